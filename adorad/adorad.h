@@ -18,11 +18,28 @@ Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
 #endif // _ADORAD_
 
 #define CORETEN_IMPL
+#define CORETEN_INCLUDE_HASH_H
     #include <adorad/core/adcore.h>
 #undef CORETEN_IMPL
 
 #include <adorad/compiler/types.h>
+#include <adorad/compiler/intern.h>
 #include <adorad/compiler/tokens.h>
 #include <adorad/compiler/lexer.h>
+#include <adorad/compiler/unicode.h>
 #include <adorad/compiler/ast.h>
+#include <adorad/compiler/number.h>
+#include <adorad/compiler/fold.h>
 #include <adorad/compiler/parser.h>
+#include <adorad/compiler/frontend.h>
+#include <adorad/compiler/build.h>
+#include <adorad/compiler/graph.h>
+#include <adorad/compiler/table.h>
+#include <adorad/compiler/typestore.h>
+#include <adorad/compiler/comptime.h>
+#include <adorad/compiler/cgen.h>
+#include <adorad/compiler/tensor.h>
+#include <adorad/compiler/server.h>
+#include <adorad/compiler/cache.h>
+#include <adorad/compiler/stats.h>
+#include <adorad/compiler/trace.h>
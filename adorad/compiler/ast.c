@@ -11,4 +11,123 @@ SPDX-License-Identifier: MIT
 Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
 */
 
-#include <adorad/compiler/ast.h>
\ No newline at end of file
+#include <adorad/compiler/ast.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <adorad/core/debug.h>
+
+// Names of the `AstNodeKind`s (see `ast_node_kind_str()`)
+static const char* const ast_node_kind_names[] = {
+    "Identifier", "Block", "FuncPrototype", "FuncDecl", "IntLiteral", "FloatLiteral", "CharLiteral", "StringLiteral",
+    "BoolLiteral", "NilLiteral", "EnumDecl", "UnionDecl", "VariableDecl", "FuncCallExpr", "IfExpr", "LoopInfExpr",
+    "LoopCExpr", "LoopInExpr", "MatchExpr", "CatchExpr", "BinaryOpExpr", "PrefixOpExpr", "FieldAccessExpr",
+    "AttributeExpr", "GroupedExpr", "TypeExpr", "InitExpr", "SliceExpr", "ArrayAccessExpr", "ArrayType",
+    "InferredArrayType", "StructExpr", "EnumExpr", "ArrayInitExpr", "ModuleStatement", "UseStatement", "TypeDecl",
+    "Break", "Continue", "ParamDecl", "ParamList", "Defer", "Return", "Unreachable", "MatchBranch", "MatchRange",
+    "Optional", "TopLevelComptime", "Root",
+};
+
+CORETEN_STATIC_ASSERT(sizeof(ast_node_kind_names) / sizeof(ast_node_kind_names[0]) == AstNodeKindRoot + 1);
+
+// Smallest number of nodes (and of `extra` words) an `Ast` is created with
+#define AST_MIN_CAPACITY    64
+
+static void ast_grow_nodes(Ast* ast, UInt32 cap) {
+    ast->kinds = cast(UInt8*)realloc(ast->kinds, cap * sizeof(UInt8));
+    ast->main_tokens = cast(UInt32*)realloc(ast->main_tokens, cap * sizeof(UInt32));
+    ast->data = cast(AstNodeData*)realloc(ast->data, cap * sizeof(AstNodeData));
+    CORETEN_ENFORCE(SOME(ast->kinds) && SOME(ast->main_tokens) && SOME(ast->data), 
+                    "Could not allocate memory. Memory full.");
+    ast->cap = cap;
+}
+
+static void ast_grow_extra(Ast* ast, UInt32 cap) {
+    ast->extra = cast(UInt32*)realloc(ast->extra, cap * sizeof(UInt32));
+    CORETEN_ENFORCE_NN(ast->extra, "Could not allocate memory. Memory full.");
+    ast->extra_cap = cap;
+}
+
+Ast* ast_new(UInt32 cap) {
+    Ast* ast = cast(Ast*)calloc(1, sizeof(Ast));
+    CORETEN_ENFORCE_NN(ast, "Could not allocate memory. Memory full.");
+    ast_grow_nodes(ast, cap < AST_MIN_CAPACITY ? AST_MIN_CAPACITY : cap);
+    ast_grow_extra(ast, AST_MIN_CAPACITY);
+    // Node 0 is the Root. Its range of top-level nodes is filled in once they're parsed
+    ast_add_node(ast, AstNodeKindRoot, 0, 0, 0);
+    return ast;
+}
+
+void ast_free(Ast* ast) {
+    if(SOME(ast)) {
+        free(ast->kinds);
+        free(ast->main_tokens);
+        free(ast->data);
+        free(ast->extra);
+        free(ast);
+    }
+}
+
+AstIndex ast_add_node(Ast* ast, AstNodeKind kind, UInt32 main_token, AstIndex lhs, AstIndex rhs) {
+    if(CORETEN_UNLIKELY(ast->len == ast->cap)) {
+        CORETEN_ENFORCE(ast->cap <= UInt32_MAX / 2, "Too many AST nodes");
+        ast_grow_nodes(ast, ast->cap * 2);
+    }
+    AstIndex node = ast->len++;
+    ast->kinds[node] = cast(UInt8)kind;
+    ast->main_tokens[node] = main_token;
+    ast->data[node] = (AstNodeData){ lhs, rhs };
+    return node;
+}
+
+void ast_truncate(Ast* ast, UInt32 len) {
+    CORETEN_ENFORCE(len >= 1 && len <= ast->len, "Invalid AST length");
+    ast->len = len;
+}
+
+void ast_clear(Ast* ast) {
+    ast->len = 1;
+    ast->extra_len = 0;
+    ast_set_node(ast, 0, 0, 0, 0);
+}
+
+AstIndex ast_reserve_node(Ast* ast, AstNodeKind kind) {
+    return ast_add_node(ast, kind, 0, AST_NULL, AST_NULL);
+}
+
+void ast_set_node(Ast* ast, AstIndex node, UInt32 main_token, AstIndex lhs, AstIndex rhs) {
+    CORETEN_ENFORCE(node < ast->len, "Invalid AST node");
+    ast->main_tokens[node] = main_token;
+    ast->data[node] = (AstNodeData){ lhs, rhs };
+}
+
+UInt32 ast_add_extra(Ast* ast, const UInt32* words, UInt32 n) {
+    if(ast->extra_len + n > ast->extra_cap) {
+        UInt32 cap = ast->extra_cap;
+        while(cap < ast->extra_len + n) {
+            CORETEN_ENFORCE(cap <= UInt32_MAX / 2, "Too much AST data");
+            cap *= 2;
+        }
+        ast_grow_extra(ast, cap);
+    }
+    UInt32 start = ast->extra_len;
+    if(n > 0)
+        memcpy(ast->extra + start, words, n * sizeof(UInt32));
+    ast->extra_len += n;
+    return start;
+}
+
+AstRange ast_add_list(Ast* ast, const AstIndex* nodes, UInt32 n) {
+    UInt32 start = ast_add_extra(ast, nodes, n);
+    return (AstRange){ start, start + n };
+}
+
+UInt64 ast_memory(Ast* ast) {
+    return sizeof(Ast) 
+         + cast(UInt64)ast->cap * (sizeof(UInt8) + sizeof(UInt32) + sizeof(AstNodeData))
+         + cast(UInt64)ast->extra_cap * sizeof(UInt32);
+}
+
+const char* ast_node_kind_str(AstNodeKind kind) {
+    return cast(UInt32)kind <= AstNodeKindRoot ? ast_node_kind_names[kind] : "Unknown";
+}
@@ -18,6 +18,10 @@ Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
 #include <adorad/core/vector.h>
 #include <adorad/compiler/location.h>
 #include <adorad/compiler/tokens.h>
+#include <adorad/compiler/intern.h>
+
+// NB: Names (of variables, functions, labels, modules, fields, etc) and string literals are stored as `SymbolId`s
+// (see <adorad/compiler/intern.h>), so they can be compared with `==`.
 
 typedef struct AstNode AstNode;
 typedef enum AstNodeKind AstNodeKind;
@@ -86,6 +90,7 @@ enum AstNodeKind {
     AstNodeKindMatchRange,
     AstNodeKindOptional,
     AstNodeKindTopLevelComptime,
+    AstNodeKindRoot,           // the whole file (only used by the index-based `Ast`)
 };
 
 typedef enum {
@@ -104,7 +109,7 @@ typedef enum {
 // The `[]` before a function/variable
 // Eg: [inline], [comptime]
 typedef struct {
-    Buff* name;   // [inline]
+    SymbolId name;   // [inline]
 } AstNodeAttribute;
 
 typedef struct {
@@ -156,7 +161,7 @@ typedef struct {
 
 // `loop i = 3; i < 10; i+=1 { ... }`
 typedef struct {
-    Buff* label;
+    SymbolId label;
     AstNode* init;
     bool has_init;
     AstNode* cond;
@@ -168,9 +173,9 @@ typedef struct {
 
 // `loop arg in args { ... }'
 typedef struct {
-    Buff* label;
-    Buff* key_var;
-    Buff* val_var;
+    SymbolId label;
+    SymbolId key_var;
+    SymbolId val_var;
     bool is_val_var_mutable;
     AstNode* cond;
     bool is_range;
@@ -179,7 +184,7 @@ typedef struct {
 } AstNodeLoopInExpr;
 
 typedef struct {
-    Buff* label;
+    SymbolId label;
     bool is_inline;
     union {
         AstNodeLoopInfExpr* loop_inf_expr;
@@ -227,11 +232,11 @@ typedef struct {
 
 // `try expr`
 typedef struct {
-    Buff* symbol;
+    SymbolId symbol;
     AstNode* target_node;
     AstNode* then_node;
     AstNode* else_node;
-    Buff* err_symbol;
+    SymbolId err_symbol;
 } AstNodeTryExpr;
 
 typedef enum {
@@ -346,14 +351,14 @@ typedef struct {
 } AstNodeExpression;
 
 typedef struct {
-    Buff* name;
+    SymbolId name;
     VisibilityMode visibility;
     Vec* fields;
     Vec* attributes;
 } AstNodeEnumDecl;
 
 typedef struct {
-    Buff* name;
+    SymbolId name;
     Vec* fields;    // variables, etc
     Vec* methods;   // methods
 } AstNodeStructDecl;
@@ -371,25 +376,25 @@ typedef struct {
 } AstNodeTypeDecl;
 
 typedef struct {
-    Buff* module;    // globals declared in a module persist through that module
+    SymbolId module;    // globals declared in a module persist through that module
     bool is_block;   // `global ( ... )`
     Vec* fields;     // various global declarations
 } AstNodeGlobalDecl;
 
 typedef struct {
-    Buff* name;
+    SymbolId name;
     VisibilityMode visibility;
     Vec* variant_types; // Vec<AstNodeType*>
 } AstNodeSumTypeDecl;
 
 // Function or Method Declaration
 typedef struct {
-    Buff* module;         // name of the module
-    Buff* name;
+    SymbolId module;         // name of the module
+    SymbolId name;
     AstNode* params;
     AstNode* body;        // can be nullptr for no-body functions (just declarations)
     AstNode* return_type;
-    Buff* parent_type;    // the `type` of which the function belongs to (null, if not a method)
+    SymbolId parent_type;    // the `type` of which the function belongs to (null, if not a method)
     // bool is_generic;      // TODO
 
     bool is_main;         // true for `func main()`
@@ -415,7 +420,7 @@ typedef struct {
 //     | AstNodeGlobalDecl
 //     | AstNodeSumTypeDecl 
 typedef struct {
-    Buff* name;
+    SymbolId name;
     VisibilityMode visibility;
     union {
         AstNodeTypeDecl* type_decl;
@@ -436,13 +441,13 @@ typedef struct {
 
 // `{ ... }`
 typedef struct {
-    Buff* label; // for labeled block statements
+    SymbolId label; // for labeled block statements
     Vec* statements;
 } AstNodeBlock;
 
 // break/continue
 typedef struct {
-    Buff* name;
+    SymbolId name;
     AstNode* expr;  // can be nullptr (`break`). always nullptr for `continue`
     enum {
         AstNodeBranchStatementBreak,
@@ -456,13 +461,13 @@ typedef struct {
 
 // `use foo` or `from foo use bar`
 typedef struct {
-    Buff* name;
-    Buff* alias; // can be null
+    SymbolId name;
+    SymbolId alias; // can be null
 } AstNodeUseStatement;
 
 typedef struct {
-    Buff* name;
-    Buff* short_name;
+    SymbolId name;
+    SymbolId short_name;
     bool is_skip;
     VisibilityMode visibility;
 } AstNodeModuleStatement;
@@ -472,7 +477,7 @@ typedef struct {
 } AstNodeReturnStatement;
 
 typedef struct {
-    Buff* name;
+    SymbolId name;
     AstNode* type;    // can be null
     AstNode* expr;
 
@@ -515,7 +520,7 @@ typedef struct {
 } AstNodeByteLiteral;
 
 typedef struct {
-    Buff* value;
+    double number;  // converted by the Parser (see <adorad/compiler/number.h>)
     // TODO (jasmcaus) - Come up with a workaround for this
     enum {
         AstNodeFloatLiteral32,    // default
@@ -525,7 +530,7 @@ typedef struct {
 } AstNodeFloatLiteral;
 
 typedef struct {
-    Buff* value;
+    UInt64 number;  // converted by the Parser (see <adorad/compiler/number.h>)
     // TODO (jasmcaus) - Come up with a workaround for this
     enum {
         AstNodeIntegerLiteral8,  // i8
@@ -542,11 +547,12 @@ typedef struct {
 } AstNodeIntegerLiteral;
 
 typedef struct {
-    Buff* value;
+    SymbolId value;    // as spelled (escapes included)
 } AstNodeCharLiteral;
 
 typedef struct {
-    Buff* value;
+    SymbolId value;    // as spelled (escapes included - see `parser_string_value()`)
+    bool has_escapes;  // see `TOKEN_FLAG_HAS_ESCAPES`
     bool is_special;   // format / raw string
     enum {
         AstNodeStringLiteralNone,   // if `is_special` is false
@@ -574,21 +580,21 @@ typedef struct {
 } AstNodeLiteral;
 
 typedef struct {
-    Buff* module;
-    Buff* name;
+    SymbolId module;
+    SymbolId name;
     AstNode* expr;
     AstNodeLiteral* literal;
     VisibilityMode visibility;
 } AstNodeConstField;
 
 typedef struct {
-    Buff* name;
+    SymbolId name;
     AstNode* expr;
     bool has_expr;
 } AstNodeGlobalField;
 
 typedef struct {
-    Buff* name;
+    SymbolId name;
     AstNode* type_expr;
     AstNode* init_expr;
     bool is_local;     // false, for global vars
@@ -605,7 +611,7 @@ typedef struct {
 //     | AstNodeGlobalField
 //     | AstNodeVariable
 typedef struct {
-    Buff* name;
+    SymbolId name;
     union {
         AstNodeConstField* const_field;
         AstNodeGlobalField* global_field;
@@ -615,7 +621,7 @@ typedef struct {
 } AstNodeScopeObject;
 
 typedef struct {
-    Buff* name;
+    SymbolId name;
     AstNode* type;
     bool is_alias;
     bool is_var_args;
@@ -627,12 +633,12 @@ typedef struct {
 } AstNodeParamList;
 
 typedef struct {
-    Buff* name;   // can be nullptr if no name
+    SymbolId name;   // can be nullptr if no name
     AstNode* body;
 } AstNodeTestDecl;
 
 typedef struct {
-    Buff* symbol;
+    SymbolId symbol;
     AstNode* target_node;
     AstNode* then_node;
     AstNode* else_node;  // null, block node, or an `if expr` node
@@ -644,6 +650,7 @@ typedef enum {
     PrefixOpKindNegation,  // !var
     PrefixOpKindAddrOf,    // &var
     PrefixOpKindOptional,  // ?
+    PrefixOpKindMinus,     // -var
 } PrefixOpKind;
 
 typedef struct {
@@ -673,7 +680,7 @@ typedef struct {
 
 typedef struct {
     AstNode* struct_expr;
-    Buff* field_name;
+    SymbolId field_name;
 } AstNodeFieldAccessExpr;
 
 typedef struct {
@@ -682,6 +689,7 @@ typedef struct {
 
 struct AstNode {
     AstNodeKind kind; // type of AST Node
+    UInt32 index;     // of the node in the Parser's index-based AST (an `AstIndex` - AST_NULL if it isn't in it)
     Loc* loc;
 
     union {
@@ -705,4 +713,119 @@ struct AstNode {
     } data;
 };
 
+// Typed accessors for the Parser's `Vec`s of `AstNode`s
+VEC_DEFINE(AstNode)
+
+/*
+    Index-based AST
+    An alternative (struct-of-arrays) encoding of the AST: node `i` is `kinds[i]`, `main_tokens[i]` and `data[i]`, and
+    children are referred to by their (32-bit) index instead of by pointer. That's 13 bytes per node (as opposed to an 
+    `AstNode` and its payloads), traversals only touch the arrays they need, and an `Ast` can be written out (and read
+    back) as is - there are no pointers to fix up.
+
+    Every node has a "main token" (an index into the Parser's token list - eg. the operator of a binary expression, or
+    the identifier of an identifier) and two 32-bit slots, `lhs` and `rhs`. Nodes that need more than that keep the
+    rest in `extra` and store its index in one of the slots. What the slots hold depends on the kind of the node:
+
+        Kind                | main token      | lhs                    | rhs
+        --------------------|-----------------|------------------------|-----------------------------
+        Root                | first token     | start of `extra` range | end of `extra` range (top-level nodes)
+        Identifier          | the identifier  | -                      | -
+        *Literal            | the literal     | -                      | -
+        BinaryOpExpr        | the operator    | left operand           | right operand
+        PrefixOpExpr        | the operator    | operand                | -
+        GroupedExpr         | `(`             | expression             | -
+        FieldAccessExpr     | the field name  | struct expression      | -
+        ArrayAccessExpr     | `[`             | array expression       | subscript
+        FuncCallExpr        | `(`             | callee                 | `extra` index of an `AstRange` (arguments)
+        IfExpr              | `if`            | condition              | `extra` index of an `AstIf`
+        Block               | `{`             | start of `extra` range | end of `extra` range (statements)
+        VariableDecl        | the name        | type expression        | initializer
+        FuncDecl            | `func`          | `extra` index of an `AstFuncProto` | body
+        Return / Defer      | the keyword     | expression             | -
+        Break / Continue    | the keyword     | value (`break` only)   | -
+        ModuleStatement     | the module name | -                      | -
+        UseStatement        | the module name | -                      | -
+
+    `-` (and any absent child) is AST_NULL. Node 0 is always the Root, so no other node can refer to it as a child.
+
+    The Parser emits its nodes into `Parser.ast` as it parses them (children first), next to the node tree. Nodes of
+    productions the Parser doesn't handle yet (eg. function bodies) aren't in it, and neither are the operands of a
+    folded constant (whose main token is then its operator - see <adorad/compiler/fold.h>). Nodes may be left
+    behind that nothing refers to: those of a declaration that failed to parse, or that `parser_reparse()` replaced.
+*/
+
+typedef UInt32 AstIndex;
+
+// "No node". This is the index of the Root, which is never anyone's child
+#define AST_NULL        0
+
+typedef struct AstNodeData {
+    AstIndex lhs;
+    AstIndex rhs;
+} AstNodeData;
+
+// A range `[start, end)` of `extra` (eg. the arguments of a function call)
+typedef struct AstRange {
+    UInt32 start;
+    UInt32 end;
+} AstRange;
+
+// Stored in `extra` for IfExpr nodes
+typedef struct AstIf {
+    AstIndex then_body;
+    AstIndex else_body;
+} AstIf;
+
+// Stored in `extra` for FuncDecl nodes
+typedef struct AstFuncProto {
+    UInt32 params_start;    // range of `extra` holding the ParamDecl nodes
+    UInt32 params_end;
+    AstIndex return_type;
+} AstFuncProto;
+
+typedef struct Ast {
+    UInt8* kinds;           // `AstNodeKind` of each node
+    UInt32* main_tokens;
+    AstNodeData* data;
+    UInt32 len;             // number of nodes
+    UInt32 cap;
+
+    UInt32* extra;          // extra data of the nodes that don't fit in `data`
+    UInt32 extra_len;
+    UInt32 extra_cap;
+} Ast;
+
+CORETEN_STATIC_ASSERT(AstNodeKindRoot <= UInt8_MAX);
+
+// Create an `Ast` with room for `cap` nodes. Its Root (node 0) is added right away
+Ast* ast_new(UInt32 cap);
+void ast_free(Ast* ast);
+// Add a node, and return its index
+AstIndex ast_add_node(Ast* ast, AstNodeKind kind, UInt32 main_token, AstIndex lhs, AstIndex rhs);
+// Reserve the index of a node whose children haven't been parsed yet. Fill it in later with `ast_set_node()`
+AstIndex ast_reserve_node(Ast* ast, AstNodeKind kind);
+void ast_set_node(Ast* ast, AstIndex node, UInt32 main_token, AstIndex lhs, AstIndex rhs);
+// Drop the nodes from the `len`th on (`len` >= 1: the Root is kept)
+void ast_truncate(Ast* ast, UInt32 len);
+// Drop every node but the Root (whose range of top-level nodes is then empty), and all of `extra`
+void ast_clear(Ast* ast);
+// Append `n` words to `extra`, and return the index of the first one
+UInt32 ast_add_extra(Ast* ast, const UInt32* words, UInt32 n);
+// Append a list of nodes to `extra`, and return its range
+AstRange ast_add_list(Ast* ast, const AstIndex* nodes, UInt32 n);
+// Memory used by `ast` (in bytes)
+UInt64 ast_memory(Ast* ast);
+// Name of `kind` (eg. "BinaryOpExpr")
+const char* ast_node_kind_str(AstNodeKind kind);
+
+#define AST_KIND(ast, node)         (cast(AstNodeKind)(ast)->kinds[(node)])
+#define AST_MAIN_TOKEN(ast, node)   ((ast)->main_tokens[(node)])
+#define AST_LHS(ast, node)          ((ast)->data[(node)].lhs)
+#define AST_RHS(ast, node)          ((ast)->data[(node)].rhs)
+// Append a struct made of `UInt32`s (eg. `AstIf`) to `extra`
+#define AST_ADD_EXTRA(ast, value)   ast_add_extra((ast), cast(const UInt32*)&(value), sizeof(value) / sizeof(UInt32))
+// Read a struct made of `UInt32`s (eg. `AstIf`) back from `extra`
+#define AST_EXTRA(ast, strct, i)    (*cast(strct*)&(ast)->extra[(i)])
+
 #endif // ADORAD_AST_H
\ No newline at end of file
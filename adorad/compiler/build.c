@@ -0,0 +1,475 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <adorad/core/debug.h>
+#include <adorad/core/map.h>
+#include <adorad/core/thread.h>
+#include <adorad/compiler/build.h>
+#include <adorad/compiler/trace.h>
+
+// A bounded (FIFO) queue of file indices between two stages of the pipeline
+typedef struct BuildQueue {
+    UInt32* items;
+    UInt32 cap;
+    UInt32 head;        // index (in `items`) of the oldest file
+    UInt32 len;
+    bool is_closed;     // set once the stage before has pushed every file
+    Mutex mutex;
+    CondVar not_empty;
+    CondVar not_full;
+} BuildQueue;
+
+// A stage of the pipeline, and the thread it runs on
+typedef struct BuildWorker {
+    Build* build;
+    BuildStage stage;
+    BuildQueue* in;     // where files come from (null for the first stage - which goes through them in order)
+    BuildQueue* out;    // where they go next (null for the last stage)
+    Thread thread;
+} BuildWorker;
+
+typedef void (*BuildStageFunc)(Build* build, BuildFile* file);
+
+static void build_queue_init(BuildQueue* queue, UInt32 cap) {
+    memset(queue, 0, sizeof(BuildQueue));
+    queue->items = cast(UInt32*)calloc(cap, sizeof(UInt32));
+    CORETEN_ENFORCE_NN(queue->items, "Could not allocate memory. Memory full.");
+    queue->cap = cap;
+    mutex_init(&queue->mutex);
+    condvar_init(&queue->not_empty);
+    condvar_init(&queue->not_full);
+}
+
+static void build_queue_destroy(BuildQueue* queue) {
+    free(queue->items);
+    mutex_destroy(&queue->mutex);
+    condvar_destroy(&queue->not_empty);
+    condvar_destroy(&queue->not_full);
+}
+
+// Push `index`, waiting for room if the queue is full
+static void build_queue_push(BuildQueue* queue, UInt32 index) {
+    mutex_lock(&queue->mutex);
+    while(queue->len == queue->cap)
+        condvar_wait(&queue->not_full, &queue->mutex);
+    queue->items[(queue->head + queue->len++) % queue->cap] = index;
+    condvar_signal(&queue->not_empty);
+    mutex_unlock(&queue->mutex);
+}
+
+// Pop the oldest file into `index`, waiting for one if the queue is empty. Returns false once the queue is empty and
+// closed
+static bool build_queue_pop(BuildQueue* queue, UInt32* index) {
+    mutex_lock(&queue->mutex);
+    while(queue->len == 0 && !queue->is_closed)
+        condvar_wait(&queue->not_empty, &queue->mutex);
+    bool is_some = queue->len > 0;
+    if(is_some) {
+        *index = queue->items[queue->head];
+        queue->head = (queue->head + 1) % queue->cap;
+        queue->len--;
+        condvar_signal(&queue->not_full);
+    }
+    mutex_unlock(&queue->mutex);
+    return is_some;
+}
+
+static void build_queue_close(BuildQueue* queue) {
+    mutex_lock(&queue->mutex);
+    queue->is_closed = true;
+    condvar_broadcast(&queue->not_empty);
+    mutex_unlock(&queue->mutex);
+}
+
+const char* build_stage_str(BuildStage stage) {
+    switch(stage) {
+        case BuildStageRead: return "read";
+        case BuildStageLex: return "lex";
+        case BuildStageParse: return "parse";
+        case BuildStageCheck: return "check";
+        case BuildStageEmit: return "emit";
+        case BuildStageCount: break;
+    }
+    return "<invalid stage>";
+}
+
+// Report a diagnostic about `[offset, offset + len)` of `file`
+ATTRIBUTE_PRINTF(6, 7)
+static void build_report(BuildFile* file, DiagnosticLevel level, Error err, UInt32 offset, UInt32 len,
+                         const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    diagnostics_vreport(file->diags, level, err, lexer_loc(file->lexer, offset), offset, offset + len, format, args);
+    va_end(args);
+}
+
+static void build_stage_read(Build* build, BuildFile* file) {
+    file->diags = diagnostics_new(build->options.max_errors);
+    if(build->options.keep_stats) {
+        file->stats = stats_new();
+        file->stats->num_files = 1;
+    }
+    STATS_TIME_PHASE(file->stats, StatsPhaseRead) {
+        file->view = file_map(file->fname);
+    }
+    if(file->view.error != 0) {
+        Buff* fname = buff_new(file->fname);
+        Location loc = { 0, 0, fname };
+        Error err = file->view.error == ENOENT ? ErrorFileNotFound : ErrorFileNotReadable;
+        diagnostics_report(file->diags, DiagnosticLevelError, err, loc, 0, 0, "Cannot open file: %s", 
+                           strerror(file->view.error));
+        buff_free(fname);
+        return;
+    }
+    if(!file->view.is_mapped)
+        STATS_COUNT_ALLOC(file->stats, StatsPhaseRead, file->view.len + FILE_VIEW_PADDING);
+}
+
+static void build_stage_lex(Build* build, BuildFile* file) {
+    if(NONE(file->view.data))
+        return;
+    file->lexer = lexer_init_view(&file->view, file->fname);
+    lexer_set_interner(file->lexer, build->interner);
+    lexer_set_diagnostics(file->lexer, file->diags);
+    lexer_set_stats(file->lexer, file->stats);
+    lexer_lex(file->lexer);
+    file->num_tokens = vec_size(file->lexer->toklist);
+}
+
+static void build_stage_parse(Build* build, BuildFile* file) {
+    if(NONE(file->lexer))
+        return;
+    file->parser = parser_init(file->lexer);
+    file->parser->id = cast(UInt32)(file - build->files);
+    file->ok = parser_parse(file->parser);
+}
+
+// Offset of the `n`th token of the top-level declaration `decl`
+static UInt32 build_decl_offset(BuildFile* file, ParserDecl* decl, UInt32 n) {
+    return vec_at_Token(file->lexer->toklist, decl->first_token + n)->offset;
+}
+
+// Find the module of `file`, and the modules it uses
+static void build_check_decls(BuildFile* file) {
+    Parser* parser = file->parser;
+    bool has_module = false;
+    for(UInt64 i = 0; i < vec_size(parser->nodelist); i++) {
+        AstNode* node = vec_at_AstNode(parser->nodelist, i);
+        ParserDecl* decl = vec_at_ParserDecl(parser->decls, i);
+        if(node->kind == AstNodeKindModuleStatement) {
+            const char* name = interner_str(parser->interner, node->data.stmt->module_stmt->name);
+            UInt32 offset = build_decl_offset(file, decl, 1);
+            if(has_module) {
+                build_report(file, DiagnosticLevelError, ErrorModuleMismatch, offset, cast(UInt32)strlen(name),
+                             "A file can only be part of one module (this one is already part of `%s`)",
+                             file->module);
+            } else if(i > 0) {
+                build_report(file, DiagnosticLevelError, ErrorSyntaxError, build_decl_offset(file, decl, 0), 6,
+                             "The `module` declaration must come first");
+            }
+            if(!has_module) {
+                file->module = name;
+                file->module_offset = offset;
+                has_module = true;
+            }
+        } else if(node->kind == AstNodeKindUseStatement) {
+            BuildUse use = { interner_str(parser->interner, node->data.stmt->use_stmt->name),
+                             build_decl_offset(file, decl, 1) };
+            bool is_dup = false;
+            for(UInt64 j = 0; j < vec_size(file->uses) && !is_dup; j++)
+                is_dup = strcmp(vec_at_BuildUse(file->uses, j)->name, use.name) == 0;
+            if(is_dup)
+                build_report(file, DiagnosticLevelWarning, ErrorNone, use.offset, cast(UInt32)strlen(use.name),
+                             "Module `%s` is already used", use.name);
+            else
+                vec_push_BuildUse(file->uses, &use);
+        }
+    }
+}
+
+static void build_stage_check(Build* build, BuildFile* file) {
+    file->module = BUILD_DEFAULT_MODULE;
+    if(NONE(file->parser))
+        return;
+    STATS_TIME_PHASE(file->stats, StatsPhaseCheck) {
+        file->uses = VEC_NEW(BuildUse, 8);
+        build_check_decls(file);
+    }
+}
+
+static void build_stage_emit(Build* build, BuildFile* file) {
+    file->ok = file->ok && file->diags->num_errors == 0 && file->diags->num_dropped == 0;
+    if(!file->ok || NONE(build->options.emit))
+        return;
+    STATS_TIME_PHASE(file->stats, StatsPhaseCodegen) {
+        file->ok = build->options.emit(build, file, build->options.emit_arg);
+    }
+}
+
+static const BuildStageFunc build_stage_funcs[BuildStageCount] = {
+    build_stage_read, build_stage_lex, build_stage_parse, build_stage_check, build_stage_emit
+};
+
+// Run a stage of the pipeline on every file, in order
+static void* build_run_stage(void* arg) {
+    BuildWorker* worker = cast(BuildWorker*)arg;
+    Build* build = worker->build;
+    BuildStageCounters* counters = &build->stages[worker->stage];
+    const char* stage = build_stage_str(worker->stage);
+    trace_thread_name(stage);
+    UInt32 next = 0;
+    for(;;) {
+        UInt64 start = stats_now();
+        UInt32 index = next++;
+        if(SOME(worker->in) ? !build_queue_pop(worker->in, &index) : index >= build->num_files) {
+            counters->stalled_ns += stats_now() - start;
+            break;
+        }
+        UInt64 begin = stats_now();
+        counters->stalled_ns += begin - start;
+        TRACE_ZONE(stage, build->files[index].fname) {
+            build_stage_funcs[worker->stage](build, &build->files[index]);
+        }
+        UInt64 end = stats_now();
+        counters->busy_ns += end - begin;
+        counters->num_files++;
+        if(SOME(worker->out)) {
+            build_queue_push(worker->out, index);
+            counters->stalled_ns += stats_now() - end;
+        }
+    }
+    if(SOME(worker->out))
+        build_queue_close(worker->out);
+    return null;
+}
+
+// Length of the directory part of `fname` (up to its last separator), or 0 if it has none
+static UInt64 build_dirname_len(const char* fname) {
+    UInt64 len = strlen(fname);
+    while(len > 0 && !(fname[len - 1] == '/' || fname[len - 1] == CORETEN_OS_SEP_CHAR))
+        len--;
+    return len;
+}
+
+// Group the files into modules, and check that every `use` names one of them
+static void build_resolve(Build* build) {
+    build->modules = VEC_NEW(BuildModule, 8);
+    Map* modules = map_new(MapKeyKindStr, 0, null);
+    // Directory -> 1 + the index of its first file
+    Map* dirs = map_new(MapKeyKindStr, 0, null);
+    for(UInt32 i = 0; i < build->num_files; i++) {
+        BuildFile* file = &build->files[i];
+        if(NONE(file->parser))
+            continue;
+        bool is_new;
+        MapEntry* entry = map_insert_str(modules, buffview_new_from_len(cast(char*)file->module, strlen(file->module)),
+                                         &is_new);
+        if(is_new) {
+            BuildModule module = { file->module, i, 0 };
+            vec_push_BuildModule(build->modules, &module);
+            entry->value = cast(void*)cast(UInt64)vec_size(build->modules);
+        }
+        vec_at_BuildModule(build->modules, cast(UInt64)entry->value - 1)->num_files++;
+
+        entry = map_insert_str(dirs, buffview_new_from_len(file->fname, build_dirname_len(file->fname)), &is_new);
+        if(is_new) {
+            entry->value = cast(void*)cast(UInt64)(i + 1);
+            continue;
+        }
+        BuildFile* first = &build->files[cast(UInt64)entry->value - 1];
+        if(strcmp(first->module, file->module) != 0) {
+            build_report(file, DiagnosticLevelError, ErrorModuleMismatch, file->module_offset,
+                         cast(UInt32)strlen(file->module),
+                         "`%s` is part of module `%s`, but `%s` (in the same directory) is part of module `%s`",
+                         file->fname, file->module, first->fname, first->module);
+            file->ok = false;
+        }
+    }
+
+    Map* externs = map_new(MapKeyKindStr, build->options.num_extern_modules, null);
+    for(UInt32 i = 0; i < build->options.num_extern_modules; i++) {
+        const char* name = build->options.extern_modules[i];
+        map_insert_str(externs, buffview_new_from_len(cast(char*)name, strlen(name)), null);
+    }
+    for(UInt32 i = 0; i < build->num_files; i++) {
+        BuildFile* file = &build->files[i];
+        for(UInt64 j = 0; SOME(file->uses) && j < vec_size(file->uses); j++) {
+            BuildUse* use = vec_at_BuildUse(file->uses, j);
+            BuffView name = buffview_new_from_len(cast(char*)use->name, strlen(use->name));
+            if(NONE(map_find_str(modules, name)) && NONE(map_find_str(externs, name))) {
+                build_report(file, DiagnosticLevelError, ErrorModuleNotFound, use->offset,
+                             cast(UInt32)strlen(use->name), "Unknown module `%s`", use->name);
+                file->ok = false;
+            }
+        }
+    }
+    map_free(externs);
+    map_free(dirs);
+    map_free(modules);
+}
+
+static int build_compare_names(const void* a, const void* b) {
+    return strcmp(*cast(char* const*)a, *cast(char* const*)b);
+}
+
+static bool build_find_file(const char* path, void* arg) {
+    UInt64 len = strlen(path);
+    if(len > 3 && strcmp(path + len - 3, ".ad") == 0) {
+        UInt64 size = len + 1;
+        char* copy = cast(char*)malloc(size);
+        CORETEN_ENFORCE_NN(copy, "Could not allocate memory. Memory full.");
+        memcpy(copy, path, size);
+        vec_push(cast(Vec*)arg, &copy);
+    }
+    return true;
+}
+
+Vec* build_find_files(const char* dir) {
+    Vec* fnames = VEC_NEW(char*, 16);
+    if(!dir_walk(dir, build_find_file, fnames)) {
+        for(UInt64 i = 0; i < vec_size(fnames); i++)
+            free(*cast(char**)vec_at(fnames, i));
+        vec_free(fnames);
+        return null;
+    }
+    // File systems list directories in no particular order
+    if(vec_size(fnames) > 0)
+        qsort(vec_begin(fnames), vec_size(fnames), sizeof(char*), build_compare_names);
+    return fnames;
+}
+
+Build* build_files(const char** fnames, UInt32 num_files, BuildOptions* options) {
+    UInt64 start = stats_now();
+    Build* build = cast(Build*)calloc(1, sizeof(Build));
+    CORETEN_ENFORCE_NN(build, "Could not allocate memory. Memory full.");
+    if(SOME(options))
+        build->options = *options;
+    if(build->options.queue_depth == 0)
+        build->options.queue_depth = BUILD_DEFAULT_QUEUE_DEPTH;
+    build->files = cast(BuildFile*)calloc(num_files > 0 ? num_files : 1, sizeof(BuildFile));
+    CORETEN_ENFORCE_NN(build->files, "Could not allocate memory. Memory full.");
+    build->num_files = num_files;
+    for(UInt32 i = 0; i < num_files; i++) {
+        UInt64 size = strlen(fnames[i]) + 1;
+        build->files[i].fname = cast(char*)malloc(size);
+        CORETEN_ENFORCE_NN(build->files[i].fname, "Could not allocate memory. Memory full.");
+        memcpy(build->files[i].fname, fnames[i], size);
+    }
+    build->diags = diagnostics_new(build->options.max_errors);
+    build->stats = build->options.keep_stats ? stats_new() : null;
+    // Files are lexed on one thread, and parsed (and checked) on others
+    build->interner = interner_new_shared();
+
+    // One thread per stage: the calling thread runs the last one
+    BuildQueue queues[BuildStageCount - 1];
+    BuildWorker workers[BuildStageCount];
+    for(UInt32 i = 0; i < BuildStageCount - 1; i++)
+        build_queue_init(&queues[i], build->options.queue_depth);
+    for(UInt32 i = 0; i < BuildStageCount; i++) {
+        workers[i].build = build;
+        workers[i].stage = cast(BuildStage)i;
+        workers[i].in = i > 0 ? &queues[i - 1] : null;
+        workers[i].out = i < BuildStageCount - 1 ? &queues[i] : null;
+    }
+    for(UInt32 i = 0; i < BuildStageCount - 1; i++)
+        CORETEN_ENFORCE(thread_start(&workers[i].thread, build_run_stage, &workers[i]), "Could not start a thread");
+    build_run_stage(&workers[BuildStageCount - 1]);
+    for(UInt32 i = 0; i < BuildStageCount - 1; i++) {
+        thread_join(&workers[i].thread);
+        build_queue_destroy(&queues[i]);
+    }
+
+    TRACE_ZONE("resolve", null) {
+        build_resolve(build);
+    }
+    build->ok = num_files > 0;
+    for(UInt32 i = 0; i < num_files; i++) {
+        BuildFile* file = &build->files[i];
+        diagnostics_merge(build->diags, file->diags);
+        if(SOME(build->stats))
+            stats_merge(build->stats, file->stats);
+        build->num_bytes += file->view.len;
+        build->num_tokens += file->num_tokens;
+        build->ok = build->ok && file->ok;
+    }
+    build->nanoseconds = stats_now() - start;
+    return build;
+}
+
+Build* build_dir(const char* dir, BuildOptions* options) {
+    Vec* fnames = build_find_files(dir);
+    if(NONE(fnames))
+        return null;
+    Build* build = build_files(cast(const char**)vec_begin(fnames), cast(UInt32)vec_size(fnames), options);
+    for(UInt64 i = 0; i < vec_size(fnames); i++)
+        free(*cast(char**)vec_at(fnames, i));
+    vec_free(fnames);
+    return build;
+}
+
+BuildModule* build_find_module(Build* build, const char* name) {
+    for(UInt64 i = 0; SOME(build->modules) && i < vec_size(build->modules); i++) {
+        BuildModule* module = vec_at_BuildModule(build->modules, i);
+        if(strcmp(module->name, name) == 0)
+            return module;
+    }
+    return null;
+}
+
+void build_print_report(Build* build, FILE* stream) {
+    double seconds = cast(double)build->nanoseconds / 1e9;
+    double per_second = seconds > 0 ? 1 / seconds : 0;
+    fprintf(stream, "Built %u file(s) in %llu module(s): %.1f KB, %llu tokens in %.3f ms\n", build->num_files,
+            cast(unsigned long long)(SOME(build->modules) ? vec_size(build->modules) : 0),
+            cast(double)build->num_bytes / 1024, cast(unsigned long long)build->num_tokens, seconds * 1e3);
+    fprintf(stream, "Throughput: %.1f files/s, %.2f MB/s, %.0f tokens/s\n", build->num_files * per_second,
+            cast(double)build->num_bytes / (1024 * 1024) * per_second, cast(double)build->num_tokens * per_second);
+    // A stage that's busy most of the time is the bottleneck: the others stall, waiting on it
+    fprintf(stream, "%-8s %8s %12s %12s %8s\n", "Stage", "Files", "Busy (ms)", "Stalled (ms)", "Busy %");
+    for(UInt32 i = 0; i < BuildStageCount; i++) {
+        BuildStageCounters* stage = &build->stages[i];
+        double busy = build->nanoseconds > 0 ? 100.0 * cast(double)stage->busy_ns / cast(double)build->nanoseconds : 0;
+        fprintf(stream, "%-8s %8llu %12.3f %12.3f %7.1f%%\n", build_stage_str(cast(BuildStage)i),
+                cast(unsigned long long)stage->num_files, cast(double)stage->busy_ns / 1e6,
+                cast(double)stage->stalled_ns / 1e6, busy);
+    }
+}
+
+void build_free(Build* build) {
+    if(SOME(build)) {
+        for(UInt32 i = 0; i < build->num_files; i++) {
+            BuildFile* file = &build->files[i];
+            // This frees the Lexer as well
+            if(SOME(file->parser))
+                parser_free(file->parser);
+            else
+                lexer_free(file->lexer);
+            file_unmap(&file->view);
+            diagnostics_free(file->diags);
+            stats_free(file->stats);
+            vec_free(file->uses);
+            free(file->fname);
+        }
+        vec_free(build->modules);
+        diagnostics_free(build->diags);
+        stats_free(build->stats);
+        interner_free(build->interner);
+        free(build->files);
+        free(build);
+    }
+}
@@ -0,0 +1,145 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#ifndef ADORAD_BUILD_H
+#define ADORAD_BUILD_H
+
+#include <stdio.h>
+
+#include <adorad/core/types.h>
+#include <adorad/core/io.h>
+#include <adorad/core/vector.h>
+#include <adorad/compiler/diagnostics.h>
+#include <adorad/compiler/lexer.h>
+#include <adorad/compiler/parser.h>
+#include <adorad/compiler/stats.h>
+
+/*
+    Build driver (`adorad build <dir>`)
+    Finds every `.ad` file under a directory and streams them through a pipeline of stages:
+
+        read -> lex -> parse -> check -> emit
+
+    Each stage runs on its own thread, and hands files on to the next one through a bounded queue (of
+    `BuildOptions.queue_depth` files). So while the first files are being checked (or emitted), the ones after them
+    are still being parsed, lexed and read - and a stage that falls behind blocks the stages before it, rather than
+    letting files pile up in memory. Files go through every stage in the same (sorted) order, so the output doesn't
+    depend on timing.
+
+    The `check` stage looks at each file on its own: its `module` declaration (files without one are part of module
+    `main`) and its `use`s. Once every file is through, `use`s are resolved against the modules the files declared,
+    and every file of a directory must be of the same module. There's no backend yet: `emit` runs
+    `BuildOptions.emit` (if set) on each file that has no errors.
+*/
+
+typedef enum BuildStage {
+    BuildStageRead,
+    BuildStageLex,
+    BuildStageParse,
+    BuildStageCheck,
+    BuildStageEmit,
+    BuildStageCount
+} BuildStage;
+
+// Number of files each queue between two stages holds, unless asked otherwise
+#define BUILD_DEFAULT_QUEUE_DEPTH   8
+// Module of files without a `module` declaration
+#define BUILD_DEFAULT_MODULE        "main"
+
+// A `use` of a file (see `BuildFile.uses`)
+typedef struct BuildUse {
+    const char* name;   // name of the module used (owned by the Build's Interner)
+    UInt32 offset;      // where the name is (in the file)
+} BuildUse;
+
+VEC_DEFINE(BuildUse)
+
+typedef struct BuildFile {
+    char* fname;
+    FileView view;      // contents of the file. Unmapped with the Build
+    Lexer* lexer;       // null if the file couldn't be read
+    Parser* parser;     // null if the file couldn't be read. `parser->id` is the index of the file
+    Diagnostics* diags; // errors in this file
+    Stats* stats;       // statistics of this file (null unless the Build keeps them)
+    const char* module; // module the file is a part of (`BUILD_DEFAULT_MODULE` if it doesn't say)
+    UInt32 module_offset; // where the module name is (in the file), if it has a `module` declaration
+    Vec* uses;          // `BuildUse`s, in the order they were made
+    UInt64 num_tokens;
+    bool ok;            // set if the file went through every stage without errors
+} BuildFile;
+
+typedef struct BuildModule {
+    const char* name;
+    UInt32 first_file;  // index of the first file of the module
+    UInt32 num_files;
+} BuildModule;
+
+VEC_DEFINE(BuildModule)
+
+typedef struct Build Build;
+
+// Called by the `emit` stage with each file that has no errors. Returns false if it failed (in which case it should
+// report why in `file->diags`)
+typedef bool (*BuildEmitFunc)(Build* build, BuildFile* file, void* arg);
+
+typedef struct BuildOptions {
+    UInt32 queue_depth; // no. of files a queue between two stages holds (BUILD_DEFAULT_QUEUE_DEPTH if 0)
+    UInt32 max_errors;  // no. of errors kept per file, and in total (see `diagnostics_new()`)
+    bool keep_stats;    // keep statistics (see `Stats`) of every file, merged into `Build.stats`
+    BuildEmitFunc emit; // if set, run on every file (that has no errors) by the `emit` stage
+    void* emit_arg;
+    // Modules that aren't part of the build, but may be used by it (eg. the ones an incremental build didn't have to
+    // rebuild - see <adorad/compiler/graph.h>)
+    const char** extern_modules;
+    UInt32 num_extern_modules;
+} BuildOptions;
+
+// What a stage of the pipeline did
+typedef struct BuildStageCounters {
+    UInt64 num_files;
+    UInt64 busy_ns;     // time spent working on files
+    UInt64 stalled_ns;  // time spent waiting - for a file to work on, or for room in the next queue
+} BuildStageCounters;
+
+struct Build {
+    BuildOptions options;
+    BuildFile* files;   // sorted by name
+    UInt32 num_files;
+    Vec* modules;       // `BuildModule`s, in the order they were first seen
+    Diagnostics* diags; // diagnostics of every file, merged in file order
+    Stats* stats;       // statistics of every file, merged (null unless `options.keep_stats`)
+    Interner* interner; // shared by the Lexer and Parser of every file (see `interner_new_shared()`)
+    BuildStageCounters stages[BuildStageCount];
+    UInt64 num_bytes;   // no. of bytes of source read
+    UInt64 num_tokens;
+    UInt64 nanoseconds; // wall-clock time of the build
+    bool ok;            // set if every file is `ok` (and there was at least one)
+};
+
+// Returns the name of `stage` (eg. "parse")
+const char* build_stage_str(BuildStage stage);
+// Returns the sorted paths of every `.ad` file under `dir` (a `Vec` of `char*`s, each to be freed with `free()`), or
+// null if `dir` couldn't be opened
+Vec* build_find_files(const char* dir);
+// Build the files `fnames[0..num_files)` (which are copied). `options` may be null (for the defaults)
+Build* build_files(const char** fnames, UInt32 num_files, BuildOptions* options);
+// Build every `.ad` file under `dir` (see `build_find_files()`). Returns null if `dir` couldn't be opened
+Build* build_dir(const char* dir, BuildOptions* options);
+// Returns the module named `name`, or null
+BuildModule* build_find_module(Build* build, const char* name);
+// Print how long the build took, how fast it went (files, bytes and tokens per second), and what each stage of the
+// pipeline did, to `stream`
+void build_print_report(Build* build, FILE* stream);
+void build_free(Build* build);
+
+#endif // ADORAD_BUILD_H
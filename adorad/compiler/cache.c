@@ -0,0 +1,200 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <adorad/core/debug.h>
+#include <adorad/core/hash.h>
+#include <adorad/compiler/cache.h>
+#include <adorad/compiler/compiler.h>
+
+// <adorad/core/endian.h> is header-only (and its functions are static): define them in this file
+#define CORETEN_IMPL
+    #include <adorad/core/endian.h>
+#undef CORETEN_IMPL
+
+#define CACHE_ALIGN(n)      (((n) + 7) & ~cast(UInt64)7)
+
+// Offsets of the sections of a cache file
+typedef struct CacheLayout {
+    UInt64 tokens;
+    UInt64 kinds;
+    UInt64 main_tokens;
+    UInt64 data;
+    UInt64 extra;
+    UInt64 size;            // size of the whole file
+} CacheLayout;
+
+static CacheLayout cache_layout(UInt64 num_tokens, UInt64 num_nodes, UInt64 num_extra) {
+    CacheLayout layout;
+    layout.tokens = sizeof(CacheHeader);
+    layout.kinds = CACHE_ALIGN(layout.tokens + num_tokens * sizeof(CompactToken));
+    layout.main_tokens = CACHE_ALIGN(layout.kinds + num_nodes * sizeof(UInt8));
+    layout.data = CACHE_ALIGN(layout.main_tokens + num_nodes * sizeof(UInt32));
+    layout.extra = CACHE_ALIGN(layout.data + num_nodes * sizeof(AstNodeData));
+    layout.size = CACHE_ALIGN(layout.extra + num_extra * sizeof(UInt32));
+    return layout;
+}
+
+// Copy `n` 32-bit words from `src` to `dst`, converting them from (or to) little-endian
+static void cache_copy32(void* dst, const void* src, UInt64 n) {
+    memcpy(dst, src, n * sizeof(UInt32));
+#if NATIVE_IS_BIG_ENDIAN
+    UInt32* words = cast(UInt32*)dst;
+    for(UInt64 i = 0; i < n; i++)
+        words[i] = endian_swap32(words[i]);
+#endif // NATIVE_IS_BIG_ENDIAN
+}
+
+// Same as `cache_copy32()`, for CompactTokens
+static void cache_copy_tokens(CompactToken* dst, const CompactToken* src, UInt64 n) {
+    memcpy(dst, src, n * sizeof(CompactToken));
+#if NATIVE_IS_BIG_ENDIAN
+    for(UInt64 i = 0; i < n; i++) {
+        dst[i].offset = endian_swap32(dst[i].offset);
+        dst[i].len = endian_swap32(dst[i].len);
+        dst[i].fileid = endian_swap16(dst[i].fileid);
+    }
+#endif // NATIVE_IS_BIG_ENDIAN
+}
+
+static void cache_copy_header(CacheHeader* dst, const CacheHeader* src) {
+    cache_copy32(dst, src, sizeof(CacheHeader) / sizeof(UInt32));
+#if NATIVE_IS_BIG_ENDIAN
+    // The 64-bit fields were swapped as two 32-bit halves: swap the halves back
+    dst->key = (dst->key >> 32) | (dst->key << 32);
+    dst->source_len = (dst->source_len >> 32) | (dst->source_len << 32);
+#endif // NATIVE_IS_BIG_ENDIAN
+}
+
+UInt64 cache_key(const char* source, UInt64 len) {
+    UInt64 seed = (cast(UInt64)ADORAD_VERSION << 32) | CACHE_FORMAT_VERSION;
+    return hash_wyhash(source, cast(Ll)len, seed);
+}
+
+char* cache_path(const char* dir, UInt64 key) {
+    UInt64 len = strlen(dir) + 1 + 16 + 4 + 1;
+    char* path = cast(char*)malloc(len);
+    CORETEN_ENFORCE_NN(path, "Could not allocate memory. Memory full.");
+    snprintf(path, len, "%s/%016llx.adc", dir, cast(unsigned long long)key);
+    return path;
+}
+
+bool cache_store(const char* path, UInt64 key, UInt64 source_len, const CompactToken* tokens, UInt32 num_tokens, 
+                 Ast* ast) {
+    CacheLayout layout = cache_layout(num_tokens, ast->len, ast->extra_len);
+    // Zeroed, so that padding is deterministic
+    char* image = cast(char*)calloc(1, layout.size);
+    CORETEN_ENFORCE_NN(image, "Could not allocate memory. Memory full.");
+
+    CacheHeader header = {0};
+    header.magic = CACHE_MAGIC;
+    header.format_version = CACHE_FORMAT_VERSION;
+    header.compiler_version = ADORAD_VERSION;
+    header.key = key;
+    header.source_len = source_len;
+    header.num_tokens = num_tokens;
+    header.num_nodes = ast->len;
+    header.num_extra = ast->extra_len;
+    cache_copy_header(cast(CacheHeader*)image, &header);
+    cache_copy_tokens(cast(CompactToken*)(image + layout.tokens), tokens, num_tokens);
+    memcpy(image + layout.kinds, ast->kinds, ast->len * sizeof(UInt8));
+    cache_copy32(image + layout.main_tokens, ast->main_tokens, ast->len);
+    cache_copy32(image + layout.data, ast->data, cast(UInt64)ast->len * 2);
+    cache_copy32(image + layout.extra, ast->extra, ast->extra_len);
+
+    // Entries of the same key are identical, so concurrent writers only need distinct temporary files
+    UInt64 tmp_len = strlen(path) + 32;
+    char* tmp_path = cast(char*)malloc(tmp_len);
+    CORETEN_ENFORCE_NN(tmp_path, "Could not allocate memory. Memory full.");
+    snprintf(tmp_path, tmp_len, "%s.%p.tmp", path, cast(void*)image);
+
+    bool is_stored = false;
+    FILE* file = fopen(tmp_path, "wb");
+    if(SOME(file)) {
+        is_stored = fwrite(image, 1, layout.size, file) == layout.size;
+        is_stored = fclose(file) == 0 && is_stored;
+        // `rename()` doesn't replace an existing file everywhere (eg. Windows)
+        if(is_stored && rename(tmp_path, path) != 0) {
+            remove(path);
+            is_stored = rename(tmp_path, path) == 0;
+        }
+        if(!is_stored)
+            remove(tmp_path);
+    }
+    free(tmp_path);
+    free(image);
+    return is_stored;
+}
+
+CacheEntry* cache_load(const char* path, UInt64 key, UInt64 source_len) {
+    FileView view = file_map(path);
+    if(view.error != 0)
+        return null;
+    CacheHeader header;
+    if(view.len < sizeof(CacheHeader)) {
+        file_unmap(&view);
+        return null;
+    }
+    cache_copy_header(&header, cast(CacheHeader*)view.data);
+    CacheLayout layout = cache_layout(header.num_tokens, header.num_nodes, header.num_extra);
+    if(header.magic != CACHE_MAGIC || header.format_version != CACHE_FORMAT_VERSION || 
+       header.compiler_version != ADORAD_VERSION || header.key != key || header.source_len != source_len ||
+       header.num_nodes == 0 || layout.size != view.len) {
+        file_unmap(&view);
+        return null;
+    }
+
+    CacheEntry* entry = cast(CacheEntry*)calloc(1, sizeof(CacheEntry));
+    CORETEN_ENFORCE_NN(entry, "Could not allocate memory. Memory full.");
+    entry->view = view;
+    entry->num_tokens = header.num_tokens;
+    entry->ast.len = entry->ast.cap = header.num_nodes;
+    entry->ast.extra_len = entry->ast.extra_cap = header.num_extra;
+    entry->ast.kinds = cast(UInt8*)(view.data + layout.kinds);
+#if NATIVE_IS_BIG_ENDIAN
+    entry->is_swapped = true;
+    entry->tokens = cast(CompactToken*)malloc(header.num_tokens * sizeof(CompactToken) + 1);
+    entry->ast.main_tokens = cast(UInt32*)malloc(header.num_nodes * sizeof(UInt32));
+    entry->ast.data = cast(AstNodeData*)malloc(header.num_nodes * sizeof(AstNodeData));
+    entry->ast.extra = cast(UInt32*)malloc(header.num_extra * sizeof(UInt32) + 1);
+    CORETEN_ENFORCE(SOME(entry->tokens) && SOME(entry->ast.main_tokens) && SOME(entry->ast.data) && 
+                    SOME(entry->ast.extra), "Could not allocate memory. Memory full.");
+    cache_copy_tokens(entry->tokens, cast(CompactToken*)(view.data + layout.tokens), header.num_tokens);
+    cache_copy32(entry->ast.main_tokens, view.data + layout.main_tokens, header.num_nodes);
+    cache_copy32(entry->ast.data, view.data + layout.data, cast(UInt64)header.num_nodes * 2);
+    cache_copy32(entry->ast.extra, view.data + layout.extra, header.num_extra);
+#else
+    entry->is_swapped = false;
+    entry->tokens = cast(CompactToken*)(view.data + layout.tokens);
+    entry->ast.main_tokens = cast(UInt32*)(view.data + layout.main_tokens);
+    entry->ast.data = cast(AstNodeData*)(view.data + layout.data);
+    entry->ast.extra = cast(UInt32*)(view.data + layout.extra);
+#endif // NATIVE_IS_BIG_ENDIAN
+    return entry;
+}
+
+void cache_entry_free(CacheEntry* entry) {
+    if(SOME(entry)) {
+        if(entry->is_swapped) {
+            free(entry->tokens);
+            free(entry->ast.main_tokens);
+            free(entry->ast.data);
+            free(entry->ast.extra);
+        }
+        file_unmap(&entry->view);
+        free(entry);
+    }
+}
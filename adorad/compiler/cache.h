@@ -0,0 +1,84 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#ifndef ADORAD_CACHE_H
+#define ADORAD_CACHE_H
+
+#include <adorad/core/types.h>
+#include <adorad/core/io.h>
+#include <adorad/compiler/ast.h>
+#include <adorad/compiler/tokens.h>
+
+/*
+    Token/AST cache
+    Saves the token stream (`CompactToken`s) and the index-based AST (see `Ast`) of a source file, so that an 
+    unchanged file doesn't have to be relexed and reparsed: a hit maps the cache file and points straight into it.
+
+    Entries are keyed by a hash of the contents of the source file and of the compiler version (see `cache_key()`),
+    so an edit - or a new compiler - is simply a miss. Nothing is ever invalidated in place.
+
+    Layout of a cache file (every field is little-endian, whatever the host; sections are 8-byte aligned):
+        CacheHeader
+        CompactToken tokens[num_tokens]
+        UInt8        kinds[num_nodes]
+        UInt32       main_tokens[num_nodes]
+        AstNodeData  data[num_nodes]
+        UInt32       extra[num_extra]
+    On a little-endian host, a hit is a single `file_map()` - the arrays are used in place. On a big-endian host they 
+    are byte-swapped into heap copies.
+*/
+
+#define CACHE_MAGIC             0x43444141  // "AADC"
+// Bump this whenever the layout (or the meaning) of anything in a cache file changes
+// (2: `CompactToken.flags`, and the RAW_STRING/TRIPLE_STRING tokens)
+#define CACHE_FORMAT_VERSION    2
+
+typedef struct CacheHeader {
+    UInt32 magic;
+    UInt32 format_version;
+    UInt32 compiler_version;// `ADORAD_VERSION`
+    UInt32 __pad;
+    UInt64 key;             // see `cache_key()`
+    UInt64 source_len;      // length of the source file (guards against hash collisions)
+    UInt32 num_tokens;
+    UInt32 num_nodes;
+    UInt32 num_extra;
+    UInt32 __pad2;
+} CacheHeader;
+
+CORETEN_STATIC_ASSERT(sizeof(CacheHeader) == 48);
+
+// A cache hit
+typedef struct CacheEntry {
+    FileView view;          // the cache file
+    CompactToken* tokens;   // `num_tokens` tokens, as made by a compact Lexer (see `lexer_init_compact()`)
+    UInt32 num_tokens;
+    // Read-only: its arrays point into `view` (unless `is_swapped`). Use it, but don't grow (or `ast_free()`) it
+    Ast ast;
+    bool is_swapped;        // set if the arrays are (byte-swapped) heap copies
+} CacheEntry;
+
+// The key of a source file: a hash of its contents, seeded with the compiler version (and the cache format)
+UInt64 cache_key(const char* source, UInt64 len);
+// Path of the cache file of `key` in the directory `dir` (`dir/<key in hex>.adc`). Free it with `free()`
+char* cache_path(const char* dir, UInt64 key);
+// Write `tokens` and `ast` (of the source file whose key is `key`) to the cache file `path`. The file is written
+// under a temporary name and then renamed, so a reader never sees it half-written. Returns false on an I/O error
+bool cache_store(const char* path, UInt64 key, UInt64 source_len, const CompactToken* tokens, UInt32 num_tokens, 
+                 Ast* ast);
+// Load the cache file `path`. Returns null on a miss: if there's no such file, or it's stale (another key or 
+// compiler version), or it's not a (complete) cache file
+CacheEntry* cache_load(const char* path, UInt64 key, UInt64 source_len);
+void cache_entry_free(CacheEntry* entry);
+
+#endif // ADORAD_CACHE_H
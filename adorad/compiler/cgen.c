@@ -0,0 +1,380 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <adorad/core/debug.h>
+#include <adorad/core/jobs.h>
+#include <adorad/core/thread.h>
+#include <adorad/compiler/cgen.h>
+#include <adorad/compiler/stats.h>
+#include <adorad/compiler/trace.h>
+
+#if defined(ADORAD_HAS_LIBTCC)
+    #include <libtcc.h>
+#endif
+
+// Longest path (of a shard, or of its object file) handled
+#define CGEN_MAX_PATH       1024
+// Longest command line (to compile a shard) handled
+#define CGEN_MAX_COMMAND    (3 * CGEN_MAX_PATH)
+
+void cwriter_init(CWriter* writer, UInt64 cap) {
+    writer->data = cast(char*)malloc(cap > 0 ? cap : 1);
+    CORETEN_ENFORCE_NN(writer->data, "Could not allocate memory. Memory full.");
+    writer->len = 0;
+    writer->cap = cap > 0 ? cap : 1;
+    writer->indent = 0;
+}
+
+void cwriter_free(CWriter* writer) {
+    free(writer->data);
+    writer->data = null;
+    writer->len = writer->cap = 0;
+}
+
+// Make room for `len` more bytes
+static void cwriter_reserve(CWriter* writer, UInt64 len) {
+    if(CORETEN_LIKELY(writer->len + len <= writer->cap))
+        return;
+    UInt64 cap = writer->cap * 2;
+    while(cap < writer->len + len)
+        cap *= 2;
+    writer->data = cast(char*)realloc(writer->data, cap);
+    CORETEN_ENFORCE_NN(writer->data, "Could not allocate memory. Memory full.");
+    writer->cap = cap;
+}
+
+void cwriter_write(CWriter* writer, const char* data, UInt64 len) {
+    cwriter_reserve(writer, len);
+    memcpy(writer->data + writer->len, data, len);
+    writer->len += len;
+}
+
+void cwriter_str(CWriter* writer, const char* str) {
+    cwriter_write(writer, str, strlen(str));
+}
+
+void cwriter_printf(CWriter* writer, const char* format, ...) {
+    // Format straight into the buffer - and if it didn't fit, make room and format again
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(writer->data + writer->len, writer->cap - writer->len, format, args);
+    va_end(args);
+    CORETEN_ENFORCE(len >= 0, "Invalid format string");
+    if(cast(UInt64)len >= writer->cap - writer->len) {
+        cwriter_reserve(writer, cast(UInt64)len + 1);
+        va_start(args, format);
+        vsnprintf(writer->data + writer->len, writer->cap - writer->len, format, args);
+        va_end(args);
+    }
+    writer->len += cast(UInt64)len;
+}
+
+void cwriter_indent(CWriter* writer) {
+    UInt64 len = cast(UInt64)writer->indent * CGEN_INDENT_WIDTH;
+    cwriter_reserve(writer, len);
+    memset(writer->data + writer->len, ' ', len);
+    writer->len += len;
+}
+
+CGen* cgen_new(CGenOptions* options) {
+    CGen* cgen = cast(CGen*)calloc(1, sizeof(CGen));
+    CORETEN_ENFORCE_NN(cgen, "Could not allocate memory. Memory full.");
+    if(SOME(options))
+        cgen->options = *options;
+    if(cgen->options.num_shards == 0)
+        cgen->options.num_shards = 1;
+    if(cgen->options.units_per_job == 0)
+        cgen->options.units_per_job = CGEN_DEFAULT_UNITS_PER_JOB;
+    cgen->units = VEC_NEW(CGenUnit, 64);
+    cwriter_init(&cgen->prelude, 4096);
+    cwriter_str(&cgen->prelude, "// Generated by the Adorad compiler. Do not edit\n");
+    cwriter_str(&cgen->prelude, "#include <stdbool.h>\n#include <stddef.h>\n#include <stdint.h>\n\n");
+    return cgen;
+}
+
+void cgen_free(CGen* cgen) {
+    if(NONE(cgen))
+        return;
+    for(UInt32 i = 0; i < cgen->num_writers; i++)
+        cwriter_free(&cgen->writers[i]);
+    free(cgen->writers);
+    free(cgen->shard_starts);
+    cwriter_free(&cgen->prelude);
+    vec_free(cgen->units);
+    free(cgen);
+}
+
+void cgen_add_unit(CGen* cgen, CGenEmitFunc emit, void* arg) {
+    CGenUnit unit = { emit, arg, 0, 0, 0 };
+    vec_push_CGenUnit(cgen->units, &unit);
+}
+
+// There's no checker yet (so no functions to emit): a file is a unit that says where it's from
+static void cgen_emit_build_file(CWriter* writer, void* arg) {
+    BuildFile* file = cast(BuildFile*)arg;
+    cwriter_printf(writer, "// %s (module %s)\n", file->fname, file->module);
+    for(UInt64 i = 0; SOME(file->uses) && i < vec_size(file->uses); i++)
+        cwriter_printf(writer, "// use %s\n", vec_at_BuildUse(file->uses, i)->name);
+    cwriter_str(writer, "\n");
+}
+
+void cgen_add_build_file(CGen* cgen, BuildFile* file) {
+    cgen_add_unit(cgen, cgen_emit_build_file, file);
+}
+
+typedef struct CGenJob {
+    CGen* cgen;
+    JobPool* pool;
+    UInt32 first;       // index of the first unit
+    UInt32 num_units;
+} CGenJob;
+
+static void cgen_run_job(void* arg) {
+    CGenJob* job = cast(CGenJob*)arg;
+    CWriter* writer = &job->cgen->writers[job_pool_worker_id(job->pool)];
+    for(UInt32 i = job->first; i < job->first + job->num_units; i++) {
+        CGenUnit* unit = vec_at_CGenUnit(job->cgen->units, i);
+        unit->writer = job_pool_worker_id(job->pool);
+        unit->offset = writer->len;
+        TRACE_ZONE("emit", null) {
+            unit->emit(writer, unit->arg);
+        }
+        unit->len = writer->len - unit->offset;
+    }
+}
+
+// Split the units into `options.num_shards` contiguous runs of about the same size: a unit goes to the shard its
+// middle byte is in (of the output split evenly)
+static void cgen_split_shards(CGen* cgen) {
+    UInt32 num_shards = cgen->options.num_shards;
+    UInt32 num_units = cast(UInt32)vec_size(cgen->units);
+    cgen->shard_starts = cast(UInt32*)calloc(num_shards + 1, sizeof(UInt32));
+    CORETEN_ENFORCE_NN(cgen->shard_starts, "Could not allocate memory. Memory full.");
+    UInt32 shard = 0;       // of the unit before
+    UInt64 num_bytes = 0;   // emitted by the units before
+    for(UInt32 i = 0; i < num_units && cgen->num_bytes > 0; i++) {
+        UInt64 len = vec_at_CGenUnit(cgen->units, i)->len;
+        UInt64 unit_shard = (num_bytes * 2 + len) * num_shards / (cgen->num_bytes * 2);
+        if(unit_shard >= num_shards)
+            unit_shard = num_shards - 1;
+        while(shard < unit_shard)
+            cgen->shard_starts[++shard] = i;
+        num_bytes += len;
+    }
+    while(shard < num_shards)
+        cgen->shard_starts[++shard] = num_units;
+}
+
+void cgen_emit(CGen* cgen) {
+    UInt64 start = stats_now();
+    UInt32 num_units = cast(UInt32)vec_size(cgen->units);
+    UInt32 num_jobs = (num_units + cgen->options.units_per_job - 1) / cgen->options.units_per_job;
+    UInt32 num_threads = cgen->options.num_threads;
+    if(num_threads == 0)
+        num_threads = thread_num_cpus();
+    if(num_threads > num_jobs)
+        num_threads = num_jobs;
+    if(num_threads == 0)
+        num_threads = 1;
+
+    JobPool* pool = job_pool_new(num_threads);
+    cgen->num_writers = pool->num_workers;
+    cgen->writers = cast(CWriter*)calloc(cgen->num_writers, sizeof(CWriter));
+    CORETEN_ENFORCE_NN(cgen->writers, "Could not allocate memory. Memory full.");
+    for(UInt32 i = 0; i < cgen->num_writers; i++)
+        cwriter_init(&cgen->writers[i], CGEN_WRITER_INITIAL_CAP);
+
+    CGenJob* jobs = cast(CGenJob*)calloc(num_jobs > 0 ? num_jobs : 1, sizeof(CGenJob));
+    CORETEN_ENFORCE_NN(jobs, "Could not allocate memory. Memory full.");
+    JobGroup group;
+    job_group_init(&group);
+    for(UInt32 i = 0; i < num_jobs; i++) {
+        jobs[i].cgen = cgen;
+        jobs[i].pool = pool;
+        jobs[i].first = i * cgen->options.units_per_job;
+        jobs[i].num_units = num_units - jobs[i].first < cgen->options.units_per_job ?
+                            num_units - jobs[i].first : cgen->options.units_per_job;
+        job_pool_submit(pool, &group, cgen_run_job, &jobs[i]);
+    }
+    job_group_wait(pool, &group);
+    job_pool_free(pool);
+    free(jobs);
+
+    cgen->num_bytes = 0;
+    for(UInt32 i = 0; i < num_units; i++)
+        cgen->num_bytes += vec_at_CGenUnit(cgen->units, i)->len;
+    cgen_split_shards(cgen);
+    cgen->nanoseconds = stats_now() - start;
+}
+
+bool cgen_write_shard(CGen* cgen, UInt32 shard, FILE* stream) {
+    CORETEN_ENFORCE_NN(cgen->shard_starts, "Emit the units (see `cgen_emit()`) before writing them");
+    CORETEN_ENFORCE(shard < cgen->options.num_shards, "No such shard");
+    bool is_ok = fwrite(cgen->prelude.data, 1, cgen->prelude.len, stream) == cgen->prelude.len;
+    for(UInt32 i = cgen->shard_starts[shard]; i < cgen->shard_starts[shard + 1] && is_ok; i++) {
+        CGenUnit* unit = vec_at_CGenUnit(cgen->units, i);
+        is_ok = fwrite(cgen->writers[unit->writer].data + unit->offset, 1, unit->len, stream) == unit->len;
+    }
+    return is_ok;
+}
+
+void cgen_shard_str(CGen* cgen, UInt32 shard, CWriter* writer) {
+    CORETEN_ENFORCE_NN(cgen->shard_starts, "Emit the units (see `cgen_emit()`) before writing them");
+    CORETEN_ENFORCE(shard < cgen->options.num_shards, "No such shard");
+    cwriter_write(writer, cgen->prelude.data, cgen->prelude.len);
+    for(UInt32 i = cgen->shard_starts[shard]; i < cgen->shard_starts[shard + 1]; i++) {
+        CGenUnit* unit = vec_at_CGenUnit(cgen->units, i);
+        cwriter_write(writer, cgen->writers[unit->writer].data + unit->offset, unit->len);
+    }
+    cwriter_write(writer, "", 1);
+    writer->len--;
+}
+
+void cgen_shard_path(CGen* cgen, const char* prefix, UInt32 shard, char* out, UInt32 cap) {
+    if(cgen->options.num_shards == 1)
+        snprintf(out, cap, "%s.c", prefix);
+    else
+        snprintf(out, cap, "%s_%u.c", prefix, shard);
+}
+
+typedef struct CGenShardJob {
+    CGen* cgen;
+    const char* prefix;
+    CompilerType compiler;
+    UInt32 shard;
+    bool ok;
+} CGenShardJob;
+
+static void cgen_write_file(void* arg) {
+    CGenShardJob* job = cast(CGenShardJob*)arg;
+    char path[CGEN_MAX_PATH];
+    cgen_shard_path(job->cgen, job->prefix, job->shard, path, sizeof(path));
+    TRACE_ZONE("write", path) {
+        FILE* stream = fopen(path, "wb");
+        job->ok = SOME(stream) && cgen_write_shard(job->cgen, job->shard, stream);
+        if(SOME(stream))
+            job->ok = fclose(stream) == 0 && job->ok;
+    }
+}
+
+// Path of the object file of shard `shard`: `foo.c` -> `foo.o` (or `foo.obj`)
+static void cgen_object_path(CGen* cgen, const char* prefix, UInt32 shard, CompilerType compiler, char* out,
+                             UInt32 cap) {
+    char src[CGEN_MAX_PATH];
+    cgen_shard_path(cgen, prefix, shard, src, sizeof(src));
+    snprintf(out, cap, "%.*s%s", cast(int)(strlen(src) - 2), src, compiler == CompilerTypeMsvc ? ".obj" : ".o");
+}
+
+static void cgen_compile_file(void* arg) {
+    CGenShardJob* job = cast(CGenShardJob*)arg;
+    char src[CGEN_MAX_PATH];
+    char obj[CGEN_MAX_PATH];
+    char command[CGEN_MAX_COMMAND];
+    cgen_shard_path(job->cgen, job->prefix, job->shard, src, sizeof(src));
+    cgen_object_path(job->cgen, job->prefix, job->shard, job->compiler, obj, sizeof(obj));
+    UInt32 len = cgen_compile_command(job->compiler, src, obj, command, sizeof(command));
+    TRACE_ZONE("compile", src) {
+        job->ok = len < sizeof(command) && system(command) == 0;
+    }
+}
+
+// Run `proc` on every shard, in parallel. Returns the no. of shards it failed on
+static UInt32 cgen_run_shards(CGen* cgen, JobProc proc, const char* prefix, CompilerType compiler) {
+    UInt32 num_shards = cgen->options.num_shards;
+    CGenShardJob* jobs = cast(CGenShardJob*)calloc(num_shards, sizeof(CGenShardJob));
+    CORETEN_ENFORCE_NN(jobs, "Could not allocate memory. Memory full.");
+    UInt32 num_threads = cgen->options.num_threads > 0 ? cgen->options.num_threads : thread_num_cpus();
+    JobPool* pool = job_pool_new(num_threads < num_shards ? num_threads : num_shards);
+    JobGroup group;
+    job_group_init(&group);
+    for(UInt32 i = 0; i < num_shards; i++) {
+        jobs[i] = (CGenShardJob){ cgen, prefix, compiler, i, false };
+        job_pool_submit(pool, &group, proc, &jobs[i]);
+    }
+    job_group_wait(pool, &group);
+    job_pool_free(pool);
+    UInt32 num_failed = 0;
+    for(UInt32 i = 0; i < num_shards; i++)
+        num_failed += !jobs[i].ok;
+    free(jobs);
+    return num_failed;
+}
+
+bool cgen_write_files(CGen* cgen, const char* prefix) {
+    CORETEN_ENFORCE_NN(cgen->shard_starts, "Emit the units (see `cgen_emit()`) before writing them");
+    return cgen_run_shards(cgen, cgen_write_file, prefix, CompilerTypeGcc) == 0;
+}
+
+UInt32 cgen_compile_command(CompilerType compiler, const char* src, const char* obj, char* out, UInt32 cap) {
+    int len;
+    switch(compiler) {
+        case CompilerTypeMsvc:
+            len = snprintf(out, cap, "cl /nologo /O2 /c \"%s\" /Fo\"%s\"", src, obj);
+            break;
+        case CompilerTypeTinyc:
+            len = snprintf(out, cap, "tcc -c \"%s\" -o \"%s\"", src, obj);
+            break;
+        case CompilerTypeClang:
+            len = snprintf(out, cap, "clang -std=c11 -O2 -w -c \"%s\" -o \"%s\"", src, obj);
+            break;
+        case CompilerTypeMingw:
+            len = snprintf(out, cap, "x86_64-w64-mingw32-gcc -std=c11 -O2 -w -c \"%s\" -o \"%s\"", src, obj);
+            break;
+        case CompilerTypeGcc:
+        default:
+            len = snprintf(out, cap, "gcc -std=c11 -O2 -w -c \"%s\" -o \"%s\"", src, obj);
+            break;
+    }
+    return len > 0 ? cast(UInt32)len : 0;
+}
+
+UInt32 cgen_compile(CGen* cgen, CompilerType compiler, const char* prefix) {
+    return cgen_run_shards(cgen, cgen_compile_file, prefix, compiler);
+}
+
+bool cgen_compile_in_process(CGen* cgen, const char* prefix, UInt32* num_failed) {
+#if defined(ADORAD_HAS_LIBTCC)
+    CORETEN_ENFORCE_NN(cgen->shard_starts, "Emit the units (see `cgen_emit()`) before compiling them");
+    *num_failed = 0;
+    CWriter unit;
+    cwriter_init(&unit, CGEN_WRITER_INITIAL_CAP);
+    // One shard after the other: libtcc keeps global state, so its compilations can't run in parallel
+    for(UInt32 i = 0; i < cgen->options.num_shards; i++) {
+        unit.len = 0;
+        cgen_shard_str(cgen, i, &unit);
+        char obj[CGEN_MAX_PATH];
+        cgen_object_path(cgen, prefix, i, CompilerTypeTinyc, obj, sizeof(obj));
+        TCCState* state = tcc_new();
+        bool is_ok = SOME(state);
+        TRACE_ZONE("compile", obj)
+        if(is_ok) {
+            tcc_set_options(state, "-w");
+            tcc_set_output_type(state, TCC_OUTPUT_OBJ);
+            is_ok = tcc_compile_string(state, unit.data) == 0 && tcc_output_file(state, obj) == 0;
+            tcc_delete(state);
+        }
+        *num_failed += !is_ok;
+    }
+    cwriter_free(&unit);
+    return true;
+#else
+    (void)cgen;
+    (void)prefix;
+    *num_failed = 0;
+    return false;
+#endif
+}
@@ -0,0 +1,130 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#ifndef ADORAD_CGEN_H
+#define ADORAD_CGEN_H
+
+#include <stdio.h>
+
+#include <adorad/core/types.h>
+#include <adorad/core/misc.h>
+#include <adorad/core/vector.h>
+#include <adorad/compiler/build.h>
+#include <adorad/compiler/compiler.h>
+
+/*
+    C backend (emission)
+    C is emitted by units - a function, a type, a global - each independently of the others, so units are emitted in
+    parallel: one job per batch of units, on a `JobPool` (see <adorad/core/jobs.h>).
+
+    Every worker writes into its own `CWriter`: an append-only buffer that C is formatted straight into (no
+    intermediate strings). A unit only records where its output went (which writer, and the span of it). Once every
+    unit is emitted, the spans are written out in the order the units were added - so the output is the same whatever
+    the number of threads or the schedule.
+
+    The output can be split into `CGenOptions.num_shards` `.c` files (contiguous runs of units, balanced by size),
+    each beginning with the prelude (includes, forward declarations) - so that the C compiler can be run on the shards
+    in parallel (see `cgen_compile()`), which is where the time of a build goes.
+
+    Debug builds go the other way: a few big (unity) shards, compiled in memory by libtcc (the Tiny C Compiler as a
+    library - see `cgen_compile_in_process()`), so no `.c` file is written and no compiler process is spawned. It's
+    only there if Adorad was built with it (`-DADORAD_WITH_LIBTCC=ON`, which defines `ADORAD_HAS_LIBTCC`); release
+    builds still go through gcc or clang.
+*/
+
+// Units emitted per job, unless asked otherwise
+#define CGEN_DEFAULT_UNITS_PER_JOB  16
+// Initial capacity of a `CWriter` (it grows as needed)
+#define CGEN_WRITER_INITIAL_CAP     (64 * 1024)
+// No. of shards of a debug build, unless asked otherwise (few: tcc is fast enough that process and file overheads
+// are most of the time)
+#define CGEN_UNITY_SHARDS           2
+// Spaces per level of indentation
+#define CGEN_INDENT_WIDTH           4
+
+typedef struct CWriter {
+    char* data;
+    UInt64 len;
+    UInt64 cap;
+    UInt32 indent;      // no. of levels `cwriter_indent()` writes
+} CWriter;
+
+// Emit a unit into `writer`. Called on any thread (but only ever on one at a time, per unit)
+typedef void (*CGenEmitFunc)(CWriter* writer, void* arg);
+
+typedef struct CGenUnit {
+    CGenEmitFunc emit;
+    void* arg;
+    // Where its output is (once emitted)
+    UInt32 writer;
+    UInt64 offset;
+    UInt64 len;
+} CGenUnit;
+
+VEC_DEFINE(CGenUnit)
+
+typedef struct CGenOptions {
+    UInt32 num_threads;     // threads to emit on (including the calling one). One per CPU if 0
+    UInt32 num_shards;      // no. of `.c` files to split the output into (1 if 0)
+    UInt32 units_per_job;   // CGEN_DEFAULT_UNITS_PER_JOB if 0
+} CGenOptions;
+
+typedef struct CGen {
+    CGenOptions options;
+    CWriter prelude;        // written at the top of every shard
+    Vec* units;             // `CGenUnit`s, in the order they're output
+    CWriter* writers;       // one per worker (once emitted)
+    UInt32 num_writers;
+    UInt32* shard_starts;   // the units of shard `i` are `shard_starts[i] .. shard_starts[i + 1]` (once emitted)
+    UInt64 num_bytes;       // emitted by the units (the prelude excluded)
+    UInt64 nanoseconds;     // wall-clock time `cgen_emit()` took
+} CGen;
+
+void cwriter_init(CWriter* writer, UInt64 cap);
+void cwriter_free(CWriter* writer);
+void cwriter_write(CWriter* writer, const char* data, UInt64 len);
+void cwriter_str(CWriter* writer, const char* str);
+ATTRIBUTE_PRINTF(2, 3)
+void cwriter_printf(CWriter* writer, const char* format, ...);
+// Write the indentation of the current level (see `CWriter.indent`)
+void cwriter_indent(CWriter* writer);
+
+// `options` may be null (for the defaults)
+CGen* cgen_new(CGenOptions* options);
+void cgen_free(CGen* cgen);
+// Add a unit, emitted by `emit(writer, arg)` (see `CGenEmitFunc`)
+void cgen_add_unit(CGen* cgen, CGenEmitFunc emit, void* arg);
+// Add the units of `file` (which must have no errors)
+void cgen_add_build_file(CGen* cgen, BuildFile* file);
+// Emit every unit, in parallel, and split them into shards
+void cgen_emit(CGen* cgen);
+// Write shard `shard` (the prelude, then its units) to `stream`. Returns false on an I/O error
+bool cgen_write_shard(CGen* cgen, UInt32 shard, FILE* stream);
+// Append shard `shard` (as `cgen_write_shard()` writes it) to `writer`, null-terminated - a translation unit in memory
+void cgen_shard_str(CGen* cgen, UInt32 shard, CWriter* writer);
+// Path of shard `shard` of the output `prefix`: `<prefix>.c` if there's one shard, `<prefix>_<shard>.c` otherwise
+void cgen_shard_path(CGen* cgen, const char* prefix, UInt32 shard, char* out, UInt32 cap);
+// Write every shard to its file (see `cgen_shard_path()`), in parallel. Returns false on an I/O error
+bool cgen_write_files(CGen* cgen, const char* prefix);
+// Write the command line that compiles `src` into the object file `obj` with `compiler` to `out` (truncated to `cap`
+// bytes). Returns its length
+UInt32 cgen_compile_command(CompilerType compiler, const char* src, const char* obj, char* out, UInt32 cap);
+// Compile every shard written by `cgen_write_files()` into an object file (`<prefix>[_<shard>].o`), running the
+// compilers in parallel. Returns the no. of shards that failed to compile
+UInt32 cgen_compile(CGen* cgen, CompilerType compiler, const char* prefix);
+// Compile every shard straight from memory into an object file (`<prefix>[_<shard>].o`) with libtcc, with the no.
+// of shards that failed to compile in `num_failed`. Returns false (and compiles nothing) if Adorad wasn't built with
+// libtcc
+bool cgen_compile_in_process(CGen* cgen, const char* prefix, UInt32* num_failed);
+
+#endif // ADORAD_CGEN_H
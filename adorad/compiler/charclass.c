@@ -0,0 +1,264 @@
+// Auto-generated by tools/scripts/generate_tokens.py
+// DO NOT EDIT - regenerate with:
+//     python tools/scripts/generate_tokens.py char_classes adorad/compiler/charclass.h adorad/compiler/charclass.c
+
+#include <adorad/compiler/charclass.h>
+
+const UInt8 charClassTable[256] = {
+    /* 0x00 */ 0,
+    /* 0x01 */ 0,
+    /* 0x02 */ 0,
+    /* 0x03 */ 0,
+    /* 0x04 */ 0,
+    /* 0x05 */ 0,
+    /* 0x06 */ 0,
+    /* 0x07 */ 0,
+    /* 0x08 */ 0,
+    /* 0x09 */ CHAR_BLANK,
+    /* 0x0A */ 0,
+    /* 0x0B */ CHAR_BLANK,
+    /* 0x0C */ CHAR_BLANK,
+    /* 0x0D */ CHAR_BLANK,
+    /* 0x0E */ 0,
+    /* 0x0F */ 0,
+    /* 0x10 */ 0,
+    /* 0x11 */ 0,
+    /* 0x12 */ 0,
+    /* 0x13 */ 0,
+    /* 0x14 */ 0,
+    /* 0x15 */ 0,
+    /* 0x16 */ 0,
+    /* 0x17 */ 0,
+    /* 0x18 */ 0,
+    /* 0x19 */ 0,
+    /* 0x1A */ 0,
+    /* 0x1B */ 0,
+    /* 0x1C */ 0,
+    /* 0x1D */ 0,
+    /* 0x1E */ 0,
+    /* 0x1F */ 0,
+    /* ' '  */ CHAR_BLANK,
+    /* '!'  */ 0,
+    /* '"'  */ 0,
+    /* '#'  */ 0,
+    /* '$'  */ 0,
+    /* '%'  */ 0,
+    /* '&'  */ 0,
+    /* '\'' */ 0,
+    /* '('  */ 0,
+    /* ')'  */ 0,
+    /* '*'  */ 0,
+    /* '+'  */ 0,
+    /* ','  */ 0,
+    /* '-'  */ 0,
+    /* '.'  */ 0,
+    /* '/'  */ 0,
+    /* '0'  */ CHAR_IDENT | CHAR_DIGIT | CHAR_HEX_DIGIT | CHAR_OCT_DIGIT | CHAR_BIN_DIGIT,
+    /* '1'  */ CHAR_IDENT | CHAR_DIGIT | CHAR_HEX_DIGIT | CHAR_OCT_DIGIT | CHAR_BIN_DIGIT,
+    /* '2'  */ CHAR_IDENT | CHAR_DIGIT | CHAR_HEX_DIGIT | CHAR_OCT_DIGIT,
+    /* '3'  */ CHAR_IDENT | CHAR_DIGIT | CHAR_HEX_DIGIT | CHAR_OCT_DIGIT,
+    /* '4'  */ CHAR_IDENT | CHAR_DIGIT | CHAR_HEX_DIGIT | CHAR_OCT_DIGIT,
+    /* '5'  */ CHAR_IDENT | CHAR_DIGIT | CHAR_HEX_DIGIT | CHAR_OCT_DIGIT,
+    /* '6'  */ CHAR_IDENT | CHAR_DIGIT | CHAR_HEX_DIGIT | CHAR_OCT_DIGIT,
+    /* '7'  */ CHAR_IDENT | CHAR_DIGIT | CHAR_HEX_DIGIT | CHAR_OCT_DIGIT,
+    /* '8'  */ CHAR_IDENT | CHAR_DIGIT | CHAR_HEX_DIGIT,
+    /* '9'  */ CHAR_IDENT | CHAR_DIGIT | CHAR_HEX_DIGIT,
+    /* ':'  */ 0,
+    /* ';'  */ 0,
+    /* '<'  */ 0,
+    /* '='  */ 0,
+    /* '>'  */ 0,
+    /* '?'  */ 0,
+    /* '@'  */ 0,
+    /* 'A'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT | CHAR_HEX_DIGIT,
+    /* 'B'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT | CHAR_HEX_DIGIT,
+    /* 'C'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT | CHAR_HEX_DIGIT,
+    /* 'D'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT | CHAR_HEX_DIGIT,
+    /* 'E'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT | CHAR_HEX_DIGIT,
+    /* 'F'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT | CHAR_HEX_DIGIT,
+    /* 'G'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'H'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'I'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'J'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'K'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'L'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'M'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'N'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'O'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'P'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'Q'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'R'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'S'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'T'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'U'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'V'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'W'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'X'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'Y'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'Z'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* '['  */ 0,
+    /* '\\' */ 0,
+    /* ']'  */ 0,
+    /* '^'  */ 0,
+    /* '_'  */ CHAR_IDENT_START | CHAR_IDENT,
+    /* '`'  */ 0,
+    /* 'a'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT | CHAR_HEX_DIGIT,
+    /* 'b'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT | CHAR_HEX_DIGIT,
+    /* 'c'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT | CHAR_HEX_DIGIT,
+    /* 'd'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT | CHAR_HEX_DIGIT,
+    /* 'e'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT | CHAR_HEX_DIGIT,
+    /* 'f'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT | CHAR_HEX_DIGIT,
+    /* 'g'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'h'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'i'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'j'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'k'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'l'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'm'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'n'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'o'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'p'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'q'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'r'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 's'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 't'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'u'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'v'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'w'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'x'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'y'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* 'z'  */ CHAR_ALPHA | CHAR_IDENT_START | CHAR_IDENT,
+    /* '{'  */ 0,
+    /* '|'  */ 0,
+    /* '}'  */ 0,
+    /* '~'  */ 0,
+    /* 0x7F */ 0,
+    /* 0x80 */ 0,
+    /* 0x81 */ 0,
+    /* 0x82 */ 0,
+    /* 0x83 */ 0,
+    /* 0x84 */ 0,
+    /* 0x85 */ 0,
+    /* 0x86 */ 0,
+    /* 0x87 */ 0,
+    /* 0x88 */ 0,
+    /* 0x89 */ 0,
+    /* 0x8A */ 0,
+    /* 0x8B */ 0,
+    /* 0x8C */ 0,
+    /* 0x8D */ 0,
+    /* 0x8E */ 0,
+    /* 0x8F */ 0,
+    /* 0x90 */ 0,
+    /* 0x91 */ 0,
+    /* 0x92 */ 0,
+    /* 0x93 */ 0,
+    /* 0x94 */ 0,
+    /* 0x95 */ 0,
+    /* 0x96 */ 0,
+    /* 0x97 */ 0,
+    /* 0x98 */ 0,
+    /* 0x99 */ 0,
+    /* 0x9A */ 0,
+    /* 0x9B */ 0,
+    /* 0x9C */ 0,
+    /* 0x9D */ 0,
+    /* 0x9E */ 0,
+    /* 0x9F */ 0,
+    /* 0xA0 */ 0,
+    /* 0xA1 */ 0,
+    /* 0xA2 */ 0,
+    /* 0xA3 */ 0,
+    /* 0xA4 */ 0,
+    /* 0xA5 */ 0,
+    /* 0xA6 */ 0,
+    /* 0xA7 */ 0,
+    /* 0xA8 */ 0,
+    /* 0xA9 */ 0,
+    /* 0xAA */ 0,
+    /* 0xAB */ 0,
+    /* 0xAC */ 0,
+    /* 0xAD */ 0,
+    /* 0xAE */ 0,
+    /* 0xAF */ 0,
+    /* 0xB0 */ 0,
+    /* 0xB1 */ 0,
+    /* 0xB2 */ 0,
+    /* 0xB3 */ 0,
+    /* 0xB4 */ 0,
+    /* 0xB5 */ 0,
+    /* 0xB6 */ 0,
+    /* 0xB7 */ 0,
+    /* 0xB8 */ 0,
+    /* 0xB9 */ 0,
+    /* 0xBA */ 0,
+    /* 0xBB */ 0,
+    /* 0xBC */ 0,
+    /* 0xBD */ 0,
+    /* 0xBE */ 0,
+    /* 0xBF */ 0,
+    /* 0xC0 */ 0,
+    /* 0xC1 */ 0,
+    /* 0xC2 */ 0,
+    /* 0xC3 */ 0,
+    /* 0xC4 */ 0,
+    /* 0xC5 */ 0,
+    /* 0xC6 */ 0,
+    /* 0xC7 */ 0,
+    /* 0xC8 */ 0,
+    /* 0xC9 */ 0,
+    /* 0xCA */ 0,
+    /* 0xCB */ 0,
+    /* 0xCC */ 0,
+    /* 0xCD */ 0,
+    /* 0xCE */ 0,
+    /* 0xCF */ 0,
+    /* 0xD0 */ 0,
+    /* 0xD1 */ 0,
+    /* 0xD2 */ 0,
+    /* 0xD3 */ 0,
+    /* 0xD4 */ 0,
+    /* 0xD5 */ 0,
+    /* 0xD6 */ 0,
+    /* 0xD7 */ 0,
+    /* 0xD8 */ 0,
+    /* 0xD9 */ 0,
+    /* 0xDA */ 0,
+    /* 0xDB */ 0,
+    /* 0xDC */ 0,
+    /* 0xDD */ 0,
+    /* 0xDE */ 0,
+    /* 0xDF */ 0,
+    /* 0xE0 */ 0,
+    /* 0xE1 */ 0,
+    /* 0xE2 */ 0,
+    /* 0xE3 */ 0,
+    /* 0xE4 */ 0,
+    /* 0xE5 */ 0,
+    /* 0xE6 */ 0,
+    /* 0xE7 */ 0,
+    /* 0xE8 */ 0,
+    /* 0xE9 */ 0,
+    /* 0xEA */ 0,
+    /* 0xEB */ 0,
+    /* 0xEC */ 0,
+    /* 0xED */ 0,
+    /* 0xEE */ 0,
+    /* 0xEF */ 0,
+    /* 0xF0 */ 0,
+    /* 0xF1 */ 0,
+    /* 0xF2 */ 0,
+    /* 0xF3 */ 0,
+    /* 0xF4 */ 0,
+    /* 0xF5 */ 0,
+    /* 0xF6 */ 0,
+    /* 0xF7 */ 0,
+    /* 0xF8 */ 0,
+    /* 0xF9 */ 0,
+    /* 0xFA */ 0,
+    /* 0xFB */ 0,
+    /* 0xFC */ 0,
+    /* 0xFD */ 0,
+    /* 0xFE */ 0,
+    /* 0xFF */ 0,
+};
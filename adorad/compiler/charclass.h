@@ -0,0 +1,31 @@
+// Auto-generated by tools/scripts/generate_tokens.py
+// DO NOT EDIT - regenerate with:
+//     python tools/scripts/generate_tokens.py char_classes adorad/compiler/charclass.h adorad/compiler/charclass.c
+
+#ifndef ADORAD_CHARCLASS_H
+#define ADORAD_CHARCLASS_H
+
+#include <adorad/core/types.h>
+
+/*
+    Character classes used by the Lexer. `charClassTable` maps every byte to the set of classes it belongs to, so
+    classifying a character is one load and one mask (see `CHAR_IS()`).
+    Bytes >= 0x80 belong to no class.
+*/
+#define CHAR_BLANK         0x01    // ' ', '\t', '\r', '\v' and '\f' (_not_ '\n')
+#define CHAR_ALPHA         0x02    // [A-Za-z]
+#define CHAR_IDENT_START   0x04    // [A-Za-z_] - begins an identifier
+#define CHAR_IDENT         0x08    // [A-Za-z0-9_] - continues an identifier (or a macro/attribute name)
+#define CHAR_DIGIT         0x10    // [0-9]
+#define CHAR_HEX_DIGIT     0x20    // [0-9A-Fa-f]
+#define CHAR_OCT_DIGIT     0x40    // [0-7]
+#define CHAR_BIN_DIGIT     0x80    // [01]
+
+extern const UInt8 charClassTable[256];
+
+// The classes of `c`
+#define CHAR_CLASS(c)           (charClassTable[cast(UInt8)(c)])
+// Is `c` in any of the classes in `classes`?
+#define CHAR_IS(c, classes)     ((CHAR_CLASS(c) & (classes)) != 0)
+
+#endif // ADORAD_CHARCLASS_H
@@ -11,6 +11,15 @@ SPDX-License-Identifier: MIT
 Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
 */
 
+#ifndef ADORAD_COMPILER_H
+#define ADORAD_COMPILER_H
+
+// Version of the compiler (keep in sync with the top-level CMakeLists.txt)
+#define ADORAD_VERSION_MAJOR    1
+#define ADORAD_VERSION_MINOR    0
+#define ADORAD_VERSION_PATCH    0
+#define ADORAD_VERSION          (ADORAD_VERSION_MAJOR * 10000 + ADORAD_VERSION_MINOR * 100 + ADORAD_VERSION_PATCH)
+
 typedef enum {
     TimeFormatTime__hhmm12,
     TimeFormatTime__hhmm24,
@@ -67,3 +76,5 @@ typedef enum {
     OutputArchRv32,
     OutputArchI386,
 } OutputArch;
+
+#endif // ADORAD_COMPILER_H
@@ -0,0 +1,823 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <adorad/core/compilers.h>
+#include <adorad/core/debug.h>
+#include <adorad/compiler/comptime.h>
+#include <adorad/compiler/fold.h>
+
+#if defined(CORETEN_COMPILER_GCC) || defined(CORETEN_COMPILER_CLANG)
+    #define COMPTIME_THREADED   1
+#else
+    #define COMPTIME_THREADED   0
+#endif
+
+// A call in progress (the callers of the running function)
+typedef struct ComptimeFrame {
+    ComptimeFunc* func;         // the caller
+    const UInt32* pc;           // where it resumes
+    ComptimeValue* base;        // its registers
+    UInt32 ret;                 // its register the result goes to
+    UInt32 callee;              // index of the function called
+    bool is_memoized;           // set if the result is to be memoized (with `args`)
+    ComptimeValue args[COMPTIME_MEMO_MAX_ARGS];
+} ComptimeFrame;
+
+ComptimeValue comptime_int(Int64 value) {
+    ComptimeValue result = { .kind = ComptimeValueKindInt, .int_value = value };
+    return result;
+}
+
+ComptimeValue comptime_float(Float64 value) {
+    ComptimeValue result = { .kind = ComptimeValueKindFloat, .float_value = value };
+    return result;
+}
+
+ComptimeValue comptime_bool(bool value) {
+    ComptimeValue result = { .kind = ComptimeValueKindBool, .int_value = 0 };
+    result.bool_value = value;
+    return result;
+}
+
+ComptimeVM* comptime_vm_new(ComptimeOptions* options) {
+    ComptimeVM* vm = cast(ComptimeVM*)calloc(1, sizeof(ComptimeVM));
+    CORETEN_ENFORCE_NN(vm, "Could not allocate memory. Memory full.");
+    if(SOME(options))
+        vm->options = *options;
+    if(vm->options.max_steps == 0)
+        vm->options.max_steps = COMPTIME_DEFAULT_MAX_STEPS;
+    if(vm->options.max_memory == 0)
+        vm->options.max_memory = COMPTIME_DEFAULT_MAX_MEMORY;
+    vm->funcs = VEC_NEW(ComptimeFunc, 8);
+    vm->arrays = VEC_NEW(ComptimeArray, 8);
+    vm->stack = cast(ComptimeValue*)malloc(COMPTIME_STACK_SIZE * sizeof(ComptimeValue));
+    CORETEN_ENFORCE_NN(vm->stack, "Could not allocate memory. Memory full.");
+    return vm;
+}
+
+void comptime_vm_free(ComptimeVM* vm) {
+    if(NONE(vm))
+        return;
+    for(UInt64 i = 0; i < vec_size(vm->funcs); i++) {
+        ComptimeFunc* func = vec_at_ComptimeFunc(vm->funcs, i);
+        free(func->code);
+        free(func->consts);
+    }
+    for(UInt64 i = 0; i < vec_size(vm->arrays); i++)
+        free(vec_at_ComptimeArray(vm->arrays, i)->values);
+    vec_free(vm->funcs);
+    vec_free(vm->arrays);
+    free(vm->stack);
+    free(vm->memo);
+    free(vm);
+}
+
+const char* comptime_result_str(ComptimeResult result) {
+    switch(result) {
+        case ComptimeOk: return "ok";
+        case ComptimeTypeError: return "operands of the wrong type";
+        case ComptimeDivisionByZero: return "division by zero";
+        case ComptimeIndexOutOfRange: return "index out of range";
+        case ComptimeStepLimit: return "too many steps (an infinite loop?)";
+        case ComptimeMemoryLimit: return "too much memory";
+        case ComptimeStackOverflow: return "calls nested too deep";
+        case ComptimeNotConstant: return "not a compile-time constant";
+        default: return "unknown error";
+    }
+}
+
+// The bits of a value that make it what it is (for equality and hashing)
+static UInt64 comptime_value_bits(const ComptimeValue* value) {
+    switch(value->kind) {
+        case ComptimeValueKindFloat: {
+            UInt64 bits;
+            memcpy(&bits, &value->float_value, sizeof(bits));
+            return bits;
+        }
+        case ComptimeValueKindBool: return value->bool_value;
+        case ComptimeValueKindArray: return value->array;
+        default: return cast(UInt64)value->int_value;
+    }
+}
+
+static bool comptime_value_equals(const ComptimeValue* a, const ComptimeValue* b) {
+    return a->kind == b->kind && comptime_value_bits(a) == comptime_value_bits(b);
+}
+
+//
+// Building functions
+//
+UInt32 comptime_func_new(ComptimeVM* vm, const char* name, UInt32 num_params) {
+    CORETEN_ENFORCE(num_params < COMPTIME_MAX_REGS, "Too many parameters");
+    CORETEN_ENFORCE(vec_size(vm->funcs) <= UInt16_MAX, "Too many functions");
+    ComptimeFunc func = {0};
+    func.name = name;
+    func.num_params = num_params;
+    func.num_regs = num_params;
+    vec_push_ComptimeFunc(vm->funcs, &func);
+    return cast(UInt32)vec_size(vm->funcs) - 1;
+}
+
+UInt32 comptime_new_reg(ComptimeVM* vm, UInt32 func) {
+    ComptimeFunc* f = vec_at_ComptimeFunc(vm->funcs, func);
+    CORETEN_ENFORCE(f->num_regs < COMPTIME_MAX_REGS, "Too many registers");
+    return f->num_regs++;
+}
+
+UInt32 comptime_const(ComptimeVM* vm, UInt32 func, ComptimeValue value) {
+    ComptimeFunc* f = vec_at_ComptimeFunc(vm->funcs, func);
+    for(UInt32 i = 0; i < f->num_consts; i++) {
+        if(comptime_value_equals(&f->consts[i], &value))
+            return i;
+    }
+    CORETEN_ENFORCE(f->num_consts <= UInt16_MAX, "Too many constants");
+    if(f->num_consts == f->consts_cap) {
+        f->consts_cap = f->consts_cap > 0 ? 2 * f->consts_cap : 8;
+        f->consts = cast(ComptimeValue*)realloc(f->consts, f->consts_cap * sizeof(ComptimeValue));
+        CORETEN_ENFORCE_NN(f->consts, "Could not allocate memory. Memory full.");
+    }
+    f->consts[f->num_consts] = value;
+    return f->num_consts++;
+}
+
+UInt32 comptime_emit(ComptimeVM* vm, UInt32 func, UInt32 ins) {
+    ComptimeFunc* f = vec_at_ComptimeFunc(vm->funcs, func);
+    CORETEN_ENFORCE(COMPTIME_OP(ins) < ComptimeOpCount, "No such instruction");
+    if(f->len == f->cap) {
+        f->cap = f->cap > 0 ? 2 * f->cap : 16;
+        f->code = cast(UInt32*)realloc(f->code, f->cap * sizeof(UInt32));
+        CORETEN_ENFORCE_NN(f->code, "Could not allocate memory. Memory full.");
+    }
+    f->code[f->len] = ins;
+    // (Re)checked at the next call
+    f->purity = ComptimePurityUnknown;
+    return f->len++;
+}
+
+void comptime_patch_jump(ComptimeVM* vm, UInt32 func, UInt32 at, UInt32 target) {
+    ComptimeFunc* f = vec_at_ComptimeFunc(vm->funcs, func);
+    CORETEN_ENFORCE(at < f->len, "No such instruction");
+    Int64 offset = cast(Int64)target - (cast(Int64)at + 1);
+    CORETEN_ENFORCE(offset >= Int16_MIN && offset <= Int16_MAX, "Jump too far");
+    f->code[at] = (f->code[at] & 0xffff) | cast(UInt32)cast(UInt16)cast(Int16)offset << 16;
+}
+
+// Check the operands of every instruction of function `index` (see the top of <adorad/compiler/comptime.h>), and
+// work out whether it's pure. Returns false if it isn't (with the functions it calls being taken to be pure while
+// they're being worked out - so that recursion works)
+static bool comptime_prepare(ComptimeVM* vm, UInt32 index) {
+    ComptimeFunc* func = vec_at_ComptimeFunc(vm->funcs, index);
+    if(func->purity == ComptimePurityPending)
+        return true;
+    if(func->purity != ComptimePurityUnknown)
+        return func->purity == ComptimePurityPure;
+    func->purity = ComptimePurityPending;
+    CORETEN_ENFORCE(func->len > 0, "A comptime function has no instructions");
+    UInt32 last = COMPTIME_OP(func->code[func->len - 1]);
+    CORETEN_ENFORCE(last == ComptimeOpReturn || last == ComptimeOpJump, "A comptime function falls off its end");
+
+    bool is_pure = func->num_params <= COMPTIME_MEMO_MAX_ARGS;
+    UInt32 num_regs = func->num_regs;
+    for(UInt32 pc = 0; pc < func->len; pc++) {
+        UInt32 ins = func->code[pc];
+        UInt32 op = COMPTIME_OP(ins);
+        bool is_ok = COMPTIME_A(ins) < num_regs;
+        switch(op) {
+            case ComptimeOpLoadConst:
+                is_ok = is_ok && COMPTIME_BX(ins) < func->num_consts;
+                break;
+            case ComptimeOpLoadInt:
+                break;
+            case ComptimeOpMove:
+            case ComptimeOpAddInt:
+            case ComptimeOpNeg:
+            case ComptimeOpNot:
+            case ComptimeOpNewArray:
+            case ComptimeOpLen:
+                is_ok = is_ok && COMPTIME_B(ins) < num_regs;
+                break;
+            case ComptimeOpJump:
+            case ComptimeOpJumpIf:
+            case ComptimeOpJumpIfNot: {
+                Int64 target = cast(Int64)pc + 1 + COMPTIME_SBX(ins);
+                is_ok = (op == ComptimeOpJump || is_ok) && target >= 0 && target < func->len;
+                break;
+            }
+            case ComptimeOpCall: {
+                UInt32 callee = COMPTIME_BX(ins);
+                is_ok = is_ok && callee < vec_size(vm->funcs);
+                if(is_ok) {
+                    is_ok = COMPTIME_A(ins) + vec_at_ComptimeFunc(vm->funcs, callee)->num_params < num_regs;
+                    is_pure = comptime_prepare(vm, callee) && is_pure;
+                    func = vec_at_ComptimeFunc(vm->funcs, index);
+                }
+                break;
+            }
+            case ComptimeOpReturn:
+                break;
+            default:
+                is_ok = is_ok && COMPTIME_B(ins) < num_regs && COMPTIME_C(ins) < num_regs;
+                break;
+        }
+        if(op == ComptimeOpNewArray || op == ComptimeOpGetIndex || op == ComptimeOpSetIndex || op == ComptimeOpLen)
+            is_pure = false;
+        CORETEN_ENFORCE(is_ok, "A comptime instruction has an operand out of range");
+    }
+    func->purity = is_pure ? ComptimePurityPure : ComptimePurityImpure;
+    return is_pure;
+}
+
+//
+// Memoization
+//
+static UInt64 comptime_memo_hash(UInt32 func, const ComptimeValue* args, UInt32 num_args) {
+    UInt64 hash = (func + 1) * 0x9e3779b97f4a7c15ull;
+    for(UInt32 i = 0; i < num_args; i++) {
+        hash = (hash ^ comptime_value_bits(&args[i]) ^ cast(UInt64)args[i].kind << 60) * 0xff51afd7ed558ccdull;
+        hash ^= hash >> 32;
+    }
+    return hash;
+}
+
+// Returns the entry of the call (of function `func`, with `args`), or the free entry it goes to
+static ComptimeMemoEntry* comptime_memo_find(ComptimeVM* vm, UInt32 func, const ComptimeValue* args,
+                                             UInt32 num_args) {
+    UInt32 mask = vm->memo_cap - 1;
+    for(UInt32 i = cast(UInt32)comptime_memo_hash(func, args, num_args) & mask;; i = (i + 1) & mask) {
+        ComptimeMemoEntry* entry = &vm->memo[i];
+        if(entry->func == 0)
+            return entry;
+        if(entry->func != func + 1)
+            continue;
+        bool is_same = true;
+        for(UInt32 j = 0; j < num_args && is_same; j++)
+            is_same = comptime_value_equals(&entry->args[j], &args[j]);
+        if(is_same)
+            return entry;
+    }
+}
+
+static void comptime_memo_insert(ComptimeVM* vm, UInt32 func, const ComptimeValue* args, UInt32 num_args,
+                                 ComptimeValue result) {
+    if(vm->memo_len >= COMPTIME_MEMO_MAX_ENTRIES)
+        return;
+    // At most half full
+    if(2 * (vm->memo_len + 1) > vm->memo_cap) {
+        ComptimeMemoEntry* old = vm->memo;
+        UInt32 old_cap = vm->memo_cap;
+        vm->memo_cap = old_cap > 0 ? 2 * old_cap : 1024;
+        vm->memo = cast(ComptimeMemoEntry*)calloc(vm->memo_cap, sizeof(ComptimeMemoEntry));
+        CORETEN_ENFORCE_NN(vm->memo, "Could not allocate memory. Memory full.");
+        for(UInt32 i = 0; i < old_cap; i++) {
+            if(old[i].func != 0) {
+                UInt32 num = vec_at_ComptimeFunc(vm->funcs, old[i].func - 1)->num_params;
+                *comptime_memo_find(vm, old[i].func - 1, old[i].args, num) = old[i];
+            }
+        }
+        free(old);
+    }
+    ComptimeMemoEntry* entry = comptime_memo_find(vm, func, args, num_args);
+    if(entry->func == 0) {
+        entry->func = func + 1;
+        memcpy(entry->args, args, num_args * sizeof(ComptimeValue));
+        vm->memo_len++;
+    }
+    entry->result = result;
+}
+
+//
+// Evaluation
+//
+// The slow paths of the arithmetic, bitwise and comparison instructions: anything but two ints
+static ComptimeResult comptime_slow_op(UInt32 op, const ComptimeValue* lhs, const ComptimeValue* rhs,
+                                       ComptimeValue* result) {
+    bool is_number = (lhs->kind == ComptimeValueKindInt || lhs->kind == ComptimeValueKindFloat) &&
+                     (rhs->kind == ComptimeValueKindInt || rhs->kind == ComptimeValueKindFloat);
+    if(op == ComptimeOpEq || op == ComptimeOpNe) {
+        bool is_equal;
+        if(is_number) {
+            Float64 a = lhs->kind == ComptimeValueKindInt ? cast(Float64)lhs->int_value : lhs->float_value;
+            Float64 b = rhs->kind == ComptimeValueKindInt ? cast(Float64)rhs->int_value : rhs->float_value;
+            is_equal = a == b;
+        } else if(lhs->kind == rhs->kind) {
+            is_equal = comptime_value_bits(lhs) == comptime_value_bits(rhs);
+        } else {
+            return ComptimeTypeError;
+        }
+        *result = comptime_bool(op == ComptimeOpEq ? is_equal : !is_equal);
+        return ComptimeOk;
+    }
+    if(lhs->kind == ComptimeValueKindBool && rhs->kind == ComptimeValueKindBool) {
+        switch(op) {
+            case ComptimeOpBitAnd: *result = comptime_bool(lhs->bool_value && rhs->bool_value); return ComptimeOk;
+            case ComptimeOpBitOr: *result = comptime_bool(lhs->bool_value || rhs->bool_value); return ComptimeOk;
+            case ComptimeOpBitXor: *result = comptime_bool(lhs->bool_value != rhs->bool_value); return ComptimeOk;
+            default: return ComptimeTypeError;
+        }
+    }
+    if(!is_number)
+        return ComptimeTypeError;
+    Float64 a = lhs->kind == ComptimeValueKindInt ? cast(Float64)lhs->int_value : lhs->float_value;
+    Float64 b = rhs->kind == ComptimeValueKindInt ? cast(Float64)rhs->int_value : rhs->float_value;
+    switch(op) {
+        case ComptimeOpAdd: *result = comptime_float(a + b); return ComptimeOk;
+        case ComptimeOpSub: *result = comptime_float(a - b); return ComptimeOk;
+        case ComptimeOpMul: *result = comptime_float(a * b); return ComptimeOk;
+        case ComptimeOpDiv:
+            if(b == 0)
+                return ComptimeDivisionByZero;
+            *result = comptime_float(a / b);
+            return ComptimeOk;
+        case ComptimeOpLt: *result = comptime_bool(a < b); return ComptimeOk;
+        case ComptimeOpLe: *result = comptime_bool(a <= b); return ComptimeOk;
+        // `%`, and the bitwise operators, are only for ints
+        default: return ComptimeTypeError;
+    }
+}
+
+ComptimeArray* comptime_array_of(ComptimeVM* vm, ComptimeValue value) {
+    if(value.kind != ComptimeValueKindArray || value.array >= vec_size(vm->arrays))
+        return null;
+    return vec_at_ComptimeArray(vm->arrays, value.array);
+}
+
+ComptimeResult comptime_call(ComptimeVM* vm, UInt32 index, const ComptimeValue* args, ComptimeValue* result) {
+    CORETEN_ENFORCE(index < vec_size(vm->funcs), "No such comptime function");
+    for(UInt64 i = 0; i < vec_size(vm->funcs); i++)
+        comptime_prepare(vm, cast(UInt32)i);
+    ComptimeFunc* funcs = vec_at_ComptimeFunc(vm->funcs, 0);
+    ComptimeFunc* func = &funcs[index];
+    ComptimeFrame* frames = cast(ComptimeFrame*)malloc(COMPTIME_MAX_FRAMES * sizeof(ComptimeFrame));
+    CORETEN_ENFORCE_NN(frames, "Could not allocate memory. Memory full.");
+    UInt32 depth = 0;
+    ComptimeValue* base = vm->stack;
+    ComptimeValue* stack_end = vm->stack + COMPTIME_STACK_SIZE;
+    if(func->num_params > 0)
+        memcpy(base, args, func->num_params * sizeof(ComptimeValue));
+    const UInt32* pc = func->code;
+    const ComptimeValue* consts = func->consts;
+    UInt64 num_steps = 0;
+    UInt64 max_steps = vm->options.max_steps;
+    ComptimeResult status = ComptimeOk;
+    UInt32 ins;
+
+    #define R(x)        base[x]
+    #define VM_A        R(COMPTIME_A(ins))
+    #define VM_B        R(COMPTIME_B(ins))
+    #define VM_C        R(COMPTIME_C(ins))
+    // Fail with `result`
+    #define VM_FAIL(result)         \
+        do {                        \
+            status = (result);      \
+            goto fail;              \
+        } while(0)
+    // Count a step (a backward jump or a call) against the budget
+    #define VM_STEP()                                           \
+        if(CORETEN_UNLIKELY(++num_steps > max_steps))          \
+            VM_FAIL(ComptimeStepLimit)
+    #define VM_SET_INT(reg, value)                              \
+        do {                                                    \
+            Int64 __value = (value);                            \
+            (reg).kind = ComptimeValueKindInt;                  \
+            (reg).int_value = __value;                          \
+        } while(0)
+    #define VM_SET_BOOL(reg, value)                             \
+        do {                                                    \
+            bool __value = (value);                             \
+            (reg).kind = ComptimeValueKindBool;                 \
+            (reg).int_value = 0;                                \
+            (reg).bool_value = __value;                         \
+        } while(0)
+    // `R[a] = R[b] op R[c]`: `expr` over the UInt64s `lhs` and `rhs` if both are ints (so that they wrap around),
+    // and the slow path otherwise
+    #define VM_BINARY(int_expr, set)                                                                    \
+        do {                                                                                            \
+            ComptimeValue* __lhs = &VM_B;                                                               \
+            ComptimeValue* __rhs = &VM_C;                                                               \
+            if(CORETEN_LIKELY(__lhs->kind == ComptimeValueKindInt && __rhs->kind == ComptimeValueKindInt)) { \
+                UInt64 lhs = cast(UInt64)__lhs->int_value;                                              \
+                UInt64 rhs = cast(UInt64)__rhs->int_value;                                              \
+                (void)lhs;                                                                              \
+                (void)rhs;                                                                              \
+                set(VM_A, int_expr);                                                                    \
+            } else {                                                                                    \
+                ComptimeValue __result;                                                                 \
+                ComptimeResult __status = comptime_slow_op(COMPTIME_OP(ins), __lhs, __rhs, &__result);  \
+                if(CORETEN_UNLIKELY(__status != ComptimeOk))                                            \
+                    VM_FAIL(__status);                                                                  \
+                VM_A = __result;                                                                        \
+            }                                                                                           \
+        } while(0)
+    #define VM_JUMP()                               \
+        do {                                        \
+            Int32 __offset = COMPTIME_SBX(ins);     \
+            pc += __offset;                         \
+            if(__offset < 0)                        \
+                VM_STEP();                          \
+        } while(0)
+
+#if COMPTIME_THREADED
+    // Direct-threaded: every instruction jumps straight to the next one's code
+    static const void* const labels[ComptimeOpCount] = {
+        [ComptimeOpLoadConst] = &&vm_LoadConst,
+        [ComptimeOpLoadInt] = &&vm_LoadInt,
+        [ComptimeOpMove] = &&vm_Move,
+        [ComptimeOpAdd] = &&vm_Add,
+        [ComptimeOpAddInt] = &&vm_AddInt,
+        [ComptimeOpSub] = &&vm_Sub,
+        [ComptimeOpMul] = &&vm_Mul,
+        [ComptimeOpDiv] = &&vm_Div,
+        [ComptimeOpMod] = &&vm_Mod,
+        [ComptimeOpBitAnd] = &&vm_BitAnd,
+        [ComptimeOpBitOr] = &&vm_BitOr,
+        [ComptimeOpBitXor] = &&vm_BitXor,
+        [ComptimeOpShl] = &&vm_Shl,
+        [ComptimeOpShr] = &&vm_Shr,
+        [ComptimeOpEq] = &&vm_Eq,
+        [ComptimeOpNe] = &&vm_Ne,
+        [ComptimeOpLt] = &&vm_Lt,
+        [ComptimeOpLe] = &&vm_Le,
+        [ComptimeOpNeg] = &&vm_Neg,
+        [ComptimeOpNot] = &&vm_Not,
+        [ComptimeOpJump] = &&vm_Jump,
+        [ComptimeOpJumpIf] = &&vm_JumpIf,
+        [ComptimeOpJumpIfNot] = &&vm_JumpIfNot,
+        [ComptimeOpCall] = &&vm_Call,
+        [ComptimeOpReturn] = &&vm_Return,
+        [ComptimeOpNewArray] = &&vm_NewArray,
+        [ComptimeOpGetIndex] = &&vm_GetIndex,
+        [ComptimeOpSetIndex] = &&vm_SetIndex,
+        [ComptimeOpLen] = &&vm_Len,
+    };
+    #define VM_CASE(op)     vm_##op:
+    #define VM_NEXT()       do { ins = *pc++; goto *labels[COMPTIME_OP(ins)]; } while(0)
+    VM_NEXT();
+    {
+#else
+    #define VM_CASE(op)     case ComptimeOp##op:
+    #define VM_NEXT()       continue
+    for(;;) {
+        ins = *pc++;
+        switch(COMPTIME_OP(ins)) {
+#endif
+        VM_CASE(LoadConst) {
+            VM_A = consts[COMPTIME_BX(ins)];
+            VM_NEXT();
+        }
+        VM_CASE(LoadInt) {
+            VM_SET_INT(VM_A, COMPTIME_SBX(ins));
+            VM_NEXT();
+        }
+        VM_CASE(Move) {
+            VM_A = VM_B;
+            VM_NEXT();
+        }
+        VM_CASE(Add) {
+            VM_BINARY(cast(Int64)(lhs + rhs), VM_SET_INT);
+            VM_NEXT();
+        }
+        VM_CASE(AddInt) {
+            ComptimeValue* operand = &VM_B;
+            Int64 imm = cast(Int8)COMPTIME_C(ins);
+            if(CORETEN_LIKELY(operand->kind == ComptimeValueKindInt))
+                VM_SET_INT(VM_A, cast(Int64)(cast(UInt64)operand->int_value + cast(UInt64)imm));
+            else if(operand->kind == ComptimeValueKindFloat)
+                VM_A = comptime_float(operand->float_value + cast(Float64)imm);
+            else
+                VM_FAIL(ComptimeTypeError);
+            VM_NEXT();
+        }
+        VM_CASE(Sub) {
+            VM_BINARY(cast(Int64)(lhs - rhs), VM_SET_INT);
+            VM_NEXT();
+        }
+        VM_CASE(Mul) {
+            VM_BINARY(cast(Int64)(lhs * rhs), VM_SET_INT);
+            VM_NEXT();
+        }
+        VM_CASE(Div) {
+            if(VM_C.kind == ComptimeValueKindInt && VM_C.int_value == 0)
+                VM_FAIL(ComptimeDivisionByZero);
+            // `Int64 min / -1` wraps around (to itself)
+            VM_BINARY(cast(Int64)rhs == -1 ? cast(Int64)(0 - lhs) : cast(Int64)lhs / cast(Int64)rhs, VM_SET_INT);
+            VM_NEXT();
+        }
+        VM_CASE(Mod) {
+            if(VM_C.kind == ComptimeValueKindInt && VM_C.int_value == 0)
+                VM_FAIL(ComptimeDivisionByZero);
+            VM_BINARY(cast(Int64)rhs == -1 ? 0 : cast(Int64)lhs % cast(Int64)rhs, VM_SET_INT);
+            VM_NEXT();
+        }
+        VM_CASE(BitAnd) {
+            VM_BINARY(cast(Int64)(lhs & rhs), VM_SET_INT);
+            VM_NEXT();
+        }
+        VM_CASE(BitOr) {
+            VM_BINARY(cast(Int64)(lhs | rhs), VM_SET_INT);
+            VM_NEXT();
+        }
+        VM_CASE(BitXor) {
+            VM_BINARY(cast(Int64)(lhs ^ rhs), VM_SET_INT);
+            VM_NEXT();
+        }
+        VM_CASE(Shl) {
+            // Shifting by the width (or more) shifts everything out
+            VM_BINARY(rhs < 64 ? cast(Int64)(lhs << rhs) : 0, VM_SET_INT);
+            VM_NEXT();
+        }
+        VM_CASE(Shr) {
+            // Arithmetic: the sign is shifted in
+            VM_BINARY(cast(Int64)lhs >> (rhs < 64 ? rhs : 63), VM_SET_INT);
+            VM_NEXT();
+        }
+        VM_CASE(Eq) {
+            VM_BINARY(lhs == rhs, VM_SET_BOOL);
+            VM_NEXT();
+        }
+        VM_CASE(Ne) {
+            VM_BINARY(lhs != rhs, VM_SET_BOOL);
+            VM_NEXT();
+        }
+        VM_CASE(Lt) {
+            VM_BINARY(cast(Int64)lhs < cast(Int64)rhs, VM_SET_BOOL);
+            VM_NEXT();
+        }
+        VM_CASE(Le) {
+            VM_BINARY(cast(Int64)lhs <= cast(Int64)rhs, VM_SET_BOOL);
+            VM_NEXT();
+        }
+        VM_CASE(Neg) {
+            ComptimeValue* operand = &VM_B;
+            if(operand->kind == ComptimeValueKindInt)
+                VM_SET_INT(VM_A, cast(Int64)(0 - cast(UInt64)operand->int_value));
+            else if(operand->kind == ComptimeValueKindFloat)
+                VM_A = comptime_float(-operand->float_value);
+            else
+                VM_FAIL(ComptimeTypeError);
+            VM_NEXT();
+        }
+        VM_CASE(Not) {
+            if(CORETEN_UNLIKELY(VM_B.kind != ComptimeValueKindBool))
+                VM_FAIL(ComptimeTypeError);
+            VM_SET_BOOL(VM_A, !VM_B.bool_value);
+            VM_NEXT();
+        }
+        VM_CASE(Jump) {
+            VM_JUMP();
+            VM_NEXT();
+        }
+        VM_CASE(JumpIf) {
+            if(CORETEN_UNLIKELY(VM_A.kind != ComptimeValueKindBool))
+                VM_FAIL(ComptimeTypeError);
+            if(VM_A.bool_value)
+                VM_JUMP();
+            VM_NEXT();
+        }
+        VM_CASE(JumpIfNot) {
+            if(CORETEN_UNLIKELY(VM_A.kind != ComptimeValueKindBool))
+                VM_FAIL(ComptimeTypeError);
+            if(!VM_A.bool_value)
+                VM_JUMP();
+            VM_NEXT();
+        }
+        VM_CASE(Call) {
+            VM_STEP();
+            UInt32 callee_index = COMPTIME_BX(ins);
+            ComptimeFunc* callee = &funcs[callee_index];
+            ComptimeValue* call_args = &R(COMPTIME_A(ins) + 1);
+            bool is_memoized = callee->purity == ComptimePurityPure;
+            for(UInt32 i = 0; i < callee->num_params && is_memoized; i++)
+                is_memoized = call_args[i].kind != ComptimeValueKindArray;
+            if(is_memoized && vm->memo_len > 0) {
+                ComptimeMemoEntry* entry = comptime_memo_find(vm, callee_index, call_args, callee->num_params);
+                if(entry->func != 0) {
+                    vm->num_memo_hits++;
+                    VM_A = entry->result;
+                    VM_NEXT();
+                }
+            }
+            ComptimeValue* callee_base = base + func->num_regs;
+            if(CORETEN_UNLIKELY(depth == COMPTIME_MAX_FRAMES || callee_base + callee->num_regs > stack_end))
+                VM_FAIL(ComptimeStackOverflow);
+            ComptimeFrame* frame = &frames[depth++];
+            frame->func = func;
+            frame->pc = pc;
+            frame->base = base;
+            frame->ret = COMPTIME_A(ins);
+            frame->callee = callee_index;
+            frame->is_memoized = is_memoized;
+            if(is_memoized)
+                memcpy(frame->args, call_args, callee->num_params * sizeof(ComptimeValue));
+            memcpy(callee_base, call_args, callee->num_params * sizeof(ComptimeValue));
+            func = callee;
+            base = callee_base;
+            pc = func->code;
+            consts = func->consts;
+            VM_NEXT();
+        }
+        VM_CASE(Return) {
+            ComptimeValue value = VM_A;
+            if(depth == 0) {
+                *result = value;
+                goto done;
+            }
+            ComptimeFrame* frame = &frames[--depth];
+            if(frame->is_memoized && value.kind != ComptimeValueKindArray)
+                comptime_memo_insert(vm, frame->callee, frame->args, func->num_params, value);
+            func = frame->func;
+            base = frame->base;
+            pc = frame->pc;
+            consts = func->consts;
+            R(frame->ret) = value;
+            VM_NEXT();
+        }
+        VM_CASE(NewArray) {
+            ComptimeValue* len = &VM_B;
+            if(CORETEN_UNLIKELY(len->kind != ComptimeValueKindInt || len->int_value < 0))
+                VM_FAIL(ComptimeTypeError);
+            UInt64 num_bytes = cast(UInt64)len->int_value * sizeof(ComptimeValue);
+            if(CORETEN_UNLIKELY(cast(UInt64)len->int_value > vm->options.max_memory ||
+                                vm->num_bytes + num_bytes > vm->options.max_memory ||
+                                vec_size(vm->arrays) > UInt32_MAX))
+                VM_FAIL(ComptimeMemoryLimit);
+            // All zeros is all `0` ints
+            ComptimeArray array = { cast(ComptimeValue*)calloc(len->int_value > 0 ? len->int_value : 1,
+                                                               sizeof(ComptimeValue)),
+                                    cast(UInt64)len->int_value };
+            CORETEN_ENFORCE_NN(array.values, "Could not allocate memory. Memory full.");
+            vm->num_bytes += num_bytes;
+            vec_push_ComptimeArray(vm->arrays, &array);
+            VM_A.kind = ComptimeValueKindArray;
+            VM_A.int_value = 0;
+            VM_A.array = cast(UInt32)vec_size(vm->arrays) - 1;
+            VM_NEXT();
+        }
+        VM_CASE(GetIndex) {
+            ComptimeValue* array = &VM_B;
+            ComptimeValue* at = &VM_C;
+            if(CORETEN_UNLIKELY(array->kind != ComptimeValueKindArray || at->kind != ComptimeValueKindInt))
+                VM_FAIL(ComptimeTypeError);
+            ComptimeArray* a = vec_at_ComptimeArray(vm->arrays, array->array);
+            if(CORETEN_UNLIKELY(cast(UInt64)at->int_value >= a->len))
+                VM_FAIL(ComptimeIndexOutOfRange);
+            VM_A = a->values[at->int_value];
+            VM_NEXT();
+        }
+        VM_CASE(SetIndex) {
+            ComptimeValue* array = &VM_A;
+            ComptimeValue* at = &VM_B;
+            if(CORETEN_UNLIKELY(array->kind != ComptimeValueKindArray || at->kind != ComptimeValueKindInt))
+                VM_FAIL(ComptimeTypeError);
+            ComptimeArray* a = vec_at_ComptimeArray(vm->arrays, array->array);
+            if(CORETEN_UNLIKELY(cast(UInt64)at->int_value >= a->len))
+                VM_FAIL(ComptimeIndexOutOfRange);
+            a->values[at->int_value] = VM_C;
+            VM_NEXT();
+        }
+        VM_CASE(Len) {
+            if(CORETEN_UNLIKELY(VM_B.kind != ComptimeValueKindArray))
+                VM_FAIL(ComptimeTypeError);
+            VM_SET_INT(VM_A, cast(Int64)vec_at_ComptimeArray(vm->arrays, VM_B.array)->len);
+            VM_NEXT();
+        }
+#if !COMPTIME_THREADED
+        }
+#endif
+    }
+
+fail:
+    vm->error_func = func->name;
+    vm->error_pc = cast(UInt32)(pc - 1 - func->code);
+done:
+    vm->num_steps += num_steps;
+    free(frames);
+    return status;
+
+    #undef R
+    #undef VM_A
+    #undef VM_B
+    #undef VM_C
+    #undef VM_FAIL
+    #undef VM_STEP
+    #undef VM_SET_INT
+    #undef VM_SET_BOOL
+    #undef VM_BINARY
+    #undef VM_JUMP
+    #undef VM_CASE
+    #undef VM_NEXT
+}
+
+//
+// Compiling expressions
+//
+// Compile `node` into code that leaves its value in register `dst` (registers above it are free to use)
+static ComptimeResult comptime_compile_node(ComptimeVM* vm, UInt32 func, AstNode* node, UInt32 dst) {
+    if(dst >= COMPTIME_MAX_REGS - 1)
+        return ComptimeNotConstant;
+    while(vec_at_ComptimeFunc(vm->funcs, func)->num_regs <= dst + 1)
+        comptime_new_reg(vm, func);
+
+    FoldValue value;
+    if(fold_value_of(node, &value)) {
+        ComptimeValue constant;
+        switch(value.kind) {
+            case FoldValueKindInt:
+                // Comptime ints are Int64s
+                if(value.magnitude > (value.is_negative ? cast(UInt64)Int64_MAX + 1 : cast(UInt64)Int64_MAX))
+                    return ComptimeNotConstant;
+                constant = comptime_int(value.is_negative ? cast(Int64)(0 - value.magnitude) :
+                                                            cast(Int64)value.magnitude);
+                if(constant.int_value >= Int16_MIN && constant.int_value <= Int16_MAX) {
+                    comptime_emit(vm, func, COMPTIME_INS_BX(ComptimeOpLoadInt, dst, constant.int_value));
+                    return ComptimeOk;
+                }
+                break;
+            case FoldValueKindFloat:
+                constant = comptime_float(value.float_value);
+                break;
+            default:
+                constant = comptime_bool(value.bool_value);
+                break;
+        }
+        comptime_emit(vm, func, COMPTIME_INS_BX(ComptimeOpLoadConst, dst, comptime_const(vm, func, constant)));
+        return ComptimeOk;
+    }
+
+    ComptimeResult result;
+    switch(node->kind) {
+        case AstNodeKindGroupedExpr:
+            return comptime_compile_node(vm, func, node->data.expr->grouped_expr->expr, dst);
+        case AstNodeKindPrefixOpExpr: {
+            PrefixOpKind op = node->data.prefix_op_expr->op;
+            if(op != PrefixOpKindMinus && op != PrefixOpKindBoolNot && op != PrefixOpKindNegation)
+                return ComptimeNotConstant;
+            if((result = comptime_compile_node(vm, func, node->data.prefix_op_expr->expr, dst)) != ComptimeOk)
+                return result;
+            if(op == PrefixOpKindNegation) {
+                // `!x` is `x ^ -1`
+                comptime_emit(vm, func, COMPTIME_INS_BX(ComptimeOpLoadInt, dst + 1, -1));
+                comptime_emit(vm, func, COMPTIME_INS(ComptimeOpBitXor, dst, dst, dst + 1));
+            } else {
+                ComptimeOp unary = op == PrefixOpKindMinus ? ComptimeOpNeg : ComptimeOpNot;
+                comptime_emit(vm, func, COMPTIME_INS(unary, dst, dst, 0));
+            }
+            return ComptimeOk;
+        }
+        case AstNodeKindBinaryOpExpr: {
+            AstNodeBinaryOpExpr* expr = node->data.expr->binary_op_expr;
+            if((result = comptime_compile_node(vm, func, expr->lhs, dst)) != ComptimeOk)
+                return result;
+            if((result = comptime_compile_node(vm, func, expr->rhs, dst + 1)) != ComptimeOk)
+                return result;
+            UInt32 lhs = dst, rhs = dst + 1;
+            ComptimeOp op;
+            switch(expr->op) {
+                case BinaryOpKindAdd: op = ComptimeOpAdd; break;
+                case BinaryOpKindSubtract: op = ComptimeOpSub; break;
+                case BinaryOpKindMult: op = ComptimeOpMul; break;
+                case BinaryOpKindDiv: op = ComptimeOpDiv; break;
+                case BinaryOpKindMod: op = ComptimeOpMod; break;
+                // `&` and `|` are spelled the same for bools and ints (see <adorad/compiler/fold.h>)
+                case BinaryOpKindBoolAnd:
+                case BinaryOpKindBitAnd: op = ComptimeOpBitAnd; break;
+                case BinaryOpKindBoolOr:
+                case BinaryOpKindBitOr: op = ComptimeOpBitOr; break;
+                case BinaryOpKindBitXor: op = ComptimeOpBitXor; break;
+                case BinaryOpKindBitshitLeft: op = ComptimeOpShl; break;
+                case BinaryOpKindBitshitRight: op = ComptimeOpShr; break;
+                case BinaryOpKindCmpEqual: op = ComptimeOpEq; break;
+                case BinaryOpKindCmpNotEqual: op = ComptimeOpNe; break;
+                case BinaryOpKindCmpLessThan: op = ComptimeOpLt; break;
+                case BinaryOpKindCmpLessThanorEqualTo: op = ComptimeOpLe; break;
+                // `a > b` is `b < a`
+                case BinaryOpKindCmpGreaterThan: op = ComptimeOpLt; lhs = dst + 1; rhs = dst; break;
+                case BinaryOpKindCmpGreaterThanorEqualTo: op = ComptimeOpLe; lhs = dst + 1; rhs = dst; break;
+                default: return ComptimeNotConstant;
+            }
+            comptime_emit(vm, func, COMPTIME_INS(op, dst, lhs, rhs));
+            return ComptimeOk;
+        }
+        default:
+            return ComptimeNotConstant;
+    }
+}
+
+ComptimeResult comptime_compile_expr(ComptimeVM* vm, AstNode* expr, UInt32* func) {
+    *func = comptime_func_new(vm, "<expr>", 0);
+    ComptimeResult result = comptime_compile_node(vm, *func, expr, 0);
+    comptime_emit(vm, *func, COMPTIME_INS(ComptimeOpReturn, 0, 0, 0));
+    return result;
+}
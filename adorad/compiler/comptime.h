@@ -0,0 +1,221 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#ifndef ADORAD_COMPTIME_H
+#define ADORAD_COMPTIME_H
+
+#include <adorad/core/types.h>
+#include <adorad/core/vector.h>
+#include <adorad/compiler/ast.h>
+
+/*
+    Comptime VM
+    Comptime code (`comptime { ... }`, `if comptime ...`, `[comptime]` functions) is compiled into a compact register
+    bytecode, and run by an interpreter - rather than evaluated by walking its `AstNode`s, which would be far too slow
+    for the lookup tables comptime code is there to build (a table of 64K entries is a loop of 64K iterations).
+
+    An instruction is 32 bits: an 8-bit opcode (`ComptimeOp`), then three 8-bit operands `a`, `b` and `c` - or `a`
+    and a 16-bit `bx` (an unsigned constant index, or a signed jump offset or immediate). Operands are registers: slots
+    of the function's window on the VM's stack (its parameters are the first ones). The interpreter is
+    direct-threaded (computed gotos) with GCC and Clang, and a `switch` otherwise.
+
+    Values are ints (Int64, wrapping around), floats (Float64), bools and arrays (of values, in the VM's heap: an
+    array value is an index into it). Mixing ints and floats converts the int, and `&`, `|` and `^` of bools are
+    logical, as in constant folding (see <adorad/compiler/fold.h>).
+
+    Calls of pure functions (see `ComptimeFunc.purity`) are memoized: there are no globals, so a function that
+    touches no arrays returns the same value for the same arguments.
+
+    Evaluation is bounded by `ComptimeOptions`:
+        * `max_steps`: the no. of steps of a `comptime_call()`, where a step is a backward jump (a loop iteration) or
+          a call - so a runaway loop (or recursion) is an error rather than a hung build;
+        * `max_memory`: the bytes of arrays allocated by the VM (arrays live as long as it does, since values that
+          are results refer to them).
+
+    Functions are checked (operands in range, no falling off their end) when they're first called, so the
+    interpreter itself doesn't check operands.
+*/
+
+// Registers of a function (its window on the stack)
+#define COMPTIME_MAX_REGS           256
+// Values on the stack (the windows of every active call)
+#define COMPTIME_STACK_SIZE         (64 * 1024)
+// Depth of calls
+#define COMPTIME_MAX_FRAMES         1024
+// Arguments of a memoizable call
+#define COMPTIME_MEMO_MAX_ARGS      4
+// Entries of the memo table (once full, calls are no longer memoized)
+#define COMPTIME_MEMO_MAX_ENTRIES   (1 << 20)
+// Budget, unless asked otherwise
+#define COMPTIME_DEFAULT_MAX_STEPS  (100 * 1000 * 1000)
+#define COMPTIME_DEFAULT_MAX_MEMORY (256 * 1024 * 1024)
+
+// Instruction encoding
+#define COMPTIME_INS(op, a, b, c)   \
+    (cast(UInt32)(op) | cast(UInt32)(a) << 8 | cast(UInt32)(b) << 16 | cast(UInt32)(c) << 24)
+#define COMPTIME_INS_BX(op, a, bx)  (cast(UInt32)(op) | cast(UInt32)(a) << 8 | cast(UInt32)(UInt16)(bx) << 16)
+#define COMPTIME_OP(ins)            ((ins) & 0xff)
+#define COMPTIME_A(ins)             (((ins) >> 8) & 0xff)
+#define COMPTIME_B(ins)             (((ins) >> 16) & 0xff)
+#define COMPTIME_C(ins)             ((ins) >> 24)
+#define COMPTIME_BX(ins)            ((ins) >> 16)
+#define COMPTIME_SBX(ins)           (cast(Int16)(UInt16)((ins) >> 16))
+
+// `R[x]` is register `x`, `K[x]` constant `x` of the function. Jumps are relative to the next instruction
+typedef enum ComptimeOp {
+    ComptimeOpLoadConst,    // R[a] = K[bx]
+    ComptimeOpLoadInt,      // R[a] = sbx
+    ComptimeOpMove,         // R[a] = R[b]
+    ComptimeOpAdd,          // R[a] = R[b] + R[c]
+    ComptimeOpAddInt,       // R[a] = R[b] + c (c a signed 8-bit immediate)
+    ComptimeOpSub,          // R[a] = R[b] - R[c]
+    ComptimeOpMul,          // R[a] = R[b] * R[c]
+    ComptimeOpDiv,          // R[a] = R[b] / R[c]
+    ComptimeOpMod,          // R[a] = R[b] % R[c]
+    ComptimeOpBitAnd,       // R[a] = R[b] & R[c]
+    ComptimeOpBitOr,        // R[a] = R[b] | R[c]
+    ComptimeOpBitXor,       // R[a] = R[b] ^ R[c]
+    ComptimeOpShl,          // R[a] = R[b] << R[c]
+    ComptimeOpShr,          // R[a] = R[b] >> R[c]
+    ComptimeOpEq,           // R[a] = R[b] == R[c]
+    ComptimeOpNe,           // R[a] = R[b] != R[c]
+    ComptimeOpLt,           // R[a] = R[b] < R[c]
+    ComptimeOpLe,           // R[a] = R[b] <= R[c]
+    ComptimeOpNeg,          // R[a] = -R[b]
+    ComptimeOpNot,          // R[a] = not R[b]
+    ComptimeOpJump,         // pc += sbx
+    ComptimeOpJumpIf,       // if R[a]: pc += sbx
+    ComptimeOpJumpIfNot,    // if not R[a]: pc += sbx
+    ComptimeOpCall,         // R[a] = function b (R[c], R[c + 1], ...) - as many arguments as it has parameters
+    ComptimeOpReturn,       // return R[a]
+    ComptimeOpNewArray,     // R[a] = an array of R[b] ints (all 0)
+    ComptimeOpGetIndex,     // R[a] = R[b][R[c]]
+    ComptimeOpSetIndex,     // R[a][R[b]] = R[c]
+    ComptimeOpLen,          // R[a] = no. of elements of R[b]
+    ComptimeOpCount
+} ComptimeOp;
+
+typedef enum ComptimeValueKind {
+    ComptimeValueKindInt,
+    ComptimeValueKindFloat,
+    ComptimeValueKindBool,
+    ComptimeValueKindArray,
+} ComptimeValueKind;
+
+typedef struct ComptimeValue {
+    ComptimeValueKind kind;
+    union {
+        Int64 int_value;
+        Float64 float_value;
+        bool bool_value;
+        UInt32 array;       // index into `ComptimeVM.arrays`
+    };
+} ComptimeValue;
+
+typedef struct ComptimeArray {
+    ComptimeValue* values;
+    UInt64 len;
+} ComptimeArray;
+
+typedef enum ComptimeResult {
+    ComptimeOk,
+    ComptimeTypeError,          // eg. `true + 1`, or indexing an int
+    ComptimeDivisionByZero,
+    ComptimeIndexOutOfRange,
+    ComptimeStepLimit,          // see `ComptimeOptions.max_steps`
+    ComptimeMemoryLimit,        // see `ComptimeOptions.max_memory`
+    ComptimeStackOverflow,      // calls too deep (see `COMPTIME_MAX_FRAMES` and `COMPTIME_STACK_SIZE`)
+    ComptimeNotConstant,        // not something `comptime_compile_expr()` compiles
+} ComptimeResult;
+
+typedef struct ComptimeFunc {
+    const char* name;
+    UInt32* code;
+    UInt32 len;
+    UInt32 cap;
+    ComptimeValue* consts;
+    UInt32 num_consts;
+    UInt32 consts_cap;
+    UInt32 num_params;
+    UInt32 num_regs;        // its parameters included
+    enum {
+        ComptimePurityUnknown,
+        ComptimePurityPending,  // being worked out (so a recursive call is taken to be pure)
+        ComptimePurityPure,     // no array instructions, and calls only pure functions (with at most
+                                // COMPTIME_MEMO_MAX_ARGS parameters): memoized
+        ComptimePurityImpure,
+    } purity;
+} ComptimeFunc;
+
+VEC_DEFINE(ComptimeFunc)
+VEC_DEFINE(ComptimeArray)
+
+typedef struct ComptimeMemoEntry {
+    UInt32 func;            // + 1 (0 if the entry is free)
+    ComptimeValue args[COMPTIME_MEMO_MAX_ARGS];
+    ComptimeValue result;
+} ComptimeMemoEntry;
+
+typedef struct ComptimeOptions {
+    UInt64 max_steps;       // COMPTIME_DEFAULT_MAX_STEPS if 0
+    UInt64 max_memory;      // COMPTIME_DEFAULT_MAX_MEMORY if 0
+} ComptimeOptions;
+
+typedef struct ComptimeVM {
+    ComptimeOptions options;
+    Vec* funcs;                 // `ComptimeFunc`s
+    Vec* arrays;                // `ComptimeArray`s
+    ComptimeValue* stack;
+    ComptimeMemoEntry* memo;
+    UInt32 memo_cap;            // a power of 2
+    UInt32 memo_len;
+    // Of the evaluations so far
+    UInt64 num_steps;
+    UInt64 num_bytes;           // of arrays
+    UInt64 num_memo_hits;
+    // Where the last evaluation failed (if it did)
+    const char* error_func;
+    UInt32 error_pc;
+} ComptimeVM;
+
+// `options` may be null (for the defaults)
+ComptimeVM* comptime_vm_new(ComptimeOptions* options);
+void comptime_vm_free(ComptimeVM* vm);
+const char* comptime_result_str(ComptimeResult result);
+
+// Building functions
+// Add a function of `num_params` parameters (registers 0 .. `num_params - 1`) to `vm`. Returns its index
+UInt32 comptime_func_new(ComptimeVM* vm, const char* name, UInt32 num_params);
+// Returns a new register of function `func`
+UInt32 comptime_new_reg(ComptimeVM* vm, UInt32 func);
+// Returns the index of constant `value` of function `func` (added if it's not one yet)
+UInt32 comptime_const(ComptimeVM* vm, UInt32 func, ComptimeValue value);
+// Append an instruction (see `COMPTIME_INS()`) to function `func`. Returns its index
+UInt32 comptime_emit(ComptimeVM* vm, UInt32 func, UInt32 ins);
+// Point the jump at `at` (of function `func`) to the instruction `target`
+void comptime_patch_jump(ComptimeVM* vm, UInt32 func, UInt32 at, UInt32 target);
+// Compile `expr` (literals, and prefix and binary operators over them) into a new function with no parameters,
+// whose index is set in `func`. Returns `ComptimeNotConstant` if `expr` isn't one of those
+ComptimeResult comptime_compile_expr(ComptimeVM* vm, AstNode* expr, UInt32* func);
+
+// Evaluation
+// Call function `func` with `args` (as many as it has parameters), and set `result` to what it returns
+ComptimeResult comptime_call(ComptimeVM* vm, UInt32 func, const ComptimeValue* args, ComptimeValue* result);
+// Returns the array `value` is (valid until the next evaluation), or null if it isn't one
+ComptimeArray* comptime_array_of(ComptimeVM* vm, ComptimeValue value);
+
+ComptimeValue comptime_int(Int64 value);
+ComptimeValue comptime_float(Float64 value);
+ComptimeValue comptime_bool(bool value);
+
+#endif // ADORAD_COMPTIME_H
@@ -0,0 +1,415 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <adorad/core/debug.h>
+#include <adorad/compiler/diagnostics.h>
+
+Diagnostics* diagnostics_new(UInt32 max_errors) {
+    Diagnostics* diags = cast(Diagnostics*)calloc(1, sizeof(Diagnostics));
+    CORETEN_ENFORCE_NN(diags, "Could not allocate memory. Memory full.");
+
+    diags->cap = 16;
+    diags->items = cast(Diagnostic*)malloc(diags->cap * sizeof(Diagnostic));
+    CORETEN_ENFORCE_NN(diags->items, "Could not allocate memory. Memory full.");
+    diags->max_errors = max_errors > 0 ? max_errors : DIAGNOSTICS_DEFAULT_MAX_ERRORS;
+    diags->strings = arena_new(0);
+    return diags;
+}
+
+void diagnostics_free(Diagnostics* diags) {
+    if(SOME(diags)) {
+        for(UInt32 i = 0; i < diags->num_files; i++) {
+            if(diags->files[i].is_owned)
+                free(cast(char*)diags->files[i].source);
+        }
+        free(diags->files);
+        free(diags->items);
+        arena_free(diags->strings);
+        free(diags);
+    }
+}
+
+// Copy `str` into the sink's arena
+static const char* diagnostics_strdup(Diagnostics* diags, const char* str, UInt64 len) {
+    char* copy = cast(char*)arena_alloc_aligned(diags->strings, len + 1, 1);
+    memcpy(copy, str, len);
+    copy[len] = nullchar;
+    return copy;
+}
+
+// Returns the index of file `fname` (of `len` bytes) in `diags->files`, added if it isn't there yet
+static UInt32 diagnostics_file(Diagnostics* diags, const char* fname, UInt64 len) {
+    // Most reports are about the same file as the one before them
+    for(UInt32 i = diags->num_files; i-- > 0;) {
+        if(strlen(diags->files[i].name) == len && memcmp(diags->files[i].name, fname, len) == 0)
+            return i;
+    }
+    if(diags->num_files == diags->files_cap) {
+        diags->files_cap = diags->files_cap > 0 ? diags->files_cap * 2 : 4;
+        diags->files = cast(DiagnosticFile*)realloc(diags->files, diags->files_cap * sizeof(DiagnosticFile));
+        CORETEN_ENFORCE_NN(diags->files, "Could not allocate memory. Memory full.");
+    }
+    DiagnosticFile* file = &diags->files[diags->num_files];
+    memset(file, 0, sizeof(*file));
+    file->name = diagnostics_strdup(diags, fname, len);
+    return diags->num_files++;
+}
+
+void diagnostics_set_source(Diagnostics* diags, const char* fname, const char* source, UInt32 len) {
+    UInt32 index = diagnostics_file(diags, fname, strlen(fname));
+    DiagnosticFile* file = &diags->files[index];
+    if(file->is_owned)
+        free(cast(char*)file->source);
+    file->source = source;
+    file->len = len;
+    file->is_loaded = true;
+    file->is_owned = false;
+}
+
+bool diagnostics_is_full(Diagnostics* diags) {
+    return diags->num_errors >= diags->max_errors;
+}
+
+bool diagnostics_vreport(Diagnostics* diags, DiagnosticLevel level, Error err, Location loc, UInt32 begin, UInt32 end,
+                         const char* format, va_list args) {
+    if(level == DiagnosticLevelError) {
+        if(diagnostics_is_full(diags)) {
+            ++diags->num_dropped;
+            return false;
+        }
+        ++diags->num_errors;
+    }
+
+    if(diags->len == diags->cap) {
+        diags->cap *= 2;
+        diags->items = cast(Diagnostic*)realloc(diags->items, diags->cap * sizeof(Diagnostic));
+        CORETEN_ENFORCE_NN(diags->items, "Could not allocate memory. Memory full.");
+    }
+
+    va_list copy;
+    va_copy(copy, args);
+    int len = vsnprintf(null, 0, format, copy);
+    va_end(copy);
+    char* message = cast(char*)arena_alloc_aligned(diags->strings, cast(UInt64)(len > 0 ? len : 0) + 1, 1);
+    vsnprintf(message, cast(UInt64)(len > 0 ? len : 0) + 1, format, args);
+
+    Diagnostic* diag = &diags->items[diags->len++];
+    diag->level = level;
+    diag->err = err;
+    diag->file = SOME(loc.fname) ? diagnostics_file(diags, loc.fname->data, loc.fname->len) :
+                                   diagnostics_file(diags, "", 0);
+    diag->fname = diags->files[diag->file].name;
+    diag->begin = begin;
+    diag->end = end > begin ? end : begin;
+    diag->line = loc.line;
+    diag->col = loc.col;
+    diag->message = message;
+    return true;
+}
+
+bool diagnostics_report(Diagnostics* diags, DiagnosticLevel level, Error err, Location loc, UInt32 begin, UInt32 end,
+                        const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    bool is_kept = diagnostics_vreport(diags, level, err, loc, begin, end, format, args);
+    va_end(args);
+    return is_kept;
+}
+
+void diagnostics_merge(Diagnostics* into, Diagnostics* from) {
+    for(UInt32 i = 0; i < from->len; i++) {
+        Diagnostic* diag = &from->items[i];
+        if(diag->level == DiagnosticLevelError) {
+            if(diagnostics_is_full(into)) {
+                ++into->num_dropped;
+                continue;
+            }
+            ++into->num_errors;
+        }
+
+        if(into->len == into->cap) {
+            into->cap *= 2;
+            into->items = cast(Diagnostic*)realloc(into->items, into->cap * sizeof(Diagnostic));
+            CORETEN_ENFORCE_NN(into->items, "Could not allocate memory. Memory full.");
+        }
+        Diagnostic* copy = &into->items[into->len++];
+        *copy = *diag;
+        copy->file = diagnostics_file(into, diag->fname, strlen(diag->fname));
+        copy->fname = into->files[copy->file].name;
+        // A source `from` was given (rather than one it read, which goes away with it)
+        DiagnosticFile* file = &from->files[diag->file];
+        if(file->is_loaded && !file->is_owned && !into->files[copy->file].is_loaded)
+            diagnostics_set_source(into, diag->fname, file->source, file->len);
+        copy->message = diagnostics_strdup(into, diag->message, strlen(diag->message));
+    }
+    into->num_dropped += from->num_dropped;
+}
+
+typedef struct DiagnosticsSortKey {
+    Diagnostic* diag;
+    UInt32 index;       // reported
+} DiagnosticsSortKey;
+
+static int diagnostics_compare(const void* a, const void* b) {
+    const DiagnosticsSortKey* x = cast(const DiagnosticsSortKey*)a;
+    const DiagnosticsSortKey* y = cast(const DiagnosticsSortKey*)b;
+    int order = x->diag->file == y->diag->file ? 0 : strcmp(x->diag->fname, y->diag->fname);
+    if(order != 0)
+        return order;
+    // Then by position
+    if(x->diag->begin != y->diag->begin)
+        return x->diag->begin < y->diag->begin ? -1 : 1;
+    if(x->diag->end != y->diag->end)
+        return x->diag->end < y->diag->end ? -1 : 1;
+    return x->index < y->index ? -1 : x->index > y->index;
+}
+
+static bool diagnostics_is_same(Diagnostic* a, Diagnostic* b) {
+    return a->file == b->file && a->begin == b->begin && a->end == b->end && a->level == b->level &&
+           a->err == b->err && strcmp(a->message, b->message) == 0;
+}
+
+void diagnostics_sort(Diagnostics* diags) {
+    if(diags->len == 0)
+        return;
+    DiagnosticsSortKey* keys = cast(DiagnosticsSortKey*)malloc(diags->len * sizeof(DiagnosticsSortKey));
+    Diagnostic* items = cast(Diagnostic*)malloc(diags->cap * sizeof(Diagnostic));
+    CORETEN_ENFORCE(SOME(keys) && SOME(items), "Could not allocate memory. Memory full.");
+    for(UInt32 i = 0; i < diags->len; i++)
+        keys[i] = (DiagnosticsSortKey){ &diags->items[i], i };
+    qsort(keys, diags->len, sizeof(DiagnosticsSortKey), diagnostics_compare);
+
+    UInt32 len = 0;
+    for(UInt32 i = 0; i < diags->len; i++) {
+        // A duplicate is among the diagnostics kept of the same range, which are the last ones kept
+        Diagnostic* diag = keys[i].diag;
+        bool is_duplicate = false;
+        for(UInt32 j = len; j > 0 && !is_duplicate; j--) {
+            Diagnostic* kept = &items[j - 1];
+            if(kept->file != diag->file || kept->begin != diag->begin || kept->end != diag->end)
+                break;
+            is_duplicate = diagnostics_is_same(kept, diag);
+        }
+        if(is_duplicate)
+            diags->num_errors -= diag->level == DiagnosticLevelError;
+        else
+            items[len++] = *diag;
+    }
+    free(diags->items);
+    free(keys);
+    diags->items = items;
+    diags->len = len;
+}
+
+// Rendering
+// What's rendered, before it's written to the stream
+typedef struct DiagnosticsOut {
+    char* data;
+    UInt64 len;
+    UInt64 cap;
+    FILE* stream;
+} DiagnosticsOut;
+
+static void diagnostics_flush(DiagnosticsOut* out) {
+    fwrite(out->data, 1, out->len, out->stream);
+    out->len = 0;
+}
+
+static void diagnostics_write(DiagnosticsOut* out, const char* data, UInt64 len) {
+    if(out->len + len > out->cap) {
+        while(out->len + len > out->cap)
+            out->cap *= 2;
+        out->data = cast(char*)realloc(out->data, out->cap);
+        CORETEN_ENFORCE_NN(out->data, "Could not allocate memory. Memory full.");
+    }
+    memcpy(out->data + out->len, data, len);
+    out->len += len;
+}
+
+static void diagnostics_str(DiagnosticsOut* out, const char* str) {
+    diagnostics_write(out, str, strlen(str));
+}
+
+ATTRIBUTE_PRINTF(2, 3)
+static void diagnostics_printf(DiagnosticsOut* out, const char* format, ...) {
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if(len < 0)
+        return;
+    if(cast(UInt64)len < sizeof(buffer)) {
+        diagnostics_write(out, buffer, cast(UInt64)len);
+        return;
+    }
+    char* long_buffer = cast(char*)malloc(cast(UInt64)len + 1);
+    CORETEN_ENFORCE_NN(long_buffer, "Could not allocate memory. Memory full.");
+    va_start(args, format);
+    vsnprintf(long_buffer, cast(UInt64)len + 1, format, args);
+    va_end(args);
+    diagnostics_write(out, long_buffer, cast(UInt64)len);
+    free(long_buffer);
+}
+
+// Returns the source of `file`, read back from it if it wasn't given (null if it can't be)
+static const char* diagnostics_source(DiagnosticFile* file) {
+    if(file->is_loaded)
+        return file->source;
+    file->is_loaded = true;
+    FILE* stream = file->name[0] != nullchar ? fopen(file->name, "rb") : null;
+    if(NONE(stream))
+        return null;
+    char* source = null;
+    long len = fseek(stream, 0, SEEK_END) == 0 ? ftell(stream) : -1;
+    if(len >= 0 && len < cast(long)UInt32_MAX && fseek(stream, 0, SEEK_SET) == 0) {
+        source = cast(char*)malloc(cast(UInt64)len + 1);
+        CORETEN_ENFORCE_NN(source, "Could not allocate memory. Memory full.");
+        if(fread(source, 1, cast(UInt64)len, stream) != cast(UInt64)len) {
+            free(source);
+            source = null;
+        }
+    }
+    fclose(stream);
+    file->source = source;
+    file->len = SOME(source) ? cast(UInt32)len : 0;
+    file->is_owned = SOME(source);
+    return source;
+}
+
+// Write the source line `diag` begins in, and a marker under its range:
+//      3 | put int a = $x
+//        |             ^~
+static void diagnostics_render_snippet(DiagnosticsOut* out, Diagnostics* diags, Diagnostic* diag, bool use_color) {
+    DiagnosticFile* file = &diags->files[diag->file];
+    const char* source = diagnostics_source(file);
+    // The file may have changed since
+    if(NONE(source) || diag->begin > file->len)
+        return;
+    UInt32 line_begin = diag->begin;
+    while(line_begin > 0 && source[line_begin - 1] != '\n')
+        line_begin--;
+    UInt32 line_end = diag->begin;
+    while(line_end < file->len && source[line_end] != '\n' && source[line_end] != '\r')
+        line_end++;
+    if(line_end - line_begin > DIAGNOSTICS_MAX_SNIPPET)
+        return;
+
+    diagnostics_printf(out, "%5u | ", diag->line);
+    diagnostics_write(out, source + line_begin, line_end - line_begin);
+    diagnostics_str(out, "\n      | ");
+    // Spaces up to the range (tabs kept, so that it lines up), then a `^` and a `~` per character of it (on its line)
+    for(UInt32 i = line_begin; i < diag->begin; i++) {
+        if((source[i] & 0xC0) != 0x80)
+            diagnostics_write(out, source[i] == '\t' ? "\t" : " ", 1);
+    }
+    if(use_color)
+        diagnostics_str(out, "\033[1;32m");
+    diagnostics_str(out, "^");
+    UInt32 end = diag->end < line_end ? diag->end : line_end;
+    for(UInt32 i = diag->begin + 1; i < end; i++) {
+        if((source[i] & 0xC0) != 0x80)
+            diagnostics_str(out, "~");
+    }
+    if(use_color)
+        diagnostics_str(out, "\033[0m");
+    diagnostics_str(out, "\n");
+}
+
+// Write `str` as a JSON string
+static void diagnostics_json_str(DiagnosticsOut* out, const char* str) {
+    diagnostics_str(out, "\"");
+    const char* run = str;
+    for(; *str != nullchar; str++) {
+        unsigned char ch = cast(unsigned char)*str;
+        if(ch >= 0x20 && ch != '"' && ch != '\\')
+            continue;
+        diagnostics_write(out, run, cast(UInt64)(str - run));
+        run = str + 1;
+        if(ch == '"' || ch == '\\')
+            diagnostics_printf(out, "\\%c", ch);
+        else if(ch == '\n')
+            diagnostics_str(out, "\\n");
+        else if(ch == '\t')
+            diagnostics_str(out, "\\t");
+        else
+            diagnostics_printf(out, "\\u%04x", ch);
+    }
+    diagnostics_write(out, run, cast(UInt64)(str - run));
+    diagnostics_str(out, "\"");
+}
+
+static void diagnostics_render_json(DiagnosticsOut* out, Diagnostics* diags) {
+    static const char* levels[] = { "error", "warning", "note" };
+    diagnostics_str(out, "{\"diagnostics\": [");
+    for(UInt32 i = 0; i < diags->len; i++) {
+        Diagnostic* diag = &diags->items[i];
+        diagnostics_printf(out, "%s\n  {\"level\": \"%s\", \"code\": ", i > 0 ? "," : "", levels[diag->level]);
+        if(diag->err != ErrorNone)
+            diagnostics_json_str(out, error_str(diag->err));
+        else
+            diagnostics_str(out, "null");
+        diagnostics_str(out, ", \"file\": ");
+        diagnostics_json_str(out, diag->fname);
+        diagnostics_printf(out, ", \"line\": %u, \"col\": %u, \"begin\": %u, \"end\": %u, \"message\": ", diag->line,
+                           diag->col, diag->begin, diag->end);
+        diagnostics_json_str(out, diag->message);
+        diagnostics_str(out, "}");
+        if(out->len >= DIAGNOSTICS_FLUSH_SIZE)
+            diagnostics_flush(out);
+    }
+    diagnostics_printf(out, "%s], \"num_dropped\": %u}\n", diags->len > 0 ? "\n" : "", diags->num_dropped);
+}
+
+void diagnostics_render(Diagnostics* diags, DiagnosticsFormat format, FILE* stream) {
+    diagnostics_sort(diags);
+    DiagnosticsOut out = { null, 0, 4096, stream };
+    out.data = cast(char*)malloc(out.cap);
+    CORETEN_ENFORCE_NN(out.data, "Could not allocate memory. Memory full.");
+    if(format == DiagnosticsFormatJson) {
+        diagnostics_render_json(&out, diags);
+        diagnostics_flush(&out);
+        free(out.data);
+        return;
+    }
+
+    bool use_color = format == DiagnosticsFormatText;
+    for(UInt32 i = 0; i < diags->len; i++) {
+        Diagnostic* diag = &diags->items[i];
+        const char* color = diag->level == DiagnosticLevelError ? "\033[1;31m" : 
+                            diag->level == DiagnosticLevelWarning ? "\033[1;33m" : "\033[1;36m";
+        // Warnings (and notes) don't have to be about an `Error`
+        const char* kind = diag->err != ErrorNone ? error_str(diag->err) : 
+                           diag->level == DiagnosticLevelWarning ? "Warning" : "Note";
+        if(use_color)
+            diagnostics_str(&out, color);
+        diagnostics_printf(&out, "%s: ", kind);
+        diagnostics_str(&out, diag->message);
+        diagnostics_printf(&out, " at %s:%u:%u", diag->fname, diag->line, diag->col);
+        diagnostics_str(&out, use_color ? "\033[0m\n" : "\n");
+        diagnostics_render_snippet(&out, diags, diag, use_color);
+        if(out.len >= DIAGNOSTICS_FLUSH_SIZE)
+            diagnostics_flush(&out);
+    }
+    if(diags->num_dropped > 0)
+        diagnostics_printf(&out, "... and %u more error%s\n", diags->num_dropped, diags->num_dropped == 1 ? "" : "s");
+    diagnostics_flush(&out);
+    free(out.data);
+}
+
+void diagnostics_print(Diagnostics* diags, FILE* stream) {
+    diagnostics_render(diags, DiagnosticsFormatText, stream);
+}
@@ -0,0 +1,120 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+#ifndef ADORAD_DIAGNOSTICS_H
+#define ADORAD_DIAGNOSTICS_H
+
+#include <stdarg.h>
+#include <stdio.h>
+
+#include <adorad/core/types.h>
+#include <adorad/core/misc.h>
+#include <adorad/core/memory.h>
+#include <adorad/compiler/error.h>
+#include <adorad/compiler/location.h>
+
+/*
+    Diagnostics sink
+    Instead of reporting the first error and exiting (see `dread()`), the Lexer and the Parser can report their errors
+    into a `Diagnostics` (see `lexer_set_diagnostics()`) and recover, so that a single pass over a file reports every
+    error in it.
+
+    Only the first `max_errors` errors are kept - the rest are counted (in `num_dropped`), and the Parser stops once
+    the sink is full. Diagnostics don't refer to the Lexer they came from (messages and file names are copied), so
+    they outlive it.
+
+    Reporting is cheap: a diagnostic is a small record (its `Error`, the file it's about - an index into the sink's
+    table of files, so a file name is stored once however many errors it has - its source range, and its message).
+    Everything else is done when the diagnostics are printed: they're sorted (by file, then position) and
+    deduplicated, then rendered (with the source line each one points into, and colors) into a buffer written to the
+    stream in large chunks - so an error storm prints about as fast as it's reported, and the output of parallel
+    builds never interleaves. The source of a file is read back when it's first needed (unless it was given with
+    `diagnostics_set_source()`).
+*/
+
+// Number of errors kept by a Diagnostics, unless asked otherwise
+#define DIAGNOSTICS_DEFAULT_MAX_ERRORS  64
+// Source lines longer than this (in bytes) aren't printed under their diagnostics
+#define DIAGNOSTICS_MAX_SNIPPET         256
+// Rendered output is written once this much of it is buffered (and at the end)
+#define DIAGNOSTICS_FLUSH_SIZE          (1024 * 1024)
+
+typedef enum DiagnosticLevel {
+    DiagnosticLevelError,
+    DiagnosticLevelWarning,
+    DiagnosticLevelNote,
+} DiagnosticLevel;
+
+typedef enum DiagnosticsFormat {
+    DiagnosticsFormatText,      // with colors
+    DiagnosticsFormatPlain,     // the same, without colors
+    DiagnosticsFormatJson,      // for tools: an object of the diagnostics (one per line) and the no. of dropped errors
+} DiagnosticsFormat;
+
+typedef struct DiagnosticFile {
+    const char* name;   // "" if unknown
+    const char* source; // null until needed (or set with `diagnostics_set_source()`)
+    UInt32 len;
+    bool is_loaded;     // has reading `source` been tried yet
+    bool is_owned;      // was `source` read by the sink (and freed with it)
+} DiagnosticFile;
+
+typedef struct Diagnostic {
+    DiagnosticLevel level;
+    Error err;
+    UInt32 file;        // index into `Diagnostics.files`
+    const char* fname;  // its name ("" if unknown)
+    UInt32 begin;       // source range `[begin, end)` (in bytes) the diagnostic refers to
+    UInt32 end;
+    UInt32 line;        // line and column of `begin`
+    UInt32 col;
+    const char* message;
+} Diagnostic;
+
+typedef struct Diagnostics {
+    Diagnostic* items;  // in the order they were reported
+    UInt32 len;
+    UInt32 cap;
+    UInt32 num_errors;  // number of errors kept (`DiagnosticLevelError`s in `items`)
+    UInt32 max_errors;
+    UInt32 num_dropped; // errors reported once the sink was full
+    DiagnosticFile* files;
+    UInt32 num_files;
+    UInt32 files_cap;
+    Arena* strings;     // storage for the messages and file names
+} Diagnostics;
+
+// Create a sink that keeps (at most) `max_errors` errors. If `max_errors` is 0, DIAGNOSTICS_DEFAULT_MAX_ERRORS is used
+Diagnostics* diagnostics_new(UInt32 max_errors);
+void diagnostics_free(Diagnostics* diags);
+// Report a diagnostic about `[begin, end)` (found at `loc`). Returns false if it was dropped (the sink is full)
+ATTRIBUTE_PRINTF(7, 8)
+bool diagnostics_report(Diagnostics* diags, DiagnosticLevel level, Error err, Location loc, UInt32 begin, UInt32 end,
+                        const char* format, ...);
+bool diagnostics_vreport(Diagnostics* diags, DiagnosticLevel level, Error err, Location loc, UInt32 begin, UInt32 end,
+                         const char* format, va_list args);
+// Has the sink reached `max_errors`?
+bool diagnostics_is_full(Diagnostics* diags);
+// Append (copies of) the diagnostics of `from` to `into`, in order. Like `diagnostics_report()`, errors past 
+// `into->max_errors` are dropped. Errors dropped by `from` are counted as dropped by `into`
+void diagnostics_merge(Diagnostics* into, Diagnostics* from);
+// Use `source` (of `len` bytes, which must outlive the sink) as the contents of file `fname`, rather than reading it
+// back when printing
+void diagnostics_set_source(Diagnostics* diags, const char* fname, const char* source, UInt32 len);
+// Sort the diagnostics by file (name), then source range (then the order they were reported in), and drop the ones
+// that repeat one before them
+void diagnostics_sort(Diagnostics* diags);
+// Sort the diagnostics, then print every one (followed by the number of dropped errors, if any) to `stream`
+void diagnostics_print(Diagnostics* diags, FILE* stream);
+void diagnostics_render(Diagnostics* diags, DiagnosticsFormat format, FILE* stream);
+
+#endif // ADORAD_DIAGNOSTICS_H
@@ -17,11 +17,16 @@ char* error_str(Error err) {
     switch(err) {
         case ErrorNone : return "<no error>";
         case ErrorFileNotFound : return "FileNotFound";
+        case ErrorFileNotReadable : return "FileNotReadable";
         case ErrorInvalidCharacter : return "InvalidCharacter";
         case ErrorSyntaxError : return "SyntaxError";
         case ErrorParseError : return "ParseError";
         case ErrorUnexpectedToken: return "UnexpectedTokenError";
         case ErrorExtraToken: return "ExtraTokenError"; 
+        case ErrorLiteralOutOfRange: return "LiteralOutOfRangeError";
+        case ErrorModuleNotFound: return "ModuleNotFoundError";
+        case ErrorModuleMismatch: return "ModuleMismatchError";
+        case ErrorUnsupported: return "UnsupportedError";
         case ErrorUnicodePointTooLarge: return "UnicodePointTooLargeError";
         case ErrorUnreachable: return "Unreachable";
         case ErrorAssertionFailed: return "AssertionFailed";
@@ -42,4 +47,18 @@ void dread(Error err, const char* format, ...) {
     cstl_colored_printf(CORETEN_COLOR_ERROR, "%s: ", error_str(err));
     printf("%s\n", buffer);
     choke_and_die();
-}
\ No newline at end of file
+}
+
+void dread_at(Error err, Location loc, const char* format, ...) {
+    va_list args;
+    char buffer[256];
+
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    buffer[sizeof(buffer)-1] = '\0';
+
+    cstl_colored_printf(CORETEN_COLOR_ERROR, "%s: ", error_str(err));
+    printf("%s at %s:%u:%u\n", buffer, SOME(loc.fname) ? loc.fname->data : "", loc.line, loc.col);
+    choke_and_die();
+}
@@ -15,10 +15,12 @@ Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
 #define ADORAD_ERROR_H
 
 #include <adorad/core/debug.h>
+#include <adorad/compiler/location.h>
 
 typedef enum Error {
     ErrorNone,
     ErrorFileNotFound,
+    ErrorFileNotReadable,   // the file exists, but couldn't be read (eg. no permission, or a directory)
     ErrorInvalidCharacter,
     
     // Compiler-specific Errors
@@ -26,6 +28,10 @@ typedef enum Error {
     ErrorParseError,
     ErrorUnexpectedToken,
     ErrorExtraToken,
+    ErrorLiteralOutOfRange,
+    ErrorModuleNotFound,
+    ErrorModuleMismatch,
+    ErrorUnsupported,       // valid syntax that the compiler doesn't handle yet
 
     // Misc
     ErrorUnicodePointTooLarge,
@@ -41,6 +47,12 @@ ATTRIBUTE_NORETURN
 ATTRIBUTE_PRINTF(2, 3)
 void dread(Error err, const char* format, ...);
 
+// Same as `dread()`, but also reports where the error occured. `loc` is typically resolved with `lexer_loc()`
+ATTRIBUTE_COLD
+ATTRIBUTE_NORETURN
+ATTRIBUTE_PRINTF(3, 4)
+void dread_at(Error err, Location loc, const char* format, ...);
+
 #define unreachable()                                                                                  \
     dread(                                                                                             \
         ErrorUnreachable,                                                                              \
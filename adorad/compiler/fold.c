@@ -0,0 +1,334 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#include <float.h>
+#include <math.h>
+
+#include <adorad/compiler/fold.h>
+
+// Magnitude of Int64 min
+#define FOLD_INT64_MIN_MAGNITUDE    ((UInt64)Int64_MAX + 1)
+
+static inline FoldValue fold_int(bool is_negative, UInt64 magnitude) {
+    FoldValue value = {0};
+    value.kind = FoldValueKindInt;
+    value.is_negative = is_negative && magnitude != 0;
+    value.magnitude = magnitude;
+    return value;
+}
+
+static inline FoldValue fold_float(double float_value) {
+    FoldValue value = {0};
+    value.kind = FoldValueKindFloat;
+    value.float_value = float_value;
+    return value;
+}
+
+static inline FoldValue fold_bool(bool bool_value) {
+    FoldValue value = {0};
+    value.kind = FoldValueKindBool;
+    value.bool_value = bool_value;
+    return value;
+}
+
+static inline double fold_as_float(const FoldValue* value) {
+    if(value->kind == FoldValueKindFloat)
+        return value->float_value;
+    return value->is_negative ? -cast(double)value->magnitude : cast(double)value->magnitude;
+}
+
+// Two's complement bits of the int `value`
+static inline UInt64 fold_bits(const FoldValue* value) {
+    return value->is_negative ? ~value->magnitude + 1 : value->magnitude;
+}
+
+static inline FoldResult fold_check_int(FoldValue* result) {
+    if(result->is_negative && result->magnitude > FOLD_INT64_MIN_MAGNITUDE)
+        return FoldOutOfRange;
+    return FoldOk;
+}
+
+static inline FoldResult fold_check_float(FoldValue* result) {
+    if(isinf(result->float_value))
+        return FoldOutOfRange;
+    if(isnan(result->float_value))
+        return FoldNotConstant;
+    return FoldOk;
+}
+
+// -1, 0 or 1 as `lhs` is less than, equal to or greater than `rhs` (ints)
+static int fold_compare_int(const FoldValue* lhs, const FoldValue* rhs) {
+    if(lhs->is_negative != rhs->is_negative)
+        return lhs->is_negative ? -1 : 1;
+    if(lhs->magnitude == rhs->magnitude)
+        return 0;
+    bool is_less = lhs->magnitude < rhs->magnitude;
+    // Among negatives, the larger magnitude is the smaller value
+    if(lhs->is_negative)
+        is_less = !is_less;
+    return is_less ? -1 : 1;
+}
+
+static FoldResult fold_add(const FoldValue* lhs, const FoldValue* rhs, FoldValue* result) {
+    if(lhs->is_negative == rhs->is_negative) {
+        UInt64 sum = lhs->magnitude + rhs->magnitude;
+        if(sum < lhs->magnitude)
+            return FoldOutOfRange;
+        *result = fold_int(lhs->is_negative, sum);
+    } else if(lhs->magnitude >= rhs->magnitude) {
+        *result = fold_int(lhs->is_negative, lhs->magnitude - rhs->magnitude);
+    } else {
+        *result = fold_int(rhs->is_negative, rhs->magnitude - lhs->magnitude);
+    }
+    return fold_check_int(result);
+}
+
+static FoldResult fold_shift_left(const FoldValue* lhs, UInt64 shift, FoldValue* result) {
+    if(lhs->magnitude == 0) {
+        *result = *lhs;
+        return FoldOk;
+    }
+    if(shift >= 64 || (shift > 0 && (lhs->magnitude >> (64 - shift)) != 0))
+        return FoldOutOfRange;
+    *result = fold_int(lhs->is_negative, lhs->magnitude << shift);
+    return fold_check_int(result);
+}
+
+// Arithmetic shift (rounds towards negative infinity)
+static FoldValue fold_shift_right(const FoldValue* lhs, UInt64 shift) {
+    if(!lhs->is_negative)
+        return fold_int(false, shift >= 64 ? 0 : lhs->magnitude >> shift);
+    if(shift >= 64)
+        return fold_int(true, 1);
+    return fold_int(true, ((lhs->magnitude - 1) >> shift) + 1);
+}
+
+static FoldResult fold_bitwise(BinaryOpKind op, const FoldValue* lhs, const FoldValue* rhs, FoldValue* result) {
+    UInt64 a = fold_bits(lhs);
+    UInt64 b = fold_bits(rhs);
+    UInt64 bits = 0;
+    switch(op) {
+        case BinaryOpKindBitAnd: bits = a & b; break;
+        case BinaryOpKindBitOr:  bits = a | b; break;
+        case BinaryOpKindBitXor: bits = a ^ b; break;
+        default: return FoldNotConstant;
+    }
+    if(!lhs->is_negative && !rhs->is_negative) {
+        *result = fold_int(false, bits);
+        return FoldOk;
+    }
+    // With a negative operand, the bits are those of an Int64 (which a UInt64-only operand has no bits of)
+    if(lhs->magnitude > Int64_MAX && !lhs->is_negative)
+        return FoldNotConstant;
+    if(rhs->magnitude > Int64_MAX && !rhs->is_negative)
+        return FoldNotConstant;
+    bool is_negative = (bits >> 63) != 0;
+    *result = fold_int(is_negative, is_negative ? ~bits + 1 : bits);
+    return FoldOk;
+}
+
+static FoldResult fold_int_op(BinaryOpKind op, const FoldValue* lhs, const FoldValue* rhs, FoldValue* result) {
+    FoldValue negated;
+    switch(op) {
+        case BinaryOpKindAdd: 
+            return fold_add(lhs, rhs, result);
+        case BinaryOpKindSubtract:
+            negated = fold_int(!rhs->is_negative, rhs->magnitude);
+            return fold_add(lhs, &negated, result);
+        case BinaryOpKindMult:
+            if(lhs->magnitude != 0 && rhs->magnitude > UInt64_MAX / lhs->magnitude)
+                return FoldOutOfRange;
+            *result = fold_int(lhs->is_negative != rhs->is_negative, lhs->magnitude * rhs->magnitude);
+            return fold_check_int(result);
+        // Both truncate (towards zero), and the remainder has the sign of `lhs`
+        case BinaryOpKindDiv:
+            if(rhs->magnitude == 0)
+                return FoldDivisionByZero;
+            *result = fold_int(lhs->is_negative != rhs->is_negative, lhs->magnitude / rhs->magnitude);
+            return fold_check_int(result);
+        case BinaryOpKindMod:
+            if(rhs->magnitude == 0)
+                return FoldDivisionByZero;
+            *result = fold_int(lhs->is_negative, lhs->magnitude % rhs->magnitude);
+            return FoldOk;
+        case BinaryOpKindBitshitLeft:
+            if(rhs->is_negative)
+                return FoldNotConstant;
+            return fold_shift_left(lhs, rhs->magnitude, result);
+        case BinaryOpKindBitshitRight:
+            if(rhs->is_negative)
+                return FoldNotConstant;
+            *result = fold_shift_right(lhs, rhs->magnitude);
+            return FoldOk;
+        // `&` and `|` are spelled the same for bools and ints
+        case BinaryOpKindBoolAnd: 
+            return fold_bitwise(BinaryOpKindBitAnd, lhs, rhs, result);
+        case BinaryOpKindBoolOr:
+            return fold_bitwise(BinaryOpKindBitOr, lhs, rhs, result);
+        case BinaryOpKindBitAnd:
+        case BinaryOpKindBitOr:
+        case BinaryOpKindBitXor:
+            return fold_bitwise(op, lhs, rhs, result);
+        case BinaryOpKindCmpEqual:                *result = fold_bool(fold_compare_int(lhs, rhs) == 0); return FoldOk;
+        case BinaryOpKindCmpNotEqual:             *result = fold_bool(fold_compare_int(lhs, rhs) != 0); return FoldOk;
+        case BinaryOpKindCmpLessThan:             *result = fold_bool(fold_compare_int(lhs, rhs) < 0); return FoldOk;
+        case BinaryOpKindCmpGreaterThan:          *result = fold_bool(fold_compare_int(lhs, rhs) > 0); return FoldOk;
+        case BinaryOpKindCmpLessThanorEqualTo:    *result = fold_bool(fold_compare_int(lhs, rhs) <= 0); return FoldOk;
+        case BinaryOpKindCmpGreaterThanorEqualTo: *result = fold_bool(fold_compare_int(lhs, rhs) >= 0); return FoldOk;
+        default: return FoldNotConstant;
+    }
+}
+
+static FoldResult fold_float_op(BinaryOpKind op, double lhs, double rhs, FoldValue* result) {
+    switch(op) {
+        case BinaryOpKindAdd:      *result = fold_float(lhs + rhs); break;
+        case BinaryOpKindSubtract: *result = fold_float(lhs - rhs); break;
+        case BinaryOpKindMult:     *result = fold_float(lhs * rhs); break;
+        case BinaryOpKindDiv:
+            if(rhs == 0.0)
+                return FoldDivisionByZero;
+            *result = fold_float(lhs / rhs);
+            break;
+        case BinaryOpKindCmpEqual:                *result = fold_bool(lhs == rhs); return FoldOk;
+        case BinaryOpKindCmpNotEqual:             *result = fold_bool(lhs != rhs); return FoldOk;
+        case BinaryOpKindCmpLessThan:             *result = fold_bool(lhs < rhs); return FoldOk;
+        case BinaryOpKindCmpGreaterThan:          *result = fold_bool(lhs > rhs); return FoldOk;
+        case BinaryOpKindCmpLessThanorEqualTo:    *result = fold_bool(lhs <= rhs); return FoldOk;
+        case BinaryOpKindCmpGreaterThanorEqualTo: *result = fold_bool(lhs >= rhs); return FoldOk;
+        default: return FoldNotConstant;
+    }
+    return fold_check_float(result);
+}
+
+static FoldResult fold_bool_op(BinaryOpKind op, bool lhs, bool rhs, FoldValue* result) {
+    switch(op) {
+        case BinaryOpKindBoolAnd:      *result = fold_bool(lhs && rhs); return FoldOk;
+        case BinaryOpKindBoolOr:       *result = fold_bool(lhs || rhs); return FoldOk;
+        case BinaryOpKindCmpEqual:     *result = fold_bool(lhs == rhs); return FoldOk;
+        case BinaryOpKindCmpNotEqual:  *result = fold_bool(lhs != rhs); return FoldOk;
+        default: return FoldNotConstant;
+    }
+}
+
+FoldResult fold_binary_op(BinaryOpKind op, const FoldValue* lhs, const FoldValue* rhs, FoldValue* result) {
+    if(lhs->kind == FoldValueKindBool || rhs->kind == FoldValueKindBool) {
+        if(lhs->kind != rhs->kind)
+            return FoldNotConstant;
+        return fold_bool_op(op, lhs->bool_value, rhs->bool_value, result);
+    }
+    if(lhs->kind == FoldValueKindInt && rhs->kind == FoldValueKindInt)
+        return fold_int_op(op, lhs, rhs, result);
+    if(lhs->kind == FoldValueKindNone || rhs->kind == FoldValueKindNone)
+        return FoldNotConstant;
+    return fold_float_op(op, fold_as_float(lhs), fold_as_float(rhs), result);
+}
+
+FoldResult fold_prefix_op(PrefixOpKind op, const FoldValue* operand, FoldValue* result) {
+    switch(operand->kind) {
+        case FoldValueKindBool:
+            if(op != PrefixOpKindBoolNot && op != PrefixOpKindNegation)
+                return FoldNotConstant;
+            *result = fold_bool(!operand->bool_value);
+            return FoldOk;
+        case FoldValueKindInt:
+            if(op == PrefixOpKindMinus) {
+                *result = fold_int(!operand->is_negative, operand->magnitude);
+                return fold_check_int(result);
+            }
+            // Bitwise complement: `!x == -x - 1`
+            if(op == PrefixOpKindNegation) {
+                FoldValue minus_one = fold_int(true, 1);
+                FoldValue negated = fold_int(!operand->is_negative, operand->magnitude);
+                return fold_add(&negated, &minus_one, result);
+            }
+            return FoldNotConstant;
+        case FoldValueKindFloat:
+            if(op != PrefixOpKindMinus)
+                return FoldNotConstant;
+            *result = fold_float(-operand->float_value);
+            return FoldOk;
+        default: 
+            return FoldNotConstant;
+    }
+}
+
+AdoradTypes fold_value_type(const FoldValue* value) {
+    switch(value->kind) {
+        case FoldValueKindInt:
+            if(value->is_negative)
+                return value->magnitude <= cast(UInt64)Int32_MAX + 1 ? AdoradTypeInt : AdoradTypeInt64;
+            if(value->magnitude <= Int32_MAX)
+                return AdoradTypeInt;
+            return value->magnitude <= Int64_MAX ? AdoradTypeInt64 : AdoradTypeUInt64;
+        case FoldValueKindFloat:
+            return fabs(value->float_value) <= FLT_MAX ? AdoradTypeFloat32 : AdoradTypeFloat64;
+        case FoldValueKindBool:
+            return AdoradTypeBool;
+        default:
+            return AdoradTypeAny;
+    }
+}
+
+bool fold_value_of(AstNode* node, FoldValue* value) {
+    AstNodeIntegerLiteral* int_literal = null;
+    switch(node->kind) {
+        case AstNodeKindIntLiteral:
+            int_literal = node->data.literal->int_value;
+            // Signed literals hold their value in two's complement
+            switch(int_literal->type) {
+                case AstNodeUIntLiteral8:
+                case AstNodeUIntLiteral16:
+                case AstNodeUIntLiteral32:
+                case AstNodeUIntLiteral64:
+                    *value = fold_int(false, int_literal->number);
+                    break;
+                default: {
+                    bool is_negative = (int_literal->number >> 63) != 0;
+                    *value = fold_int(is_negative, is_negative ? ~int_literal->number + 1 : int_literal->number);
+                    break;
+                }
+            }
+            return true;
+        case AstNodeKindFloatLiteral:
+            *value = fold_float(node->data.literal->float_value->number);
+            return true;
+        case AstNodeKindBoolLiteral:
+            *value = fold_bool(node->data.literal->bool_value->value);
+            return true;
+        default:
+            return false;
+    }
+}
+
+void fold_value_store(const FoldValue* value, AstNode* node) {
+    switch(value->kind) {
+        case FoldValueKindInt:
+            node->data.literal->int_value->number = fold_bits(value);
+            switch(fold_value_type(value)) {
+                case AdoradTypeInt: node->data.literal->int_value->type = AstNodeIntegerLiteral32; break;
+                case AdoradTypeInt64: node->data.literal->int_value->type = AstNodeIntegerLiteral64; break;
+                default: node->data.literal->int_value->type = AstNodeUIntLiteral64; break;
+            }
+            break;
+        case FoldValueKindFloat:
+            node->data.literal->float_value->number = value->float_value;
+            node->data.literal->float_value->type = fold_value_type(value) == AdoradTypeFloat32 
+                                                        ? AstNodeFloatLiteral32 : AstNodeFloatLiteral64;
+            break;
+        case FoldValueKindBool:
+            node->data.literal->bool_value->value = value->bool_value;
+            break;
+        default: 
+            break;
+    }
+}
@@ -0,0 +1,64 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#ifndef ADORAD_FOLD_H
+#define ADORAD_FOLD_H
+
+#include <adorad/compiler/ast.h>
+#include <adorad/compiler/types.h>
+
+/*
+    Constant folding
+    The Parser folds operators whose operands are all literals (eg. `1 << 12 | 0x40`, `-1.5 * 2`, `not true`) into a
+    single literal node as it builds them, so that constant-heavy code doesn't leave deep trees for every later pass
+    to walk (see `Parser.fold_constants`).
+
+    Integer constants are exact over [Int64 min, UInt64 max] - the union of the ranges of the `AdoradTypeInt*` and 
+    `AdoradTypeUInt*` types - and anything outside that range is an error. The type of a folded integer is the 
+    smallest of `AdoradTypeInt`, `AdoradTypeInt64` and `AdoradTypeUInt64` that holds it. Float constants are 
+    Float64s: `AdoradTypeFloat32` if they're in its range, and `AdoradTypeFloat64` otherwise. Operands of different 
+    kinds are only mixed for ints and floats (the int is converted).
+*/
+
+typedef enum FoldValueKind {
+    FoldValueKindNone,
+    FoldValueKindInt,
+    FoldValueKindFloat,
+    FoldValueKindBool,
+} FoldValueKind;
+
+typedef struct FoldValue {
+    FoldValueKind kind;
+    bool is_negative;       // ints: the value is `-magnitude` (never set for 0)
+    UInt64 magnitude;
+    double float_value;
+    bool bool_value;
+} FoldValue;
+
+typedef enum FoldResult {
+    FoldOk,
+    FoldNotConstant,        // the operation can't be folded (eg. `&1`, or `true + 1`): it's left as it is
+    FoldOutOfRange,         // the result doesn't fit (see above)
+    FoldDivisionByZero,
+} FoldResult;
+
+// Set `value` to the value of `node` and return true, if it's an int, float or bool literal
+bool fold_value_of(AstNode* node, FoldValue* value);
+FoldResult fold_binary_op(BinaryOpKind op, const FoldValue* lhs, const FoldValue* rhs, FoldValue* result);
+FoldResult fold_prefix_op(PrefixOpKind op, const FoldValue* operand, FoldValue* result);
+// The smallest type that holds `value` (see above). `AdoradTypeBool` for bools
+AdoradTypes fold_value_type(const FoldValue* value);
+// Store `value` (an int, float or bool) in the payload of `node` (a literal of the matching kind)
+void fold_value_store(const FoldValue* value, AstNode* node);
+
+#endif // ADORAD_FOLD_H
@@ -0,0 +1,235 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <adorad/core/debug.h>
+#include <adorad/core/jobs.h>
+#include <adorad/compiler/frontend.h>
+#include <adorad/compiler/trace.h>
+
+// A file of the Frontend, as a job (see `JobPool`)
+typedef struct FrontendJob {
+    Frontend* frontend;
+    JobPool* pool;      // the one running the files (large files are lexed in chunks on it too)
+    UInt32 index;
+} FrontendJob;
+
+// Longest file name shown in the time report (longer ones are cut down - see `frontend_print_time_row()`)
+#define FRONTEND_REPORT_NAME_WIDTH      48
+
+// Read, lex and parse `frontend->files[index]`
+static void frontend_process(void* arg) {
+    Frontend* frontend = (cast(FrontendJob*)arg)->frontend;
+    JobPool* pool = (cast(FrontendJob*)arg)->pool;
+    UInt32 index = (cast(FrontendJob*)arg)->index;
+    FrontendFile* file = &frontend->files[index];
+    file->diags = diagnostics_new(frontend->diags->max_errors);
+    if(SOME(frontend->stats)) {
+        file->stats = stats_new();
+        file->stats->num_files = 1;
+    }
+
+    TRACE_ZONE("read", file->fname)
+    STATS_TIME_PHASE(file->stats, StatsPhaseRead) {
+        file->view = file_map(file->fname);
+    }
+    if(file->view.error != 0) {
+        Buff* fname = buff_new(cast(char*)file->fname);
+        Location loc = { 0, 0, fname };
+        Error err = file->view.error == ENOENT ? ErrorFileNotFound : ErrorFileNotReadable;
+        diagnostics_report(file->diags, DiagnosticLevelError, err, loc, 0, 0, "Cannot open file: %s", 
+                           strerror(file->view.error));
+        buff_free(fname);
+        return;
+    }
+    if(!file->view.is_mapped)
+        STATS_COUNT_ALLOC(file->stats, StatsPhaseRead, file->view.len + FILE_VIEW_PADDING);
+    file->lexer = lexer_init_view(&file->view, cast(char*)file->fname);
+    lexer_set_interner(file->lexer, frontend->interner);
+    lexer_set_diagnostics(file->lexer, file->diags);
+    lexer_set_stats(file->lexer, file->stats);
+    if(SOME(file->stats))
+        lexer_set_allocator(file->lexer, &frontend->memory[FrontendMemoryTokens].allocator);
+    // While it waits for its chunks, this thread may run other jobs (whose time is then counted as lexing this file)
+    TRACE_ZONE("lex", file->fname) {
+        lexer_lex_parallel(file->lexer, pool);
+    }
+
+    file->parser = parser_init(file->lexer);
+    file->parser->id = index;
+    if(SOME(file->stats))
+        parser_set_allocator(file->parser, &frontend->memory[FrontendMemoryAst].allocator);
+    TRACE_ZONE("parse", file->fname) {
+        file->ok = parser_parse(file->parser);
+    }
+    file->ok = file->ok && file->diags->num_errors == 0 && file->diags->num_dropped == 0;
+}
+
+Frontend* frontend_run(const char** fnames, UInt32 num_files, UInt32 num_threads, UInt32 max_errors, bool keep_stats) {
+    UInt64 start = stats_now();
+    Frontend* frontend = cast(Frontend*)calloc(1, sizeof(Frontend));
+    CORETEN_ENFORCE_NN(frontend, "Could not allocate memory. Memory full.");
+    frontend->files = cast(FrontendFile*)calloc(num_files > 0 ? num_files : 1, sizeof(FrontendFile));
+    CORETEN_ENFORCE_NN(frontend->files, "Could not allocate memory. Memory full.");
+    frontend->num_files = num_files;
+    frontend->diags = diagnostics_new(max_errors);
+    frontend->stats = keep_stats ? stats_new() : null;
+    frontend->interner = interner_new_shared();
+    tracking_allocator_init(&frontend->memory[FrontendMemoryTokens], "tokens", null);
+    tracking_allocator_init(&frontend->memory[FrontendMemoryAst], "ast", null);
+    for(UInt32 i = 0; i < num_files; i++)
+        frontend->files[i].fname = fnames[i];
+
+    if(num_threads == 0)
+        num_threads = thread_num_cpus();
+    if(num_threads > num_files)
+        num_threads = num_files;
+    if(num_threads == 0)
+        num_threads = 1;
+
+    // One job per file. The calling thread runs them too (while it waits)
+    FrontendJob* jobs = cast(FrontendJob*)calloc(num_files > 0 ? num_files : 1, sizeof(FrontendJob));
+    CORETEN_ENFORCE_NN(jobs, "Could not allocate memory. Memory full.");
+    JobPool* pool = job_pool_new(num_threads);
+    JobGroup group;
+    job_group_init(&group);
+    for(UInt32 i = 0; i < num_files; i++) {
+        jobs[i].frontend = frontend;
+        jobs[i].pool = pool;
+        jobs[i].index = i;
+        job_pool_submit(pool, &group, frontend_process, &jobs[i]);
+    }
+    job_group_wait(pool, &group);
+    frontend->num_threads = num_threads;
+    frontend->num_steals = cast(UInt32)job_pool_num_steals(pool);
+    job_pool_free(pool);
+    free(jobs);
+
+    frontend->ok = true;
+    for(UInt32 i = 0; i < num_files; i++) {
+        diagnostics_merge(frontend->diags, frontend->files[i].diags);
+        if(SOME(frontend->stats))
+            stats_merge(frontend->stats, frontend->files[i].stats);
+        frontend->ok = frontend->ok && frontend->files[i].ok;
+    }
+    frontend->nanoseconds = stats_now() - start;
+    return frontend;
+}
+
+// Total time `stats` spent in every phase
+static UInt64 frontend_stats_total(Stats* stats) {
+    UInt64 total = 0;
+    for(UInt32 i = 0; i < StatsPhaseCount; i++)
+        total += stats->phases[i].nanoseconds;
+    return total;
+}
+
+// Print a row of the time report: `name`, followed by the time spent in each phase (and in total), in milliseconds
+static void frontend_print_time_row(FILE* stream, const char* name, int width, Stats* stats) {
+    // Keep the end of names that don't fit (the file name, rather than the directories it's in)
+    int len = cast(int)strlen(name);
+    if(len > width)
+        fprintf(stream, "...%-*s", width - 3, name + len - (width - 3));
+    else
+        fprintf(stream, "%-*s", width, name);
+    for(UInt32 i = 0; i < StatsPhaseCount; i++)
+        fprintf(stream, " %10.3f", cast(double)stats->phases[i].nanoseconds / 1e6);
+    fprintf(stream, " %10.3f\n", cast(double)frontend_stats_total(stats) / 1e6);
+}
+
+void frontend_print_time_report(Frontend* frontend, FILE* stream) {
+    CORETEN_ENFORCE_NN(frontend->stats, "The Frontend didn't keep statistics");
+    // Files that couldn't be read aren't listed
+    UInt32* order = cast(UInt32*)calloc(frontend->num_files > 0 ? frontend->num_files : 1, sizeof(UInt32));
+    UInt64* totals = cast(UInt64*)calloc(frontend->num_files > 0 ? frontend->num_files : 1, sizeof(UInt64));
+    CORETEN_ENFORCE(SOME(order) && SOME(totals), "Could not allocate memory. Memory full.");
+    UInt32 num_files = 0;
+    int width = cast(int)strlen("Total");
+    for(UInt32 i = 0; i < frontend->num_files; i++) {
+        FrontendFile* file = &frontend->files[i];
+        if(NONE(file->stats) || NONE(file->lexer))
+            continue;
+        int len = cast(int)strlen(file->fname);
+        width = len > width ? len : width;
+        // Insertion sort, slowest first (stable, so that ties stay in file order)
+        UInt64 total = frontend_stats_total(file->stats);
+        UInt32 j = num_files++;
+        for(; j > 0 && totals[j - 1] < total; j--) {
+            order[j] = order[j - 1];
+            totals[j] = totals[j - 1];
+        }
+        order[j] = i;
+        totals[j] = total;
+    }
+    width = width > FRONTEND_REPORT_NAME_WIDTH ? FRONTEND_REPORT_NAME_WIDTH : width;
+
+    fprintf(stream, "Time report: %u file(s) on %u thread(s), %.3f ms wall-clock\n", num_files, 
+            frontend->num_threads, cast(double)frontend->nanoseconds / 1e6);
+    fprintf(stream, "%-*s", width, "File (ms)");
+    for(UInt32 i = 0; i < StatsPhaseCount; i++)
+        fprintf(stream, " %10s", stats_phase_str(cast(StatsPhase)i));
+    fprintf(stream, " %10s\n", "total");
+    for(UInt32 i = 0; i < num_files; i++)
+        frontend_print_time_row(stream, frontend->files[order[i]].fname, width, frontend->files[order[i]].stats);
+    frontend_print_time_row(stream, "Total", width, frontend->stats);
+
+    // Share of the total time spent in each phase
+    UInt64 total = frontend_stats_total(frontend->stats);
+    fprintf(stream, "%-*s", width, "");
+    for(UInt32 i = 0; i < StatsPhaseCount; i++) {
+        double share = total > 0 ? 100.0 * cast(double)frontend->stats->phases[i].nanoseconds / cast(double)total : 0;
+        fprintf(stream, " %9.1f%%", share);
+    }
+    fprintf(stream, " %9.1f%%\n", total > 0 ? 100.0 : 0.0);
+    free(order);
+    free(totals);
+}
+
+void frontend_print_memory_report(Frontend* frontend, FILE* stream) {
+    CORETEN_ENFORCE_NN(frontend->stats, "The Frontend didn't keep statistics");
+    fprintf(stream, "%-8s %12s %12s %12s %10s %10s\n", "Memory", "Live (KB)", "Peak (KB)", "Total (KB)", "Allocs", 
+            "Frees");
+    for(UInt32 i = 0; i < FrontendMemoryCount; i++) {
+        TrackingAllocator* tracker = &frontend->memory[i];
+        fprintf(stream, "%-8s %12.1f %12.1f %12.1f %10llu %10llu\n", tracker->name, 
+                cast(double)atomic_load(&tracker->live_bytes) / 1024, 
+                cast(double)atomic_load(&tracker->peak_bytes) / 1024,
+                cast(double)atomic_load(&tracker->total_bytes) / 1024,
+                cast(unsigned long long)atomic_load(&tracker->num_allocs), 
+                cast(unsigned long long)atomic_load(&tracker->num_frees));
+    }
+}
+
+void frontend_free(Frontend* frontend) {
+    if(SOME(frontend)) {
+        for(UInt32 i = 0; i < frontend->num_files; i++) {
+            FrontendFile* file = &frontend->files[i];
+            // This frees the Lexer as well
+            if(SOME(file->parser))
+                parser_free(file->parser);
+            else
+                lexer_free(file->lexer);
+            file_unmap(&file->view);
+            diagnostics_free(file->diags);
+            stats_free(file->stats);
+        }
+        diagnostics_free(frontend->diags);
+        stats_free(frontend->stats);
+        interner_free(frontend->interner);
+        free(frontend->files);
+        free(frontend);
+    }
+}
@@ -0,0 +1,86 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#ifndef ADORAD_FRONTEND_H
+#define ADORAD_FRONTEND_H
+
+#include <adorad/core/types.h>
+#include <adorad/core/io.h>
+#include <adorad/compiler/diagnostics.h>
+#include <adorad/compiler/lexer.h>
+#include <adorad/compiler/parser.h>
+#include <adorad/compiler/stats.h>
+
+/*
+    Front end driver
+    Runs every file of a module through the front end (read -> lex -> parse) on a pool of threads.
+
+    Files don't depend on one another here, so each one is a job: it's mapped (see `file_map()`), lexed and parsed 
+    with its own Lexer, Parser (and so, its own arena) and Diagnostics. The only thing shared between threads is the
+    Interner: one (thread-safe) Interner per run, so that a name has the same `SymbolId` in every file. Jobs run on a 
+    work-stealing `JobPool` (see <adorad/core/jobs.h>): the calling thread submits every file, and idle threads steal
+    them one at a time. This keeps every thread busy even when file sizes are very uneven, 
+    without a shared queue.
+
+    Results are stored by file index (not by completion order), and merged in the order the files were given, so the
+    output - including the order of the diagnostics - does not depend on the number of threads or on scheduling.
+*/
+
+// A source file, once it's been through the front end
+typedef struct FrontendFile {
+    const char* fname;
+    FileView view;      // contents of the file (the Lexical buffer). Unmapped with the Frontend
+    Lexer* lexer;       // null if the file couldn't be read
+    Parser* parser;     // null if the file couldn't be read. `parser->id` is the index of the file
+    Diagnostics* diags; // errors in this file
+    Stats* stats;       // statistics of this file (null unless the Frontend keeps them)
+    bool ok;            // set if the file was read, lexed and parsed without errors
+} FrontendFile;
+
+// Memory is accounted for by subsystem (when the Frontend keeps statistics), across every file
+typedef enum FrontendMemory {
+    FrontendMemoryTokens,   // token lists (see `lexer_set_allocator()`)
+    FrontendMemoryAst,      // AST nodes (see `parser_set_allocator()`)
+    FrontendMemoryCount
+} FrontendMemory;
+
+typedef struct Frontend {
+    FrontendFile* files;// in the order they were given
+    UInt32 num_files;
+    UInt32 num_threads; // number of threads the files were processed on (including the calling thread)
+    UInt32 num_steals;  // number of files stolen by a thread from another
+    Diagnostics* diags; // diagnostics of every file, merged in file order
+    Stats* stats;       // statistics of every file, merged (null unless asked for - see `frontend_run()`)
+    Interner* interner; // shared by the Lexer and Parser of every file (see `interner_new_shared()`)
+    UInt64 nanoseconds; // wall-clock time `frontend_run()` took
+    TrackingAllocator memory[FrontendMemoryCount]; // where the memory of the files went (if `stats` is set)
+    bool ok;            // set if every file is `ok`
+} Frontend;
+
+// Read, lex and parse `fnames[0..num_files)` on `num_threads` threads (the calling thread being one of them).
+// If `num_threads` is 0, one thread per CPU is used. Files are lexed in chunks on the same threads (see 
+// `lexer_lex_parallel()`) - no others are started. Each file keeps (at most) `max_errors` errors, and so does the 
+// merged sink (see `diagnostics_new()`). Errors are always recovered from, never reported as we exit.
+// If `keep_stats` is set, each file keeps its own statistics (see `Stats`), merged into `frontend->stats`.
+Frontend* frontend_run(const char** fnames, UInt32 num_files, UInt32 num_threads, UInt32 max_errors, bool keep_stats);
+// Print a breakdown of where the time went (like GCC's `-ftime-report`) to `stream`: the time each file spent in each
+// phase (slowest files first), and the totals - which, with more than one thread, can add up to more than the 
+// wall-clock time. The Frontend must have kept statistics.
+void frontend_print_time_report(Frontend* frontend, FILE* stream);
+// Print how much memory each subsystem used (live, peak and in total) to `stream`. The Frontend must have kept 
+// statistics.
+void frontend_print_memory_report(Frontend* frontend, FILE* stream);
+// Free the Frontend, along with every file's Parser, Lexer and Diagnostics (and the Interner they share)
+void frontend_free(Frontend* frontend);
+
+#endif // ADORAD_FRONTEND_H
@@ -0,0 +1,492 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <adorad/core/debug.h>
+#include <adorad/core/hash.h>
+#include <adorad/core/map.h>
+#include <adorad/core/serial.h>
+#include <adorad/compiler/cache.h>
+#include <adorad/compiler/compiler.h>
+#include <adorad/compiler/graph.h>
+#include <adorad/compiler/trace.h>
+
+// A view of the nul-terminated `str` (as a map key)
+#define GRAPH_KEY(str)      buffview_new_from_len(cast(char*)(str), strlen(str))
+
+ModuleGraph* module_graph_new() {
+    ModuleGraph* graph = cast(ModuleGraph*)calloc(1, sizeof(ModuleGraph));
+    CORETEN_ENFORCE_NN(graph, "Could not allocate memory. Memory full.");
+    graph->files = VEC_NEW(GraphFile, 16);
+    graph->modules = VEC_NEW(GraphModule, 8);
+    graph->strings = arena_new(0);
+    return graph;
+}
+
+void module_graph_free(ModuleGraph* graph) {
+    if(SOME(graph)) {
+        for(UInt64 i = 0; i < vec_size(graph->files); i++)
+            vec_free(vec_at_GraphFile(graph->files, i)->uses);
+        vec_free(graph->files);
+        vec_free(graph->modules);
+        arena_free(graph->strings);
+        free(graph);
+    }
+}
+
+// Copy `data[0..len)` (as a nul-terminated string) into the graph
+static char* graph_copy_str(ModuleGraph* graph, const char* data, UInt64 len) {
+    char* copy = cast(char*)arena_alloc_aligned(graph->strings, len + 1, 1);
+    memcpy(copy, data, len);
+    copy[len] = nullchar;
+    return copy;
+}
+
+// Find the modules of the graph's files, and whether each of them was built without errors
+static void graph_index_modules(ModuleGraph* graph) {
+    vec_clear(graph->modules);
+    Map* modules = map_new(MapKeyKindStr, 0, null);
+    // The interface of a module is that of its files, in order
+    Vec* states = VEC_NEW(HashWyState, 8);
+    for(UInt64 i = 0; i < vec_size(graph->files); i++) {
+        GraphFile* file = vec_at_GraphFile(graph->files, i);
+        bool is_new;
+        MapEntry* entry = map_insert_str(modules, GRAPH_KEY(file->module), &is_new);
+        if(is_new) {
+            GraphModule module = { file->module, 0, 0, true };
+            vec_push_GraphModule(graph->modules, &module);
+            HashWyState state;
+            hash_wyhash_init(&state, GRAPH_FORMAT_VERSION);
+            vec_push(states, &state);
+            entry->value = cast(void*)cast(UInt64)vec_size(graph->modules);
+        }
+        UInt64 index = cast(UInt64)entry->value - 1;
+        GraphModule* module = vec_at_GraphModule(graph->modules, index);
+        module->num_files++;
+        module->ok = module->ok && file->ok;
+        hash_wyhash_update(cast(HashWyState*)vec_at(states, index), &file->interface, sizeof(file->interface));
+    }
+    for(UInt64 i = 0; i < vec_size(graph->modules); i++)
+        vec_at_GraphModule(graph->modules, i)->interface = hash_wyhash_final(cast(HashWyState*)vec_at(states, i));
+    vec_free(states);
+    map_free(modules);
+}
+
+GraphFile* module_graph_find_file(ModuleGraph* graph, const char* fname) {
+    // Files are sorted by name
+    UInt64 low = 0;
+    UInt64 high = vec_size(graph->files);
+    while(low < high) {
+        UInt64 mid = low + (high - low) / 2;
+        GraphFile* file = vec_at_GraphFile(graph->files, mid);
+        int cmp = strcmp(file->fname, fname);
+        if(cmp == 0)
+            return file;
+        if(cmp < 0)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return null;
+}
+
+GraphModule* module_graph_find_module(ModuleGraph* graph, const char* name) {
+    for(UInt64 i = 0; i < vec_size(graph->modules); i++) {
+        GraphModule* module = vec_at_GraphModule(graph->modules, i);
+        if(strcmp(module->name, name) == 0)
+            return module;
+    }
+    return null;
+}
+
+/*
+    Layout of a graph file (see <adorad/core/serial.h> for the encodings):
+        u32  GRAPH_MAGIC, GRAPH_FORMAT_VERSION, ADORAD_VERSION
+        uleb num_files
+        for each file:
+            str  fname, module
+            u64  hash, interface
+            uleb size
+            u64  mtime_ns
+            u8   ok
+            uleb num_uses
+            str  uses[num_uses]
+        u32  checksum (of everything before it)
+    Modules aren't saved: they're found again from the files (see `graph_index_modules()`).
+*/
+
+bool module_graph_save(ModuleGraph* graph, const char* path) {
+    SerialWriter writer;
+    serial_writer_init_memory(&writer, 4096);
+    serial_write_u32(&writer, GRAPH_MAGIC);
+    serial_write_u32(&writer, GRAPH_FORMAT_VERSION);
+    serial_write_u32(&writer, ADORAD_VERSION);
+    serial_write_uleb(&writer, vec_size(graph->files));
+    for(UInt64 i = 0; i < vec_size(graph->files); i++) {
+        GraphFile* file = vec_at_GraphFile(graph->files, i);
+        serial_write_str(&writer, file->fname, strlen(file->fname));
+        serial_write_str(&writer, file->module, strlen(file->module));
+        serial_write_u64(&writer, file->hash);
+        serial_write_u64(&writer, file->interface);
+        serial_write_uleb(&writer, file->info.size);
+        serial_write_u64(&writer, file->info.mtime_ns);
+        serial_write_u8(&writer, file->ok);
+        serial_write_uleb(&writer, vec_size(file->uses));
+        for(UInt64 j = 0; j < vec_size(file->uses); j++) {
+            const char* use = *cast(char**)vec_at(file->uses, j);
+            serial_write_str(&writer, use, strlen(use));
+        }
+    }
+    serial_write_u32(&writer, serial_writer_checksum(&writer));
+
+    UInt64 tmp_len = strlen(path) + 32;
+    char* tmp_path = cast(char*)malloc(tmp_len);
+    CORETEN_ENFORCE_NN(tmp_path, "Could not allocate memory. Memory full.");
+    snprintf(tmp_path, tmp_len, "%s.%p.tmp", path, cast(void*)graph);
+
+    bool is_saved = false;
+    FILE* stream = fopen(tmp_path, "wb");
+    if(SOME(stream)) {
+        is_saved = fwrite(writer.data, 1, writer.len, stream) == writer.len;
+        is_saved = fclose(stream) == 0 && is_saved;
+        // `rename()` doesn't replace an existing file everywhere (eg. Windows)
+        if(is_saved && rename(tmp_path, path) != 0) {
+            remove(path);
+            is_saved = rename(tmp_path, path) == 0;
+        }
+        if(!is_saved)
+            remove(tmp_path);
+    }
+    free(tmp_path);
+    serial_writer_free(&writer);
+    return is_saved;
+}
+
+// Copy the string read next into the graph
+static char* graph_read_str(ModuleGraph* graph, SerialReader* reader) {
+    BuffView str = serial_read_str(reader);
+    return graph_copy_str(graph, reader->has_error ? "" : str.data, str.len);
+}
+
+ModuleGraph* module_graph_load(const char* path) {
+    FileView view = file_map(path);
+    if(view.error != 0)
+        return null;
+    SerialReader reader;
+    serial_reader_init_memory(&reader, view.data, view.len);
+    bool is_ok = serial_read_u32(&reader) == GRAPH_MAGIC && serial_read_u32(&reader) == GRAPH_FORMAT_VERSION &&
+                 serial_read_u32(&reader) == ADORAD_VERSION;
+
+    ModuleGraph* graph = module_graph_new();
+    UInt64 num_files = is_ok ? serial_read_uleb(&reader) : 0;
+    for(UInt64 i = 0; i < num_files && !reader.has_error; i++) {
+        GraphFile file = {0};
+        file.fname = graph_read_str(graph, &reader);
+        file.module = graph_read_str(graph, &reader);
+        file.hash = serial_read_u64(&reader);
+        file.interface = serial_read_u64(&reader);
+        file.info.size = serial_read_uleb(&reader);
+        file.info.mtime_ns = serial_read_u64(&reader);
+        file.ok = serial_read_u8(&reader) != 0;
+        UInt64 num_uses = serial_read_uleb(&reader);
+        file.uses = VEC_NEW(char*, num_uses > 0 && num_uses < 1024 ? num_uses : 1);
+        for(UInt64 j = 0; j < num_uses && !reader.has_error; j++) {
+            char* use = graph_read_str(graph, &reader);
+            vec_push(file.uses, &use);
+        }
+        vec_push_GraphFile(graph->files, &file);
+    }
+    UInt32 checksum = serial_reader_checksum(&reader);
+    is_ok = is_ok && serial_read_u32(&reader) == checksum && serial_reader_is_done(&reader);
+    serial_reader_free(&reader);
+    file_unmap(&view);
+    if(!is_ok) {
+        module_graph_free(graph);
+        return null;
+    }
+    graph_index_modules(graph);
+    return graph;
+}
+
+// Does a token of this kind begin a top-level declaration?
+static bool graph_begins_decl(TokenKind kind) {
+    return kind == EXPORT || kind == FUNC || kind == PUT || kind == MODULE || kind == USE || kind == STRUCT ||
+           kind == ENUM || token_is_attribute(kind);
+}
+
+// This goes by tokens (rather than by the AST) so that it doesn't depend on how much of a declaration the Parser
+// understands
+UInt64 graph_interface_hash(Lexer* lexer) {
+    HashWyState state;
+    hash_wyhash_init(&state, GRAPH_FORMAT_VERSION);
+    bool is_exported = false;   // in an exported declaration
+    bool is_func = false;       // ... of a function
+    bool is_head = false;       // in the keywords that begin it (eg. `export [inline] func`)
+    bool is_body = false;       // in the body of the function
+    UInt32 depth = 0;           // of brackets
+    for(UInt64 i = 0; i < vec_size(lexer->toklist); i++) {
+        Token* token = vec_at_Token(lexer->toklist, i);
+        TokenKind kind = token->kind;
+        if(kind == TOK_EOF)
+            break;
+        if(depth == 0 && graph_begins_decl(kind)) {
+            if(!is_head) {
+                is_exported = kind == EXPORT;
+                is_func = false;
+            }
+            is_head = true;
+            is_func = is_func || kind == FUNC;
+        } else {
+            is_head = false;
+        }
+
+        if(depth == 0 && kind == LBRACE && is_func)
+            is_body = true;
+        if(kind == LBRACE || kind == LPAREN || kind == LSQUAREBRACK)
+            depth++;
+        if(is_exported && !is_body) {
+            UInt32 kind32 = cast(UInt32)kind;
+            hash_wyhash_update(&state, &kind32, sizeof(kind32));
+            BuffView value = lexer_value(lexer, token);
+            hash_wyhash_update(&state, value.data, cast(Ll)value.len);
+        }
+        if((kind == RBRACE || kind == RPAREN || kind == RSQUAREBRACK) && depth > 0) {
+            depth--;
+            if(depth == 0)
+                is_body = false;
+        }
+    }
+    return hash_wyhash_final(&state);
+}
+
+// Add `name` to the set `names` (a map keyed by string). Returns true if it wasn't in it
+static bool graph_set_add(Map* names, const char* name) {
+    bool is_new;
+    map_insert_str(names, GRAPH_KEY(name), &is_new);
+    return is_new;
+}
+
+static bool graph_set_has(Map* names, const char* name) {
+    return SOME(map_find_str(names, GRAPH_KEY(name)));
+}
+
+// Mark every module that uses one of `changed` as dirty (unless it's been built already)
+static void graph_mark_users(ModuleGraph* graph, Map* changed, Map* dirty, bool* is_built) {
+    for(UInt64 i = 0; i < vec_size(graph->files); i++) {
+        GraphFile* file = vec_at_GraphFile(graph->files, i);
+        if(is_built[i] || graph_set_has(dirty, file->module))
+            continue;
+        for(UInt64 j = 0; j < vec_size(file->uses); j++) {
+            if(graph_set_has(changed, *cast(char**)vec_at(file->uses, j))) {
+                graph_set_add(dirty, file->module);
+                break;
+            }
+        }
+    }
+}
+
+// Mark the users of every module that changed since `prev` as dirty: the modules that went away, and (if
+// `with_interfaces`) the ones that appeared or whose interface changed
+static void graph_mark_changed(ModuleGraph* graph, ModuleGraph* prev, Map* prev_interfaces, Map* dirty,
+                               bool* is_built, bool with_interfaces) {
+    graph_index_modules(graph);
+    Map* changed = map_new(MapKeyKindStr, 0, null);
+    for(UInt64 i = 0; with_interfaces && i < vec_size(graph->modules); i++) {
+        GraphModule* module = vec_at_GraphModule(graph->modules, i);
+        MapEntry* entry = map_find_str(prev_interfaces, GRAPH_KEY(module->name));
+        if(NONE(entry) || (cast(GraphModule*)entry->value)->interface != module->interface)
+            graph_set_add(changed, module->name);
+    }
+    for(UInt64 i = 0; SOME(prev) && i < vec_size(prev->modules); i++) {
+        GraphModule* module = vec_at_GraphModule(prev->modules, i);
+        if(NONE(module_graph_find_module(graph, module->name)))
+            graph_set_add(changed, module->name);
+    }
+    graph_mark_users(graph, changed, dirty, is_built);
+    map_free(changed);
+}
+
+// Record what building `built` found out about `file`
+static void graph_update_file(ModuleGraph* graph, GraphFile* file, BuildFile* built) {
+    file->module = graph_copy_str(graph, built->module, strlen(built->module));
+    file->ok = built->ok;
+    file->interface = SOME(built->lexer) ? graph_interface_hash(built->lexer) : 0;
+    vec_free(file->uses);
+    file->uses = VEC_NEW(char*, SOME(built->uses) && vec_size(built->uses) > 0 ? vec_size(built->uses) : 1);
+    for(UInt64 i = 0; SOME(built->uses) && i < vec_size(built->uses); i++) {
+        const char* name = vec_at_BuildUse(built->uses, i)->name;
+        char* use = graph_copy_str(graph, name, strlen(name));
+        vec_push(file->uses, &use);
+    }
+}
+
+ModuleGraph* module_graph_build(ModuleGraph* prev, const char* dir, BuildOptions* options, GraphBuildReport* report) {
+    UInt64 start = stats_now();
+    memset(report, 0, sizeof(GraphBuildReport));
+    Vec* fnames = build_find_files(dir);
+    if(NONE(fnames))
+        return null;
+    report->diags = diagnostics_new(SOME(options) ? options->max_errors : 0);
+
+    // Which files changed? (and so, which modules must be rebuilt)
+    ModuleGraph* graph = module_graph_new();
+    UInt64 num_files = vec_size(fnames);
+    bool* is_built = cast(bool*)calloc(num_files > 0 ? num_files : 1, sizeof(bool));
+    bool* is_changed = cast(bool*)calloc(num_files > 0 ? num_files : 1, sizeof(bool));
+    CORETEN_ENFORCE(SOME(is_built) && SOME(is_changed), "Could not allocate memory. Memory full.");
+    Map* dirty = map_new(MapKeyKindStr, 0, null);
+    Map* seen = map_new(MapKeyKindStr, num_files > 0 ? cast(UInt32)num_files : 1, null);
+    for(UInt64 i = 0; i < num_files; i++) {
+        const char* fname = *cast(char**)vec_at(fnames, i);
+        graph_set_add(seen, fname);
+        GraphFile file = {0};
+        file.fname = graph_copy_str(graph, fname, strlen(fname));
+        file_info(fname, &file.info);
+        GraphFile* old = SOME(prev) ? module_graph_find_file(prev, fname) : null;
+        bool is_same = SOME(old) && old->info.size == file.info.size && old->info.mtime_ns == file.info.mtime_ns;
+        if(!is_same) {
+            TRACE_ZONE("hash", fname) {
+                FileView view = file_map(fname);
+                file.hash = cache_key(view.data, view.len);
+                file_unmap(&view);
+            }
+            report->num_hashed++;
+            is_same = SOME(old) && old->hash == file.hash;
+        }
+        if(is_same) {
+            file.hash = old->hash;
+            file.interface = old->interface;
+            file.ok = old->ok;
+            file.module = graph_copy_str(graph, old->module, strlen(old->module));
+            file.uses = VEC_NEW(char*, vec_size(old->uses) > 0 ? vec_size(old->uses) : 1);
+            for(UInt64 j = 0; j < vec_size(old->uses); j++) {
+                const char* name = *cast(char**)vec_at(old->uses, j);
+                char* use = graph_copy_str(graph, name, strlen(name));
+                vec_push(file.uses, &use);
+            }
+            if(!old->ok)
+                graph_set_add(dirty, file.module);
+        } else {
+            // Its module isn't known until it's parsed
+            is_changed[i] = true;
+            file.module = SOME(old) ? graph_copy_str(graph, old->module, strlen(old->module)) : "";
+            file.uses = VEC_NEW(char*, 1);
+            if(SOME(old))
+                graph_set_add(dirty, old->module);
+        }
+        vec_push_GraphFile(graph->files, &file);
+    }
+    // The modules of the files that were removed changed too
+    for(UInt64 i = 0; SOME(prev) && i < vec_size(prev->files); i++) {
+        GraphFile* old = vec_at_GraphFile(prev->files, i);
+        if(!graph_set_has(seen, old->fname))
+            graph_set_add(dirty, old->module);
+    }
+    Map* prev_interfaces = map_new(MapKeyKindStr, 0, null);
+    for(UInt64 i = 0; SOME(prev) && i < vec_size(prev->modules); i++) {
+        GraphModule* module = vec_at_GraphModule(prev->modules, i);
+        map_put_str(prev_interfaces, GRAPH_KEY(module->name), module);
+    }
+
+    // Modules that are gone (every file of theirs was removed) won't be built: their users must be rebuilt now
+    graph_mark_changed(graph, prev, prev_interfaces, dirty, is_built, false);
+
+    // Build the dirty modules, wave after wave, until no interface changes
+    Vec* wave = VEC_NEW(char*, 16);
+    Vec* wave_files = VEC_NEW(UInt64, 16);
+    Vec* externs = VEC_NEW(char*, 16);
+    Map* built_modules = map_new(MapKeyKindStr, 0, null);
+    for(;;) {
+        vec_clear(wave);
+        vec_clear(wave_files);
+        vec_clear(externs);
+        Map* extern_set = map_new(MapKeyKindStr, 0, null);
+        for(UInt64 i = 0; i < num_files; i++) {
+            GraphFile* file = vec_at_GraphFile(graph->files, i);
+            if(!is_built[i] && (is_changed[i] || graph_set_has(dirty, file->module))) {
+                vec_push(wave, &file->fname);
+                vec_push(wave_files, &i);
+            } else if(graph_set_add(extern_set, file->module)) {
+                vec_push(externs, &file->module);
+            }
+        }
+        map_free(extern_set);
+        if(vec_size(wave) == 0)
+            break;
+
+        BuildOptions wave_options = {0};
+        if(SOME(options))
+            wave_options = *options;
+        wave_options.extern_modules = cast(const char**)vec_begin(externs);
+        wave_options.num_extern_modules = cast(UInt32)vec_size(externs);
+        Build* build = null;
+        TRACE_ZONE("wave", null) {
+            build = build_files(cast(const char**)vec_begin(wave), cast(UInt32)vec_size(wave), &wave_options);
+        }
+        report->num_waves++;
+        report->num_rebuilt_files += build->num_files;
+        diagnostics_merge(report->diags, build->diags);
+        for(UInt64 j = 0; j < vec_size(wave_files); j++) {
+            UInt64 i = *cast(UInt64*)vec_at(wave_files, j);
+            is_built[i] = true;
+            graph_update_file(graph, vec_at_GraphFile(graph->files, i), &build->files[j]);
+            graph_set_add(built_modules, build->files[j].module);
+        }
+        build_free(build);
+
+        // A module that (now) has a file that wasn't in the wave must be rebuilt as a whole
+        for(UInt64 i = 0; i < num_files; i++) {
+            GraphFile* file = vec_at_GraphFile(graph->files, i);
+            if(!is_built[i] && graph_set_has(built_modules, file->module))
+                graph_set_add(dirty, file->module);
+        }
+        // ... and so must the users of a module whose interface changed (or that appeared, or went away)
+        graph_mark_changed(graph, prev, prev_interfaces, dirty, is_built, true);
+    }
+    graph_index_modules(graph);
+
+    report->num_files = cast(UInt32)num_files;
+    report->num_modules = cast(UInt32)vec_size(graph->modules);
+    report->num_rebuilt_modules = map_len(built_modules);
+    report->ok = true;
+    for(UInt64 i = 0; i < vec_size(graph->modules); i++)
+        report->ok = report->ok && vec_at_GraphModule(graph->modules, i)->ok;
+
+    map_free(built_modules);
+    map_free(prev_interfaces);
+    map_free(seen);
+    map_free(dirty);
+    vec_free(externs);
+    vec_free(wave_files);
+    vec_free(wave);
+    free(is_changed);
+    free(is_built);
+    for(UInt64 i = 0; i < num_files; i++)
+        free(*cast(char**)vec_at(fnames, i));
+    vec_free(fnames);
+    report->nanoseconds = stats_now() - start;
+    return graph;
+}
+
+void graph_print_report(GraphBuildReport* report, FILE* stream) {
+    if(report->num_waves == 0) {
+        fprintf(stream, "Up to date: %u file(s) in %u module(s), checked in %.3f ms\n", report->num_files,
+                report->num_modules, cast(double)report->nanoseconds / 1e6);
+        return;
+    }
+    fprintf(stream, "Rebuilt %u of %u module(s) (%u of %u file(s)) in %u wave(s), %.3f ms. %u file(s) hashed\n",
+            report->num_rebuilt_modules, report->num_modules, report->num_rebuilt_files, report->num_files,
+            report->num_waves, cast(double)report->nanoseconds / 1e6, report->num_hashed);
+}
@@ -0,0 +1,106 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#ifndef ADORAD_GRAPH_H
+#define ADORAD_GRAPH_H
+
+#include <stdio.h>
+
+#include <adorad/core/types.h>
+#include <adorad/core/io.h>
+#include <adorad/core/memory.h>
+#include <adorad/core/vector.h>
+#include <adorad/compiler/build.h>
+#include <adorad/compiler/diagnostics.h>
+#include <adorad/compiler/lexer.h>
+
+/*
+    Module graph (incremental builds)
+    Records, for every file of the last build, its content hash (see `cache_key()`), what it exports (a hash of its
+    interface - see `graph_interface_hash()`), its module and the modules it uses. The graph is saved next to the
+    sources (see `GRAPH_DEFAULT_FNAME`) and loaded by the next build, which then only rebuilds:
+        1. modules with a file that was added, removed or edited (or that had errors last time), and
+        2. modules that use a module whose interface changed in the process - and so on, for as long as interfaces
+           keep changing.
+    So an edit to the body of a function rebuilds its module, but not the modules that use it. Files whose size and
+    modification time haven't changed since they were hashed aren't even read: a no-op build is a directory walk.
+
+    Modules are rebuilt in waves (see `module_graph_build()`): the new interfaces are only known once a wave is built.
+*/
+
+#define GRAPH_MAGIC             0x47444141  // "AADG"
+// Bump this whenever the layout (or the meaning) of anything in a graph file changes
+#define GRAPH_FORMAT_VERSION    1
+// Name of the graph file, in the directory being built
+#define GRAPH_DEFAULT_FNAME     ".adorad-graph"
+
+typedef struct GraphFile {
+    char* fname;
+    char* module;       // module the file is a part of
+    Vec* uses;          // names (`char*`) of the modules it uses
+    UInt64 hash;        // `cache_key()` of its contents
+    UInt64 interface;   // see `graph_interface_hash()`
+    FileInfo info;      // its size and modification time when it was hashed
+    bool ok;            // set if it was built without errors
+} GraphFile;
+
+VEC_DEFINE(GraphFile)
+
+typedef struct GraphModule {
+    char* name;
+    UInt64 interface;   // hash of the interfaces of its files (in file order)
+    UInt32 num_files;
+    bool ok;            // set if every file of the module is `ok`
+} GraphModule;
+
+VEC_DEFINE(GraphModule)
+
+typedef struct ModuleGraph {
+    Vec* files;         // `GraphFile`s, sorted by name
+    Vec* modules;       // `GraphModule`s, in the order they're first seen in `files`
+    Arena* strings;     // storage for the names
+} ModuleGraph;
+
+// What `module_graph_build()` did
+typedef struct GraphBuildReport {
+    UInt32 num_files;
+    UInt32 num_modules;
+    UInt32 num_hashed;          // files that had to be read to be hashed (their size or modification time changed)
+    UInt32 num_rebuilt_files;
+    UInt32 num_rebuilt_modules;
+    UInt32 num_waves;           // no. of builds it took
+    UInt64 nanoseconds;
+    Diagnostics* diags;         // diagnostics of every file rebuilt. Free them with `diagnostics_free()`
+    bool ok;                    // set if every module is `ok`
+} GraphBuildReport;
+
+ModuleGraph* module_graph_new();
+void module_graph_free(ModuleGraph* graph);
+// Load the graph saved at `path`. Returns null if there's no such file, or it isn't a (complete, uncorrupted) graph
+// file of this compiler
+ModuleGraph* module_graph_load(const char* path);
+// Save `graph` to `path` (under a temporary name, then renamed). Returns false on an I/O error
+bool module_graph_save(ModuleGraph* graph, const char* path);
+GraphFile* module_graph_find_file(ModuleGraph* graph, const char* fname);
+GraphModule* module_graph_find_module(ModuleGraph* graph, const char* name);
+// Hash of what a file exports, from its tokens: every top-level declaration that begins with `export`, except for
+// the bodies of functions. Edits to anything else (private declarations, function bodies, comments and whitespace)
+// don't change it
+UInt64 graph_interface_hash(Lexer* lexer);
+// Build the modules under `dir` that changed since `prev` (which may be null, to build everything), and return the
+// graph of the result (`prev` is left as it is). Returns null if `dir` couldn't be opened. `report` is filled in
+ModuleGraph* module_graph_build(ModuleGraph* prev, const char* dir, BuildOptions* options, GraphBuildReport* report);
+// Print what `module_graph_build()` did to `stream`
+void graph_print_report(GraphBuildReport* report, FILE* stream);
+
+#endif // ADORAD_GRAPH_H
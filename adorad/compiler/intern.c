@@ -0,0 +1,116 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <adorad/core/debug.h>
+#include <adorad/core/hash.h>
+#include <adorad/compiler/intern.h>
+
+// Initial capacity of the table
+#define INTERN_INITIAL_CAPACITY     512
+
+Interner* interner_new() {
+    Interner* interner = cast(Interner*)calloc(1, sizeof(Interner));
+    CORETEN_ENFORCE_NN(interner, "Could not allocate memory. Memory full.");
+
+    interner->table = map_new(MapKeyKindStr, INTERN_INITIAL_CAPACITY, null);
+    interner->strings = arena_new(0);
+
+    return interner;
+}
+
+Interner* interner_new_shared() {
+    Interner* interner = interner_new();
+    interner->is_shared = true;
+    mutex_init(&interner->lock);
+    return interner;
+}
+
+void interner_free(Interner* interner) {
+    if(SOME(interner)) {
+        if(interner->is_shared)
+            mutex_destroy(&interner->lock);
+        arena_free(interner->strings);
+        map_free(interner->table);
+        free(interner);
+    }
+}
+
+// Copy `data[0..len)` (and a nul terminator) into the spelling storage
+static const char* interner_store(Interner* interner, const char* data, UInt32 len) {
+    // Spellings are packed (they don't need to be aligned)
+    char* str = cast(char*)arena_alloc_aligned(interner->strings, len + 1, 1);
+    memcpy(str, data, len);
+    str[len] = nullchar;
+    return str;
+}
+
+static inline void interner_lock(Interner* interner) {
+    if(interner->is_shared)
+        mutex_lock(&interner->lock);
+}
+
+static inline void interner_unlock(Interner* interner) {
+    if(interner->is_shared)
+        mutex_unlock(&interner->lock);
+}
+
+SymbolId interner_intern(Interner* interner, const char* data, UInt32 len) {
+    bool is_new;
+    interner_lock(interner);
+    MapEntry* entry = map_insert_str(interner->table, buffview_new_from_len(cast(char*)data, len), &is_new);
+    SymbolId id = cast(SymbolId)(entry - interner->table->entries) + 1;
+    if(CORETEN_UNLIKELY(is_new)) {
+        CORETEN_ENFORCE(map_len(interner->table) < UInt32_MAX, "Too many symbols");
+        // The key looked up is only borrowed: the table keeps the stored copy
+        entry->key.str = buffview_new_from_len(cast(char*)interner_store(interner, data, len), len);
+    }
+    interner_unlock(interner);
+    return id;
+}
+
+SymbolId interner_intern_view(Interner* interner, BuffView view) {
+    return interner_intern(interner, view.data, cast(UInt32)view.len);
+}
+
+SymbolId interner_find(Interner* interner, const char* data, UInt32 len) {
+    interner_lock(interner);
+    MapEntry* entry = map_find_str(interner->table, buffview_new_from_len(cast(char*)data, len));
+    SymbolId id = NONE(entry) ? SYMBOL_NULL : cast(SymbolId)(entry - interner->table->entries) + 1;
+    interner_unlock(interner);
+    return id;
+}
+
+BuffView interner_view(Interner* interner, SymbolId id) {
+    if(id == SYMBOL_NULL)
+        return buffview_new_from_len("", 0);
+    // The table's entries move as it grows (the spellings don't)
+    interner_lock(interner);
+    CORETEN_ENFORCE(id <= map_len(interner->table), "Invalid symbol id");
+    BuffView view = map_at(interner->table, id - 1)->key.str;
+    interner_unlock(interner);
+    return view;
+}
+
+const char* interner_str(Interner* interner, SymbolId id) {
+    return interner_view(interner, id).data;
+}
+
+UInt32 interner_len(Interner* interner) {
+    interner_lock(interner);
+    UInt32 len = map_len(interner->table);
+    interner_unlock(interner);
+    return len;
+}
@@ -0,0 +1,66 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+#ifndef ADORAD_INTERN_H
+#define ADORAD_INTERN_H
+
+#include <adorad/core/types.h>
+#include <adorad/core/buffer.h>
+#include <adorad/core/memory.h>
+#include <adorad/core/map.h>
+#include <adorad/core/thread.h>
+
+/*
+    The Interner maps every distinct spelling (of an identifier, a string literal, etc) to a stable 32-bit
+    `SymbolId`. Each spelling is stored exactly once, so two names are equal if and only if their ids are - comparing
+    names (and looking up symbols) is an integer operation no matter which file they were read from.
+
+    The same Interner is meant to be shared by every Lexer and Parser of a compilation (see `lexer_set_interner()`).
+    One made with `interner_new()` is _not_ thread-safe. One made with `interner_new_shared()` is: every call takes
+    its lock, so files lexed (and parsed) on different threads can share it. Spellings never move, so views (and 
+    strings) returned by it stay valid while other threads intern.
+*/
+
+typedef UInt32 SymbolId;
+
+// Id of "no symbol". No spelling (not even the empty string) is ever interned as SYMBOL_NULL
+#define SYMBOL_NULL     0
+
+typedef struct Interner {
+    // Spellings are never removed, so the `id`th spelling interned is entry `id - 1` of the table (its key is the
+    // nul-terminated copy of the spelling in `strings`)
+    Map* table;
+    Arena* strings;     // storage for the spellings (which never move)
+    bool is_shared;     // set if `lock` guards every call (see `interner_new_shared()`)
+    Mutex lock;
+} Interner;
+
+Interner* interner_new();
+// Same as `interner_new()`, but the Interner may be used by several threads at once
+Interner* interner_new_shared();
+void interner_free(Interner* interner);
+
+// Returns the id of `data[0..len)`, interning it if it hasn't been seen before
+SymbolId interner_intern(Interner* interner, const char* data, UInt32 len);
+// Same as `interner_intern()`, for a view (eg. the value of a `CompactToken`)
+SymbolId interner_intern_view(Interner* interner, BuffView view);
+// Returns the id of `data[0..len)` if it has been interned, or SYMBOL_NULL
+SymbolId interner_find(Interner* interner, const char* data, UInt32 len);
+
+// Returns the spelling of `id`
+BuffView interner_view(Interner* interner, SymbolId id);
+// Returns the spelling of `id` as a (nul-terminated) string
+const char* interner_str(Interner* interner, SymbolId id);
+// Number of interned spellings
+UInt32 interner_len(Interner* interner);
+
+#endif // ADORAD_INTERN_H
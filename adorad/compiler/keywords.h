@@ -0,0 +1,100 @@
+// Auto-generated by tools/scripts/generate_tokens.py
+// DO NOT EDIT - regenerate with:
+//     python tools/scripts/generate_tokens.py keyword_hash adorad/compiler/tokens.h adorad/compiler/keywords.h
+
+#ifndef ADORAD_KEYWORDS_H
+#define ADORAD_KEYWORDS_H
+
+#include <adorad/core/types.h>
+#include <adorad/compiler/tokens.h>
+
+/*
+    Collision-free perfect hash for the keywords in `ALLTOKENS` (TOK___KEYWORDS_BEGIN..TOK___KEYWORDS_END).
+    A keyword is classified with one hash and one compare (see `is_keyword_or_identifier()` in lexer.c).
+*/
+#define KEYWORD_COUNT       35
+#define KEYWORD_MIN_LENGTH  2
+#define KEYWORD_MAX_LENGTH  11
+#define KEYWORD_HASH_BITS   6
+#define KEYWORD_TABLE_SIZE  (1 << KEYWORD_HASH_BITS)
+
+// If this fails, `ALLTOKENS` has changed and this file must be regenerated
+CORETEN_STATIC_ASSERT(TOK___KEYWORDS_END - TOK___KEYWORDS_BEGIN - 2 == KEYWORD_COUNT);
+
+// Packs the first two and last two characters of a keyword candidate (along with its length) into a single word
+// `len` must be in [KEYWORD_MIN_LENGTH, KEYWORD_MAX_LENGTH]
+static inline UInt32 keyword_hash(const char* data, UInt32 len) {
+    const UInt8* s = cast(const UInt8*)data;
+    UInt32 key = (s[0] | (s[1] << 8) | (s[len - 2] << 16) | (cast(UInt32)s[len - 1] << 24)) ^ len;
+    return cast(UInt32)(key * 0x425B4453u) >> (32 - KEYWORD_HASH_BITS);
+}
+
+// Maps `keyword_hash()` to a keyword TokenKind (TOK_NULL for empty slots)
+static const UInt8 keywordTable[KEYWORD_TABLE_SIZE] = {
+    FROM,
+    USE,
+    FALLTHROUGH,
+    NOT,
+    DEFER,
+    ELSE,
+    DEFAULT,
+    TOK_NULL,
+    TOK_NULL,
+    TRY,
+    RETURN,
+    TOK_NULL,
+    IF,
+    TOK_NULL,
+    TOK_NULL,
+    TOK_NULL,
+    ELSEIF,
+    CONTINUE,
+    TOK_NULL,
+    ORELSE,
+    CONST,
+    TOK_NULL,
+    PUT,
+    TOK_NULL,
+    TYPEOF,
+    TOK_NULL,
+    TOK_NULL,
+    TOK_NULL,
+    TOK_NULL,
+    LOOP,
+    EXPORT,
+    TOK_NULL,
+    WHEN,
+    TOK_NULL,
+    UNION,
+    GLOBAL,
+    FUNC,
+    TOK_NULL,
+    ALIAS,
+    TOK_NULL,
+    IN,
+    TOK_NULL,
+    RANGE,
+    MATCH,
+    TOK_NULL,
+    STRUCT,
+    TOK_NULL,
+    TOK_NULL,
+    MUTABLE,
+    TOK_NULL,
+    TOK_NULL,
+    WHERE,
+    TOK_NULL,
+    AS,
+    TOK_NULL,
+    RAISE,
+    MODULE,
+    TOK_NULL,
+    BREAK,
+    ENUM,
+    MACRO,
+    TOK_NULL,
+    TOK_NULL,
+    TOK_NULL,
+};
+
+#endif // ADORAD_KEYWORDS_H
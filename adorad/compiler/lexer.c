@@ -15,7 +15,13 @@ Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
 #include <stdlib.h>
 #include <string.h>
 
+#include <adorad/core/utf8.h>
+
 #include <adorad/compiler/lexer.h>
+#include <adorad/compiler/keywords.h>
+#include <adorad/compiler/charclass.h>
+#include <adorad/compiler/scanner.h>
+#include <adorad/compiler/unicode.h>
 
 #define SHOULD_LOG_LEXER    0
 #if SHOULD_LOG_LEXER != 0
@@ -28,24 +34,13 @@ Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
 // NB: This does not increase the offset
 #define LEXER_CURR_CHAR           buff_at(lexer->buffer, lexer->offset)
 
-// Reset the line
-#define LEXER_RESET_LINENO        lexer->loc->line = 0
-// Reset the column number 
-#define LEXER_RESET_COLNO         lexer->loc->col = 0
-
-// Increment the line number
-#define LEXER_INCREMENT_LINENO    ++lexer->loc->line; LEXER_RESET_COLNO
-// Decrement the line
-#define LEXER_DECREMENT_LINENO    --lexer->loc->line; LEXER_RESET_COLNO
-// Increment the column number
-#define LEXER_INCREMENT_COLNO     ++lexer->loc->col 
-// Decrement the col
-#define LEXER_DECREMENT_COLNO     --lexer->loc->col
+// NB: The Lexer only keeps track of the offset. Lines and columns are resolved from offsets when needed 
+// (see `lexer_loc()`)
 
 // Increment the Lexical Buffer offset
-#define LEXER_INCREMENT_OFFSET    ++lexer->offset; LEXER_INCREMENT_COLNO
+#define LEXER_INCREMENT_OFFSET    ++lexer->offset
 // Decrement the Lexical Buffer offset
-#define LEXER_DECREMENT_OFFSET    --lexer->offset; LEXER_DECREMENT_COLNO
+#define LEXER_DECREMENT_OFFSET    --lexer->offset
 
 // Reset the Lexer state
 #define LEXER_RESET             \
@@ -53,65 +48,164 @@ Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
     lexer->offset = 0;          \
     loc_reset(lexer->loc)
 
-// These macros are used in the switch() statements below during the Lexing of Adorad source files.
-#define WHITESPACE_NO_NEWLINE \
-    ' ': case '\r': case '\t': case '\v': case '\f'
-
-#define DIGIT_NON_ZERO  \
-    '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9'
-
-#define DIGIT \
-    '0': case DIGIT_NON_ZERO
+// Returns the offset of the first invalid UTF-8 byte at or after `offset`, or UInt32_MAX if there is none
+static UInt32 lexer_find_bad_utf8(Lexer* lexer, UInt32 offset) {
+    UInt64 bad = offset + utf8_validate(lexer->buffer->data + offset, lexer->buff_cap - offset);
+    return bad < lexer->buff_cap ? cast(UInt32)bad : UInt32_MAX;
+}
 
-#define HEX_DIGIT \
-    'a': case 'b': case 'c': case 'd': case 'e': case 'f': case 'A': case 'B': case 'C': case 'D': case 'E': case 'F': \
-    case DIGIT
+// Check the encoding of the Lexical buffer (once, as it's set). Invalid UTF-8 is only reported once it's lexed (see 
+// `lexer_check_utf8()`)
+static void lexer_check_encoding(Lexer* lexer) {
+    lexer->is_ascii = NONE(lexer->buffer->data) || utf8_is_ascii(lexer->buffer->data, lexer->buff_cap);
+    lexer->bad_utf8 = lexer->is_ascii ? UInt32_MAX : lexer_find_bad_utf8(lexer, 0);
+}
 
-#define ALPHA_EXCEPT_B_O_X \
-         'a': case 'c': case 'd': case 'e': case 'f': case 'g': case 'h': case 'i': case 'j': case 'k': case 'l': \
-    case 'm': case 'n': case 'p': case 'q': case 'r': case 's': case 't': case 'u': case 'v': case 'w': case 'y': \
-    case 'z': case 'A': case 'C': case 'D': case 'E': case 'F': case 'G': case 'H': case 'I': case 'J': case 'K': \
-    case 'L': case 'M': case 'N':case 'P': case 'Q': case 'R': case 'S': case 'T': case 'U': case 'V': case 'W':  \
-    case 'Y': case 'Z'  \
+Lexer* lexer_init(char* buffer, char* fname) {
+    Lexer* lexer = cast(Lexer*)calloc(1, sizeof(Lexer));
 
-#define ALPHA \
-         'b': case 'o': case 'x': case 'B': case 'O': case 'X': case ALPHA_EXCEPT_B_O_X
+    lexer->offset = 0;
+    lexer->buffer = BUFF_NEW(buffer);
+    lexer->buff_cap = buff_len(lexer->buffer);
+    lexer->is_padded = false;
+    lexer->toklist = VEC_NEW(Token, TOKENLIST_ALLOC_CAPACITY);
+    lexer->loc = loc_new(fname);
+    lexer->is_compact = false;
+    lexer->tokens = null;
+    lexer->lines = null;
+    lexer->interner = null;
+    lexer->diags = null;
+    lexer->on_recover = null;
+    lexer->scan_end = UInt32_MAX;
+    lexer->on_error = null;
+    lexer_check_encoding(lexer);
 
+    return lexer;
+}
 
-Lexer* lexer_init(char* buffer, char* fname) {
+Lexer* lexer_init_compact(char* buffer, char* fname, UInt16 fileid) {
     Lexer* lexer = cast(Lexer*)calloc(1, sizeof(Lexer));
 
     lexer->offset = 0;
     lexer->buffer = BUFF_NEW(buffer);
     lexer->buff_cap = buff_len(lexer->buffer);
-    lexer->toklist = VEC_NEW(Token, TOKENLIST_ALLOC_CAPACITY);
+    lexer->is_padded = false;
+    lexer->toklist = null;
     lexer->loc = loc_new(fname);
+    lexer->is_compact = true;
+    lexer->tokens = token_arena_new(TOKENLIST_ALLOC_CAPACITY);
+    lexer->fileid = fileid;
+    lexer->lines = null;
+    lexer->interner = null;
+    lexer->diags = null;
+    lexer->on_recover = null;
+    lexer->scan_end = UInt32_MAX;
+    lexer->on_error = null;
+    lexer_check_encoding(lexer);
 
     return lexer;
 }
 
+// Point the Lexical buffer at `view` (without copying it, or scanning it for its length)
+static void lexer_set_view(Lexer* lexer, FileView* view) {
+    CORETEN_ENFORCE_NN(view, "Expected not null");
+    CORETEN_ENFORCE(view->len < UInt32_MAX, "Source files larger than 4GB are not supported");
+
+    lexer->buffer->data = view->data;
+    lexer->buffer->len = view->len;
+    lexer->buff_cap = view->len;
+    lexer->is_padded = true;
+    lexer_check_encoding(lexer);
+}
+
+Lexer* lexer_init_view(FileView* view, char* fname) {
+    Lexer* lexer = lexer_init(null, fname);
+    lexer_set_view(lexer, view);
+    return lexer;
+}
+
+Lexer* lexer_init_compact_view(FileView* view, char* fname, UInt16 fileid) {
+    Lexer* lexer = lexer_init_compact(null, fname, fileid);
+    lexer_set_view(lexer, view);
+    return lexer;
+}
+
+void lexer_set_interner(Lexer* lexer, Interner* interner) {
+    lexer->interner = interner;
+}
+
+void lexer_set_diagnostics(Lexer* lexer, Diagnostics* diags) {
+    lexer->diags = diags;
+}
+
+void lexer_set_stats(Lexer* lexer, Stats* stats) {
+    lexer->stats = stats;
+}
+
+void lexer_set_allocator(Lexer* lexer, Allocator* allocator) {
+    CORETEN_ENFORCE(lexer->num_tokens == 0 && NONE(lexer->ring), "The Lexer has already made tokens");
+    lexer->allocator = allocator;
+    if(SOME(lexer->toklist)) {
+        vec_free(lexer->toklist);
+        lexer->toklist = VEC_NEW_WITH(Token, TOKENLIST_ALLOC_CAPACITY, allocator);
+    }
+}
+
 static void lexer_toklist_push(Lexer* lexer, Token* token) {
-    vec_push(lexer->toklist, token);
+    vec_push_Token(lexer->toklist, token);
 }
 
 void lexer_free(Lexer* lexer) {
     if(SOME(lexer)) {
         vec_free(lexer->toklist);
+        token_arena_free(lexer->tokens);
+        if(SOME(lexer->ring))
+            free(lexer->ring);
+        line_table_free(lexer->lines);
         buff_free(lexer->buffer);
         loc_free(lexer->loc);
         free(lexer);
     }
 }
 
+LineTable* lexer_line_table(Lexer* lexer) {
+    if(NONE(lexer->lines))
+        lexer->lines = line_table_new(lexer->buffer->data, cast(UInt32)lexer->buff_cap);
+    return lexer->lines;
+}
+
+Location lexer_loc(Lexer* lexer, UInt32 offset) {
+    Location loc = line_table_loc(lexer_line_table(lexer), offset);
+    loc.fname = lexer->loc->fname;
+    return loc;
+}
+
 #define lexer_error(err, ...)  (__lexer_error(lexer, (err), __VA_ARGS__))
-// Report an error and exit
+// Report an error and exit (or, if the Lexer has a Diagnostics, report it there and recover - see `lexer_scan()`)
 void __lexer_error(Lexer* lexer, Error err, const char* fmt, ...) {
+    // A speculative error is not necessarily a real one (see `lexer_lex_parallel()`)
+    if(SOME(lexer->on_error))
+        longjmp(*lexer->on_error, 1);
+
     va_list vl;
     va_start(vl, fmt);
-    fprintf(stderr, "%s%s: ", "\033[1;31m", error_str(err));
-    vfprintf(stderr, fmt, vl);
-    fprintf(stderr, " at %s:%d:%d%s\n", lexer->loc->fname->data, lexer->loc->line,lexer->loc->col, "\033[0m");
+    if(SOME(lexer->on_recover)) {
+        UInt32 begin = lexer->token_begin;
+        if(SOME(lexer->diags))
+            diagnostics_vreport(lexer->diags, DiagnosticLevelError, err, lexer_loc(lexer, begin), begin, 
+                                lexer->offset, fmt, vl);
+        va_end(vl);
+        longjmp(*lexer->on_recover, 1);
+    }
+
+    // Printed like any other diagnostic: in one write, with the line it's on
+    Diagnostics* diags = diagnostics_new(1);
+    diagnostics_set_source(diags, lexer->loc->fname->data, lexer->buffer->data, cast(UInt32)lexer->buff_cap);
+    UInt32 begin = lexer->token_begin;
+    diagnostics_vreport(diags, DiagnosticLevelError, err, lexer_loc(lexer, begin), begin, lexer->offset, fmt, vl);
     va_end(vl);
+    diagnostics_print(diags, stderr);
+    diagnostics_free(diags);
     exit(1);
 }
 
@@ -124,7 +218,6 @@ static inline char lexer_advance(Lexer* lexer) {
     if(lexer->offset >= lexer->buff_cap)
         return nullchar;
     
-    LEXER_INCREMENT_COLNO;
     // Do _not_ use `buff_at(lexer->buffer, lexer->offset++)` here
     return lexer->buffer->data[lexer->offset++];
 }
@@ -135,7 +228,6 @@ static inline char lexer_advancen(Lexer* lexer, UInt32 n) {
     if(lexer->offset + n >= lexer->buff_cap)
         return nullchar;
     
-    lexer->loc->col += n;
     lexer->offset += n;
     return lexer->buffer->data[lexer->offset];
 }
@@ -160,80 +252,239 @@ static inline char prevn(Lexer* lexer, UInt32 n) {
 
 // Returns the current element in the Lexical Buffer.
 static inline char peek(Lexer* lexer) {
+    // The padding of a `FileView` reads as `nullchar`
+    if(lexer->is_padded)
+        return lexer->buffer->data[lexer->offset];
     return buff_at(lexer->buffer, lexer->offset);
 }
 
 // "Look ahead" `n` characters in the Lexical buffer.
 // It _does not_ increment the buffer offset.
 static inline char peekn(Lexer* lexer, UInt32 n) {
+    if(lexer->is_padded && n < FILE_VIEW_PADDING)
+        return lexer->buffer->data[lexer->offset + n];
     if(lexer->offset + n >= lexer->buff_cap)
         return nullchar;
     
     return (char)lexer->buffer->data[lexer->offset + n];
 }
 
-static void maketoken(Lexer* lexer, TokenKind kind, Buff* value, UInt32 offset, UInt32 line, UInt32 col) {  
-    LEXER_LOG("Inside maketoken()");
+// Move forward to `offset` in the Lexical buffer (used after a run scanner, see <adorad/compiler/scanner.h>).
+static inline void lexer_skip_to(Lexer* lexer, UInt32 offset) {
+    lexer->offset = offset;
+}
 
-    Token* token = token_init();
-    CORETEN_ENFORCE_NN(token, "Could not allocate memory. Memory full.");
+// Report the invalid UTF-8 byte at `bad`. Lexing resumes at `resume` (where the search for the next one starts)
+static void lexer_bad_utf8_error(Lexer* lexer, UInt32 bad, UInt32 resume) {
+    lexer->bad_utf8 = lexer_find_bad_utf8(lexer, resume);
+    lexer_error(ErrorInvalidCharacter, "Invalid UTF-8 byte `0x%02X` at offset %u", 
+                cast(UInt8)lexer->buffer->data[bad], bad);
+}
 
-    if(!value->data) {
-        value = token_to_buff(kind);
+// Report the invalid UTF-8 (if any) in the token that was just lexed. Only strings and comments can contain any - 
+// everything else stops at the first non-ASCII byte that isn't part of an identifier.
+static inline void lexer_check_utf8(Lexer* lexer) {
+    if(CORETEN_LIKELY(lexer->offset <= lexer->bad_utf8))
+        return;
+    // `bad_utf8` falls behind if part of the buffer was lexed by another Lexer (see `lexer_lex_parallel()`)
+    if(lexer->bad_utf8 < lexer->token_begin)
+        lexer->bad_utf8 = lexer_find_bad_utf8(lexer, lexer->token_begin);
+    if(lexer->bad_utf8 < lexer->offset)
+        lexer_bad_utf8_error(lexer, lexer->bad_utf8, lexer->offset);
+}
 
-        switch(kind) {
-            case STRING:
-            case IDENTIFIER:
-            case INTEGER:
-            case HEX_INT:
-            case BIN_INT:
-            case OCT_INT:
-                WARN("Expected a token value. Got `null`"); break;
-            default: break;
+// Returns the value of the token spanning `len` bytes from `offset` in `data`.
+// The value of a token is its spelling in the source, except for strings (no enclosing quotes - or `r"` of raw
+// strings) and macros (no `@`). Escapes are kept as spelled (see `lexer_string_value()`)
+static inline BuffView token_span_value(char* data, TokenKind kind, UInt32 offset, UInt32 len) {
+    switch(kind) {
+        case STRING: 
+            if(len >= 2)
+                return buffview_new_from_len(data + offset + 1, len - 2);
+            break;
+        case RAW_STRING:
+            if(len >= 3)
+                return buffview_new_from_len(data + offset + 2, len - 3);
+            break;
+        case TRIPLE_STRING:
+            if(len >= 6)
+                return buffview_new_from_len(data + offset + 3, len - 6);
+            break;
+        case MACRO:
+            if(len >= 1)
+                return buffview_new_from_len(data + offset + 1, len - 1);
+            break;
+        default: break;
+    }
+    return buffview_new_from_len(data + offset, len);
+}
+
+BuffView lexer_token_value(Lexer* lexer, CompactToken* token) {
+    return token_span_value(lexer->buffer->data, cast(TokenKind)token->kind, token->offset, token->len);
+}
+
+BuffView lexer_value(Lexer* lexer, Token* token) {
+    return token_span_value(lexer->buffer->data, token->kind, token->offset, token->len);
+}
+
+// The value of the hex digit `ch`
+static inline char lexer_hex_value(char ch) {
+    return cast(char)(CHAR_IS(ch, CHAR_DIGIT) ? ch - '0' : (ch | 0x20) - 'a' + 10);
+}
+
+BuffView lexer_string_value(BuffView value, UInt8 flags, Arena* arena) {
+    if(!(flags & TOKEN_FLAG_HAS_ESCAPES))
+        return value;
+
+    // Unescaping never makes a string longer
+    char* data = cast(char*)arena_alloc(arena, value.len + 1);
+    UInt64 len = 0;
+    for(UInt64 i = 0; i < value.len; i++) {
+        char ch = value.data[i];
+        if(ch != '\\') {
+            data[len++] = ch;
+            continue;
+        }
+        ch = value.data[++i];
+        switch(ch) {
+            case 'a':  ch = '\a'; break;
+            case 'b':  ch = '\b'; break;
+            case 'e':  ch = '\x1b'; break;
+            case 'f':  ch = '\f'; break;
+            case 'n':  ch = '\n'; break;
+            case 'r':  ch = '\r'; break;
+            case 't':  ch = '\t'; break;
+            case 'v':  ch = '\v'; break;
+            case 'x':
+                ch = cast(char)(lexer_hex_value(value.data[i + 1]) << 4 | lexer_hex_value(value.data[i + 2]));
+                i += 2;
+                break;
+            default:
+                // `\0`-`\7`, and the characters that stand for themselves (`\"`, `\'`, `\?` and `\\`)
+                if(CHAR_IS(ch, CHAR_OCT_DIGIT))
+                    ch = cast(char)(ch - '0');
+                break;
         }
+        data[len++] = ch;
     }
+    data[len] = nullchar;
+    return buffview_new_from_len(data, len);
+}
+
+// Push a compact token into `lexer->tokens`
+static inline void lexer_tokens_push(Lexer* lexer, TokenKind kind, UInt32 offset, UInt32 len, UInt8 flags) {
+    TokenArena* arena = lexer->tokens;
+    if(CORETEN_UNLIKELY(arena->len == arena->cap))
+        token_arena_grow(arena, arena->len + 1);
+    
+    CompactToken* token = &arena->data[arena->len++];
+    token->offset = offset;
+    token->len = len;
+    token->fileid = lexer->fileid;
+    token->kind = cast(UInt8)kind;
+    token->flags = flags;
+}
+
+// Push the kind and span of a token into `lexer->kinds`
+static inline void lexer_kinds_push(Lexer* lexer, TokenKind kind, UInt32 offset, UInt32 len) {
+    TokenKinds* kinds = lexer->kinds;
+    if(CORETEN_UNLIKELY(kinds->len == kinds->cap))
+        token_kinds_grow(kinds, kinds->len + 1);
+
+    kinds->kinds[kinds->len] = cast(UInt8)kind;
+    kinds->offsets[kinds->len] = offset;
+    kinds->lens[kinds->len] = len;
+    kinds->len++;
+}
+
+// Whether `kind` is a string literal
+static inline bool lexer_is_string(TokenKind kind) {
+    return kind == STRING || kind == RAW_STRING || kind == TRIPLE_STRING;
+}
+
+// Whether tokens of kind `kind` carry a symbol (see `Token.symbol`)
+static inline bool lexer_is_interned(TokenKind kind) {
+    return kind == IDENTIFIER || lexer_is_string(kind);
+}
 
+// Make a token of kind `kind` spanning `len` bytes from `offset` in the Lexical buffer, with `flags` (see
+// `TOKEN_FLAG_HAS_ESCAPES`)
+static void maketoken_with_flags(Lexer* lexer, TokenKind kind, UInt32 offset, UInt32 len, UInt8 flags) {  
+    LEXER_LOG("Inside maketoken()");
+
+    ++lexer->num_tokens;
+    if(SOME(lexer->kinds)) {
+        lexer_kinds_push(lexer, kind, offset, len);
+        return;
+    }
+    if(lexer->is_compact) {
+        lexer_tokens_push(lexer, kind, offset, len, flags);
+        return;
+    }
+
+    // In streaming mode, the token is made in place (in the ring). Otherwise, it's copied into `toklist`
+    Token tok;
+    Token* token = &tok;
+    if(SOME(lexer->ring))
+        token = &lexer->ring[(lexer->num_tokens - 1) & (LEXER_RING_SIZE - 1)];
+
+    // Nothing is allocated: the value is read from the Lexical buffer when it's needed (see `lexer_value()`)
     token->kind = kind;
     token->offset = offset;
-    token->loc->col = col;
-    token->loc->line = line;
-    buff_set(token->value, value->data);
-    buff_set(token->loc->fname, lexer->loc->fname->data);
-    lexer_toklist_push(lexer, token);
+    token->len = len;
+    token->symbol = SYMBOL_NULL;
+    token->flags = flags;
+    if(SOME(lexer->interner) && lexer_is_interned(kind))
+        token->symbol = interner_intern_view(lexer->interner, token_span_value(lexer->buffer->data, kind, offset, len));
+
+    if(NONE(lexer->ring))
+        lexer_toklist_push(lexer, token);
+}
+
+static inline void maketoken(Lexer* lexer, TokenKind kind, UInt32 offset, UInt32 len) {
+    maketoken_with_flags(lexer, kind, offset, len, 0);
 }
 
 // Scan a comment (single line).
 // We store comments in the lexing phase. The Parser will decide which comments are actually useful and which aren't.
 static inline void lex_sl_comment(Lexer* lexer) {
     LEXER_LOG("Inside lex_sl_comment()");
-    char ch = ADVANCE();
-
-    while(ch != nullchar && ch != '\n') {
-        ch = ADVANCE();
-    }
 
-    CORETEN_ENFORCE(ch == '\n');
-    
-    LEXER_DECREMENT_OFFSET;
+    // Stop right before the newline (`lexer_lex()` handles it)
+    lexer_skip_to(lexer, scan_until(lexer->buffer->data, lexer->offset, lexer->buff_cap, '\n'));
+    lexer_check_utf8(lexer);
+    // Comments are only tokens in kinds-only mode
+    if(SOME(lexer->kinds))
+        maketoken(lexer, COMMENT, lexer->token_begin, lexer->offset - lexer->token_begin);
 }
 
 // Scan a comment (multi-line)
 static inline void lex_ml_comment(Lexer* lexer) {
     LEXER_LOG("Inside lex_ml_comment()");
 
-    char ch = ADVANCE();
-    bool asterisk_found = false; 
-    while(ch && !(ch == '/' && asterisk_found)) {
-        asterisk_found = false; 
-        while(ch && (ch != '*'))
-            ch = ADVANCE();
-        
-        if(ch == '*')
-            asterisk_found = true;
+    char* data = lexer->buffer->data;
+    UInt32 end = lexer->buff_cap;
+    // Skip the opening `*` (the `/` has already been consumed by `lexer_lex()`)
+    UInt32 pos = lexer->offset + 1;
+
+    while(true) {
+        pos = scan_until(data, pos, end, '*');
+        if(pos >= end) {
+            lexer->offset = end;
+            lexer_error(ErrorSyntaxError, "Unterminated comment");
+        }
 
-        ch = ADVANCE();
+        if(pos + 1 < end && data[pos + 1] == '/') {
+            pos += 2;
+            break;
+        }
+        ++pos;
     }
-    ch = ADVANCE();
+
+    lexer->offset = pos;
+    lexer_check_utf8(lexer);
+    if(SOME(lexer->kinds))
+        maketoken(lexer, COMMENT, lexer->token_begin, lexer->offset - lexer->token_begin);
 }
 
 // Scan a character
@@ -243,43 +494,21 @@ static inline void lex_char(Lexer* lexer) {
     char ch = ADVANCE();
     if(ch != nullchar) {
         LEXER_INCREMENT_OFFSET;
-        if(ch == '\n') {
-            LEXER_INCREMENT_LINENO;
-            LEXER_RESET_COLNO;
-        }
     }
 }
 
-// Scan an escape char
-static inline void lex_esc_char(Lexer* lexer) {
-    LEXER_LOG("Inside lex_esc_char()");
-    CORETEN_ENFORCE(false, "TODO");
-    char ch = ADVANCE();
-    if(ch == '\\') {
-        ch = ADVANCE();
-        switch(ch) {
-            case 'a':  ch = '\a'; break;
-            case 'b':  ch = '\b'; break;
-            case 'e':  ch = '\x1b'; break;
-            case 'f':  ch = '\f'; break;
-            case 'n':  ch = '\n'; break;
-            case 'r':  ch = '\r'; break;
-            case 't':  ch = '\t'; break;
-            case 'v':  ch = '\f'; break;
-            case '"':  ch = '\"'; break;
-            case '\'': ch = '\''; break;
-            case '?':  ch = '?';  break;
-            case '1':  ch = '\1'; break;
-            case '2':  ch = '\2'; break;
-            case '3':  ch = '\3'; break;
-            case '4':  ch = '\4'; break;
-            case '5':  ch = '\5'; break;
-            case '6':  ch = '\6'; break;
-            case '7':  ch = '\7'; break;
-            case '\\': ch = '\\'; break;
-            default:
-                lexer_error(ErrorInvalidCharacter, "\\%c", ch);
-        }
+// Returns the length of the escape sequence at `pos` in `data` (a backslash), or 0 if it isn't a valid one.
+// See `lexer_string_value()` for what they stand for
+static inline UInt32 lex_esc_char(const char* data, UInt32 pos) {
+    switch(data[pos + 1]) {
+        case 'a': case 'b': case 'e': case 'f': case 'n': case 'r': case 't': case 'v':
+        case '"': case '\'': case '?': case '\\':
+        case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+            return 2;
+        case 'x':
+            return CHAR_IS(data[pos + 2], CHAR_HEX_DIGIT) && CHAR_IS(data[pos + 3], CHAR_HEX_DIGIT) ? 4 : 0;
+        default:
+            return 0;
     }
 }
 
@@ -287,310 +516,342 @@ static inline void lex_esc_char(Lexer* lexer) {
 static inline void lex_macro(Lexer* lexer) {
     LEXER_LOG("Inside lex_macro()");
 
-    char ch = ADVANCE();
-    int macro_length = 0;
+    // The `@` has already been consumed by `lexer_lex()`
+    UInt32 begin = lexer->offset - 1;
 
-    // Don't include the `@` in the macro symbol name
-    UInt32 prev_offset = lexer->offset;
-    UInt32 line = lexer->loc->line;
-    UInt32 col = lexer->loc->col;
-
-    while(char_is_letter(ch) || char_is_digit(ch)) {
-        ch = ADVANCE();
-        ++macro_length;
-    }
+    while(CHAR_IS(peek(lexer), CHAR_IDENT))
+        ADVANCE();
 
+    // Don't include the `@` in the macro symbol name
+    UInt32 macro_length = lexer->offset - begin - 1;
     if(macro_length > MAX_TOKEN_LENGTH)
-        WARN("A number can never have more than 256 characters");
-
-    UInt32 offset_diff = lexer->offset - prev_offset;
-
-    Buff* macro_value = buff_slice(lexer->buffer, prev_offset - 1, offset_diff);
-    CORETEN_ENFORCE_NN(macro_value, "`macro_value` must not be null");
-    maketoken(lexer, MACRO, macro_value, prev_offset - 1, line, col - 1);
+        WARN("A macro can never have more than 256 characters");
 
-    LEXER_DECREMENT_OFFSET;
+    maketoken(lexer, MACRO, begin, macro_length + 1);
 }
 
-// Scan a string
-static inline void lex_string(Lexer* lexer) {
+// Scan a string (`"..."`, or `"""..."""` if `is_triple`).
+// Its body is searched for the closing quote or the next backslash (see `scan_until2()`) - escapes are checked here,
+// but only unescaped when asked for (see `lexer_string_value()`), so the token just records whether it has any
+static inline void lex_string(Lexer* lexer, bool is_triple) {
     LEXER_LOG("Inside lex_string()");
 
-    // We already know that the curr char is _not_ a quote (`"`) since an empty string token (`""`) is
-    // handled by `lexer_lex()`
-    CORETEN_ENFORCE(LEXER_CURR_CHAR != '"');
-    char ch = ADVANCE();
-    int str_length = 0;
-    UInt32 prev_offset = lexer->offset - 1;
-    UInt32 line = lexer->loc->line;
-    UInt32 col = lexer->loc->col;
+    // The opening quote(s) have already been consumed by `lexer_lex()`
+    UInt32 begin = lexer->offset - (is_triple ? 3 : 1);
     lexer->is_inside_str = true;
 
-    while(ch != '"') {
-        if(ch == '\\') {
-            // lexer_lex_esc_char(lexer);
-            ch = ADVANCE();
+    char* data = lexer->buffer->data;
+    UInt32 end = lexer->buff_cap;
+    UInt32 pos = lexer->offset;
+    UInt32 bad_escape = UInt32_MAX;
+    UInt8 flags = 0;
+    while(true) {
+        pos = scan_until2(data, pos, end, '"', '\\');
+        if(pos >= end) {
+            lexer_skip_to(lexer, end);
+            lexer_error(ErrorSyntaxError, "Unterminated string literal");
+        }
+        
+        if(data[pos] == '\\') {
+            UInt32 len = lex_esc_char(data, pos);
+            if(CORETEN_UNLIKELY(len == 0) && bad_escape == UInt32_MAX)
+                bad_escape = pos;
+            flags |= TOKEN_FLAG_HAS_ESCAPES;
+            pos += len > 0 ? len : 2;
+        } else if(!is_triple || (data[pos + 1] == '"' && data[pos + 2] == '"')) {
+            break;
         } else {
-            ch = ADVANCE();
+            ++pos;
         }
-        ++str_length;
     }
     lexer->is_inside_str = false;
 
-    CORETEN_ENFORCE(ch == '"');
-    UInt32 offset_diff = lexer->offset - prev_offset;
+    // Account for the closing quote(s)
+    lexer_skip_to(lexer, pos + (is_triple ? 3 : 1));
+    // The whole string is the bad token (rather than lexing the rest of it as code)
+    if(CORETEN_UNLIKELY(bad_escape != UInt32_MAX))
+        lexer_error(ErrorInvalidCharacter, "Invalid escape sequence `\\%c`", data[bad_escape + 1]);
+    lexer_check_utf8(lexer);
+    // The span includes the quotes
+    maketoken_with_flags(lexer, is_triple ? TRIPLE_STRING : STRING, begin, lexer->offset - begin, flags);
+}
+
+// Scan a raw string (`r"..."`), which has no escapes: it ends at the first quote
+static inline void lex_raw_string(Lexer* lexer) {
+    LEXER_LOG("Inside lex_raw_string()");
+
+    // The `r` has already been consumed by `lexer_lex()`
+    UInt32 begin = lexer->offset - 1;
+    lexer->is_inside_str = true;
+    UInt32 pos = scan_until(lexer->buffer->data, lexer->offset + 1, lexer->buff_cap, '"');
+    if(pos >= lexer->buff_cap) {
+        lexer_skip_to(lexer, lexer->buff_cap);
+        lexer_error(ErrorSyntaxError, "Unterminated string literal");
+    }
+    lexer->is_inside_str = false;
 
-    // `offset_diff - 1` so as to ignore the closing quote `"`
-    Buff* str_value = buff_slice(lexer->buffer, prev_offset, offset_diff - 1);
-    CORETEN_ENFORCE_NN(str_value, "`str_value` must not be null");
-    maketoken(lexer, STRING, str_value, prev_offset - 1, line, col - 1);
+    lexer_skip_to(lexer, pos + 1);
+    lexer_check_utf8(lexer);
+    maketoken(lexer, RAW_STRING, begin, lexer->offset - begin);
 }
 
 // Returns whether `value` is a keyword or an identifier
-static inline TokenKind is_keyword_or_identifier(char* value) {
-    // Search `tokenHash` for a match for `value`. 
+static inline TokenKind is_keyword_or_identifier(BuffView value) {
+    // Look up `value` in the (generated) perfect hash table of keywords. Since the hash is collision-free, a single
+    // compare against the candidate's spelling tells us whether we have a match.
     // If we can't find one, we assume an identifier
-    for(TokenKind tokenkind = TOK___KEYWORDS_BEGIN + 1; tokenkind < TOK___KEYWORDS_END; tokenkind++)
-        if(strcmp(tokenHash[tokenkind], value) == 0)
+    if(value.len < KEYWORD_MIN_LENGTH || value.len > KEYWORD_MAX_LENGTH)
+        return IDENTIFIER;
+
+    TokenKind tokenkind = keywordTable[keyword_hash(value.data, value.len)];
+    if(tokenkind != TOK_NULL) {
+        const char* kwd = tokenHash[tokenkind];
+        if(strncmp(kwd, value.data, value.len) == 0 && kwd[value.len] == nullchar)
             return tokenkind; // Found a match
+    }
 
     // If we're still here, we haven't found a keyword match
     return IDENTIFIER;
 }
 
+// Make the identifier (or keyword) token spanning from `begin` to the current offset
+static inline void lexer_make_identifier(Lexer* lexer, UInt32 begin) {
+    UInt32 ident_length = lexer->offset - begin;
+    if(ident_length > MAX_TOKEN_LENGTH)
+        WARN("An identifier can never have more than 256 characters");
+
+    // Determine if a keyword or just a regular identifier
+    BuffView ident_value = buffview_new_from_len(lexer->buffer->data + begin, ident_length);
+    TokenKind tokenkind = is_keyword_or_identifier(ident_value);
+    maketoken(lexer, tokenkind, begin, ident_length);
+}
+
+// Skip over the rest of an identifier from `pos`, which may have non-ASCII characters (see 
+// `unicode_is_ident_continue()`) in it. Runs of ASCII are still skipped by `scan_identifier()`
+static UInt32 lexer_scan_unicode_identifier(Lexer* lexer, UInt32 pos) {
+    const char* data = lexer->buffer->data;
+    UInt32 end = cast(UInt32)lexer->buff_cap;
+    for(;;) {
+        pos = scan_identifier(data, pos, end);
+        if(pos >= end || cast(UInt8)data[pos] < 0x80)
+            return pos;
+        Rune rune;
+        UInt32 nbytes = utf8_decode(data + pos, end - pos, &rune);
+        if(nbytes == 0 || !unicode_is_ident_continue(rune))
+            return pos;
+        pos += nbytes;
+    }
+}
+
 // Scan an identifier
 static inline void lex_identifier(Lexer* lexer) {
     LEXER_LOG("Inside lex_identifier()");
 
-    // When this function is called, we alread know that the first character statisfies the `case ALPHA`.
-    // So, the remaining characters are ALPHA, DIGIT, or `_`
+    // When this function is called, we alread know that the first character is a CHAR_IDENT_START.
+    // So, the remaining characters are CHAR_IDENTs.
     // Still, we check it either way to ensure sanity.
-    CORETEN_ENFORCE(char_is_letter(prev(lexer)) || char_is_digit(prev(lexer)),
+    CORETEN_ENFORCE(CHAR_IS(prev(lexer), CHAR_IDENT_START),
                "This message means you've encountered a serious bug within Adorad. Please file an issue on "
                "Adorad's Github repo.\nError: `lex_identifier()` hasn't been called with a valid identifier character");
 
-    UInt32 prev_offset = lexer->offset;
-    UInt32 line = lexer->loc->line;
-    UInt32 col = lexer->loc->col;
-    int ident_length = 0;
-    char ch = ADVANCE();
-
-    while(char_is_letter(ch) || char_is_digit(ch)) {
-        ch = ADVANCE();
-        ++ident_length;
-    }
+    UInt32 begin = lexer->offset - 1;
 
-    if(ident_length > MAX_TOKEN_LENGTH)
-        WARN("An identifier can never have more than 256 characters");
-
-    UInt32 offset_diff = lexer->offset - prev_offset;
-    Buff* ident_value = buff_slice(lexer->buffer, prev_offset - 1, offset_diff);
-    CORETEN_ENFORCE_NN(ident_value, "`ident_value` must not be null");
+    if(CORETEN_LIKELY(lexer->is_ascii))
+        lexer_skip_to(lexer, scan_identifier(lexer->buffer->data, lexer->offset, lexer->buff_cap));
+    else
+        lexer_skip_to(lexer, lexer_scan_unicode_identifier(lexer, lexer->offset));
+    lexer_make_identifier(lexer, begin);
+}
 
-    // Determine if a keyword or just a regular identifier
-    TokenKind tokenkind = is_keyword_or_identifier(ident_value->data);
-    maketoken(lexer, tokenkind, ident_value, prev_offset - 1, line, col - 1);
+// Scan an identifier that begins with a non-ASCII character
+static void lex_unicode_identifier(Lexer* lexer) {
+    LEXER_LOG("Inside lex_unicode_identifier()");
+
+    // The first byte has already been consumed by `lexer_lex()`
+    UInt32 begin = lexer->offset - 1;
+    Rune rune;
+    UInt32 nbytes = utf8_decode(lexer->buffer->data + begin, lexer->buff_cap - begin, &rune);
+    if(nbytes == 0)
+        lexer_bad_utf8_error(lexer, begin, begin + 1);
+    if(!unicode_is_ident_start(rune)) {
+        lexer_skip_to(lexer, begin + nbytes);
+        lexer_error(ErrorInvalidCharacter, "Invalid character `%.*s` (U+%04X)", nbytes, lexer->buffer->data + begin, 
+                    rune);
+    }
 
-    LEXER_DECREMENT_OFFSET;
+    lexer_skip_to(lexer, lexer_scan_unicode_identifier(lexer, begin + nbytes));
+    lexer_make_identifier(lexer, begin);
 }
 
 // Attributes
 // Eg. [inline] or [comptime]
-static inline void lex_attribute(Lexer* lexer) {
+// Returns false (without consuming anything) if the `[` doesn't begin an attribute. In this case, the `[` is just a 
+// regular LSQUAREBRACK (eg. `foo[bar]`)
+static inline bool lex_attribute(Lexer* lexer) {
     LEXER_LOG("Inside lex_attribute()");
 
-    UInt32 prev_offset = lexer->offset;
-    UInt32 line = lexer->loc->line;
-    UInt32 col = lexer->loc->col;
-    int attr_length = 0;
+    // The `[` has already been consumed by `lexer_lex()`
+    UInt32 begin = lexer->offset - 1;
 
-    // Skip whitespace
-    while(LEXER_CURR_CHAR == ' ')
-        ADVANCE();
+    UInt32 name_length = 0;
+    char ch = peek(lexer);
+    while(CHAR_IS(ch, CHAR_IDENT))
+        ch = peekn(lexer, ++name_length);
     
-    char ch;
-    switch(LEXER_CURR_CHAR) {
-        // Possible attribute text
-        case ALPHA:
-            ch = ADVANCE();
-            while(char_is_letter(ch) || char_is_digit(ch)) {
-                ch = ADVANCE();
-                ++attr_length;
-            }
-
-            UInt32 offset_diff = lexer->offset - prev_offset;
-            Buff* attr_value = buff_slice(lexer->buffer, prev_offset - 1, offset_diff);
-            CORETEN_ENFORCE_NN(attr_value, "`attr_value` must not be null");
+    if(ch != ']')
+        return false;
+
+    // Determine what kind of attribute this is (`tokenHash` stores attributes along with their `[]`):
+    char* name = lexer->buffer->data + lexer->offset;
+    TokenKind kind = TOK_NULL;
+    for(TokenKind i = TOK___ATTRIBUTES_BEGIN + 1; i < TOK___ATTRIBUTES_END; i++) {
+        const char* attr = tokenHash[i];
+        if(strncmp(attr + 1, name, name_length) == 0 && attr[name_length + 1] == ']' && 
+           attr[name_length + 2] == nullchar) {
+            kind = i;
+            break;
+        }
+    }
 
-            // Determine what kind of attribute this is:
-            TokenKind kind = TOK_NULL;
-            for(TokenKind i = TOK___ATTRIBUTES_BEGIN; i < TOK___ATTRIBUTES_END; i++) {
-                if(strcmp(attr_value->data, tokenHash[i]) == 0) {
-                    kind = i;
-                    break;
-                }
-            }
+    if(kind == TOK_NULL)
+        return false;
+    
+    // Account for the closing `]`
+    lexer->offset += name_length + 1;
+    maketoken(lexer, kind, begin, lexer->offset - begin);
+    return true;
+}
 
-            CORETEN_ENFORCE(kind != TOK_NULL, "Compiler error. Expected `kind` to be an attribute");
-            
-            maketoken(lexer, kind, attr_value, prev_offset - 1, line, col - 1);
+// Returns the character at `offset` in the Lexical buffer (`nullchar` past its end).
+// This is non-destructive --> the buffer offset is not updated.
+static inline char lexer_char_at(Lexer* lexer, UInt32 offset) {
+    if(offset >= lexer->buff_cap)
+        return nullchar;
+    return lexer->buffer->data[offset];
+}
 
-            LEXER_DECREMENT_OFFSET;
-            break;
-        default:
-            lexer_error(ErrorSyntaxError, "Expected an attribute"); break;
-    }
+// Skip the rest of a malformed number at `pos` (so that it's reported, and replaced with TOK_ILLEGAL, as a whole)
+static inline void lex_digit_skip_malformed(Lexer* lexer, UInt32 pos) {
+    while(CHAR_IS(lexer_char_at(lexer, pos), CHAR_IDENT))
+        ++pos;
+    lexer->offset = pos;
 }
 
 // Numeric lexing! Finally, the feast can start.
+//      Decimal     [0-9][0-9_]*
+//      Hexadecimal ("0x"|"0X")[0-9A-Fa-f_]+
+//      Octal       ("0o"|"0O")[0-7_]+
+//      Binary      ("0b"|"0B")[01_]+
+//      Float       [0-9][0-9_]* ("." [0-9][0-9_]*)? ([eE] [+-]? [0-9][0-9_]*)?  (with a fraction and/or an exponent)
+//                  or "." [0-9][0-9_]* ([eE] [+-]? [0-9][0-9_]*)?
+// A `.` is only part of a number if a digit follows it, so that ranges (`0..10`) still lex.
+// The number is only checked here: its value is converted by the Parser (see <adorad/compiler/number.h>)
 static inline void lex_digit(Lexer* lexer) {
     LEXER_LOG("Inside lex_digit()");
-    // 0x... --> Hexadecimal ("0x"|"0X")[0-9A-Fa-f_]+
-    // 0o... --> Octal       ("0o"|"0O")[0-7_]+
-    // 0b... --> Binary      ("0b"|"0B")[01_]+
-    // This cannot be `lexer_advance(lexer)` because we enter here from `lexer_lex()` where we already
-    // know that the first char is a digit value. 
-    // This value needs to be captured as well in `token->value`
-    char ch = prev(lexer);
-    UInt32 prev_offset = lexer->offset - 1;
-    UInt32 line = lexer->loc->line;
-    UInt32 col = lexer->loc->col - 1;
-    TokenKind tokenkind = TOK_ILLEGAL;
-    int digit_length = 0; // no. of digits in the number
-
-    CORETEN_ENFORCE(char_is_digit(ch));
-    while(char_is_digit(ch)) {
-        // Hex, Octal, or Binary?
-        if(ch == '0') {
-            ch = ADVANCE();
-            switch(ch) {
-                // Hex
-                case 'x': case 'X':;
-                    // Skip [xX]
-                    ch = ADVANCE();
-                    int hexcount = 0;
-                    while(char_is_hex_digit(ch)) {
-                        ++hexcount; 
-                        ch = ADVANCE();
-                    }
-                    if(hexcount == 0)
-                        lexer_error(ErrorSyntaxError, "Expected hexadecimal digits [0-9A-Fa-f] after `0x`");
-                    
-                    tokenkind = HEX_INT;
-                    digit_length = hexcount + 1; // Account for the '0'
-                    break;
-                // Binary
-                case 'b': case 'B':
-                    // Skip [bB]
-                    ch = ADVANCE();
-                    int bincount = 0;
-                    while(char_is_binary_digit(ch)) {
-                        ++bincount; 
-                        ch = ADVANCE();
-                    }
-                    if(bincount == 0)
-                        lexer_error(ErrorSyntaxError, "Expected binary digit [0-1] after `0b`");
-                    
-                    tokenkind = BIN_INT;
-                    digit_length = bincount + 1; // Account for the '0'
-                    break;
-                // Octal
-                // Depart from the (error-prone) C-style octals with an inital zero e.g 0123
-                // Instead, we support the `0o` or `0O` prefix, like 0o123
-                case 'o': case 'O':
-                    // Skip [oO]
-                    ch = ADVANCE();
-                    int octcount = 0;
-                    while(char_is_octal_digit(ch)) {
-                        ++octcount; 
-                        ch = ADVANCE();
-                    }
-                    if(octcount == 0)
-                        lexer_error(ErrorSyntaxError, "Expected octal digits [0-7] after `0o`");
-                    
-                    tokenkind = OCT_INT;
-                    digit_length = octcount + 1; // Account for the '0'
-                    break;
-                case ALPHA_EXCEPT_B_O_X:
-                    // Error
-                    lexer_error(ErrorSyntaxError, "Invalid character `%c`. Adorad currently supports [xXbBoO] after `0`", ch);
-                    break;
-                default:
-                    // An integer?
-                    // lexer_error(ErrorSyntaxError, "Cannot have an integer beginning with `0`");     
-                    break;               
-            } // switch(ch)
+    // We enter here from `lexer_scan_tokens()` where the first character (a digit, or a `.` followed by one) has 
+    // already been consumed. It needs to be captured as well in the token's value
+    UInt32 begin = lexer->offset - 1;
+    UInt32 pos = begin;
+    TokenKind tokenkind = INTEGER;
+    char ch = lexer_char_at(lexer, pos);
+
+    // Hex, Octal, or Binary?
+    // Depart from the (error-prone) C-style octals with an inital zero e.g 0123
+    // Instead, we support the `0o` or `0O` prefix, like 0o123
+    if(ch == '0') {
+        UInt8 digit_class = 0;
+        const char* expected = null;
+        switch(lexer_char_at(lexer, pos + 1)) {
+            case 'x': case 'X':
+                tokenkind = HEX_INT; digit_class = CHAR_HEX_DIGIT; 
+                expected = "hexadecimal digits [0-9A-Fa-f] after `0x`"; 
+                break;
+            case 'b': case 'B':
+                tokenkind = BIN_INT; digit_class = CHAR_BIN_DIGIT; 
+                expected = "binary digits [0-1] after `0b`"; 
+                break;
+            case 'o': case 'O':
+                tokenkind = OCT_INT; digit_class = CHAR_OCT_DIGIT; 
+                expected = "octal digits [0-7] after `0o`"; 
+                break;
+            default: break;
         }
-        // Fractions, or Integer?
-        else {
-            // Normal Floats
-            if(ch == '.' || ch == '_') {
-                ch = ADVANCE();
-                if(ch == '_')
-                    lexer_error(ErrorSyntaxError, "Unexpected `_` near `.`");
-            }
-            
-            // Exponents (Float)
-            else if(ch == 'e' || ch == 'E') {
-                // Skip over [eE]
-                ch = ADVANCE();
-                if(ch == '+' || ch == '-') { 
-                    ch = ADVANCE();
-                } else {
-                    lexer_error(ErrorSyntaxError, "Expected [+-] after exponent `e`. Got `%c`", ch);
-                }
-                
-                int exp_digits = 0;
-                while(char_is_digit(ch)) {
-                    ch = ADVANCE();
-                    ++exp_digits;
-                }
-                if(exp_digits == 0)
-                    lexer_error(ErrorSyntaxError, "Invalid character after exponent `e`. Expected a digit, got `%c`", ch);
-                
-                // (TODO) Verify this is correct
-                digit_length = exp_digits + 1; // Account for the prev digit
+
+        if(digit_class != 0) {
+            pos += 2;
+            UInt32 num_digits = 0;
+            for(;; pos++) {
+                ch = lexer_char_at(lexer, pos);
+                if(CHAR_IS(ch, digit_class))
+                    ++num_digits;
+                else if(ch != '_')
+                    break;
             }
-            // Imaginary
-            else if(ch == 'j' || ch == 'J') {
-                // digit_length = imag_count;
+            if(num_digits == 0) {
+                lex_digit_skip_malformed(lexer, pos);
+                lexer_error(ErrorSyntaxError, "Expected %s", expected);
             }
+            goto lex_digit_end;
         }
-        // ch = ADVANCE();
     }
 
-    // CORETEN_ENFORCE(tokenkind != TOK_ILLEGAL);
+    // Integer part
+    while(CHAR_IS(ch, CHAR_DIGIT) || ch == '_')
+        ch = lexer_char_at(lexer, ++pos);
 
-    int offset_diff = cast(int)(lexer->offset - prev_offset);
-    CORETEN_ENFORCE(offset_diff != 0);
+    // Fraction
+    if(ch == '.' && CHAR_IS(lexer_char_at(lexer, pos + 1), CHAR_DIGIT)) {
+        tokenkind = FLOAT_LIT;
+        ch = lexer_char_at(lexer, ++pos);
+        while(CHAR_IS(ch, CHAR_DIGIT) || ch == '_')
+            ch = lexer_char_at(lexer, ++pos);
+    }
 
-    if(digit_length > MAX_TOKEN_LENGTH)
-        WARN("A number can never have more than 256 characters");
+    // Exponent
+    if(ch == 'e' || ch == 'E') {
+        tokenkind = FLOAT_LIT;
+        ch = lexer_char_at(lexer, ++pos);
+        if(ch == '+' || ch == '-')
+            ch = lexer_char_at(lexer, ++pos);
+        if(!CHAR_IS(ch, CHAR_DIGIT)) {
+            lex_digit_skip_malformed(lexer, pos);
+            lexer_error(ErrorSyntaxError, "Invalid character after exponent `e`. Expected a digit, got `%c`", ch);
+        }
+        while(CHAR_IS(ch, CHAR_DIGIT) || ch == '_')
+            ch = lexer_char_at(lexer, ++pos);
+    }
 
-    // digit_length can be 0 and we can still have a number. Reasoning is as follows:
-    // This function is guaranteed to be called when there's at least one "number-like". We simply check if
-    // there are more digits to lex.
-    // If digit_length = 0, this means that there's only one digit in the number (eg. 0, 2, 9)
-    Buff* digit_value = buff_slice(lexer->buffer, prev_offset, offset_diff - 1);
-    CORETEN_ENFORCE_NN(digit_value, "`digit_value` must not be null");
-    if(!digit_value)
-        printf("digit_value = null\n");
-    maketoken(lexer, tokenkind, digit_value, prev_offset, line, col);
+lex_digit_end:
+    // A number can't run into an identifier (eg. `12ab` or `0b102`)
+    if(CHAR_IS(ch, CHAR_IDENT_START | CHAR_DIGIT)) {
+        lex_digit_skip_malformed(lexer, pos);
+        lexer_error(ErrorSyntaxError, "Invalid character `%c` in a number", ch);
+    }
 
-    LEXER_DECREMENT_OFFSET;
+    if(pos - begin > MAX_TOKEN_LENGTH)
+        WARN("A number can never have more than 256 characters");
+
+    lexer->offset = pos;
+    maketoken(lexer, tokenkind, begin, pos - begin);
 }
 
-// Lex the Source files
-void lexer_lex(Lexer* lexer) {
-    // Some UTF8 text may start with a 3-byte 'BOM' marker sequence. If it exists, skip over them because they 
-    // are useless bytes. Generally, it is not recommended to add BOM markers to UTF8 texts, but it's not 
-    // uncommon (especially on Windows).
+// Some UTF8 text may start with a 3-byte 'BOM' marker sequence. If it exists, skip over them because they 
+// are useless bytes. Generally, it is not recommended to add BOM markers to UTF8 texts, but it's not 
+// uncommon (especially on Windows).
+static inline void lexer_skip_bom(Lexer* lexer) {
     if(lexer->buffer->data[0] == (char)0xef && lexer->buffer->data[1] == (char)0xbb && lexer->buffer->data[2] == (char)0xbf)
         ADVANCEN(3);
+}
 
+// Scan the Lexical buffer, making tokens as we go.
+// If `single` is set, this returns as soon as a token has been made.
+// Returns false once the TOK_EOF token has been made.
+static bool lexer_scan_tokens(Lexer* lexer, bool single) {
+    UInt64 num_tokens = lexer->num_tokens;
     char next = nullchar;
     char curr = nullchar;
     TokenKind tokenkind = TOK_ILLEGAL;
+    UInt32 begin = 0;
 
     while(true) {
         // `ADVANCE()` returns the current character and moves forward, and `peek()` returns the current
@@ -598,212 +859,582 @@ void lexer_lex(Lexer* lexer) {
         // For example, if we start from buff[0], 
         //      curr = buff[0]
         //      next = buff[1]
+        begin = lexer->offset;
+        if(CORETEN_UNLIKELY(begin >= lexer->scan_end))
+            return true;
+        lexer->token_begin = begin;
         curr = ADVANCE();
         next = peek(lexer);
         tokenkind = TOK_ILLEGAL;
 
-        switch(curr) {
-            case nullchar: goto lex_eof;
-            // NB: Whitespace as a token is useless for our case (will this change later?)
-            case WHITESPACE_NO_NEWLINE: tokenkind = TOK_NULL; break;
-            case '\n':
-                LEXER_INCREMENT_LINENO;
-                LEXER_RESET_COLNO;
-                tokenkind = TOK_NULL;
-                break;
-            // Identifier
-            case ALPHA: case '_': tokenkind = TOK_NULL; lex_identifier(lexer); break;
-            case DIGIT: tokenkind = TOK_NULL; lex_digit(lexer); break;
-            case '"':
-                switch(next) {
-                    // Empty String literal 
-                    case '"': LEXER_INCREMENT_OFFSET; maketoken(lexer, STRING, BUFF_NEW("\"\""), lexer->offset - 1, 
-                                                                lexer->loc->line, lexer->loc->col - 1); 
-                              break;
-                    default: tokenkind = TOK_NULL; lex_string(lexer); break;
-                }
-                break;
-            case ';':  tokenkind = SEMICOLON; break;
-            case ',':  tokenkind = COMMA; break;
-            case '\\': tokenkind = BACKSLASH; break;
-            case '[':  
-                // We check for func/var attributes enclosed in `[` and `]`. 
-                // Eg. [inline] or [comptime]
-                // TODO(jasmcaus) Whitespace between `[` and an identifier token needs to be handled appropriately
-                // (whitespace needs to be skipped)
-                switch(next) {
-                    case ALPHA: tokenkind = TOK_NULL; lex_attribute(lexer); break;
-                    default: tokenkind = LSQUAREBRACK; break;
-                }
-                break;
-            case ']':  tokenkind = RSQUAREBRACK; break;
-            case '{':  lexer->nest_level++; tokenkind = LBRACE; break;
-            case '}':  lexer->nest_level--; tokenkind = RBRACE; break;
-            case '(':  tokenkind = LPAREN; break;
-            case ')':  tokenkind = RPAREN; break;
-            case '=':
-                switch(next) {
-                    case '=': LEXER_INCREMENT_OFFSET; tokenkind = EQUALS_EQUALS; break;
-                    case '>': LEXER_INCREMENT_OFFSET; tokenkind = EQUALS_ARROW; break;
-                    default: tokenkind = EQUALS; break;
-                }
-                break;
-            case '+':
-                switch(next) {
-                    // This might be removed at some point. 
-                    // '++' serves no purpose since Adorad doesn't (and won't) support pointer arithmetic.
-                    case '+': LEXER_INCREMENT_OFFSET; tokenkind = PLUS_PLUS; break;
-                    case '=': LEXER_INCREMENT_OFFSET; tokenkind  = PLUS_EQUALS; break;
-                    default: tokenkind = PLUS; break;
-                }
-                break;
-            case '-':
-                switch(next) {
-                    // This might be removed at some point. 
-                    // '--' serves no purpose since Adorad doesn't (and won't) support pointer arithmetic.
-                    case '-': LEXER_INCREMENT_OFFSET; tokenkind = MINUS_MINUS; break;
-                    case '=': LEXER_INCREMENT_OFFSET; tokenkind = MINUS_EQUALS; break;
-                    case '>': LEXER_INCREMENT_OFFSET; tokenkind = RARROW; break;
-                    default: tokenkind = MINUS; break;
-                } 
-                break;
-            case '*':
-                switch(next) {
-                    case '*': LEXER_INCREMENT_OFFSET; tokenkind = MULT_MULT; break;
-                    case '=': LEXER_INCREMENT_OFFSET; tokenkind = MULT_EQUALS; break;
-                    default: tokenkind = MULT; break;
-                }
-                break;
-            case '/':
-                switch(next) {
-                    // Add tokenkind here? 
-                    // (TODO) jasmcaus
-                    case '/': tokenkind = TOK_NULL; lex_sl_comment(lexer); break;
-                    case '*': tokenkind = TOK_NULL; lex_ml_comment(lexer); break;
-                    case '=': LEXER_INCREMENT_OFFSET; tokenkind = SLASH_EQUALS; break;
-                    default: tokenkind = SLASH; break;
-                }
-                break;
-            case '#': 
-                // Ignore shebang on the first line
-                if(lexer->loc->line == 1 && next == '!' && peekn(lexer, 1) == '/') {
+        // Identifiers, numbers and whitespace (the bulk of any source) are dispatched on their character class, with
+        // a single table lookup. Everything else is punctuation, which is handled by the switch below.
+        UInt8 cls = CHAR_CLASS(curr);
+        if(cls & (CHAR_IDENT_START | CHAR_BLANK | CHAR_DIGIT)) {
+            tokenkind = TOK_NULL;
+            if(cls & CHAR_IDENT_START) {
+                if(CORETEN_UNLIKELY(next == '"') && curr == 'r')
+                    lex_raw_string(lexer);
+                else
+                    lex_identifier(lexer);
+            }
+            else if(cls & CHAR_BLANK)
+                // NB: Whitespace as a token is useless for our case (will this change later?)
+                lexer_skip_to(lexer, scan_blanks(lexer->buffer->data, lexer->offset, lexer->buff_cap));
+            else
+                lex_digit(lexer);
+        } else {
+            switch(curr) {
+                case nullchar: goto lex_eof;
+                case '\n': tokenkind = TOK_NULL; break;
+                case '"':
                     tokenkind = TOK_NULL;
-                    // Skip till end of line
-                    while(LEXER_CURR_CHAR && (LEXER_CURR_CHAR != '\n' || LEXER_CURR_CHAR != nullchar))
-                        curr = ADVANCE();
-                }
-                // Comment
-                else {
+                    if(next != '"') {
+                        lex_string(lexer, false);
+                    } else if(lexer->buffer->data[lexer->offset + 1] == '"') {
+                        // Triple-quoted string literal
+                        lexer_skip_to(lexer, lexer->offset + 2);
+                        lex_string(lexer, true);
+                    } else {
+                        // Empty String literal
+                        LEXER_INCREMENT_OFFSET;
+                        tokenkind = STRING;
+                    }
+                    break;
+                case ';':  tokenkind = SEMICOLON; break;
+                case ',':  tokenkind = COMMA; break;
+                case '\\': tokenkind = BACKSLASH; break;
+                case '[':  
+                    // We check for func/var attributes enclosed in `[` and `]`. 
+                    // Eg. [inline] or [comptime]
+                    // TODO(jasmcaus) Whitespace between `[` and an identifier token needs to be handled appropriately
+                    // (whitespace needs to be skipped)
+                    if(CHAR_IS(next, CHAR_ALPHA))
+                        tokenkind = lex_attribute(lexer) ? TOK_NULL : LSQUAREBRACK;
+                    else
+                        tokenkind = LSQUAREBRACK;
+                    break;
+                case ']':  tokenkind = RSQUAREBRACK; break;
+                case '{':  lexer->nest_level++; tokenkind = LBRACE; break;
+                case '}':  lexer->nest_level--; tokenkind = RBRACE; break;
+                case '(':  tokenkind = LPAREN; break;
+                case ')':  tokenkind = RPAREN; break;
+                case '=':
+                    switch(next) {
+                        case '=': LEXER_INCREMENT_OFFSET; tokenkind = EQUALS_EQUALS; break;
+                        case '>': LEXER_INCREMENT_OFFSET; tokenkind = EQUALS_ARROW; break;
+                        default: tokenkind = EQUALS; break;
+                    }
+                    break;
+                case '+':
+                    switch(next) {
+                        // This might be removed at some point. 
+                        // '++' serves no purpose since Adorad doesn't (and won't) support pointer arithmetic.
+                        case '+': LEXER_INCREMENT_OFFSET; tokenkind = PLUS_PLUS; break;
+                        case '=': LEXER_INCREMENT_OFFSET; tokenkind  = PLUS_EQUALS; break;
+                        default: tokenkind = PLUS; break;
+                    }
+                    break;
+                case '-':
+                    switch(next) {
+                        // This might be removed at some point. 
+                        // '--' serves no purpose since Adorad doesn't (and won't) support pointer arithmetic.
+                        case '-': LEXER_INCREMENT_OFFSET; tokenkind = MINUS_MINUS; break;
+                        case '=': LEXER_INCREMENT_OFFSET; tokenkind = MINUS_EQUALS; break;
+                        case '>': LEXER_INCREMENT_OFFSET; tokenkind = RARROW; break;
+                        default: tokenkind = MINUS; break;
+                    } 
+                    break;
+                case '*':
+                    switch(next) {
+                        case '*': LEXER_INCREMENT_OFFSET; tokenkind = MULT_MULT; break;
+                        case '=': LEXER_INCREMENT_OFFSET; tokenkind = MULT_EQUALS; break;
+                        default: tokenkind = MULT; break;
+                    }
+                    break;
+                case '/':
+                    switch(next) {
+                        // Add tokenkind here? 
+                        // (TODO) jasmcaus
+                        case '/': tokenkind = TOK_NULL; lex_sl_comment(lexer); break;
+                        case '*': tokenkind = TOK_NULL; lex_ml_comment(lexer); break;
+                        case '=': LEXER_INCREMENT_OFFSET; tokenkind = SLASH_EQUALS; break;
+                        default: tokenkind = SLASH; break;
+                    }
+                    break;
+                case '#': 
+                    // Comment (a shebang on the first line is skipped the same way)
                     tokenkind = TOK_NULL;
                     lex_sl_comment(lexer);
-                }
-                break;
-            case '!':
-                switch(next) {
-                    case '=': LEXER_INCREMENT_OFFSET; tokenkind = EXCLAMATION_EQUALS; break;
-                    default: tokenkind = MINUS_MINUS; break;
-                }
-                break;
-            case '%':
-                switch(next) {
-                    case '%': LEXER_INCREMENT_OFFSET; tokenkind = MOD_MOD; break;
-                    case '=': LEXER_INCREMENT_OFFSET; tokenkind = MOD_EQUALS; break;
-                    default: tokenkind = MOD; break;
-                }
-                break;
-            case '&':
-                switch(next) {
-                    case '&': LEXER_INCREMENT_OFFSET; tokenkind = AND_AND; break;
-                    case '^': LEXER_INCREMENT_OFFSET; tokenkind = AND_NOT; break;
-                    case '=': LEXER_INCREMENT_OFFSET; tokenkind = AND_EQUALS; break;
-                    default: tokenkind = AND; break;
-                }
-                break;
-            case '|':
-                switch(next) {
-                    case '|': LEXER_INCREMENT_OFFSET; tokenkind = OR_OR; break;
-                    case '=': LEXER_INCREMENT_OFFSET; tokenkind = OR_EQUALS; break;
-                    default: tokenkind = OR; break;
-                }
-                break;
-            case '^':
-                switch(next) {
-                    case '=': LEXER_INCREMENT_OFFSET; tokenkind = XOR_EQUALS; break;
-                    default: tokenkind = XOR; break;
-                }
-                break;
-            case '<':
-                switch(next) {
-                    case '=': LEXER_INCREMENT_OFFSET; tokenkind = LESS_THAN_OR_EQUAL_TO; break;
-                    case '-': LEXER_INCREMENT_OFFSET; tokenkind = LARROW; break;
-                    case '<': 
-                        LEXER_INCREMENT_OFFSET;
-                        char c = peek(lexer);
-                        if(c == '=') {
-                            LEXER_INCREMENT_OFFSET; tokenkind = LBITSHIFT_EQUALS;
-                        } else {
-                            tokenkind = LBITSHIFT;
-                        }
-                        break;
-                    default: tokenkind = LESS_THAN; break;
-                }
-                break;
-            case '>':
-                switch(next) {
-                    case '=': LEXER_INCREMENT_OFFSET; tokenkind = GREATER_THAN_OR_EQUAL_TO; break;
-                    case '>': 
-                        LEXER_INCREMENT_OFFSET;
-                        char c = peek(lexer);
-                        if(c == '=') {
-                            LEXER_INCREMENT_OFFSET; tokenkind = RBITSHIFT_EQUALS;
-                        } else {
-                            tokenkind = RBITSHIFT;
-                        }
-                        break;
-                    default: tokenkind = GREATER_THAN; break;
-                }
-                break;
-            case '~':
-                switch(next) {
-                    case '=': LEXER_INCREMENT_OFFSET; tokenkind = TILDA_EQUALS; break;
-                    default: tokenkind = TILDA; break;
-                }
-                break;
-            case '.':
-                switch(next) {
-                    case '.': 
-                        LEXER_INCREMENT_OFFSET;
-                        char c = peek(lexer);
-                        if(c == '.') {
-                            LEXER_INCREMENT_OFFSET; tokenkind = ELLIPSIS;
-                        } else {
-                            tokenkind = DDOT;
-                        }
-                        break;
-                    // Fractions are possible here:
-                    // Eg: `.0192` or `.9983838`
-                    case DIGIT: tokenkind = TOK_NULL; lex_digit(lexer); break;
-                    default: tokenkind = DOT; break;
-                }
-                break;
-            case ':':
-                switch(next) {
-                    case ':': LEXER_INCREMENT_OFFSET; tokenkind = COLON_COLON; break;
-                    default: tokenkind = COLON; break;
-                }
-                break;
-            case '?': tokenkind = QUESTION; break;
-            case '@': tokenkind = TOK_NULL; lex_macro(lexer); break;
-            default:
-                lexer_error(ErrorSyntaxError, "Invalid character `%c`", curr);
-                break;
-        } // switch(ch)
+                    break;
+                case '!':
+                    switch(next) {
+                        case '=': LEXER_INCREMENT_OFFSET; tokenkind = EXCLAMATION_EQUALS; break;
+                        default: tokenkind = EXCLAMATION; break;
+                    }
+                    break;
+                case '%':
+                    switch(next) {
+                        case '%': LEXER_INCREMENT_OFFSET; tokenkind = MOD_MOD; break;
+                        case '=': LEXER_INCREMENT_OFFSET; tokenkind = MOD_EQUALS; break;
+                        default: tokenkind = MOD; break;
+                    }
+                    break;
+                case '&':
+                    switch(next) {
+                        case '&': LEXER_INCREMENT_OFFSET; tokenkind = AND_AND; break;
+                        case '^': LEXER_INCREMENT_OFFSET; tokenkind = AND_NOT; break;
+                        case '=': LEXER_INCREMENT_OFFSET; tokenkind = AND_EQUALS; break;
+                        default: tokenkind = AND; break;
+                    }
+                    break;
+                case '|':
+                    switch(next) {
+                        case '|': LEXER_INCREMENT_OFFSET; tokenkind = OR_OR; break;
+                        case '=': LEXER_INCREMENT_OFFSET; tokenkind = OR_EQUALS; break;
+                        default: tokenkind = OR; break;
+                    }
+                    break;
+                case '^':
+                    switch(next) {
+                        case '=': LEXER_INCREMENT_OFFSET; tokenkind = XOR_EQUALS; break;
+                        default: tokenkind = XOR; break;
+                    }
+                    break;
+                case '<':
+                    switch(next) {
+                        case '=': LEXER_INCREMENT_OFFSET; tokenkind = LESS_THAN_OR_EQUAL_TO; break;
+                        case '-': LEXER_INCREMENT_OFFSET; tokenkind = LARROW; break;
+                        case '<': 
+                            LEXER_INCREMENT_OFFSET;
+                            char c = peek(lexer);
+                            if(c == '=') {
+                                LEXER_INCREMENT_OFFSET; tokenkind = LBITSHIFT_EQUALS;
+                            } else {
+                                tokenkind = LBITSHIFT;
+                            }
+                            break;
+                        default: tokenkind = LESS_THAN; break;
+                    }
+                    break;
+                case '>':
+                    switch(next) {
+                        case '=': LEXER_INCREMENT_OFFSET; tokenkind = GREATER_THAN_OR_EQUAL_TO; break;
+                        case '>': 
+                            LEXER_INCREMENT_OFFSET;
+                            char c = peek(lexer);
+                            if(c == '=') {
+                                LEXER_INCREMENT_OFFSET; tokenkind = RBITSHIFT_EQUALS;
+                            } else {
+                                tokenkind = RBITSHIFT;
+                            }
+                            break;
+                        default: tokenkind = GREATER_THAN; break;
+                    }
+                    break;
+                case '~':
+                    switch(next) {
+                        case '=': LEXER_INCREMENT_OFFSET; tokenkind = TILDA_EQUALS; break;
+                        default: tokenkind = TILDA; break;
+                    }
+                    break;
+                case '.':
+                    switch(next) {
+                        case '.': 
+                            LEXER_INCREMENT_OFFSET;
+                            char c = peek(lexer);
+                            if(c == '.') {
+                                LEXER_INCREMENT_OFFSET; tokenkind = ELLIPSIS;
+                            } else {
+                                tokenkind = DDOT;
+                            }
+                            break;
+                        // Fractions are possible here:
+                        // Eg: `.0192` or `.9983838`
+                        default: 
+                            if(CHAR_IS(next, CHAR_DIGIT)) {
+                                tokenkind = TOK_NULL;
+                                lex_digit(lexer);
+                            } else {
+                                tokenkind = DOT;
+                            }
+                            break;
+                    }
+                    break;
+                case ':':
+                    switch(next) {
+                        case ':': LEXER_INCREMENT_OFFSET; tokenkind = COLON_COLON; break;
+                        default: tokenkind = COLON; break;
+                    }
+                    break;
+                case '?': tokenkind = QUESTION; break;
+                case '@': tokenkind = TOK_NULL; lex_macro(lexer); break;
+                default:
+                    if(cast(UInt8)curr >= 0x80) {
+                        tokenkind = TOK_NULL;
+                        lex_unicode_identifier(lexer);
+                    } else {
+                        lexer_error(ErrorSyntaxError, "Invalid character `%c`", curr);
+                    }
+                    break;
+            } // switch(ch)
+        }
 
-        if(tokenkind == TOK_NULL) continue;
-        maketoken(lexer, tokenkind, BUFF_NEW(null), lexer->offset - 1, lexer->loc->line, lexer->loc->col - 1);
+        if(tokenkind != TOK_NULL)
+            maketoken(lexer, tokenkind, begin, lexer->offset - begin);
+        if(single && lexer->num_tokens != num_tokens)
+            return true;
     } // while
 
 lex_eof:;
 
-    maketoken(lexer, TOK_EOF, BUFF_NEW(null), lexer->offset - 1, lexer->loc->line, lexer->loc->col - 1);
+    maketoken(lexer, TOK_EOF, lexer->offset, 0);
+    return false;
+}
+
+// Same as `lexer_scan_tokens()`, except that if the Lexer has a Diagnostics (or is in kinds-only mode), errors are 
+// recovered from: the rest of the bad token is skipped, and a TOK_ILLEGAL token is made in its place.
+static bool lexer_scan(Lexer* lexer, bool single) {
+    if((NONE(lexer->diags) && NONE(lexer->kinds)) || SOME(lexer->on_error))
+        return lexer_scan_tokens(lexer, single);
+
+    jmp_buf recover;
+    jmp_buf* prev_recover = lexer->on_recover;
+    lexer->on_recover = &recover;
+    while(true) {
+        if(setjmp(recover) == 0) {
+            bool is_more = lexer_scan_tokens(lexer, single);
+            lexer->on_recover = prev_recover;
+            return is_more;
+        }
+
+        // An error was reported. Skip to the end of the offending token (always making progress)
+        UInt32 begin = lexer->token_begin;
+        UInt32 end = lexer->offset > begin ? lexer->offset : begin + 1;
+        while(end < lexer->buff_cap && CHAR_IS(lexer->buffer->data[end], CHAR_IDENT))
+            ++end;
+        if(end > lexer->buff_cap)
+            end = cast(UInt32)lexer->buff_cap;
+        lexer->offset = end;
+        lexer->is_inside_str = false;
+        maketoken(lexer, TOK_ILLEGAL, begin, end - begin);
+        if(single) {
+            lexer->on_recover = prev_recover;
+            return true;
+        }
+    }
+    return true;
+}
+
+// Lex the Source files
+// Count a call to `lexer_lex()` (or `lexer_lex_parallel()`) that started at `start`, from `offset` and `num_tokens`
+static void lexer_count_run(Lexer* lexer, UInt64 start, UInt32 offset, UInt64 num_tokens) {
+    Stats* stats = lexer->stats;
+    stats_add_run(stats, StatsPhaseLex, start);
+    stats->bytes_scanned += lexer->offset - offset;
+    stats->num_tokens += lexer->num_tokens - num_tokens;
+}
+
+void lexer_lex(Lexer* lexer) {
+    CORETEN_ENFORCE(NONE(lexer->ring), "Cannot call `lexer_lex()` on a Lexer in streaming mode");
+    if(CORETEN_LIKELY(NONE(lexer->stats))) {
+        lexer_skip_bom(lexer);
+        lexer_scan(lexer, false);
+        return;
+    }
+
+    UInt64 start = stats_now();
+    UInt32 offset = lexer->offset;
+    UInt64 num_tokens = lexer->num_tokens;
+    lexer_skip_bom(lexer);
+    lexer_scan(lexer, false);
+    lexer_count_run(lexer, start, offset, num_tokens);
+}
+
+void lexer_set_buffer(Lexer* lexer, char* buffer) {
+    CORETEN_ENFORCE(!lexer->is_padded, "Cannot replace the Lexical buffer of a Lexer made from a view");
+    buff_set(lexer->buffer, buffer);
+    lexer->buff_cap = buff_len(lexer->buffer);
+    lexer->offset = 0;
+    lexer_check_encoding(lexer);
+    // Rebuilt on first use
+    line_table_free(lexer->lines);
+    lexer->lines = null;
+}
+
+UInt32 lexer_lex_range(Lexer* lexer, Vec* toklist, UInt32 begin, UInt32 end) {
+    CORETEN_ENFORCE(!lexer->is_compact && NONE(lexer->ring), "Can only lex a range into a list of Tokens");
+
+    // Same Lexical buffer (and Interner), but our own tokens
+    Lexer range = *lexer;
+    range.toklist = toklist;
+    range.offset = begin;
+    range.scan_end = end;
+    range.num_tokens = 0;
+    range.is_inside_str = false;
+    range.diags = null;
+    range.on_recover = null;
+    jmp_buf on_error;
+    range.on_error = &on_error;
+    if(setjmp(on_error) != 0)
+        return UInt32_MAX;
+
+    lexer_scan(&range, false);
+    return range.offset;
+}
+
+UInt32 lexer_lex_kinds(Lexer* lexer, TokenKinds* kinds, UInt32 begin, UInt32 end) {
+    CORETEN_ENFORCE_NN(kinds, "Expected not null");
+    CORETEN_ENFORCE(begin <= lexer->buff_cap, "`begin` is past the end of the Lexical buffer");
+
+    // Same Lexical buffer (and Diagnostics), but only kinds. No values, symbols or stats
+    Lexer range = *lexer;
+    range.kinds = kinds;
+    range.offset = begin;
+    range.scan_end = end;
+    range.num_tokens = 0;
+    range.is_inside_str = false;
+    range.on_recover = null;
+    range.on_error = null;
+    range.stats = null;
+    if(begin == 0)
+        lexer_skip_bom(&range);
+    lexer_scan(&range, false);
+    return range.offset;
+}
+
+// A chunk of the Lexical buffer, lexed speculatively (as a job, on any thread) by `lexer_lex_parallel()`
+typedef struct LexerChunk {
+    Lexer lexer;        // shares the Lexical buffer of the parent Lexer, but has its own tokens
+    UInt32 begin;       // offset of the (line start) the chunk was lexed from
+    UInt32 end;         // offset at which lexing stopped (the first token boundary past the chunk)
+    bool has_failed;    // set if a lexer error was raised. The tokens made until then are discarded
+    bool is_eof;        // set if TOK_EOF was made
+    jmp_buf on_error;
+} LexerChunk;
+
+static void lexer_chunk_init(LexerChunk* chunk, Lexer* parent, UInt32 begin, UInt32 end) {
+    Lexer* lexer = &chunk->lexer;
+    *lexer = *parent;
+    lexer->offset = begin;
+    lexer->scan_end = end;
+    lexer->num_tokens = 0;
+    lexer->nest_level = 0;
+    if(parent->is_compact)
+        lexer->tokens = token_arena_new(TOKENLIST_ALLOC_CAPACITY);
+    else
+        lexer->toklist = VEC_NEW(Token, TOKENLIST_ALLOC_CAPACITY);
+    // The Interner needn't be thread-safe (see `interner_new_shared()`). Tokens are interned once they're taken (see 
+    // `lexer_chunk_take()`)
+    lexer->interner = null;
+    // Errors are only reported once the chunk is re-lexed (see `lexer_chunk_resync()`), and Stats aren't thread-safe
+    lexer->diags = null;
+    lexer->stats = null;
+    lexer->on_recover = null;
+    lexer->on_error = &chunk->on_error;
+
+    chunk->begin = begin;
+    chunk->end = begin;
+    chunk->has_failed = false;
+    chunk->is_eof = false;
+}
+
+static void lexer_chunk_lex(void* arg) {
+    LexerChunk* chunk = cast(LexerChunk*)arg;
+    if(setjmp(chunk->on_error) == 0)
+        chunk->is_eof = !lexer_scan(&chunk->lexer, false);
+    else
+        chunk->has_failed = true;
+    chunk->end = chunk->lexer.offset;
+}
+
+static inline UInt32 lexer_chunk_offset(LexerChunk* chunk, UInt64 i) {
+    if(chunk->lexer.is_compact)
+        return chunk->lexer.tokens->data[i].offset;
+    return vec_at_Token(chunk->lexer.toklist, i)->offset;
+}
+
+// Move the tokens of `chunk` (from the `first`th) over to `lexer`, and free the chunk's tokens
+static void lexer_chunk_take(Lexer* lexer, LexerChunk* chunk, UInt64 first) {
+    UInt64 num_tokens = chunk->lexer.num_tokens;
+    if(chunk->lexer.is_compact) {
+        TokenArena* arena = lexer->tokens;
+        TokenArena* from = chunk->lexer.tokens;
+        if(first < num_tokens) {
+            token_arena_grow(arena, arena->len + (num_tokens - first));
+            memcpy(arena->data + arena->len, from->data + first, (num_tokens - first) * sizeof(CompactToken));
+            arena->len += num_tokens - first;
+        }
+        for(UInt64 i = first; i < num_tokens; i++)
+            lexer->nest_level += (from->data[i].kind == LBRACE) - (from->data[i].kind == RBRACE);
+        token_arena_free(from);
+    } else {
+        Token* tokens = cast(Token*)chunk->lexer.toklist->core.data;
+        // The tokens before `first` are discarded
+        for(UInt64 i = first; i < num_tokens; i++) {
+            Token* token = &tokens[i];
+            if(SOME(lexer->interner) && lexer_is_interned(token->kind))
+                token->symbol = interner_intern_view(lexer->interner, lexer_value(lexer, token));
+            lexer->nest_level += (token->kind == LBRACE) - (token->kind == RBRACE);
+        }
+        if(first < num_tokens)
+            vec_extend_Token(lexer->toklist, tokens + first, num_tokens - first);
+        vec_free(chunk->lexer.toklist);
+    }
+
+    if(first < num_tokens)
+        lexer->num_tokens += num_tokens - first;
+}
+
+// Lex `chunk` again, from `lexer->offset` (where the previous chunk ended) instead of from its line start.
+// This stops as soon as we get to the beginning of one of the chunk's (speculative) tokens: lexing is context-free
+// between tokens, so from there on the speculative tokens are the right ones.
+// Returns whether TOK_EOF has been made.
+static bool lexer_chunk_resync(Lexer* lexer, LexerChunk* chunk) {
+    // TOK_EOF doesn't begin where a token could
+    UInt64 num_tokens = chunk->has_failed ? 0 : chunk->lexer.num_tokens - chunk->is_eof;
+    UInt64 i = 0;
+    bool is_eof = false;
+    while(true) {
+        while(i < num_tokens && lexer_chunk_offset(chunk, i) < lexer->offset)
+            ++i;
+        if(i < num_tokens && lexer_chunk_offset(chunk, i) == lexer->offset) {
+            // Back in sync
+            lexer_chunk_take(lexer, chunk, i);
+            lexer->offset = chunk->end;
+            return chunk->is_eof;
+        }
+
+        lexer->scan_end = i < num_tokens ? lexer_chunk_offset(chunk, i) : chunk->lexer.scan_end;
+        is_eof = !lexer_scan(lexer, false);
+        if(is_eof || i == num_tokens)
+            break;
+    }
+
+    // We never got back in sync (so none of the speculative tokens are used)
+    lexer_chunk_take(lexer, chunk, chunk->lexer.num_tokens);
+    return is_eof;
+}
+
+static void lexer_scan_parallel(Lexer* lexer, JobPool* pool) {
+    lexer_skip_bom(lexer);
+
+    UInt32 num_threads = SOME(pool) ? pool->num_workers : 1;
+    UInt32 begin = lexer->offset;
+    UInt32 len = cast(UInt32)lexer->buff_cap - begin;
+    UInt32 num_chunks = len / LEXER_PARALLEL_MIN_CHUNK;
+    if(num_chunks > num_threads)
+        num_chunks = num_threads;
+    if(num_chunks <= 1) {
+        lexer_scan(lexer, false);
+        return;
+    }
+
+    // Chunk `0` is lexed by the calling thread (directly into `lexer`), and chunks `1..` by `chunks[0..]`.
+    // Each chunk begins right after the first newline past its share of the buffer
+    LexerChunk* chunks = cast(LexerChunk*)calloc(num_chunks - 1, sizeof(LexerChunk));
+    CORETEN_ENFORCE_NN(chunks, "Could not allocate memory. Memory full.");
+    UInt32* bounds = cast(UInt32*)malloc((num_chunks + 1) * sizeof(UInt32));
+    CORETEN_ENFORCE_NN(bounds, "Could not allocate memory. Memory full.");
+
+    UInt32 count = 1;
+    bounds[0] = begin;
+    for(UInt32 i = 1; i < num_chunks; i++) {
+        UInt32 at = begin + cast(UInt32)(cast(UInt64)len * i / num_chunks);
+        at = scan_until(lexer->buffer->data, at, lexer->buff_cap, '\n') + 1;
+        if(at > bounds[count - 1] && at < lexer->buff_cap)
+            bounds[count++] = at;
+    }
+    // The last chunk runs until TOK_EOF
+    bounds[count] = UInt32_MAX;
+
+    JobGroup group;
+    job_group_init(&group);
+    for(UInt32 i = 1; i < count; i++) {
+        LexerChunk* chunk = &chunks[i - 1];
+        lexer_chunk_init(chunk, lexer, bounds[i], bounds[i + 1]);
+        job_pool_submit(pool, &group, lexer_chunk_lex, chunk);
+    }
+
+    // Chunk `0` can't be a job: errors in it are reported (and recovered from) as usual, which must happen on the 
+    // calling thread. Any chunk left by the time it's done is lexed here too (see `job_group_wait()`)
+    lexer->scan_end = bounds[1];
+    bool is_eof = !lexer_scan(lexer, false);
+    job_group_wait(pool, &group);
+
+    // Stitch the chunks together (in order)
+    for(UInt32 i = 1; i < count; i++) {
+        LexerChunk* chunk = &chunks[i - 1];
+        if(is_eof)
+            lexer_chunk_take(lexer, chunk, chunk->lexer.num_tokens);
+        else if(!chunk->has_failed && chunk->begin == lexer->offset) {
+            // The speculation was right
+            lexer_chunk_take(lexer, chunk, 0);
+            lexer->offset = chunk->end;
+            is_eof = chunk->is_eof;
+        } else {
+            is_eof = lexer_chunk_resync(lexer, chunk);
+        }
+    }
+    lexer->scan_end = UInt32_MAX;
+
+    free(bounds);
+    free(chunks);
+}
+
+void lexer_lex_parallel(Lexer* lexer, JobPool* pool) {
+    CORETEN_ENFORCE(NONE(lexer->ring), "Cannot call `lexer_lex_parallel()` on a Lexer in streaming mode");
+    if(CORETEN_LIKELY(NONE(lexer->stats))) {
+        lexer_scan_parallel(lexer, pool);
+        return;
+    }
+
+    UInt64 start = stats_now();
+    UInt32 offset = lexer->offset;
+    UInt64 num_tokens = lexer->num_tokens;
+    lexer_scan_parallel(lexer, pool);
+    lexer_count_run(lexer, start, offset, num_tokens);
+}
+
+// Switch the Lexer to streaming mode (on the first call to `lexer_next_token()` or `lexer_peek_token()`)
+static void lexer_stream_begin(Lexer* lexer) {
+    CORETEN_ENFORCE(!lexer->is_compact, "Streaming is not supported in compact mode");
+    CORETEN_ENFORCE(lexer->num_tokens == 0, "Cannot stream from a Lexer that has already lexed its tokens");
+
+    // The ring replaces `toklist`
+    vec_free(lexer->toklist);
+    lexer->toklist = null;
+
+    lexer->ring = cast(Token*)calloc(LEXER_RING_SIZE, sizeof(Token));
+    CORETEN_ENFORCE_NN(lexer->ring, "Could not allocate memory. Memory full.");
+    lexer->ring_pos = 0;
+    lexer->is_done = false;
+    lexer_skip_bom(lexer);
+}
+
+Token* lexer_peek_token(Lexer* lexer, UInt32 n) {
+    CORETEN_ENFORCE(n < LEXER_LOOKAHEAD, "Can only look ahead `LEXER_LOOKAHEAD` tokens");
+    if(CORETEN_UNLIKELY(NONE(lexer->ring)))
+        lexer_stream_begin(lexer);
+
+    while(lexer->ring_pos + n >= lexer->num_tokens) {
+        // Past the end, we keep on returning TOK_EOF
+        if(lexer->is_done)
+            return &lexer->ring[(lexer->num_tokens - 1) & (LEXER_RING_SIZE - 1)];
+        lexer->is_done = !lexer_scan(lexer, true);
+    }
+    return &lexer->ring[(lexer->ring_pos + n) & (LEXER_RING_SIZE - 1)];
+}
+
+Token* lexer_next_token(Lexer* lexer) {
+    Token* token = lexer_peek_token(lexer, 0);
+    if(token->kind != TOK_EOF)
+        ++lexer->ring_pos;
+    return token;
+}
+
+void lexer_unget_token(Lexer* lexer) {
+    CORETEN_ENFORCE(SOME(lexer->ring) && lexer->ring_pos > 0, "No token to put back");
+    CORETEN_ENFORCE(lexer->num_tokens - lexer->ring_pos < LEXER_RING_SIZE, "The token has left the ring");
+    --lexer->ring_pos;
 }
\ No newline at end of file
@@ -19,10 +19,17 @@ Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
 #include <adorad/core/vector.h>
 #include <adorad/core/buffer.h>
 #include <adorad/core/debug.h>
+#include <adorad/core/io.h>
+#include <adorad/core/jobs.h>
+
+#include <setjmp.h>
 
 #include <adorad/compiler/tokens.h>
 #include <adorad/compiler/location.h>
 #include <adorad/compiler/error.h>
+#include <adorad/compiler/intern.h>
+#include <adorad/compiler/diagnostics.h>
+#include <adorad/compiler/stats.h>
 
 /*
     Adorad's Lexer is built in such a way that no (or negligible) memory allocations are necessary during usage. 
@@ -40,27 +47,150 @@ Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
 // When this limit is reached, we realloc using this same constant (TOKENLIST_ALLOC_CAPACITY * sizeof(Token)) bytes 
 // at a time (which works out to around 0.26MB) per (re)allocation
 #define TOKENLIST_ALLOC_CAPACITY    8192
+// Typed accessors for `toklist` (see `VEC_DEFINE()`)
+VEC_DEFINE(Token)
+
 // Maximum length of an individual token
 #define MAX_TOKEN_LENGTH            256
+// Number of tokens held by the Lexer in streaming mode (must be a power of 2). See `lexer_next_token()`
+#define LEXER_RING_SIZE             64
+// How far ahead `lexer_peek_token()` can look
+#define LEXER_LOOKAHEAD             8
+CORETEN_STATIC_ASSERT((LEXER_RING_SIZE & (LEXER_RING_SIZE - 1)) == 0 && LEXER_LOOKAHEAD < LEXER_RING_SIZE);
+// Smallest chunk of the Lexical buffer that `lexer_lex_parallel()` hands off to a thread
+#define LEXER_PARALLEL_MIN_CHUNK    (64 * 1024)
 
 typedef struct Lexer {
     Buff* buffer;       // the Lexical buffer
     UInt64 buff_cap;    // buffer capacity
-    UInt32 offset;      // current buffer offset (in Bytes) 
+    bool is_padded;     // set if the buffer is followed by `FILE_VIEW_PADDING` zero bytes (see `lexer_init_view()`)
+    // Encoding of the buffer, checked once (when it's set)
+    // Identifiers are scanned for non-ASCII characters only if the buffer isn't all ASCII
+    bool is_ascii;
+    UInt32 bad_utf8;    // offset of the next invalid UTF-8 byte (that hasn't been reported), or UInt32_MAX if none
+    UInt32 offset;      // current buffer offset (in Bytes)
                         // offset of the curr char (no. of chars b/w the beginning of the Lexical Buffer
                         // and the curr char)
 
     Vec* toklist;       // list of tokens
-    Loc* loc;      // location of the token in the source code
+    Loc* loc;           // source file (only `fname` is kept up to date - see `lexer_loc()`)
+    LineTable* lines;   // line-start table of the buffer (built on first use)
+    Interner* interner; // if set, identifiers and strings are interned as they're lexed (not owned by the Lexer)
+
+    // Error recovery (see `lexer_set_diagnostics()`)
+    Diagnostics* diags; // if set, errors are reported here (instead of exiting), and lexing carries on
+    jmp_buf* on_recover;// where errors jump to once reported (set while lexing)
+    UInt32 token_begin; // offset of the token being lexed
+
+    Stats* stats;       // if set, `lexer_lex()` counts what it does here (see `lexer_set_stats()`)
+    Allocator* allocator;// where `toklist` comes from (the heap, if null - see `lexer_set_allocator()`)
+
+    // Compact mode
+    // If set, tokens are emitted as `CompactToken`s into `tokens` (and `toklist` is null). No memory is allocated
+    // per token.
+    bool is_compact;
+    TokenArena* tokens;
+    UInt16 fileid;      // id of the file being lexed (stored in every `CompactToken`)
+    UInt64 num_tokens;  // number of tokens made so far
+
+    // Streaming mode
+    // If set, tokens are made on demand (see `lexer_next_token()`) into `ring` (and `toklist` is null).
+    Token* ring;        // the last `LEXER_RING_SIZE` tokens
+    UInt64 ring_pos;    // index (in the token stream) of the next token to be returned
+    bool is_done;       // set once TOK_EOF has been made
+
+    // Kinds-only mode (see `lexer_lex_kinds()`)
+    // If set, only the kind and the span of each token are kept, in `kinds` (and so are comments, as COMMENTs)
+    TokenKinds* kinds;
+
+    // Parallel mode (see `lexer_lex_parallel()`)
+    UInt32 scan_end;    // lexing stops at the first token boundary at or past this offset
+    jmp_buf* on_error;  // if set, lexer errors jump here instead of exiting (while lexing speculatively)
 
     bool is_inside_str; // set to true inside a string
     int nest_level;     // used to infer if we're inside many `{}`s
 } Lexer;
 
 Lexer* lexer_init(char* buffer, char* fname);
+// Same as `lexer_init()`, except that the Lexer emits `CompactToken`s into `lexer->tokens`
+Lexer* lexer_init_compact(char* buffer, char* fname, UInt16 fileid);
+// Same as `lexer_init()` and `lexer_init_compact()`, except that the Lexer reads directly from `view` (see 
+// `file_map()`). `view` is neither copied nor owned by the Lexer, and must outlive it.
+Lexer* lexer_init_view(FileView* view, char* fname);
+Lexer* lexer_init_compact_view(FileView* view, char* fname, UInt16 fileid);
 void lexer_free(Lexer* lexer);
+// Intern the values of identifier and string tokens into `interner` (see `Token.symbol`).
+// This has no effect in compact mode - `CompactToken`s don't carry a symbol (intern `lexer_token_value()` instead).
+void lexer_set_interner(Lexer* lexer, Interner* interner);
+// Report errors into `diags` instead of exiting on the first one (`diags` is not owned by the Lexer, and is also 
+// used by any Parser made from it). The bad source is skipped (up to the end of the offending token) and a 
+// TOK_ILLEGAL token is made in its place, so that lexing carries on.
+void lexer_set_diagnostics(Lexer* lexer, Diagnostics* diags);
+// Keep statistics (tokens, bytes scanned, allocations and time) in `stats`, which is shared with the Parser of the 
+// Lexer. `stats` is not owned by the Lexer. Allocations made by the threads of `lexer_lex_parallel()` aren't counted
+void lexer_set_stats(Lexer* lexer, Stats* stats);
+// Allocate the token list from `allocator` (eg. a `TrackingAllocator`, to account for it). `allocator` is not owned 
+// by the Lexer, must outlive its tokens, and must be thread-safe for `lexer_lex_parallel()`. Must be set before 
+// anything is lexed.
+void lexer_set_allocator(Lexer* lexer, Allocator* allocator);
 void lexer_error(Lexer* lexer, Error err, const char* format, ...);
 // Lex the source files
 void lexer_lex(Lexer* lexer);
+// Same as `lexer_lex()`, except that the Lexical buffer is split into (at most) `pool->num_workers` chunks which are
+// lexed in parallel, as jobs of `pool`. The calling thread must be the one that made `pool`, or running one of its jobs
+// (eg. a file of the Frontend). If `pool` is null, the buffer is lexed on the calling thread.
+// Chunks begin at line starts and are lexed speculatively - a chunk that turns out to have begun inside a string or
+// a comment is re-lexed from where the previous chunk ended (until it's back in sync). Either way, the tokens are
+// exactly those of `lexer_lex()`.
+void lexer_lex_parallel(Lexer* lexer, JobPool* pool);
+// Point the Lexer at a new Lexical buffer (eg. the source after an edit - see `parser_reparse()`). Like the one given 
+// to `lexer_init()`, `buffer` is not copied, and must outlive the Lexer. The tokens made so far are left as they are.
+void lexer_set_buffer(Lexer* lexer, char* buffer);
+// Lex `[begin, end)` of the Lexical buffer into `toklist` (instead of `lexer->toklist`). `begin` must be a token 
+// boundary. Like `lexer_lex_parallel()`'s chunks, this stops at the first token boundary at or past `end` (or after 
+// TOK_EOF), and returns its offset. Returns UInt32_MAX on a lexer error (without reporting it).
+UInt32 lexer_lex_range(Lexer* lexer, Vec* toklist, UInt32 begin, UInt32 end);
+// Lex `[begin, end)` of the Lexical buffer, appending only the kind and the span of each token (and of each comment,
+// as a COMMENT) to `kinds` - for editors, which don't need token values (and formatters, which need comments too).
+// Nothing is allocated per token, and the Lexer's own tokens are left as they are.
+// `begin` must be a token boundary: the start of a line outside of any comment or string (eg. what
+// `token_kinds_rewind()` returns), or the start of the source. This stops at the first token boundary at or past
+// `end` (or after TOK_EOF), and returns its offset. Errors don't stop lexing: the bad source is made into a TOK_ILLEGAL
+// (reported into the Lexer's Diagnostics, if it has one).
+UInt32 lexer_lex_kinds(Lexer* lexer, TokenKinds* kinds, UInt32 begin, UInt32 end);
+// Returns the location (file, line and column) of `offset` in the Lexical buffer.
+// Tokens only store their offset, so this is how their line and column are found (eg. for diagnostics).
+Location lexer_loc(Lexer* lexer, UInt32 offset);
+// Returns the line-start table of the Lexical buffer (built on the first call)
+LineTable* lexer_line_table(Lexer* lexer);
+
+// Pull-mode (streaming) API
+// Instead of lexing the entire source with `lexer_lex()`, tokens can be lexed on demand, one at a time. Only the 
+// last `LEXER_RING_SIZE` tokens are kept in memory, so a token returned by these functions is only valid until 
+// another `LEXER_RING_SIZE - LEXER_LOOKAHEAD` tokens have been consumed (a value taken with `lexer_value()` stays 
+// valid, though).
+// Not supported in compact mode.
+// 
+// Consume and return the next token. Past the end of the source, TOK_EOF is returned.
+Token* lexer_next_token(Lexer* lexer);
+// Return the token `n` tokens ahead of the next one (without consuming anything). `n` must be < LEXER_LOOKAHEAD
+Token* lexer_peek_token(Lexer* lexer, UInt32 n);
+// Put back the last consumed token
+void lexer_unget_token(Lexer* lexer);
+
+// Returns the value of a compact token (as a view into the Lexical buffer).
+// For strings, the enclosing quotes are not part of the value.
+BuffView lexer_token_value(Lexer* lexer, CompactToken* token);
+// Same as `lexer_token_value()`, for a (regular) Token. The view is into the Lexical buffer the Lexer has now, so it 
+// stays valid (as long as the buffer does) across `lexer_set_buffer()`, whose tokens move along with the source.
+// Like the buffer, it's not nul-terminated.
+BuffView lexer_value(Lexer* lexer, Token* token);
+
+// Returns the value of the string literal spelled `value` (a token value: without its quotes), with `flags` (those
+// of its token). A string without escapes is its spelling, so this is `value` itself (for compact tokens, a view into
+// the source). Otherwise, the string is unescaped into `arena` (so the value lives as long as it does).
+// The escapes are those of C: `\a \b \e \f \n \r \t \v \" \' \? \\`, `\0`-`\7` and `\xHH`. The Lexer
+// has already checked them
+BuffView lexer_string_value(BuffView value, UInt8 flags, Arena* arena);
 
 #endif // ADORAD_LEXER_H
\ No newline at end of file
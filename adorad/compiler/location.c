@@ -13,6 +13,7 @@ Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
 
 #include <stdlib.h>
 #include <adorad/compiler/location.h>
+#include <adorad/compiler/scanner.h>
 
 Location* loc_new(char* fname) {
     Location* loc = cast(Location*)calloc(1, sizeof(Location));
@@ -34,4 +35,53 @@ void loc_free(Location* loc) {
         buff_free(loc->fname);
         free(loc);
     }
-}
\ No newline at end of file
+}
+
+LineTable* line_table_new(const char* data, UInt32 len) {
+    LineTable* lines = cast(LineTable*)calloc(1, sizeof(LineTable));
+    CORETEN_ENFORCE_NN(lines, "Could not allocate memory. Memory full.");
+
+    // Assume ~32 characters per line to start with
+    UInt32 cap = len / 32 + 1;
+    lines->starts = cast(UInt32*)malloc(cap * sizeof(UInt32));
+    CORETEN_ENFORCE_NN(lines->starts, "Could not allocate memory. Memory full.");
+    lines->starts[lines->num_lines++] = 0;
+
+    UInt32 pos = 0;
+    while((pos = scan_until(data, pos, len, '\n')) < len) {
+        if(CORETEN_UNLIKELY(lines->num_lines == cap)) {
+            cap *= 2;
+            lines->starts = cast(UInt32*)realloc(lines->starts, cap * sizeof(UInt32));
+            CORETEN_ENFORCE_NN(lines->starts, "Could not allocate memory. Memory full.");
+        }
+        lines->starts[lines->num_lines++] = ++pos;
+    }
+
+    return lines;
+}
+
+void line_table_free(LineTable* lines) {
+    if(lines) {
+        free(lines->starts);
+        free(lines);
+    }
+}
+
+Location line_table_loc(LineTable* lines, UInt32 offset) {
+    // Find the last line that starts at or before `offset`
+    UInt32 lo = 0;
+    UInt32 hi = lines->num_lines;
+    while(hi - lo > 1) {
+        UInt32 mid = lo + (hi - lo) / 2;
+        if(lines->starts[mid] <= offset)
+            lo = mid;
+        else
+            hi = mid;
+    }
+
+    Location loc;
+    loc.line = lo + 1;
+    loc.col = offset - lines->starts[lo] + 1;
+    loc.fname = null;
+    return loc;
+}
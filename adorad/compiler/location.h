@@ -29,4 +29,17 @@ Location* loc_new(char* fname);
 void loc_reset(Location* loc);
 void loc_free(Location* loc);
 
+// Line-start table
+// Records the offset of the first character of every line in a source file, so that the line and column of a
+// token (which only stores its offset) can be resolved on demand (by binary search) - typically only for diagnostics.
+typedef struct LineTable {
+    UInt32* starts;     // `starts[i]` is the offset of the first character of line `i + 1`
+    UInt32 num_lines;
+} LineTable;
+
+LineTable* line_table_new(const char* data, UInt32 len);
+void line_table_free(LineTable* lines);
+// Returns the (1-based) line and column of `offset`. The `fname` of the returned Location is null
+Location line_table_loc(LineTable* lines, UInt32 offset);
+
 #endif // ADORAD_LOCATION_H
\ No newline at end of file
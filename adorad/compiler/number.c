@@ -0,0 +1,619 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+#include <adorad/core/debug.h>
+#include <adorad/core/misc.h>
+#include <adorad/compiler/number.h>
+
+// <adorad/core/endian.h> is header-only (and its functions are static): define them in this file
+#define CORETEN_IMPL
+    #include <adorad/core/endian.h>
+#undef CORETEN_IMPL
+
+// Largest value that 8 more decimal digits can be appended to without overflowing a UInt64
+#define NUMBER_MAX_BEFORE_8_DIGITS  ((UInt64_MAX - 99999999ull) / 100000000ull)
+// No. of decimal digits that always fit in a UInt64
+#define NUMBER_MAX_MANTISSA_DIGITS  19
+
+// Load 8 bytes of `data` as a little-endian word (the first byte in the lowest bits)
+static inline UInt64 number_load8(const char* data) {
+    UInt64 word;
+    memcpy(&word, data, sizeof(word));
+#if NATIVE_IS_BIG_ENDIAN
+    word = endian_swap64(word);
+#endif // NATIVE_IS_BIG_ENDIAN
+    return word;
+}
+
+// Are the 8 bytes of `word` all ASCII digits?
+static inline bool number_is_8_digits(UInt64 word) {
+    return ((word & 0xF0F0F0F0F0F0F0F0ull) | 
+            (((word + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) == 0x3333333333333333ull;
+}
+
+// Value of the 8 digits in `word` (see `number_load8()`)
+static inline UInt32 number_parse_8_digits(UInt64 word) {
+    const UInt64 mask = 0x000000FF000000FFull;
+    const UInt64 mul1 = 0x000F424000000064ull;     // 100 + (1000000 << 32)
+    const UInt64 mul2 = 0x0000271000000001ull;     // 1 + (10000 << 32)
+    word -= 0x3030303030303030ull;
+    // Pairs of digits, then groups of 4, then all 8
+    word = (word * 10) + (word >> 8);
+    word = (((word & mask) * mul1) + (((word >> 16) & mask) * mul2)) >> 32;
+    return cast(UInt32)word;
+}
+
+// `*value = *value * mul + add`. Returns false (leaving `value` as it is) on overflow
+static inline bool number_mul_add(UInt64* value, UInt64 mul, UInt64 add) {
+    if(*value > (UInt64_MAX - add) / mul)
+        return false;
+    *value = *value * mul + add;
+    return true;
+}
+
+// Value of the (hexadecimal) digit `c`, or 0xFF if it isn't one
+static inline UInt32 number_digit_value(char c) {
+    if(c >= '0' && c <= '9')
+        return cast(UInt32)(c - '0');
+    c = cast(char)(c | 0x20);
+    if(c >= 'a' && c <= 'f')
+        return cast(UInt32)(c - 'a' + 10);
+    return 0xFF;
+}
+
+// Convert digits of `bits` bits each (a `0x`, `0b` or `0o` literal, past the prefix)
+static NumberResult number_parse_radix(const char* data, UInt32 len, UInt32 bits, UInt64* value) {
+    UInt64 result = 0;
+    bool has_digits = false;
+    for(UInt32 i = 0; i < len; i++) {
+        if(data[i] == '_')
+            continue;
+        UInt32 digit = number_digit_value(data[i]);
+        if(digit >= (1u << bits))
+            return NumberInvalid;
+        if(result >> (64 - bits) != 0)
+            return NumberOverflow;
+        result = (result << bits) | digit;
+        has_digits = true;
+    }
+    *value = result;
+    return has_digits ? NumberOk : NumberInvalid;
+}
+
+NumberResult number_parse_int(const char* data, UInt32 len, UInt64* value) {
+    *value = 0;
+    if(len > 2 && data[0] == '0') {
+        switch(data[1]) {
+            case 'x': case 'X': return number_parse_radix(data + 2, len - 2, 4, value);
+            case 'b': case 'B': return number_parse_radix(data + 2, len - 2, 1, value);
+            case 'o': case 'O': return number_parse_radix(data + 2, len - 2, 3, value);
+            default: break;
+        }
+    }
+
+    UInt64 result = 0;
+    bool has_digits = false;
+    UInt32 pos = 0;
+    while(pos < len) {
+        if(pos + 8 <= len) {
+            UInt64 word = number_load8(data + pos);
+            if(number_is_8_digits(word)) {
+                UInt64 chunk = number_parse_8_digits(word);
+                if(CORETEN_LIKELY(result <= NUMBER_MAX_BEFORE_8_DIGITS))
+                    result = result * 100000000ull + chunk;
+                else if(!number_mul_add(&result, 100000000ull, chunk))
+                    return NumberOverflow;
+                has_digits = true;
+                pos += 8;
+                continue;
+            }
+        }
+
+        char c = data[pos++];
+        if(c == '_')
+            continue;
+        UInt32 digit = cast(UInt32)(cast(UInt8)(c - '0'));
+        if(digit > 9)
+            return NumberInvalid;
+        if(!number_mul_add(&result, 10, digit))
+            return NumberOverflow;
+        has_digits = true;
+    }
+    *value = result;
+    return has_digits ? NumberOk : NumberInvalid;
+}
+
+/*
+    Floats
+*/
+
+// `a * b`: returns the low 64 bits of the product, and sets `hi` to the high 64 bits
+static inline UInt64 number_mul128(UInt64 a, UInt64 b, UInt64* hi) {
+#if defined(__SIZEOF_INT128__)
+    __extension__ unsigned __int128 product = cast(unsigned __int128)a * b;
+    *hi = cast(UInt64)(product >> 64);
+    return cast(UInt64)product;
+#else
+    UInt64 a_lo = a & 0xFFFFFFFFull, a_hi = a >> 32;
+    UInt64 b_lo = b & 0xFFFFFFFFull, b_hi = b >> 32;
+    UInt64 p0 = a_lo * b_lo, p1 = a_lo * b_hi, p2 = a_hi * b_lo, p3 = a_hi * b_hi;
+    UInt64 mid = (p0 >> 32) + (p1 & 0xFFFFFFFFull) + (p2 & 0xFFFFFFFFull);
+    *hi = p3 + (p1 >> 32) + (p2 >> 32) + (mid >> 32);
+    return (mid << 32) | (p0 & 0xFFFFFFFFull);
+#endif // __SIZEOF_INT128__
+}
+
+// No. of leading zero bits of `x` (which isn't 0)
+static inline UInt32 number_clz64(UInt64 x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return cast(UInt32)__builtin_clzll(x);
+#else
+    UInt32 n = 0;
+    while((x & 0x8000000000000000ull) == 0) {
+        x <<= 1;
+        ++n;
+    }
+    return n;
+#endif // __GNUC__
+}
+
+static inline double number_from_bits(UInt64 bits) {
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Eisel-Lemire: the bits of the double nearest to `mantissa * 10^exp10` (`mantissa` isn't 0, and `exp10` is in the
+// range of `numberPowersOfTen`). Returns false if that can't be decided from the 128-bit approximation of 10^exp10,
+// or if the result isn't a normal double.
+static bool number_eisel_lemire(UInt64 mantissa, Int32 exp10, UInt64* bits) {
+    // Normalize the mantissa. The binary exponent is floor(exp10 * log2(10)) (217706 / 2^16 ~= log2(10))
+    UInt32 clz = number_clz64(mantissa);
+    mantissa <<= clz;
+    Int64 scaled = cast(Int64)217706 * exp10;
+    Int64 exp2 = scaled >= 0 ? scaled >> 16 : -((-scaled + 65535) >> 16);
+    UInt64 ret_exp2 = cast(UInt64)(exp2 + 64 + 1023) - clz;
+
+    // The top 64 bits of the product are enough, unless they're right at a rounding boundary
+    const UInt64* power = numberPowersOfTen[exp10 - NUMBER_POW10_MIN];
+    UInt64 x_hi;
+    UInt64 x_lo = number_mul128(mantissa, power[1], &x_hi);
+    if((x_hi & 0x1FF) == 0x1FF && x_lo + mantissa < mantissa) {
+        // Wider approximation: bring in the low 64 bits of the power
+        UInt64 y_hi;
+        UInt64 y_lo = number_mul128(mantissa, power[0], &y_hi);
+        UInt64 merged_hi = x_hi;
+        UInt64 merged_lo = x_lo + y_hi;
+        if(merged_lo < x_lo)
+            ++merged_hi;
+        if((merged_hi & 0x1FF) == 0x1FF && merged_lo + 1 == 0 && y_lo + mantissa < mantissa)
+            return false;
+        x_hi = merged_hi;
+        x_lo = merged_lo;
+    }
+
+    // Shift to 54 bits
+    UInt64 msb = x_hi >> 63;
+    UInt64 ret_mantissa = x_hi >> (msb + 9);
+    ret_exp2 -= 1 ^ msb;
+
+    // Halfway between two doubles: which way to round depends on the bits we don't have
+    if(x_lo == 0 && (x_hi & 0x1FF) == 0 && (ret_mantissa & 3) == 1)
+        return false;
+
+    // From 54 to 53 bits (rounding to even)
+    ret_mantissa += ret_mantissa & 1;
+    ret_mantissa >>= 1;
+    if(ret_mantissa >> 53 > 0) {
+        ret_mantissa >>= 1;
+        ++ret_exp2;
+    }
+    // Subnormal (0 or, having wrapped around, huge) or infinite
+    if(ret_exp2 - 1 >= 0x7FF - 1)
+        return false;
+    *bits = (ret_exp2 << 52) | (ret_mantissa & 0x000FFFFFFFFFFFFFull);
+    return true;
+}
+
+/*
+    Big decimal (the slow path)
+    An exact decimal (`0.digits * 10^decimal_point`), scaled by powers of 2 until it's in the range of a double's 
+    mantissa, and then rounded. Only the first `NUMBER_DECIMAL_DIGITS` digits are kept, which is always enough to 
+    decide the rounding of a double (`is_truncated` breaks ties).
+*/
+
+#define NUMBER_DECIMAL_DIGITS   800
+// Largest shift `number_decimal_shift()` does at once (9 << shift must fit in a UInt64)
+#define NUMBER_DECIMAL_MAX_SHIFT    60
+
+typedef struct NumberDecimal {
+    UInt8 digits[NUMBER_DECIMAL_DIGITS];    // most significant first
+    Int32 num_digits;
+    Int32 decimal_point;
+    bool is_truncated;                      // set if non-zero digits were dropped
+} NumberDecimal;
+
+static void number_decimal_trim(NumberDecimal* dec) {
+    while(dec->num_digits > 0 && dec->digits[dec->num_digits - 1] == 0)
+        --dec->num_digits;
+    if(dec->num_digits == 0)
+        dec->decimal_point = 0;
+}
+
+// Set `dec` to the float literal `[data, data + len)` (already validated by `number_parse_float()`)
+static void number_decimal_set(NumberDecimal* dec, const char* data, UInt32 len) {
+    dec->num_digits = 0;
+    dec->decimal_point = 0;
+    dec->is_truncated = false;
+
+    bool has_dot = false;
+    UInt32 pos = 0;
+    for(; pos < len; pos++) {
+        char c = data[pos];
+        if(c == '_')
+            continue;
+        if(c == '.') {
+            has_dot = true;
+            dec->decimal_point = dec->num_digits;
+            continue;
+        }
+        if(c < '0' || c > '9')
+            break;
+        // Leading zeros
+        if(c == '0' && dec->num_digits == 0) {
+            --dec->decimal_point;
+            continue;
+        }
+        if(dec->num_digits < NUMBER_DECIMAL_DIGITS)
+            dec->digits[dec->num_digits++] = cast(UInt8)(c - '0');
+        else if(c != '0')
+            dec->is_truncated = true;
+    }
+    if(!has_dot)
+        dec->decimal_point = dec->num_digits;
+
+    // Exponent
+    if(pos < len) {
+        ++pos;
+        Int32 sign = 1;
+        if(data[pos] == '+' || data[pos] == '-')
+            sign = data[pos++] == '-' ? -1 : 1;
+        Int32 exponent = 0;
+        for(; pos < len; pos++) {
+            if(data[pos] != '_' && exponent < 10000)
+                exponent = exponent * 10 + (data[pos] - '0');
+        }
+        dec->decimal_point += sign * exponent;
+    }
+    number_decimal_trim(dec);
+}
+
+// `dec *= 2^shift`
+static void number_decimal_left_shift(NumberDecimal* dec, UInt32 shift) {
+    // The digits of the result, least significant first. 2^shift has at most 19 digits, and so does the carry
+    UInt8 result[NUMBER_DECIMAL_DIGITS + 20];
+    Int32 len = 0;
+    UInt64 n = 0;
+    for(Int32 i = dec->num_digits - 1; i >= 0; i--) {
+        n += cast(UInt64)dec->digits[i] << shift;
+        result[len++] = cast(UInt8)(n % 10);
+        n /= 10;
+    }
+    while(n > 0) {
+        result[len++] = cast(UInt8)(n % 10);
+        n /= 10;
+    }
+
+    Int32 num_digits = len < NUMBER_DECIMAL_DIGITS ? len : NUMBER_DECIMAL_DIGITS;
+    for(Int32 i = 0; i < len - num_digits; i++) {
+        if(result[i] != 0)
+            dec->is_truncated = true;
+    }
+    for(Int32 i = 0; i < num_digits; i++)
+        dec->digits[i] = result[len - 1 - i];
+    dec->decimal_point += len - dec->num_digits;
+    dec->num_digits = num_digits;
+    number_decimal_trim(dec);
+}
+
+// `dec /= 2^shift`
+static void number_decimal_right_shift(NumberDecimal* dec, UInt32 shift) {
+    Int32 read = 0;
+    Int32 write = 0;
+    UInt64 n = 0;
+
+    // Pick up enough leading digits to cover the first shift
+    for(; (n >> shift) == 0; read++) {
+        if(read >= dec->num_digits) {
+            if(n == 0) {
+                dec->num_digits = 0;
+                return;
+            }
+            while((n >> shift) == 0) {
+                n *= 10;
+                ++read;
+            }
+            break;
+        }
+        n = n * 10 + dec->digits[read];
+    }
+    dec->decimal_point -= read - 1;
+
+    // Pick up a digit, put down a digit
+    UInt64 mask = (cast(UInt64)1 << shift) - 1;
+    for(; read < dec->num_digits; read++) {
+        UInt64 digit = n >> shift;
+        n &= mask;
+        dec->digits[write++] = cast(UInt8)digit;
+        n = n * 10 + dec->digits[read];
+    }
+
+    // Put down the remaining digits
+    while(n > 0) {
+        UInt64 digit = n >> shift;
+        n &= mask;
+        if(write < NUMBER_DECIMAL_DIGITS)
+            dec->digits[write++] = cast(UInt8)digit;
+        else if(digit > 0)
+            dec->is_truncated = true;
+        n *= 10;
+    }
+    dec->num_digits = write;
+    number_decimal_trim(dec);
+}
+
+// `dec *= 2^shift` (`shift` may be negative)
+static void number_decimal_shift(NumberDecimal* dec, Int32 shift) {
+    if(dec->num_digits == 0)
+        return;
+    for(; shift > NUMBER_DECIMAL_MAX_SHIFT; shift -= NUMBER_DECIMAL_MAX_SHIFT)
+        number_decimal_left_shift(dec, NUMBER_DECIMAL_MAX_SHIFT);
+    for(; shift < -NUMBER_DECIMAL_MAX_SHIFT; shift += NUMBER_DECIMAL_MAX_SHIFT)
+        number_decimal_right_shift(dec, NUMBER_DECIMAL_MAX_SHIFT);
+    if(shift > 0)
+        number_decimal_left_shift(dec, cast(UInt32)shift);
+    else if(shift < 0)
+        number_decimal_right_shift(dec, cast(UInt32)-shift);
+}
+
+// Should `dec` be rounded up, if cut to its first `num_digits` digits (round half to even)?
+static bool number_decimal_should_round_up(NumberDecimal* dec, Int32 num_digits) {
+    if(num_digits < 0 || num_digits >= dec->num_digits)
+        return false;
+    // Exactly halfway (unless digits were dropped)
+    if(dec->digits[num_digits] == 5 && num_digits + 1 == dec->num_digits) {
+        if(dec->is_truncated)
+            return true;
+        return num_digits > 0 && dec->digits[num_digits - 1] % 2 == 1;
+    }
+    return dec->digits[num_digits] >= 5;
+}
+
+// The integer part of `dec`, rounded
+static UInt64 number_decimal_rounded_integer(NumberDecimal* dec) {
+    if(dec->decimal_point > 20)
+        return UInt64_MAX;
+    UInt64 n = 0;
+    Int32 i = 0;
+    for(; i < dec->decimal_point && i < dec->num_digits; i++)
+        n = n * 10 + dec->digits[i];
+    for(; i < dec->decimal_point; i++)
+        n *= 10;
+    if(number_decimal_should_round_up(dec, dec->decimal_point))
+        ++n;
+    return n;
+}
+
+// The bits of the double nearest to `dec` (whose contents are lost). Sets `is_overflow` if that's infinity
+static UInt64 number_decimal_to_bits(NumberDecimal* dec, bool* is_overflow) {
+    // No. of bits to shift by to scale by (at least) 10^i
+    static const Int32 powers[] = { 1, 3, 6, 9, 13, 16, 19, 23, 26 };
+    const Int32 num_powers = cast(Int32)(sizeof(powers) / sizeof(powers[0]));
+    const Int32 bias = -1023;
+    const Int32 mantissa_bits = 52;
+    const Int32 max_exp = (1 << 11) - 1;
+
+    Int32 exp = 0;
+    UInt64 mantissa = 0;
+    *is_overflow = false;
+
+    if(dec->num_digits == 0 || dec->decimal_point < -330) {
+        exp = bias;
+        goto done;
+    }
+    if(dec->decimal_point > 310)
+        goto overflow;
+
+    // Scale by powers of 2 until in the range [0.5, 1)
+    while(dec->decimal_point > 0) {
+        Int32 n = dec->decimal_point >= num_powers ? 27 : powers[dec->decimal_point];
+        number_decimal_shift(dec, -n);
+        exp += n;
+    }
+    while(dec->decimal_point < 0 || (dec->decimal_point == 0 && dec->digits[0] < 5)) {
+        Int32 n = -dec->decimal_point >= num_powers ? 27 : powers[-dec->decimal_point];
+        number_decimal_shift(dec, n);
+        exp -= n;
+    }
+    // [0.5, 1) -> [1, 2)
+    --exp;
+
+    // Subnormals: the smallest exponent is `bias + 1`
+    if(exp < bias + 1) {
+        Int32 n = bias + 1 - exp;
+        number_decimal_shift(dec, -n);
+        exp += n;
+    }
+    if(exp - bias >= max_exp)
+        goto overflow;
+
+    // Extract `1 + mantissa_bits` bits
+    number_decimal_shift(dec, 1 + mantissa_bits);
+    mantissa = number_decimal_rounded_integer(dec);
+    // Rounding may have added a bit
+    if(mantissa == (cast(UInt64)2 << mantissa_bits)) {
+        mantissa >>= 1;
+        ++exp;
+        if(exp - bias >= max_exp)
+            goto overflow;
+    }
+    if((mantissa & (cast(UInt64)1 << mantissa_bits)) == 0)
+        exp = bias;
+    goto done;
+
+overflow:
+    mantissa = 0;
+    exp = max_exp + bias;
+    *is_overflow = true;
+
+done:;
+    UInt64 bits = mantissa & ((cast(UInt64)1 << mantissa_bits) - 1);
+    bits |= cast(UInt64)((exp - bias) & max_exp) << mantissa_bits;
+    return bits;
+}
+
+// Exactly representable powers of ten (for Clinger's fast path)
+static const double number_exact_powers[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+// Accumulate the digits (and `_`s) at `data[*pos]..` into the mantissa. Digits past the first 
+// NUMBER_MAX_MANTISSA_DIGITS significant ones are dropped. `kept_scale` is added to the exponent for each digit kept,
+// and `dropped_scale` for each one dropped.
+static inline void number_read_digits(const char* data, UInt32 len, UInt32* pos, UInt64* mantissa, Int64* exponent,
+                                      UInt32* num_digits, bool* is_truncated, bool* has_digits, 
+                                      Int64 kept_scale, Int64 dropped_scale) {
+    UInt32 i = *pos;
+    while(i < len) {
+        // 8 digits at once, while they're sure to be kept
+        if(*num_digits > 0 && *num_digits + 8 <= NUMBER_MAX_MANTISSA_DIGITS && i + 8 <= len) {
+            UInt64 word = number_load8(data + i);
+            if(number_is_8_digits(word)) {
+                *mantissa = *mantissa * 100000000ull + number_parse_8_digits(word);
+                *num_digits += 8;
+                *exponent += 8 * kept_scale;
+                *has_digits = true;
+                i += 8;
+                continue;
+            }
+        }
+
+        char c = data[i];
+        if(c == '_') {
+            ++i;
+            continue;
+        }
+        if(c < '0' || c > '9')
+            break;
+        UInt32 digit = cast(UInt32)(c - '0');
+        if(*num_digits < NUMBER_MAX_MANTISSA_DIGITS) {
+            *mantissa = *mantissa * 10 + digit;
+            // Leading zeros aren't significant
+            *num_digits += *mantissa != 0;
+            *exponent += kept_scale;
+        } else {
+            *exponent += dropped_scale;
+            *is_truncated = *is_truncated || digit != 0;
+        }
+        *has_digits = true;
+        ++i;
+    }
+    *pos = i;
+}
+
+NumberResult number_parse_float(const char* data, UInt32 len, double* value) {
+    *value = 0.0;
+    UInt64 mantissa = 0;
+    Int64 exponent = 0;
+    UInt32 num_digits = 0;
+    bool is_truncated = false;
+    bool has_digits = false;
+    UInt32 pos = 0;
+
+    // Integer part, then fraction
+    number_read_digits(data, len, &pos, &mantissa, &exponent, &num_digits, &is_truncated, &has_digits, 0, 1);
+    if(pos < len && data[pos] == '.') {
+        ++pos;
+        number_read_digits(data, len, &pos, &mantissa, &exponent, &num_digits, &is_truncated, &has_digits, -1, 0);
+    }
+    if(!has_digits)
+        return NumberInvalid;
+
+    // Exponent
+    if(pos < len && (data[pos] == 'e' || data[pos] == 'E')) {
+        ++pos;
+        bool is_negative = false;
+        if(pos < len && (data[pos] == '+' || data[pos] == '-'))
+            is_negative = data[pos++] == '-';
+        Int64 exp10 = 0;
+        bool has_exp_digits = false;
+        for(; pos < len && ((data[pos] >= '0' && data[pos] <= '9') || data[pos] == '_'); pos++) {
+            if(data[pos] == '_')
+                continue;
+            // Anything this large is 0 or infinity anyway
+            if(exp10 < 100000)
+                exp10 = exp10 * 10 + (data[pos] - '0');
+            has_exp_digits = true;
+        }
+        if(!has_exp_digits)
+            return NumberInvalid;
+        exponent += is_negative ? -exp10 : exp10;
+    }
+    if(pos != len)
+        return NumberInvalid;
+
+    if(mantissa == 0)
+        return NumberOk;
+
+#if FLT_EVAL_METHOD == 0
+    // Clinger's fast path: the mantissa and the power of ten are both exact doubles, so a single (correctly rounded)
+    // operation gives the correctly rounded result
+    if(!is_truncated && mantissa <= (cast(UInt64)1 << 53) && exponent >= -22 && exponent <= 22) {
+        double result = cast(double)mantissa;
+        *value = exponent < 0 ? result / number_exact_powers[-exponent] : result * number_exact_powers[exponent];
+        return NumberOk;
+    }
+#endif // FLT_EVAL_METHOD
+
+    // The mantissa has at most 19 digits, so this is below half the smallest subnormal (or above the largest double)
+    if(exponent < NUMBER_POW10_MIN)
+        return NumberOk;
+    if(exponent > NUMBER_POW10_MAX) {
+        *value = HUGE_VAL;
+        return NumberOverflow;
+    }
+
+    // If digits were dropped, the value is somewhere between `mantissa` and `mantissa + 1` (times 10^exponent): we 
+    // have the answer if both round to the same double
+    UInt64 bits = 0;
+    bool is_exact = number_eisel_lemire(mantissa, cast(Int32)exponent, &bits);
+    if(is_exact && is_truncated) {
+        UInt64 bits_up = 0;
+        is_exact = number_eisel_lemire(mantissa + 1, cast(Int32)exponent, &bits_up) && bits_up == bits;
+    }
+    if(is_exact) {
+        *value = number_from_bits(bits);
+        return NumberOk;
+    }
+
+    NumberDecimal dec;
+    bool is_overflow = false;
+    number_decimal_set(&dec, data, len);
+    *value = number_from_bits(number_decimal_to_bits(&dec, &is_overflow));
+    return is_overflow ? NumberOverflow : NumberOk;
+}
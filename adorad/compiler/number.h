@@ -0,0 +1,53 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#ifndef ADORAD_NUMBER_H
+#define ADORAD_NUMBER_H
+
+#include <adorad/core/types.h>
+
+/*
+    Numeric literal conversion
+    The Lexer only checks numbers (see lexer.h) - these convert the text of an `INTEGER`, `HEX_INT`, `BIN_INT`, 
+    `OCT_INT` or `FLOAT_LIT` token to its value. They read the token's slice of the Lexical buffer directly (`_` digit
+    separators are skipped), allocate nothing, and never call into libc's `strto*()`.
+
+    Integers: decimal digits are converted 8 at a time (SWAR - a single 64-bit load, validated and combined with 3 
+    multiplications), falling back to one digit at a time around separators and at the end.
+    
+    Floats: the decimal mantissa (its first 19 digits) and exponent are converted with the Eisel-Lemire algorithm - 
+    one or two 64x64 -> 128-bit multiplications by a table of powers of ten (see powers.c) - which gives the correctly
+    rounded double in all but a vanishingly small number of cases. Small exact cases take Clinger's fast path instead.
+    When neither can decide (a mantissa with more than 19 digits that rounds differently depending on the digits that
+    were dropped, or a halfway case), the number is converted exactly with a (simple) big decimal.
+*/
+
+typedef enum NumberResult {
+    NumberOk,
+    NumberOverflow,     // the value doesn't fit (a UInt64, or a finite double - which is then +inf)
+    NumberInvalid,      // not a number of the expected form
+} NumberResult;
+
+// Range of the exponents (of ten) in `numberPowersOfTen`
+#define NUMBER_POW10_MIN    (-348)
+#define NUMBER_POW10_MAX    347
+
+extern const UInt64 numberPowersOfTen[NUMBER_POW10_MAX - NUMBER_POW10_MIN + 1][2];
+
+// Convert the integer literal `[data, data + len)` - decimal, or `0x`, `0b` or `0o`-prefixed - into `value`
+NumberResult number_parse_int(const char* data, UInt32 len, UInt64* value);
+// Convert the (decimal) float literal `[data, data + len)` - eg. `1.5`, `.5`, `2e-3`, `1_000.0` - into `value`, 
+// correctly rounded (to nearest, ties to even)
+NumberResult number_parse_float(const char* data, UInt32 len, double* value);
+
+#endif // ADORAD_NUMBER_H
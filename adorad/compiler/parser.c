@@ -27,23 +27,32 @@ Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
         TODO
 */
 
+#include <string.h>
+
 #include <adorad/compiler/ast.h>
+#include <adorad/compiler/fold.h>
+#include <adorad/compiler/number.h>
 #include <adorad/compiler/parser.h>
+#include <adorad/compiler/precedence.h>
 #include <adorad/core/debug.h>
+#include <adorad/core/hash.h>
 #include <adorad/core/os.h>
 
 #define pt      parser->toklist
 #define pc      parser->curr_tok
 
-#define NODEPUSH(node)          vec_push(parser->nodelist, node)
+#define NODEPUSH(node)          vec_push_AstNode(parser->nodelist, node)
 
 #define CHOMP(n)                parser_chomp(parser, n)
 #define CHOMP_IF(kind)          parser_chomp_if(parser, kind)
 #define EXPECT_TOK(kind)        parser_expect_token(parser, kind)
 
-#define AST_ERROR(...)          dread(ErrorParseError, __VA_ARGS__)
+#define AST_LOC                 lexer_loc(parser->lexer, pc->offset)
+#define AST_ERROR(...)          parser_error(parser, ErrorParseError, __VA_ARGS__)
 #define AST_EXPECTED(...)       AST_ERROR("Expected %s; got `%s`", (__VA_ARGS__), tokenHash[pc->kind])
-#define AST_UNEXPECTED(...)     dread(ErrorUnexpectedToken, __VA_ARGS__)
+#define AST_UNEXPECTED(...)     parser_error(parser, ErrorUnexpectedToken, __VA_ARGS__)
+// For (valid) syntax the Parser can't handle yet: an error like any other, so that the rest of the file is parsed
+#define AST_UNSUPPORTED(what)   parser_error(parser, ErrorUnsupported, "%s aren't supported yet", (what))
 
 #ifdef ADORAD_DEBUG
     #define TRACE_PARSER()                                                \
@@ -52,20 +61,30 @@ Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
             "parsing file: `%s` | curr_tok: `%s` | location: `%d:%d`",    \
             parser->fullpath,                                             \
             tokenHash[parser->curr_tok->kind],                            \
-            parser->loc->line,                                            \
-            parser->loc->col                                              \
+            AST_LOC.line,                                                 \
+            AST_LOC.col                                                   \
         )
 #else
     #define TRACE_PARSER()
 #endif // ADORAD_DEBUG
 
+// Use the Lexer's Interner if it has one, or make one of our own
+static void parser_init_interner(Parser* parser) {
+    parser->interner = parser->lexer->interner;
+    parser->owns_interner = NONE(parser->interner);
+    if(parser->owns_interner)
+        parser->interner = interner_new();
+}
+
 // Initialize a new Parser
 Parser* parser_init(Lexer* lexer) {
     Parser* parser = cast(Parser*)calloc(1, sizeof(Parser));
     parser->fullpath = lexer->loc->fname;
     // Generally, the ratio of lexer tokens to parser nodes is about 4:1
     // So, preallocate roughly 25% of the number of lexer tokens
-    parser->nodelist = VEC_NEW(AstNode, cast(UInt64)(vec_size(lexer->toklist) * .25));
+    parser->nodelist = VEC_NEW(AstNode, cast(UInt64)(vec_size(lexer->toklist) * .25) + 1);
+    parser->decls = VEC_NEW(ParserDecl, 64);
+    parser->ast = ast_new(cast(UInt32)(vec_size(lexer->toklist) / 4));
     parser->lexer = lexer;
     parser->toklist = lexer->toklist;
     parser->curr_tok = cast(Token*)vec_at(parser->toklist, 0);
@@ -73,18 +92,131 @@ Parser* parser_init(Lexer* lexer) {
     parser->num_tokens = vec_size(parser->toklist);
     parser->num_lines = 0;
     parser->mod_name = null;
+    parser->arena = arena_new(0);
+    parser->diags = lexer->diags;
+    parser->stats = lexer->stats;
+    parser->fold_constants = true;
+    parser->on_error = null;
+    parser_init_interner(parser);
+    return parser;
+}
+
+// Initialize a new Parser that pulls tokens from `lexer` on demand
+Parser* parser_init_stream(Lexer* lexer) {
+    Parser* parser = cast(Parser*)calloc(1, sizeof(Parser));
+    parser->fullpath = lexer->loc->fname;
+    // We don't know the number of tokens up front
+    parser->nodelist = VEC_NEW(AstNode, TOKENLIST_ALLOC_CAPACITY / 4);
+    parser->decls = VEC_NEW(ParserDecl, 1);
+    parser->ast = ast_new(TOKENLIST_ALLOC_CAPACITY / 4);
+    parser->lexer = lexer;
+    parser->toklist = null;
+    parser->is_streaming = true;
+    parser->curr_tok = lexer_peek_token(lexer, 0);
+    parser->offset = 0;
+    parser->num_tokens = 0;
+    parser->num_lines = 0;
+    parser->mod_name = null;
+    parser->arena = arena_new(0);
+    parser->diags = lexer->diags;
+    parser->stats = lexer->stats;
+    parser->fold_constants = true;
+    parser->on_error = null;
+    parser_init_interner(parser);
     return parser;
 }
 
+// Returns the symbol of `token` (an identifier or a string)
+static inline SymbolId parser_symbol(Parser* parser, Token* token) {
+    if(token->symbol != SYMBOL_NULL)
+        return token->symbol;
+    return interner_intern_view(parser->interner, lexer_value(parser->lexer, token));
+}
+
+// Report an error at the current token.
+// If the Parser has a Diagnostics, the error is reported there and we jump back to the innermost synchronization
+// point. Otherwise (or if there's no synchronization point), we exit.
+ATTRIBUTE_COLD
+ATTRIBUTE_NORETURN
+ATTRIBUTE_PRINTF(3, 4)
+static void parser_error(Parser* parser, Error err, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    if(NONE(parser->diags) || NONE(parser->on_error)) {
+        char buffer[256];
+        vsnprintf(buffer, sizeof(buffer), format, args);
+        va_end(args);
+        dread_at(err, AST_LOC, "%s", buffer);
+    }
+
+    parser->has_errors = true;
+    // An illegal token has already been reported by the Lexer
+    if(pc->kind != TOK_ILLEGAL) {
+        diagnostics_vreport(parser->diags, DiagnosticLevelError, err, AST_LOC, pc->offset, pc->offset + pc->len, 
+                            format, args);
+    }
+    va_end(args);
+    longjmp(*parser->on_error, 1);
+}
+
+// Report an error at `tok` without giving up on the current declaration (for errors that don't affect how the rest of
+// it parses). Without a Diagnostics, we exit as `parser_error()` does.
+ATTRIBUTE_COLD
+ATTRIBUTE_PRINTF(4, 5)
+static void parser_report_at(Parser* parser, const Token* tok, Error err, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    Location loc = lexer_loc(parser->lexer, tok->offset);
+    if(NONE(parser->diags)) {
+        char buffer[256];
+        vsnprintf(buffer, sizeof(buffer), format, args);
+        va_end(args);
+        dread_at(err, loc, "%s", buffer);
+    }
+
+    parser->has_errors = true;
+    diagnostics_vreport(parser->diags, DiagnosticLevelError, err, loc, tok->offset, tok->offset + tok->len, format, 
+                        args);
+    va_end(args);
+}
+
+// Returns the token `n` tokens after the current one (`n` < LEXER_LOOKAHEAD), without consuming anything. Past the
+// end, this is the TOK_EOF token.
+// NB: Always look ahead with this (never with `pc + n`): in streaming mode, `pc` points into the Lexer's ring
+static inline Token* parser_peek(Parser* parser, UInt32 n) {
+    if(parser->is_streaming)
+        return lexer_peek_token(parser->lexer, n);
+
+    if(parser->offset + n >= parser->num_tokens)
+        return cast(Token*)vec_at(parser->toklist, parser->num_tokens - 1);
+    return parser->curr_tok + n;
+}
+
 static inline Token* parser_peek_next(Parser* parser) {
+    if(parser->is_streaming)
+        return pc->kind == TOK_EOF ? null : lexer_peek_token(parser->lexer, 1);
+
     if(parser->offset + 1 >= parser->num_tokens)
         return null;
 
-    return cast(Token*)(parser->toklist + parser->offset + 1);
+    return parser->curr_tok + 1;
 }
 
 // Consumes a token and moves on to the next `n` tokens
 static inline Token* parser_chomp(Parser* parser, UInt64 n) {
+    if(parser->is_streaming) {
+        // Same as below: don't move if that would take us past TOK_EOF
+        for(UInt32 i = 0; i < n; i++)
+            if(lexer_peek_token(parser->lexer, i)->kind == TOK_EOF)
+                return null;
+
+        for(UInt32 i = 0; i < n; i++)
+            lexer_next_token(parser->lexer);
+        parser->offset += n;
+        parser->curr_tok = lexer_peek_token(parser->lexer, 0);
+        return parser->curr_tok;
+    }
+
     if(parser->offset + n >= parser->num_tokens)
         return null;
 
@@ -94,10 +226,13 @@ static inline Token* parser_chomp(Parser* parser, UInt64 n) {
 }
 
 // Expect the current token's kind to match `tokenkind`.
-// If it does, move on to the next token, otherwise throw an error.
+// If it does, move on to the next token (and return the one that matched), otherwise throw an error.
 static inline Token* parser_expect_token(Parser* parser, TokenKind tokenkind) {
-    if(pc->kind == tokenkind)
-        return CHOMP(1);
+    if(pc->kind == tokenkind) {
+        Token* token = pc;
+        CHOMP(1);
+        return token;
+    }
 
     AST_ERROR(
         "Expected `%s`; got `%s`",
@@ -108,7 +243,7 @@ static inline Token* parser_expect_token(Parser* parser, TokenKind tokenkind) {
     return null; // Clang complains despite this point never being reached
 }
 
-// If the current token matches the expected token, consume it and move on to the next. If not, return null.
+// If the current token matches the expected token, consume (and return) it. If not, return null.
 // There is no fundamental difference between this and `parser_expect_token` expect that this function does not 
 // throw an error and is useful for checking for "optional" tokens (like semicolons)
 // I could modify `parser_expect_token` to accept a boolean whether to throw an error or not,
@@ -117,8 +252,11 @@ static inline Token* parser_expect_token(Parser* parser, TokenKind tokenkind) {
 // Will need to re-work on how I approach this. 
 // TODO(jasmcaus)
 static inline Token* parser_chomp_if(Parser* parser, TokenKind tokenkind) {
-    if(pc->kind == tokenkind)
-        return CHOMP(1);
+    if(pc->kind == tokenkind) {
+        Token* token = pc;
+        CHOMP(1);
+        return token;
+    }
 
     return null;
 }
@@ -126,17 +264,268 @@ static inline Token* parser_chomp_if(Parser* parser, TokenKind tokenkind) {
 static inline void parser_put_back(Parser* parser) {
     if(parser->offset == 0)
         unreachable();
-        
-    parser->curr_tok -= 1;
+    
     parser->offset -= 1;
+    if(parser->is_streaming) {
+        lexer_unget_token(parser->lexer);
+        parser->curr_tok = lexer_peek_token(parser->lexer, 0);
+        return;
+    }
+    parser->curr_tok -= 1;
+}
+
+// Skip tokens up to the next synchronization point (after an error): just past a `;` (or a braced `{ ... }`) at the 
+// current nesting level, or up to a token that begins a declaration. The current token is always skipped, except
+// for the `}` that closes the block we're in (which is left for it if `in_block` is set).
+static void parser_synchronize(Parser* parser, bool in_block) {
+    UInt32 depth = 0;
+    bool is_first = true;
+    while(pc->kind != TOK_EOF) {
+        switch(pc->kind) {
+            case LBRACE:
+                ++depth;
+                break;
+            case RBRACE:
+                if(depth == 0) {
+                    if(in_block)
+                        return;
+                    // A stray `}` at the top level
+                    break;
+                }
+                if(--depth == 0) {
+                    CHOMP(1);
+                    return;
+                }
+                break;
+            case SEMICOLON:
+                if(depth == 0) {
+                    CHOMP(1);
+                    return;
+                }
+                break;
+            case MODULE:
+            case USE:
+            case PUT:
+            case FUNC:
+            case EXPORT:
+            case STRUCT:
+            case ENUM:
+            case ATTR_COMPTIME:
+            case ATTR_INLINE:
+            case ATTR_NOINLINE:
+            case ATTR_NORETURN:
+                if(depth == 0 && !is_first)
+                    return;
+                break;
+            default:
+                break;
+        }
+        is_first = false;
+        // This is the last token
+        if(NONE(CHOMP(1)))
+            return;
+    }
 }
 
-AstNode* ast_create_node(AstNodeKind kind) {
-    AstNode* node = cast(AstNode*)calloc(1, sizeof(AstNode));
+#define AST_NEW(strct)      ARENA_NEW(parser->arena, strct)
+
+AstNode* ast_create_node(Parser* parser, AstNodeKind kind) {
+    AstNode* node = AST_NEW(AstNode);
     node->kind = kind;
+    node->index = AST_NULL;
+    if(CORETEN_UNLIKELY(SOME(parser->stats))) {
+        ++parser->stats->num_nodes;
+        ++parser->stats->nodes_by_kind[kind];
+    }
+
+    // Allocate the payload(s) that nodes of this kind are accessed through (eg. `node->data.stmt->use_stmt`)
+    switch(kind) {
+        case AstNodeKindIdentifier:
+            node->data.identifier = AST_NEW(AstNodeIdentifier);
+            break;
+        case AstNodeKindBlock:
+            node->data.stmt = AST_NEW(AstNodeStatement);
+            node->data.stmt->block_stmt = AST_NEW(AstNodeBlock);
+            break;
+        case AstNodeKindFuncPrototype:
+        case AstNodeKindFuncDecl:
+            node->data.decl = AST_NEW(AstNodeDecl);
+            node->data.decl->func_decl = AST_NEW(AstNodeFuncDecl);
+            break;
+
+        // Literals
+        case AstNodeKindIntLiteral:
+            node->data.literal = AST_NEW(AstNodeLiteral);
+            node->data.literal->int_value = AST_NEW(AstNodeIntegerLiteral);
+            break;
+        case AstNodeKindFloatLiteral:
+            node->data.literal = AST_NEW(AstNodeLiteral);
+            node->data.literal->float_value = AST_NEW(AstNodeFloatLiteral);
+            break;
+        case AstNodeKindCharLiteral:
+            node->data.literal = AST_NEW(AstNodeLiteral);
+            node->data.literal->char_value = AST_NEW(AstNodeCharLiteral);
+            break;
+        case AstNodeKindStringLiteral:
+            node->data.literal = AST_NEW(AstNodeLiteral);
+            node->data.literal->str_value = AST_NEW(AstNodeStringLiteral);
+            break;
+        case AstNodeKindBoolLiteral:
+            node->data.literal = AST_NEW(AstNodeLiteral);
+            node->data.literal->bool_value = AST_NEW(AstNodeBoolLiteral);
+            break;
+        case AstNodeKindNilLiteral:
+            node->data.literal = AST_NEW(AstNodeLiteral);
+            break;
+
+        // Declarations
+        case AstNodeKindEnumDecl:
+            node->data.type_decl = AST_NEW(AstNodeTypeDecl);
+            node->data.type_decl->enum_decl = AST_NEW(AstNodeEnumDecl);
+            break;
+        case AstNodeKindTypeDecl:
+        case AstNodeKindUnionDecl:
+            node->data.type_decl = AST_NEW(AstNodeTypeDecl);
+            break;
+        case AstNodeKindVariableDecl:
+            node->data.scope_obj = AST_NEW(AstNodeScopeObject);
+            node->data.scope_obj->var = AST_NEW(AstNodeVariable);
+            break;
+
+        // Expressions
+        case AstNodeKindFuncCallExpr:
+            node->data.expr = AST_NEW(AstNodeExpression);
+            node->data.expr->func_call_expr = AST_NEW(AstNodeFuncCallExpr);
+            break;
+        case AstNodeKindIfExpr:
+            node->data.expr = AST_NEW(AstNodeExpression);
+            node->data.expr->if_expr = AST_NEW(AstNodeIfExpr);
+            break;
+        case AstNodeKindLoopInfExpr:
+            node->data.expr = AST_NEW(AstNodeExpression);
+            node->data.expr->loop_expr = AST_NEW(AstNodeLoopExpr);
+            node->data.expr->loop_expr->loop_inf_expr = AST_NEW(AstNodeLoopInfExpr);
+            break;
+        case AstNodeKindLoopCExpr:
+            node->data.expr = AST_NEW(AstNodeExpression);
+            node->data.expr->loop_expr = AST_NEW(AstNodeLoopExpr);
+            node->data.expr->loop_expr->loop_c_expr = AST_NEW(AstNodeLoopCExpr);
+            break;
+        case AstNodeKindLoopInExpr:
+            node->data.expr = AST_NEW(AstNodeExpression);
+            node->data.expr->loop_expr = AST_NEW(AstNodeLoopExpr);
+            node->data.expr->loop_expr->loop_in_expr = AST_NEW(AstNodeLoopInExpr);
+            break;
+        case AstNodeKindMatchExpr:
+            node->data.expr = AST_NEW(AstNodeExpression);
+            node->data.expr->match_expr = AST_NEW(AstNodeMatchExpr);
+            break;
+        case AstNodeKindMatchBranch:
+            node->data.expr = AST_NEW(AstNodeExpression);
+            node->data.expr->match_branch_expr = AST_NEW(AstNodeMatchBranchExpr);
+            break;
+        case AstNodeKindMatchRange:
+            node->data.expr = AST_NEW(AstNodeExpression);
+            node->data.expr->match_range_expr = AST_NEW(AstNodeMatchRangeExpr);
+            break;
+        case AstNodeKindCatchExpr:
+            node->data.expr = AST_NEW(AstNodeExpression);
+            node->data.expr->catch_expr = AST_NEW(AstNodeCatchExpr);
+            break;
+        case AstNodeKindBinaryOpExpr:
+            node->data.expr = AST_NEW(AstNodeExpression);
+            node->data.expr->binary_op_expr = AST_NEW(AstNodeBinaryOpExpr);
+            break;
+        case AstNodeKindPrefixOpExpr:
+            node->data.prefix_op_expr = AST_NEW(AstNodePrefixOpExpr);
+            break;
+        case AstNodeKindFieldAccessExpr:
+            node->data.field_access_expr = AST_NEW(AstNodeFieldAccessExpr);
+            break;
+        case AstNodeKindAttributeExpr:
+            node->data.expr = AST_NEW(AstNodeExpression);
+            node->data.expr->attr_expr = AST_NEW(AstNodeAttributeExpr);
+            break;
+        case AstNodeKindGroupedExpr:
+            node->data.expr = AST_NEW(AstNodeExpression);
+            node->data.expr->grouped_expr = AST_NEW(AstNodeGroupedExpr);
+            break;
+        case AstNodeKindTypeExpr:
+            node->data.expr = AST_NEW(AstNodeExpression);
+            node->data.expr->type_expr = AST_NEW(AstNodeTypeExpr);
+            break;
+        case AstNodeKindInitExpr:
+        case AstNodeKindStructExpr:
+        case AstNodeKindEnumExpr:
+        case AstNodeKindArrayInitExpr:
+            node->data.expr = AST_NEW(AstNodeExpression);
+            node->data.expr->init_expr = AST_NEW(AstNodeInitExpr);
+            break;
+        case AstNodeKindSliceExpr:
+            node->data.expr = AST_NEW(AstNodeExpression);
+            node->data.expr->slice_expr = AST_NEW(AstNodeSliceExpr);
+            break;
+        case AstNodeKindArrayAccessExpr:
+            node->data.array_access_expr = AST_NEW(AstNodeArrayAccessExpr);
+            break;
+        case AstNodeKindArrayType:
+            node->data.array_type = AST_NEW(AstNodeArrayType);
+            break;
+        case AstNodeKindInferredArrayType:
+            node->data.inferred_array_type = AST_NEW(AstNodeInferredArrayType);
+            break;
+
+        // Statements
+        case AstNodeKindModuleStatement:
+            node->data.stmt = AST_NEW(AstNodeStatement);
+            node->data.stmt->module_stmt = AST_NEW(AstNodeModuleStatement);
+            break;
+        case AstNodeKindUseStatement:
+            node->data.stmt = AST_NEW(AstNodeStatement);
+            node->data.stmt->use_stmt = AST_NEW(AstNodeUseStatement);
+            break;
+        case AstNodeKindBreak:
+        case AstNodeKindContinue:
+            node->data.stmt = AST_NEW(AstNodeStatement);
+            node->data.stmt->branch_stmt = AST_NEW(AstNodeBranchStatement);
+            break;
+        case AstNodeKindDefer:
+            node->data.stmt = AST_NEW(AstNodeStatement);
+            node->data.stmt->defer_stmt = AST_NEW(AstNodeDeferStatement);
+            break;
+        case AstNodeKindReturn:
+            node->data.stmt = AST_NEW(AstNodeStatement);
+            node->data.stmt->return_stmt = AST_NEW(AstNodeReturnStatement);
+            break;
+
+        // Misc
+        case AstNodeKindParamDecl:
+            node->data.param_decl = AST_NEW(AstNodeParamDecl);
+            break;
+        case AstNodeKindParamList:
+            node->data.param_list = AST_NEW(AstNodeParamList);
+            break;
+        case AstNodeKindTopLevelComptime:
+            node->data.toplevel_comptime_expr = AST_NEW(AstNodeTopLevelComptime);
+            break;
+        case AstNodeKindUnreachable:
+        case AstNodeKindOptional:
+        case AstNodeKindRoot:
+            // No payload
+            break;
+    }
     return node;
 }
 
+// Index of `node` in `parser->ast` (AST_NULL for no node)
+#define AST_INDEX(node)     (SOME(node) ? (node)->index : AST_NULL)
+
+// Add `node` (whose children have been added already) to `parser->ast`, with the `main_token`th token as its main 
+// token (see `Ast`)
+static void parser_emit(Parser* parser, AstNode* node, UInt32 main_token, AstNode* lhs, AstNode* rhs) {
+    node->index = ast_add_node(parser->ast, node->kind, main_token, AST_INDEX(lhs), AST_INDEX(rhs));
+}
+
 static AstNode* ast_parse_root(Parser* parser);
 static AstNode* ast_parse_string_literal(Parser* parser);
 static AstNode* ast_parse_suffix_op(Parser* parser);
@@ -151,6 +540,8 @@ static AstNode* ast_parse_match_clause(Parser* );
 static AstNode* ast_parse_match_branch(Parser* parser);
 static AstNode* ast_parse_match_expr(Parser* parser);
 static AstNode* ast_parse_primary_type_expr(Parser* parser);
+static AstNode* ast_fold_binary_op(Parser* parser, const Token* op_tok, AstNode* lhs, BinaryOpKind op, AstNode* rhs);
+static AstNode* ast_fold_prefix_op(Parser* parser, const Token* op_tok, PrefixOpKind op, AstNode* operand);
 static AstNode* ast_parse_brace_suffix_expr(Parser* parser);
 static AstNode* ast_parse_block(Parser* parser);
 static AstNode* ast_parse_primary_expr(Parser* parser);
@@ -183,31 +574,27 @@ static AstNode* ast_parse_toplevel_decl(Parser* parser);
 //      | StructDecl
 //      | EnumDecl
 static AstNode* ast_parse_toplevel_decl(Parser* parser) {
-    AstNode* module = ast_parse_module_statement(parser);
-    if(SOME(module))
-        return module;
-    
-    AstNode* use = ast_parse_use_statement(parser);
-    if(SOME(use))
-        return use;
-
-    AstNode* variable = ast_parse_variable_decl(parser);
-    if(SOME(variable))
-        return variable;
-
-    AstNode* func_decl = ast_parse_func_decl(parser);
-    if(SOME(func_decl))
-        return func_decl;
-    
-    AstNode* struct_decl = ast_parse_struct_decl(parser);
-    if(SOME(struct_decl))
-        return struct_decl;
-
-    AstNode* enum_decl = ast_parse_enum_decl(parser);
-    if(SOME(enum_decl))
-        return enum_decl;
-    
-    return null;
+    switch(pc->kind) {
+        case MODULE: return ast_parse_module_statement(parser);
+        case USE: return ast_parse_use_statement(parser);
+        case PUT: return ast_parse_variable_decl(parser);
+        case ATTR_COMPTIME: {
+            // `[comptime] put ...` or `[comptime] func ...`
+            Token* next = parser_peek_next(parser);
+            if(SOME(next) && next->kind == PUT)
+                return ast_parse_variable_decl(parser);
+            return ast_parse_func_decl(parser);
+        }
+        case ATTR_NORETURN:
+        case ATTR_INLINE:
+        case ATTR_NOINLINE:
+        case EXPORT:
+        case FUNC: 
+            return ast_parse_func_decl(parser);
+        case STRUCT: return ast_parse_struct_decl(parser);
+        case ENUM: return ast_parse_enum_decl(parser);
+        default: return null;
+    }
 }
 
 // ModuleStatement
@@ -217,14 +604,16 @@ static AstNode* ast_parse_module_statement(Parser* parser) {
     if(NONE(module_kwd))
         return null;
     
+    UInt32 name_offset = parser->offset;
     Token* module_name = CHOMP_IF(IDENTIFIER);
     if(NONE(module_name))
         AST_EXPECTED("module name");
     
     Token* semicolon = CHOMP_IF(SEMICOLON); // this is optional
 
-    AstNode* node = ast_create_node(AstNodeKindModuleStatement);
-    node->data.stmt->module_stmt->name = module_name->value;
+    AstNode* node = ast_create_node(parser, AstNodeKindModuleStatement);
+    node->data.stmt->module_stmt->name = parser_symbol(parser, module_name);
+    parser_emit(parser, node, name_offset, null, null);
 
     return node;
 }
@@ -247,14 +636,16 @@ static AstNode* ast_parse_use_statement(Parser* parser) {
     if(NONE(use_kwd))
         return null;
     
+    UInt32 name_offset = parser->offset;
     Token* use_name = CHOMP_IF(IDENTIFIER);
     if(NONE(use_name))
         AST_EXPECTED("use name");
     
     Token* semicolon = CHOMP_IF(SEMICOLON); // this is optional
 
-    AstNode* node = ast_create_node(AstNodeKindUseStatement);
-    node->data.stmt->use_stmt->name = use_name->value;
+    AstNode* node = ast_create_node(parser, AstNodeKindUseStatement);
+    node->data.stmt->use_stmt->name = parser_symbol(parser, use_name);
+    parser_emit(parser, node, name_offset, null, null);
     return node;
 }
 
@@ -278,9 +669,11 @@ static AstNode* ast_parse_variable_decl(Parser* parser) {
         AST_EXPECTED("a type");
     }
 
+    UInt32 name_offset = parser->offset;
     Token* identifier = CHOMP_IF(IDENTIFIER);
     if(NONE(identifier))
         AST_EXPECTED("an identifier");
+    SymbolId name = parser_symbol(parser, identifier);
     
     Token* equals = CHOMP_IF(EQUALS);
     AstNode* init_expr = null;
@@ -291,17 +684,18 @@ static AstNode* ast_parse_variable_decl(Parser* parser) {
 
     Token* semicolon = CHOMP_IF(SEMICOLON);
 
-    AstNode* node = ast_create_node(AstNodeKindVariableDecl);
-    node->data.scope_obj->var->name = identifier->value;
+    AstNode* node = ast_create_node(parser, AstNodeKindVariableDecl);
+    node->data.scope_obj->var->name = name;
     node->data.scope_obj->var->init_expr = init_expr;
     node->data.scope_obj->var->is_local = !parser->is_in_global_context;
     node->data.scope_obj->var->is_comptime = cast(bool)SOME(comptime_attr);
     node->data.scope_obj->var->is_mutable = cast(bool)SOME(mutable_kwd);
+    parser_emit(parser, node, name_offset, type_expr, init_expr);
     return node;
 }
 
 // FuncDecl
-//      <Attributes> KEYWORD(export)? KEYWORD(func) IDENTIFIER? LPAREN ParamList RPAREN LARROW TypeExpr (SEMICOLON? / BLOCK)
+//      <Attributes> KEYWORD(export)? KEYWORD(func) IDENTIFIER? LPAREN ParamList RPAREN RARROW TypeExpr (SEMICOLON? / BLOCK)
 // where <Attributes> can be one of:
 //      | ATTR_NORETURN
 //      | ATTR_COMPTIME
@@ -340,18 +734,20 @@ func_no_attrs:;
     
     bool is_variadic = false;
     Token* identifier = CHOMP_IF(IDENTIFIER);
+    // Tokens don't outlive the Lexer's ring buffer in streaming mode, so grab the symbol now
+    SymbolId name = SOME(identifier) ? parser_symbol(parser, identifier) : SYMBOL_NULL;
     AstNode* params = ast_parse_param_list(parser, &is_variadic);
     
-    Token* larrow = CHOMP_IF(LARROW);
+    Token* rarrow = CHOMP_IF(RARROW);
     AstNode* return_type_expr = ast_parse_type_expr(parser);
     if(NONE(return_type_expr))
         AST_EXPECTED("Return type expression. Use `void` if your function doesn't return anything");
-    if(NONE(larrow) && SOME(return_type_expr))
+    if(NONE(rarrow) && SOME(return_type_expr))
         AST_EXPECTED("trailing `->` after function prototype");
     
     bool no_body = false;
     AstNode* body = null;
-    AstNode* node = ast_create_node(AstNodeKindFuncDecl);
+    AstNode* node = ast_create_node(parser, AstNodeKindFuncDecl);
     switch(pc->kind) {
         case SEMICOLON:
             CHOMP(1);
@@ -366,7 +762,7 @@ func_no_attrs:;
             AST_EXPECTED("Semicolon or Function Body");
     } // switch
 
-    node->data.decl->func_decl->name = identifier->value;
+    node->data.decl->func_decl->name = name;
     node->data.decl->func_decl->params = params;
     node->data.decl->func_decl->return_type = return_type_expr;
     node->data.decl->func_decl->no_body = no_body;
@@ -391,20 +787,22 @@ func_no_attrs:;
 static AstNode* ast_parse_param_list(Parser* parser, bool* is_variadic) {
     Token* lparen = EXPECT_TOK(LPAREN);
     bool seen_varargs = false;
-    Vec* params = VEC_NEW(AstNode, 1);
+    Vec* params = VEC_NEW_WITH(AstNode, 1, arena_allocator(parser->arena));
     while(true) {
-        if(NONE(CHOMP_IF(RPAREN)))
+        if(SOME(CHOMP_IF(RPAREN)))
             break;
-        AstNode* param = ast_parse_param_decl(parser);
-        if(SOME(param)) {
-            vec_push(params, param);
-        } else if((pc - 1)->kind == ELLIPSIS) {
+        if(SOME(CHOMP_IF(ELLIPSIS))) {
             seen_varargs = true;
+        } else {
+            AstNode* param = ast_parse_param_decl(parser);
+            if(SOME(param))
+                vec_push_AstNode(params, param);
         }
 
         switch(pc->kind) {
             case COMMA: CHOMP(1); break;
-            case RPAREN: CHOMP(1); break;
+            // (Chomped at the top of the loop)
+            case RPAREN: break;
             case COLON: 
             case RBRACE: 
             case RSQUAREBRACK: 
@@ -415,7 +813,7 @@ static AstNode* ast_parse_param_list(Parser* parser, bool* is_variadic) {
         }
     }
 
-    AstNode* node = ast_create_node(AstNodeKindParamList);
+    AstNode* node = ast_create_node(parser, AstNodeKindParamList);
     node->data.param_list->is_variadic = cast(bool)seen_varargs;
     node->data.param_list->params = params;
     node->data.param_list->is_variadic = seen_varargs;
@@ -425,7 +823,7 @@ static AstNode* ast_parse_param_list(Parser* parser, bool* is_variadic) {
 
 // ParamDecl
 static AstNode* ast_parse_param_decl(Parser* parser) {
-    CORETEN_ENFORCE(false, "TODO");
+    AST_UNSUPPORTED("Function parameters");
     return null;
 }
 
@@ -437,9 +835,8 @@ static AstNode* ast_parse_param_decl(Parser* parser) {
 //      | MatchExpr
 //      | AssignmentExpr SEMICOLON?
 static AstNode* ast_parse_statement(Parser* parser) {
-    AstNode* var_decl = ast_parse_variable_decl(parser);
-    if(SOME(var_decl))
-        return var_decl;
+    if(pc->kind == PUT || pc->kind == ATTR_COMPTIME)
+        return ast_parse_variable_decl(parser);
     
     AstNode* block_expr = ast_parse_block_expr(parser);
     if(SOME(block_expr))
@@ -470,7 +867,7 @@ static AstNode* ast_parse_statement(Parser* parser) {
 //          name: BarBar
 //      }
 static AstNode* ast_parse_struct_decl(Parser* parser) {
-    CORETEN_ENFORCE(false, "TODO");
+    AST_UNSUPPORTED("Struct declarations");
     return null;
 }
 
@@ -483,7 +880,7 @@ static AstNode* ast_parse_struct_decl(Parser* parser) {
 //          BarBar
 //      }
 static AstNode* ast_parse_enum_decl(Parser* parser) {
-    CORETEN_ENFORCE(false, "TODO");
+    AST_UNSUPPORTED("Enum declarations");
     return null;
 }
 
@@ -536,7 +933,7 @@ static AstNode* ast_parse_if_expr(Parser* parser) {
     if(NONE(else_body) && SOME(semicolon))
         AST_EXPECTED("Semicolon or `else` block");
 
-    AstNode* node = ast_create_node(AstNodeKindIfExpr);
+    AstNode* node = ast_create_node(parser, AstNodeKindIfExpr);
     node->data.expr->if_expr->condition = condition;
     node->data.expr->if_expr->if_body = if_body;
     node->data.expr->if_expr->has_else = SOME(else_body);
@@ -591,17 +988,17 @@ outexpect:
         3. ast_parse_loop_in_expr(parser)
 */
 static AstNode* ast_parse_loop_inf_expr(Parser* parser) {
-    CORETEN_ENFORCE(false, "TODO");
+    AST_UNSUPPORTED("Infinite loops");
     return null;
 }
 
 static AstNode* ast_parse_loop_c_expr(Parser* parser) {
-    CORETEN_ENFORCE(false, "TODO");
+    AST_UNSUPPORTED("C-style loops");
     return null;
 }
 
 static AstNode* ast_parse_loop_in_expr(Parser* parser) {
-    CORETEN_ENFORCE(false, "TODO");
+    AST_UNSUPPORTED("`loop ... in` loops");
     return null;
 }
 
@@ -628,9 +1025,9 @@ static AstNode* ast_parse_block_expr_statement(Parser* parser) {
 static AstNode* ast_parse_block_expr(Parser* parser) {
     switch(pc->kind) {
         case IDENTIFIER:
-            if((pc->kind + 1) == COLON && (pc->kind + 2) == LBRACE) {
-                pc += 2;
-                return ast_parse_block(parser);    
+            if(parser_peek(parser, 1)->kind == COLON && parser_peek(parser, 2)->kind == LBRACE) {
+                CHOMP(2);
+                return ast_parse_block(parser);
             } else {
                 return null;
             }
@@ -678,63 +1075,23 @@ static AstNode* ast_parse_assignment_expr(Parser* parser) {
 
         default: return lhs;
     }
+    UInt32 op_offset = parser->offset;
 
     AstNode* rhs = ast_parse_expr(parser);
     if(NONE(rhs))
         AST_EXPECTED("an expression after assignment op");
 
-    AstNode* node = ast_create_node(AstNodeKindBinaryOpExpr);
+    AstNode* node = ast_create_node(parser, AstNodeKindBinaryOpExpr);
     node->data.expr->binary_op_expr->op = op;
     node->data.expr->binary_op_expr->lhs = lhs;
     node->data.expr->binary_op_expr->rhs = rhs;
+    parser_emit(parser, node, op_offset, lhs, rhs);
     return node;
 }
 
-typedef struct ast_prec {
-    TokenKind tok_kind;
-    UInt8 prec;
-    BinaryOpKind bin_kind;
-} ast_prec;
-
-// A table of binary operator precedence, from strong to weak. Binary Operators of the same precedence value
-// are grouped together in the order given by their associativity.
-#define PRECEDENCE_TABLE_SIZE   (sizeof(precedence_table)/sizeof(precedence_table[0]))
-static const ast_prec precedence_table[] = {
-    // { .tok_kind = MULT_MULT, .prec = 60, .bin_kind = BinaryOpKindMultMult },
-    { .tok_kind = MULT,  .prec = 60, .bin_kind = BinaryOpKindMult },
-    { .tok_kind = MOD,   .prec = 60, .bin_kind = BinaryOpKindMod },
-    { .tok_kind = SLASH, .prec = 60, .bin_kind = BinaryOpKindDiv },
-
-    { .tok_kind = PLUS,         .prec = 50, .bin_kind = BinaryOpKindAdd },
-    { .tok_kind = MINUS,        .prec = 50, .bin_kind = BinaryOpKindSubtract },
-    { .tok_kind = PLUS_EQUALS,  .prec = 50, .bin_kind = BinaryOpKindAssignmentPlus },
-    { .tok_kind = MINUS_EQUALS, .prec = 50, .bin_kind = BinaryOpKindAssignmentMinus },
-
-    { .tok_kind = LBITSHIFT, .prec = 40, .bin_kind = BinaryOpKindBitshitLeft },
-    { .tok_kind = RBITSHIFT, .prec = 40, .bin_kind = BinaryOpKindBitshitRight },
-    
-    { .tok_kind = LESS_THAN,                 .prec = 30, .bin_kind = BinaryOpKindCmpLessThan },
-    { .tok_kind = GREATER_THAN,              .prec = 30, .bin_kind = BinaryOpKindCmpGreaterThan },
-    { .tok_kind = EQUALS_EQUALS,             .prec = 30, .bin_kind = BinaryOpKindCmpEqual },
-    { .tok_kind = EXCLAMATION_EQUALS,        .prec = 30, .bin_kind = BinaryOpKindCmpNotEqual },
-    { .tok_kind = LESS_THAN_OR_EQUAL_TO,     .prec = 30, .bin_kind = BinaryOpKindCmpLessThanorEqualTo },
-    { .tok_kind = GREATER_THAN_OR_EQUAL_TO,  .prec = 30, .bin_kind = BinaryOpKindCmpGreaterThanorEqualTo },
-
-    { .tok_kind = AND, .prec = 20, .bin_kind = BinaryOpKindBoolAnd },
-
-    { .tok_kind = OR,  .prec = 10, .bin_kind = BinaryOpKindBoolOr },
-};
-
-static inline ast_prec lookup_precedence(TokenKind kind) {
-    for(int i = 0; i < PRECEDENCE_TABLE_SIZE; i++) {
-        if(precedence_table[i].tok_kind == kind)
-            return precedence_table[i];
-    }
-    AST_ERROR("Expected a valid assignment token op");
-    return cast(ast_prec) {0}; // Clang complains despite this point never being reached
-}
-
 static AstNode* ast_parse_precedence(Parser* parser, UInt8 min_prec) {
+    // Every node added to the Ast from here on is part of `node` (or of its right operand)
+    UInt32 ast_begin = parser->ast->len;
     AstNode* node = ast_parse_prefix_expr(parser);
     if(NONE(node))
         return null;
@@ -742,29 +1099,46 @@ static AstNode* ast_parse_precedence(Parser* parser, UInt8 min_prec) {
     UInt8 banned_prec = 0;
 
     while(true) {
-        ast_prec prec = lookup_precedence(pc->kind);
-        if(prec.prec < min_prec || prec.prec == banned_prec)
+        // Anything that isn't a binary operator (PREC_NONE) ends the expression
+        UInt8 prec = BINOP_PRECEDENCE(pc->kind);
+        if(prec == PREC_NONE || prec < min_prec || prec == banned_prec)
             break;
         
+        TokenKind op_kind = pc->kind;
+        BinaryOpKind op = BINOP_KIND(op_kind);
+        // (A copy: in streaming mode, the token doesn't outlive its ring slot)
+        Token op_tok = *pc;
+        UInt32 op_offset = parser->offset;
         CHOMP(1);
-        Token* op_token = pc;
 
-        AstNode* rhs = ast_parse_precedence(parser, prec.prec + 1);
+        AstNode* rhs = ast_parse_precedence(parser, prec + 1);
         if(NONE(rhs))
             AST_ERROR("Invalid token");
         
-        node->data.expr->binary_op_expr->lhs = node;
-        node->data.expr->binary_op_expr->op = prec.bin_kind;
-        node->data.expr->binary_op_expr->rhs = rhs;
+        AstNode* folded = parser->fold_constants ? ast_fold_binary_op(parser, &op_tok, node, op, rhs) : null;
+        if(SOME(folded)) {
+            // The operands are gone
+            ast_truncate(parser->ast, ast_begin);
+            parser_emit(parser, folded, op_offset, null, null);
+            node = folded;
+        } else {
+            AstNode* binary = ast_create_node(parser, AstNodeKindBinaryOpExpr);
+            binary->data.expr->binary_op_expr->lhs = node;
+            binary->data.expr->binary_op_expr->op = op;
+            binary->data.expr->binary_op_expr->rhs = rhs;
+            parser_emit(parser, binary, op_offset, node, rhs);
+            node = binary;
+        }
 
-        switch(pc->kind) {
+        // Comparisons don't chain (`a < b < c` is an error)
+        switch(op_kind) {
             case EQUALS_EQUALS:
             case EXCLAMATION_EQUALS:
             case GREATER_THAN:
             case LESS_THAN:
             case GREATER_THAN_OR_EQUAL_TO:
             case LESS_THAN_OR_EQUAL_TO:
-                banned_prec = prec.prec;
+                banned_prec = prec;
                 break;
             default:
                 break;
@@ -789,17 +1163,31 @@ static AstNode* ast_parse_prefix_expr(Parser* parser) {
     switch(parser->curr_tok->kind) {
         case NOT: op = PrefixOpKindBoolNot; break;
         case EXCLAMATION: op = PrefixOpKindNegation; break;
+        case MINUS: op = PrefixOpKindMinus; break;
         case AND: op = PrefixOpKindAddrOf; break;
         default: return ast_parse_primary_expr(parser);
     }
+    Token op_tok = *pc;
+    UInt32 op_offset = parser->offset;
+    CHOMP(1);
 
+    UInt32 ast_begin = parser->ast->len;
     AstNode* lhs = ast_parse_prefix_expr(parser);
     if(NONE(lhs))
         AST_EXPECTED("prefix op expression");
+    if(parser->fold_constants) {
+        AstNode* folded = ast_fold_prefix_op(parser, &op_tok, op, lhs);
+        if(SOME(folded)) {
+            ast_truncate(parser->ast, ast_begin);
+            parser_emit(parser, folded, op_offset, null, null);
+            return folded;
+        }
+    }
 
-    AstNode* node = ast_create_node(AstNodeKindPrefixOpExpr);
+    AstNode* node = ast_create_node(parser, AstNodeKindPrefixOpExpr);
     node->data.prefix_op_expr->op = op;
     node->data.prefix_op_expr->expr = lhs;
+    parser_emit(parser, node, op_offset, lhs, null);
     return node;
 }
 
@@ -818,17 +1206,23 @@ static AstNode* ast_parse_type_expr(Parser* parser) {
             kind = pc->kind;
             expr = ast_parse_expr(parser);
 
-            node = ast_create_node(AstNodeKindTypeExpr);
+            node = ast_create_node(parser, AstNodeKindTypeExpr);
             node->data.expr->type_expr->expr = expr;
             node->data.expr->type_expr->is_address = kind == AND;
             node->data.expr->type_expr->is_optional = kind == QUESTION;
             node->data.expr->type_expr->is_slice_expr = false;
+            // TypeExprs aren't nodes of their own in the Ast: they're the expression they wrap
+            node->index = AST_INDEX(expr);
             break;
         case IDENTIFIER:
             expr = ast_parse_expr(parser);
             if(pc->kind == LSQUAREBRACK) {
-                CORETEN_ENFORCE(false, "TODO: Parse optional SliceExpr");
+                AST_UNSUPPORTED("Slice types");
             }
+
+            node = ast_create_node(parser, AstNodeKindTypeExpr);
+            node->data.expr->type_expr->expr = expr;
+            node->index = AST_INDEX(expr);
             break;
         default:
             AST_EXPECTED("Something");
@@ -850,29 +1244,31 @@ static AstNode* ast_parse_primary_expr(Parser* parser) {
     AstNode* node = null;
     AstNode* expr = null;
     Token* label = null;
+    SymbolId label_name = SYMBOL_NULL;
     switch(pc->kind) {
         case IF: return ast_parse_if_expr(parser);
         case BREAK: 
             CHOMP(1);
             label = ast_parse_break_label(parser);
+            label_name = SOME(label) ? parser_symbol(parser, label) : SYMBOL_NULL;
             expr = ast_parse_expr(parser);
 
-            node = ast_create_node(AstNodeKindBreak);
+            node = ast_create_node(parser, AstNodeKindBreak);
             node->data.stmt->branch_stmt->type = AstNodeBranchStatementBreak;
-            node->data.stmt->branch_stmt->name = SOME(label) ? label->value : null;
+            node->data.stmt->branch_stmt->name = label_name;
             node->data.stmt->branch_stmt->expr = expr;
             return node;
         case CONTINUE:
             CHOMP(1);
             label = ast_parse_break_label(parser);
-            node = ast_create_node(AstNodeKindBreak);
+            node = ast_create_node(parser, AstNodeKindBreak);
             node->data.stmt->branch_stmt->type = AstNodeBranchStatementContinue;
-            node->data.stmt->branch_stmt->name = SOME(label) ? label->value : null;
+            node->data.stmt->branch_stmt->name = SOME(label) ? parser_symbol(parser, label) : SYMBOL_NULL;
             node->data.stmt->branch_stmt->expr = null;
             return node;
         case ATTR_COMPTIME:
             CHOMP(1);
-            node = ast_create_node(AstNodeKindAttributeExpr);
+            node = ast_create_node(parser, AstNodeKindAttributeExpr);
             expr = ast_parse_expr(parser);
             if(NONE(expr))
                 AST_EXPECTED("expression");
@@ -881,14 +1277,14 @@ static AstNode* ast_parse_primary_expr(Parser* parser) {
             return node;
         case RETURN:
             CHOMP(1);
-            node = ast_create_node(AstNodeKindReturn);
+            node = ast_create_node(parser, AstNodeKindReturn);
             expr = ast_parse_expr(parser);
             node->data.stmt->return_stmt->expr = expr;
             return node;
         case IDENTIFIER:
             // `foo:`
-            if((pc + 1)->kind == COLON) {
-                switch((pc + 2)->kind) {
+            if(parser_peek(parser, 1)->kind == COLON) {
+                switch(parser_peek(parser, 2)->kind) {
                     case ATTR_INLINE:
                         CHOMP(3);
                         switch(pc->kind) {
@@ -915,10 +1311,13 @@ static AstNode* ast_parse_primary_expr(Parser* parser) {
         case LOOP: 
             return ast_parse_loop_expr(parser);
         default:
-            AST_ERROR("Invalid parser pattern");
+            break;
     } // switch(pc->kind)
-    AST_ERROR("Invalid parser pattern");
-    return null; // Clang complains despite this point never being reached
+    // Everything else (including a plain `foo`) is a PrimaryTypeExpr
+    AstNode* primary = ast_parse_primary_type_expr(parser);
+    if(NONE(primary))
+        AST_ERROR("Invalid parser pattern");
+    return primary;
 }
 
 // Block
@@ -928,16 +1327,32 @@ static AstNode* ast_parse_block(Parser* parser) {
     if(NONE(lbrace))
         AST_EXPECTED("LBRACE `{`");
 
-    Vec* statements = VEC_NEW(AstNode, 1);
+    Vec* statements = VEC_NEW_WITH(AstNode, 1, arena_allocator(parser->arena));
+    // Statement boundaries are synchronization points: a bad statement is skipped, and we carry on with the next one
+    jmp_buf recover;
+    jmp_buf* prev_on_error = parser->on_error;
+    if(SOME(parser->diags)) {
+        if(setjmp(recover) != 0) {
+            // Once the Diagnostics is full, give up on the entire declaration
+            if(diagnostics_is_full(parser->diags) && SOME(prev_on_error)) {
+                parser->on_error = prev_on_error;
+                longjmp(*prev_on_error, 1);
+            }
+            parser_synchronize(parser, true);
+        }
+        parser->on_error = &recover;
+    }
+
     AstNode* statement = null;
-    while(SOME(statement = ast_parse_statement(parser)))
-        vec_push(statements, statement);
+    while(pc->kind != RBRACE && pc->kind != TOK_EOF && SOME(statement = ast_parse_statement(parser)))
+        vec_push_AstNode(statements, statement);
+    parser->on_error = prev_on_error;
 
     Token* rbrace = CHOMP_IF(RBRACE);
     if(NONE(rbrace))
         AST_EXPECTED("RBRACE `}`");
     
-    AstNode* node = ast_create_node(AstNodeKindBlock);
+    AstNode* node = ast_create_node(parser, AstNodeKindBlock);
     node->data.stmt->block_stmt->statements = statements;
     return node;
 }
@@ -961,8 +1376,8 @@ static AstNode* ast_parse_brace_suffix_expr(Parser* parser) {
     Vec* fields = null;
     AstNode* field_init = ast_parse_field_init(parser);
     if(SOME(field_init)) {
-        fields = VEC_NEW(AstNode, 1);
-        vec_push(fields, field_init);
+        fields = VEC_NEW_WITH(AstNode, 1, arena_allocator(parser->arena));
+        vec_push_AstNode(fields, field_init);
         while(true) {
             switch(pc->kind) {
                 case COMMA: CHOMP(1); break;
@@ -979,28 +1394,28 @@ static AstNode* ast_parse_brace_suffix_expr(Parser* parser) {
             AstNode* field_init = ast_parse_field_init(parser);
             if(NONE(field_init))
                 AST_EXPECTED("field init");
-            vec_push(fields, field_init);
+            vec_push_AstNode(fields, field_init);
         } // while(true)
         Token* comma = CHOMP_IF(COMMA);
-        AstNode* node = ast_create_node(AstNodeKindStructExpr);
+        AstNode* node = ast_create_node(parser, AstNodeKindStructExpr);
         node->data.expr->init_expr->kind = InitExprKindStruct;
         node->data.expr->init_expr->entries = fields;
         return node;
     }
 
-    AstNode* node = ast_create_node(AstNodeKindArrayInitExpr);
+    AstNode* node = ast_create_node(parser, AstNodeKindArrayInitExpr);
     node->data.expr->init_expr->kind = InitExprKindArray;
 
     AstNode* expr = ast_parse_expr(parser);
     if(SOME(expr)) {
-        Vec* fields = VEC_NEW(AstNode, 1);
-        vec_push(fields, expr);
+        Vec* fields = VEC_NEW_WITH(AstNode, 1, arena_allocator(parser->arena));
+        vec_push_AstNode(fields, expr);
         Token* comma = null;
         while(pc->kind != COMMA) {
             AstNode* exp = ast_parse_expr(parser);
             if(NONE(exp))
                 break;
-            vec_push(fields, exp);
+            vec_push_AstNode(fields, exp);
         }
         node->data.expr->init_expr->entries = fields;
         return node;
@@ -1036,13 +1451,13 @@ static AstNode* ast_parse_suffix_expr(Parser* parser) {
         return node;
     }
 
-    Vec* params = VEC_NEW(AstNode, 1);
+    Vec* params = VEC_NEW_WITH(AstNode, 1, arena_allocator(parser->arena));
     AstNode* param = null;
     while(CHOMP(1)->kind != RPAREN) {
         param = ast_parse_expr(parser);
         if(NONE(param))
             break;
-        vec_push(params, param);
+        vec_push_AstNode(params, param);
         switch(pc->kind) {
             case COMMA: CHOMP(1);
             case RPAREN: CHOMP(1); break;
@@ -1055,6 +1470,86 @@ static AstNode* ast_parse_suffix_expr(Parser* parser) {
 }
 */
 
+// Make a literal node holding `value` (its `value` - the spelling - is null: see `ast_parse_int_literal()`)
+static AstNode* ast_create_constant(Parser* parser, const FoldValue* value) {
+    AstNode* node = null;
+    switch(value->kind) {
+        case FoldValueKindInt: node = ast_create_node(parser, AstNodeKindIntLiteral); break;
+        case FoldValueKindFloat: node = ast_create_node(parser, AstNodeKindFloatLiteral); break;
+        case FoldValueKindBool: node = ast_create_node(parser, AstNodeKindBoolLiteral); break;
+        default: unreachable();
+    }
+    fold_value_store(value, node);
+    return node;
+}
+
+// The literal that `result` (of folding the operator `op_tok`) is, or null if it couldn't be folded. Errors are 
+// reported at the operator, and the operator is then left as it is
+static AstNode* ast_fold_result(Parser* parser, const Token* op_tok, FoldResult result, const FoldValue* value) {
+    switch(result) {
+        case FoldOk: return ast_create_constant(parser, value);
+        case FoldNotConstant: return null;
+        case FoldOutOfRange:
+            parser_report_at(parser, op_tok, ErrorLiteralOutOfRange, 
+                             "Constant expression is out of range (of Int64 and UInt64, or of Float64)");
+            return null;
+        case FoldDivisionByZero: 
+            parser_report_at(parser, op_tok, ErrorParseError, "Division by zero in a constant expression");
+            return null;
+    }
+    return null;
+}
+
+static AstNode* ast_fold_binary_op(Parser* parser, const Token* op_tok, AstNode* lhs, BinaryOpKind op, AstNode* rhs) {
+    FoldValue lhs_value, rhs_value, result;
+    if(!fold_value_of(lhs, &lhs_value) || !fold_value_of(rhs, &rhs_value))
+        return null;
+    return ast_fold_result(parser, op_tok, fold_binary_op(op, &lhs_value, &rhs_value, &result), &result);
+}
+
+static AstNode* ast_fold_prefix_op(Parser* parser, const Token* op_tok, PrefixOpKind op, AstNode* operand) {
+    FoldValue value, result;
+    if(!fold_value_of(operand, &value))
+        return null;
+    return ast_fold_result(parser, op_tok, fold_prefix_op(op, &value, &result), &result);
+}
+
+// IntegerLiteral (`INTEGER`, `HEX_INT`, `BIN_INT` or `OCT_INT`)
+static AstNode* ast_parse_int_literal(Parser* parser) {
+    UInt64 number = 0;
+    BuffView spelling = lexer_value(parser->lexer, pc);
+    switch(number_parse_int(spelling.data, cast(UInt32)spelling.len, &number)) {
+        case NumberOk: break;
+        case NumberOverflow:
+            parser_error(parser, ErrorLiteralOutOfRange, "Integer literal `" BV_FMT "` does not fit in 64 bits", 
+                         BV_ARG(spelling));
+        case NumberInvalid: AST_ERROR("Invalid integer literal `" BV_FMT "`", BV_ARG(spelling));
+    }
+    FoldValue value = { .kind = FoldValueKindInt, .magnitude = number };
+    AstNode* node = ast_create_constant(parser, &value);
+    parser_emit(parser, node, parser->offset, null, null);
+    CHOMP(1);
+    return node;
+}
+
+// FloatLiteral (`FLOAT_LIT`)
+static AstNode* ast_parse_float_literal(Parser* parser) {
+    double number = 0.0;
+    BuffView spelling = lexer_value(parser->lexer, pc);
+    switch(number_parse_float(spelling.data, cast(UInt32)spelling.len, &number)) {
+        case NumberOk: break;
+        case NumberOverflow:
+            parser_error(parser, ErrorLiteralOutOfRange, "Float literal `" BV_FMT "` is too large for a 64-bit float", 
+                         BV_ARG(spelling));
+        case NumberInvalid: AST_ERROR("Invalid float literal `" BV_FMT "`", BV_ARG(spelling));
+    }
+    FoldValue value = { .kind = FoldValueKindFloat, .float_value = number };
+    AstNode* node = ast_create_constant(parser, &value);
+    parser_emit(parser, node, parser->offset, null, null);
+    CHOMP(1);
+    return node;
+}
+
 // PrimaryTypeExpr
 //      BUILTINIDENTIFIER FuncCallArgs
 //      CHAR_LITERAL
@@ -1083,26 +1578,40 @@ static AstNode* ast_parse_primary_type_expr(Parser* parser) {
     Token* tok = null;
     switch(pc->kind) {
         case CHAR_LIT:
-            node = ast_create_node(AstNodeKindCharLiteral);
-            node->data.literal->char_value->value = pc->value;
+            node = ast_create_node(parser, AstNodeKindCharLiteral);
+            node->data.literal->char_value->value = parser_symbol(parser, pc);
+            parser_emit(parser, node, parser->offset, null, null);
             CHOMP(1);
             return node;
         case INTEGER:
-            node = ast_create_node(AstNodeKindIntLiteral);
-            node->data.literal->int_value->value = pc->value;
-            CHOMP(1);
-            return node;
+        case HEX_INT:
+        case BIN_INT:
+        case OCT_INT:
+            return ast_parse_int_literal(parser);
         case FLOAT_LIT:
-            node = ast_create_node(AstNodeKindFloatLiteral);
-            node->data.literal->float_value->value = pc->value;
+            return ast_parse_float_literal(parser);
+        case TOK_TRUE:
+        case TOK_FALSE:
+            node = ast_create_node(parser, AstNodeKindBoolLiteral);
+            node->data.literal->bool_value->value = pc->kind == TOK_TRUE;
+            parser_emit(parser, node, parser->offset, null, null);
             CHOMP(1);
             return node;
         case UNREACHABLE:
-            node = ast_create_node(AstNodeKindUnreachable);
+            node = ast_create_node(parser, AstNodeKindUnreachable);
             CHOMP(1);
             return node;
         case STRING:
-            node = ast_create_node(AstNodeKindStringLiteral);
+        case RAW_STRING:
+        case TRIPLE_STRING:
+            node = ast_create_node(parser, AstNodeKindStringLiteral);
+            node->data.literal->str_value->value = parser_symbol(parser, pc);
+            node->data.literal->str_value->has_escapes = (pc->flags & TOKEN_FLAG_HAS_ESCAPES) != 0;
+            if(pc->kind == RAW_STRING) {
+                node->data.literal->str_value->is_special = true;
+                node->data.literal->str_value->type = AstNodeStringLiteralRaw;
+            }
+            parser_emit(parser, node, parser->offset, null, null);
             CHOMP(1);
             return node;
         case BUILTIN: return ast_parse_builtin_call(parser);
@@ -1112,16 +1621,16 @@ static AstNode* ast_parse_primary_type_expr(Parser* parser) {
         case STRUCT: return ast_parse_struct_decl(parser);
         case ENUM: return ast_parse_enum_decl(parser);
         case ATTR_COMPTIME:
-            node = ast_create_node(AstNodeKindAttributeExpr);
+            node = ast_create_node(parser, AstNodeKindAttributeExpr);
             expr = ast_parse_type_expr(parser);
             if(NONE(expr))
                 AST_EXPECTED("type expr");
             node->data.expr->attr_expr->expr = expr;
             return node;
         case IDENTIFIER:
-            switch((pc + 1)->kind) {
+            switch(parser_peek(parser, 1)->kind) {
                 case COLON:
-                    switch((pc + 2)->kind) {
+                    switch(parser_peek(parser, 2)->kind) {
                         case ATTR_INLINE:
                             CHOMP(3);
                             switch(pc->kind) {
@@ -1135,12 +1644,14 @@ static AstNode* ast_parse_primary_type_expr(Parser* parser) {
                             CHOMP(2);
                             return ast_parse_block(parser);
                         default:
-                            node = ast_create_node(AstNodeKindIdentifier);
+                            node = ast_create_node(parser, AstNodeKindIdentifier);
+                            parser_emit(parser, node, parser->offset, null, null);
                             CHOMP(1);
                             return node;
                     }
                 default:
-                    node = ast_create_node(AstNodeKindIdentifier);
+                    node = ast_create_node(parser, AstNodeKindIdentifier);
+                    parser_emit(parser, node, parser->offset, null, null);
                     CHOMP(1);
                     return node;
             }
@@ -1154,16 +1665,18 @@ static AstNode* ast_parse_primary_type_expr(Parser* parser) {
             break;
         case LOOP: return ast_parse_loop_expr(parser);
         case DOT:
-            switch((pc + 1)->kind) {
+            switch(parser_peek(parser, 1)->kind) {
                 case IDENTIFIER:
-                    node = ast_create_node(AstNodeKindIdentifier);
+                    node = ast_create_node(parser, AstNodeKindIdentifier);
+                    parser_emit(parser, node, parser->offset + 1, null, null);
                     CHOMP(1);
                     return node;
                 default: return null;
             }
             break;
-        case LPAREN:
-            node = ast_create_node(AstNodeKindGroupedExpr);
+        case LPAREN: {
+            UInt32 lparen_offset = parser->offset;
+            CHOMP(1);
             expr = ast_parse_expr(parser);
             if(NONE(expr))
                 AST_EXPECTED("expression");
@@ -1171,14 +1684,21 @@ static AstNode* ast_parse_primary_type_expr(Parser* parser) {
             if(NONE(tok))
                 AST_EXPECTED("RPAREN");
 
+            // A (folded) constant needs no grouping
+            FoldValue value;
+            if(parser->fold_constants && fold_value_of(expr, &value))
+                return expr;
+            node = ast_create_node(parser, AstNodeKindGroupedExpr);
             node->data.expr->grouped_expr->expr = expr;
+            parser_emit(parser, node, lparen_offset, expr, null);
             return node;
+        }
     }
     return null;
 }
 
 static AstNode* ast_parse_builtin_call(Parser* parser) {
-    CORETEN_ENFORCE(false, "TODO");
+    AST_UNSUPPORTED("Builtin calls");
     return null;
 }
 
@@ -1203,15 +1723,15 @@ static AstNode* ast_parse_match_expr(Parser* parser) {
     AstNode* branch_node = ast_parse_match_branch(parser);
     if(NONE(branch_node))
         AST_EXPECTED("branches for `match`");
-    Vec* branches = VEC_NEW(AstNode, 1);
+    Vec* branches = VEC_NEW_WITH(AstNode, 1, arena_allocator(parser->arena));
     do {
-        vec_push(branches, branch_node);
+        vec_push_AstNode(branches, branch_node);
     } while(SOME(branch_node = ast_parse_match_branch(parser)));
 
     // Parse any trailing comma
     Token* comma = CHOMP_IF(COMMA);
 
-    AstNode* node = ast_create_node(AstNodeKindMatchExpr);
+    AstNode* node = ast_create_node(parser, AstNodeKindMatchExpr);
     node->data.expr->match_expr->expr = expr;
     node->data.expr->match_expr->branches = branches;
     return node;
@@ -1256,7 +1776,7 @@ static AstNode* ast_parse_match_clause(Parser* parser) {
         return null;
     }
 
-    AstNode* out = ast_create_node(AstNodeKindMatchBranch);
+    AstNode* out = ast_create_node(parser, AstNodeKindMatchBranch);
     out->data.expr->match_branch_expr->is_range = false;
     AstNode* cond_node = expr;
 
@@ -1267,7 +1787,7 @@ static AstNode* ast_parse_match_clause(Parser* parser) {
         if(NONE(expr2))
             AST_EXPECTED("Expected expression after `..`");
 
-        AstNode* range = ast_create_node(AstNodeKindMatchRange);
+        AstNode* range = ast_create_node(parser, AstNodeKindMatchRange);
         range->data.expr->match_range_expr->begin = expr;
         range->data.expr->match_range_expr->end = expr2;
         cond_node = range;
@@ -1309,9 +1829,9 @@ static Token* ast_parse_block_label(Parser* parser) {
 // FieldInit
 //      DOT IDENTIFIER EQUALS Expr
 static AstNode* ast_parse_field_init(Parser* parser) {
-    if((pc + 0)->kind == DOT &&
-       (pc + 1)->kind == IDENTIFIER &&
-       (pc + 2)->kind == EQUALS) {
+    if(pc->kind == DOT &&
+       parser_peek(parser, 1)->kind == IDENTIFIER &&
+       parser_peek(parser, 2)->kind == EQUALS) {
             CHOMP(3);
             AstNode* expr = ast_parse_expr(parser);
             if(NONE(expr))
@@ -1339,7 +1859,7 @@ static AstNode* ast_parse_suffix_op(Parser* parser) {
             }
             Token* rbrace = EXPECT_TOK(RBRACE);
 
-            AstNode* node = ast_create_node(AstNodeKindSliceExpr);
+            AstNode* node = ast_create_node(parser, AstNodeKindSliceExpr);
             node->data.expr->slice_expr->lower = lower;
             node->data.expr->slice_expr->upper = upper;
             node->data.expr->slice_expr->sentinel = sentinel;
@@ -1348,7 +1868,7 @@ static AstNode* ast_parse_suffix_op(Parser* parser) {
 
         Token* rbrace = EXPECT_TOK(RBRACE);
 
-        AstNode* node = ast_create_node(AstNodeKindArrayAccessExpr);
+        AstNode* node = ast_create_node(parser, AstNodeKindArrayAccessExpr);
         node->data.array_access_expr->subscript = lower;
         return node;
     }
@@ -1356,8 +1876,8 @@ static AstNode* ast_parse_suffix_op(Parser* parser) {
     Token* dot = CHOMP_IF(DOT);
     if(SOME(dot)) {
         Token* identifier = EXPECT_TOK(IDENTIFIER);
-        AstNode* node = ast_create_node(AstNodeKindFieldAccessExpr);
-        node->data.field_access_expr->field_name = identifier->value;
+        AstNode* node = ast_create_node(parser, AstNodeKindFieldAccessExpr);
+        node->data.field_access_expr->field_name = parser_symbol(parser, identifier);
         return node;
     }
 
@@ -1368,7 +1888,7 @@ static AstNode* ast_parse_suffix_op(Parser* parser) {
 static AstNode* ast_parse_string_literal(Parser* parser) {
     if(pc->kind == STRING) {
         CHOMP(1);
-        AstNode* node = ast_create_node(AstNodeKindStringLiteral);
+        AstNode* node = ast_create_node(parser, AstNodeKindStringLiteral);
         return node;
     }
 
@@ -1376,34 +1896,302 @@ static AstNode* ast_parse_string_literal(Parser* parser) {
     return null;
 }
 
+BuffView parser_string_value(Parser* parser, AstNode* node) {
+    CORETEN_ENFORCE(node->kind == AstNodeKindStringLiteral);
+    AstNodeStringLiteral* str = node->data.literal->str_value;
+    return lexer_string_value(interner_view(parser->interner, str->value),
+                              str->has_escapes ? TOKEN_FLAG_HAS_ESCAPES : 0, parser->arena);
+}
+
+// Content hash of the `n` tokens from the `first`th (see `ParserDecl`)
+static UInt64 parser_hash_tokens(Parser* parser, UInt64 first, UInt64 n) {
+    Token* tokens = cast(Token*)vec_begin(pt);
+    UInt64 hash = 0x9747b28c;
+    for(UInt64 i = first; i < first + n; i++) {
+        BuffView value = lexer_value(parser->lexer, &tokens[i]);
+        hash = hash_murmur64_seed(value.data, value.len, hash ^ (tokens[i].kind * 0x9E3779B97F4A7C15ull));
+    }
+    return hash;
+}
+
+// Record the span of the declaration just parsed (from the `first`th token, and the `ast_begin`th node of the Ast)
+static void parser_push_decl(Parser* parser, UInt32 first, UInt32 ast_begin) {
+    if(parser->is_streaming)
+        return;
+    ParserDecl decl;
+    decl.first_token = first;
+    decl.num_tokens = parser->offset - first;
+    decl.hash = parser_hash_tokens(parser, first, decl.num_tokens);
+    decl.next_kind = pc->kind;
+    decl.ast_begin = ast_begin;
+    decl.ast_end = parser->ast->len;
+    vec_push_ParserDecl(parser->decls, &decl);
+}
+
+// Move the main tokens of the nodes of `decl` by `delta` tokens (its tokens have moved)
+static void parser_move_decl(Parser* parser, ParserDecl* decl, Int64 delta) {
+    UInt32* main_tokens = parser->ast->main_tokens;
+    for(UInt32 i = decl->ast_begin; i < decl->ast_end; i++)
+        main_tokens[i] = cast(UInt32)(main_tokens[i] + delta);
+    decl->first_token = cast(UInt32)(decl->first_token + delta);
+}
+
+// Point the Ast's Root at the (Ast nodes of the) top-level declarations in `parser->nodelist`
+static void parser_set_ast_root(Parser* parser) {
+    Ast* ast = parser->ast;
+    // The last list of top-level nodes is dropped first, if nothing came after it
+    if(ast->data[0].rhs == ast->extra_len)
+        ast->extra_len = ast->data[0].lhs;
+    UInt32 start = ast->extra_len;
+    for(UInt64 i = 0; i < vec_size(parser->nodelist); i++) {
+        AstIndex node = vec_at_AstNode(parser->nodelist, i)->index;
+        if(node != AST_NULL)
+            ast_add_extra(ast, &node, 1);
+    }
+    ast_set_node(ast, 0, 0, start, ast->extra_len);
+}
+
+// If one of the `num_reuse` declarations in `reuse` (an old parse of them, see `parser_reparse()`) begins at the 
+// current token, push it (without parsing it again) and move past it
+static bool parser_reuse_decl(Parser* parser, ParserDecl* reuse, AstNode* reuse_nodes, UInt32 num_reuse) {
+    for(UInt32 i = 0; i < num_reuse; i++) {
+        UInt32 n = reuse[i].num_tokens;
+        // (0: already reused - its nodes can't be in the Ast twice)
+        if(n == 0 || parser->offset + n >= parser->num_tokens)
+            continue;
+        Token* next = vec_at_Token(pt, parser->offset + n);
+        if(next->kind != reuse[i].next_kind || parser_hash_tokens(parser, parser->offset, n) != reuse[i].hash)
+            continue;
+
+        ParserDecl decl = reuse[i];
+        parser_move_decl(parser, &decl, cast(Int64)parser->offset - cast(Int64)decl.first_token);
+        NODEPUSH(&reuse_nodes[i]);
+        vec_push_ParserDecl(parser->decls, &decl);
+        reuse[i].num_tokens = 0;
+        CHOMP(n);
+        return true;
+    }
+    return false;
+}
+
+// TopLevelDecl* (up to the `stop`th token, or TOK_EOF)
+//
+// The top-level declarations are pushed into `parser->nodelist` (and their spans into `parser->decls`). If the 
+// Parser has a Diagnostics, each declaration is a synchronization point: a bad declaration is skipped, and we carry 
+// on with the next one (until the Diagnostics is full). Declarations in `reuse` are reused if they turn up (see 
+// `parser_reuse_decl()`). Returns false if there were any errors (see `parser->has_errors`).
+static bool parser_parse_decls(Parser* parser, UInt64 stop, ParserDecl* reuse, AstNode* reuse_nodes, UInt32 num_reuse) {
+    jmp_buf recover;
+    jmp_buf* prev_on_error = parser->on_error;
+    if(SOME(parser->diags)) {
+        if(setjmp(recover) != 0) {
+            if(diagnostics_is_full(parser->diags)) {
+                parser->on_error = prev_on_error;
+                return false;
+            }
+            parser_synchronize(parser, false);
+        }
+        parser->on_error = &recover;
+    }
+
+    while(pc->kind != TOK_EOF && parser->offset < stop) {
+        if(num_reuse > 0 && parser_reuse_decl(parser, reuse, reuse_nodes, num_reuse))
+            continue;
+
+        UInt32 first = parser->offset;
+        UInt32 ast_begin = parser->ast->len;
+        AstNode* decl = ast_parse_toplevel_decl(parser);
+        if(NONE(decl))
+            AST_EXPECTED("a top-level declaration");
+        NODEPUSH(decl);
+        parser_push_decl(parser, first, ast_begin);
+    }
+    parser->on_error = prev_on_error;
+    return !parser->has_errors;
+}
+
+// Root
+//      TopLevelDecl* TOK_EOF
+//
+// Returns null if there were any errors (see `parser_parse_decls()`)
 static AstNode* ast_parse_root(Parser* parser) {
-    return null;   
+    parser->has_errors = false;
+    bool is_ok = parser_parse_decls(parser, UInt64_MAX, null, null, 0);
+    parser_set_ast_root(parser);
+    if(!is_ok)
+        return null;
+
+    AstNode* root = ast_create_node(parser, AstNodeKindRoot);
+    root->index = 0;
+    return root;
 }
 
-// Entry point for the Parser
-// static AstNode* ast_parse(Parser* parser) {
-//     LOG("Entering `ast_parse`");
+bool parser_parse(Parser* parser) {
+    Stats* stats = parser->stats;
+    if(CORETEN_LIKELY(NONE(stats)))
+        return SOME(ast_parse_root(parser));
+
+    // Nodes (and their payloads) are counted as they're made. Allocations, from what the arena handed out
+    UInt64 start = stats_now();
+    UInt64 num_allocs = parser->arena->num_allocs;
+    UInt64 allocated = parser->arena->allocated;
+    bool is_ok = SOME(ast_parse_root(parser));
+    stats->phases[StatsPhaseParse].num_allocs += parser->arena->num_allocs - num_allocs;
+    stats->phases[StatsPhaseParse].bytes_allocated += parser->arena->allocated - allocated;
+    stats_add_run(stats, StatsPhaseParse, start);
+    return is_ok;
+}
 
-//     // Begin with the module declaration
-//     AstNode* module_decl = ast_parse_module_statement(parser);
-    
-//     Vec* stmts = VEC_NEW(AstNode, 1);
-//     // Imports
-//     for(;;) {
-//         if(pc->kind == IMPORT)
-//     }
-// }
+// Relex and reparse the whole file
+static bool parser_reparse_all(Parser* parser) {
+    Lexer* lexer = parser->lexer;
+    vec_clear(lexer->toklist);
+    lexer->offset = 0;
+    lexer->num_tokens = 0;
+    lexer->nest_level = 0;
+    lexer->is_inside_str = false;
+    lexer_lex(lexer);
+
+    vec_clear(parser->nodelist);
+    vec_clear(parser->decls);
+    arena_reset(parser->arena);
+    ast_clear(parser->ast);
+    parser->curr_tok = cast(Token*)vec_at(pt, 0);
+    parser->offset = 0;
+    parser->num_tokens = vec_size(pt);
+    return parser_parse(parser);
+}
+
+// Offset (in the source) of the first token of `decl`, and of the token after its last one
+#define DECL_BEGIN(decl)    (tokens[(decl)->first_token].offset)
+#define DECL_END(decl)      (tokens[(decl)->first_token + (decl)->num_tokens].offset)
+
+bool parser_reparse(Parser* parser, char* source, UInt32 edit_begin, UInt32 edit_end, UInt32 new_len) {
+    CORETEN_ENFORCE(!parser->is_streaming, "Cannot reparse a Parser in streaming mode");
+    CORETEN_ENFORCE(edit_begin <= edit_end, "Invalid edit");
+    Lexer* lexer = parser->lexer;
+    UInt64 old_len = lexer->buff_cap;
+    Int64 delta = cast(Int64)new_len - cast(Int64)(edit_end - edit_begin);
+    lexer_set_buffer(lexer, source);
+    CORETEN_ENFORCE(cast(Int64)lexer->buff_cap == cast(Int64)old_len + delta, "The edit doesn't match the new source");
+
+    UInt32 num_decls = cast(UInt32)vec_size(parser->decls);
+    if(parser->has_errors || num_decls == 0)
+        return parser_reparse_all(parser);
+
+    // The damaged region: from the first declaration that ends at or after the edit, to the last one that begins at
+    // or before it (declarations are in order, and - since the last parse had no errors - cover every token).
+    // Declarations that merely touch the edit are part of it, since their first/last token may change.
+    Token* tokens = cast(Token*)vec_begin(pt);
+    ParserDecl* decls = cast(ParserDecl*)vec_begin(parser->decls);
+    UInt32 lo = 0, hi = num_decls - 1;
+    while(lo < hi) {
+        UInt32 mid = lo + (hi - lo) / 2;
+        if(DECL_END(&decls[mid]) >= edit_begin)
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    UInt32 first = lo;
+    lo = first, hi = num_decls - 1;
+    while(lo < hi) {
+        UInt32 mid = lo + (hi - lo + 1) / 2;
+        if(DECL_BEGIN(&decls[mid]) <= edit_end)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    UInt32 last = lo;
+
+    // Relex the damaged region (up to the first token of the next declaration, which is unchanged - only moved)
+    UInt64 num_tokens = vec_size(pt);
+    UInt32 first_token = first == 0 ? 0 : decls[first].first_token;
+    bool is_tail = last + 1 < num_decls;
+    UInt32 stop_token = is_tail ? decls[last + 1].first_token : cast(UInt32)num_tokens;
+    UInt32 relex_begin = first == 0 ? 0 : DECL_BEGIN(&decls[first]);
+    UInt32 relex_end = is_tail ? cast(UInt32)(tokens[stop_token].offset + delta) : UInt32_MAX;
+
+    Vec* region = VEC_NEW(Token, (stop_token - first_token) + 16);
+    UInt32 stopped = lexer_lex_range(lexer, region, relex_begin, relex_end);
+    if(stopped == UInt32_MAX || (is_tail && stopped != relex_end)) {
+        // A lexer error, or the edit spilled over (eg. into an unterminated string)
+        vec_free(region);
+        return parser_reparse_all(parser);
+    }
+
+    // Splice the new tokens in, and move the ones after them
+    UInt32 num_region = cast(UInt32)vec_size(region);
+    vec_splice(pt, first_token, stop_token - first_token, region->core.data, num_region);
+    vec_free(region);
+    tokens = cast(Token*)vec_begin(pt);
+    num_tokens = vec_size(pt);
+    for(UInt64 i = first_token + num_region; i < num_tokens; i++)
+        tokens[i].offset = cast(UInt32)(tokens[i].offset + delta);
+    lexer->num_tokens = num_tokens;
+    Int64 token_delta = cast(Int64)num_region - cast(Int64)(stop_token - first_token);
+
+    // Reparse the damaged region (reusing the declarations that are unchanged) on its own
+    Vec* nodelist = parser->nodelist;
+    Vec* old_decls = parser->decls;
+    parser->nodelist = VEC_NEW(AstNode, 16);
+    parser->decls = VEC_NEW(ParserDecl, 16);
+    parser->num_tokens = num_tokens;
+    parser->offset = first_token;
+    parser->curr_tok = &tokens[first_token];
+    UInt32 stop = first_token + num_region;
+    bool is_ok = parser_parse_decls(parser, is_tail ? stop : UInt64_MAX, &decls[first], 
+                                    cast(AstNode*)vec_at(nodelist, first), last - first + 1);
+    if(is_tail && parser->offset > stop) {
+        // A declaration ran into the next one. Parse the rest of the file too
+        is_tail = false;
+        is_ok = parser_parse_decls(parser, UInt64_MAX, null, null, 0);
+    }
+
+    // ... and splice it in
+    Vec* region_nodes = parser->nodelist;
+    Vec* region_decls = parser->decls;
+    parser->nodelist = nodelist;
+    parser->decls = old_decls;
+    UInt32 num_removed = is_tail ? last - first + 1 : num_decls - first;
+    vec_splice(parser->nodelist, first, num_removed, region_nodes->core.data, vec_size(region_nodes));
+    vec_splice(parser->decls, first, num_removed, region_decls->core.data, vec_size(region_decls));
+    decls = cast(ParserDecl*)vec_begin(parser->decls);
+    for(UInt64 i = first + vec_size(region_decls); i < vec_size(parser->decls); i++)
+        parser_move_decl(parser, &decls[i], token_delta);
+    vec_free(region_nodes);
+    vec_free(region_decls);
+    // (The nodes of the declarations that were reparsed are left in the Ast, but nothing refers to them any more)
+    parser_set_ast_root(parser);
+
+    parser->has_errors = !is_ok;
+    return is_ok;
+}
+
+#undef DECL_BEGIN
+#undef DECL_END
 
 AstNode* return_result(Parser* parser) {
     return ast_parse_block_expr(parser);
 }
 
+void parser_set_allocator(Parser* parser, Allocator* allocator) {
+    CORETEN_ENFORCE(parser->arena->num_allocs == 0, "The Parser has already made nodes");
+    arena_free(parser->arena);
+    parser->arena = arena_new_with(0, allocator);
+}
+
 // Free a Parser* instance
-static void parser_free(Parser* parser) {
+void parser_free(Parser* parser) {
     if(SOME(parser)) {
         lexer_free(parser->lexer);
+        if(parser->owns_interner)
+            interner_free(parser->interner);
+        // This frees the entire AST
+        arena_free(parser->arena);
+        ast_free(parser->ast);
         buff_free(parser->mod_name);
         vec_free(parser->nodelist);
+        vec_free(parser->decls);
         free(parser);
     }
 }
\ No newline at end of file
@@ -18,17 +18,42 @@ Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
 #include <adorad/compiler/lexer.h>
 #include <adorad/compiler/tokens.h>
 
+// Span of a top-level declaration, recorded as it's parsed (see `parser_reparse()`)
+typedef struct ParserDecl {
+    UInt32 first_token; // index (in `toklist`) of the declaration's first token
+    UInt32 num_tokens;
+    UInt64 hash;        // content hash of those tokens (their kinds and values, _not_ their offsets)
+    TokenKind next_kind;// kind of the token that follows (the Parser may have looked at it)
+    UInt32 ast_begin;   // the nodes `[ast_begin, ast_end)` of `Parser.ast` are those of the declaration
+    UInt32 ast_end;
+} ParserDecl;
+
+VEC_DEFINE(ParserDecl)
+
 // Each Adorad source file can be represented by a `Parser` structure.
 // This means if there are `n` source files, there will be `n` Parser instances (one for each file).
 typedef struct Parser {
     UInt32 id;
     Buff* fullpath;     // path/to/file.ad
     // Buff* basename;     // file.ad
-    Vec* nodelist;      // List of `AstNode*`s
+    Vec* nodelist;      // List of `AstNode*`s (the top-level declarations, once parsed)
+    Vec* decls;         // List of `ParserDecl`s (`decls[i]` is the span of `nodelist[i]`). Empty if `is_streaming`
+    bool has_errors;    // set if the last parse had errors
+    Arena* arena;       // every AstNode (and its payload, lists included) is allocated from here, and freed along with
+                        // the Parser
+    Ast* ast;           // index-based (struct-of-arrays) AST of the file, filled in as it's parsed (see `Ast`)
     Lexer* lexer;
-    Vec* toklist;       // shortcut to `lexer->toklist`
+    Interner* interner; // names and strings in the AST are interned here (shared with `lexer`, if it has one)
+    bool owns_interner; // set if `interner` was made by (and is freed with) the Parser
+    Diagnostics* diags; // errors are reported here and recovered from, if set (shared with `lexer`)
+    jmp_buf* on_error;  // innermost synchronization point (see `ast_parse_root()` and `ast_parse_block()`)
+    Stats* stats;       // if set, `parser_parse()` counts nodes, allocations and time here (shared with `lexer`)
+    bool fold_constants;// fold operators on literals (eg. `1 << 12 | 0x40`) into a single literal as they're parsed
+                        // (on by default - see <adorad/compiler/fold.h>)
+    Vec* toklist;       // shortcut to `lexer->toklist` (null if `is_streaming`)
     Token* curr_tok;
-    UInt32 offset;      // offset of `curr_tok` in `toklist`
+    UInt32 offset;      // offset of `curr_tok` in `toklist` (or in the token stream if `is_streaming`)
+    bool is_streaming;  // set if tokens are pulled from the Lexer on demand (see `parser_init_stream()`)
     UInt64 num_tokens;
     UInt64 num_lines;
 
@@ -39,8 +64,29 @@ typedef struct Parser {
 } Parser;
 
 Parser* parser_init(Lexer* lexer);
-static void parser_free(Parser* parser);
-AstNode* ast_create_node(AstNodeKind type);
+// Same as `parser_init()`, except that the Parser pulls tokens from `lexer` as it goes (see `lexer_next_token()`)
+// instead of requiring `lexer_lex()` to have been called beforehand.
+Parser* parser_init_stream(Lexer* lexer);
+void parser_free(Parser* parser);
+// Allocate the AST (the blocks of `parser->arena`) from `allocator` (eg. a `TrackingAllocator`, to account for it). 
+// `allocator` is not owned by the Parser, and must outlive it. Must be set before anything is parsed.
+void parser_set_allocator(Parser* parser, Allocator* allocator);
+// Parse the whole file. Returns false if there were any errors (which are only returned - rather than reported as
+// we exit - if `lexer` has a Diagnostics. See `lexer_set_diagnostics()`)
+bool parser_parse(Parser* parser);
+// Bring the AST up to date after an edit: `[edit_begin, edit_end)` of the old source was replaced with `new_len` 
+// bytes, giving `source` (which, like the Lexical buffer, is not copied). Only the damaged region - the top-level 
+// declarations touching the edit - is relexed and reparsed. Of those, declarations whose tokens are unchanged are not
+// even reparsed: their nodes are reused. Everything else (tokens and nodes) is kept as is.
+// If the last parse had errors (or the edit can't be contained), the whole file is relexed and reparsed instead.
+// Nodes of replaced declarations are only freed by a full reparse (or with the Parser).
+// Returns false if there were any errors. Not supported when `is_streaming`.
+bool parser_reparse(Parser* parser, char* source, UInt32 edit_begin, UInt32 edit_end, UInt32 new_len);
+// Create a node (and its payload) of kind `kind` from the Parser's arena
+AstNode* ast_create_node(Parser* parser, AstNodeKind kind);
 AstNode* return_result(Parser* parser);
+// Returns the value of the string literal `node`: its spelling if it has no escapes (shared with the Interner), or
+// its unescaped value otherwise - made in the Parser's arena on each call, since few stages ever ask for it
+BuffView parser_string_value(Parser* parser, AstNode* node);
 
 #endif // ADORAD_PARSER_H
\ No newline at end of file
@@ -0,0 +1,154 @@
+// Auto-generated by tools/scripts/generate_tokens.py
+// DO NOT EDIT - regenerate with:
+//     python tools/scripts/generate_tokens.py precedence adorad/compiler/tokens.h adorad/compiler/precedence.h adorad/compiler/precedence.c
+
+#include <adorad/compiler/precedence.h>
+
+// If this fails, `ALLTOKENS` has changed and this file must be regenerated
+CORETEN_STATIC_ASSERT(TOK_COUNT == 143);
+
+const BinaryOpInfo binaryOpTable[TOK_COUNT] = {
+    [TOK_NULL]                         = { PREC_NONE, BinaryOpKindInvalid },
+    [TOK_ILLEGAL]                      = { PREC_NONE, BinaryOpKindInvalid },
+    [TOK_EOF]                          = { PREC_NONE, BinaryOpKindInvalid },
+    [COMMENT]                          = { PREC_NONE, BinaryOpKindInvalid },
+    [DOCS_COMMENT]                     = { PREC_NONE, BinaryOpKindInvalid },
+    [UNREACHABLE]                      = { PREC_NONE, BinaryOpKindInvalid },
+    [BUILTIN]                          = { PREC_NONE, BinaryOpKindInvalid },
+    [TOK___LITERALS_BEGIN]             = { PREC_NONE, BinaryOpKindInvalid },
+    [IDENTIFIER]                       = { PREC_NONE, BinaryOpKindInvalid },
+    [INTEGER]                          = { PREC_NONE, BinaryOpKindInvalid },
+    [BIN_INT]                          = { PREC_NONE, BinaryOpKindInvalid },
+    [HEX_INT]                          = { PREC_NONE, BinaryOpKindInvalid },
+    [OCT_INT]                          = { PREC_NONE, BinaryOpKindInvalid },
+    [UINT_LIT]                         = { PREC_NONE, BinaryOpKindInvalid },
+    [FLOAT_LIT]                        = { PREC_NONE, BinaryOpKindInvalid },
+    [IMAG]                             = { PREC_NONE, BinaryOpKindInvalid },
+    [RUNE]                             = { PREC_NONE, BinaryOpKindInvalid },
+    [CHAR_LIT]                         = { PREC_NONE, BinaryOpKindInvalid },
+    [STRING]                           = { PREC_NONE, BinaryOpKindInvalid },
+    [RAW_STRING]                       = { PREC_NONE, BinaryOpKindInvalid },
+    [TRIPLE_STRING]                    = { PREC_NONE, BinaryOpKindInvalid },
+    [TOK_TRUE]                         = { PREC_NONE, BinaryOpKindInvalid },
+    [TOK_FALSE]                        = { PREC_NONE, BinaryOpKindInvalid },
+    [TOK___LITERALS_END]               = { PREC_NONE, BinaryOpKindInvalid },
+    [TOK___OPERATORS_BEGIN]            = { PREC_NONE, BinaryOpKindInvalid },
+    [OPERATOR]                         = { PREC_NONE, BinaryOpKindInvalid },
+    [PLUS]                             = { 50, BinaryOpKindAdd },
+    [MINUS]                            = { 50, BinaryOpKindSubtract },
+    [MULT]                             = { 60, BinaryOpKindMult },
+    [SLASH]                            = { 60, BinaryOpKindDiv },
+    [MOD]                              = { 60, BinaryOpKindMod },
+    [MOD_MOD]                          = { PREC_NONE, BinaryOpKindInvalid },
+    [PLUS_PLUS]                        = { PREC_NONE, BinaryOpKindInvalid },
+    [MINUS_MINUS]                      = { PREC_NONE, BinaryOpKindInvalid },
+    [MULT_MULT]                        = { PREC_NONE, BinaryOpKindInvalid },
+    [SLASH_SLASH]                      = { PREC_NONE, BinaryOpKindInvalid },
+    [AT_SIGN]                          = { PREC_NONE, BinaryOpKindInvalid },
+    [HASH_SIGN]                        = { PREC_NONE, BinaryOpKindInvalid },
+    [QUESTION]                         = { PREC_NONE, BinaryOpKindInvalid },
+    [TOK___COMP_OPERATORS_BEGIN]       = { PREC_NONE, BinaryOpKindInvalid },
+    [GREATER_THAN]                     = { 30, BinaryOpKindCmpGreaterThan },
+    [LESS_THAN]                        = { 30, BinaryOpKindCmpLessThan },
+    [GREATER_THAN_OR_EQUAL_TO]         = { 30, BinaryOpKindCmpGreaterThanorEqualTo },
+    [LESS_THAN_OR_EQUAL_TO]            = { 30, BinaryOpKindCmpLessThanorEqualTo },
+    [EQUALS_EQUALS]                    = { 30, BinaryOpKindCmpEqual },
+    [EXCLAMATION_EQUALS]               = { 30, BinaryOpKindCmpNotEqual },
+    [TOK___COMP_OPERATORS_END]         = { PREC_NONE, BinaryOpKindInvalid },
+    [TOK___ASSIGNMENT_OPERATORS_BEGIN] = { PREC_NONE, BinaryOpKindInvalid },
+    [EQUALS]                           = { PREC_NONE, BinaryOpKindInvalid },
+    [PLUS_EQUALS]                      = { 50, BinaryOpKindAssignmentPlus },
+    [MINUS_EQUALS]                     = { 50, BinaryOpKindAssignmentMinus },
+    [MULT_EQUALS]                      = { PREC_NONE, BinaryOpKindInvalid },
+    [SLASH_EQUALS]                     = { PREC_NONE, BinaryOpKindInvalid },
+    [MOD_EQUALS]                       = { PREC_NONE, BinaryOpKindInvalid },
+    [AND_EQUALS]                       = { PREC_NONE, BinaryOpKindInvalid },
+    [OR_EQUALS]                        = { PREC_NONE, BinaryOpKindInvalid },
+    [XOR_EQUALS]                       = { PREC_NONE, BinaryOpKindInvalid },
+    [LBITSHIFT_EQUALS]                 = { PREC_NONE, BinaryOpKindInvalid },
+    [RBITSHIFT_EQUALS]                 = { PREC_NONE, BinaryOpKindInvalid },
+    [TILDA]                            = { PREC_NONE, BinaryOpKindInvalid },
+    [TILDA_EQUALS]                     = { PREC_NONE, BinaryOpKindInvalid },
+    [TOK___ASSIGNMENT_OPERATORS_END]   = { PREC_NONE, BinaryOpKindInvalid },
+    [TOK___ARROW_OPERATORS_BEGIN]      = { PREC_NONE, BinaryOpKindInvalid },
+    [EQUALS_ARROW]                     = { PREC_NONE, BinaryOpKindInvalid },
+    [RARROW]                           = { PREC_NONE, BinaryOpKindInvalid },
+    [LARROW]                           = { PREC_NONE, BinaryOpKindInvalid },
+    [TOK___ARROW_OPERATORS_END]        = { PREC_NONE, BinaryOpKindInvalid },
+    [TOK___DELIMITERS_OPERATORS_BEGIN] = { PREC_NONE, BinaryOpKindInvalid },
+    [LSQUAREBRACK]                     = { PREC_NONE, BinaryOpKindInvalid },
+    [RSQUAREBRACK]                     = { PREC_NONE, BinaryOpKindInvalid },
+    [LBRACE]                           = { PREC_NONE, BinaryOpKindInvalid },
+    [RBRACE]                           = { PREC_NONE, BinaryOpKindInvalid },
+    [LPAREN]                           = { PREC_NONE, BinaryOpKindInvalid },
+    [RPAREN]                           = { PREC_NONE, BinaryOpKindInvalid },
+    [TOK___DELIMITERS_OPERATORS_END]   = { PREC_NONE, BinaryOpKindInvalid },
+    [TOK___BITWISE_OPERATORS_BEGIN]    = { PREC_NONE, BinaryOpKindInvalid },
+    [LBITSHIFT]                        = { 40, BinaryOpKindBitshitLeft },
+    [RBITSHIFT]                        = { 40, BinaryOpKindBitshitRight },
+    [AND]                              = { 20, BinaryOpKindBoolAnd },
+    [OR]                               = { 10, BinaryOpKindBoolOr },
+    [EXCLAMATION]                      = { PREC_NONE, BinaryOpKindInvalid },
+    [XOR]                              = { PREC_NONE, BinaryOpKindInvalid },
+    [AND_NOT]                          = { PREC_NONE, BinaryOpKindInvalid },
+    [AND_AND]                          = { PREC_NONE, BinaryOpKindInvalid },
+    [OR_OR]                            = { PREC_NONE, BinaryOpKindInvalid },
+    [TOK___BITWISE_OPERATORS_END]      = { PREC_NONE, BinaryOpKindInvalid },
+    [TOK___OPERATORS_END]              = { PREC_NONE, BinaryOpKindInvalid },
+    [TOK___SEPARATORS_BEGIN]           = { PREC_NONE, BinaryOpKindInvalid },
+    [COLON]                            = { PREC_NONE, BinaryOpKindInvalid },
+    [COLON_COLON]                      = { PREC_NONE, BinaryOpKindInvalid },
+    [SEMICOLON]                        = { PREC_NONE, BinaryOpKindInvalid },
+    [COMMA]                            = { PREC_NONE, BinaryOpKindInvalid },
+    [DOT]                              = { PREC_NONE, BinaryOpKindInvalid },
+    [DDOT]                             = { PREC_NONE, BinaryOpKindInvalid },
+    [ELLIPSIS]                         = { PREC_NONE, BinaryOpKindInvalid },
+    [BACKSLASH]                        = { PREC_NONE, BinaryOpKindInvalid },
+    [TOK___SEPARATORS_END]             = { PREC_NONE, BinaryOpKindInvalid },
+    [TOK___ATTRIBUTES_BEGIN]           = { PREC_NONE, BinaryOpKindInvalid },
+    [ATTR_COMPTIME]                    = { PREC_NONE, BinaryOpKindInvalid },
+    [ATTR_INLINE]                      = { PREC_NONE, BinaryOpKindInvalid },
+    [ATTR_NOINLINE]                    = { PREC_NONE, BinaryOpKindInvalid },
+    [ATTR_NORETURN]                    = { PREC_NONE, BinaryOpKindInvalid },
+    [ATTR_LIKELY]                      = { PREC_NONE, BinaryOpKindInvalid },
+    [ATTR_UNLIKELY]                    = { PREC_NONE, BinaryOpKindInvalid },
+    [TOK___ATTRIBUTES_END]             = { PREC_NONE, BinaryOpKindInvalid },
+    [TOK___KEYWORDS_BEGIN]             = { PREC_NONE, BinaryOpKindInvalid },
+    [KEYWORD]                          = { PREC_NONE, BinaryOpKindInvalid },
+    [AS]                               = { PREC_NONE, BinaryOpKindInvalid },
+    [ALIAS]                            = { PREC_NONE, BinaryOpKindInvalid },
+    [BREAK]                            = { PREC_NONE, BinaryOpKindInvalid },
+    [CONST]                            = { PREC_NONE, BinaryOpKindInvalid },
+    [CONTINUE]                         = { PREC_NONE, BinaryOpKindInvalid },
+    [DEFAULT]                          = { PREC_NONE, BinaryOpKindInvalid },
+    [DEFER]                            = { PREC_NONE, BinaryOpKindInvalid },
+    [ENUM]                             = { PREC_NONE, BinaryOpKindInvalid },
+    [ELSE]                             = { PREC_NONE, BinaryOpKindInvalid },
+    [ELSEIF]                           = { PREC_NONE, BinaryOpKindInvalid },
+    [EXPORT]                           = { PREC_NONE, BinaryOpKindInvalid },
+    [FALLTHROUGH]                      = { PREC_NONE, BinaryOpKindInvalid },
+    [FROM]                             = { PREC_NONE, BinaryOpKindInvalid },
+    [FUNC]                             = { PREC_NONE, BinaryOpKindInvalid },
+    [GLOBAL]                           = { PREC_NONE, BinaryOpKindInvalid },
+    [IF]                               = { PREC_NONE, BinaryOpKindInvalid },
+    [IN]                               = { PREC_NONE, BinaryOpKindInvalid },
+    [LOOP]                             = { PREC_NONE, BinaryOpKindInvalid },
+    [MACRO]                            = { PREC_NONE, BinaryOpKindInvalid },
+    [MATCH]                            = { PREC_NONE, BinaryOpKindInvalid },
+    [MODULE]                           = { PREC_NONE, BinaryOpKindInvalid },
+    [MUTABLE]                          = { PREC_NONE, BinaryOpKindInvalid },
+    [NOT]                              = { PREC_NONE, BinaryOpKindInvalid },
+    [ORELSE]                           = { PREC_NONE, BinaryOpKindInvalid },
+    [PUT]                              = { PREC_NONE, BinaryOpKindInvalid },
+    [RAISE]                            = { PREC_NONE, BinaryOpKindInvalid },
+    [RANGE]                            = { PREC_NONE, BinaryOpKindInvalid },
+    [RETURN]                           = { PREC_NONE, BinaryOpKindInvalid },
+    [STRUCT]                           = { PREC_NONE, BinaryOpKindInvalid },
+    [TRY]                              = { PREC_NONE, BinaryOpKindInvalid },
+    [TYPEOF]                           = { PREC_NONE, BinaryOpKindInvalid },
+    [WHEN]                             = { PREC_NONE, BinaryOpKindInvalid },
+    [WHERE]                            = { PREC_NONE, BinaryOpKindInvalid },
+    [UNION]                            = { PREC_NONE, BinaryOpKindInvalid },
+    [USE]                              = { PREC_NONE, BinaryOpKindInvalid },
+    [TOK___KEYWORDS_END]               = { PREC_NONE, BinaryOpKindInvalid },
+};
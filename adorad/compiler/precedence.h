@@ -0,0 +1,32 @@
+// Auto-generated by tools/scripts/generate_tokens.py
+// DO NOT EDIT - regenerate with:
+//     python tools/scripts/generate_tokens.py precedence adorad/compiler/tokens.h adorad/compiler/precedence.h adorad/compiler/precedence.c
+
+#ifndef ADORAD_PRECEDENCE_H
+#define ADORAD_PRECEDENCE_H
+
+#include <adorad/core/types.h>
+#include <adorad/compiler/tokens.h>
+#include <adorad/compiler/ast.h>
+
+/*
+    Binary operator table, indexed by TokenKind. Every token has an entry - tokens that aren't binary operators have
+    a precedence of PREC_NONE (and BinaryOpKindInvalid), so the Parser finds out both whether a token is a binary
+    operator and how strongly it binds with a single load (see `ast_parse_precedence()` in parser.c).
+    Higher precedence values bind more strongly.
+*/
+#define PREC_NONE       0
+
+typedef struct BinaryOpInfo {
+    UInt8 prec;
+    UInt8 op;       // BinaryOpKind
+} BinaryOpInfo;
+
+extern const BinaryOpInfo binaryOpTable[TOK_COUNT];
+
+// Precedence of `kind` (PREC_NONE if it isn't a binary operator)
+#define BINOP_PRECEDENCE(kind)      (binaryOpTable[(kind)].prec)
+// BinaryOpKind of `kind` (BinaryOpKindInvalid if it isn't a binary operator)
+#define BINOP_KIND(kind)            (cast(BinaryOpKind)binaryOpTable[(kind)].op)
+
+#endif // ADORAD_PRECEDENCE_H
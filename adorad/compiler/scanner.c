@@ -0,0 +1,167 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#include <adorad/core/cpu.h>
+#include <adorad/core/compilers.h>
+#include <adorad/compiler/scanner.h>
+#include <adorad/compiler/charclass.h>
+
+// Every SIMD backend provides the same set of operations on a vector of bytes (`SimdVec`). A comparison yields a
+// vector with all bits set in the matching lanes, and `simd_mask()` packs such a vector into a bitmask with
+// `1 << SIMD_MASK_SHIFT` bits per lane (NEON has no `movemask`)
+#if defined(CORETEN_SIMD_AVX2)
+    #include <immintrin.h>
+    #define SCANNER_HAS_SIMD    1
+    #define SIMD_WIDTH          32
+    #define SIMD_MASK_SHIFT     0
+    #define SIMD_FULL_MASK      0xFFFFFFFFull
+
+    typedef __m256i SimdVec;
+    #define simd_load(p)        _mm256_loadu_si256(cast(const __m256i*)(p))
+    #define simd_set(c)         _mm256_set1_epi8(c)
+    #define simd_eq(v, c)       _mm256_cmpeq_epi8((v), simd_set(c))
+    #define simd_or(a, b)       _mm256_or_si256((a), (b))
+    #define simd_andnot(a, b)   _mm256_andnot_si256((b), (a))
+    #define simd_mask(v)        cast(UInt64)cast(UInt32)_mm256_movemask_epi8(v)
+
+    // Bytes in the range [lo, hi] (unsigned)
+    static inline SimdVec simd_in_range(SimdVec v, char lo, char hi) {
+        SimdVec t = _mm256_sub_epi8(v, simd_set(lo));
+        return _mm256_cmpeq_epi8(_mm256_min_epu8(t, simd_set(cast(char)(hi - lo))), t);
+    }
+#elif defined(CORETEN_SIMD_SSE2)
+    #include <emmintrin.h>
+    #define SCANNER_HAS_SIMD    1
+    #define SIMD_WIDTH          16
+    #define SIMD_MASK_SHIFT     0
+    #define SIMD_FULL_MASK      0xFFFFull
+
+    typedef __m128i SimdVec;
+    #define simd_load(p)        _mm_loadu_si128(cast(const __m128i*)(p))
+    #define simd_set(c)         _mm_set1_epi8(c)
+    #define simd_eq(v, c)       _mm_cmpeq_epi8((v), simd_set(c))
+    #define simd_or(a, b)       _mm_or_si128((a), (b))
+    #define simd_andnot(a, b)   _mm_andnot_si128((b), (a))
+    #define simd_mask(v)        cast(UInt64)cast(UInt32)_mm_movemask_epi8(v)
+
+    // Bytes in the range [lo, hi] (unsigned)
+    static inline SimdVec simd_in_range(SimdVec v, char lo, char hi) {
+        SimdVec t = _mm_sub_epi8(v, simd_set(lo));
+        return _mm_cmpeq_epi8(_mm_min_epu8(t, simd_set(cast(char)(hi - lo))), t);
+    }
+#elif defined(CORETEN_SIMD_NEON)
+    #include <arm_neon.h>
+    #define SCANNER_HAS_SIMD    1
+    #define SIMD_WIDTH          16
+    #define SIMD_MASK_SHIFT     2
+    #define SIMD_FULL_MASK      0xFFFFFFFFFFFFFFFFull
+
+    typedef uint8x16_t SimdVec;
+    #define simd_load(p)        vld1q_u8(cast(const uint8_t*)(p))
+    #define simd_set(c)         vdupq_n_u8(cast(uint8_t)(c))
+    #define simd_eq(v, c)       vceqq_u8((v), simd_set(c))
+    #define simd_or(a, b)       vorrq_u8((a), (b))
+    #define simd_andnot(a, b)   vbicq_u8((a), (b))
+    // Narrow every byte to 4 bits
+    #define simd_mask(v)        vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(v), 4)), 0)
+
+    // Bytes in the range [lo, hi] (unsigned)
+    static inline SimdVec simd_in_range(SimdVec v, char lo, char hi) {
+        return vcleq_u8(vsubq_u8(v, simd_set(lo)), simd_set(hi - lo));
+    }
+#endif // CORETEN_SIMD_AVX2
+
+#ifdef SCANNER_HAS_SIMD
+    #if defined(CORETEN_COMPILER_MSVC)
+        #include <intrin.h>
+    #endif // CORETEN_COMPILER_MSVC
+
+    // Index of the first lane set in `mask` (which must not be 0)
+    static inline UInt32 scanner_first_lane(UInt64 mask) {
+    #if defined(CORETEN_COMPILER_MSVC)
+        unsigned long index;
+        _BitScanForward64(&index, mask);
+        return cast(UInt32)index >> SIMD_MASK_SHIFT;
+    #else
+        return cast(UInt32)__builtin_ctzll(mask) >> SIMD_MASK_SHIFT;
+    #endif // CORETEN_COMPILER_MSVC
+    }
+#endif // SCANNER_HAS_SIMD
+
+UInt32 scan_blanks(const char* data, UInt32 pos, UInt32 end) {
+#ifdef SCANNER_HAS_SIMD
+    while(pos + SIMD_WIDTH <= end) {
+        SimdVec v = simd_load(data + pos);
+        // '\t', '\v', '\f' and '\r' are [9, 13] (except for '\n')
+        SimdVec blank = simd_or(simd_eq(v, ' '), simd_andnot(simd_in_range(v, '\t', '\r'), simd_eq(v, '\n')));
+        UInt64 mask = simd_mask(blank) ^ SIMD_FULL_MASK;
+        if(mask != 0)
+            return pos + scanner_first_lane(mask);
+        pos += SIMD_WIDTH;
+    }
+#endif // SCANNER_HAS_SIMD
+
+    while(pos < end && CHAR_IS(data[pos], CHAR_BLANK))
+        ++pos;
+    return pos;
+}
+
+UInt32 scan_identifier(const char* data, UInt32 pos, UInt32 end) {
+#ifdef SCANNER_HAS_SIMD
+    while(pos + SIMD_WIDTH <= end) {
+        SimdVec v = simd_load(data + pos);
+        // Setting bit 5 maps [A-Z] onto [a-z] (and nothing else onto [a-z])
+        SimdVec ident = simd_or(simd_in_range(simd_or(v, simd_set(0x20)), 'a', 'z'),
+                                simd_or(simd_in_range(v, '0', '9'), simd_eq(v, '_')));
+        UInt64 mask = simd_mask(ident) ^ SIMD_FULL_MASK;
+        if(mask != 0)
+            return pos + scanner_first_lane(mask);
+        pos += SIMD_WIDTH;
+    }
+#endif // SCANNER_HAS_SIMD
+
+    while(pos < end && CHAR_IS(data[pos], CHAR_IDENT))
+        ++pos;
+    return pos;
+}
+
+UInt32 scan_until(const char* data, UInt32 pos, UInt32 end, char c) {
+#ifdef SCANNER_HAS_SIMD
+    while(pos + SIMD_WIDTH <= end) {
+        UInt64 mask = simd_mask(simd_eq(simd_load(data + pos), c));
+        if(mask != 0)
+            return pos + scanner_first_lane(mask);
+        pos += SIMD_WIDTH;
+    }
+#endif // SCANNER_HAS_SIMD
+
+    while(pos < end && data[pos] != c)
+        ++pos;
+    return pos;
+}
+
+UInt32 scan_until2(const char* data, UInt32 pos, UInt32 end, char c1, char c2) {
+#ifdef SCANNER_HAS_SIMD
+    while(pos + SIMD_WIDTH <= end) {
+        SimdVec v = simd_load(data + pos);
+        UInt64 mask = simd_mask(simd_or(simd_eq(v, c1), simd_eq(v, c2)));
+        if(mask != 0)
+            return pos + scanner_first_lane(mask);
+        pos += SIMD_WIDTH;
+    }
+#endif // SCANNER_HAS_SIMD
+
+    while(pos < end && data[pos] != c1 && data[pos] != c2)
+        ++pos;
+    return pos;
+}
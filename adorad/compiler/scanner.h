@@ -0,0 +1,40 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#ifndef ADORAD_SCANNER_H
+#define ADORAD_SCANNER_H
+
+#include <adorad/core/misc.h>
+#include <adorad/core/types.h>
+
+/*
+    Run scanners used by the Lexer to skip over whitespace, comments, strings and identifiers in bulk (instead of
+    one character at a time).
+
+    Each scanner starts at `data[pos]` and returns the offset of the first byte in [pos, end) that ends the run, or
+    `end` if there is none. `end` is the length of `data` - no byte at or beyond `data[end]` is ever read.
+
+    The scanners are vectorized with AVX2 or SSE2 (x86) or NEON (ARM) depending on what `<adorad/core/cpu.h>`
+    reports at compile-time, with a scalar fallback.
+*/
+
+// Skip over ' ', '\t', '\r', '\v' and '\f' (_not_ '\n' - the Lexer needs to see newlines)
+UInt32 scan_blanks(const char* data, UInt32 pos, UInt32 end);
+// Skip over identifier characters [A-Za-z0-9_]
+UInt32 scan_identifier(const char* data, UInt32 pos, UInt32 end);
+// Find `c`
+UInt32 scan_until(const char* data, UInt32 pos, UInt32 end, char c);
+// Find either `c1` or `c2`
+UInt32 scan_until2(const char* data, UInt32 pos, UInt32 end, char c1, char c2);
+
+#endif // ADORAD_SCANNER_H
@@ -0,0 +1,311 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+// For `fdopen()` (this must come before the first system header)
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <adorad/core/debug.h>
+#include <adorad/core/os_defs.h>
+#include <adorad/compiler/server.h>
+#include <adorad/compiler/stats.h>
+
+#if !defined(CORETEN_OS_WINDOWS)
+    #include <poll.h>
+    #include <signal.h>
+    #include <sys/socket.h>
+    #include <sys/un.h>
+    #include <unistd.h>
+#endif
+
+// Returns `dir/fname` (to be freed with `free()`)
+static char* server_join(const char* dir, const char* fname) {
+    UInt64 len = strlen(dir) + strlen(fname) + 2;
+    char* path = cast(char*)malloc(len);
+    CORETEN_ENFORCE_NN(path, "Could not allocate memory. Memory full.");
+    snprintf(path, len, "%s/%s", dir, fname);
+    return path;
+}
+
+Server* server_new(const char* dir, ServerOptions* options) {
+#if defined(CORETEN_OS_WINDOWS)
+    (void)dir;
+    (void)options;
+    return null;
+#else
+    Server* server = cast(Server*)calloc(1, sizeof(Server));
+    CORETEN_ENFORCE_NN(server, "Could not allocate memory. Memory full.");
+    if(SOME(options))
+        server->options = *options;
+    if(server->options.poll_ms == 0)
+        server->options.poll_ms = SERVER_DEFAULT_POLL_MS;
+    if(server->options.request_timeout_ms == 0)
+        server->options.request_timeout_ms = SERVER_DEFAULT_REQUEST_TIMEOUT_MS;
+    server->dir = server_join(dir, "");
+    server->dir[strlen(server->dir) - 1] = nullchar;
+    server->socket_path = SOME(server->options.socket_path) ? server_join(server->options.socket_path, "") :
+                                                              server_join(dir, SERVER_DEFAULT_SOCKET);
+    if(SOME(server->options.socket_path))
+        server->socket_path[strlen(server->socket_path) - 1] = nullchar;
+    // Start from where the last build (of any kind) left off
+    char* graph_path = server_join(dir, GRAPH_DEFAULT_FNAME);
+    server->graph = module_graph_load(graph_path);
+    free(graph_path);
+    server->listen_fd = -1;
+    server->start = stats_now();
+    return server;
+#endif
+}
+
+void server_free(Server* server) {
+    if(NONE(server))
+        return;
+    module_graph_free(server->graph);
+    if(SOME(server->report.diags))
+        diagnostics_free(server->report.diags);
+    free(server->socket_path);
+    free(server->dir);
+    free(server);
+}
+
+// Has any file under the directory been added, removed or changed (by size or modification time) since the last
+// build?
+static bool server_is_stale(Server* server) {
+    // Nothing built yet by this server (even if the graph was loaded, its diagnostics weren't)
+    if(NONE(server->graph) || NONE(server->report.diags))
+        return true;
+    Vec* fnames = build_find_files(server->dir);
+    if(NONE(fnames))
+        return true;
+    bool is_stale = vec_size(fnames) != vec_size(server->graph->files);
+    for(UInt64 i = 0; i < vec_size(fnames); i++) {
+        char* fname = *cast(char**)vec_at(fnames, i);
+        GraphFile* file = is_stale ? null : module_graph_find_file(server->graph, fname);
+        FileInfo info;
+        is_stale = is_stale || NONE(file) || !file_info(fname, &info) || info.size != file->info.size ||
+                   info.mtime_ns != file->info.mtime_ns;
+        free(fname);
+    }
+    vec_free(fnames);
+    return is_stale;
+}
+
+bool server_update(Server* server) {
+    if(!server_is_stale(server))
+        return true;
+    GraphBuildReport report;
+    ModuleGraph* graph = module_graph_build(server->graph, server->dir, &server->options.build, &report);
+    if(NONE(graph))
+        return false;
+    module_graph_free(server->graph);
+    if(SOME(server->report.diags))
+        diagnostics_free(server->report.diags);
+    server->graph = graph;
+    server->report = report;
+    server->num_builds += report.num_waves > 0;
+    return true;
+}
+
+bool server_handle(Server* server, const char* request, FILE* out) {
+    server->num_requests++;
+    UInt64 len = strcspn(request, "\r\n");
+    bool is_check = strncmp(request, "check", len) == 0 && len == 5;
+    bool is_build = strncmp(request, "build", len) == 0 && len == 5;
+    if(is_check || is_build) {
+        UInt64 start = stats_now();
+        UInt64 num_builds = server->num_builds;
+        if(!server_update(server)) {
+            fprintf(out, "Cannot open directory `%s`\ndone 1\n", server->dir);
+            return true;
+        }
+        diagnostics_print(server->report.diags, out);
+        if(server->num_builds != num_builds)
+            graph_print_report(&server->report, out);
+        else
+            fprintf(out, "Up to date: %u file(s) in %u module(s), checked in %.3f ms\n", server->report.num_files,
+                    server->report.num_modules, cast(double)(stats_now() - start) / 1e6);
+        if(is_build) {
+            char* graph_path = server_join(server->dir, GRAPH_DEFAULT_FNAME);
+            if(!module_graph_save(server->graph, graph_path))
+                fprintf(out, "Cannot save the module graph to `%s`\n", graph_path);
+            free(graph_path);
+        }
+        fprintf(out, "done %d\n", server->report.ok ? 0 : 1);
+        return true;
+    }
+    if(strncmp(request, "status", len) == 0 && len == 6) {
+        fprintf(out, "Serving `%s` for %.3f s: %u file(s) in %u module(s), %llu request(s), %llu build(s)\n",
+                server->dir, cast(double)(stats_now() - server->start) / 1e9,
+                SOME(server->graph) ? cast(UInt32)vec_size(server->graph->files) : 0,
+                SOME(server->graph) ? cast(UInt32)vec_size(server->graph->modules) : 0,
+                cast(unsigned long long)server->num_requests, cast(unsigned long long)server->num_builds);
+        fprintf(out, "done 0\n");
+        return true;
+    }
+    if(strncmp(request, "stop", len) == 0 && len == 4) {
+        fprintf(out, "done 0\n");
+        server->is_stopping = true;
+        return false;
+    }
+    fprintf(out, "Unknown request `%.*s` (expected check, build, status or stop)\ndone 1\n", cast(int)len, request);
+    return true;
+}
+
+#if defined(CORETEN_OS_WINDOWS)
+    bool server_run(Server* server) {
+        (void)server;
+        return false;
+    }
+
+    int server_request(const char* socket_path, const char* request, FILE* out) {
+        (void)socket_path;
+        (void)request;
+        (void)out;
+        return -1;
+    }
+#else
+    // Make the address of the socket at `path`. Returns false if the path is too long for one
+    static bool server_address(const char* path, struct sockaddr_un* addr) {
+        memset(addr, 0, sizeof(*addr));
+        addr->sun_family = AF_UNIX;
+        if(strlen(path) >= sizeof(addr->sun_path))
+            return false;
+        strcpy(addr->sun_path, path);
+        return true;
+    }
+
+    // Read a request line from `fd` into `request` (of SERVER_MAX_REQUEST bytes). Returns false if the client sent
+    // nothing (eg. `server_is_listening()` of another server), or didn't send its request within `timeout_ms`
+    // (requests are answered one at a time, so an idle client would stall the others)
+    static bool server_read_request(int fd, char* request, UInt32 timeout_ms) {
+        UInt64 deadline = stats_now() + cast(UInt64)timeout_ms * 1000000;
+        UInt64 len = 0;
+        while(len + 1 < SERVER_MAX_REQUEST) {
+            UInt64 now = stats_now();
+            struct pollfd pfd = { fd, POLLIN, 0 };
+            if(now >= deadline || poll(&pfd, 1, cast(int)((deadline - now + 999999) / 1000000)) <= 0)
+                return false;
+            ssize_t num = read(fd, request + len, SERVER_MAX_REQUEST - 1 - len);
+            if(num <= 0)
+                break;
+            len += cast(UInt64)num;
+            if(SOME(memchr(request, '\n', len)))
+                break;
+        }
+        request[len] = nullchar;
+        return len > 0;
+    }
+
+    // Returns whether a server is listening on the socket at `addr`
+    static bool server_is_listening(struct sockaddr_un* addr) {
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if(fd < 0)
+            return false;
+        bool is_listening = connect(fd, cast(struct sockaddr*)addr, sizeof(*addr)) == 0;
+        close(fd);
+        return is_listening;
+    }
+
+    bool server_run(Server* server) {
+        struct sockaddr_un addr;
+        if(!server_address(server->socket_path, &addr) || server_is_listening(&addr))
+            return false;
+        server->listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if(server->listen_fd < 0)
+            return false;
+        // Nothing answers on it, so the socket was left behind by a server that didn't stop cleanly
+        unlink(server->socket_path);
+        if(bind(server->listen_fd, cast(struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(server->listen_fd, 8) != 0) {
+            close(server->listen_fd);
+            server->listen_fd = -1;
+            return false;
+        }
+        // A client that goes away mid-response mustn't take the server with it
+        signal(SIGPIPE, SIG_IGN);
+
+        server_update(server);
+        server->is_stopping = false;
+        while(!server->is_stopping) {
+            struct pollfd pfd = { server->listen_fd, POLLIN, 0 };
+            int num_ready = poll(&pfd, 1, cast(int)server->options.poll_ms);
+            if(num_ready == 0) {
+                // Nothing asked for: keep up with the edits
+                server_update(server);
+                continue;
+            }
+            if(num_ready < 0)
+                continue;
+            int fd = accept(server->listen_fd, null, null);
+            if(fd < 0)
+                continue;
+            char request[SERVER_MAX_REQUEST];
+            if(!server_read_request(fd, request, server->options.request_timeout_ms)) {
+                close(fd);
+                continue;
+            }
+            FILE* out = fdopen(fd, "w");
+            if(NONE(out)) {
+                close(fd);
+                continue;
+            }
+            server_handle(server, request, out);
+            fclose(out);
+        }
+        close(server->listen_fd);
+        server->listen_fd = -1;
+        unlink(server->socket_path);
+        return true;
+    }
+
+    int server_request(const char* socket_path, const char* request, FILE* out) {
+        struct sockaddr_un addr;
+        if(!server_address(socket_path, &addr))
+            return -1;
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if(fd < 0)
+            return -1;
+        if(connect(fd, cast(struct sockaddr*)&addr, sizeof(addr)) != 0) {
+            close(fd);
+            return -1;
+        }
+        UInt64 len = strlen(request);
+        bool is_sent = write(fd, request, len) == cast(ssize_t)len && write(fd, "\n", 1) == 1;
+        shutdown(fd, SHUT_WR);
+
+        // Copy the response, keeping its last line (`done <status>`)
+        int status = -1;
+        char buffer[4096];
+        char line[64];
+        UInt32 line_len = 0;
+        ssize_t num;
+        while(is_sent && (num = read(fd, buffer, sizeof(buffer))) > 0) {
+            fwrite(buffer, 1, cast(size_t)num, out);
+            for(ssize_t i = 0; i < num; i++) {
+                if(buffer[i] == '\n') {
+                    line[line_len] = nullchar;
+                    if(strncmp(line, "done ", 5) == 0)
+                        status = atoi(line + 5);
+                    line_len = 0;
+                } else if(line_len + 1 < sizeof(line)) {
+                    line[line_len++] = buffer[i];
+                }
+            }
+        }
+        close(fd);
+        return status;
+    }
+#endif
@@ -0,0 +1,82 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#ifndef ADORAD_SERVER_H
+#define ADORAD_SERVER_H
+
+#include <stdio.h>
+
+#include <adorad/core/types.h>
+#include <adorad/compiler/build.h>
+#include <adorad/compiler/graph.h>
+
+/*
+    Compile server (`adorad serve <dir>`)
+    A long-running process that keeps the module graph of a directory in memory (see <adorad/compiler/graph.h>), and
+    answers requests over a local (Unix domain) socket. Between requests, it watches the directory - by polling the
+    size and modification time of its files every `ServerOptions.poll_ms` - and rebuilds what changed right away. So
+    by the time a request comes in, the build is usually done, and answering it is a walk of the directory.
+
+    Requests are single lines; responses are lines of text, the last of which is `done <status>` (0 if the build has
+    no errors):
+        check       rebuild what changed, and print the diagnostics and what was rebuilt
+        build       the same, then save the graph (so that the next cold `adorad build` is incremental too)
+        status      print what the server holds (files, modules, requests and builds so far)
+        stop        stop the server
+*/
+
+// Name of the socket, in the directory being served
+#define SERVER_DEFAULT_SOCKET   ".adorad-socket"
+// How often the directory is checked for changes (in milliseconds), unless asked otherwise
+#define SERVER_DEFAULT_POLL_MS  250
+// Longest request line
+#define SERVER_MAX_REQUEST      256
+// How long a client has to send its request (in milliseconds) before it's dropped, unless asked otherwise
+#define SERVER_DEFAULT_REQUEST_TIMEOUT_MS   1000
+
+typedef struct ServerOptions {
+    const char* socket_path;    // <dir>/SERVER_DEFAULT_SOCKET if null
+    UInt32 poll_ms;             // SERVER_DEFAULT_POLL_MS if 0
+    UInt32 request_timeout_ms;  // SERVER_DEFAULT_REQUEST_TIMEOUT_MS if 0
+    BuildOptions build;
+} ServerOptions;
+
+typedef struct Server {
+    ServerOptions options;
+    char* dir;
+    char* socket_path;
+    ModuleGraph* graph;         // of the last build (null before the first one)
+    GraphBuildReport report;    // of the last build
+    UInt64 num_requests;
+    UInt64 num_builds;          // builds that rebuilt something
+    UInt64 start;               // when the server was made (see `stats_now()`)
+    int listen_fd;              // -1 unless listening
+    bool is_stopping;
+} Server;
+
+// Make a server for `dir`, with the graph saved by the last build (if any). `options` may be null (for the
+// defaults). Returns null if the platform has no local sockets
+Server* server_new(const char* dir, ServerOptions* options);
+void server_free(Server* server);
+// Rebuild what changed since the last build. Returns false if `dir` couldn't be opened
+bool server_update(Server* server);
+// Answer `request` (see above) to `out`. Returns false once the server is to stop
+bool server_handle(Server* server, const char* request, FILE* out);
+// Listen on the socket, and answer requests (one at a time) until a `stop`. Returns false if the socket couldn't be
+// made, or if a server is already listening on it
+bool server_run(Server* server);
+// Send `request` to the server listening on `socket_path`, and copy its response to `out`. Returns the status the
+// response ended with, or -1 if there's no server (or it went away)
+int server_request(const char* socket_path, const char* request, FILE* out);
+
+#endif // ADORAD_SERVER_H
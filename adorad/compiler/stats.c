@@ -0,0 +1,78 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#include <stdlib.h>
+#include <time.h>
+
+#include <adorad/core/debug.h>
+#include <adorad/compiler/stats.h>
+
+static const char* const stats_phase_names[StatsPhaseCount] = { "read", "lex", "parse", "check", "codegen" };
+
+Stats* stats_new() {
+    Stats* stats = cast(Stats*)calloc(1, sizeof(Stats));
+    CORETEN_ENFORCE_NN(stats, "Could not allocate memory. Memory full.");
+    return stats;
+}
+
+void stats_free(Stats* stats) {
+    free(stats);
+}
+
+void stats_merge(Stats* into, Stats* from) {
+    into->num_files += from->num_files;
+    into->bytes_scanned += from->bytes_scanned;
+    into->num_tokens += from->num_tokens;
+    into->num_nodes += from->num_nodes;
+    for(UInt32 i = 0; i <= AstNodeKindRoot; i++)
+        into->nodes_by_kind[i] += from->nodes_by_kind[i];
+    for(UInt32 i = 0; i < StatsPhaseCount; i++) {
+        into->phases[i].num_runs += from->phases[i].num_runs;
+        into->phases[i].nanoseconds += from->phases[i].nanoseconds;
+        into->phases[i].num_allocs += from->phases[i].num_allocs;
+        into->phases[i].bytes_allocated += from->phases[i].bytes_allocated;
+    }
+}
+
+const char* stats_phase_str(StatsPhase phase) {
+    return stats_phase_names[phase];
+}
+
+UInt64 stats_now() {
+    return clock_monotonic_ns();
+}
+
+void stats_add_run(Stats* stats, StatsPhase phase, UInt64 start) {
+    ++stats->phases[phase].num_runs;
+    stats->phases[phase].nanoseconds += stats_now() - start;
+}
+
+void stats_print(Stats* stats, FILE* stream) {
+    fprintf(stream, "Files:          %llu\n", cast(unsigned long long)stats->num_files);
+    fprintf(stream, "Bytes scanned:  %llu\n", cast(unsigned long long)stats->bytes_scanned);
+    fprintf(stream, "Tokens:         %llu\n", cast(unsigned long long)stats->num_tokens);
+    fprintf(stream, "AST nodes:      %llu\n", cast(unsigned long long)stats->num_nodes);
+    for(UInt32 i = 0; i <= AstNodeKindRoot; i++) {
+        if(stats->nodes_by_kind[i] > 0)
+            fprintf(stream, "    %-20s %llu\n", ast_node_kind_str(cast(AstNodeKind)i), 
+                    cast(unsigned long long)stats->nodes_by_kind[i]);
+    }
+
+    fprintf(stream, "%-8s %8s %12s %12s %14s\n", "Phase", "Runs", "Time (ms)", "Allocs", "Bytes");
+    for(UInt32 i = 0; i < StatsPhaseCount; i++) {
+        StatsPhaseCounters* phase = &stats->phases[i];
+        fprintf(stream, "%-8s %8llu %12.3f %12llu %14llu\n", stats_phase_names[i], 
+                cast(unsigned long long)phase->num_runs, cast(double)phase->nanoseconds / 1e6, 
+                cast(unsigned long long)phase->num_allocs, cast(unsigned long long)phase->bytes_allocated);
+    }
+}
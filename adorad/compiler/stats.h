@@ -0,0 +1,93 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#ifndef ADORAD_STATS_H
+#define ADORAD_STATS_H
+
+#include <stdio.h>
+
+#include <adorad/core/types.h>
+#include <adorad/core/debug.h>
+#include <adorad/core/misc.h>
+#include <adorad/core/clock.h>
+#include <adorad/compiler/ast.h>
+
+/*
+    Front end statistics
+    Counters of what the Lexer and the Parser did, and of what it cost: tokens made, bytes scanned, AST nodes (by kind)
+    and, for each phase, the time spent, the number of allocations and the bytes allocated.
+
+    Stats are opt-in: a Lexer only keeps them if it's given a `Stats` (see `lexer_set_stats()`), and its Parser uses 
+    the same one. Otherwise, the cost is a (well-predicted) branch per token and per node. A `Stats` isn't 
+    thread-safe - give each thread its own, and merge them (see `stats_merge()`).
+*/
+
+typedef enum StatsPhase {
+    StatsPhaseRead,     // reading (or mapping) source files
+    StatsPhaseLex,
+    StatsPhaseParse,
+    StatsPhaseCheck,    // semantic analysis
+    StatsPhaseCodegen,
+    StatsPhaseCount
+} StatsPhase;
+
+typedef struct StatsPhaseCounters {
+    UInt64 num_runs;    // no. of times the phase was run (eg. once per file)
+    UInt64 nanoseconds; // wall-clock time spent in the phase
+    UInt64 num_allocs;
+    UInt64 bytes_allocated;
+} StatsPhaseCounters;
+
+typedef struct Stats {
+    UInt64 num_files;
+    UInt64 bytes_scanned;   // no. of bytes of source lexed
+    UInt64 num_tokens;
+    UInt64 num_nodes;
+    UInt64 nodes_by_kind[AstNodeKindRoot + 1];
+    StatsPhaseCounters phases[StatsPhaseCount];
+} Stats;
+
+// Create a new (zeroed) Stats
+Stats* stats_new();
+void stats_free(Stats* stats);
+// Add the counters of `from` to `into`
+void stats_merge(Stats* into, Stats* from);
+// Print `stats` (in a human-readable form) to `stream`
+void stats_print(Stats* stats, FILE* stream);
+// Returns the name of `phase` (eg. "lex")
+const char* stats_phase_str(StatsPhase phase);
+// Monotonic wall-clock time (in nanoseconds), for timing phases (see `clock_monotonic_ns()`)
+UInt64 stats_now();
+// Add a run of `phase` that started at `start` (see `stats_now()`)
+void stats_add_run(Stats* stats, StatsPhase phase, UInt64 start);
+
+// Time the statement (or block) that follows as a run of `phase`. `stats` may be null, in which case the clock isn't 
+// read at all. Eg:
+//      STATS_TIME_PHASE(file->stats, StatsPhaseRead) {
+//          file->view = file_map(file->fname);
+//      }
+// Leaving the block early (with `break`, `return` or `goto`) skips counting the run
+#define STATS_TIME_PHASE(stats, phase)                                                                      \
+    for(UInt64 __stats_start = SOME(stats) ? stats_now() : 0, __stats_once = 1; __stats_once;                \
+        __stats_once = 0, SOME(stats) ? stats_add_run((stats), (phase), __stats_start) : (void)0)
+
+// Count an allocation of `bytes` bytes made during `phase`. `stats` may be null
+#define STATS_COUNT_ALLOC(stats, phase, bytes)                      \
+    do {                                                            \
+        if(CORETEN_UNLIKELY(SOME(stats))) {                         \
+            ++(stats)->phases[(phase)].num_allocs;                  \
+            (stats)->phases[(phase)].bytes_allocated += (bytes);    \
+        }                                                           \
+    } while(0)
+
+#endif // ADORAD_STATS_H
@@ -0,0 +1,194 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <adorad/core/debug.h>
+#include <adorad/compiler/table.h>
+
+// Bits of the hash of a key that pick its shard (the top ones: the slot is picked with the bottom ones)
+#define TABLE_SHARD_BITS    6
+#define TABLE_SHARD_OF(hash)    (cast(UInt32)((hash) >> (64 - TABLE_SHARD_BITS)))
+
+// Hash of the key (`module`, `name`)
+static inline UInt64 table_hash(SymbolId module, SymbolId name) {
+    UInt64 key = (cast(UInt64)module << 32) | name;
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDull;
+    key ^= key >> 33;
+    key *= 0xC4CEB9FE1A85EC53ull;
+    key ^= key >> 33;
+    return key;
+}
+
+static TableSlots* table_slots_new(UInt32 cap) {
+    TableSlots* slots = cast(TableSlots*)malloc(sizeof(TableSlots) + cap * sizeof(_Atomic(Symbol*)));
+    CORETEN_ENFORCE_NN(slots, "Could not allocate memory. Memory full.");
+    slots->prev = null;
+    slots->cap = cap;
+    for(UInt32 i = 0; i < cap; i++)
+        atomic_init(&slots->slots[i], null);
+    return slots;
+}
+
+Table* table_new() {
+    CORETEN_STATIC_ASSERT((1 << TABLE_SHARD_BITS) == TABLE_NUM_SHARDS);
+    Table* table = cast(Table*)calloc(1, sizeof(Table));
+    CORETEN_ENFORCE_NN(table, "Could not allocate memory. Memory full.");
+    for(UInt32 i = 0; i < TABLE_NUM_SHARDS; i++) {
+        TableShard* shard = &table->shards[i];
+        atomic_init(&shard->slots, table_slots_new(TABLE_SHARD_INITIAL_CAP));
+        atomic_init(&shard->len, 0);
+        mutex_init(&shard->lock);
+        shard->symbols = arena_new(0);
+    }
+    return table;
+}
+
+void table_free(Table* table) {
+    if(NONE(table))
+        return;
+    for(UInt32 i = 0; i < TABLE_NUM_SHARDS; i++) {
+        TableShard* shard = &table->shards[i];
+        TableSlots* slots = atomic_load(&shard->slots);
+        while(SOME(slots)) {
+            TableSlots* prev = slots->prev;
+            free(slots);
+            slots = prev;
+        }
+        mutex_destroy(&shard->lock);
+        arena_free(shard->symbols);
+    }
+    free(table);
+}
+
+// Find the key (`module`, `name`) in `slots`. Returns its symbol (or null), and sets `slot` to the slot that holds it
+// (or the empty one where it would go). The symbol is the one loaded while probing: the slot may have been filled by
+// now, if it was empty
+static inline Symbol* table_probe(TableSlots* slots, UInt64 hash, SymbolId module, SymbolId name,
+                                  _Atomic(Symbol*)** slot) {
+    UInt32 mask = slots->cap - 1;
+    for(UInt32 i = cast(UInt32)hash & mask;; i = (i + 1) & mask) {
+        Symbol* symbol = atomic_load_explicit(&slots->slots[i], memory_order_acquire);
+        if(NONE(symbol) || (symbol->name == name && symbol->module == module)) {
+            *slot = &slots->slots[i];
+            return symbol;
+        }
+    }
+}
+
+// Copy the shard's symbols into an array twice as large, and publish it. The shard must be locked
+static TableSlots* table_shard_grow(TableShard* shard, TableSlots* slots) {
+    TableSlots* grown = table_slots_new(slots->cap * 2);
+    for(UInt32 i = 0; i < slots->cap; i++) {
+        Symbol* symbol = atomic_load_explicit(&slots->slots[i], memory_order_relaxed);
+        if(SOME(symbol)) {
+            _Atomic(Symbol*)* slot;
+            table_probe(grown, table_hash(symbol->module, symbol->name), symbol->module, symbol->name, &slot);
+            atomic_store_explicit(slot, symbol, memory_order_relaxed);
+        }
+    }
+    grown->prev = slots;
+    atomic_store_explicit(&shard->slots, grown, memory_order_release);
+    return grown;
+}
+
+// Insert a copy of `symbol` (of hash `hash`) into `shard`, which must be locked
+static Symbol* table_shard_insert(TableShard* shard, const Symbol* symbol, UInt64 hash, bool* is_new) {
+    TableSlots* slots = atomic_load_explicit(&shard->slots, memory_order_relaxed);
+    _Atomic(Symbol*)* slot;
+    Symbol* found = table_probe(slots, hash, symbol->module, symbol->name, &slot);
+    *is_new = NONE(found);
+    if(SOME(found))
+        return found;
+
+    UInt32 len = atomic_load_explicit(&shard->len, memory_order_relaxed) + 1;
+    if(len * 2 > slots->cap) {
+        slots = table_shard_grow(shard, slots);
+        table_probe(slots, hash, symbol->module, symbol->name, &slot);
+    }
+    Symbol* copy = cast(Symbol*)arena_alloc_aligned(shard->symbols, sizeof(Symbol), _Alignof(Symbol));
+    memcpy(copy, symbol, sizeof(Symbol));
+    // Publish it only once it's complete
+    atomic_store_explicit(slot, copy, memory_order_release);
+    atomic_store_explicit(&shard->len, len, memory_order_relaxed);
+    return copy;
+}
+
+Symbol* table_insert(Table* table, const Symbol* symbol, bool* is_new) {
+    UInt64 hash = table_hash(symbol->module, symbol->name);
+    TableShard* shard = &table->shards[TABLE_SHARD_OF(hash)];
+    bool is_inserted;
+    mutex_lock(&shard->lock);
+    Symbol* result = table_shard_insert(shard, symbol, hash, &is_inserted);
+    mutex_unlock(&shard->lock);
+    if(SOME(is_new))
+        *is_new = is_inserted;
+    return result;
+}
+
+UInt32 table_insert_bulk(Table* table, const Symbol* symbols, UInt32 num, Symbol** results) {
+    if(num == 0)
+        return 0;
+    // Sort the symbols by shard (a counting sort), so that each shard is locked once
+    UInt64* hashes = cast(UInt64*)malloc(num * sizeof(UInt64));
+    UInt32* order = cast(UInt32*)malloc(num * sizeof(UInt32));
+    CORETEN_ENFORCE(SOME(hashes) && SOME(order), "Could not allocate memory. Memory full.");
+    UInt32 starts[TABLE_NUM_SHARDS + 1] = {0};
+    for(UInt32 i = 0; i < num; i++) {
+        hashes[i] = table_hash(symbols[i].module, symbols[i].name);
+        starts[TABLE_SHARD_OF(hashes[i]) + 1]++;
+    }
+    for(UInt32 i = 0; i < TABLE_NUM_SHARDS; i++)
+        starts[i + 1] += starts[i];
+    UInt32 next[TABLE_NUM_SHARDS];
+    memcpy(next, starts, sizeof(next));
+    for(UInt32 i = 0; i < num; i++)
+        order[next[TABLE_SHARD_OF(hashes[i])]++] = i;
+
+    UInt32 num_inserted = 0;
+    for(UInt32 s = 0; s < TABLE_NUM_SHARDS; s++) {
+        if(starts[s] == starts[s + 1])
+            continue;
+        TableShard* shard = &table->shards[s];
+        mutex_lock(&shard->lock);
+        for(UInt32 j = starts[s]; j < starts[s + 1]; j++) {
+            UInt32 i = order[j];
+            bool is_new;
+            Symbol* result = table_shard_insert(shard, &symbols[i], hashes[i], &is_new);
+            num_inserted += is_new;
+            if(SOME(results))
+                results[i] = result;
+        }
+        mutex_unlock(&shard->lock);
+    }
+    free(order);
+    free(hashes);
+    return num_inserted;
+}
+
+Symbol* table_find(Table* table, SymbolId module, SymbolId name) {
+    UInt64 hash = table_hash(module, name);
+    TableShard* shard = &table->shards[TABLE_SHARD_OF(hash)];
+    TableSlots* slots = atomic_load_explicit(&shard->slots, memory_order_acquire);
+    _Atomic(Symbol*)* slot;
+    return table_probe(slots, hash, module, name, &slot);
+}
+
+UInt32 table_len(Table* table) {
+    UInt32 len = 0;
+    for(UInt32 i = 0; i < TABLE_NUM_SHARDS; i++)
+        len += atomic_load_explicit(&table->shards[i].len, memory_order_relaxed);
+    return len;
+}
@@ -0,0 +1,99 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#ifndef ADORAD_TABLE_H
+#define ADORAD_TABLE_H
+
+#include <stdatomic.h>
+
+#include <adorad/core/types.h>
+#include <adorad/core/cpu.h>
+#include <adorad/core/memory.h>
+#include <adorad/core/thread.h>
+#include <adorad/compiler/intern.h>
+
+/*
+    Symbol table
+    The one table shared by every Parser of a compilation: every type, const and function, keyed by the (interned)
+    ids of its module and of its name. Ids only compare equal if the files were lexed with the same Interner, so the
+    files of a compilation must share one (see `lexer_set_interner()`).
+
+    Files are parsed in parallel, so the table is split into `TABLE_NUM_SHARDS` shards (picked by the hash of the
+    key), each an open-addressing array of pointers to Symbols:
+        * inserting locks only the shard it goes to. A file's declarations are inserted all at once (see
+          `table_insert_bulk()`), shard by shard, so a file takes each lock at most once;
+        * lookups don't lock at all: they load the shard's array, and probe it. A Symbol is only published (with a
+          release store) once it's complete, and is never moved or removed, so a lookup either sees it whole or not
+          at all. When a shard's array fills up, it's copied into one twice as large - the old one is kept (in
+          `prev`) until the table is freed, as lookups may still be probing it.
+    Arrays are kept at most half full, so a lookup probes a handful of slots, and never waits on an insert.
+*/
+
+typedef enum SymbolKind {
+    SymbolKindType,
+    SymbolKindConst,
+    SymbolKindFunc,
+    SymbolKindVar,
+    SymbolKindCount
+} SymbolKind;
+
+typedef struct Symbol {
+    SymbolId module;    // module it's declared in
+    SymbolId name;
+    SymbolKind kind;
+    UInt32 file;        // index of the file it's declared in (eg. `Parser.id`)
+    UInt32 offset;      // where it's declared (in the file)
+    void* decl;         // its declaration (eg. an AstNode), owned by the caller
+} Symbol;
+
+// No. of shards (a power of 2)
+#define TABLE_NUM_SHARDS            64
+// Initial no. of slots of a shard's array (a power of 2). It grows as needed
+#define TABLE_SHARD_INITIAL_CAP     64
+
+typedef struct TableSlots TableSlots;
+struct TableSlots {
+    TableSlots* prev;   // the array this one replaced (see above)
+    UInt32 cap;         // a power of 2
+    _Atomic(Symbol*) slots[];
+};
+
+typedef struct TableShard {
+    _Atomic(TableSlots*) slots;
+    _Atomic UInt32 len;
+    Mutex lock;         // guards inserting (and `symbols`)
+    Arena* symbols;     // storage for the Symbols of the shard
+    // Inserts into one shard shouldn't slow down lookups (or inserts) in the next
+    char __pad[CORETEN_CACHE_LINE_SIZE];
+} TableShard;
+
+typedef struct Table {
+    TableShard shards[TABLE_NUM_SHARDS];
+} Table;
+
+Table* table_new();
+// Free the table (and its Symbols). No thread may still be using it
+void table_free(Table* table);
+// Insert a copy of `symbol`, unless there's a symbol with the same module and name already. Returns the one in the
+// table (whichever it is). `is_new` (if not null) is set if `symbol` was inserted
+Symbol* table_insert(Table* table, const Symbol* symbol, bool* is_new);
+// Insert (copies of) `symbols[0..num)`, eg. every declaration of a file, once it's parsed. If `results` isn't null,
+// `results[i]` is set to the symbol in the table for `symbols[i]` - which isn't a copy of it if it was declared before.
+// Returns the no. of symbols inserted
+UInt32 table_insert_bulk(Table* table, const Symbol* symbols, UInt32 num, Symbol** results);
+// Returns the symbol `name` of `module`, or null. Safe to call while other threads insert
+Symbol* table_find(Table* table, SymbolId module, SymbolId name);
+// No. of symbols in the table
+UInt32 table_len(Table* table);
+
+#endif // ADORAD_TABLE_H
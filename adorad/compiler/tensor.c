@@ -0,0 +1,497 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <adorad/core/debug.h>
+#include <adorad/core/os_defs.h>
+#include <adorad/compiler/tensor.h>
+
+// What the emitted code needs of the C compiler to be vectorized
+#define TENSOR_VECTOR_GUARD     "defined(__GNUC__) && !defined(__TINYC__)"
+#define TENSOR_X86_GUARD        "(defined(__x86_64__) || defined(__i386__))"
+
+TensorKernel* tensor_kernel_new(const char* name, AdoradTypes type, UInt32 num_inputs, OutputArch arch) {
+    CORETEN_ENFORCE(type >= AdoradTypeTensorInt16 && type <= AdoradTypeTensorFloat64, "Not a tensor type");
+    TensorKernel* kernel = cast(TensorKernel*)calloc(1, sizeof(TensorKernel));
+    CORETEN_ENFORCE_NN(kernel, "Could not allocate memory. Memory full.");
+    kernel->name = name;
+    kernel->type = type;
+    kernel->num_inputs = num_inputs;
+    kernel->nodes = VEC_NEW(TensorNode, 16);
+    kernel->isa = tensor_isa_of_arch(arch);
+    for(UInt32 i = 0; i < num_inputs; i++) {
+        TensorNode node = { TensorOpInput, 0, 0, i, 0, 0 };
+        vec_push_TensorNode(kernel->nodes, &node);
+    }
+    return kernel;
+}
+
+void tensor_kernel_free(TensorKernel* kernel) {
+    if(NONE(kernel))
+        return;
+    vec_free(kernel->nodes);
+    free(kernel);
+}
+
+TensorNode* tensor_node(TensorKernel* kernel, TensorNodeId id) {
+    return vec_at_TensorNode(kernel->nodes, id);
+}
+
+static bool tensor_is_float(TensorKernel* kernel) {
+    return kernel->type == AdoradTypeTensorFloat32 || kernel->type == AdoradTypeTensorFloat64;
+}
+
+// Size of an element (in bytes)
+static UInt32 tensor_elem_size(AdoradTypes type) {
+    switch(type) {
+        case AdoradTypeTensorInt16: return 2;
+        case AdoradTypeTensorInt32: return 4;
+        case AdoradTypeTensorFloat32: return 4;
+        default: return 8;
+    }
+}
+
+static const char* tensor_elem_ctype(AdoradTypes type) {
+    switch(type) {
+        case AdoradTypeTensorInt16: return "int16_t";
+        case AdoradTypeTensorInt32: return "int32_t";
+        case AdoradTypeTensorInt64: return "int64_t";
+        case AdoradTypeTensorFloat32: return "float";
+        default: return "double";
+    }
+}
+
+// Returns the node (made, unless there's one like it already)
+static TensorNodeId tensor_intern(TensorKernel* kernel, TensorNode* node) {
+    for(UInt64 i = 0; i < vec_size(kernel->nodes); i++) {
+        TensorNode* other = vec_at_TensorNode(kernel->nodes, i);
+        if(other->op == node->op && other->lhs == node->lhs && other->rhs == node->rhs &&
+           other->input == node->input && other->int_value == node->int_value &&
+           (other->float_value == node->float_value ||
+            (isnan(other->float_value) && isnan(node->float_value))))
+            return cast(TensorNodeId)i;
+    }
+    vec_push_TensorNode(kernel->nodes, node);
+    return cast(TensorNodeId)(vec_size(kernel->nodes) - 1);
+}
+
+TensorNodeId tensor_input(TensorKernel* kernel, UInt32 index) {
+    CORETEN_ENFORCE(index < kernel->num_inputs, "No such input");
+    // The inputs are the first nodes
+    return index;
+}
+
+TensorNodeId tensor_const(TensorKernel* kernel, Float64 value) {
+    CORETEN_ENFORCE(tensor_is_float(kernel), "A float constant of an integer tensor");
+    if(kernel->type == AdoradTypeTensorFloat32)
+        value = cast(float)value;
+    TensorNode node = { TensorOpConst, 0, 0, 0, 0, value };
+    return tensor_intern(kernel, &node);
+}
+
+// Wrap `value` around to the width of the kernel's elements
+static Int64 tensor_wrap(TensorKernel* kernel, UInt64 value) {
+    switch(kernel->type) {
+        case AdoradTypeTensorInt16: return cast(Int16)cast(UInt16)value;
+        case AdoradTypeTensorInt32: return cast(Int32)cast(UInt32)value;
+        default: return cast(Int64)value;
+    }
+}
+
+TensorNodeId tensor_const_int(TensorKernel* kernel, Int64 value) {
+    CORETEN_ENFORCE(!tensor_is_float(kernel), "An integer constant of a float tensor");
+    TensorNode node = { TensorOpConst, 0, 0, 0, tensor_wrap(kernel, cast(UInt64)value), 0 };
+    return tensor_intern(kernel, &node);
+}
+
+// Fold `op` over constants `lhs` and `rhs` (`rhs` unused by unary operators) into `result`. Returns false if it
+// can't be (integer division by 0, or overflowing)
+static bool tensor_fold(TensorKernel* kernel, TensorOp op, TensorNode* lhs, TensorNode* rhs, TensorNode* result) {
+    *result = (TensorNode){ TensorOpConst, 0, 0, 0, 0, 0 };
+    if(tensor_is_float(kernel)) {
+        Float64 a = lhs->float_value;
+        Float64 b = SOME(rhs) ? rhs->float_value : 0;
+        switch(op) {
+            case TensorOpAdd: result->float_value = a + b; break;
+            case TensorOpSub: result->float_value = a - b; break;
+            case TensorOpMul: result->float_value = a * b; break;
+            case TensorOpDiv: result->float_value = a / b; break;
+            // As emitted (see `tensor_emit_node()`)
+            case TensorOpMin: result->float_value = a < b ? a : b; break;
+            case TensorOpMax: result->float_value = a > b ? a : b; break;
+            case TensorOpNeg: result->float_value = -a; break;
+            case TensorOpAbs: result->float_value = a < 0 ? -a : a; break;
+            default: return false;
+        }
+        if(kernel->type == AdoradTypeTensorFloat32)
+            result->float_value = cast(float)result->float_value;
+        return true;
+    }
+    // Integers wrap around (as vectors of them do)
+    UInt64 a = cast(UInt64)lhs->int_value;
+    UInt64 b = SOME(rhs) ? cast(UInt64)rhs->int_value : 0;
+    switch(op) {
+        case TensorOpAdd: result->int_value = tensor_wrap(kernel, a + b); break;
+        case TensorOpSub: result->int_value = tensor_wrap(kernel, a - b); break;
+        case TensorOpMul: result->int_value = tensor_wrap(kernel, a * b); break;
+        case TensorOpDiv:
+            if(rhs->int_value == 0 || (rhs->int_value == -1 && lhs->int_value == Int64_MIN))
+                return false;
+            result->int_value = tensor_wrap(kernel, cast(UInt64)(lhs->int_value / rhs->int_value));
+            break;
+        case TensorOpMin: result->int_value = lhs->int_value < rhs->int_value ? lhs->int_value : rhs->int_value; break;
+        case TensorOpMax: result->int_value = lhs->int_value > rhs->int_value ? lhs->int_value : rhs->int_value; break;
+        case TensorOpNeg: result->int_value = tensor_wrap(kernel, 0 - a); break;
+        case TensorOpAbs: result->int_value = tensor_wrap(kernel, lhs->int_value < 0 ? 0 - a : a); break;
+        default: return false;
+    }
+    return true;
+}
+
+TensorNodeId tensor_binary(TensorKernel* kernel, TensorOp op, TensorNodeId lhs, TensorNodeId rhs) {
+    CORETEN_ENFORCE(op >= TensorOpAdd && op <= TensorOpMax, "Not a binary operator");
+    CORETEN_ENFORCE(lhs < vec_size(kernel->nodes) && rhs < vec_size(kernel->nodes), "No such node");
+    TensorNode* a = vec_at_TensorNode(kernel->nodes, lhs);
+    TensorNode* b = vec_at_TensorNode(kernel->nodes, rhs);
+    TensorNode node;
+    if(a->op == TensorOpConst && b->op == TensorOpConst && tensor_fold(kernel, op, a, b, &node))
+        return tensor_intern(kernel, &node);
+    // Commutative operators are made with their operands in order, so `a + b` and `b + a` are the same node
+    if((op == TensorOpAdd || op == TensorOpMul || (op == TensorOpMin && !tensor_is_float(kernel)) ||
+        (op == TensorOpMax && !tensor_is_float(kernel))) && lhs > rhs) {
+        TensorNodeId id = lhs;
+        lhs = rhs;
+        rhs = id;
+    }
+    node = (TensorNode){ op, lhs, rhs, 0, 0, 0 };
+    return tensor_intern(kernel, &node);
+}
+
+TensorNodeId tensor_unary(TensorKernel* kernel, TensorOp op, TensorNodeId operand) {
+    CORETEN_ENFORCE(op == TensorOpNeg || op == TensorOpAbs, "Not a unary operator");
+    CORETEN_ENFORCE(operand < vec_size(kernel->nodes), "No such node");
+    TensorNode* a = vec_at_TensorNode(kernel->nodes, operand);
+    TensorNode node;
+    if(a->op == TensorOpConst && tensor_fold(kernel, op, a, null, &node))
+        return tensor_intern(kernel, &node);
+    node = (TensorNode){ op, operand, 0, 0, 0, 0 };
+    return tensor_intern(kernel, &node);
+}
+
+TensorIsa tensor_isa_of_arch(OutputArch arch) {
+    if(arch == OutputArchAuto) {
+    #if defined(CORETEN_ARCH_X86)
+        arch = OutputArchAmd64;
+    #elif defined(CORETEN_ARCH_ARM64) || defined(CORETEN_ARCH_ARM)
+        arch = OutputArchArm64;
+    #endif
+    }
+    switch(arch) {
+        case OutputArchAmd64:
+        case OutputArchI386: return TensorIsaSse2;
+        case OutputArchArm64:
+        case OutputArchArm32: return TensorIsaNeon;
+        default: return TensorIsaScalar;
+    }
+}
+
+UInt32 tensor_isa_width(TensorIsa isa) {
+    switch(isa) {
+        case TensorIsaSse2: return 16;
+        case TensorIsaAvx2: return 32;
+        case TensorIsaAvx512: return 64;
+        case TensorIsaNeon: return 16;
+        default: return 0;
+    }
+}
+
+const char* tensor_isa_str(TensorIsa isa) {
+    switch(isa) {
+        case TensorIsaScalar: return "scalar";
+        case TensorIsaSse2: return "sse2";
+        case TensorIsaAvx2: return "avx2";
+        case TensorIsaAvx512: return "avx512";
+        case TensorIsaNeon: return "neon";
+        default: return "unknown";
+    }
+}
+
+// Emission
+// Names of the vector types of `width` bytes: of the elements, and of the masks comparing them makes
+static void tensor_vector_names(TensorKernel* kernel, UInt32 width, char* vtype, char* mtype) {
+    UInt32 size = tensor_elem_size(kernel->type);
+    const char* elem = tensor_is_float(kernel) ? "f" : "i";
+    snprintf(vtype, 32, "adorad_%s%ux%u", elem, size * 8, width / size);
+    snprintf(mtype, 32, "adorad_i%ux%u", size * 8, width / size);
+}
+
+// Define the vector types of `width` bytes (once per translation unit)
+static void tensor_emit_vector_types(CWriter* writer, TensorKernel* kernel, UInt32 width) {
+    char vtype[32], mtype[32];
+    tensor_vector_names(kernel, width, vtype, mtype);
+    static const char* mask_ctypes[] = { null, null, "int16_t", null, "int32_t", null, null, null, "int64_t" };
+    const char* types[2] = { vtype, mtype };
+    const char* ctypes[2] = { tensor_elem_ctype(kernel->type), mask_ctypes[tensor_elem_size(kernel->type)] };
+    for(UInt32 i = 0; i < (strcmp(vtype, mtype) == 0 ? 1u : 2u); i++) {
+        cwriter_printf(writer, "#ifndef %s_DEFINED\n#define %s_DEFINED\n", types[i], types[i]);
+        cwriter_printf(writer, "typedef %s %s __attribute__((vector_size(%u)));\n#endif\n", ctypes[i], types[i], width);
+    }
+}
+
+// Write `(T* restrict out, const T* restrict in0, ..., size_t n)`
+static void tensor_emit_params(CWriter* writer, TensorKernel* kernel) {
+    const char* ctype = tensor_elem_ctype(kernel->type);
+    cwriter_printf(writer, "(%s* restrict out", ctype);
+    for(UInt32 i = 0; i < kernel->num_inputs; i++)
+        cwriter_printf(writer, ", const %s* restrict in%u", ctype, i);
+    cwriter_str(writer, ", size_t n)");
+}
+
+// Write constant `node` as a C expression
+static void tensor_emit_const(CWriter* writer, TensorKernel* kernel, TensorNode* node) {
+    const char* ctype = tensor_elem_ctype(kernel->type);
+    if(!tensor_is_float(kernel)) {
+        if(node->int_value == Int64_MIN)
+            cwriter_str(writer, "((int64_t)(-9223372036854775807LL - 1))");
+        else
+            cwriter_printf(writer, "((%s)%lldLL)", ctype, cast(long long)node->int_value);
+    } else if(isnan(node->float_value)) {
+        cwriter_printf(writer, "((%s)(0.0 / 0.0))", ctype);
+    } else if(isinf(node->float_value)) {
+        cwriter_printf(writer, "((%s)(%s1.0 / 0.0))", ctype, node->float_value < 0 ? "-" : "");
+    } else {
+        // Hex floats are exact
+        cwriter_printf(writer, "((%s)%a)", ctype, node->float_value);
+    }
+}
+
+// Marks the nodes the output is computed from (in `is_live`)
+static void tensor_mark_live(TensorKernel* kernel, bool* is_live) {
+    is_live[kernel->output] = true;
+    for(UInt64 i = vec_size(kernel->nodes); i-- > 0;) {
+        TensorNode* node = vec_at_TensorNode(kernel->nodes, i);
+        if(!is_live[i] || node->op == TensorOpInput || node->op == TensorOpConst)
+            continue;
+        is_live[node->lhs] = true;
+        if(node->op != TensorOpNeg && node->op != TensorOpAbs)
+            is_live[node->rhs] = true;
+    }
+}
+
+// Write node `id` as local `t<id>` of a loop body (a vector of `vtype` and `mtype` masks, or a scalar if `vtype` is
+// null)
+static void tensor_emit_node(CWriter* writer, TensorKernel* kernel, TensorNodeId id, const char* vtype,
+                             const char* mtype) {
+    TensorNode* node = vec_at_TensorNode(kernel->nodes, id);
+    const char* type = SOME(vtype) ? vtype : tensor_elem_ctype(kernel->type);
+    static const char* ops[TensorOpCount] = { null, null, "+", "-", "*", "/", "<", ">", null, null };
+    cwriter_indent(writer);
+    switch(node->op) {
+        case TensorOpInput:
+            if(NONE(vtype)) {
+                cwriter_printf(writer, "%s t%u = in%u[i];\n", type, id, node->input);
+                return;
+            }
+            // The tensors needn't be aligned to vectors
+            cwriter_printf(writer, "%s t%u;\n", type, id);
+            cwriter_indent(writer);
+            cwriter_printf(writer, "__builtin_memcpy(&t%u, in%u + i, sizeof(t%u));\n", id, node->input, id);
+            return;
+        case TensorOpConst:
+            // Broadcast into every lane
+            cwriter_printf(writer, "%s t%u = ", type, id);
+            if(SOME(vtype))
+                cwriter_printf(writer, "(%s){0} + ", vtype);
+            tensor_emit_const(writer, kernel, node);
+            cwriter_str(writer, ";\n");
+            return;
+        case TensorOpAdd:
+        case TensorOpSub:
+        case TensorOpMul:
+        case TensorOpDiv:
+            cwriter_printf(writer, "%s t%u = t%u %s t%u;\n", type, id, node->lhs, ops[node->op], node->rhs);
+            return;
+        case TensorOpNeg:
+            cwriter_printf(writer, "%s t%u = -t%u;\n", type, id, node->lhs);
+            return;
+        case TensorOpMin:
+        case TensorOpMax:
+        case TensorOpAbs: {
+            // `cond ? a : b`, where `a` is `t<lhs>` (`-t<lhs>` for abs) and `b` is `t<rhs>` (`t<lhs>` for abs)
+            char cond[64], a[32], b[32];
+            if(node->op == TensorOpAbs) {
+                if(SOME(vtype))
+                    snprintf(cond, sizeof(cond), "t%u < (%s){0}", node->lhs, vtype);
+                else
+                    snprintf(cond, sizeof(cond), "t%u < 0", node->lhs);
+                snprintf(a, sizeof(a), "-t%u", node->lhs);
+                snprintf(b, sizeof(b), "t%u", node->lhs);
+            } else {
+                snprintf(cond, sizeof(cond), "t%u %s t%u", node->lhs, ops[node->op], node->rhs);
+                snprintf(a, sizeof(a), "t%u", node->lhs);
+                snprintf(b, sizeof(b), "t%u", node->rhs);
+            }
+            if(NONE(vtype)) {
+                cwriter_printf(writer, "%s t%u = %s ? %s : %s;\n", type, id, cond, a, b);
+                return;
+            }
+            // C has no `?:` of vectors: select the bits with the mask the comparison makes (all ones where true)
+            cwriter_printf(writer, "%s m%u = %s;\n", mtype, id, cond);
+            cwriter_indent(writer);
+            cwriter_printf(writer, "%s t%u = (%s)(((%s)(%s) & m%u) | ((%s)(%s) & ~m%u));\n", type, id, vtype, mtype,
+                           a, id, mtype, b, id);
+            return;
+        }
+        default:
+            CORETEN_ENFORCE(false, "Unknown tensor operator");
+    }
+}
+
+// Write the body of a loop over the elements (vectors of `vtype` or scalars, see `tensor_emit_node()`)
+static void tensor_emit_loop_body(CWriter* writer, TensorKernel* kernel, const bool* is_live, const char* vtype,
+                                  const char* mtype) {
+    writer->indent++;
+    for(UInt64 i = 0; i < vec_size(kernel->nodes); i++) {
+        if(is_live[i])
+            tensor_emit_node(writer, kernel, cast(TensorNodeId)i, vtype, mtype);
+    }
+    cwriter_indent(writer);
+    if(SOME(vtype))
+        cwriter_printf(writer, "__builtin_memcpy(out + i, &t%u, sizeof(t%u));\n", kernel->output, kernel->output);
+    else
+        cwriter_printf(writer, "out[i] = t%u;\n", kernel->output);
+    writer->indent--;
+}
+
+// Write a definition of the kernel called `name`, its main loop over vectors of `width` bytes (if not 0), and the
+// one over the elements left over after it. `prefix` goes before the definition
+static void tensor_emit_func(CWriter* writer, TensorKernel* kernel, const bool* is_live, const char* name,
+                             const char* prefix, UInt32 width) {
+    cwriter_printf(writer, "%s%s", prefix, name);
+    tensor_emit_params(writer, kernel);
+    cwriter_str(writer, " {\n");
+    writer->indent++;
+    cwriter_indent(writer);
+    cwriter_str(writer, "size_t i = 0;\n");
+    if(width > 0) {
+        char vtype[32], mtype[32];
+        tensor_vector_names(kernel, width, vtype, mtype);
+        UInt32 lanes = width / tensor_elem_size(kernel->type);
+        cwriter_indent(writer);
+        cwriter_printf(writer, "for(; i + %u <= n; i += %u) {\n", lanes, lanes);
+        tensor_emit_loop_body(writer, kernel, is_live, vtype, mtype);
+        cwriter_indent(writer);
+        cwriter_str(writer, "}\n");
+    }
+    cwriter_indent(writer);
+    cwriter_str(writer, "for(; i < n; i++) {\n");
+    tensor_emit_loop_body(writer, kernel, is_live, null, null);
+    cwriter_indent(writer);
+    cwriter_str(writer, "}\n");
+    writer->indent--;
+    cwriter_str(writer, "}\n");
+}
+
+// The versions of a dispatched kernel (widest first), what the CPU needs for each, and what they're compiled for
+static const TensorIsa tensor_dispatch_isas[] = { TensorIsaAvx512, TensorIsaAvx2, TensorIsaSse2 };
+static const char* tensor_dispatch_checks[] = {
+    "__builtin_cpu_supports(\"avx512f\") && __builtin_cpu_supports(\"avx512bw\")",
+    "__builtin_cpu_supports(\"avx2\")",
+    null
+};
+static const char* tensor_dispatch_targets[] = { "avx512f,avx512bw", "avx2", "sse2" };
+
+static void tensor_emit_dispatch(CWriter* writer, TensorKernel* kernel, const bool* is_live) {
+    const char* name = kernel->name;
+    char clone[256], prefix[64];
+    for(UInt32 i = 0; i < 3; i++)
+        tensor_emit_vector_types(writer, kernel, tensor_isa_width(tensor_dispatch_isas[i]));
+    for(UInt32 i = 0; i < 3; i++) {
+        snprintf(clone, sizeof(clone), "%s__%s", name, tensor_isa_str(tensor_dispatch_isas[i]));
+        snprintf(prefix, sizeof(prefix), "__attribute__((target(\"%s\"))) static void ", tensor_dispatch_targets[i]);
+        tensor_emit_func(writer, kernel, is_live, clone, prefix, tensor_isa_width(tensor_dispatch_isas[i]));
+    }
+    cwriter_printf(writer, "typedef void (*%s__func)", name);
+    tensor_emit_params(writer, kernel);
+    cwriter_printf(writer, ";\nstatic %s__func %s__impl;\nvoid %s", name, name, name);
+    tensor_emit_params(writer, kernel);
+    cwriter_str(writer, " {\n");
+    writer->indent++;
+    // Threads racing on the first call all pick the same version
+    cwriter_indent(writer);
+    cwriter_printf(writer, "%s__func impl = __atomic_load_n(&%s__impl, __ATOMIC_RELAXED);\n", name, name);
+    cwriter_indent(writer);
+    cwriter_str(writer, "if(!impl) {\n");
+    writer->indent++;
+    cwriter_indent(writer);
+    cwriter_str(writer, "__builtin_cpu_init();\n");
+    cwriter_indent(writer);
+    cwriter_str(writer, "impl = ");
+    for(UInt32 i = 0; i < 3; i++) {
+        if(SOME(tensor_dispatch_checks[i]))
+            cwriter_printf(writer, "%s ? %s__%s : ", tensor_dispatch_checks[i], name,
+                           tensor_isa_str(tensor_dispatch_isas[i]));
+        else
+            cwriter_printf(writer, "%s__%s;\n", name, tensor_isa_str(tensor_dispatch_isas[i]));
+    }
+    cwriter_indent(writer);
+    cwriter_printf(writer, "__atomic_store_n(&%s__impl, impl, __ATOMIC_RELAXED);\n", name);
+    writer->indent--;
+    cwriter_indent(writer);
+    cwriter_str(writer, "}\n");
+    cwriter_indent(writer);
+    cwriter_str(writer, "impl(out");
+    for(UInt32 i = 0; i < kernel->num_inputs; i++)
+        cwriter_printf(writer, ", in%u", i);
+    cwriter_str(writer, ", n);\n");
+    writer->indent--;
+    cwriter_str(writer, "}\n");
+}
+
+void tensor_emit(CWriter* writer, void* arg) {
+    TensorKernel* kernel = cast(TensorKernel*)arg;
+    UInt64 num_nodes = vec_size(kernel->nodes);
+    CORETEN_ENFORCE(kernel->output < num_nodes, "The kernel has no output");
+    bool* is_live = cast(bool*)calloc(num_nodes, sizeof(bool));
+    CORETEN_ENFORCE_NN(is_live, "Could not allocate memory. Memory full.");
+    tensor_mark_live(kernel, is_live);
+    UInt32 num_ops = 0;
+    for(UInt64 i = 0; i < num_nodes; i++) {
+        TensorOp op = vec_at_TensorNode(kernel->nodes, i)->op;
+        num_ops += is_live[i] && op != TensorOpInput && op != TensorOpConst;
+    }
+    cwriter_printf(writer, "// Tensor kernel `%s`: %u operation(s) over %u input(s), fused\n", kernel->name, num_ops,
+                   kernel->num_inputs);
+
+    UInt32 width = tensor_isa_width(kernel->isa);
+    if(kernel->dispatch)
+        cwriter_str(writer, "#if " TENSOR_VECTOR_GUARD " && " TENSOR_X86_GUARD "\n");
+    else if(width > 0)
+        cwriter_str(writer, "#if " TENSOR_VECTOR_GUARD "\n");
+    if(kernel->dispatch) {
+        tensor_emit_dispatch(writer, kernel, is_live);
+    } else if(width > 0) {
+        tensor_emit_vector_types(writer, kernel, width);
+        tensor_emit_func(writer, kernel, is_live, kernel->name, "void ", width);
+    }
+    if(kernel->dispatch || width > 0)
+        cwriter_str(writer, "#else\n");
+    // No vectors (or no vector extensions)
+    tensor_emit_func(writer, kernel, is_live, kernel->name, "void ", 0);
+    if(kernel->dispatch || width > 0)
+        cwriter_str(writer, "#endif\n");
+    free(is_live);
+}
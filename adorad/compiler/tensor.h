@@ -0,0 +1,114 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#ifndef ADORAD_TENSOR_H
+#define ADORAD_TENSOR_H
+
+#include <adorad/core/types.h>
+#include <adorad/core/vector.h>
+#include <adorad/compiler/cgen.h>
+#include <adorad/compiler/compiler.h>
+#include <adorad/compiler/types.h>
+
+/*
+    Tensor kernels
+    An elementwise tensor expression (eg. `out = a * b + 2.0 * a`, over `AdoradTypeTensorFloat32`s) is lowered into a
+    `TensorKernel`: a DAG of elementwise operations over the inputs of the kernel. Nodes are made once (asking for
+    `a * b` again returns the same node), and operations over constants are folded as they're made.
+
+    A kernel is emitted (by `tensor_emit()`, a `CGenEmitFunc` - so kernels are units of the C backend, see
+    <adorad/compiler/cgen.h>) as a single fused loop over the elements: every node is a local of the loop body, so
+    there's no temporary tensor per operator, and every input is read (and the output written) once per element.
+
+    The loop is vectorized with the vector extensions of GCC and Clang (`__attribute__((vector_size(N)))`), `N` being
+    the width of the kernel's ISA (see `tensor_isa_of_arch()`), and a scalar loop does the rest of the elements (or all
+    of them, with compilers that have no vector extensions: MSVC and tcc).
+
+    With `TensorKernel.dispatch` (x86 only), the kernel is emitted once per ISA (SSE2, AVX2 and AVX-512), each
+    compiled for its ISA (`__attribute__((target(...)))`), and its entry point calls the widest one the CPU supports
+    (found on the first call). Binaries then run anywhere, at the speed of the CPU they run on.
+
+    The emitted kernel is `void <name>(T* restrict out, const T* restrict in0, ..., size_t n)`. Integer operations
+    are C's (so dividing by 0 is undefined).
+*/
+
+typedef enum TensorOp {
+    TensorOpInput,
+    TensorOpConst,
+    TensorOpAdd,
+    TensorOpSub,
+    TensorOpMul,
+    TensorOpDiv,
+    TensorOpMin,
+    TensorOpMax,
+    TensorOpNeg,
+    TensorOpAbs,
+    TensorOpCount
+} TensorOp;
+
+// Index of a node of a kernel
+typedef UInt32 TensorNodeId;
+
+typedef struct TensorNode {
+    TensorOp op;
+    TensorNodeId lhs;       // the operand of unary operators
+    TensorNodeId rhs;
+    UInt32 input;           // inputs: which one
+    Int64 int_value;        // constants (of integer tensors)
+    Float64 float_value;    // constants (of float tensors)
+} TensorNode;
+
+VEC_DEFINE(TensorNode)
+
+typedef enum TensorIsa {
+    TensorIsaScalar,
+    TensorIsaSse2,
+    TensorIsaAvx2,
+    TensorIsaAvx512,
+    TensorIsaNeon,
+    TensorIsaCount
+} TensorIsa;
+
+typedef struct TensorKernel {
+    const char* name;
+    AdoradTypes type;       // `AdoradTypeTensorInt16` .. `AdoradTypeTensorFloat64`
+    UInt32 num_inputs;
+    Vec* nodes;             // `TensorNode`s, operands before the nodes that use them
+    TensorNodeId output;
+    TensorIsa isa;          // of the vector loop (unless `dispatch`)
+    bool dispatch;          // emit a version per x86 ISA, and pick one at runtime
+} TensorKernel;
+
+// A kernel `name` over tensors of `type`, with `num_inputs` inputs, for `arch` (see `tensor_isa_of_arch()`)
+TensorKernel* tensor_kernel_new(const char* name, AdoradTypes type, UInt32 num_inputs, OutputArch arch);
+void tensor_kernel_free(TensorKernel* kernel);
+// The `index`th input
+TensorNodeId tensor_input(TensorKernel* kernel, UInt32 index);
+// A constant (of a float tensor)
+TensorNodeId tensor_const(TensorKernel* kernel, Float64 value);
+// A constant (of an integer tensor)
+TensorNodeId tensor_const_int(TensorKernel* kernel, Int64 value);
+TensorNodeId tensor_binary(TensorKernel* kernel, TensorOp op, TensorNodeId lhs, TensorNodeId rhs);
+TensorNodeId tensor_unary(TensorKernel* kernel, TensorOp op, TensorNodeId operand);
+TensorNode* tensor_node(TensorKernel* kernel, TensorNodeId id);
+
+// The ISA a kernel is vectorized for on `arch`: the baseline of the architecture (SSE2 on amd64 and i386, NEON on
+// arm64 and arm32), or scalar code if it has no vectors we know about
+TensorIsa tensor_isa_of_arch(OutputArch arch);
+// Width of a vector register of `isa` in bytes (0 for scalars)
+UInt32 tensor_isa_width(TensorIsa isa);
+const char* tensor_isa_str(TensorIsa isa);
+// Emit the kernel `arg` (a `TensorKernel*`) - see above
+void tensor_emit(CWriter* writer, void* arg);
+
+#endif // ADORAD_TENSOR_H
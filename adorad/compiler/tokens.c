@@ -12,6 +12,7 @@ Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
 */
 
 #include <stdlib.h>
+#include <adorad/core/debug.h>
 #include <adorad/compiler/tokens.h>
 
 const char* tokenHash[TOK_COUNT + 1] = {
@@ -25,8 +26,8 @@ Token* token_init() {
     Token* token = cast(Token*)calloc(1, sizeof(Token));
     token->kind = TOK_ILLEGAL;
     token->offset = 0;
-    token->value = BUFF_NEW(null);
-    token->loc = loc_new(null);
+    token->len = 0;
+    token->symbol = SYMBOL_NULL;
 
     return token;
 }
@@ -35,8 +36,8 @@ Token* token_init() {
 void token_reset_token(Token* token) {
     token->kind = TOK_ILLEGAL; 
     token->offset = 0; 
-    buff_set(token->value, "");
-    loc_reset(token->loc);
+    token->len = 0;
+    token->symbol = SYMBOL_NULL;
 }
 
 // Convert a Token to its respective string representation
@@ -48,4 +49,113 @@ Buff* token_to_buff(TokenKind kind) {
 // Is `kind` an attribute?
 bool token_is_attribute(TokenKind kind) {
     return kind > TOK___ATTRIBUTES_BEGIN && kind < TOK___ATTRIBUTES_END;
-}
\ No newline at end of file
+}
+// Create a new TokenArena with space for `cap` tokens
+TokenArena* token_arena_new(UInt64 cap) {
+    CORETEN_ENFORCE(cap > 0, "Really? `cap` can only be > 0");
+
+    TokenArena* arena = cast(TokenArena*)calloc(1, sizeof(TokenArena));
+    CORETEN_ENFORCE_NN(arena, "Could not allocate memory. Memory full.");
+
+    arena->data = cast(CompactToken*)malloc(cap * sizeof(CompactToken));
+    CORETEN_ENFORCE_NN(arena->data, "Could not allocate memory. Memory full.");
+    arena->len = 0;
+    arena->cap = cap;
+
+    return arena;
+}
+
+// Grow the arena so that it can hold at least `cap` tokens (but at least by a factor of 2)
+void token_arena_grow(TokenArena* arena, UInt64 cap) {
+    CORETEN_ENFORCE_NN(arena, "Expected not null");
+    if(cap <= arena->cap)
+        return;
+
+    UInt64 newcap = arena->cap * 2;
+    if(newcap < cap)
+        newcap = cap;
+
+    CompactToken* newdata = cast(CompactToken*)realloc(arena->data, newcap * sizeof(CompactToken));
+    CORETEN_ENFORCE_NN(newdata, "Could not allocate memory. Memory full.");
+
+    arena->data = newdata;
+    arena->cap = newcap;
+}
+
+// Free the arena (and every token in it)
+void token_arena_free(TokenArena* arena) {
+    if(SOME(arena)) {
+        free(arena->data);
+        free(arena);
+    }
+}
+
+TokenKinds* token_kinds_new(UInt64 cap) {
+    CORETEN_ENFORCE(cap > 0, "Really? `cap` can only be > 0");
+
+    TokenKinds* kinds = cast(TokenKinds*)calloc(1, sizeof(TokenKinds));
+    CORETEN_ENFORCE_NN(kinds, "Could not allocate memory. Memory full.");
+    kinds->kinds = cast(UInt8*)malloc(cap * sizeof(UInt8));
+    kinds->offsets = cast(UInt32*)malloc(cap * sizeof(UInt32));
+    kinds->lens = cast(UInt32*)malloc(cap * sizeof(UInt32));
+    CORETEN_ENFORCE(SOME(kinds->kinds) && SOME(kinds->offsets) && SOME(kinds->lens), 
+                    "Could not allocate memory. Memory full.");
+    kinds->len = 0;
+    kinds->cap = cap;
+
+    return kinds;
+}
+
+// Grow `kinds` so that it can hold at least `cap` tokens (but at least by a factor of 2)
+void token_kinds_grow(TokenKinds* kinds, UInt64 cap) {
+    CORETEN_ENFORCE_NN(kinds, "Expected not null");
+    if(cap <= kinds->cap)
+        return;
+
+    UInt64 newcap = kinds->cap * 2;
+    if(newcap < cap)
+        newcap = cap;
+
+    UInt8* newkinds = cast(UInt8*)realloc(kinds->kinds, newcap * sizeof(UInt8));
+    CORETEN_ENFORCE_NN(newkinds, "Could not allocate memory. Memory full.");
+    kinds->kinds = newkinds;
+    UInt32* newoffsets = cast(UInt32*)realloc(kinds->offsets, newcap * sizeof(UInt32));
+    CORETEN_ENFORCE_NN(newoffsets, "Could not allocate memory. Memory full.");
+    kinds->offsets = newoffsets;
+    UInt32* newlens = cast(UInt32*)realloc(kinds->lens, newcap * sizeof(UInt32));
+    CORETEN_ENFORCE_NN(newlens, "Could not allocate memory. Memory full.");
+    kinds->lens = newlens;
+    kinds->cap = newcap;
+}
+
+void token_kinds_free(TokenKinds* kinds) {
+    if(SOME(kinds)) {
+        free(kinds->kinds);
+        free(kinds->offsets);
+        free(kinds->lens);
+        free(kinds);
+    }
+}
+
+UInt64 token_kinds_find(TokenKinds* kinds, UInt32 offset) {
+    // Tokens don't overlap, so their ends are sorted as well
+    UInt64 lo = 0;
+    UInt64 hi = kinds->len;
+    while(lo < hi) {
+        UInt64 mid = lo + (hi - lo) / 2;
+        if(cast(UInt64)kinds->offsets[mid] + kinds->lens[mid] < offset)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+UInt32 token_kinds_rewind(TokenKinds* kinds, UInt32 offset) {
+    UInt64 index = token_kinds_find(kinds, offset);
+    // A token that ends at `offset` is made again too: what follows may be part of it (eg. after an edit)
+    if(index < kinds->len && kinds->offsets[index] < offset)
+        offset = kinds->offsets[index];
+    kinds->len = index;
+    return offset;
+}
@@ -17,6 +17,7 @@ Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
 #include <adorad/core/misc.h>
 #include <adorad/core/types.h> 
 #include <adorad/compiler/location.h>
+#include <adorad/compiler/intern.h>
 
 /*
     `tokens.h` defines constants representing the lexical tokens of the Adorad programming language and basic operations
@@ -203,14 +204,56 @@ typedef enum TokenKind {
 
 extern const char* tokenHash[TOK_COUNT + 1];
 
+// Set on string literals with at least one escape sequence. Their value is only unescaped when asked for (see
+// `lexer_string_value()`): those without are used as they're spelled
+#define TOKEN_FLAG_HAS_ESCAPES      0x01
+
 // Main Token Struct 
+// Like a `CompactToken`, a Token owns no memory - its value is read through a `BuffView` into the Lexical buffer (see
+// `lexer_value()`), which is what `offset` and `len` are into.
 typedef struct Token {
     TokenKind kind;     // Token Kind
     UInt32 offset;      // Offset of the first character of the Token
-    Buff* value;        // Token value
-    Loc* loc;      // Location of the token in the source code
+    UInt32 len;         // Length of the Token (in bytes)
+    SymbolId symbol;    // interned value of identifiers and strings (SYMBOL_NULL if the Lexer has no Interner - see
+                        // `lexer_set_interner()`)
+    UInt8 flags;        // see `TOKEN_FLAG_HAS_ESCAPES`
+    // NB: Tokens don't store their line/column. These are resolved from `offset` when needed (see `lexer_loc()`)
 } Token;
 
+// Compact Token
+// A plain-old-data alternative to `Token` used by the Lexer's compact mode. It owns no memory - the token value
+// is read through a `BuffView` into the source buffer (see `lexer_token_value()`).
+typedef struct CompactToken {
+    UInt32 offset;      // Offset of the first character of the Token
+    UInt32 len;         // Length of the Token (in bytes)
+    UInt16 fileid;      // Id of the source file the Token belongs to
+    UInt8 kind;         // Token Kind (a `TokenKind`)
+    UInt8 flags;        // see `TOKEN_FLAG_HAS_ESCAPES`
+} CompactToken;
+
+CORETEN_STATIC_ASSERT(TOK_COUNT <= UInt8_MAX);
+CORETEN_STATIC_ASSERT(sizeof(CompactToken) == 12);
+
+// A contiguous block of `CompactToken`s.
+// This is grown geometrically, so pushing a token is (amortized) a single store.
+typedef struct TokenArena {
+    CompactToken* data;
+    UInt64 len;         // number of tokens in the arena
+    UInt64 cap;         // allocated capacity (no. of tokens)
+} TokenArena;
+
+// Token kinds
+// What `lexer_lex_kinds()` makes: the kind and the span of each token (and of each comment), as parallel arrays -
+// all that highlighting, bracket matching and formatting need. Tokens are in source order.
+typedef struct TokenKinds {
+    UInt8* kinds;       // `TokenKind`s
+    UInt32* offsets;    // of the first character of each token
+    UInt32* lens;       // in bytes
+    UInt64 len;         // number of tokens
+    UInt64 cap;         // allocated capacity (no. of tokens)
+} TokenKinds;
+
 // Create a basic (ILLEGAL) token
 Token* token_init();
 // Reset a Token instance
@@ -220,4 +263,23 @@ Buff* token_to_buff(TokenKind kind);
 // Is an attribute?
 bool token_is_attribute(TokenKind kind);
 
+// Create a new TokenArena with space for `cap` tokens
+TokenArena* token_arena_new(UInt64 cap);
+// Grow the arena so that it can hold at least `cap` tokens
+void token_arena_grow(TokenArena* arena, UInt64 cap);
+// Free the arena (and every token in it)
+void token_arena_free(TokenArena* arena);
+
+// Create a new (empty) TokenKinds with space for `cap` tokens
+TokenKinds* token_kinds_new(UInt64 cap);
+// Grow `kinds` so that it can hold at least `cap` tokens
+void token_kinds_grow(TokenKinds* kinds, UInt64 cap);
+void token_kinds_free(TokenKinds* kinds);
+// Returns the index of the first token that ends at or past `offset` (or `kinds->len` if there's none)
+UInt64 token_kinds_find(TokenKinds* kinds, UInt32 offset);
+// Drop the tokens from the one that ends at or past `offset` on (eg. those of an edited, or newly visible, part of the
+// source), and return where to lex from (see `lexer_lex_kinds()`) to make them again: the beginning of that token if
+// it spans `offset` (a comment or a string, say), or `offset` itself
+UInt32 token_kinds_rewind(TokenKinds* kinds, UInt32 offset);
+
 #endif // ADORAD_TOKEN_H
\ No newline at end of file
@@ -0,0 +1,194 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <adorad/core/debug.h>
+#include <adorad/core/thread.h>
+#include <adorad/compiler/trace.h>
+
+atomic_bool traceEnabled = false;
+
+// The buffers of the threads that recorded zones (a lock-free stack: threads push theirs on their first zone)
+static _Atomic(TraceBuffer*) trace_buffers = null;
+static atomic_uint trace_next_tid = 0;
+// Of the current trace (0 before the first one). A thread's buffer is only its own for the session it was made in
+static atomic_uint trace_session = 0;
+static UInt64 trace_events_per_thread = TRACE_DEFAULT_EVENTS;
+static UInt64 trace_epoch = 0;
+
+static CORETEN_THREAD_LOCAL TraceBuffer* trace_thread_buffer = null;
+static CORETEN_THREAD_LOCAL UInt32 trace_thread_session = 0;
+
+void trace_start(UInt64 events_per_thread) {
+    trace_free();
+    UInt64 num_events = 1;
+    while(num_events < (events_per_thread > 0 ? events_per_thread : TRACE_DEFAULT_EVENTS))
+        num_events <<= 1;
+    trace_events_per_thread = num_events;
+    trace_epoch = stats_now();
+    atomic_fetch_add(&trace_session, 1);
+    atomic_store(&traceEnabled, true);
+    trace_thread_name("main");
+}
+
+void trace_stop() {
+    atomic_store(&traceEnabled, false);
+}
+
+void trace_free() {
+    trace_stop();
+    TraceBuffer* buffer = atomic_exchange(&trace_buffers, null);
+    while(SOME(buffer)) {
+        TraceBuffer* next = buffer->next;
+        free(buffer->events);
+        free(buffer);
+        buffer = next;
+    }
+    atomic_store(&trace_next_tid, 0);
+}
+
+// The buffer of the calling thread, in the current session (made on its first zone)
+static TraceBuffer* trace_buffer() {
+    UInt32 session = atomic_load_explicit(&trace_session, memory_order_relaxed);
+    if(CORETEN_LIKELY(trace_thread_session == session))
+        return trace_thread_buffer;
+
+    TraceBuffer* buffer = cast(TraceBuffer*)calloc(1, sizeof(TraceBuffer));
+    CORETEN_ENFORCE_NN(buffer, "Could not allocate memory. Memory full.");
+    buffer->events = cast(TraceEvent*)malloc(trace_events_per_thread * sizeof(TraceEvent));
+    CORETEN_ENFORCE_NN(buffer->events, "Could not allocate memory. Memory full.");
+    buffer->mask = trace_events_per_thread - 1;
+    atomic_init(&buffer->head, 0);
+    buffer->tid = atomic_fetch_add(&trace_next_tid, 1) + 1;
+    buffer->next = atomic_load_explicit(&trace_buffers, memory_order_relaxed);
+    while(!atomic_compare_exchange_weak_explicit(&trace_buffers, &buffer->next, buffer, memory_order_release,
+                                                 memory_order_relaxed))
+        ;
+    trace_thread_buffer = buffer;
+    trace_thread_session = session;
+    return buffer;
+}
+
+void trace_thread_name(const char* name) {
+    if(!atomic_load_explicit(&traceEnabled, memory_order_relaxed))
+        return;
+    TraceBuffer* buffer = trace_buffer();
+    snprintf(buffer->thread_name, sizeof(buffer->thread_name), "%s", name);
+}
+
+void trace_zone_end(const char* name, const char* detail, UInt64 begin) {
+    UInt64 end = stats_now();
+    if(!atomic_load_explicit(&traceEnabled, memory_order_relaxed))
+        return;
+    // Only this thread writes to its buffer: the slot is filled in, then published
+    TraceBuffer* buffer = trace_buffer();
+    UInt64 head = atomic_load_explicit(&buffer->head, memory_order_relaxed);
+    TraceEvent* event = &buffer->events[head & buffer->mask];
+    event->name = name;
+    event->begin = begin;
+    event->end = end;
+    UInt64 len = SOME(detail) ? strlen(detail) : 0;
+    if(len >= TRACE_MAX_DETAIL) {
+        detail += len - (TRACE_MAX_DETAIL - 1);
+        len = TRACE_MAX_DETAIL - 1;
+        // Not from the middle of a UTF-8 sequence
+        while(len > 0 && (cast(unsigned char)*detail & 0xc0) == 0x80) {
+            detail++;
+            len--;
+        }
+    }
+    if(len > 0)
+        memcpy(event->detail, detail, len);
+    event->detail[len] = nullchar;
+    atomic_store_explicit(&buffer->head, head + 1, memory_order_release);
+}
+
+// No. of events of `buffer` that are kept
+static UInt64 trace_buffer_len(TraceBuffer* buffer) {
+    UInt64 head = atomic_load_explicit(&buffer->head, memory_order_acquire);
+    return head <= buffer->mask ? head : buffer->mask + 1;
+}
+
+UInt64 trace_num_events() {
+    UInt64 num_events = 0;
+    for(TraceBuffer* buffer = atomic_load(&trace_buffers); SOME(buffer); buffer = buffer->next)
+        num_events += trace_buffer_len(buffer);
+    return num_events;
+}
+
+UInt64 trace_num_dropped() {
+    UInt64 num_dropped = 0;
+    for(TraceBuffer* buffer = atomic_load(&trace_buffers); SOME(buffer); buffer = buffer->next)
+        num_dropped += atomic_load(&buffer->head) - trace_buffer_len(buffer);
+    return num_dropped;
+}
+
+// Write `str` as a JSON string
+static void trace_json_str(FILE* stream, const char* str) {
+    fputc('"', stream);
+    for(; *str != nullchar; str++) {
+        unsigned char ch = cast(unsigned char)*str;
+        if(ch == '"' || ch == '\\')
+            fprintf(stream, "\\%c", ch);
+        else if(ch < 0x20)
+            fprintf(stream, "\\u%04x", ch);
+        else
+            fputc(ch, stream);
+    }
+    fputc('"', stream);
+}
+
+// Microseconds since `trace_start()` (as Chrome wants them)
+static double trace_us(UInt64 ns) {
+    return ns > trace_epoch ? cast(double)(ns - trace_epoch) / 1e3 : 0;
+}
+
+void trace_write_chrome(FILE* stream) {
+    fprintf(stream, "{\"traceEvents\": [\n");
+    fprintf(stream, "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 1, \"args\": {\"name\": \"adorad\"}}");
+    for(TraceBuffer* buffer = atomic_load(&trace_buffers); SOME(buffer); buffer = buffer->next) {
+        if(buffer->thread_name[0] != nullchar) {
+            fprintf(stream, ",\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": %u, \"args\": {\"name\": ",
+                    buffer->tid);
+            trace_json_str(stream, buffer->thread_name);
+            fprintf(stream, "}}");
+        }
+        UInt64 head = atomic_load_explicit(&buffer->head, memory_order_acquire);
+        for(UInt64 i = head - trace_buffer_len(buffer); i < head; i++) {
+            TraceEvent* event = &buffer->events[i & buffer->mask];
+            fprintf(stream, ",\n{\"name\": ");
+            trace_json_str(stream, event->name);
+            fprintf(stream, ", \"ph\": \"X\", \"pid\": 1, \"tid\": %u, \"ts\": %.3f, \"dur\": %.3f", buffer->tid,
+                    trace_us(event->begin), trace_us(event->end) - trace_us(event->begin));
+            if(event->detail[0] != nullchar) {
+                fprintf(stream, ", \"args\": {\"detail\": ");
+                trace_json_str(stream, event->detail);
+                fprintf(stream, "}");
+            }
+            fprintf(stream, "}");
+        }
+    }
+    fprintf(stream, "\n],\n\"displayTimeUnit\": \"ms\",\n\"otherData\": {\"num_dropped\": %llu}}\n",
+            cast(unsigned long long)trace_num_dropped());
+}
+
+bool trace_save_chrome(const char* fname) {
+    FILE* stream = fopen(fname, "wb");
+    if(NONE(stream))
+        return false;
+    trace_write_chrome(stream);
+    bool is_ok = !ferror(stream);
+    return fclose(stream) == 0 && is_ok;
+}
@@ -0,0 +1,102 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#ifndef ADORAD_TRACE_H
+#define ADORAD_TRACE_H
+
+#include <stdio.h>
+#include <stdatomic.h>
+
+#include <adorad/core/types.h>
+#include <adorad/core/misc.h>
+#include <adorad/compiler/stats.h>
+
+/*
+    Tracing
+    A zone is a span of time of a thread, with a name (eg. "lex") and a detail (eg. the file being lexed):
+        TRACE_ZONE("lex", file->fname) {
+            lexer_lex(file->lexer);
+        }
+    Once tracing is started (see `trace_start()`), every zone that ends is recorded in a ring buffer of the thread it
+    ran on. Rings are per thread, so recording takes no lock (nor a single atomic read-modify-write): a zone is two
+    reads of the clock and a 64-byte write. When the ring of a thread is full, its oldest zones are overwritten (and
+    counted as dropped).
+
+    `trace_write_chrome()` writes the zones in the Chrome trace format (of `chrome://tracing` and Perfetto): a track
+    per thread, so the files and phases on the critical path of a parallel build are the ones with nothing to their
+    right.
+
+    When tracing isn't on, a zone costs a (well-predicted) branch. Defining `ADORAD_NO_TRACE` (see `ADORAD_TRACE` in
+    CMake) compiles zones out altogether: `TRACE_ZONE(...)` is then only the block that follows it.
+
+    Tracing is started, written and freed by one thread, while no zones are running.
+*/
+
+// Zones kept per thread, unless asked otherwise (a power of 2)
+#define TRACE_DEFAULT_EVENTS    (64 * 1024)
+// Bytes of the detail of a zone that are kept (the last ones, for longer details: the end of a path is its file)
+#define TRACE_MAX_DETAIL        40
+// Bytes of the name of a thread that are kept
+#define TRACE_MAX_THREAD_NAME   32
+
+typedef struct TraceEvent {
+    const char* name;       // a string literal (or a string that outlives the trace)
+    UInt64 begin;           // see `stats_now()`
+    UInt64 end;
+    char detail[TRACE_MAX_DETAIL];
+} TraceEvent;
+
+typedef struct TraceBuffer {
+    TraceEvent* events;
+    UInt64 mask;                // no. of events - 1
+    atomic_uint_fast64_t head;  // no. of events recorded (the last one is at `(head - 1) & mask`)
+    UInt32 tid;
+    char thread_name[TRACE_MAX_THREAD_NAME];
+    struct TraceBuffer* next;
+} TraceBuffer;
+
+// Whether zones are being recorded
+extern atomic_bool traceEnabled;
+
+// Start recording zones, up to `events_per_thread` per thread (rounded up to a power of 2, `TRACE_DEFAULT_EVENTS`
+// if 0). Zones recorded before (by an earlier `trace_start()`) are freed
+void trace_start(UInt64 events_per_thread);
+// Stop recording zones (what was recorded is kept, for `trace_write_chrome()`)
+void trace_stop();
+// Stop recording zones, and free them
+void trace_free();
+// Name the calling thread (eg. "lex"), in the trace. Does nothing if tracing isn't on
+void trace_thread_name(const char* name);
+// Record the zone `name` (with `detail`, which may be null) that began at `begin` (see `stats_now()`), and ends now.
+// See `TRACE_ZONE()`
+void trace_zone_end(const char* name, const char* detail, UInt64 begin);
+// No. of zones kept (by every thread), and of those that were overwritten (see `trace_start()`)
+UInt64 trace_num_events();
+UInt64 trace_num_dropped();
+// Write the recorded zones to `stream`, in the Chrome trace format (JSON)
+void trace_write_chrome(FILE* stream);
+// Write the recorded zones to the file `fname`. Returns false if it can't be written
+bool trace_save_chrome(const char* fname);
+
+// Trace the statement (or block) that follows as the zone `name`, with `detail` (a string, or null - read when the
+// zone ends). Leaving the block early (with `break`, `return` or `goto`) skips recording the zone
+#if defined(ADORAD_NO_TRACE)
+    #define TRACE_ZONE(name, detail)
+#else
+    #define TRACE_ZONE(name, detail)                                                                                \
+        for(UInt64 __trace_begin = atomic_load_explicit(&traceEnabled, memory_order_relaxed) ? stats_now() : 0,     \
+                   __trace_once = 1; __trace_once;                                                                  \
+            __trace_once = 0, __trace_begin != 0 ? trace_zone_end((name), (detail), __trace_begin) : (void)0)
+#endif // ADORAD_NO_TRACE
+
+#endif // ADORAD_TRACE_H
@@ -50,7 +50,9 @@ typedef enum {
 
     // Quaternion
     AdoradTypeQuaternion128, 
-    AdoradTypeQuaternion256 
+    AdoradTypeQuaternion256,
+
+    AdoradTypeCount // no. of primitive types
 } AdoradTypes; 
 
 
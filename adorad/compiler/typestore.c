@@ -0,0 +1,292 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <adorad/core/debug.h>
+#include <adorad/compiler/typestore.h>
+
+// Initial capacity of the table
+#define TYPE_STORE_INITIAL_CAPACITY     256
+// No. of words of a key that fit on the stack (longer keys - of functions with many parameters - are allocated)
+#define TYPE_KEY_STACK_WORDS            64
+
+static const char* const primitiveNames[AdoradTypeCount] = {
+    "Any", "Null", "Bool", "Byte", "String", "Rune",
+    "Int8", "Int16", "Int", "Int64",
+    "Float32", "Float64",
+    "UInt16", "UInt32", "UInt64",
+    "TensorInt16", "TensorInt32", "TensorInt64", "TensorFloat32", "TensorFloat64",
+    "Complex32", "Complex64",
+    "Quaternion128", "Quaternion256"
+};
+
+const char* type_primitive_str(AdoradTypes primitive) {
+    return primitive < AdoradTypeCount ? primitiveNames[primitive] : "<unknown>";
+}
+
+// Returns the id of the type with key `key[0..len)` (its kind, then its parts), making an (empty) entry for it if
+// there isn't one. `is_new` is set if there wasn't
+static TypeId type_store_lookup(TypeStore* store, const UInt32* key, UInt32 len, bool* is_new) {
+    UInt64 num_bytes = len * sizeof(UInt32);
+    MapEntry* entry = map_insert_str(store->table, buffview_new_from_len(cast(char*)key, num_bytes), is_new);
+    if(CORETEN_LIKELY(!*is_new))
+        return cast(TypeId)(entry - store->table->entries) + 1;
+
+    CORETEN_ENFORCE(map_len(store->table) < UInt32_MAX, "Too many types");
+    // The key looked up is only borrowed: the table keeps the stored copy
+    char* copy = cast(char*)arena_alloc_aligned(store->keys, num_bytes, sizeof(UInt32));
+    memcpy(copy, key, num_bytes);
+    entry->key.str = buffview_new_from_len(copy, num_bytes);
+    Type type = {0};
+    type.kind = cast(TypeKind)key[0];
+    type.is_complete = true;
+    vec_push_Type(store->types, &type);
+    return map_len(store->table);
+}
+
+TypeStore* type_store_new() {
+    TypeStore* store = cast(TypeStore*)calloc(1, sizeof(TypeStore));
+    CORETEN_ENFORCE_NN(store, "Could not allocate memory. Memory full.");
+    store->table = map_new(MapKeyKindStr, TYPE_STORE_INITIAL_CAPACITY, null);
+    store->types = VEC_NEW(Type, TYPE_STORE_INITIAL_CAPACITY);
+    store->args = VEC_NEW(TypeArg, TYPE_STORE_INITIAL_CAPACITY);
+    store->keys = arena_new(0);
+
+    for(UInt32 i = 0; i < AdoradTypeCount; i++) {
+        UInt32 key[2] = { TypeKindPrimitive, i };
+        bool is_new;
+        TypeId id = type_store_lookup(store, key, 2, &is_new);
+        CORETEN_ENFORCE(id == TYPE_ID_OF(i), "Primitives must be the first types made");
+        type_store_get(store, id)->primitive = cast(AdoradTypes)i;
+    }
+    return store;
+}
+
+void type_store_free(TypeStore* store) {
+    if(SOME(store)) {
+        arena_free(store->keys);
+        vec_free(store->args);
+        vec_free(store->types);
+        map_free(store->table);
+        free(store);
+    }
+}
+
+Type* type_store_get(TypeStore* store, TypeId id) {
+    CORETEN_DEBUG_ENFORCE(id != TYPE_NONE && id <= vec_size(store->types), "Invalid TypeId");
+    return vec_at_Type(store->types, id - 1);
+}
+
+UInt32 type_store_len(TypeStore* store) {
+    return cast(UInt32)vec_size(store->types);
+}
+
+TypeArg* type_store_arg(TypeStore* store, TypeId id, UInt32 index) {
+    Type* type = type_store_get(store, id);
+    CORETEN_DEBUG_ENFORCE(index < type->num_args, "Invalid argument index");
+    return vec_at_TypeArg(store->args, type->first_arg + index);
+}
+
+// Returns the id of the pointer to, slice of or optional of `elem` (by `kind`)
+static TypeId type_derived(TypeStore* store, TypeKind kind, TypeId elem) {
+    UInt32 key[2] = { kind, elem };
+    bool is_new;
+    TypeId id = type_store_lookup(store, key, 2, &is_new);
+    if(is_new)
+        type_store_get(store, id)->elem = elem;
+    return id;
+}
+
+TypeId type_pointer_to(TypeStore* store, TypeId elem) {
+    Type* type = type_store_get(store, elem);
+    if(CORETEN_LIKELY(type->pointer != TYPE_NONE))
+        return type->pointer;
+    TypeId id = type_derived(store, TypeKindPointer, elem);
+    // (`type` may have moved)
+    type_store_get(store, elem)->pointer = id;
+    return id;
+}
+
+TypeId type_slice_of(TypeStore* store, TypeId elem) {
+    Type* type = type_store_get(store, elem);
+    if(CORETEN_LIKELY(type->slice != TYPE_NONE))
+        return type->slice;
+    TypeId id = type_derived(store, TypeKindSlice, elem);
+    type_store_get(store, elem)->slice = id;
+    return id;
+}
+
+TypeId type_optional_of(TypeStore* store, TypeId elem) {
+    Type* type = type_store_get(store, elem);
+    if(CORETEN_LIKELY(type->optional != TYPE_NONE))
+        return type->optional;
+    TypeId id = type_derived(store, TypeKindOptional, elem);
+    type_store_get(store, elem)->optional = id;
+    return id;
+}
+
+TypeId type_array_of(TypeStore* store, TypeId elem, UInt64 len) {
+    CORETEN_DEBUG_ENFORCE(elem != TYPE_NONE && elem <= type_store_len(store), "Invalid TypeId");
+    UInt32 key[4] = { TypeKindArray, elem, cast(UInt32)len, cast(UInt32)(len >> 32) };
+    bool is_new;
+    TypeId id = type_store_lookup(store, key, 4, &is_new);
+    if(is_new) {
+        Type* type = type_store_get(store, id);
+        type->elem = elem;
+        type->len = len;
+    }
+    return id;
+}
+
+TypeId type_func(TypeStore* store, const TypeId* params, UInt32 num_params, TypeId result) {
+    UInt32 stack_key[TYPE_KEY_STACK_WORDS];
+    UInt32 len = 3 + num_params;
+    UInt32* key = stack_key;
+    if(CORETEN_UNLIKELY(len > TYPE_KEY_STACK_WORDS)) {
+        key = cast(UInt32*)malloc(len * sizeof(UInt32));
+        CORETEN_ENFORCE_NN(key, "Could not allocate memory. Memory full.");
+    }
+    key[0] = TypeKindFunc;
+    key[1] = result;
+    key[2] = num_params;
+    for(UInt32 i = 0; i < num_params; i++)
+        key[3 + i] = params[i];
+
+    bool is_new;
+    TypeId id = type_store_lookup(store, key, len, &is_new);
+    if(is_new) {
+        UInt32 first_arg = cast(UInt32)vec_size(store->args);
+        for(UInt32 i = 0; i < num_params; i++) {
+            TypeArg arg = { SYMBOL_NULL, params[i] };
+            vec_push_TypeArg(store->args, &arg);
+        }
+        Type* type = type_store_get(store, id);
+        type->elem = result;
+        type->first_arg = first_arg;
+        type->num_args = num_params;
+    }
+    if(key != stack_key)
+        free(key);
+    return id;
+}
+
+TypeId type_struct(TypeStore* store, SymbolId module, SymbolId name) {
+    UInt32 key[3] = { TypeKindStruct, module, name };
+    bool is_new;
+    TypeId id = type_store_lookup(store, key, 3, &is_new);
+    if(is_new) {
+        Type* type = type_store_get(store, id);
+        type->module = module;
+        type->name = name;
+        type->is_complete = false;
+    }
+    return id;
+}
+
+void type_struct_set_fields(TypeStore* store, TypeId id, const TypeArg* fields, UInt32 num_fields) {
+    Type* type = type_store_get(store, id);
+    CORETEN_ENFORCE(type->kind == TypeKindStruct && !type->is_complete, "The fields of a struct are set once");
+    type->first_arg = cast(UInt32)vec_size(store->args);
+    type->num_args = num_fields;
+    type->is_complete = true;
+    for(UInt32 i = 0; i < num_fields; i++)
+        vec_push_TypeArg(store->args, &fields[i]);
+}
+
+// A (truncating) writer of a type's name
+typedef struct TypeFormatter {
+    char* out;
+    UInt32 cap;
+    UInt32 len;         // of the whole name (it may be longer than `cap`)
+} TypeFormatter;
+
+static void type_format_str(TypeFormatter* fmt, const char* str, UInt32 len) {
+    if(fmt->len + 1 < fmt->cap) {
+        UInt32 num = fmt->cap - 1 - fmt->len;
+        memcpy(fmt->out + fmt->len, str, len < num ? len : num);
+    }
+    fmt->len += len;
+}
+
+static void type_format_into(TypeStore* store, TypeId id, Interner* interner, TypeFormatter* fmt) {
+    if(id == TYPE_NONE) {
+        type_format_str(fmt, "<none>", 6);
+        return;
+    }
+    Type* type = type_store_get(store, id);
+    char num[32];
+    switch(type->kind) {
+        case TypeKindPrimitive: {
+            const char* name = type_primitive_str(type->primitive);
+            type_format_str(fmt, name, cast(UInt32)strlen(name));
+            break;
+        }
+        case TypeKindPointer:
+            type_format_str(fmt, "*", 1);
+            type_format_into(store, type->elem, interner, fmt);
+            break;
+        case TypeKindSlice:
+            type_format_str(fmt, "[]", 2);
+            type_format_into(store, type->elem, interner, fmt);
+            break;
+        case TypeKindOptional:
+            type_format_str(fmt, "?", 1);
+            type_format_into(store, type->elem, interner, fmt);
+            break;
+        case TypeKindArray: {
+            int len = snprintf(num, sizeof(num), "[%llu]", cast(unsigned long long)type->len);
+            type_format_str(fmt, num, cast(UInt32)len);
+            type_format_into(store, type->elem, interner, fmt);
+            break;
+        }
+        case TypeKindFunc: {
+            type_format_str(fmt, "func(", 5);
+            UInt32 first_arg = type->first_arg;
+            UInt32 num_args = type->num_args;
+            TypeId result = type->elem;
+            for(UInt32 i = 0; i < num_args; i++) {
+                if(i > 0)
+                    type_format_str(fmt, ", ", 2);
+                type_format_into(store, vec_at_TypeArg(store->args, first_arg + i)->type, interner, fmt);
+            }
+            type_format_str(fmt, ") ", 2);
+            type_format_into(store, result, interner, fmt);
+            break;
+        }
+        case TypeKindStruct: {
+            if(NONE(interner)) {
+                type_format_str(fmt, num, cast(UInt32)snprintf(num, sizeof(num), "struct#%u", id));
+                break;
+            }
+            BuffView module = interner_view(interner, type->module);
+            BuffView name = interner_view(interner, type->name);
+            type_format_str(fmt, module.data, cast(UInt32)module.len);
+            type_format_str(fmt, ".", 1);
+            type_format_str(fmt, name.data, cast(UInt32)name.len);
+            break;
+        }
+        default:
+            CORETEN_ENFORCE(false, "Unknown TypeKind");
+    }
+}
+
+UInt32 type_format(TypeStore* store, TypeId id, Interner* interner, char* out, UInt32 cap) {
+    TypeFormatter fmt = { out, cap, 0 };
+    type_format_into(store, id, interner, &fmt);
+    if(cap > 0)
+        out[fmt.len < cap ? fmt.len : cap - 1] = nullchar;
+    return fmt.len;
+}
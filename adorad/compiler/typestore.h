@@ -0,0 +1,122 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#ifndef ADORAD_TYPESTORE_H
+#define ADORAD_TYPESTORE_H
+
+#include <adorad/core/types.h>
+#include <adorad/core/memory.h>
+#include <adorad/core/map.h>
+#include <adorad/core/vector.h>
+#include <adorad/compiler/intern.h>
+#include <adorad/compiler/types.h>
+
+/*
+    Type store
+    Hash-conses every type of a compilation into a unique 32-bit `TypeId` (the way the Interner does spellings): a
+    type is made once, and asking for it again returns the same id. So two types are equal if and only if their ids
+    are.
+
+    The primitives (see `AdoradTypes`) are made up front: the id of `AdoradTypeX` is `TYPE_ID_OF(AdoradTypeX)`. Other
+    types are made from the ones they're made of:
+        * pointers (`*T`), slices (`[]T`) and optionals (`?T`) of a type are memoized in the type itself, so asking
+          for one again is an array access;
+        * arrays (`[N]T`) and functions (`func(A, B) R`) are looked up by their parts - with a key built on the stack,
+          so a type that already exists costs a hash lookup, and no allocation;
+        * structs are nominal: identified by their module and name. Their fields are set once they're known (which
+          doesn't change their id).
+    Types are never removed: the `id`th type is entry `id - 1` of the table (and of `types`).
+
+    The store is _not_ thread-safe.
+*/
+
+typedef UInt32 TypeId;
+
+// Id of "no type". No type is ever made with it
+#define TYPE_NONE               0
+// Id of the primitive `primitive` (an `AdoradTypes`)
+#define TYPE_ID_OF(primitive)   (cast(TypeId)(primitive) + 1)
+
+typedef enum TypeKind {
+    TypeKindPrimitive,
+    TypeKindPointer,
+    TypeKindSlice,
+    TypeKindArray,
+    TypeKindOptional,
+    TypeKindFunc,
+    TypeKindStruct,
+    TypeKindCount
+} TypeKind;
+
+// A parameter of a function type, or a field of a struct (see `Type.first_arg`)
+typedef struct TypeArg {
+    SymbolId name;      // SYMBOL_NULL for parameters
+    TypeId type;
+} TypeArg;
+
+VEC_DEFINE(TypeArg)
+
+typedef struct Type {
+    TypeKind kind;
+    AdoradTypes primitive;  // (TypeKindPrimitive)
+    TypeId elem;            // type pointed to, of the elements, or wrapped (pointers, slices, arrays and optionals).
+                            // The result of a function
+    UInt64 len;             // (TypeKindArray)
+    SymbolId module;        // (TypeKindStruct)
+    SymbolId name;          // (TypeKindStruct)
+    UInt32 first_arg;       // the parameters (or fields) are `TypeStore.args[first_arg .. first_arg + num_args)`
+    UInt32 num_args;
+    bool is_complete;       // unset for structs whose fields haven't been set
+    // Types made from this one (TYPE_NONE until they're asked for)
+    TypeId pointer;
+    TypeId slice;
+    TypeId optional;
+} Type;
+
+VEC_DEFINE(Type)
+
+typedef struct TypeStore {
+    Map* table;         // key of each type -> (its id is its index + 1). The keys are in `keys`
+    Vec* types;         // `Type`s, by id - 1
+    Vec* args;          // `TypeArg`s of the functions and structs
+    Arena* keys;
+} TypeStore;
+
+TypeStore* type_store_new();
+void type_store_free(TypeStore* store);
+// Returns the type `id`. The pointer is valid until the next type is made
+Type* type_store_get(TypeStore* store, TypeId id);
+// Number of types made (the primitives included)
+UInt32 type_store_len(TypeStore* store);
+// Returns the argument `index` of the function (or struct) `id`
+TypeArg* type_store_arg(TypeStore* store, TypeId id, UInt32 index);
+
+// Return the id of the type made from `elem` - which is made if it hasn't been before
+TypeId type_pointer_to(TypeStore* store, TypeId elem);
+TypeId type_slice_of(TypeStore* store, TypeId elem);
+TypeId type_optional_of(TypeStore* store, TypeId elem);
+TypeId type_array_of(TypeStore* store, TypeId elem, UInt64 len);
+// Returns the id of the type of functions taking `params[0..num_params)` and returning `result`
+TypeId type_func(TypeStore* store, const TypeId* params, UInt32 num_params, TypeId result);
+// Returns the id of the struct `name` of `module`. It's incomplete until its fields are set
+TypeId type_struct(TypeStore* store, SymbolId module, SymbolId name);
+// Set the fields of the struct `id` (once)
+void type_struct_set_fields(TypeStore* store, TypeId id, const TypeArg* fields, UInt32 num_fields);
+
+// Returns the name of the primitive `primitive` (eg. "Float64")
+const char* type_primitive_str(AdoradTypes primitive);
+// Write the name of the type `id` (eg. "[]*Int") to `out`, truncated (and nul-terminated) to `cap` bytes. Names of
+// structs are looked up in `interner` (which may be null). Returns the length of the whole name
+UInt32 type_format(TypeStore* store, TypeId id, Interner* interner, char* out, UInt32 cap);
+
+#endif // ADORAD_TYPESTORE_H
@@ -0,0 +1,40 @@
+// Auto-generated by tools/scripts/generate_tokens.py
+// DO NOT EDIT - regenerate with:
+//     python tools/scripts/generate_tokens.py unicode adorad/compiler/unicode.h adorad/compiler/unicode.c
+
+#ifndef ADORAD_UNICODE_H
+#define ADORAD_UNICODE_H
+
+#include <adorad/core/misc.h>
+#include <adorad/core/types.h>
+#include <adorad/core/utf8.h>
+
+/*
+    Unicode properties of code points, as two-stage tables (generated from the Unicode Character Database).
+    The code points are split into blocks of `UNICODE_BLOCK_SIZE`. Blocks with the same properties are only stored
+    once (in `unicodeCategories`), and `unicodeBlocks` maps every block to its index there - so a lookup is two loads.
+*/
+#define UNICODE_VERSION         "14.0.0"
+#define UNICODE_BLOCK_SHIFT     7
+#define UNICODE_BLOCK_SIZE      (1 << UNICODE_BLOCK_SHIFT)
+#define UNICODE_NUM_BLOCKS      249  // distinct blocks
+
+extern const UInt8 unicodeBlocks[(CORETEN_RUNE_MAX + 1) >> UNICODE_BLOCK_SHIFT];
+// The general category (a `cstlUTF8Category`) of every code point of every distinct block
+extern const UInt8 unicodeCategories[UNICODE_NUM_BLOCKS * UNICODE_BLOCK_SIZE];
+
+// Returns the general category of `rune` (UTF8_CATEGORY_CN past U+10FFFF)
+cstlUTF8Category unicode_category(Rune rune);
+
+/*
+    Identifiers (following the default syntax of UAX #31 - https://unicode.org/reports/tr31/)
+    An identifier begins with a letter (Lu, Ll, Lt, Lm, Lo), a letter number (Nl) or `_`, and continues with any of
+    those, a mark (Mn, Mc), a decimal digit (Nd) or a connector (Pc).
+    These are whole code points - the Lexer classifies ASCII with its own (cheaper) table first.
+*/
+// Can `rune` begin an identifier?
+bool unicode_is_ident_start(Rune rune);
+// Can `rune` continue an identifier?
+bool unicode_is_ident_continue(Rune rune);
+
+#endif // ADORAD_UNICODE_H
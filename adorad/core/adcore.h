@@ -61,10 +61,14 @@ CREDITS
 #include <adorad/core/memory.h>
 #include <adorad/core/math.h>
 #include <adorad/core/os.h>
+#include <adorad/core/thread.h>
+#include <adorad/core/jobs.h>
 #include <adorad/core/buffer.h>
 #include <adorad/core/char.h>
 #include <adorad/core/utf8.h>
 #include <adorad/core/vector.h>
+#include <adorad/core/map.h>
+#include <adorad/core/serial.h>
 #include <adorad/core/warnings.h>
 
 #ifdef CORETEN_INCLUDE_HASH_H
@@ -18,6 +18,8 @@ Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
 #include <adorad/core/types.h>
 #include <adorad/core/char.h>
 #include <adorad/core/misc.h>
+#include <adorad/core/memory.h>
+#include <adorad/core/hash.h>
 
 /*
     A `cstlBuffer` is a Fixed-Size Buffer.
@@ -38,12 +40,28 @@ struct cstlBuffer {
     // bool is_utf8;  // UTF-8 Strings
 };
 
+// Strings shorter than this (with their null terminator) are all copied into the same size class (see below)
+#define BUFF_SMALL_CAPACITY     16
+
+// Size of the single allocation made by `buff_new_copy()` for a string of `len` bytes.
+// Short strings all come from the same size class.
+#define BUFF_COPY_SIZE(len)     (sizeof(cstlBuffer) + ((len) < BUFF_SMALL_CAPACITY ? BUFF_SMALL_CAPACITY : (len) + 1))
+
 #define BUFF_NEW(buff_data)     buff_new(buff_data)
+// Same as `BUFF_NEW`, but for string literals (whose length is known at compile time)
+#define BUFF_LIT(cstr)          buff_new_from_len(cstr, sizeof(cstr) - 1)
 #define BV(cstr)                buffview_new_from_len(cstr, sizeof(cstr) - 1)
 #define BV_FMT                  "%.*s"
 #define BV_ARG(bv)              (int)(bv).len, (bv).data
 
 cstlBuffer* buff_new(char* buff_data);
+cstlBuffer* buff_new_from_len(char* buff_data, UInt64 len);
+// Copy `len` bytes from `data` into a new buffer, allocated along with its data (`buff_free()` frees both).
+cstlBuffer* buff_new_copy(const char* data, UInt64 len);
+// Same as `buff_new_copy()`, allocating from `allocator` (see `Allocator`). Free it with `buff_free_with()`
+cstlBuffer* buff_new_copy_with(const char* data, UInt64 len, Allocator* allocator);
+cstlBuffView buff_view(cstlBuffer* buffer);
+void buff_set_len(cstlBuffer* buffer, char* new_buff, UInt64 len);
 char buff_at(cstlBuffer* buffer, UInt64 n);
 char* buff_begin(cstlBuffer* buffer);
 char* buff_end(cstlBuffer* buffer);
@@ -59,6 +77,8 @@ bool buff_cmp(cstlBuffer* buff1, cstlBuffer* buff2);
 bool buff_cmp_nocase(cstlBuffer* buff1, cstlBuffer* buff2);
 cstlBuffer* buff_slice(cstlBuffer* buffer, int begin, int num_bytes);
 void buff_free(cstlBuffer* buffer);
+// Free a buffer made by `buff_new_copy_with(..., allocator)` (whose `len` hasn't changed since)
+void buff_free_with(cstlBuffer* buffer, Allocator* allocator);
 cstlBuffer* buff_toupper(cstlBuffer* buffer);
 cstlBuffer* buff_tolower(cstlBuffer* buffer);
 
@@ -71,6 +91,9 @@ cstlBuffView buffview_rev(cstlBuffView* view);
 void buffview_set(cstlBuffView* view, char* data);
 bool buffview_cmp(cstlBuffView* view1, cstlBuffView* view2);
 bool buffview_cmp_nocase(cstlBuffView* view1, cstlBuffView* view2);
+cstlBuffView buffview_slice(cstlBuffView* view, UInt64 begin, UInt64 num_bytes);
+UInt64 buffview_hash(cstlBuffView* view);
+
 
 
 #ifdef CORETEN_IMPL
@@ -86,6 +109,40 @@ bool buffview_cmp_nocase(cstlBuffView* view1, cstlBuffView* view2);
         return buffer;
     }
 
+    // Create a new `cstlBuffer` from `len` bytes at `buff_data` (which isn't copied)
+    cstlBuffer* buff_new_from_len(char* buff_data, UInt64 len) {
+        cstlBuffer* buffer = cast(cstlBuffer*)calloc(1, sizeof(cstlBuffer));
+        CORETEN_ENFORCE_NN(buffer, "Could not allocate memory. Memory full.");
+
+        buff_set_len(buffer, buff_data, len);
+
+        return buffer;
+    }
+
+    // Copy `len` bytes from `data` into a new buffer. The copy is null-terminated and stored right after the 
+    // `cstlBuffer` itself, so this is a single allocation (and `buff_free()` frees both)
+    cstlBuffer* buff_new_copy(const char* data, UInt64 len) {
+        return buff_new_copy_with(data, len, null);
+    }
+
+    cstlBuffer* buff_new_copy_with(const char* data, UInt64 len, Allocator* allocator) {
+        cstlBuffer* buffer = cast(cstlBuffer*)allocator_alloc(allocator, BUFF_COPY_SIZE(len));
+
+        buffer->data = cast(char*)(buffer + 1);
+        if(len > 0)
+            memcpy(buffer->data, data, len);
+        buffer->data[len] = nullchar;
+        buffer->len = len;
+
+        return buffer;
+    }
+
+    // A view of the whole buffer
+    cstlBuffView buff_view(cstlBuffer* buffer) {
+        CORETEN_ENFORCE_NN(buffer, "Expected not null");
+        return buffview_new_from_len(buffer->data, buffer->len);
+    }
+
     // Return the n'th character in the buffer data
     char buff_at(cstlBuffer* buffer, UInt64 n) {
         CORETEN_ENFORCE_NN(buffer, "Expected not null");
@@ -256,6 +313,19 @@ bool buffview_cmp_nocase(cstlBuffView* view1, cstlBuffView* view2);
         buffer->len = len;
     }
 
+    // Assign the `len` bytes at `new_buff` to the buffer data (without scanning it for its length)
+    void buff_set_len(cstlBuffer* buffer, char* new_buff, UInt64 len) {
+        CORETEN_ENFORCE_NN(buffer, "Expected not null");
+
+        if(NONE(new_buff)) {
+            len = 0;
+            new_buff = "";
+        }
+
+        buffer->data = new_buff;
+        buffer->len = len;
+    }
+
     // Returns the buffer length
     UInt64 buff_len(cstlBuffer* buffer) {
         return buffer->len;
@@ -289,100 +359,52 @@ bool buffview_cmp_nocase(cstlBuffView* view1, cstlBuffView* view2);
     // Compare two buffers (case-sensitive)
     // Returns true if `buff1` is lexicographically equal to `buff2`
     bool buff_cmp(cstlBuffer* buff1, cstlBuffer* buff2) {
-        if(buff1->len != buff2->len)
-            return false;
-        
-        const unsigned char* s1 = cast(const unsigned char*) buff1->data;
-        const unsigned char* s2 = cast(const unsigned char*) buff2->data;
-        unsigned char ch1, ch2;
-
-        do {
-            ch1 = cast(unsigned char) *s1++;
-            ch2 = cast(unsigned char) *s2++;
-            if(ch1 == nullchar)
-                return (ch1 - ch2) == 0 ? true : false;
-        } while(ch1 == ch2);
-
-        return (ch1 - ch2) == 0 ? true : false;
+        return buffview_cmp(buff1, buff2);
     }
 
     // Compare two buffers (ignoring case)
     // Returns true if `buff1` is lexicographically equal to `buff2`
     bool buff_cmp_nocase(cstlBuffer* buff1, cstlBuffer* buff2) {
-        if(buff1->len != buff2->len)
-            return false;
-        
-        const unsigned char* s1 = cast(const unsigned char*) buff1->data;
-        const unsigned char* s2 = cast(const unsigned char*) buff2->data;
-        int result;
-
-        if(s1 == s2)
-            return true;
-        
-        while((result = char_to_lower(*s1) - char_to_lower(*s2++)) == 0) {
-            if(*s1++ == nullchar)
-                break;
-        }
-        return result == 0 ? true : false;
+        return buffview_cmp_nocase(buff1, buff2);
     }
 
     // Get a slice of a buffer
+    // Get a slice of a buffer (a copy - see `buffview_slice()` for one that doesn't copy)
     cstlBuffer* buff_slice(cstlBuffer* buffer, int begin, int num_bytes) {
         CORETEN_ENFORCE_NN(buffer, "`buffer` cannot be null");
         CORETEN_ENFORCE(begin >= 0);
         CORETEN_ENFORCE(num_bytes >  0);
+        CORETEN_ENFORCE(cast(UInt64)begin + num_bytes <= buffer->len, "Out of bounds");
 
-        cstlBuffer* slice = buff_new(null);
-        CORETEN_ENFORCE_NN(slice, "`slice` cannot be null");
-        char* temp = cast(char*)calloc(1, num_bytes);
-        strncpy(temp, &(buffer->data[begin]), num_bytes);
-        buff_set(slice, temp);
-        CORETEN_ENFORCE_NN(slice, "`slice source` cannot be null");
-        return slice;
+        return buff_new_copy(buffer->data + begin, cast(UInt64)num_bytes);
     }
 
     // Clone a buffer
     cstlBuffer* buff_clone(cstlBuffer* buffer) {
         CORETEN_ENFORCE_NN(buffer, "Cannot clone a null buffer :(");
-        cstlBuffer* clone = buff_new(null);
-        char* dest = cast(char*)calloc(1, buff_len(buffer));
-        char* source = buffer->data;
-
-        if(source) {
-            char* str = dest;
-            while(*source)
-                *str++ = *source++;
-        }
-        buff_set(clone, dest);
-        return clone;
+        return buff_new_copy(buffer->data, buffer->len);
     }
 
     // Clone a buffer (upto `n` chars)
     cstlBuffer* buff_clone_n(cstlBuffer* buffer, int n) {
         CORETEN_ENFORCE_NN(buffer, "Cannot clone a null buffer :(");
         CORETEN_ENFORCE(n > 0);
-        CORETEN_ENFORCE(n > buffer->len);
-        cstlBuffer* clone = buff_new(null);
-        char* dest = cast(char*)calloc(1, buff_len(buffer));
-        char* source = buffer->data;
-
-        if(source) {
-            char* str = dest;
-            while(n > 0 && *source) {
-                *str++ = *source++;
-                n--;
-            }
-        }
-        buff_set(clone, dest);
-        return clone;
+        return buff_new_copy(buffer->data, cast(UInt64)n < buffer->len ? cast(UInt64)n : buffer->len);
     }
 
-    // Free the buffer from its associated memory
+    // Free the buffer from its associated memory.
+    // Buffers made by `buff_new_copy()` (or the functions that use it) own their data, which is freed along 
+    // with them. Otherwise, the data is not freed.
     void buff_free(cstlBuffer* buffer) {
         if(SOME(buffer))
             free(buffer);
     }
 
+    void buff_free_with(cstlBuffer* buffer, Allocator* allocator) {
+        if(SOME(buffer))
+            allocator_free(allocator, buffer, BUFF_COPY_SIZE(buffer->len));
+    }
+
     // Convert a buffer to lowercase
     cstlBuffer* buff_tolower(cstlBuffer* buffer) {
         cstlBuffer* lower = buff_new(null);
@@ -502,22 +524,12 @@ bool buffview_cmp_nocase(cstlBuffView* view1, cstlBuffView* view2);
 
     // Compare two BuffViews (case-sensitive)
     // Returns true if `view1` is lexicographically equal to `view2`
+    // Views need not be null-terminated (only `len` bytes are compared)
     bool buffview_cmp(cstlBuffView* view1, cstlBuffView* view2) {
         if(view1->len != view2->len)
             return false;
         
-        const unsigned char* s1 = cast(const unsigned char*) view1->data;
-        const unsigned char* s2 = cast(const unsigned char*) view2->data;
-        unsigned char ch1, ch2;
-
-        do {
-            ch1 = cast(unsigned char) *s1++;
-            ch2 = cast(unsigned char) *s2++;
-            if(ch1 == nullchar)
-                return (ch1 - ch2) == 0 ? true : false;
-        } while(ch1 == ch2);
-
-        return (ch1 - ch2) == 0 ? true : false;
+        return view1->data == view2->data || memcmp(view1->data, view2->data, view1->len) == 0;
     }
 
     // Compare two BuffViews (ignoring case)
@@ -528,16 +540,28 @@ bool buffview_cmp_nocase(cstlBuffView* view1, cstlBuffView* view2);
         
         const unsigned char* s1 = cast(const unsigned char*) view1->data;
         const unsigned char* s2 = cast(const unsigned char*) view2->data;
-        int result;
-
         if(s1 == s2)
             return true;
         
-        while((result = char_to_lower(*s1) - char_to_lower(*s2++)) == 0) {
-            if(*s1++ == nullchar)
-                break;
+        for(UInt64 i = 0; i < view1->len; i++) {
+            if(char_to_lower(s1[i]) != char_to_lower(s2[i]))
+                return false;
         }
-        return result == 0 ? true : false;
+        return true;
+    }
+
+    // A view of `num_bytes` bytes of `view` (from the `begin`th). Nothing is copied
+    cstlBuffView buffview_slice(cstlBuffView* view, UInt64 begin, UInt64 num_bytes) {
+        CORETEN_ENFORCE_NN(view, "Expected not null");
+        CORETEN_ENFORCE(begin + num_bytes <= view->len, "Out of bounds");
+
+        return buffview_new_from_len(view->data + begin, num_bytes);
+    }
+
+    // Hash of the `len` bytes of `view` (two views that compare equal have the same hash)
+    UInt64 buffview_hash(cstlBuffView* view) {
+        CORETEN_ENFORCE_NN(view, "Expected not null");
+        return hash_murmur64(view->data, cast(Ll)view->len);
     }
 
     // Append `view2` to the end of `view`.
@@ -16,9 +16,21 @@ Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
 
 #include <time.h>
 
+#include <adorad/core/os_defs.h>
+#include <adorad/core/headers.h>
+#include <adorad/core/types.h>
+
+// Processor time (see `clock()`). Not suited to timing anything multi-threaded, or that waits on I/O - use 
+// `clock_monotonic_ns()` for that
 double clock_now();
 double clock_duration(clock_t start, clock_t end);
 
+// Monotonic wall-clock time, in nanoseconds since an arbitrary (but fixed) point. It never goes backwards (unlike the
+// time of day, it isn't affected by the system clock being set), and is comparable across threads.
+UInt64 clock_monotonic_ns();
+// Nanoseconds elapsed since `start` (see `clock_monotonic_ns()`)
+UInt64 clock_elapsed_ns(UInt64 start);
+
 #ifdef CORETEN_IMPL
     #include <adorad/core/misc.h>
     
@@ -31,6 +43,47 @@ double clock_duration(clock_t start, clock_t end);
     double clock_duration(clock_t start, clock_t end) {
         return cast(double)(end - start)/CLOCKS_PER_SEC;
     }
+
+    #if defined(CORETEN_OS_WINDOWS)
+        UInt64 clock_monotonic_ns() {
+            static LARGE_INTEGER freq;
+            if(freq.QuadPart == 0)
+                QueryPerformanceFrequency(&freq);
+            LARGE_INTEGER now;
+            QueryPerformanceCounter(&now);
+            // Split the conversion, so that `counter * 1e9` can't overflow
+            UInt64 counter = cast(UInt64)now.QuadPart;
+            UInt64 f = cast(UInt64)freq.QuadPart;
+            return (counter / f) * 1000000000ull + (counter % f) * 1000000000ull / f;
+        }
+    #elif defined(CORETEN_OS_OSX)
+        #include <mach/mach_time.h>
+
+        UInt64 clock_monotonic_ns() {
+            static mach_timebase_info_data_t timebase;
+            if(timebase.denom == 0)
+                mach_timebase_info(&timebase);
+            UInt64 ticks = mach_absolute_time();
+            return (ticks / timebase.denom) * timebase.numer + (ticks % timebase.denom) * timebase.numer / timebase.denom;
+        }
+    #elif defined(CLOCK_MONOTONIC)
+        UInt64 clock_monotonic_ns() {
+            struct timespec now;
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            return cast(UInt64)now.tv_sec * 1000000000ull + cast(UInt64)now.tv_nsec;
+        }
+    #else
+        // No monotonic clock (eg. <time.h> was included in strict ISO C mode) - fall back to the time of day
+        UInt64 clock_monotonic_ns() {
+            struct timespec now;
+            timespec_get(&now, TIME_UTC);
+            return cast(UInt64)now.tv_sec * 1000000000ull + cast(UInt64)now.tv_nsec;
+        }
+    #endif // CORETEN_OS_WINDOWS
+
+    UInt64 clock_elapsed_ns(UInt64 start) {
+        return clock_monotonic_ns() - start;
+    }
 #endif // CORETEN_IMPL
 
 #endif // CORETEN_CLOCK_H
\ No newline at end of file
@@ -64,4 +64,95 @@ defined(__ia64__) || defined(__x86_64__)
     #define CORETEN_64BIT    0
 #endif
 
+// SIMD instruction sets available at compile-time
+// Define CORETEN_NO_SIMD to force the scalar code paths
+#ifndef CORETEN_NO_SIMD
+    #if defined(CORETEN_CPU_X86)
+        #if defined(__AVX2__)
+            #define CORETEN_SIMD_AVX2    1
+        #endif
+        #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+            #define CORETEN_SIMD_SSE2    1
+        #endif
+    #elif defined(CORETEN_CPU_ARM)
+        #if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+            #define CORETEN_SIMD_NEON    1
+        #endif
+    #endif
+#endif // CORETEN_NO_SIMD
+
+#include <adorad/core/types.h>
+
+// CPU features detected at runtime. Code that's compiled for a baseline target (eg. plain x86-64) checks these
+// before taking a path that needs a newer instruction set
+typedef struct CpuFeatures {
+    bool sse42;         // SSE4.2 (x86) - includes the CRC32C instructions
+    bool avx2;          // AVX2 (x86)
+    bool neon;          // NEON (ARM)
+    bool crc32;         // the CRC32/CRC32C instructions (ARMv8)
+} CpuFeatures;
+
+// Returns the features of the CPU we're running on (detected on the first call)
+const CpuFeatures* cpu_features();
+
+#ifdef CORETEN_IMPL
+    #if defined(CORETEN_CPU_X86)
+        #if defined(_MSC_VER)
+            #include <intrin.h>
+        #else
+            #include <cpuid.h>
+        #endif // _MSC_VER
+    #endif // CORETEN_CPU_X86
+
+    static CpuFeatures __cpu_detect() {
+        CpuFeatures features = {0};
+    #if defined(CORETEN_CPU_X86)
+        unsigned int regs[4] = {0};
+        #if defined(_MSC_VER)
+            __cpuid((int*)regs, 1);
+        #else
+            __get_cpuid(1, &regs[0], &regs[1], &regs[2], &regs[3]);
+        #endif // _MSC_VER
+        features.sse42 = (regs[2] >> 20) & 1;
+        // AVX2 also needs the OS to save the YMM registers (OSXSAVE, and XCR0's bits 1 and 2)
+        bool has_ymm = false;
+        if((regs[2] >> 27) & 1) {
+        #if defined(_MSC_VER)
+            has_ymm = (_xgetbv(0) & 6) == 6;
+        #else
+            unsigned int xcr0_lo, xcr0_hi;
+            __asm__ volatile("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+            has_ymm = (xcr0_lo & 6) == 6;
+        #endif // _MSC_VER
+        }
+        #if defined(_MSC_VER)
+            __cpuidex((int*)regs, 7, 0);
+        #else
+            __cpuid_count(7, 0, regs[0], regs[1], regs[2], regs[3]);
+        #endif // _MSC_VER
+        features.avx2 = has_ymm && ((regs[1] >> 5) & 1);
+    #elif defined(CORETEN_CPU_ARM)
+        // These are part of the target on the ARM platforms we build for (there's no portable way of asking the CPU)
+        #if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+            features.neon = true;
+        #endif
+        #if defined(__ARM_FEATURE_CRC32)
+            features.crc32 = true;
+        #endif
+    #endif // CORETEN_CPU_X86
+        return features;
+    }
+
+    const CpuFeatures* cpu_features() {
+        // Racing threads all compute (and store) the same result
+        static volatile bool is_detected = false;
+        static CpuFeatures features;
+        if(!is_detected) {
+            features = __cpu_detect();
+            is_detected = true;
+        }
+        return &features;
+    }
+#endif // CORETEN_IMPL
+
 #endif // CORETEN_CPU_H
\ No newline at end of file
@@ -149,6 +149,17 @@ void coreten_dread(DreadLevel pl, const char* format, ...);
 #define ENFORCE_NULL(val,...)                 CORETEN_ENFORCE((val) == null, __VA_ARGS__)
 #define CORETEN_ENFORCE_NN(val,...)           CORETEN_ENFORCE((val) != null, __VA_ARGS__)
 
+// Checks that guard against misuse (rather than against a failure at runtime, like running out of memory) on hot 
+// paths. These are compiled out if `CORETEN_NO_DEBUG_CHECKS` is defined (see `ADORAD_ELIDE_CHECKS` in CMake), so 
+// `cond` must not have side effects.
+#ifdef CORETEN_NO_DEBUG_CHECKS
+    #define CORETEN_DEBUG_ENFORCE(...)        ((void)0)
+    #define CORETEN_DEBUG_ENFORCE_NN(...)     ((void)0)
+#else
+    #define CORETEN_DEBUG_ENFORCE(...)        CORETEN_ENFORCE(__VA_ARGS__)
+    #define CORETEN_DEBUG_ENFORCE_NN(...)     CORETEN_ENFORCE_NN(__VA_ARGS__)
+#endif // CORETEN_NO_DEBUG_CHECKS
+
 #define WARN(...)     \
     cstl_colored_printf(CORETEN_COLOR_WARN, "%s:%u:\nWARNING: %s\n", __FILE__, __LINE__, __VA_ARGS__)
 
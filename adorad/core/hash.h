@@ -15,6 +15,10 @@ Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
 #define CORETEN_HASH_H
 
 #include <adorad/core/types.h>
+#include <adorad/core/misc.h>
+#include <adorad/core/warnings.h>
+#include <adorad/core/cpu.h>
+#include <adorad/core/compilers.h>
 
 /*
     Hashing & Checksum Functions
@@ -38,6 +42,31 @@ UInt64 hash_murmur64(void const* data, Ll len);
 UInt32 hash_murmur32_seed(void const* data, Ll len, UInt32 seed);
 UInt64 hash_murmur64_seed(void const* data__, Ll len, UInt64 seed);
 
+// CRC32C (Castagnoli), with the SSE4.2 or ARMv8 CRC instructions if the CPU has them (see `cpu_features()`)
+UInt32 hash_crc32c(void const* data, Ll len);
+// Extend `crc` (the `hash_crc32c()` of the data so far, or 0) with `data`
+UInt32 hash_crc32c_update(UInt32 crc, void const* data, Ll len);
+
+// wyhash (https://github.com/wangyi-fudan/wyhash) - a fast 64-bit hash (about as fast as memory can be read) with 
+// good statistical quality. It isn't cryptographic. Meant for content-hashing large inputs (eg. whole source files).
+// The hash of some data is the same on every platform.
+UInt64 hash_wyhash(void const* data, Ll len, UInt64 seed);
+
+// Streaming wyhash: feeding data in pieces (of any size) gives the same hash as `hash_wyhash()` of all of it
+typedef struct HashWyState {
+    UInt64 seed;
+    UInt64 see1;
+    UInt64 see2;
+    UInt64 len;         // no. of bytes so far
+    UInt8 buffer[64];   // the last 16 bytes of the blocks hashed so far, followed by (up to 48) pending bytes
+    UInt32 pending;
+    bool has_blocks;    // have any (48-byte) blocks been hashed?
+} HashWyState;
+
+void hash_wyhash_init(HashWyState* state, UInt64 seed);
+void hash_wyhash_update(HashWyState* state, void const* data, Ll len);
+UInt64 hash_wyhash_final(HashWyState* state);
+
 
 #ifdef CORETEN_INCLUDE_HASH_H
 #ifdef CORETEN_IMPL
@@ -343,7 +372,6 @@ UInt64 hash_murmur64_seed(void const* data__, Ll len, UInt64 seed);
         UInt64 h = seed ^ (len * m);
 
         UInt64 const* data = cast(UInt64 const* )data__;
-        UInt8  const* data2 = cast(UInt8 const* )data__;
         UInt64 const* end = data + (len / 8);
 
         while(data != end) {
@@ -356,6 +384,8 @@ UInt64 hash_murmur64_seed(void const* data__, Ll len, UInt64 seed);
             h ^= k;
             h *= m;
         }
+        // The (up to 7) bytes left over
+        UInt8 const* data2 = cast(UInt8 const* )data;
 
         // Fallthrough intended
         CORETEN_GCC_SUPPRESS_WARNING_PUSH
@@ -446,6 +476,315 @@ UInt64 hash_murmur64_seed(void const* data__, Ll len, UInt64 seed);
     #endif // CORETEN_ARCH_64BIT
     }
 
+    /*
+        CRC32C
+    */
+    #include <string.h>
+
+    static UInt32 const CORETEN__CRC32C_TABLE[256] = {
+        0x00000000, 0xf26b8303, 0xe13b70f7, 0x1350f3f4,
+        0xc79a971f, 0x35f1141c, 0x26a1e7e8, 0xd4ca64eb,
+        0x8ad958cf, 0x78b2dbcc, 0x6be22838, 0x9989ab3b,
+        0x4d43cfd0, 0xbf284cd3, 0xac78bf27, 0x5e133c24,
+        0x105ec76f, 0xe235446c, 0xf165b798, 0x030e349b,
+        0xd7c45070, 0x25afd373, 0x36ff2087, 0xc494a384,
+        0x9a879fa0, 0x68ec1ca3, 0x7bbcef57, 0x89d76c54,
+        0x5d1d08bf, 0xaf768bbc, 0xbc267848, 0x4e4dfb4b,
+        0x20bd8ede, 0xd2d60ddd, 0xc186fe29, 0x33ed7d2a,
+        0xe72719c1, 0x154c9ac2, 0x061c6936, 0xf477ea35,
+        0xaa64d611, 0x580f5512, 0x4b5fa6e6, 0xb93425e5,
+        0x6dfe410e, 0x9f95c20d, 0x8cc531f9, 0x7eaeb2fa,
+        0x30e349b1, 0xc288cab2, 0xd1d83946, 0x23b3ba45,
+        0xf779deae, 0x05125dad, 0x1642ae59, 0xe4292d5a,
+        0xba3a117e, 0x4851927d, 0x5b016189, 0xa96ae28a,
+        0x7da08661, 0x8fcb0562, 0x9c9bf696, 0x6ef07595,
+        0x417b1dbc, 0xb3109ebf, 0xa0406d4b, 0x522bee48,
+        0x86e18aa3, 0x748a09a0, 0x67dafa54, 0x95b17957,
+        0xcba24573, 0x39c9c670, 0x2a993584, 0xd8f2b687,
+        0x0c38d26c, 0xfe53516f, 0xed03a29b, 0x1f682198,
+        0x5125dad3, 0xa34e59d0, 0xb01eaa24, 0x42752927,
+        0x96bf4dcc, 0x64d4cecf, 0x77843d3b, 0x85efbe38,
+        0xdbfc821c, 0x2997011f, 0x3ac7f2eb, 0xc8ac71e8,
+        0x1c661503, 0xee0d9600, 0xfd5d65f4, 0x0f36e6f7,
+        0x61c69362, 0x93ad1061, 0x80fde395, 0x72966096,
+        0xa65c047d, 0x5437877e, 0x4767748a, 0xb50cf789,
+        0xeb1fcbad, 0x197448ae, 0x0a24bb5a, 0xf84f3859,
+        0x2c855cb2, 0xdeeedfb1, 0xcdbe2c45, 0x3fd5af46,
+        0x7198540d, 0x83f3d70e, 0x90a324fa, 0x62c8a7f9,
+        0xb602c312, 0x44694011, 0x5739b3e5, 0xa55230e6,
+        0xfb410cc2, 0x092a8fc1, 0x1a7a7c35, 0xe811ff36,
+        0x3cdb9bdd, 0xceb018de, 0xdde0eb2a, 0x2f8b6829,
+        0x82f63b78, 0x709db87b, 0x63cd4b8f, 0x91a6c88c,
+        0x456cac67, 0xb7072f64, 0xa457dc90, 0x563c5f93,
+        0x082f63b7, 0xfa44e0b4, 0xe9141340, 0x1b7f9043,
+        0xcfb5f4a8, 0x3dde77ab, 0x2e8e845f, 0xdce5075c,
+        0x92a8fc17, 0x60c37f14, 0x73938ce0, 0x81f80fe3,
+        0x55326b08, 0xa759e80b, 0xb4091bff, 0x466298fc,
+        0x1871a4d8, 0xea1a27db, 0xf94ad42f, 0x0b21572c,
+        0xdfeb33c7, 0x2d80b0c4, 0x3ed04330, 0xccbbc033,
+        0xa24bb5a6, 0x502036a5, 0x4370c551, 0xb11b4652,
+        0x65d122b9, 0x97baa1ba, 0x84ea524e, 0x7681d14d,
+        0x2892ed69, 0xdaf96e6a, 0xc9a99d9e, 0x3bc21e9d,
+        0xef087a76, 0x1d63f975, 0x0e330a81, 0xfc588982,
+        0xb21572c9, 0x407ef1ca, 0x532e023e, 0xa145813d,
+        0x758fe5d6, 0x87e466d5, 0x94b49521, 0x66df1622,
+        0x38cc2a06, 0xcaa7a905, 0xd9f75af1, 0x2b9cd9f2,
+        0xff56bd19, 0x0d3d3e1a, 0x1e6dcdee, 0xec064eed,
+        0xc38d26c4, 0x31e6a5c7, 0x22b65633, 0xd0ddd530,
+        0x0417b1db, 0xf67c32d8, 0xe52cc12c, 0x1747422f,
+        0x49547e0b, 0xbb3ffd08, 0xa86f0efc, 0x5a048dff,
+        0x8ecee914, 0x7ca56a17, 0x6ff599e3, 0x9d9e1ae0,
+        0xd3d3e1ab, 0x21b862a8, 0x32e8915c, 0xc083125f,
+        0x144976b4, 0xe622f5b7, 0xf5720643, 0x07198540,
+        0x590ab964, 0xab613a67, 0xb831c993, 0x4a5a4a90,
+        0x9e902e7b, 0x6cfbad78, 0x7fab5e8c, 0x8dc0dd8f,
+        0xe330a81a, 0x115b2b19, 0x020bd8ed, 0xf0605bee,
+        0x24aa3f05, 0xd6c1bc06, 0xc5914ff2, 0x37faccf1,
+        0x69e9f0d5, 0x9b8273d6, 0x88d28022, 0x7ab90321,
+        0xae7367ca, 0x5c18e4c9, 0x4f48173d, 0xbd23943e,
+        0xf36e6f75, 0x0105ec76, 0x12551f82, 0xe03e9c81,
+        0x34f4f86a, 0xc69f7b69, 0xd5cf889d, 0x27a40b9e,
+        0x79b737ba, 0x8bdcb4b9, 0x988c474d, 0x6ae7c44e,
+        0xbe2da0a5, 0x4c4623a6, 0x5f16d052, 0xad7d5351,
+    };
+
+    static UInt32 __hash_crc32c_sw(UInt32 crc, UInt8 const* bytes, Ll len) {
+        for(; len > 0; len--, bytes++)
+            crc = (crc >> 8) ^ CORETEN__CRC32C_TABLE[(crc ^ *bytes) & 0xff];
+        return crc;
+    }
+
+    #if defined(CORETEN_CPU_X86)
+        #include <nmmintrin.h>
+        // Compiled for SSE4.2 (whatever the target), but only called if the CPU has it
+        #if defined(CORETEN_COMPILER_MSVC) || defined(__SSE4_2__)
+            #define __HASH_TARGET_SSE42
+        #else
+            #define __HASH_TARGET_SSE42     __attribute__((target("sse4.2")))
+        #endif // CORETEN_COMPILER_MSVC
+
+        __HASH_TARGET_SSE42
+        static UInt32 __hash_crc32c_hw(UInt32 crc, UInt8 const* bytes, Ll len) {
+        #if CORETEN_64BIT
+            UInt64 crc64 = crc;
+            for(; len >= 8; len -= 8, bytes += 8) {
+                UInt64 word;
+                memcpy(&word, bytes, 8);
+                crc64 = _mm_crc32_u64(crc64, word);
+            }
+            crc = cast(UInt32)crc64;
+        #endif // CORETEN_64BIT
+            for(; len >= 4; len -= 4, bytes += 4) {
+                UInt32 word;
+                memcpy(&word, bytes, 4);
+                crc = _mm_crc32_u32(crc, word);
+            }
+            for(; len > 0; len--, bytes++)
+                crc = _mm_crc32_u8(crc, *bytes);
+            return crc;
+        }
+        #define __HASH_HAS_CRC32C_HW()      (cpu_features()->sse42)
+    #elif defined(CORETEN_CPU_ARM) && defined(__ARM_FEATURE_CRC32)
+        #include <arm_acle.h>
+
+        static UInt32 __hash_crc32c_hw(UInt32 crc, UInt8 const* bytes, Ll len) {
+            for(; len >= 8; len -= 8, bytes += 8) {
+                UInt64 word;
+                memcpy(&word, bytes, 8);
+                crc = __crc32cd(crc, word);
+            }
+            for(; len > 0; len--, bytes++)
+                crc = __crc32cb(crc, *bytes);
+            return crc;
+        }
+        #define __HASH_HAS_CRC32C_HW()      true
+    #else
+        #define __hash_crc32c_hw            __hash_crc32c_sw
+        #define __HASH_HAS_CRC32C_HW()      false
+    #endif // CORETEN_CPU_X86
+
+    UInt32 hash_crc32c_update(UInt32 crc, void const* data, Ll len) {
+        UInt8 const* bytes = cast(UInt8 const*)data;
+        crc = ~crc;
+        crc = __HASH_HAS_CRC32C_HW() ? __hash_crc32c_hw(crc, bytes, len) : __hash_crc32c_sw(crc, bytes, len);
+        return ~crc;
+    }
+
+    UInt32 hash_crc32c(void const* data, Ll len) {
+        return hash_crc32c_update(0, data, len);
+    }
+
+    /*
+        wyhash
+        Adapted from wyhash (final version 3), released into the public domain by Wang Yi <godspeed_china@yeah.net>
+    */
+    #if defined(CORETEN_COMPILER_MSVC) && defined(_M_X64)
+        #include <intrin.h>
+    #endif // CORETEN_COMPILER_MSVC
+
+    static UInt64 const __HASH_WY_SECRET[4] = {
+        0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull
+    };
+
+    // The 128-bit product of `*a` and `*b` (low half in `*a`, high half in `*b`)
+    static inline void __hash_wy_mum(UInt64* a, UInt64* b) {
+    #if defined(__SIZEOF_INT128__)
+        __uint128_t r = *a;
+        r *= *b;
+        *a = cast(UInt64)r;
+        *b = cast(UInt64)(r >> 64);
+    #elif defined(CORETEN_COMPILER_MSVC) && defined(_M_X64)
+        *a = _umul128(*a, *b, b);
+    #else
+        UInt64 ha = *a >> 32, hb = *b >> 32, la = cast(UInt32)*a, lb = cast(UInt32)*b;
+        UInt64 rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32);
+        UInt64 c = t < rl;
+        UInt64 lo = t + (rm1 << 32);
+        c += lo < t;
+        *a = lo;
+        *b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+    #endif // __SIZEOF_INT128__
+    }
+
+    static inline UInt64 __hash_wy_mix(UInt64 a, UInt64 b) {
+        __hash_wy_mum(&a, &b);
+        return a ^ b;
+    }
+
+    // Little-endian reads (so that hashes don't depend on the platform)
+    static inline UInt64 __hash_wy_r8(UInt8 const* p) {
+        UInt64 v;
+        memcpy(&v, p, 8);
+    #if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        v = __builtin_bswap64(v);
+    #endif
+        return v;
+    }
+
+    static inline UInt64 __hash_wy_r4(UInt8 const* p) {
+        UInt32 v;
+        memcpy(&v, p, 4);
+    #if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        v = __builtin_bswap32(v);
+    #endif
+        return v;
+    }
+
+    // 1 to 3 bytes
+    static inline UInt64 __hash_wy_r3(UInt8 const* p, UInt64 k) {
+        return (cast(UInt64)p[0] << 16) | (cast(UInt64)p[k >> 1] << 8) | p[k - 1];
+    }
+
+    static inline void __hash_wy_block(HashWyState* state, UInt8 const* p) {
+        UInt64 const* secret = __HASH_WY_SECRET;
+        state->seed = __hash_wy_mix(__hash_wy_r8(p) ^ secret[1], __hash_wy_r8(p + 8) ^ state->seed);
+        state->see1 = __hash_wy_mix(__hash_wy_r8(p + 16) ^ secret[2], __hash_wy_r8(p + 24) ^ state->see1);
+        state->see2 = __hash_wy_mix(__hash_wy_r8(p + 32) ^ secret[3], __hash_wy_r8(p + 40) ^ state->see2);
+    }
+
+    // Hash the last `i` (at most 48) bytes at `p`. If `len > 16`, the 16 bytes before `p` must be readable (they're 
+    // the end of the last block, if `i < 16`)
+    static UInt64 __hash_wy_finish(HashWyState* state, UInt8 const* p, UInt64 i) {
+        UInt64 const* secret = __HASH_WY_SECRET;
+        UInt64 len = state->len;
+        UInt64 seed = state->seed;
+        UInt64 a, b;
+        if(CORETEN_LIKELY(len <= 16)) {
+            if(CORETEN_LIKELY(len >= 4)) {
+                a = (__hash_wy_r4(p) << 32) | __hash_wy_r4(p + ((len >> 3) << 2));
+                b = (__hash_wy_r4(p + len - 4) << 32) | __hash_wy_r4(p + len - 4 - ((len >> 3) << 2));
+            } else if(CORETEN_LIKELY(len > 0)) {
+                a = __hash_wy_r3(p, len);
+                b = 0;
+            } else {
+                a = b = 0;
+            }
+        } else {
+            if(state->has_blocks)
+                seed ^= state->see1 ^ state->see2;
+            while(CORETEN_UNLIKELY(i > 16)) {
+                seed = __hash_wy_mix(__hash_wy_r8(p) ^ secret[1], __hash_wy_r8(p + 8) ^ seed);
+                i -= 16;
+                p += 16;
+            }
+            a = __hash_wy_r8(p + i - 16);
+            b = __hash_wy_r8(p + i - 8);
+        }
+        a ^= secret[1];
+        b ^= seed;
+        __hash_wy_mum(&a, &b);
+        return __hash_wy_mix(a ^ secret[0] ^ len, b ^ secret[1]);
+    }
+
+    void hash_wyhash_init(HashWyState* state, UInt64 seed) {
+        UInt64 const* secret = __HASH_WY_SECRET;
+        seed ^= __hash_wy_mix(seed ^ secret[0], secret[1]);
+        state->seed = seed;
+        state->see1 = seed;
+        state->see2 = seed;
+        state->len = 0;
+        state->pending = 0;
+        state->has_blocks = false;
+    }
+
+    UInt64 hash_wyhash(void const* data, Ll len, UInt64 seed) {
+        UInt8 const* p = cast(UInt8 const*)data;
+        HashWyState state;
+        hash_wyhash_init(&state, seed);
+        state.len = cast(UInt64)len;
+
+        // Blocks are hashed as long as more than 48 bytes are left (so the last one is always left to the tail)
+        UInt64 i = cast(UInt64)len;
+        if(i > 48) {
+            state.has_blocks = true;
+            do {
+                __hash_wy_block(&state, p);
+                p += 48;
+                i -= 48;
+            } while(CORETEN_LIKELY(i > 48));
+        }
+        return __hash_wy_finish(&state, p, i);
+    }
+
+    void hash_wyhash_update(HashWyState* state, void const* data, Ll len) {
+        UInt8 const* p = cast(UInt8 const*)data;
+        UInt64 n = cast(UInt64)len;
+        state->len += n;
+        while(n > 0) {
+            // No pending bytes: hash whole blocks straight from `data` (keeping the last bytes pending, since they 
+            // may be the end of the data)
+            if(state->pending == 0 && n > 48) {
+                do {
+                    __hash_wy_block(state, p);
+                    p += 48;
+                    n -= 48;
+                } while(n > 48);
+                state->has_blocks = true;
+                memcpy(state->buffer, p - 16, 16);
+                continue;
+            }
+
+            UInt64 take = 48 - state->pending;
+            if(take > n)
+                take = n;
+            memcpy(state->buffer + 16 + state->pending, p, take);
+            state->pending += cast(UInt32)take;
+            p += take;
+            n -= take;
+            // A full block that isn't the last one
+            if(state->pending == 48 && n > 0) {
+                __hash_wy_block(state, state->buffer + 16);
+                memcpy(state->buffer, state->buffer + 48, 16);
+                state->pending = 0;
+                state->has_blocks = true;
+            }
+        }
+    }
+
+    UInt64 hash_wyhash_final(HashWyState* state) {
+        return __hash_wy_finish(state, state->buffer + 16, state->pending);
+    }
+
 #endif // CORETEN_IMPL
 #endif // CORETEN_INCLUDE_HASH_H
 
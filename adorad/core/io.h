@@ -22,10 +22,48 @@ typedef struct File {
     char* contents;
 } File;
 
+// Number of zero bytes that are guaranteed to follow the contents of a `FileView`. This lets a reader (like the
+// Lexer) look ahead a few bytes past the end without bounds checks.
+#define FILE_VIEW_PADDING   64
+
+// A read-only view of the contents of a file (see `file_map()`).
+// `data[len]` .. `data[len + FILE_VIEW_PADDING - 1]` are guaranteed to be zero.
+typedef struct FileView {
+    char* data;         // file contents (read-only)
+    UInt64 len;         // length of the file (in bytes), excluding the padding
+    
+    bool is_mapped;     // true if `data` is a memory-mapped view (as opposed to a heap copy)
+    UInt64 __map_len;   // length of the mapping
+    int error;          // 0, or why the file couldn't be read (an `errno` value - eg. `ENOENT`). `data` is then null
+} FileView;
+
 char* read_file(const char* fname);
 bool file_exists(const char* path);
+// Map the file `fname` into memory (mmap on POSIX, MapViewOfFile on Windows) without copying it.
+// Falls back to reading the file into a (padded) heap buffer if it cannot be mapped. If the file cannot be read at
+// all (or is a directory), `view.error` says why - nothing is printed, and it's up to the caller to report it.
+FileView file_map(const char* fname);
+void file_unmap(FileView* view);
+
+// Size and last modification time of a file (see `file_info()`)
+typedef struct FileInfo {
+    UInt64 size;
+    UInt64 mtime_ns;    // nanoseconds since the epoch (only as precise as the file system)
+} FileInfo;
+
+// Get the size and modification time of `path`. Returns false if there's no such file
+bool file_info(const char* path, FileInfo* info);
+
+// Called by `dir_walk()` with the path of every file found (valid until it returns). Return false to stop the walk
+typedef bool (*DirWalkFunc)(const char* path, void* arg);
+// Call `func` with the path (`dir/.../name`) of every regular file under `dir`, recursively, in the order the file 
+// system lists them. Entries whose name begins with a `.` (eg. `.git`) are skipped. Returns false if `dir` couldn't 
+// be opened, or if `func` stopped the walk
+bool dir_walk(const char* dir, DirWalkFunc func, void* arg);
 
 #ifdef CORETEN_IMPL
+    #include <errno.h>
+    #include <string.h>
     #include <sys/stat.h>
 
     char* read_file(const char* fname) {
@@ -57,6 +95,179 @@ bool file_exists(const char* path);
         return buffer;
     }
 
+    // An (unmapped) view of a file that couldn't be read
+    static FileView __file_open_error(int error) {
+        FileView view = {0};
+        view.error = error != 0 ? error : EIO;
+        return view;
+    }
+
+    // Read the file into a heap buffer, followed by `FILE_VIEW_PADDING` zero bytes.
+    // `len` is only a hint (pipes and character devices report a size of 0)
+    static FileView __file_read_padded(FILE* file, UInt64 len, const char* fname) {
+        FileView view = {0};
+        // One more byte than `len` so that no second read is needed to see the end of the file
+        UInt64 cap = len > 0 ? len + 1 : 4096;
+        view.data = cast(char*)malloc(cap + FILE_VIEW_PADDING);
+        
+        while(SOME(view.data)) {
+            view.len += fread(view.data + view.len, 1, cap - view.len, file);
+            if(ferror(file)) {
+                int error = errno;
+                free(view.data);
+                return __file_open_error(error);
+            }
+            if(view.len < cap)
+                break;
+            cap *= 2;
+            char* data = cast(char*)realloc(view.data, cap + FILE_VIEW_PADDING);
+            if(NONE(data))
+                free(view.data);
+            view.data = data;
+        }
+        if(NONE(view.data)) {
+            fprintf(stderr, "Could not allocate memory for buffer for file at %s\n", fname);
+            exit(1);
+        }
+
+        memset(view.data + view.len, 0, FILE_VIEW_PADDING);
+        view.is_mapped = false;
+        return view;
+    }
+
+#if defined(CORETEN_OS_WINDOWS)
+    FileView file_map(const char* fname) {
+        HANDLE file = CreateFileA(fname, GENERIC_READ, FILE_SHARE_READ, null, OPEN_EXISTING, 
+                                  FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, null);
+        if(file == INVALID_HANDLE_VALUE) {
+            DWORD error = GetLastError();
+            bool is_missing = error == ERROR_FILE_NOT_FOUND || error == ERROR_PATH_NOT_FOUND;
+            return __file_open_error(is_missing ? ENOENT : EACCES);
+        }
+
+        LARGE_INTEGER size;
+        GetFileSizeEx(file, &size);
+        UInt64 len = cast(UInt64)size.QuadPart;
+
+        // A view cannot extend past the end of the file, so the file is only mapped if the zeroed tail of its last 
+        // page can hold the padding. Otherwise we read it
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        UInt64 page = info.dwPageSize;
+        UInt64 map_len = (len + page - 1) & ~(page - 1);
+        if(len > 0 && map_len - len >= FILE_VIEW_PADDING) {
+            HANDLE mapping = CreateFileMappingA(file, null, PAGE_READONLY, 0, 0, null);
+            if(SOME(mapping)) {
+                void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                // The view keeps the mapping (and file) alive
+                CloseHandle(mapping);
+                if(SOME(data)) {
+                    CloseHandle(file);
+                    FileView view = { cast(char*)data, len, true, map_len };
+                    return view;
+                }
+            }
+        }
+        CloseHandle(file);
+
+        FILE* fp = fopen(fname, "rb");
+        if(NONE(fp))
+            return __file_open_error(errno);
+        FileView view = __file_read_padded(fp, len, fname);
+        fclose(fp);
+        return view;
+    }
+
+    void file_unmap(FileView* view) {
+        if(NONE(view) || NONE(view->data))
+            return;
+        
+        if(view->is_mapped)
+            UnmapViewOfFile(view->data);
+        else
+            free(view->data);
+        view->data = null;
+        view->len = 0;
+    }
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+
+    // Without it, files whose last page has no room left for the padding are read instead of mapped
+    #if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+        #define MAP_ANONYMOUS MAP_ANON
+    #endif
+
+    FileView file_map(const char* fname) {
+        int fd = open(fname, O_RDONLY);
+        if(fd < 0)
+            return __file_open_error(errno);
+        struct stat st;
+        int error = fstat(fd, &st) != 0 ? errno : S_ISDIR(st.st_mode) ? EISDIR : 0;
+        if(error != 0) {
+            close(fd);
+            return __file_open_error(error);
+        }
+        
+        UInt64 len = cast(UInt64)st.st_size;
+        UInt64 page = cast(UInt64)sysconf(_SC_PAGESIZE);
+        UInt64 file_len = (len + page - 1) & ~(page - 1);
+        UInt64 map_len = (len + FILE_VIEW_PADDING + page - 1) & ~(page - 1);
+        
+        char* data = null;
+        if(S_ISREG(st.st_mode) && len > 0 && file_len - len >= FILE_VIEW_PADDING) {
+            // Past `len`, the last page of the file reads as zero
+            void* base = mmap(null, file_len, PROT_READ, MAP_PRIVATE, fd, 0);
+            if(base != MAP_FAILED) {
+                data = cast(char*)base;
+                map_len = file_len;
+            }
+        }
+    #ifdef MAP_ANONYMOUS
+        else if(S_ISREG(st.st_mode)) {
+            // Reserve enough zeroed (anonymous) pages for the file + padding, and map the file over the first few
+            void* base = mmap(null, map_len, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if(base != MAP_FAILED) {
+                if(len == 0 || mmap(base, file_len, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0) != MAP_FAILED)
+                    data = cast(char*)base;
+                else
+                    munmap(base, map_len);
+            }
+        }
+    #endif // MAP_ANONYMOUS
+        close(fd);
+
+        if(SOME(data)) {
+        #ifdef MADV_SEQUENTIAL
+            madvise(data, file_len, MADV_SEQUENTIAL);
+        #endif // MADV_SEQUENTIAL
+            FileView view = { data, len, true, map_len };
+            return view;
+        }
+
+        // Not a regular file (or cannot be mapped)
+        FILE* fp = fopen(fname, "rb");
+        if(NONE(fp))
+            return __file_open_error(errno);
+        FileView view = __file_read_padded(fp, len, fname);
+        fclose(fp);
+        return view;
+    }
+
+    void file_unmap(FileView* view) {
+        if(NONE(view) || NONE(view->data))
+            return;
+        
+        if(view->is_mapped)
+            munmap(view->data, view->__map_len);
+        else
+            free(view->data);
+        view->data = null;
+        view->len = 0;
+    }
+#endif // CORETEN_OS_WINDOWS
+
     bool file_exists(const char* path) {
     #ifdef WIN32
         if (GetFileAttributesA(path) != INVALID_FILE_ATTRIBUTES) return true;
@@ -68,6 +279,111 @@ bool file_exists(const char* path);
         return false;
     }
 
+    bool file_info(const char* path, FileInfo* info) {
+    #if defined(CORETEN_OS_WINDOWS)
+        WIN32_FILE_ATTRIBUTE_DATA data;
+        if(!GetFileAttributesExA(path, GetFileExInfoStandard, &data))
+            return false;
+        info->size = (cast(UInt64)data.nFileSizeHigh << 32) | data.nFileSizeLow;
+        // 100ns intervals since 1601
+        UInt64 ticks = (cast(UInt64)data.ftLastWriteTime.dwHighDateTime << 32) | data.ftLastWriteTime.dwLowDateTime;
+        info->mtime_ns = (ticks - 116444736000000000ull) * 100;
+    #else
+        struct stat st;
+        if(stat(path, &st) != 0)
+            return false;
+        info->size = cast(UInt64)st.st_size;
+        #if defined(CORETEN_OS_OSX)
+            info->mtime_ns = cast(UInt64)st.st_mtimespec.tv_sec * 1000000000ull + cast(UInt64)st.st_mtimespec.tv_nsec;
+        #elif defined(CORETEN_OS_LINUX) && defined(__GLIBC__) && !defined(__USE_XOPEN2K8)
+            // glibc only has `st_mtim` with POSIX 2008 (not in strict ISO C builds)
+            info->mtime_ns = cast(UInt64)st.st_mtime * 1000000000ull + cast(UInt64)st.st_mtimensec;
+        #elif defined(CORETEN_OS_LINUX)
+            info->mtime_ns = cast(UInt64)st.st_mtim.tv_sec * 1000000000ull + cast(UInt64)st.st_mtim.tv_nsec;
+        #else
+            info->mtime_ns = cast(UInt64)st.st_mtime * 1000000000ull;
+        #endif // CORETEN_OS_OSX
+    #endif // CORETEN_OS_WINDOWS
+        return true;
+    }
+
+    // `dir` + separator + `name` (to be freed by the caller)
+    static char* __dir_path_join(const char* dir, const char* name) {
+        UInt64 dir_len = strlen(dir);
+        UInt64 name_len = strlen(name);
+        char* path = cast(char*)malloc(dir_len + name_len + 2);
+        CORETEN_ENFORCE_NN(path, "Could not allocate memory. Memory full.");
+        memcpy(path, dir, dir_len);
+        if(dir_len > 0 && dir[dir_len - 1] != '/' && dir[dir_len - 1] != CORETEN_OS_SEP_CHAR)
+            path[dir_len++] = CORETEN_OS_SEP_CHAR;
+        memcpy(path + dir_len, name, name_len + 1);
+        return path;
+    }
+
+    // Walk `dir`. Returns false if `func` stopped the walk (directories that can't be opened are skipped). 
+    // `is_opened` is set if `dir` could be opened
+    static bool __dir_walk(const char* dir, DirWalkFunc func, void* arg, bool* is_opened);
+
+    bool dir_walk(const char* dir, DirWalkFunc func, void* arg) {
+        bool is_opened = false;
+        return __dir_walk(dir, func, arg, &is_opened) && is_opened;
+    }
+
+#if defined(CORETEN_OS_WINDOWS)
+    static bool __dir_walk(const char* dir, DirWalkFunc func, void* arg, bool* is_opened) {
+        char* pattern = __dir_path_join(dir, "*");
+        WIN32_FIND_DATAA entry;
+        HANDLE find = FindFirstFileA(pattern, &entry);
+        free(pattern);
+        *is_opened = find != INVALID_HANDLE_VALUE;
+        if(!*is_opened)
+            return true;
+
+        bool is_ok = true;
+        do {
+            if(entry.cFileName[0] == '.')
+                continue;
+            char* path = __dir_path_join(dir, entry.cFileName);
+            bool is_subdir_opened;
+            if(entry.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+                is_ok = __dir_walk(path, func, arg, &is_subdir_opened);
+            else
+                is_ok = func(path, arg);
+            free(path);
+        } while(is_ok && FindNextFileA(find, &entry));
+        FindClose(find);
+        return is_ok;
+    }
+#else
+    #include <dirent.h>
+
+    static bool __dir_walk(const char* dir, DirWalkFunc func, void* arg, bool* is_opened) {
+        DIR* handle = opendir(dir);
+        *is_opened = SOME(handle);
+        if(!*is_opened)
+            return true;
+
+        bool is_ok = true;
+        struct dirent* entry;
+        while(is_ok && SOME(entry = readdir(handle))) {
+            if(entry->d_name[0] == '.')
+                continue;
+            char* path = __dir_path_join(dir, entry->d_name);
+            struct stat st;
+            bool is_subdir_opened;
+            if(stat(path, &st) == 0) {
+                if(S_ISDIR(st.st_mode))
+                    is_ok = __dir_walk(path, func, arg, &is_subdir_opened);
+                else if(S_ISREG(st.st_mode))
+                    is_ok = func(path, arg);
+            }
+            free(path);
+        }
+        closedir(handle);
+        return is_ok;
+    }
+#endif // CORETEN_OS_WINDOWS
+
 #endif // CORETEN_IMPL
 
 #endif // CORETEN_IO_H
\ No newline at end of file
@@ -0,0 +1,390 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#ifndef CORETEN_JOBS_H
+#define CORETEN_JOBS_H
+
+#include <stdatomic.h>
+
+#include <adorad/core/types.h>
+#include <adorad/core/misc.h>
+#include <adorad/core/memory.h>
+#include <adorad/core/thread.h>
+
+/*
+    Job system
+    A pool of threads that run jobs (a function and its argument), scheduled by work stealing.
+
+    Each worker has its own deque of jobs (a Chase-Lev deque): it pushes and takes jobs at the bottom (so the jobs it
+    runs are the ones it made last, whose data is still in its cache), while idle workers steal from the top - the
+    oldest, and usually the largest, pieces of work. Only stealing needs to synchronize, so workers that have enough
+    to do never contend. Idle workers sleep until jobs are submitted.
+
+    The thread that makes the pool is its worker `0`: it doesn't run jobs on its own, but does while it waits on a
+    `JobGroup` (as does any job that waits). So a pool of `n` threads starts `n - 1` of them, and a pool of 1 runs
+    every job on the calling thread, in `job_group_wait()`.
+
+    Jobs may be submitted from the thread that made the pool, or from a job - not from any other thread.
+*/
+
+typedef void (*JobProc)(void* arg);
+
+// A set of jobs that can be waited on together
+typedef struct JobGroup {
+    _Atomic UInt64 num_pending; // no. of jobs submitted (to the group), and not yet finished
+} JobGroup;
+
+typedef struct Job {
+    JobProc proc;
+    void* arg;
+    JobGroup* group;
+} Job;
+
+// The jobs of a deque are `buffer[top % cap .. bottom % cap)`. Once it's full, it's copied into a buffer twice as
+// large - the old one is kept (in `prev`) until the pool is freed, as a thief may still be reading from it
+typedef struct JobDequeBuffer JobDequeBuffer;
+struct JobDequeBuffer {
+    JobDequeBuffer* prev;
+    Int64 cap;                  // a power of 2
+    _Atomic(Job*) jobs[];
+};
+
+typedef struct JobDeque {
+    _Atomic Int64 top;          // where thieves steal from
+    _Atomic Int64 bottom;       // where the owner pushes and takes
+    _Atomic(JobDequeBuffer*) buffer;
+} JobDeque;
+
+typedef struct JobPool JobPool;
+
+typedef struct JobWorker {
+    JobDeque deque;
+    JobPool* pool;
+    UInt32 id;
+    UInt64 seed;                // for picking victims
+    Arena* arena;               // scratch memory of the worker (see `job_pool_arena()`)
+    UInt64 num_jobs;            // no. of jobs this worker ran
+    UInt64 num_steals;          // no. of jobs this worker stole
+    Thread thread;
+    bool is_started;
+} JobWorker;
+
+struct JobPool {
+    JobWorker* workers;
+    UInt32 num_workers;         // including the thread that made the pool
+    _Atomic UInt64 num_queued;  // no. of jobs in the deques (that no worker has taken yet)
+    _Atomic UInt32 num_sleeping;// no. of workers waiting for jobs
+    _Atomic bool is_stopping;
+    Mutex lock;                 // guards sleeping (with `wake`)
+    CondVar wake;
+    JobWorker* prev_worker;     // worker of the calling thread before the pool was made (restored once it's freed)
+};
+
+// Initial no. of jobs a deque can hold (it grows as needed)
+#define JOB_DEQUE_INITIAL_CAP   256
+// No. of rounds of stealing an idle worker tries before it goes to sleep
+#define JOB_IDLE_SPINS          64
+
+// Create a pool of `num_threads` threads (including the calling one). If `num_threads` is 0, one thread per CPU is
+// used. Threads that can't be started are simply left out (their share of jobs is stolen by the others)
+JobPool* job_pool_new(UInt32 num_threads);
+// Stop and join every thread, and free the pool. No jobs may be pending
+void job_pool_free(JobPool* pool);
+// Run `proc(arg)` on the pool, as part of `group`
+void job_pool_submit(JobPool* pool, JobGroup* group, JobProc proc, void* arg);
+// Id (`0..num_workers`) of the worker of the calling thread - eg. for per-worker results. The calling thread must be
+// the one that made the pool, or running one of its jobs
+UInt32 job_pool_worker_id(JobPool* pool);
+// An Arena of the calling worker (see `job_pool_worker_id()`), for scratch memory that's only ever used by one
+// thread at a time. It's freed along with the pool
+Arena* job_pool_arena(JobPool* pool);
+// Total no. of jobs stolen by the workers of the pool
+UInt64 job_pool_num_steals(JobPool* pool);
+
+void job_group_init(JobGroup* group);
+// Wait for every job of `group` (including those submitted by its jobs) to finish, running jobs in the meantime
+void job_group_wait(JobPool* pool, JobGroup* group);
+
+#ifdef CORETEN_IMPL
+    #include <stdlib.h>
+    #include <adorad/core/debug.h>
+
+    // The worker of the calling thread (null if it isn't one)
+    static CORETEN_THREAD_LOCAL JobWorker* __job_current_worker = null;
+
+    static JobDequeBuffer* __job_deque_buffer_new(Int64 cap) {
+        JobDequeBuffer* buffer = cast(JobDequeBuffer*)malloc(sizeof(JobDequeBuffer) + cast(UInt64)cap * sizeof(Job*));
+        CORETEN_ENFORCE_NN(buffer, "Could not allocate memory. Memory full.");
+        buffer->prev = null;
+        buffer->cap = cap;
+        return buffer;
+    }
+
+    static void __job_deque_init(JobDeque* deque) {
+        atomic_init(&deque->top, 0);
+        atomic_init(&deque->bottom, 0);
+        atomic_init(&deque->buffer, __job_deque_buffer_new(JOB_DEQUE_INITIAL_CAP));
+    }
+
+    static void __job_deque_free(JobDeque* deque) {
+        JobDequeBuffer* buffer = atomic_load(&deque->buffer);
+        while(SOME(buffer)) {
+            JobDequeBuffer* prev = buffer->prev;
+            free(buffer);
+            buffer = prev;
+        }
+    }
+
+    // Push `job` at the bottom (only called by the owner)
+    static void __job_deque_push(JobDeque* deque, Job* job) {
+        Int64 bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+        Int64 top = atomic_load_explicit(&deque->top, memory_order_acquire);
+        JobDequeBuffer* buffer = atomic_load_explicit(&deque->buffer, memory_order_relaxed);
+        if(bottom - top > buffer->cap - 1) {
+            JobDequeBuffer* grown = __job_deque_buffer_new(buffer->cap * 2);
+            for(Int64 i = top; i < bottom; i++) {
+                Job* moved = atomic_load_explicit(&buffer->jobs[i & (buffer->cap - 1)], memory_order_relaxed);
+                atomic_store_explicit(&grown->jobs[i & (grown->cap - 1)], moved, memory_order_relaxed);
+            }
+            grown->prev = buffer;
+            atomic_store_explicit(&deque->buffer, grown, memory_order_release);
+            buffer = grown;
+        }
+        atomic_store_explicit(&buffer->jobs[bottom & (buffer->cap - 1)], job, memory_order_relaxed);
+        atomic_thread_fence(memory_order_release);
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+    }
+
+    // Take the job at the bottom (only called by the owner). Returns null if the deque is empty
+    static Job* __job_deque_take(JobDeque* deque) {
+        Int64 bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+        JobDequeBuffer* buffer = atomic_load_explicit(&deque->buffer, memory_order_relaxed);
+        atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        Int64 top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+        if(top > bottom) {
+            atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+            return null;
+        }
+
+        Job* job = atomic_load_explicit(&buffer->jobs[bottom & (buffer->cap - 1)], memory_order_relaxed);
+        if(top == bottom) {
+            // The last job: race the thieves for it
+            if(!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1, memory_order_seq_cst,
+                                                        memory_order_relaxed))
+                job = null;
+            atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+        }
+        return job;
+    }
+
+    // Steal the job at the top. Returns null if the deque is empty, or if another thread got there first
+    static Job* __job_deque_steal(JobDeque* deque) {
+        Int64 top = atomic_load_explicit(&deque->top, memory_order_acquire);
+        atomic_thread_fence(memory_order_seq_cst);
+        Int64 bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+        if(top >= bottom)
+            return null;
+
+        JobDequeBuffer* buffer = atomic_load_explicit(&deque->buffer, memory_order_acquire);
+        Job* job = atomic_load_explicit(&buffer->jobs[top & (buffer->cap - 1)], memory_order_relaxed);
+        if(!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1, memory_order_seq_cst,
+                                                    memory_order_relaxed))
+            return null;
+        return job;
+    }
+
+    // Find a job for `worker`: its own (newest first), or else one stolen from another worker (starting with a
+    // random one, so that thieves spread out)
+    static Job* __job_worker_find(JobWorker* worker) {
+        JobPool* pool = worker->pool;
+        Job* job = __job_deque_take(&worker->deque);
+        if(NONE(job) && pool->num_workers > 1) {
+            // xorshift64
+            worker->seed ^= worker->seed << 13;
+            worker->seed ^= worker->seed >> 7;
+            worker->seed ^= worker->seed << 17;
+            UInt32 first = cast(UInt32)(worker->seed % pool->num_workers);
+            for(UInt32 i = 0; i < pool->num_workers && NONE(job); i++) {
+                JobWorker* victim = &pool->workers[(first + i) % pool->num_workers];
+                if(victim != worker)
+                    job = __job_deque_steal(&victim->deque);
+            }
+            if(SOME(job))
+                ++worker->num_steals;
+        }
+        if(SOME(job))
+            atomic_fetch_sub(&pool->num_queued, 1);
+        return job;
+    }
+
+    static void __job_run(JobWorker* worker, Job* job) {
+        JobGroup* group = job->group;
+        job->proc(job->arg);
+        ++worker->num_jobs;
+        free(job);
+        atomic_fetch_sub_explicit(&group->num_pending, 1, memory_order_release);
+    }
+
+    static void* __job_worker_main(void* arg) {
+        JobWorker* worker = cast(JobWorker*)arg;
+        JobPool* pool = worker->pool;
+        __job_current_worker = worker;
+
+        UInt32 num_idle = 0;
+        while(!atomic_load(&pool->is_stopping)) {
+            Job* job = __job_worker_find(worker);
+            if(SOME(job)) {
+                __job_run(worker, job);
+                num_idle = 0;
+                continue;
+            }
+            if(++num_idle < JOB_IDLE_SPINS) {
+                thread_yield();
+                continue;
+            }
+
+            // Sleep until jobs are submitted. `num_sleeping` is raised before `num_queued` is checked (and the other
+            // way around in `job_pool_submit()`), so a job submitted meanwhile always wakes someone up
+            mutex_lock(&pool->lock);
+            atomic_fetch_add(&pool->num_sleeping, 1);
+            if(atomic_load(&pool->num_queued) == 0 && !atomic_load(&pool->is_stopping))
+                condvar_wait(&pool->wake, &pool->lock);
+            atomic_fetch_sub(&pool->num_sleeping, 1);
+            mutex_unlock(&pool->lock);
+            num_idle = 0;
+        }
+        __job_current_worker = null;
+        return null;
+    }
+
+    JobPool* job_pool_new(UInt32 num_threads) {
+        if(num_threads == 0)
+            num_threads = thread_num_cpus();
+
+        JobPool* pool = cast(JobPool*)calloc(1, sizeof(JobPool));
+        CORETEN_ENFORCE_NN(pool, "Could not allocate memory. Memory full.");
+        pool->workers = cast(JobWorker*)calloc(num_threads, sizeof(JobWorker));
+        CORETEN_ENFORCE_NN(pool->workers, "Could not allocate memory. Memory full.");
+        pool->num_workers = num_threads;
+        atomic_init(&pool->num_queued, 0);
+        atomic_init(&pool->num_sleeping, 0);
+        atomic_init(&pool->is_stopping, false);
+        mutex_init(&pool->lock);
+        condvar_init(&pool->wake);
+
+        for(UInt32 i = 0; i < num_threads; i++) {
+            JobWorker* worker = &pool->workers[i];
+            __job_deque_init(&worker->deque);
+            worker->pool = pool;
+            worker->id = i;
+            worker->seed = 0x9E3779B97F4A7C15ull * (i + 1);
+        }
+
+        // Worker `0` is the calling thread. The others are only started once every deque is ready to be stolen from
+        pool->prev_worker = __job_current_worker;
+        __job_current_worker = &pool->workers[0];
+        for(UInt32 i = 1; i < num_threads; i++) {
+            JobWorker* worker = &pool->workers[i];
+            worker->is_started = thread_start(&worker->thread, __job_worker_main, worker);
+        }
+        return pool;
+    }
+
+    void job_pool_free(JobPool* pool) {
+        if(NONE(pool))
+            return;
+        CORETEN_ENFORCE(atomic_load(&pool->num_queued) == 0, "Jobs are still pending");
+
+        mutex_lock(&pool->lock);
+        atomic_store(&pool->is_stopping, true);
+        condvar_broadcast(&pool->wake);
+        mutex_unlock(&pool->lock);
+        // Every worker may (until it stops) steal from any deque - including worker `0`'s, which is never joined. So the
+        // deques are only freed once they've all been joined
+        for(UInt32 i = 1; i < pool->num_workers; i++) {
+            if(pool->workers[i].is_started)
+                thread_join(&pool->workers[i].thread);
+        }
+        for(UInt32 i = 0; i < pool->num_workers; i++) {
+            __job_deque_free(&pool->workers[i].deque);
+            arena_free(pool->workers[i].arena);
+        }
+        __job_current_worker = pool->prev_worker;
+
+        condvar_destroy(&pool->wake);
+        mutex_destroy(&pool->lock);
+        free(pool->workers);
+        free(pool);
+    }
+
+    // The worker of the calling thread, which must belong to `pool`
+    static JobWorker* __job_worker_of(JobPool* pool) {
+        JobWorker* worker = __job_current_worker;
+        CORETEN_ENFORCE(SOME(worker) && worker->pool == pool, "The calling thread isn't a worker of this pool");
+        return worker;
+    }
+
+    void job_pool_submit(JobPool* pool, JobGroup* group, JobProc proc, void* arg) {
+        JobWorker* worker = __job_worker_of(pool);
+        Job* job = cast(Job*)malloc(sizeof(Job));
+        CORETEN_ENFORCE_NN(job, "Could not allocate memory. Memory full.");
+        job->proc = proc;
+        job->arg = arg;
+        job->group = group;
+
+        atomic_fetch_add_explicit(&group->num_pending, 1, memory_order_relaxed);
+        atomic_fetch_add(&pool->num_queued, 1);
+        __job_deque_push(&worker->deque, job);
+        if(atomic_load(&pool->num_sleeping) > 0) {
+            mutex_lock(&pool->lock);
+            condvar_signal(&pool->wake);
+            mutex_unlock(&pool->lock);
+        }
+    }
+
+    UInt32 job_pool_worker_id(JobPool* pool) {
+        return __job_worker_of(pool)->id;
+    }
+
+    Arena* job_pool_arena(JobPool* pool) {
+        JobWorker* worker = __job_worker_of(pool);
+        if(NONE(worker->arena))
+            worker->arena = arena_new(0);
+        return worker->arena;
+    }
+
+    UInt64 job_pool_num_steals(JobPool* pool) {
+        UInt64 num_steals = 0;
+        for(UInt32 i = 0; i < pool->num_workers; i++)
+            num_steals += pool->workers[i].num_steals;
+        return num_steals;
+    }
+
+    void job_group_init(JobGroup* group) {
+        atomic_init(&group->num_pending, 0);
+    }
+
+    void job_group_wait(JobPool* pool, JobGroup* group) {
+        JobWorker* worker = __job_worker_of(pool);
+        while(atomic_load_explicit(&group->num_pending, memory_order_acquire) > 0) {
+            Job* job = __job_worker_find(worker);
+            if(SOME(job))
+                __job_run(worker, job);
+            else
+                thread_yield();
+        }
+    }
+#endif // CORETEN_IMPL
+
+#endif // CORETEN_JOBS_H
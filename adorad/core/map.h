@@ -0,0 +1,466 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#ifndef CORETEN_MAP_H
+#define CORETEN_MAP_H
+
+#include <adorad/core/types.h>
+#include <adorad/core/misc.h>
+#include <adorad/core/debug.h>
+#include <adorad/core/cpu.h>
+#include <adorad/core/compilers.h>
+#include <adorad/core/buffer.h>
+#include <adorad/core/memory.h>
+#include <adorad/core/hash.h>
+
+/*
+    A `cstlMap` is an open-addressing hash map (in the style of Abseil's SwissTable), keyed by a `BuffView` or an
+    integer (every key of a map is of the same kind).
+
+    The table is an array of 1-byte control words (one per slot): each is either empty, deleted, or holds 7 bits of
+    the hash of the key in the slot. A lookup compares a whole group of control words against those 7 bits at once
+    (with SSE2/NEON, or 8 at a time in a machine word), so it usually touches one group of the table and then the
+    one entry that matches - one or two cache misses.
+
+    Entries are stored densely, in insertion order, so iterating them (see `map_next()`) visits them in the order
+    they were inserted regardless of how the table was grown. Removed entries leave a hole that's skipped (and
+    reclaimed the next time the table is rehashed).
+
+    Memory comes from the heap, or from an `Arena` (see `map_new()`) - memory of a table outgrown is then only
+    released along with the arena.
+    Pointers to entries are invalidated by insertions and removals.
+*/
+
+typedef enum MapKeyKind {
+    MapKeyKindInt,
+    MapKeyKindStr
+} MapKeyKind;
+
+typedef struct MapEntry {
+    union {
+        UInt64 num;
+        BuffView str;   // not copied: the key's data must outlive the entry
+    } key;
+    void* value;
+    UInt32 hash;
+    bool is_removed;
+} MapEntry;
+
+typedef struct cstlMap cstlMap;
+typedef cstlMap Map;
+
+struct cstlMap {
+    UInt8* ctrl;            // `num_slots` control words (followed by a copy of the first group's)
+    UInt32* slots;          // `slots[i]` is the index (in `entries`) of the entry in slot `i`
+    MapEntry* entries;      // in insertion order
+    UInt32 num_slots;       // always a power of 2
+    UInt32 growth_left;     // no. of empty slots that can be filled before the table must be rehashed
+    UInt32 num_entries;     // no. of entries in `entries` (including removed ones)
+    UInt32 cap_entries;     // allocated capacity of `entries`
+    UInt32 len;             // no. of (live) entries
+    MapKeyKind kind;
+    Arena* arena;           // if set, all memory is allocated from here
+};
+
+// Create a new map for (at least) `capacity` entries. If `arena` is set, the map (and its tables) are allocated
+// from it, and `map_free()` is a no-op
+Map* map_new(MapKeyKind kind, UInt32 capacity, Arena* arena);
+void map_free(Map* map);
+// Make room for `num` entries (so that inserting up to `num` entries doesn't rehash)
+void map_reserve(Map* map, UInt32 num);
+// Remove all entries (keeping the allocated memory)
+void map_clear(Map* map);
+// No. of entries in `map`
+UInt32 map_len(Map* map);
+
+// Returns the entry of `key`, or null
+MapEntry* map_find_str(Map* map, BuffView key);
+MapEntry* map_find_int(Map* map, UInt64 key);
+// Returns the entry of `key`, inserting it (with a null `value`) if it's not in `map`. `is_new` (if set) tells
+// which. The key of a new entry may be replaced with an equal one (eg. a copy that outlives the one looked up)
+MapEntry* map_insert_str(Map* map, BuffView key, bool* is_new);
+MapEntry* map_insert_int(Map* map, UInt64 key, bool* is_new);
+// Set the value of `key` (inserting it if needed)
+MapEntry* map_put_str(Map* map, BuffView key, void* value);
+MapEntry* map_put_int(Map* map, UInt64 key, void* value);
+// Remove `key`. Returns false if it wasn't in `map`
+bool map_remove_str(Map* map, BuffView key);
+bool map_remove_int(Map* map, UInt64 key);
+
+// Iterate the entries of `map` in insertion order. `iter` must start at 0; returns null once done:
+//      UInt32 iter = 0;
+//      for(MapEntry* entry; SOME(entry = map_next(map, &iter)); ) { ... }
+MapEntry* map_next(Map* map, UInt32* iter);
+// The `index`th entry inserted (if none have been removed, the entries are `map_at(map, 0..map_len(map))`)
+MapEntry* map_at(Map* map, UInt32 index);
+
+UInt32 map_hash_str(BuffView key);
+UInt32 map_hash_int(UInt64 key);
+
+
+#ifdef CORETEN_IMPL
+    #include <string.h>
+
+    #define MAP_CTRL_EMPTY      0x80
+    #define MAP_CTRL_DELETED    0xFE
+    // The 7 bits of the hash stored in the control word. The slot is picked with the low bits
+    #define MAP_H2(hash)        cast(UInt8)((hash) >> 25)
+
+    // Every backend matches a group of `MAP_GROUP_WIDTH` control words, and yields a bitmask with one bit set per
+    // matching control word (its lane is the bit's index `>> MAP_MASK_SHIFT`)
+    #if defined(CORETEN_SIMD_SSE2)
+        #include <emmintrin.h>
+        #define MAP_GROUP_WIDTH     16
+        #define MAP_MASK_SHIFT      0
+
+        static inline UInt64 map_group_match(const UInt8* ctrl, UInt8 h2) {
+            __m128i group = _mm_loadu_si128(cast(const __m128i*)ctrl);
+            return cast(UInt32)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(cast(char)h2)));
+        }
+        static inline UInt64 map_group_empty(const UInt8* ctrl) {
+            return map_group_match(ctrl, MAP_CTRL_EMPTY);
+        }
+        // Empty or deleted (the control words with the high bit set)
+        static inline UInt64 map_group_free(const UInt8* ctrl) {
+            return cast(UInt32)_mm_movemask_epi8(_mm_loadu_si128(cast(const __m128i*)ctrl));
+        }
+    #elif defined(CORETEN_SIMD_NEON)
+        #include <arm_neon.h>
+        #define MAP_GROUP_WIDTH     16
+        #define MAP_MASK_SHIFT      2
+
+        // Narrow every byte to 4 bits (NEON has no `movemask`), and keep one of them
+        static inline UInt64 map_group_mask(uint8x16_t v) {
+            return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(v), 4)), 0) &
+                   0x8888888888888888ull;
+        }
+        static inline UInt64 map_group_match(const UInt8* ctrl, UInt8 h2) {
+            return map_group_mask(vceqq_u8(vld1q_u8(ctrl), vdupq_n_u8(h2)));
+        }
+        static inline UInt64 map_group_empty(const UInt8* ctrl) {
+            return map_group_match(ctrl, MAP_CTRL_EMPTY);
+        }
+        static inline UInt64 map_group_free(const UInt8* ctrl) {
+            return map_group_mask(vtstq_u8(vld1q_u8(ctrl), vdupq_n_u8(0x80)));
+        }
+    #else
+        // A group is a machine word (the tricks are from "Bit Twiddling Hacks")
+        #define MAP_GROUP_WIDTH     8
+        #define MAP_MASK_SHIFT      3
+        #define MAP_LSBS            0x0101010101010101ull
+        #define MAP_MSBS            0x8080808080808080ull
+
+        // Lane `i` is byte `i` (whatever the endianness)
+        static inline UInt64 map_group_load(const UInt8* ctrl) {
+            UInt64 word = 0;
+            for(UInt32 i = 0; i < MAP_GROUP_WIDTH; i++)
+                word |= cast(UInt64)ctrl[i] << (8 * i);
+            return word;
+        }
+        // May have false positives (only in lanes after a true match), which fail the key comparison anyway
+        static inline UInt64 map_group_match(const UInt8* ctrl, UInt8 h2) {
+            UInt64 x = map_group_load(ctrl) ^ (MAP_LSBS * h2);
+            return (x - MAP_LSBS) & ~x & MAP_MSBS;
+        }
+        // The high bit set, and bit 1 clear
+        static inline UInt64 map_group_empty(const UInt8* ctrl) {
+            UInt64 word = map_group_load(ctrl);
+            return word & ~(word << 6) & MAP_MSBS;
+        }
+        static inline UInt64 map_group_free(const UInt8* ctrl) {
+            return map_group_load(ctrl) & MAP_MSBS;
+        }
+    #endif // CORETEN_SIMD_SSE2
+
+    #if defined(CORETEN_COMPILER_MSVC)
+        #include <intrin.h>
+    #endif // CORETEN_COMPILER_MSVC
+
+    // Lane of the first bit set in `mask` (which must not be 0)
+    static inline UInt32 map_first_lane(UInt64 mask) {
+    #if defined(CORETEN_COMPILER_MSVC)
+        unsigned long index;
+        _BitScanForward64(&index, mask);
+        return cast(UInt32)index >> MAP_MASK_SHIFT;
+    #else
+        return cast(UInt32)__builtin_ctzll(mask) >> MAP_MASK_SHIFT;
+    #endif // CORETEN_COMPILER_MSVC
+    }
+
+    // The table is kept at most 7/8 full (so a probe always ends at an empty slot)
+    static inline UInt32 map_slots_capacity(UInt32 num_slots) {
+        return num_slots - num_slots / 8;
+    }
+
+    static void* __map_alloc(Map* map, UInt64 size) {
+        void* ptr = SOME(map->arena) ? arena_alloc(map->arena, size) : malloc(size);
+        CORETEN_ENFORCE_NN(ptr, "Could not allocate memory. Memory full.");
+        return ptr;
+    }
+
+    static void __map_release(Map* map, void* ptr) {
+        if(NONE(map->arena))
+            free(ptr);
+    }
+
+    UInt32 map_hash_str(BuffView key) {
+        UInt64 hash = hash_murmur64(key.data, cast(Ll)key.len);
+        return cast(UInt32)(hash ^ (hash >> 32));
+    }
+
+    // The 64-bit finalizer of MurmurHash3 (every bit of `key` affects every bit of the hash)
+    UInt32 map_hash_int(UInt64 key) {
+        key ^= key >> 33;
+        key *= 0xFF51AFD7ED558CCDull;
+        key ^= key >> 33;
+        key *= 0xC4CEB9FE1A85EC53ull;
+        key ^= key >> 33;
+        return cast(UInt32)key;
+    }
+
+    // Set the control word of `slot` (and its copy, if it's in the first group)
+    static inline void __map_set_ctrl(Map* map, UInt32 slot, UInt8 ctrl) {
+        map->ctrl[slot] = ctrl;
+        if(slot < MAP_GROUP_WIDTH)
+            map->ctrl[map->num_slots + slot] = ctrl;
+    }
+
+    static inline bool __map_entry_eq(Map* map, MapEntry* entry, UInt32 hash, UInt64 num, BuffView* str) {
+        if(entry->hash != hash)
+            return false;
+        if(map->kind == MapKeyKindInt)
+            return entry->key.num == num;
+        return entry->key.str.len == str->len && memcmp(entry->key.str.data, str->data, str->len) == 0;
+    }
+
+    // Returns the slot of the key (`num` or `str`, depending on the kind of `map`), or UInt32_MAX.
+    // Groups are probed quadratically (the `i`th probe is `i * (i + 1) / 2` groups away), which visits every group
+    // of the table since the no. of slots is a power of 2
+    static UInt32 __map_lookup(Map* map, UInt32 hash, UInt64 num, BuffView* str) {
+        UInt32 mask = map->num_slots - 1;
+        UInt32 pos = hash & mask;
+        UInt8 h2 = MAP_H2(hash);
+        for(UInt32 stride = MAP_GROUP_WIDTH; ; stride += MAP_GROUP_WIDTH) {
+            for(UInt64 match = map_group_match(map->ctrl + pos, h2); match != 0; match &= match - 1) {
+                UInt32 slot = (pos + map_first_lane(match)) & mask;
+                if(__map_entry_eq(map, &map->entries[map->slots[slot]], hash, num, str))
+                    return slot;
+            }
+            if(CORETEN_LIKELY(map_group_empty(map->ctrl + pos) != 0))
+                return UInt32_MAX;
+            pos = (pos + stride) & mask;
+        }
+    }
+
+    // Returns the first empty or deleted slot in the probe sequence of `hash`
+    static UInt32 __map_find_free(Map* map, UInt32 hash) {
+        UInt32 mask = map->num_slots - 1;
+        UInt32 pos = hash & mask;
+        for(UInt32 stride = MAP_GROUP_WIDTH; ; stride += MAP_GROUP_WIDTH) {
+            UInt64 free_slots = map_group_free(map->ctrl + pos);
+            if(free_slots != 0)
+                return (pos + map_first_lane(free_slots)) & mask;
+            pos = (pos + stride) & mask;
+        }
+    }
+
+    static void __map_grow_entries(Map* map, UInt32 capacity) {
+        if(capacity <= map->cap_entries)
+            return;
+        MapEntry* entries = cast(MapEntry*)__map_alloc(map, cast(UInt64)capacity * sizeof(MapEntry));
+        if(map->num_entries > 0)
+            memcpy(entries, map->entries, map->num_entries * sizeof(MapEntry));
+        __map_release(map, map->entries);
+        map->entries = entries;
+        map->cap_entries = capacity;
+    }
+
+    // Rebuild the table, with room for (at least) `num` entries. Removed entries are dropped (the others keep their
+    // order)
+    static void __map_rehash(Map* map, UInt32 num) {
+        CORETEN_ENFORCE(num < UInt32_MAX / 2, "Too many entries");
+        UInt32 num_slots = MAP_GROUP_WIDTH * 2;
+        while(map_slots_capacity(num_slots) < num)
+            num_slots *= 2;
+
+        if(map->len < map->num_entries) {
+            UInt32 len = 0;
+            for(UInt32 i = 0; i < map->num_entries; i++) {
+                if(!map->entries[i].is_removed)
+                    map->entries[len++] = map->entries[i];
+            }
+            map->num_entries = len;
+        }
+
+        if(num_slots != map->num_slots) {
+            __map_release(map, map->ctrl);
+            __map_release(map, map->slots);
+            map->ctrl = cast(UInt8*)__map_alloc(map, num_slots + MAP_GROUP_WIDTH);
+            map->slots = cast(UInt32*)__map_alloc(map, cast(UInt64)num_slots * sizeof(UInt32));
+            map->num_slots = num_slots;
+        }
+        memset(map->ctrl, MAP_CTRL_EMPTY, num_slots + MAP_GROUP_WIDTH);
+        for(UInt32 i = 0; i < map->num_entries; i++) {
+            UInt32 hash = map->entries[i].hash;
+            UInt32 slot = __map_find_free(map, hash);
+            __map_set_ctrl(map, slot, MAP_H2(hash));
+            map->slots[slot] = i;
+        }
+        map->growth_left = map_slots_capacity(num_slots) - map->num_entries;
+    }
+
+    Map* map_new(MapKeyKind kind, UInt32 capacity, Arena* arena) {
+        Map* map = cast(Map*)(SOME(arena) ? arena_alloc(arena, sizeof(Map)) : malloc(sizeof(Map)));
+        CORETEN_ENFORCE_NN(map, "Could not allocate memory. Memory full.");
+        memset(map, 0, sizeof(Map));
+        map->kind = kind;
+        map->arena = arena;
+
+        __map_rehash(map, capacity);
+        __map_grow_entries(map, capacity > 0 ? capacity : MAP_GROUP_WIDTH);
+        return map;
+    }
+
+    void map_free(Map* map) {
+        if(NONE(map) || SOME(map->arena))
+            return;
+        free(map->ctrl);
+        free(map->slots);
+        free(map->entries);
+        free(map);
+    }
+
+    void map_reserve(Map* map, UInt32 num) {
+        // Slots held by removed entries can't be counted on (they're only reclaimed by a rehash)
+        if(num > map->len + map->growth_left)
+            __map_rehash(map, num);
+        __map_grow_entries(map, num);
+    }
+
+    void map_clear(Map* map) {
+        memset(map->ctrl, MAP_CTRL_EMPTY, map->num_slots + MAP_GROUP_WIDTH);
+        map->num_entries = 0;
+        map->len = 0;
+        map->growth_left = map_slots_capacity(map->num_slots);
+    }
+
+    UInt32 map_len(Map* map) {
+        return map->len;
+    }
+
+    static MapEntry* __map_find(Map* map, UInt32 hash, UInt64 num, BuffView* str) {
+        UInt32 slot = __map_lookup(map, hash, num, str);
+        return slot == UInt32_MAX ? null : &map->entries[map->slots[slot]];
+    }
+
+    static MapEntry* __map_insert(Map* map, UInt32 hash, UInt64 num, BuffView* str, bool* is_new) {
+        UInt32 slot = __map_lookup(map, hash, num, str);
+        if(SOME(is_new))
+            *is_new = slot == UInt32_MAX;
+        if(slot != UInt32_MAX)
+            return &map->entries[map->slots[slot]];
+
+        slot = __map_find_free(map, hash);
+        // Reusing a deleted slot doesn't use up an empty one
+        if(CORETEN_UNLIKELY(map->growth_left == 0 && map->ctrl[slot] == MAP_CTRL_EMPTY)) {
+            __map_rehash(map, map->len + 1);
+            slot = __map_find_free(map, hash);
+        }
+        if(CORETEN_UNLIKELY(map->num_entries == map->cap_entries))
+            __map_grow_entries(map, map->cap_entries + map->cap_entries / 2 + 1);
+
+        map->growth_left -= map->ctrl[slot] == MAP_CTRL_EMPTY;
+        __map_set_ctrl(map, slot, MAP_H2(hash));
+        map->slots[slot] = map->num_entries;
+
+        MapEntry* entry = &map->entries[map->num_entries++];
+        if(map->kind == MapKeyKindInt)
+            entry->key.num = num;
+        else
+            entry->key.str = *str;
+        entry->value = null;
+        entry->hash = hash;
+        entry->is_removed = false;
+        ++map->len;
+        return entry;
+    }
+
+    static bool __map_remove(Map* map, UInt32 hash, UInt64 num, BuffView* str) {
+        UInt32 slot = __map_lookup(map, hash, num, str);
+        if(slot == UInt32_MAX)
+            return false;
+        map->entries[map->slots[slot]].is_removed = true;
+        __map_set_ctrl(map, slot, MAP_CTRL_DELETED);
+        --map->len;
+        return true;
+    }
+
+    MapEntry* map_find_str(Map* map, BuffView key) {
+        CORETEN_DEBUG_ENFORCE(map->kind == MapKeyKindStr, "Expected a map keyed by strings");
+        return __map_find(map, map_hash_str(key), 0, &key);
+    }
+
+    MapEntry* map_find_int(Map* map, UInt64 key) {
+        CORETEN_DEBUG_ENFORCE(map->kind == MapKeyKindInt, "Expected a map keyed by integers");
+        return __map_find(map, map_hash_int(key), key, null);
+    }
+
+    MapEntry* map_insert_str(Map* map, BuffView key, bool* is_new) {
+        CORETEN_DEBUG_ENFORCE(map->kind == MapKeyKindStr, "Expected a map keyed by strings");
+        return __map_insert(map, map_hash_str(key), 0, &key, is_new);
+    }
+
+    MapEntry* map_insert_int(Map* map, UInt64 key, bool* is_new) {
+        CORETEN_DEBUG_ENFORCE(map->kind == MapKeyKindInt, "Expected a map keyed by integers");
+        return __map_insert(map, map_hash_int(key), key, null, is_new);
+    }
+
+    MapEntry* map_put_str(Map* map, BuffView key, void* value) {
+        MapEntry* entry = map_insert_str(map, key, null);
+        entry->value = value;
+        return entry;
+    }
+
+    MapEntry* map_put_int(Map* map, UInt64 key, void* value) {
+        MapEntry* entry = map_insert_int(map, key, null);
+        entry->value = value;
+        return entry;
+    }
+
+    bool map_remove_str(Map* map, BuffView key) {
+        CORETEN_DEBUG_ENFORCE(map->kind == MapKeyKindStr, "Expected a map keyed by strings");
+        return __map_remove(map, map_hash_str(key), 0, &key);
+    }
+
+    bool map_remove_int(Map* map, UInt64 key) {
+        CORETEN_DEBUG_ENFORCE(map->kind == MapKeyKindInt, "Expected a map keyed by integers");
+        return __map_remove(map, map_hash_int(key), key, null);
+    }
+
+    MapEntry* map_next(Map* map, UInt32* iter) {
+        while(*iter < map->num_entries) {
+            MapEntry* entry = &map->entries[(*iter)++];
+            if(!entry->is_removed)
+                return entry;
+        }
+        return null;
+    }
+
+    MapEntry* map_at(Map* map, UInt32 index) {
+        CORETEN_DEBUG_ENFORCE(index < map->num_entries, "Out of bounds");
+        return &map->entries[index];
+    }
+
+#endif // CORETEN_IMPL
+
+#endif // CORETEN_MAP_H
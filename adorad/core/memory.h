@@ -14,6 +14,11 @@ Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
 #ifndef CORETEN_MEMORY_H
 #define CORETEN_MEMORY_H
 
+#include <stdatomic.h>
+
+#include <adorad/core/types.h>
+#include <adorad/core/misc.h>
+
 #ifndef KB_TO_BYTES
     #define KB_TO_BYTES(x)               (x) * (Int64)(1024)
     #define MB_TO_BYTES(x)    KB_TO_BYTES(x) * (Int64)(1024)
@@ -25,4 +30,299 @@ Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
 #define CORETEN_HIGHS           CORETEN_ONES * (UInt8_MAX/2+1)
 #define CORETEN_HAS_ZERO(x)     (x)-CORETEN_ONES & ~(x) & CORETEN_HIGHS
 
+/*
+    Allocators
+    An `Allocator` is where a container (a `Vec`, a `Buff`, an `Arena`'s blocks, ...) gets its memory from. It's a 
+    single function that allocates, resizes and frees - which, given the size of the block every time, is all an arena
+    or a tracking wrapper needs. A null `Allocator*` is the heap (malloc/free), and takes no indirect call.
+
+    Allocations that fail are fatal (like every other allocation in the codebase): the `allocator_*()` functions 
+    never return null.
+*/
+typedef struct Allocator Allocator;
+// Allocate, resize or free a block, as `realloc()` would:
+//      ptr == null         allocate `new_size` bytes
+//      new_size == 0       free `ptr` (a block of `old_size` bytes), and return null
+//      otherwise           resize `ptr` from `old_size` to `new_size` bytes (moving it if need be)
+// Returns null if out of memory.
+typedef void* (*AllocatorFunc)(Allocator* allocator, void* ptr, UInt64 old_size, UInt64 new_size);
+
+struct Allocator {
+    AllocatorFunc func;
+};
+
+// Allocate `size` bytes (uninitialized) from `allocator` (the heap, if null)
+void* allocator_alloc(Allocator* allocator, UInt64 size);
+// Allocate `size` bytes (zeroed) from `allocator`
+void* allocator_calloc(Allocator* allocator, UInt64 size);
+// Resize a block of `old_size` bytes to `new_size` (> 0) bytes
+void* allocator_realloc(Allocator* allocator, void* ptr, UInt64 old_size, UInt64 new_size);
+// Free a block of `size` bytes (that came from `allocator`). `ptr` may be null
+void allocator_free(Allocator* allocator, void* ptr, UInt64 size);
+
+/*
+    Tracking allocator
+    Forwards to another allocator (its `parent`), and counts what goes through it: live bytes, the peak number of live
+    bytes, and the allocations made and freed. Give each subsystem (eg. tokens, the AST) its own to find out where the
+    memory goes. The counters are atomic, so a TrackingAllocator can be shared by threads - at the cost of a contended
+    cache line, so only track when asked to.
+*/
+typedef struct TrackingAllocator {
+    Allocator allocator;        // use `&tracker->allocator` wherever an `Allocator*` is expected
+    Allocator* parent;          // where the memory comes from (the heap, if null)
+    const char* name;           // eg. the subsystem being tracked
+    _Atomic UInt64 live_bytes;  // no. of bytes allocated, and not yet freed
+    _Atomic UInt64 peak_bytes;  // highest `live_bytes` has been
+    _Atomic UInt64 total_bytes; // no. of bytes ever allocated (resizes count their growth)
+    _Atomic UInt64 num_allocs;  // no. of blocks allocated (or resized)
+    _Atomic UInt64 num_frees;   // no. of blocks freed
+} TrackingAllocator;
+
+void tracking_allocator_init(TrackingAllocator* tracker, const char* name, Allocator* parent);
+
+/*
+    Arena (bump) allocator
+    Memory is handed out from large blocks by bumping a pointer, and is only ever released all at once (with
+    `arena_reset()` or `arena_free()`). This is meant for lots of small objects that share a lifetime - eg. the nodes
+    of an AST.
+*/
+// Default size of a block of the arena
+#define ARENA_DEFAULT_BLOCK_SIZE    (64 * 1024)
+// Alignment of an allocation, unless asked otherwise (enough for any scalar type)
+#define ARENA_ALIGNMENT             16
+
+typedef struct ArenaBlock ArenaBlock;
+struct ArenaBlock {
+    ArenaBlock* next;   // the previously filled block
+    UInt64 used;        // no. of bytes handed out from this block
+    UInt64 cap;         // size of `data` (in bytes)
+    // The block's memory follows (aligned on `ARENA_ALIGNMENT`)
+};
+
+typedef struct Arena {
+    Allocator allocator;// the Arena as an `Allocator` (see `arena_allocator()`)
+    Allocator* backing; // where the blocks come from (the heap, if null)
+    ArenaBlock* head;   // the block being filled
+    UInt64 block_size;  // size of a new block (larger allocations get a block of their own)
+    UInt64 allocated;   // no. of bytes handed out so far
+    UInt64 num_allocs;  // no. of allocations made so far
+} Arena;
+
+// Create a new Arena. If `block_size` is 0, `ARENA_DEFAULT_BLOCK_SIZE` is used
+Arena* arena_new(UInt64 block_size);
+// Same as `arena_new()`, except that the Arena (and its blocks) are allocated from `backing`
+Arena* arena_new_with(UInt64 block_size, Allocator* backing);
+// Returns `arena` as an `Allocator`. Frees are ignored, and resizes always move the block (unless it shrinks) - 
+// nothing is released until the Arena is reset
+Allocator* arena_allocator(Arena* arena);
+// Allocate `size` bytes (uninitialized) from `arena`
+void* arena_alloc(Arena* arena, UInt64 size);
+// Same as `arena_alloc()`, with an alignment of `align` (a power of 2, at most `ARENA_ALIGNMENT`) bytes
+void* arena_alloc_aligned(Arena* arena, UInt64 size, UInt64 align);
+// Allocate `size` bytes (zeroed) from `arena`
+void* arena_calloc(Arena* arena, UInt64 size);
+// Release everything allocated from `arena` (keeping one block around for reuse)
+void arena_reset(Arena* arena);
+// Free `arena` and everything allocated from it
+void arena_free(Arena* arena);
+
+#define ARENA_NEW(arena, strct)     cast(strct*)arena_calloc((arena), sizeof(strct))
+
+#ifdef CORETEN_IMPL
+    #include <stdlib.h>
+    #include <string.h>
+    #include <adorad/core/debug.h>
+
+    void* allocator_alloc(Allocator* allocator, UInt64 size) {
+        void* ptr = NONE(allocator) ? malloc(size > 0 ? size : 1) : allocator->func(allocator, null, 0, size);
+        CORETEN_ENFORCE_NN(ptr, "Could not allocate memory. Memory full.");
+        return ptr;
+    }
+
+    void* allocator_calloc(Allocator* allocator, UInt64 size) {
+        if(NONE(allocator)) {
+            void* ptr = calloc(1, size > 0 ? size : 1);
+            CORETEN_ENFORCE_NN(ptr, "Could not allocate memory. Memory full.");
+            return ptr;
+        }
+        void* ptr = allocator_alloc(allocator, size);
+        memset(ptr, 0, size);
+        return ptr;
+    }
+
+    void* allocator_realloc(Allocator* allocator, void* ptr, UInt64 old_size, UInt64 new_size) {
+        CORETEN_ENFORCE(new_size > 0, "Use `allocator_free()` to free a block");
+        void* newptr = NONE(allocator) ? realloc(ptr, new_size) : allocator->func(allocator, ptr, old_size, new_size);
+        CORETEN_ENFORCE_NN(newptr, "Could not allocate memory. Memory full.");
+        return newptr;
+    }
+
+    void allocator_free(Allocator* allocator, void* ptr, UInt64 size) {
+        if(NONE(ptr))
+            return;
+        if(NONE(allocator))
+            free(ptr);
+        else
+            allocator->func(allocator, ptr, size, 0);
+    }
+
+    static void* __tracking_allocator_func(Allocator* allocator, void* ptr, UInt64 old_size, UInt64 new_size) {
+        TrackingAllocator* tracker = cast(TrackingAllocator*)allocator;
+        void* newptr;
+        if(new_size == 0) {
+            allocator_free(tracker->parent, ptr, old_size);
+            atomic_fetch_sub_explicit(&tracker->live_bytes, old_size, memory_order_relaxed);
+            atomic_fetch_add_explicit(&tracker->num_frees, 1, memory_order_relaxed);
+            return null;
+        }
+
+        if(NONE(ptr))
+            newptr = allocator_alloc(tracker->parent, new_size);
+        else
+            newptr = allocator_realloc(tracker->parent, ptr, old_size, new_size);
+        atomic_fetch_add_explicit(&tracker->num_allocs, 1, memory_order_relaxed);
+        if(new_size < old_size) {
+            atomic_fetch_sub_explicit(&tracker->live_bytes, old_size - new_size, memory_order_relaxed);
+            return newptr;
+        }
+
+        UInt64 grown = new_size - old_size;
+        atomic_fetch_add_explicit(&tracker->total_bytes, grown, memory_order_relaxed);
+        UInt64 live = atomic_fetch_add_explicit(&tracker->live_bytes, grown, memory_order_relaxed) + grown;
+        UInt64 peak = atomic_load_explicit(&tracker->peak_bytes, memory_order_relaxed);
+        while(live > peak && 
+              !atomic_compare_exchange_weak_explicit(&tracker->peak_bytes, &peak, live, memory_order_relaxed, 
+                                                     memory_order_relaxed)) {}
+        return newptr;
+    }
+
+    void tracking_allocator_init(TrackingAllocator* tracker, const char* name, Allocator* parent) {
+        tracker->allocator.func = __tracking_allocator_func;
+        tracker->parent = parent;
+        tracker->name = name;
+        atomic_init(&tracker->live_bytes, 0);
+        atomic_init(&tracker->peak_bytes, 0);
+        atomic_init(&tracker->total_bytes, 0);
+        atomic_init(&tracker->num_allocs, 0);
+        atomic_init(&tracker->num_frees, 0);
+    }
+
+    #define __ARENA_HEADER_SIZE     ((sizeof(ArenaBlock) + ARENA_ALIGNMENT - 1) & ~cast(UInt64)(ARENA_ALIGNMENT - 1))
+    #define __ARENA_BLOCK_DATA(b)   (cast(char*)(b) + __ARENA_HEADER_SIZE)
+
+    static void* __arena_allocator_func(Allocator* allocator, void* ptr, UInt64 old_size, UInt64 new_size) {
+        if(new_size == 0)
+            return null;
+        if(SOME(ptr) && new_size <= old_size)
+            return ptr;
+        void* newptr = arena_alloc(cast(Arena*)allocator, new_size);
+        if(SOME(ptr))
+            memcpy(newptr, ptr, old_size);
+        return newptr;
+    }
+
+    Arena* arena_new_with(UInt64 block_size, Allocator* backing) {
+        Arena* arena = cast(Arena*)allocator_alloc(backing, sizeof(Arena));
+
+        arena->allocator.func = __arena_allocator_func;
+        arena->backing = backing;
+        arena->head = null;
+        arena->block_size = block_size > 0 ? block_size : ARENA_DEFAULT_BLOCK_SIZE;
+        arena->allocated = 0;
+        arena->num_allocs = 0;
+        return arena;
+    }
+
+    Arena* arena_new(UInt64 block_size) {
+        return arena_new_with(block_size, null);
+    }
+
+    Allocator* arena_allocator(Arena* arena) {
+        return &arena->allocator;
+    }
+
+    static ArenaBlock* __arena_new_block(Arena* arena, UInt64 cap) {
+        ArenaBlock* block = cast(ArenaBlock*)allocator_alloc(arena->backing, __ARENA_HEADER_SIZE + cap);
+        block->next = null;
+        block->used = 0;
+        block->cap = cap;
+        return block;
+    }
+
+    void* arena_alloc_aligned(Arena* arena, UInt64 size, UInt64 align) {
+        CORETEN_ENFORCE(align > 0 && align <= ARENA_ALIGNMENT && (align & (align - 1)) == 0, "Invalid alignment");
+        ArenaBlock* block = arena->head;
+        UInt64 begin = SOME(block) ? (block->used + align - 1) & ~(align - 1) : 0;
+        if(CORETEN_UNLIKELY(NONE(block) || begin + size > block->cap)) {
+            if(size > arena->block_size / 4) {
+                // A large allocation gets a block of its own (behind the current one, which keeps being filled)
+                ArenaBlock* large = __arena_new_block(arena, size);
+                large->used = size;
+                if(SOME(block)) {
+                    large->next = block->next;
+                    block->next = large;
+                } else {
+                    arena->head = large;
+                }
+                arena->allocated += size;
+                ++arena->num_allocs;
+                return __ARENA_BLOCK_DATA(large);
+            }
+
+            block = __arena_new_block(arena, arena->block_size);
+            block->next = arena->head;
+            arena->head = block;
+            begin = 0;
+        }
+
+        block->used = begin + size;
+        arena->allocated += size;
+        ++arena->num_allocs;
+        return __ARENA_BLOCK_DATA(block) + begin;
+    }
+
+    void* arena_alloc(Arena* arena, UInt64 size) {
+        return arena_alloc_aligned(arena, size, ARENA_ALIGNMENT);
+    }
+
+    void* arena_calloc(Arena* arena, UInt64 size) {
+        void* ptr = arena_alloc(arena, size);
+        memset(ptr, 0, size);
+        return ptr;
+    }
+
+    void arena_reset(Arena* arena) {
+        // Keep the block being filled (unless it's a large one), and free the rest
+        ArenaBlock* keep = arena->head;
+        ArenaBlock* block = null;
+        if(SOME(keep)) {
+            block = keep->next;
+            if(keep->cap != arena->block_size) {
+                block = keep;
+                keep = null;
+            } else {
+                keep->next = null;
+                keep->used = 0;
+            }
+        }
+        while(SOME(block)) {
+            ArenaBlock* next = block->next;
+            allocator_free(arena->backing, block, __ARENA_HEADER_SIZE + block->cap);
+            block = next;
+        }
+        arena->head = keep;
+        arena->allocated = 0;
+        arena->num_allocs = 0;
+    }
+
+    void arena_free(Arena* arena) {
+        if(SOME(arena)) {
+            arena_reset(arena);
+            if(SOME(arena->head))
+                allocator_free(arena->backing, arena->head, __ARENA_HEADER_SIZE + arena->head->cap);
+            allocator_free(arena->backing, arena, sizeof(Arena));
+        }
+    }
+#endif // CORETEN_IMPL
+
 #endif // CORETEN_MEMORY_H
\ No newline at end of file
@@ -0,0 +1,571 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#ifndef CORETEN_SERIAL_H
+#define CORETEN_SERIAL_H
+
+#include <string.h>
+
+#include <adorad/core/types.h>
+#include <adorad/core/misc.h>
+#include <adorad/core/endian.h>
+#include <adorad/core/memory.h>
+#include <adorad/core/buffer.h>
+#include <adorad/core/vector.h>
+#include <adorad/core/map.h>
+#include <adorad/core/hash.h>
+
+/*
+    Binary serialization
+    A `SerialWriter` appends fields to a buffer, which is either the output itself (memory mode) or flushed to a file
+    descriptor whenever it fills up - one syscall per `SERIAL_BUFFER_SIZE` bytes, not per field. A `SerialReader` reads
+    them back, from a block of memory (which isn't copied) or from a file descriptor, through a buffer of the same size.
+
+    Encodings (whatever the host's byte order):
+        u8/u16/u32/u64/f64  fixed-width, little-endian
+        uleb/sleb           (U/S)LEB128 varints: 7 bits per byte, low bits first - 1 byte for values under 128
+        str                 a reference into the string table: `index << 1` if the string was written before, or
+                            `len << 1 | 1` followed by its bytes the first time (which adds it to the table). The
+                            table is built as the stream is read, so it never needs to be written on its own.
+    Both ends keep a CRC32C (see `hash_crc32c()`) of the bytes written or read so far, to checksum (a part of) a
+    stream - eg. write `serial_writer_checksum()` as the last field, and compare it to `serial_reader_checksum()`
+    before reading it.
+
+    Errors are sticky: a failed write (or a read past the end, or of a malformed field) sets `has_error`, after which
+    writes are dropped and reads return 0 (or empty strings). Check it once, at the end.
+*/
+
+// Size of the buffer of a SerialWriter (or SerialReader) over a file descriptor
+#define SERIAL_BUFFER_SIZE      (64 * 1024)
+// Longest encoding of a 64-bit varint
+#define SERIAL_MAX_VARINT_LEN   10
+
+typedef struct SerialWriter {
+    char* data;         // the buffer (in memory mode, everything written so far)
+    UInt64 len;         // no. of bytes in `data`
+    UInt64 cap;
+    int fd;             // file descriptor written to, or -1 in memory mode
+    UInt64 num_flushed; // no. of bytes written to `fd` so far
+    UInt64 crc_len;     // no. of bytes of `data` already in `crc`
+    UInt32 crc;
+    bool has_error;
+    Map* strings;       // the string table: string -> 1 + its index (made on first use)
+    Arena* arena;       // copies of the strings in the table
+    UInt32 num_strings;
+} SerialWriter;
+
+typedef struct SerialReader {
+    const char* data;   // the block being read (in fd mode, `buffer`)
+    UInt64 pos;         // offset of the next byte in `data`
+    UInt64 len;         // no. of bytes in `data`
+    int fd;             // file descriptor read from, or -1 in memory mode
+    char* buffer;       // (fd mode)
+    UInt64 num_consumed;// no. of bytes dropped from the front of `buffer` so far (fd mode)
+    UInt64 crc_pos;     // offset in `data` up to which bytes are in `crc`
+    UInt32 crc;
+    bool has_error;
+    Vec* strings;       // the string table, as `BuffView`s (made on first use)
+    Arena* arena;       // copies of the strings in the table (fd mode)
+} SerialReader;
+
+// Write into memory. `data` (and `len`) are the output; they're freed with the writer
+void serial_writer_init_memory(SerialWriter* writer, UInt64 capacity);
+// Write (buffered) to `fd`, which is not closed by the writer
+void serial_writer_init_fd(SerialWriter* writer, int fd);
+// Flush, and free the writer. Returns false if anything couldn't be written
+bool serial_writer_free(SerialWriter* writer);
+// Write out the buffer (in fd mode). Returns false if anything couldn't be written
+bool serial_writer_flush(SerialWriter* writer);
+// No. of bytes written so far
+UInt64 serial_writer_offset(SerialWriter* writer);
+// CRC32C of every byte written so far
+UInt32 serial_writer_checksum(SerialWriter* writer);
+void serial_write_bytes(SerialWriter* writer, const void* data, UInt64 len);
+void serial_write_str(SerialWriter* writer, const char* data, UInt64 len);
+// Make room for `len` more bytes in the buffer (flushing it, or growing it)
+void __serial_writer_make_room(SerialWriter* writer, UInt64 len);
+
+// Read `len` bytes of `data` (which must outlive the reader - strings read point into it)
+void serial_reader_init_memory(SerialReader* reader, const void* data, UInt64 len);
+// Read (buffered) from `fd`, which is not closed by the reader
+void serial_reader_init_fd(SerialReader* reader, int fd);
+void serial_reader_free(SerialReader* reader);
+// Returns true if everything has been read (and there was no error)
+bool serial_reader_is_done(SerialReader* reader);
+// No. of bytes read so far
+UInt64 serial_reader_offset(SerialReader* reader);
+// CRC32C of every byte read so far
+UInt32 serial_reader_checksum(SerialReader* reader);
+// Read `len` bytes into `dst`. Returns false (and zeroes `dst`) if there weren't enough
+bool serial_read_bytes(SerialReader* reader, void* dst, UInt64 len);
+// Read a string. The view is valid as long as the reader (or, in memory mode, its data) is
+BuffView serial_read_str(SerialReader* reader);
+UInt64 serial_read_uleb(SerialReader* reader);
+Int64 serial_read_sleb(SerialReader* reader);
+// Make `len` bytes available in the buffer (reading more). Returns null (and sets `has_error`) if there aren't enough
+const char* __serial_reader_fill(SerialReader* reader, UInt64 len);
+
+/*
+    Fixed-width fields and varints are written (and read) inline: a bounds check, and a store.
+*/
+
+static inline char* __serial_writer_room(SerialWriter* writer, UInt64 len) {
+    if(CORETEN_UNLIKELY(writer->cap - writer->len < len))
+        __serial_writer_make_room(writer, len);
+    char* at = writer->data + writer->len;
+    writer->len += len;
+    return at;
+}
+
+static inline void __serial_store16(char* at, UInt16 value) {
+#if NATIVE_IS_BIG_ENDIAN
+    at[0] = cast(char)value;
+    at[1] = cast(char)(value >> 8);
+#else
+    memcpy(at, &value, sizeof(value));
+#endif // NATIVE_IS_BIG_ENDIAN
+}
+
+static inline void __serial_store32(char* at, UInt32 value) {
+#if NATIVE_IS_BIG_ENDIAN
+    for(UInt32 i = 0; i < 4; i++)
+        at[i] = cast(char)(value >> (8 * i));
+#else
+    memcpy(at, &value, sizeof(value));
+#endif // NATIVE_IS_BIG_ENDIAN
+}
+
+static inline void __serial_store64(char* at, UInt64 value) {
+#if NATIVE_IS_BIG_ENDIAN
+    for(UInt32 i = 0; i < 8; i++)
+        at[i] = cast(char)(value >> (8 * i));
+#else
+    memcpy(at, &value, sizeof(value));
+#endif // NATIVE_IS_BIG_ENDIAN
+}
+
+static inline UInt16 __serial_load16(const char* at) {
+    const UInt8* bytes = cast(const UInt8*)at;
+    return cast(UInt16)(bytes[0] | (bytes[1] << 8));
+}
+
+static inline UInt32 __serial_load32(const char* at) {
+#if NATIVE_IS_BIG_ENDIAN
+    const UInt8* bytes = cast(const UInt8*)at;
+    return cast(UInt32)bytes[0] | (cast(UInt32)bytes[1] << 8) | (cast(UInt32)bytes[2] << 16) |
+           (cast(UInt32)bytes[3] << 24);
+#else
+    UInt32 value;
+    memcpy(&value, at, sizeof(value));
+    return value;
+#endif // NATIVE_IS_BIG_ENDIAN
+}
+
+static inline UInt64 __serial_load64(const char* at) {
+#if NATIVE_IS_BIG_ENDIAN
+    return cast(UInt64)__serial_load32(at) | (cast(UInt64)__serial_load32(at + 4) << 32);
+#else
+    UInt64 value;
+    memcpy(&value, at, sizeof(value));
+    return value;
+#endif // NATIVE_IS_BIG_ENDIAN
+}
+
+static inline void serial_write_u8(SerialWriter* writer, UInt8 value) {
+    *__serial_writer_room(writer, 1) = cast(char)value;
+}
+
+static inline void serial_write_u16(SerialWriter* writer, UInt16 value) {
+    __serial_store16(__serial_writer_room(writer, 2), value);
+}
+
+static inline void serial_write_u32(SerialWriter* writer, UInt32 value) {
+    __serial_store32(__serial_writer_room(writer, 4), value);
+}
+
+static inline void serial_write_u64(SerialWriter* writer, UInt64 value) {
+    __serial_store64(__serial_writer_room(writer, 8), value);
+}
+
+static inline void serial_write_f64(SerialWriter* writer, double value) {
+    UInt64 bits;
+    memcpy(&bits, &value, sizeof(bits));
+    serial_write_u64(writer, bits);
+}
+
+static inline void serial_write_uleb(SerialWriter* writer, UInt64 value) {
+    char* at = __serial_writer_room(writer, SERIAL_MAX_VARINT_LEN);
+    UInt32 len = 0;
+    while(value >= 0x80) {
+        at[len++] = cast(char)(value | 0x80);
+        value >>= 7;
+    }
+    at[len++] = cast(char)value;
+    writer->len -= SERIAL_MAX_VARINT_LEN - len;
+}
+
+static inline void serial_write_sleb(SerialWriter* writer, Int64 value) {
+    char* at = __serial_writer_room(writer, SERIAL_MAX_VARINT_LEN);
+    UInt32 len = 0;
+    for(;;) {
+        UInt8 byte = cast(UInt8)(value & 0x7F);
+        value >>= 7;    // arithmetic
+        if((value == 0 && !(byte & 0x40)) || (value == -1 && (byte & 0x40))) {
+            at[len++] = cast(char)byte;
+            break;
+        }
+        at[len++] = cast(char)(byte | 0x80);
+    }
+    writer->len -= SERIAL_MAX_VARINT_LEN - len;
+}
+
+static inline const char* __serial_reader_take(SerialReader* reader, UInt64 len) {
+    if(CORETEN_UNLIKELY(reader->len - reader->pos < len))
+        return __serial_reader_fill(reader, len);
+    const char* at = reader->data + reader->pos;
+    reader->pos += len;
+    return at;
+}
+
+static inline UInt8 serial_read_u8(SerialReader* reader) {
+    const char* at = __serial_reader_take(reader, 1);
+    return SOME(at) ? cast(UInt8)*at : 0;
+}
+
+static inline UInt16 serial_read_u16(SerialReader* reader) {
+    const char* at = __serial_reader_take(reader, 2);
+    return SOME(at) ? __serial_load16(at) : 0;
+}
+
+static inline UInt32 serial_read_u32(SerialReader* reader) {
+    const char* at = __serial_reader_take(reader, 4);
+    return SOME(at) ? __serial_load32(at) : 0;
+}
+
+static inline UInt64 serial_read_u64(SerialReader* reader) {
+    const char* at = __serial_reader_take(reader, 8);
+    return SOME(at) ? __serial_load64(at) : 0;
+}
+
+static inline double serial_read_f64(SerialReader* reader) {
+    UInt64 bits = serial_read_u64(reader);
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+#ifdef CORETEN_IMPL
+    #include <stdlib.h>
+    #include <adorad/core/debug.h>
+    #include <adorad/core/os_defs.h>
+
+    #if defined(CORETEN_OS_WINDOWS)
+        #include <io.h>
+        #define __serial_sys_write(fd, data, len)   _write((fd), (data), cast(unsigned int)(len))
+        #define __serial_sys_read(fd, data, len)    _read((fd), (data), cast(unsigned int)(len))
+    #else
+        #include <unistd.h>
+        #define __serial_sys_write(fd, data, len)   write((fd), (data), cast(size_t)(len))
+        #define __serial_sys_read(fd, data, len)    read((fd), (data), cast(size_t)(len))
+    #endif // CORETEN_OS_WINDOWS
+
+    // The most a single `read()` or `write()` is asked to move
+    #define __SERIAL_MAX_IO     (1u << 30)
+
+    static void __serial_writer_init(SerialWriter* writer, UInt64 capacity, int fd) {
+        memset(writer, 0, sizeof(SerialWriter));
+        writer->cap = capacity > SERIAL_MAX_VARINT_LEN ? capacity : SERIAL_MAX_VARINT_LEN;
+        writer->data = cast(char*)malloc(writer->cap);
+        CORETEN_ENFORCE_NN(writer->data, "Could not allocate memory. Memory full.");
+        writer->fd = fd;
+    }
+
+    void serial_writer_init_memory(SerialWriter* writer, UInt64 capacity) {
+        __serial_writer_init(writer, capacity, -1);
+    }
+
+    void serial_writer_init_fd(SerialWriter* writer, int fd) {
+        __serial_writer_init(writer, SERIAL_BUFFER_SIZE, fd);
+    }
+
+    // Write `len` bytes to the file descriptor (retrying short writes)
+    static void __serial_writer_write_fd(SerialWriter* writer, const char* data, UInt64 len) {
+        while(len > 0 && !writer->has_error) {
+            UInt64 chunk = len < __SERIAL_MAX_IO ? len : __SERIAL_MAX_IO;
+            Int64 written = cast(Int64)__serial_sys_write(writer->fd, data, chunk);
+            if(written <= 0) {
+                writer->has_error = true;
+                break;
+            }
+            data += written;
+            len -= cast(UInt64)written;
+            writer->num_flushed += cast(UInt64)written;
+        }
+    }
+
+    // Bring `crc` up to date with every byte of the buffer
+    static void __serial_writer_update_crc(SerialWriter* writer) {
+        writer->crc = hash_crc32c_update(writer->crc, writer->data + writer->crc_len,
+                                         cast(Ll)(writer->len - writer->crc_len));
+        writer->crc_len = writer->len;
+    }
+
+    bool serial_writer_flush(SerialWriter* writer) {
+        if(writer->fd >= 0 && writer->len > 0) {
+            __serial_writer_update_crc(writer);
+            __serial_writer_write_fd(writer, writer->data, writer->len);
+            writer->len = 0;
+            writer->crc_len = 0;
+        }
+        return !writer->has_error;
+    }
+
+    void __serial_writer_make_room(SerialWriter* writer, UInt64 len) {
+        if(writer->fd >= 0) {
+            serial_writer_flush(writer);
+            if(len <= writer->cap)
+                return;
+        }
+        UInt64 cap = writer->cap * 2;
+        while(cap - writer->len < len)
+            cap *= 2;
+        writer->data = cast(char*)realloc(writer->data, cap);
+        CORETEN_ENFORCE_NN(writer->data, "Could not allocate memory. Memory full.");
+        writer->cap = cap;
+    }
+
+    bool serial_writer_free(SerialWriter* writer) {
+        bool is_ok = serial_writer_flush(writer);
+        free(writer->data);
+        map_free(writer->strings);
+        arena_free(writer->arena);
+        memset(writer, 0, sizeof(SerialWriter));
+        writer->fd = -1;
+        return is_ok;
+    }
+
+    UInt64 serial_writer_offset(SerialWriter* writer) {
+        return writer->num_flushed + writer->len;
+    }
+
+    UInt32 serial_writer_checksum(SerialWriter* writer) {
+        __serial_writer_update_crc(writer);
+        return writer->crc;
+    }
+
+    void serial_write_bytes(SerialWriter* writer, const void* data, UInt64 len) {
+        if(writer->fd >= 0 && len >= writer->cap) {
+            // Too large to be worth buffering: write it out directly
+            serial_writer_flush(writer);
+            writer->crc = hash_crc32c_update(writer->crc, data, cast(Ll)len);
+            __serial_writer_write_fd(writer, cast(const char*)data, len);
+            return;
+        }
+        if(len > 0)
+            memcpy(__serial_writer_room(writer, len), data, len);
+    }
+
+    void serial_write_str(SerialWriter* writer, const char* data, UInt64 len) {
+        if(NONE(writer->strings)) {
+            writer->strings = map_new(MapKeyKindStr, 0, null);
+            writer->arena = arena_new(0);
+        }
+        bool is_new;
+        MapEntry* entry = map_insert_str(writer->strings, buffview_new_from_len(cast(char*)data, len), &is_new);
+        if(!is_new) {
+            serial_write_uleb(writer, (cast(UInt64)entry->value - 1) << 1);
+            return;
+        }
+
+        // The key must outlive the entry: point it at a copy
+        char* copy = cast(char*)arena_alloc_aligned(writer->arena, len > 0 ? len : 1, 1);
+        if(len > 0)
+            memcpy(copy, data, len);
+        entry->key.str.data = copy;
+        entry->value = cast(void*)(cast(UInt64)++writer->num_strings);
+        serial_write_uleb(writer, (len << 1) | 1);
+        serial_write_bytes(writer, data, len);
+    }
+
+    static void __serial_reader_init(SerialReader* reader, const void* data, UInt64 len, int fd) {
+        memset(reader, 0, sizeof(SerialReader));
+        reader->data = cast(const char*)data;
+        reader->len = len;
+        reader->fd = fd;
+    }
+
+    void serial_reader_init_memory(SerialReader* reader, const void* data, UInt64 len) {
+        __serial_reader_init(reader, data, len, -1);
+    }
+
+    void serial_reader_init_fd(SerialReader* reader, int fd) {
+        __serial_reader_init(reader, null, 0, fd);
+        reader->buffer = cast(char*)malloc(SERIAL_BUFFER_SIZE);
+        CORETEN_ENFORCE_NN(reader->buffer, "Could not allocate memory. Memory full.");
+        reader->data = reader->buffer;
+    }
+
+    void serial_reader_free(SerialReader* reader) {
+        free(reader->buffer);
+        vec_free(reader->strings);
+        arena_free(reader->arena);
+        memset(reader, 0, sizeof(SerialReader));
+        reader->fd = -1;
+    }
+
+    static void __serial_reader_update_crc(SerialReader* reader) {
+        reader->crc = hash_crc32c_update(reader->crc, reader->data + reader->crc_pos,
+                                         cast(Ll)(reader->pos - reader->crc_pos));
+        reader->crc_pos = reader->pos;
+    }
+
+    // Move the unread bytes to the front of the buffer, and read until there are (at least) `len` of them, or the end
+    // of the file. Returns the no. of bytes available
+    static UInt64 __serial_reader_read_fd(SerialReader* reader, UInt64 len) {
+        __serial_reader_update_crc(reader);
+        UInt64 left = reader->len - reader->pos;
+        memmove(reader->buffer, reader->buffer + reader->pos, left);
+        reader->num_consumed += reader->pos;
+        reader->pos = 0;
+        reader->crc_pos = 0;
+        reader->len = left;
+        while(reader->len < len) {
+            Int64 num_read = cast(Int64)__serial_sys_read(reader->fd, reader->buffer + reader->len,
+                                                          SERIAL_BUFFER_SIZE - reader->len);
+            if(num_read <= 0)
+                break;
+            reader->len += cast(UInt64)num_read;
+        }
+        return reader->len;
+    }
+
+    // Set `has_error`, and skip what's left (so that every read from here on fails)
+    static void __serial_reader_fail(SerialReader* reader) {
+        reader->has_error = true;
+        reader->pos = reader->len;
+        reader->crc_pos = reader->len;
+    }
+
+    const char* __serial_reader_fill(SerialReader* reader, UInt64 len) {
+        if(!reader->has_error && reader->fd >= 0 && len <= SERIAL_BUFFER_SIZE &&
+           __serial_reader_read_fd(reader, len) >= len) {
+            const char* at = reader->data + reader->pos;
+            reader->pos += len;
+            return at;
+        }
+        __serial_reader_fail(reader);
+        return null;
+    }
+
+    bool serial_reader_is_done(SerialReader* reader) {
+        if(reader->has_error)
+            return false;
+        if(reader->pos < reader->len)
+            return false;
+        return reader->fd < 0 || __serial_reader_read_fd(reader, 1) == 0;
+    }
+
+    UInt64 serial_reader_offset(SerialReader* reader) {
+        return reader->num_consumed + reader->pos;
+    }
+
+    UInt32 serial_reader_checksum(SerialReader* reader) {
+        __serial_reader_update_crc(reader);
+        return reader->crc;
+    }
+
+    bool serial_read_bytes(SerialReader* reader, void* dst, UInt64 len) {
+        char* out = cast(char*)dst;
+        while(len > 0) {
+            UInt64 chunk = len < SERIAL_BUFFER_SIZE ? len : SERIAL_BUFFER_SIZE;
+            const char* at = __serial_reader_take(reader, chunk);
+            if(NONE(at)) {
+                memset(out, 0, len);
+                return false;
+            }
+            memcpy(out, at, chunk);
+            out += chunk;
+            len -= chunk;
+        }
+        return true;
+    }
+
+    UInt64 serial_read_uleb(SerialReader* reader) {
+        UInt64 value = 0;
+        for(UInt32 shift = 0; shift < 64; shift += 7) {
+            UInt8 byte = serial_read_u8(reader);
+            value |= cast(UInt64)(byte & 0x7F) << shift;
+            if(!(byte & 0x80))
+                return value;
+        }
+        // More than `SERIAL_MAX_VARINT_LEN` bytes
+        __serial_reader_fail(reader);
+        return 0;
+    }
+
+    Int64 serial_read_sleb(SerialReader* reader) {
+        UInt64 value = 0;
+        for(UInt32 shift = 0; shift < 64; shift += 7) {
+            UInt8 byte = serial_read_u8(reader);
+            value |= cast(UInt64)(byte & 0x7F) << shift;
+            if(!(byte & 0x80)) {
+                // Sign-extend
+                if(shift + 7 < 64 && (byte & 0x40))
+                    value |= ~cast(UInt64)0 << (shift + 7);
+                return cast(Int64)value;
+            }
+        }
+        __serial_reader_fail(reader);
+        return 0;
+    }
+
+    BuffView serial_read_str(SerialReader* reader) {
+        BuffView str = { null, 0 };
+        UInt64 tag = serial_read_uleb(reader);
+        if(reader->has_error)
+            return str;
+        if(NONE(reader->strings))
+            reader->strings = VEC_NEW(BuffView, 16);
+
+        if(!(tag & 1)) {
+            UInt64 index = tag >> 1;
+            if(index >= vec_size(reader->strings)) {
+                __serial_reader_fail(reader);
+                return str;
+            }
+            return *cast(BuffView*)vec_at(reader->strings, index);
+        }
+
+        str.len = tag >> 1;
+        if(reader->fd < 0) {
+            // Point into the data
+            str.data = cast(char*)__serial_reader_take(reader, str.len);
+        } else {
+            if(NONE(reader->arena))
+                reader->arena = arena_new(0);
+            str.data = cast(char*)arena_alloc_aligned(reader->arena, str.len + 1, 1);
+            if(serial_read_bytes(reader, str.data, str.len))
+                str.data[str.len] = nullchar;
+            else
+                str.data = null;
+        }
+        if(NONE(str.data)) {
+            str.len = 0;
+            return str;
+        }
+        vec_push(reader->strings, &str);
+        return str;
+    }
+#endif // CORETEN_IMPL
+
+#endif // CORETEN_SERIAL_H
@@ -0,0 +1,220 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+#ifndef CORETEN_THREAD_H
+#define CORETEN_THREAD_H
+
+#include <adorad/core/os_defs.h>
+#include <adorad/core/compilers.h>
+#include <adorad/core/headers.h>
+#include <adorad/core/types.h>
+
+#if !defined(CORETEN_OS_WINDOWS)
+    #include <pthread.h>
+#endif // CORETEN_OS_WINDOWS
+
+// Storage class of a variable with one instance per thread
+#if defined(CORETEN_COMPILER_MSVC)
+    #define CORETEN_THREAD_LOCAL    __declspec(thread)
+#else
+    #define CORETEN_THREAD_LOCAL    _Thread_local
+#endif // CORETEN_COMPILER_MSVC
+
+typedef void* (*ThreadProc)(void* arg);
+
+typedef struct Thread {
+#if defined(CORETEN_OS_WINDOWS)
+    HANDLE handle;
+#else
+    pthread_t handle;
+#endif // CORETEN_OS_WINDOWS
+    ThreadProc proc;
+    void* arg;
+    void* result;       // value returned by `proc` (once joined)
+} Thread;
+
+// Start a thread running `proc(arg)`. Returns false if the thread could not be created.
+bool thread_start(Thread* thread, ThreadProc proc, void* arg);
+// Wait for `thread` to finish, and return the value returned by its `proc`
+void* thread_join(Thread* thread);
+// Number of CPUs (logical cores) available. Always at least 1
+UInt32 thread_num_cpus();
+// Give up the rest of the calling thread's time slice
+void thread_yield();
+
+// A mutual exclusion lock (not recursive)
+typedef struct Mutex {
+#if defined(CORETEN_OS_WINDOWS)
+    SRWLOCK lock;
+#else
+    pthread_mutex_t lock;
+#endif // CORETEN_OS_WINDOWS
+} Mutex;
+
+// A condition variable, waited on with a (locked) Mutex. Waits may wake up spuriously
+typedef struct CondVar {
+#if defined(CORETEN_OS_WINDOWS)
+    CONDITION_VARIABLE cond;
+#else
+    pthread_cond_t cond;
+#endif // CORETEN_OS_WINDOWS
+} CondVar;
+
+void mutex_init(Mutex* mutex);
+void mutex_destroy(Mutex* mutex);
+void mutex_lock(Mutex* mutex);
+void mutex_unlock(Mutex* mutex);
+
+void condvar_init(CondVar* cond);
+void condvar_destroy(CondVar* cond);
+// Unlock `mutex`, wait for `cond` to be signalled, and lock `mutex` again
+void condvar_wait(CondVar* cond, Mutex* mutex);
+// Wake up (at least) one of the threads waiting on `cond`
+void condvar_signal(CondVar* cond);
+// Wake up every thread waiting on `cond`
+void condvar_broadcast(CondVar* cond);
+
+#ifdef CORETEN_IMPL
+    #include <adorad/core/misc.h>
+
+#if defined(CORETEN_OS_WINDOWS)
+    static DWORD WINAPI __thread_trampoline(LPVOID arg) {
+        Thread* thread = cast(Thread*)arg;
+        thread->result = thread->proc(thread->arg);
+        return 0;
+    }
+
+    bool thread_start(Thread* thread, ThreadProc proc, void* arg) {
+        thread->proc = proc;
+        thread->arg = arg;
+        thread->result = null;
+        thread->handle = CreateThread(null, 0, __thread_trampoline, thread, 0, null);
+        return SOME(thread->handle);
+    }
+
+    void* thread_join(Thread* thread) {
+        WaitForSingleObject(thread->handle, INFINITE);
+        CloseHandle(thread->handle);
+        return thread->result;
+    }
+
+    UInt32 thread_num_cpus() {
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return info.dwNumberOfProcessors > 0 ? cast(UInt32)info.dwNumberOfProcessors : 1;
+    }
+
+    void thread_yield() {
+        SwitchToThread();
+    }
+
+    void mutex_init(Mutex* mutex) {
+        InitializeSRWLock(&mutex->lock);
+    }
+
+    void mutex_destroy(Mutex* mutex) {
+        // SRW locks don't need to be destroyed
+        (void)mutex;
+    }
+
+    void mutex_lock(Mutex* mutex) {
+        AcquireSRWLockExclusive(&mutex->lock);
+    }
+
+    void mutex_unlock(Mutex* mutex) {
+        ReleaseSRWLockExclusive(&mutex->lock);
+    }
+
+    void condvar_init(CondVar* cond) {
+        InitializeConditionVariable(&cond->cond);
+    }
+
+    void condvar_destroy(CondVar* cond) {
+        (void)cond;
+    }
+
+    void condvar_wait(CondVar* cond, Mutex* mutex) {
+        SleepConditionVariableSRW(&cond->cond, &mutex->lock, INFINITE, 0);
+    }
+
+    void condvar_signal(CondVar* cond) {
+        WakeConditionVariable(&cond->cond);
+    }
+
+    void condvar_broadcast(CondVar* cond) {
+        WakeAllConditionVariable(&cond->cond);
+    }
+#else
+    #include <sched.h>
+    #include <unistd.h>
+
+    bool thread_start(Thread* thread, ThreadProc proc, void* arg) {
+        thread->proc = proc;
+        thread->arg = arg;
+        thread->result = null;
+        return pthread_create(&thread->handle, null, proc, arg) == 0;
+    }
+
+    void* thread_join(Thread* thread) {
+        pthread_join(thread->handle, &thread->result);
+        return thread->result;
+    }
+
+    UInt32 thread_num_cpus() {
+        long count = sysconf(_SC_NPROCESSORS_ONLN);
+        return count > 0 ? cast(UInt32)count : 1;
+    }
+
+    void thread_yield() {
+        sched_yield();
+    }
+
+    void mutex_init(Mutex* mutex) {
+        pthread_mutex_init(&mutex->lock, null);
+    }
+
+    void mutex_destroy(Mutex* mutex) {
+        pthread_mutex_destroy(&mutex->lock);
+    }
+
+    void mutex_lock(Mutex* mutex) {
+        pthread_mutex_lock(&mutex->lock);
+    }
+
+    void mutex_unlock(Mutex* mutex) {
+        pthread_mutex_unlock(&mutex->lock);
+    }
+
+    void condvar_init(CondVar* cond) {
+        pthread_cond_init(&cond->cond, null);
+    }
+
+    void condvar_destroy(CondVar* cond) {
+        pthread_cond_destroy(&cond->cond);
+    }
+
+    void condvar_wait(CondVar* cond, Mutex* mutex) {
+        pthread_cond_wait(&cond->cond, &mutex->lock);
+    }
+
+    void condvar_signal(CondVar* cond) {
+        pthread_cond_signal(&cond->cond);
+    }
+
+    void condvar_broadcast(CondVar* cond) {
+        pthread_cond_broadcast(&cond->cond);
+    }
+#endif // CORETEN_OS_WINDOWS
+#endif // CORETEN_IMPL
+
+#endif // CORETEN_THREAD_H
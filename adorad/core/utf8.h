@@ -60,6 +60,20 @@ char* utf8_encode(Rune value);
 Ll utf8_encode_nbytes(Rune value);
 Ll utf8_decode_nbytes(Rune byte);
 
+// Decode the UTF-8 sequence at the beginning of `data[0..len)` into `rune`.
+// Returns the length of the sequence (1-4 bytes), or 0 (leaving `rune` untouched) if it isn't a valid one: a stray
+// continuation byte, an overlong encoding, a surrogate, a code point past U+10FFFF or a truncated sequence.
+UInt32 utf8_decode(const char* data, UInt64 len, Rune* rune);
+// Returns the offset of the first non-ASCII byte (>= 0x80) in `data[0..len)`, or `len` if there is none.
+// Vectorized with AVX2 or SSE2 (x86) or NEON (ARM), 8 bytes at a time otherwise.
+UInt64 utf8_find_non_ascii(const char* data, UInt64 len);
+// Is all of `data[0..len)` ASCII?
+bool utf8_is_ascii(const char* data, UInt64 len);
+// Returns the offset of the first byte of `data[0..len)` that isn't part of a valid UTF-8 sequence (see
+// `utf8_decode()`), or `len` if all of it is valid. Runs of ASCII (the bulk of most text) are skipped over a vector
+// at a time, and only the rest is decoded.
+UInt64 utf8_validate(const char* data, UInt64 len);
+
 /*
     WIP
 */
@@ -185,7 +199,6 @@ typedef enum {
     UTF8_BOUNDCLASS_E_ZWG = 20, /* UTF8_BOUNDCLASS_EXTENDED_PICTOGRAPHIC + ZWJ */
 } cstlUTF8Boundclass;
 
-
 #ifdef CORETEN_IMPL
     #include <string.h>
     
@@ -273,9 +286,6 @@ typedef enum {
         #define UTF8_UINT16_MAX     65535U
     #endif // UTF8_UINT16_MAX
 
-    #include <adorad/core/utf8_data.h>
-    // #include <adorad/core/utf8_properties.h>
-
     const Rune codepoint_decoded_length[256] = {
         // Basic Latin
         1, 1, 1, 1, 1, 1, 1, 1, // 0x00 - 0x07
@@ -424,6 +434,128 @@ typedef enum {
         return dst;
     }
 
+    UInt32 utf8_decode(const char* data, UInt64 len, Rune* rune) {
+        const Byte* s = cast(const Byte*)data;
+        if(len == 0)
+            return 0;
+
+        Byte lead = s[0];
+        if(lead < 0x80) {
+            *rune = lead;
+            return 1;
+        }
+        // 0x80 - 0xBF are continuation bytes, and 0xC0 - 0xC1 can only begin an overlong encoding
+        if(lead < 0xC2 || lead > 0xF4)
+            return 0;
+
+        // The range of the second byte depends on the lead byte (see the grammar at the top of this file). This 
+        // rules out overlong encodings, surrogates and code points past U+10FFFF
+        UInt32 nbytes = lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4;
+        Byte lo = 0x80, hi = 0xBF;
+        switch(lead) {
+            case 0xE0: lo = 0xA0; break;
+            case 0xED: hi = 0x9F; break;
+            case 0xF0: lo = 0x90; break;
+            case 0xF4: hi = 0x8F; break;
+        }
+        if(len < nbytes || s[1] < lo || s[1] > hi)
+            return 0;
+
+        Rune value = lead & (0x7F >> nbytes);
+        value = (value << 6) | (s[1] & 0x3F);
+        for(UInt32 i = 2; i < nbytes; i++) {
+            if((s[i] & 0xC0) != 0x80)
+                return 0;
+            value = (value << 6) | (s[i] & 0x3F);
+        }
+        *rune = value;
+        return nbytes;
+    }
+
+    #if defined(CORETEN_SIMD_AVX2)
+        #include <immintrin.h>
+    #elif defined(CORETEN_SIMD_SSE2)
+        #include <emmintrin.h>
+    #elif defined(CORETEN_SIMD_NEON)
+        #include <arm_neon.h>
+    #endif // CORETEN_SIMD_AVX2
+
+    #if defined(CORETEN_COMPILER_MSVC)
+        #include <intrin.h>
+    #endif // CORETEN_COMPILER_MSVC
+
+    // Index of the first bit set in `mask` (which must not be 0)
+    static inline UInt32 __utf8_first_bit(UInt64 mask) {
+    #if defined(CORETEN_COMPILER_MSVC)
+        unsigned long index;
+        _BitScanForward64(&index, mask);
+        return cast(UInt32)index;
+    #else
+        return cast(UInt32)__builtin_ctzll(mask);
+    #endif // CORETEN_COMPILER_MSVC
+    }
+
+    UInt64 utf8_find_non_ascii(const char* data, UInt64 len) {
+        UInt64 pos = 0;
+        // The high bit of every byte is packed into a mask (NEON has no `movemask`, so each byte is narrowed to 4 
+        // bits instead)
+    #if defined(CORETEN_SIMD_AVX2)
+        for(; pos + 32 <= len; pos += 32) {
+            UInt64 mask = cast(UInt32)_mm256_movemask_epi8(_mm256_loadu_si256(cast(const __m256i*)(data + pos)));
+            if(mask != 0)
+                return pos + __utf8_first_bit(mask);
+        }
+    #elif defined(CORETEN_SIMD_SSE2)
+        for(; pos + 16 <= len; pos += 16) {
+            UInt64 mask = cast(UInt32)_mm_movemask_epi8(_mm_loadu_si128(cast(const __m128i*)(data + pos)));
+            if(mask != 0)
+                return pos + __utf8_first_bit(mask);
+        }
+    #elif defined(CORETEN_SIMD_NEON)
+        for(; pos + 16 <= len; pos += 16) {
+            uint8x16_t high = vtstq_u8(vld1q_u8(cast(const uint8_t*)(data + pos)), vdupq_n_u8(0x80));
+            UInt64 mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(high), 4)), 0);
+            if(mask != 0)
+                return pos + (__utf8_first_bit(mask) >> 2);
+        }
+    #endif // CORETEN_SIMD_AVX2
+
+        // A machine word at a time (and the byte itself is found below, whatever the endianness)
+        for(; pos + 8 <= len; pos += 8) {
+            UInt64 word;
+            memcpy(&word, data + pos, sizeof(word));
+            if(word & 0x8080808080808080ull)
+                break;
+        }
+        for(; pos < len; pos++) {
+            if(cast(Byte)data[pos] >= 0x80)
+                return pos;
+        }
+        return len;
+    }
+
+    bool utf8_is_ascii(const char* data, UInt64 len) {
+        return utf8_find_non_ascii(data, len) == len;
+    }
+
+    UInt64 utf8_validate(const char* data, UInt64 len) {
+        UInt64 pos = 0;
+        for(;;) {
+            pos += utf8_find_non_ascii(data + pos, len - pos);
+            if(pos == len)
+                return len;
+
+            // Decode until we're back to ASCII (non-ASCII characters tend to come in runs)
+            Rune rune;
+            do {
+                UInt32 nbytes = utf8_decode(data + pos, len - pos, &rune);
+                if(nbytes == 0)
+                    return pos;
+                pos += nbytes;
+            } while(pos < len && cast(Byte)data[pos] >= 0x80);
+        }
+    }
+
     /*
         WIP
     */
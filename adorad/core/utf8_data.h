@@ -1,7582 +0,0 @@
-/*
-          _____   ____  _____            _____
-    /\   |  __ \ / __ \|  __ \     /\   |  __ \
-   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
-  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
- / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/AdoradInternalTests/
-/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
-
-Licensed under the MIT License <http://opensource.org/licenses/MIT>
-SPDX-License-Identifier: MIT
-Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
-*/
-
-#ifndef CORETEN_UTF8_DATA_H
-#define CORETEN_UTF8_DATA_H
-
-/*
-    Note that while this file is included as part of the CSTL library, we are not the actual authors.
-    Due credit goes to the authors behind the `utf8proc` library (https://github.com/JuliaStrings/utf8proc).
-*/
-
-static const UInt16 utf8_sequences[] = {
-    97, 98, 99, 100, 101, 102, 103,
-    104, 105, 106, 107, 108, 109, 110, 111,
-    112, 113, 114, 115, 116, 117, 118, 119,
-    120, 121, 122, 32, 32, 776, 32, 772,
-    50, 51, 32, 769, 956, 32, 807, 49,
-    49, 8260, 52, 49, 8260, 50, 51, 8260,
-    52, 65, 768, 224, 65, 769, 225, 65,
-    770, 226, 65, 771, 227, 65, 776, 228,
-    65, 778, 229, 230, 67, 807, 231, 69,
-    768, 232, 69, 769, 233, 69, 770, 234,
-    69, 776, 235, 73, 768, 236, 73, 769,
-    237, 73, 770, 238, 73, 776, 239, 240,
-    78, 771, 241, 79, 768, 242, 79, 769,
-    243, 79, 770, 244, 79, 771, 245, 79,
-    776, 246, 248, 85, 768, 249, 85, 769,
-    250, 85, 770, 251, 85, 776, 252, 89,
-    769, 253, 254, 115, 115, 97, 768, 97,
-    769, 97, 770, 97, 771, 97, 776, 97,
-    778, 99, 807, 101, 768, 101, 769, 101,
-    770, 101, 776, 105, 768, 105, 769, 105,
-    770, 105, 776, 110, 771, 111, 768, 111,
-    769, 111, 770, 111, 771, 111, 776, 117,
-    768, 117, 769, 117, 770, 117, 776, 121,
-    769, 121, 776, 65, 772, 257, 97, 772,
-    65, 774, 259, 97, 774, 65, 808, 261,
-    97, 808, 67, 769, 263, 99, 769, 67,
-    770, 265, 99, 770, 67, 775, 267, 99,
-    775, 67, 780, 269, 99, 780, 68, 780,
-    271, 100, 780, 273, 69, 772, 275, 101,
-    772, 69, 774, 277, 101, 774, 69, 775,
-    279, 101, 775, 69, 808, 281, 101, 808,
-    69, 780, 283, 101, 780, 71, 770, 285,
-    103, 770, 71, 774, 287, 103, 774, 71,
-    775, 289, 103, 775, 71, 807, 291, 103,
-    807, 72, 770, 293, 104, 770, 295, 73,
-    771, 297, 105, 771, 73, 772, 299, 105,
-    772, 73, 774, 301, 105, 774, 73, 808,
-    303, 105, 808, 73, 775, 105, 775, 73,
-    74, 307, 105, 106, 74, 770, 309, 106,
-    770, 75, 807, 311, 107, 807, 76, 769,
-    314, 108, 769, 76, 807, 316, 108, 807,
-    76, 780, 318, 108, 780, 76, 183, 320,
-    108, 183, 322, 78, 769, 324, 110, 769,
-    78, 807, 326, 110, 807, 78, 780, 328,
-    110, 780, 700, 110, 331, 79, 772, 333,
-    111, 772, 79, 774, 335, 111, 774, 79,
-    779, 337, 111, 779, 339, 82, 769, 341,
-    114, 769, 82, 807, 343, 114, 807, 82,
-    780, 345, 114, 780, 83, 769, 347, 115,
-    769, 83, 770, 349, 115, 770, 83, 807,
-    351, 115, 807, 83, 780, 353, 115, 780,
-    84, 807, 355, 116, 807, 84, 780, 357,
-    116, 780, 359, 85, 771, 361, 117, 771,
-    85, 772, 363, 117, 772, 85, 774, 365,
-    117, 774, 85, 778, 367, 117, 778, 85,
-    779, 369, 117, 779, 85, 808, 371, 117,
-    808, 87, 770, 373, 119, 770, 89, 770,
-    375, 121, 770, 89, 776, 255, 90, 769,
-    378, 122, 769, 90, 775, 380, 122, 775,
-    90, 780, 382, 122, 780, 595, 387, 389,
-    596, 392, 598, 599, 396, 477, 601, 603,
-    402, 608, 611, 617, 616, 409, 623, 626,
-    629, 79, 795, 417, 111, 795, 419, 421,
-    640, 424, 643, 429, 648, 85, 795, 432,
-    117, 795, 650, 651, 436, 438, 658, 441,
-    445, 68, 381, 454, 68, 382, 100, 382,
-    76, 74, 457, 76, 106, 108, 106, 78,
-    74, 460, 78, 106, 110, 106, 65, 780,
-    462, 97, 780, 73, 780, 464, 105, 780,
-    79, 780, 466, 111, 780, 85, 780, 468,
-    117, 780, 220, 772, 470, 252, 772, 220,
-    769, 472, 252, 769, 220, 780, 474, 252,
-    780, 220, 768, 476, 252, 768, 196, 772,
-    479, 228, 772, 550, 772, 481, 551, 772,
-    198, 772, 483, 230, 772, 485, 71, 780,
-    487, 103, 780, 75, 780, 489, 107, 780,
-    79, 808, 491, 111, 808, 490, 772, 493,
-    491, 772, 439, 780, 495, 658, 780, 106,
-    780, 68, 90, 499, 68, 122, 100, 122,
-    71, 769, 501, 103, 769, 405, 447, 78,
-    768, 505, 110, 768, 197, 769, 507, 229,
-    769, 198, 769, 509, 230, 769, 216, 769,
-    511, 248, 769, 65, 783, 513, 97, 783,
-    65, 785, 515, 97, 785, 69, 783, 517,
-    101, 783, 69, 785, 519, 101, 785, 73,
-    783, 521, 105, 783, 73, 785, 523, 105,
-    785, 79, 783, 525, 111, 783, 79, 785,
-    527, 111, 785, 82, 783, 529, 114, 783,
-    82, 785, 531, 114, 785, 85, 783, 533,
-    117, 783, 85, 785, 535, 117, 785, 83,
-    806, 537, 115, 806, 84, 806, 539, 116,
-    806, 541, 72, 780, 543, 104, 780, 414,
-    547, 549, 65, 775, 551, 97, 775, 69,
-    807, 553, 101, 807, 214, 772, 555, 246,
-    772, 213, 772, 557, 245, 772, 79, 775,
-    559, 111, 775, 558, 772, 561, 559, 772,
-    89, 772, 563, 121, 772, 11365, 572, 410,
-    11366, 578, 384, 649, 652, 583, 585, 587,
-    589, 591, 614, 633, 635, 641, 32, 774,
-    32, 775, 32, 778, 32, 808, 32, 771,
-    32, 779, 661, 768, 769, 787, 776, 769,
-    953, 881, 883, 697, 887, 32, 837, 59,
-    1011, 168, 769, 913, 769, 940, 183, 917,
-    769, 941, 919, 769, 942, 921, 769, 943,
-    927, 769, 972, 933, 769, 973, 937, 769,
-    974, 970, 769, 953, 776, 769, 945, 946,
-    947, 948, 949, 950, 951, 952, 954, 955,
-    957, 958, 959, 960, 961, 963, 964, 965,
-    966, 967, 968, 969, 921, 776, 970, 933,
-    776, 971, 945, 769, 949, 769, 951, 769,
-    953, 769, 971, 769, 965, 776, 769, 953,
-    776, 965, 776, 959, 769, 965, 769, 969,
-    769, 983, 933, 978, 769, 978, 776, 985,
-    987, 989, 991, 993, 995, 997, 999, 1001,
-    1003, 1005, 1007, 962, 920, 1016, 931, 1010,
-    1019, 891, 892, 893, 1045, 768, 1104, 1045,
-    776, 1105, 1106, 1043, 769, 1107, 1108, 1109,
-    1110, 1030, 776, 1111, 1112, 1113, 1114, 1115,
-    1050, 769, 1116, 1048, 768, 1117, 1059, 774,
-    1118, 1119, 1072, 1073, 1074, 1075, 1076, 1077,
-    1078, 1079, 1080, 1048, 774, 1081, 1082, 1083,
-    1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091,
-    1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099,
-    1100, 1101, 1102, 1103, 1080, 774, 1077, 768,
-    1077, 776, 1075, 769, 1110, 776, 1082, 769,
-    1080, 768, 1091, 774, 1121, 1123, 1125, 1127,
-    1129, 1131, 1133, 1135, 1137, 1139, 1141, 1140,
-    783, 1143, 1141, 783, 1145, 1147, 1149, 1151,
-    1153, 1163, 1165, 1167, 1169, 1171, 1173, 1175,
-    1177, 1179, 1181, 1183, 1185, 1187, 1189, 1191,
-    1193, 1195, 1197, 1199, 1201, 1203, 1205, 1207,
-    1209, 1211, 1213, 1215, 1231, 1046, 774, 1218,
-    1078, 774, 1220, 1222, 1224, 1226, 1228, 1230,
-    1040, 774, 1233, 1072, 774, 1040, 776, 1235,
-    1072, 776, 1237, 1045, 774, 1239, 1077, 774,
-    1241, 1240, 776, 1243, 1241, 776, 1046, 776,
-    1245, 1078, 776, 1047, 776, 1247, 1079, 776,
-    1249, 1048, 772, 1251, 1080, 772, 1048, 776,
-    1253, 1080, 776, 1054, 776, 1255, 1086, 776,
-    1257, 1256, 776, 1259, 1257, 776, 1069, 776,
-    1261, 1101, 776, 1059, 772, 1263, 1091, 772,
-    1059, 776, 1265, 1091, 776, 1059, 779, 1267,
-    1091, 779, 1063, 776, 1269, 1095, 776, 1271,
-    1067, 776, 1273, 1099, 776, 1275, 1277, 1279,
-    1281, 1283, 1285, 1287, 1289, 1291, 1293, 1295,
-    1297, 1299, 1301, 1303, 1305, 1307, 1309, 1311,
-    1313, 1315, 1317, 1319, 1321, 1323, 1325, 1327,
-    1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384,
-    1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392,
-    1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400,
-    1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408,
-    1409, 1410, 1411, 1412, 1413, 1414, 1381, 1410,
-    1575, 1619, 1575, 1620, 1608, 1620, 1575, 1621,
-    1610, 1620, 1575, 1652, 1608, 1652, 1735, 1652,
-    1610, 1652, 1749, 1620, 1729, 1620, 1746, 1620,
-    2344, 2364, 2352, 2364, 2355, 2364, 2325, 2364,
-    2326, 2364, 2327, 2364, 2332, 2364, 2337, 2364,
-    2338, 2364, 2347, 2364, 2351, 2364, 2503, 2494,
-    2503, 2519, 2465, 2492, 2466, 2492, 2479, 2492,
-    2610, 2620, 2616, 2620, 2582, 2620, 2583, 2620,
-    2588, 2620, 2603, 2620, 2887, 2902, 2887, 2878,
-    2887, 2903, 2849, 2876, 2850, 2876, 2962, 3031,
-    3014, 3006, 3015, 3006, 3014, 3031, 3142, 3158,
-    3263, 3285, 3270, 3285, 3270, 3286, 3270, 3266,
-    3274, 3285, 3398, 3390, 3399, 3390, 3398, 3415,
-    3545, 3530, 3545, 3535, 3548, 3530, 3545, 3551,
-    3661, 3634, 3789, 3762, 3755, 3737, 3755, 3745,
-    3851, 3906, 4023, 3916, 4023, 3921, 4023, 3926,
-    4023, 3931, 4023, 3904, 4021, 3953, 3954, 3953,
-    3956, 4018, 3968, 4018, 3969, 4019, 3968, 4019,
-    3969, 3953, 3968, 3986, 4023, 3996, 4023, 4001,
-    4023, 4006, 4023, 4011, 4023, 3984, 4021, 4133,
-    4142, 11520, 11521, 11522, 11523, 11524, 11525, 11526,
-    11527, 11528, 11529, 11530, 11531, 11532, 11533, 11534,
-    11535, 11536, 11537, 11538, 11539, 11540, 11541, 11542,
-    11543, 11544, 11545, 11546, 11547, 11548, 11549, 11550,
-    11551, 11552, 11553, 11554, 11555, 11556, 11557, 11559,
-    11565, 4316, 5104, 5105, 5106, 5107, 5108, 5109,
-    6917, 6965, 6919, 6965, 6921, 6965, 6923, 6965,
-    6925, 6965, 6929, 6965, 6970, 6965, 6972, 6965,
-    6974, 6965, 6975, 6965, 6978, 6965, 42571, 65,
-    198, 66, 68, 69, 398, 71, 72, 73,
-    74, 75, 76, 77, 78, 79, 546, 80,
-    82, 84, 85, 87, 592, 593, 7426, 604,
-    7446, 7447, 7453, 7461, 594, 597, 607, 609,
-    613, 618, 7547, 669, 621, 7557, 671, 625,
-    624, 627, 628, 632, 642, 427, 7452, 656,
-    657, 65, 805, 7681, 97, 805, 66, 775,
-    7683, 98, 775, 66, 803, 7685, 98, 803,
-    66, 817, 7687, 98, 817, 199, 769, 7689,
-    231, 769, 68, 775, 7691, 100, 775, 68,
-    803, 7693, 100, 803, 68, 817, 7695, 100,
-    817, 68, 807, 7697, 100, 807, 68, 813,
-    7699, 100, 813, 274, 768, 7701, 275, 768,
-    274, 769, 7703, 275, 769, 69, 813, 7705,
-    101, 813, 69, 816, 7707, 101, 816, 552,
-    774, 7709, 553, 774, 70, 775, 7711, 102,
-    775, 71, 772, 7713, 103, 772, 72, 775,
-    7715, 104, 775, 72, 803, 7717, 104, 803,
-    72, 776, 7719, 104, 776, 72, 807, 7721,
-    104, 807, 72, 814, 7723, 104, 814, 73,
-    816, 7725, 105, 816, 207, 769, 7727, 239,
-    769, 75, 769, 7729, 107, 769, 75, 803,
-    7731, 107, 803, 75, 817, 7733, 107, 817,
-    76, 803, 7735, 108, 803, 7734, 772, 7737,
-    7735, 772, 76, 817, 7739, 108, 817, 76,
-    813, 7741, 108, 813, 77, 769, 7743, 109,
-    769, 77, 775, 7745, 109, 775, 77, 803,
-    7747, 109, 803, 78, 775, 7749, 110, 775,
-    78, 803, 7751, 110, 803, 78, 817, 7753,
-    110, 817, 78, 813, 7755, 110, 813, 213,
-    769, 7757, 245, 769, 213, 776, 7759, 245,
-    776, 332, 768, 7761, 333, 768, 332, 769,
-    7763, 333, 769, 80, 769, 7765, 112, 769,
-    80, 775, 7767, 112, 775, 82, 775, 7769,
-    114, 775, 82, 803, 7771, 114, 803, 7770,
-    772, 7773, 7771, 772, 82, 817, 7775, 114,
-    817, 83, 775, 7777, 115, 775, 83, 803,
-    7779, 115, 803, 346, 775, 7781, 347, 775,
-    352, 775, 7783, 353, 775, 7778, 775, 7785,
-    7779, 775, 84, 775, 7787, 116, 775, 84,
-    803, 7789, 116, 803, 84, 817, 7791, 116,
-    817, 84, 813, 7793, 116, 813, 85, 804,
-    7795, 117, 804, 85, 816, 7797, 117, 816,
-    85, 813, 7799, 117, 813, 360, 769, 7801,
-    361, 769, 362, 776, 7803, 363, 776, 86,
-    771, 7805, 118, 771, 86, 803, 7807, 118,
-    803, 87, 768, 7809, 119, 768, 87, 769,
-    7811, 119, 769, 87, 776, 7813, 119, 776,
-    87, 775, 7815, 119, 775, 87, 803, 7817,
-    119, 803, 88, 775, 7819, 120, 775, 88,
-    776, 7821, 120, 776, 89, 775, 7823, 121,
-    775, 90, 770, 7825, 122, 770, 90, 803,
-    7827, 122, 803, 90, 817, 7829, 122, 817,
-    104, 817, 116, 776, 119, 778, 121, 778,
-    97, 702, 383, 775, 223, 65, 803, 7841,
-    97, 803, 65, 777, 7843, 97, 777, 194,
-    769, 7845, 226, 769, 194, 768, 7847, 226,
-    768, 194, 777, 7849, 226, 777, 194, 771,
-    7851, 226, 771, 7840, 770, 7853, 7841, 770,
-    258, 769, 7855, 259, 769, 258, 768, 7857,
-    259, 768, 258, 777, 7859, 259, 777, 258,
-    771, 7861, 259, 771, 7840, 774, 7863, 7841,
-    774, 69, 803, 7865, 101, 803, 69, 777,
-    7867, 101, 777, 69, 771, 7869, 101, 771,
-    202, 769, 7871, 234, 769, 202, 768, 7873,
-    234, 768, 202, 777, 7875, 234, 777, 202,
-    771, 7877, 234, 771, 7864, 770, 7879, 7865,
-    770, 73, 777, 7881, 105, 777, 73, 803,
-    7883, 105, 803, 79, 803, 7885, 111, 803,
-    79, 777, 7887, 111, 777, 212, 769, 7889,
-    244, 769, 212, 768, 7891, 244, 768, 212,
-    777, 7893, 244, 777, 212, 771, 7895, 244,
-    771, 7884, 770, 7897, 7885, 770, 416, 769,
-    7899, 417, 769, 416, 768, 7901, 417, 768,
-    416, 777, 7903, 417, 777, 416, 771, 7905,
-    417, 771, 416, 803, 7907, 417, 803, 85,
-    803, 7909, 117, 803, 85, 777, 7911, 117,
-    777, 431, 769, 7913, 432, 769, 431, 768,
-    7915, 432, 768, 431, 777, 7917, 432, 777,
-    431, 771, 7919, 432, 771, 431, 803, 7921,
-    432, 803, 89, 768, 7923, 121, 768, 89,
-    803, 7925, 121, 803, 89, 777, 7927, 121,
-    777, 89, 771, 7929, 121, 771, 7931, 7933,
-    7935, 945, 787, 945, 788, 7936, 768, 7937,
-    768, 7936, 769, 7937, 769, 7936, 834, 7937,
-    834, 913, 787, 7936, 913, 788, 7937, 7944,
-    768, 7938, 7945, 768, 7939, 7944, 769, 7940,
-    7945, 769, 7941, 7944, 834, 7942, 7945, 834,
-    7943, 949, 787, 949, 788, 7952, 768, 7953,
-    768, 7952, 769, 7953, 769, 917, 787, 7952,
-    917, 788, 7953, 7960, 768, 7954, 7961, 768,
-    7955, 7960, 769, 7956, 7961, 769, 7957, 951,
-    787, 951, 788, 7968, 768, 7969, 768, 7968,
-    769, 7969, 769, 7968, 834, 7969, 834, 919,
-    787, 7968, 919, 788, 7969, 7976, 768, 7970,
-    7977, 768, 7971, 7976, 769, 7972, 7977, 769,
-    7973, 7976, 834, 7974, 7977, 834, 7975, 953,
-    787, 953, 788, 7984, 768, 7985, 768, 7984,
-    769, 7985, 769, 7984, 834, 7985, 834, 921,
-    787, 7984, 921, 788, 7985, 7992, 768, 7986,
-    7993, 768, 7987, 7992, 769, 7988, 7993, 769,
-    7989, 7992, 834, 7990, 7993, 834, 7991, 959,
-    787, 959, 788, 8000, 768, 8001, 768, 8000,
-    769, 8001, 769, 927, 787, 8000, 927, 788,
-    8001, 8008, 768, 8002, 8009, 768, 8003, 8008,
-    769, 8004, 8009, 769, 8005, 965, 787, 965,
-    788, 8016, 768, 965, 787, 768, 8017, 768,
-    8016, 769, 965, 787, 769, 8017, 769, 8016,
-    834, 965, 787, 834, 8017, 834, 933, 788,
-    8017, 8025, 768, 8019, 8025, 769, 8021, 8025,
-    834, 8023, 969, 787, 969, 788, 8032, 768,
-    8033, 768, 8032, 769, 8033, 769, 8032, 834,
-    8033, 834, 937, 787, 8032, 937, 788, 8033,
-    8040, 768, 8034, 8041, 768, 8035, 8040, 769,
-    8036, 8041, 769, 8037, 8040, 834, 8038, 8041,
-    834, 8039, 945, 768, 949, 768, 951, 768,
-    953, 768, 959, 768, 965, 768, 969, 768,
-    7936, 837, 7936, 953, 7937, 837, 7937, 953,
-    7938, 837, 7938, 953, 7939, 837, 7939, 953,
-    7940, 837, 7940, 953, 7941, 837, 7941, 953,
-    7942, 837, 7942, 953, 7943, 837, 7943, 953,
-    7944, 837, 8064, 7945, 837, 8065, 7946, 837,
-    8066, 7947, 837, 8067, 7948, 837, 8068, 7949,
-    837, 8069, 7950, 837, 8070, 7951, 837, 8071,
-    7968, 837, 7968, 953, 7969, 837, 7969, 953,
-    7970, 837, 7970, 953, 7971, 837, 7971, 953,
-    7972, 837, 7972, 953, 7973, 837, 7973, 953,
-    7974, 837, 7974, 953, 7975, 837, 7975, 953,
-    7976, 837, 8080, 7977, 837, 8081, 7978, 837,
-    8082, 7979, 837, 8083, 7980, 837, 8084, 7981,
-    837, 8085, 7982, 837, 8086, 7983, 837, 8087,
-    8032, 837, 8032, 953, 8033, 837, 8033, 953,
-    8034, 837, 8034, 953, 8035, 837, 8035, 953,
-    8036, 837, 8036, 953, 8037, 837, 8037, 953,
-    8038, 837, 8038, 953, 8039, 837, 8039, 953,
-    8040, 837, 8096, 8041, 837, 8097, 8042, 837,
-    8098, 8043, 837, 8099, 8044, 837, 8100, 8045,
-    837, 8101, 8046, 837, 8102, 8047, 837, 8103,
-    945, 774, 945, 772, 8048, 837, 8048, 953,
-    945, 837, 945, 953, 940, 837, 940, 953,
-    945, 834, 8118, 837, 945, 834, 953, 913,
-    774, 8112, 913, 772, 8113, 913, 768, 8048,
-    902, 8049, 913, 837, 8115, 32, 787, 32,
-    834, 168, 834, 8052, 837, 8052, 953, 951,
-    837, 951, 953, 942, 837, 942, 953, 951,
-    834, 8134, 837, 951, 834, 953, 917, 768,
-    8050, 904, 8051, 919, 768, 8052, 905, 8053,
-    919, 837, 8131, 8127, 768, 8127, 769, 8127,
-    834, 953, 774, 953, 772, 970, 768, 953,
-    776, 768, 912, 953, 834, 970, 834, 953,
-    776, 834, 921, 774, 8144, 921, 772, 8145,
-    921, 768, 8054, 906, 8055, 8190, 768, 8190,
-    769, 8190, 834, 965, 774, 965, 772, 971,
-    768, 965, 776, 768, 944, 961, 787, 961,
-    788, 965, 834, 971, 834, 965, 776, 834,
-    933, 774, 8160, 933, 772, 8161, 933, 768,
-    8058, 910, 8059, 929, 788, 8165, 168, 768,
-    901, 96, 8060, 837, 8060, 953, 969, 837,
-    969, 953, 974, 837, 974, 953, 969, 834,
-    8182, 837, 969, 834, 953, 927, 768, 8056,
-    908, 8057, 937, 768, 8060, 911, 8061, 937,
-    837, 8179, 180, 32, 788, 8194, 8195, 8208,
-    32, 819, 46, 46, 46, 46, 46, 46,
-    8242, 8242, 8242, 8242, 8242, 8245, 8245, 8245,
-    8245, 8245, 33, 33, 32, 773, 63, 63,
-    63, 33, 33, 63, 8242, 8242, 8242, 8242,
-    48, 52, 53, 54, 55, 56, 57, 43,
-    8722, 61, 40, 41, 82, 115, 97, 47,
-    99, 97, 47, 115, 67, 176, 67, 99,
-    47, 111, 99, 47, 117, 400, 176, 70,
-    78, 111, 81, 83, 77, 84, 69, 76,
-    84, 77, 90, 937, 197, 70, 8526, 1488,
-    1489, 1490, 1491, 70, 65, 88, 915, 928,
-    8721, 49, 8260, 55, 49, 8260, 57, 49,
-    8260, 49, 48, 49, 8260, 51, 50, 8260,
-    51, 49, 8260, 53, 50, 8260, 53, 51,
-    8260, 53, 52, 8260, 53, 49, 8260, 54,
-    53, 8260, 54, 49, 8260, 56, 51, 8260,
-    56, 53, 8260, 56, 55, 8260, 56, 49,
-    8260, 8560, 73, 73, 8561, 73, 73, 73,
-    8562, 73, 86, 8563, 86, 8564, 86, 73,
-    8565, 86, 73, 73, 8566, 86, 73, 73,
-    73, 8567, 73, 88, 8568, 88, 8569, 88,
-    73, 8570, 88, 73, 73, 8571, 8572, 8573,
-    8574, 8575, 105, 105, 105, 105, 105, 105,
-    118, 118, 105, 118, 105, 105, 118, 105,
-    105, 105, 105, 120, 120, 105, 120, 105,
-    105, 8580, 48, 8260, 51, 8592, 824, 8594,
-    824, 8596, 824, 8656, 824, 8660, 824, 8658,
-    824, 8707, 824, 8712, 824, 8715, 824, 8739,
-    824, 8741, 824, 8747, 8747, 8747, 8747, 8747,
-    8750, 8750, 8750, 8750, 8750, 8764, 824, 8771,
-    824, 8773, 824, 8776, 824, 61, 824, 8801,
-    824, 8781, 824, 60, 824, 62, 824, 8804,
-    824, 8805, 824, 8818, 824, 8819, 824, 8822,
-    824, 8823, 824, 8826, 824, 8827, 824, 8834,
-    824, 8835, 824, 8838, 824, 8839, 824, 8866,
-    824, 8872, 824, 8873, 824, 8875, 824, 8828,
-    824, 8829, 824, 8849, 824, 8850, 824, 8882,
-    824, 8883, 824, 8884, 824, 8885, 824, 12296,
-    12297, 49, 48, 49, 49, 49, 50, 49,
-    51, 49, 52, 49, 53, 49, 54, 49,
-    55, 49, 56, 49, 57, 50, 48, 40,
-    49, 41, 40, 50, 41, 40, 51, 41,
-    40, 52, 41, 40, 53, 41, 40, 54,
-    41, 40, 55, 41, 40, 56, 41, 40,
-    57, 41, 40, 49, 48, 41, 40, 49,
-    49, 41, 40, 49, 50, 41, 40, 49,
-    51, 41, 40, 49, 52, 41, 40, 49,
-    53, 41, 40, 49, 54, 41, 40, 49,
-    55, 41, 40, 49, 56, 41, 40, 49,
-    57, 41, 40, 50, 48, 41, 49, 46,
-    50, 46, 51, 46, 52, 46, 53, 46,
-    54, 46, 55, 46, 56, 46, 57, 46,
-    49, 48, 46, 49, 49, 46, 49, 50,
-    46, 49, 51, 46, 49, 52, 46, 49,
-    53, 46, 49, 54, 46, 49, 55, 46,
-    49, 56, 46, 49, 57, 46, 50, 48,
-    46, 40, 97, 41, 40, 98, 41, 40,
-    99, 41, 40, 100, 41, 40, 101, 41,
-    40, 102, 41, 40, 103, 41, 40, 104,
-    41, 40, 105, 41, 40, 106, 41, 40,
-    107, 41, 40, 108, 41, 40, 109, 41,
-    40, 110, 41, 40, 111, 41, 40, 112,
-    41, 40, 113, 41, 40, 114, 41, 40,
-    115, 41, 40, 116, 41, 40, 117, 41,
-    40, 118, 41, 40, 119, 41, 40, 120,
-    41, 40, 121, 41, 40, 122, 41, 9424,
-    9425, 9426, 9427, 9428, 9429, 9430, 9431, 9432,
-    9433, 9434, 9435, 9436, 9437, 9438, 9439, 9440,
-    9441, 83, 9442, 9443, 9444, 9445, 9446, 9447,
-    89, 9448, 9449, 8747, 8747, 8747, 8747, 58,
-    58, 61, 61, 61, 61, 61, 61, 10973,
-    824, 11312, 11313, 11314, 11315, 11316, 11317, 11318,
-    11319, 11320, 11321, 11322, 11323, 11324, 11325, 11326,
-    11327, 11328, 11329, 11330, 11331, 11332, 11333, 11334,
-    11335, 11336, 11337, 11338, 11339, 11340, 11341, 11342,
-    11343, 11344, 11345, 11346, 11347, 11348, 11349, 11350,
-    11351, 11352, 11353, 11354, 11355, 11356, 11357, 11358,
-    11361, 619, 7549, 637, 11368, 11370, 11372, 11379,
-    11382, 575, 576, 11393, 11395, 11397, 11399, 11401,
-    11403, 11405, 11407, 11409, 11411, 11413, 11415, 11417,
-    11419, 11421, 11423, 11425, 11427, 11429, 11431, 11433,
-    11435, 11437, 11439, 11441, 11443, 11445, 11447, 11449,
-    11451, 11453, 11455, 11457, 11459, 11461, 11463, 11465,
-    11467, 11469, 11471, 11473, 11475, 11477, 11479, 11481,
-    11483, 11485, 11487, 11489, 11491, 11500, 11502, 11507,
-    11617, 27597, 40863, 19968, 20008, 20022, 20031, 20057,
-    20101, 20108, 20128, 20154, 20799, 20837, 20843, 20866,
-    20886, 20907, 20960, 20981, 20992, 21147, 21241, 21269,
-    21274, 21304, 21313, 21340, 21353, 21378, 21430, 21448,
-    21475, 22231, 22303, 22763, 22786, 22794, 22805, 22823,
-    22899, 23376, 23424, 23544, 23567, 23586, 23608, 23662,
-    23665, 24027, 24037, 24049, 24062, 24178, 24186, 24191,
-    24308, 24318, 24331, 24339, 24400, 24417, 24435, 24515,
-    25096, 25142, 25163, 25903, 25908, 25991, 26007, 26020,
-    26041, 26080, 26085, 26352, 26376, 26408, 27424, 27490,
-    27513, 27571, 27595, 27604, 27611, 27663, 27668, 27700,
-    28779, 29226, 29238, 29243, 29247, 29255, 29273, 29275,
-    29356, 29572, 29577, 29916, 29926, 29976, 29983, 29992,
-    30000, 30091, 30098, 30326, 30333, 30382, 30399, 30446,
-    30683, 30690, 30707, 31034, 31160, 31166, 31348, 31435,
-    31481, 31859, 31992, 32566, 32593, 32650, 32701, 32769,
-    32780, 32786, 32819, 32895, 32905, 33251, 33258, 33267,
-    33276, 33292, 33307, 33311, 33390, 33394, 33400, 34381,
-    34411, 34880, 34892, 34915, 35198, 35211, 35282, 35328,
-    35895, 35910, 35925, 35960, 35997, 36196, 36208, 36275,
-    36523, 36554, 36763, 36784, 36789, 37009, 37193, 37318,
-    37324, 37329, 38263, 38272, 38428, 38582, 38585, 38632,
-    38737, 38750, 38754, 38761, 38859, 38893, 38899, 38913,
-    39080, 39131, 39135, 39318, 39321, 39340, 39592, 39640,
-    39647, 39717, 39727, 39730, 39740, 39770, 40165, 40565,
-    40575, 40613, 40635, 40643, 40653, 40657, 40697, 40701,
-    40718, 40723, 40736, 40763, 40778, 40786, 40845, 40860,
-    40864, 12306, 21316, 21317, 12363, 12441, 12365, 12441,
-    12367, 12441, 12369, 12441, 12371, 12441, 12373, 12441,
-    12375, 12441, 12377, 12441, 12379, 12441, 12381, 12441,
-    12383, 12441, 12385, 12441, 12388, 12441, 12390, 12441,
-    12392, 12441, 12399, 12441, 12399, 12442, 12402, 12441,
-    12402, 12442, 12405, 12441, 12405, 12442, 12408, 12441,
-    12408, 12442, 12411, 12441, 12411, 12442, 12358, 12441,
-    32, 12441, 32, 12442, 12445, 12441, 12424, 12426,
-    12459, 12441, 12461, 12441, 12463, 12441, 12465, 12441,
-    12467, 12441, 12469, 12441, 12471, 12441, 12473, 12441,
-    12475, 12441, 12477, 12441, 12479, 12441, 12481, 12441,
-    12484, 12441, 12486, 12441, 12488, 12441, 12495, 12441,
-    12495, 12442, 12498, 12441, 12498, 12442, 12501, 12441,
-    12501, 12442, 12504, 12441, 12504, 12442, 12507, 12441,
-    12507, 12442, 12454, 12441, 12527, 12441, 12528, 12441,
-    12529, 12441, 12530, 12441, 12541, 12441, 12467, 12488,
-    4352, 4353, 4522, 4354, 4524, 4525, 4355, 4356,
-    4357, 4528, 4529, 4530, 4531, 4532, 4533, 4378,
-    4358, 4359, 4360, 4385, 4361, 4362, 4363, 4364,
-    4365, 4366, 4367, 4368, 4369, 4370, 4449, 4450,
-    4451, 4452, 4453, 4454, 4455, 4456, 4457, 4458,
-    4459, 4460, 4461, 4462, 4463, 4464, 4465, 4466,
-    4467, 4468, 4469, 4448, 4372, 4373, 4551, 4552,
-    4556, 4558, 4563, 4567, 4569, 4380, 4573, 4575,
-    4381, 4382, 4384, 4386, 4387, 4391, 4393, 4395,
-    4396, 4397, 4398, 4399, 4402, 4406, 4416, 4423,
-    4428, 4593, 4594, 4439, 4440, 4441, 4484, 4485,
-    4488, 4497, 4498, 4500, 4510, 4513, 19977, 22235,
-    19978, 20013, 19979, 30002, 19993, 19969, 22825, 22320,
-    40, 4352, 41, 40, 4354, 41, 40, 4355,
-    41, 40, 4357, 41, 40, 4358, 41, 40,
-    4359, 41, 40, 4361, 41, 40, 4363, 41,
-    40, 4364, 41, 40, 4366, 41, 40, 4367,
-    41, 40, 4368, 41, 40, 4369, 41, 40,
-    4370, 41, 40, 4352, 4449, 41, 40, 4354,
-    4449, 41, 40, 4355, 4449, 41, 40, 4357,
-    4449, 41, 40, 4358, 4449, 41, 40, 4359,
-    4449, 41, 40, 4361, 4449, 41, 40, 4363,
-    4449, 41, 40, 4364, 4449, 41, 40, 4366,
-    4449, 41, 40, 4367, 4449, 41, 40, 4368,
-    4449, 41, 40, 4369, 4449, 41, 40, 4370,
-    4449, 41, 40, 4364, 4462, 41, 40, 4363,
-    4457, 4364, 4453, 4523, 41, 40, 4363, 4457,
-    4370, 4462, 41, 40, 19968, 41, 40, 20108,
-    41, 40, 19977, 41, 40, 22235, 41, 40,
-    20116, 41, 40, 20845, 41, 40, 19971, 41,
-    40, 20843, 41, 40, 20061, 41, 40, 21313,
-    41, 40, 26376, 41, 40, 28779, 41, 40,
-    27700, 41, 40, 26408, 41, 40, 37329, 41,
-    40, 22303, 41, 40, 26085, 41, 40, 26666,
-    41, 40, 26377, 41, 40, 31038, 41, 40,
-    21517, 41, 40, 29305, 41, 40, 36001, 41,
-    40, 31069, 41, 40, 21172, 41, 40, 20195,
-    41, 40, 21628, 41, 40, 23398, 41, 40,
-    30435, 41, 40, 20225, 41, 40, 36039, 41,
-    40, 21332, 41, 40, 31085, 41, 40, 20241,
-    41, 40, 33258, 41, 40, 33267, 41, 21839,
-    24188, 31631, 80, 84, 69, 50, 49, 50,
-    50, 50, 51, 50, 52, 50, 53, 50,
-    54, 50, 55, 50, 56, 50, 57, 51,
-    48, 51, 49, 51, 50, 51, 51, 51,
-    52, 51, 53, 4352, 4449, 4354, 4449, 4355,
-    4449, 4357, 4449, 4358, 4449, 4359, 4449, 4361,
-    4449, 4363, 4449, 4364, 4449, 4366, 4449, 4367,
-    4449, 4368, 4449, 4369, 4449, 4370, 4449, 4366,
-    4449, 4535, 4352, 4457, 4364, 4462, 4363, 4468,
-    4363, 4462, 20116, 20845, 19971, 20061, 26666, 26377,
-    31038, 21517, 29305, 36001, 31069, 21172, 31192, 30007,
-    36969, 20778, 21360, 27880, 38917, 20241, 20889, 27491,
-    24038, 21491, 21307, 23447, 23398, 30435, 20225, 36039,
-    21332, 22812, 51, 54, 51, 55, 51, 56,
-    51, 57, 52, 48, 52, 49, 52, 50,
-    52, 51, 52, 52, 52, 53, 52, 54,
-    52, 55, 52, 56, 52, 57, 53, 48,
-    49, 26376, 50, 26376, 51, 26376, 52, 26376,
-    53, 26376, 54, 26376, 55, 26376, 56, 26376,
-    57, 26376, 49, 48, 26376, 49, 49, 26376,
-    49, 50, 26376, 72, 103, 101, 114, 103,
-    101, 86, 76, 84, 68, 12450, 12452, 12454,
-    12456, 12458, 12459, 12461, 12463, 12465, 12467, 12469,
-    12471, 12473, 12475, 12477, 12479, 12481, 12484, 12486,
-    12488, 12490, 12491, 12492, 12493, 12494, 12495, 12498,
-    12501, 12504, 12507, 12510, 12511, 12512, 12513, 12514,
-    12516, 12518, 12520, 12521, 12522, 12523, 12524, 12525,
-    12527, 12528, 12529, 12530, 12450, 12497, 12540, 12488,
-    12450, 12523, 12501, 12449, 12450, 12531, 12506, 12450,
-    12450, 12540, 12523, 12452, 12491, 12531, 12464, 12452,
-    12531, 12481, 12454, 12457, 12531, 12456, 12473, 12463,
-    12540, 12489, 12456, 12540, 12459, 12540, 12458, 12531,
-    12473, 12458, 12540, 12512, 12459, 12452, 12522, 12459,
-    12521, 12483, 12488, 12459, 12525, 12522, 12540, 12460,
-    12525, 12531, 12460, 12531, 12510, 12462, 12460, 12462,
-    12491, 12540, 12461, 12517, 12522, 12540, 12462, 12523,
-    12480, 12540, 12461, 12525, 12461, 12525, 12464, 12521,
-    12512, 12461, 12525, 12513, 12540, 12488, 12523, 12461,
-    12525, 12527, 12483, 12488, 12464, 12521, 12512, 12464,
-    12521, 12512, 12488, 12531, 12463, 12523, 12476, 12452,
-    12525, 12463, 12525, 12540, 12493, 12465, 12540, 12473,
-    12467, 12523, 12490, 12467, 12540, 12509, 12469, 12452,
-    12463, 12523, 12469, 12531, 12481, 12540, 12512, 12471,
-    12522, 12531, 12464, 12475, 12531, 12481, 12475, 12531,
-    12488, 12480, 12540, 12473, 12487, 12471, 12489, 12523,
-    12488, 12531, 12490, 12494, 12494, 12483, 12488, 12495,
-    12452, 12484, 12497, 12540, 12475, 12531, 12488, 12497,
-    12540, 12484, 12496, 12540, 12524, 12523, 12500, 12450,
-    12473, 12488, 12523, 12500, 12463, 12523, 12500, 12467,
-    12499, 12523, 12501, 12449, 12521, 12483, 12489, 12501,
-    12451, 12540, 12488, 12502, 12483, 12471, 12455, 12523,
-    12501, 12521, 12531, 12504, 12463, 12479, 12540, 12523,
-    12506, 12477, 12506, 12491, 12498, 12504, 12523, 12484,
-    12506, 12531, 12473, 12506, 12540, 12472, 12505, 12540,
-    12479, 12509, 12452, 12531, 12488, 12508, 12523, 12488,
-    12507, 12531, 12509, 12531, 12489, 12507, 12540, 12523,
-    12507, 12540, 12531, 12510, 12452, 12463, 12525, 12510,
-    12452, 12523, 12510, 12483, 12495, 12510, 12523, 12463,
-    12510, 12531, 12471, 12519, 12531, 12511, 12463, 12525,
-    12531, 12511, 12522, 12511, 12522, 12496, 12540, 12523,
-    12513, 12460, 12513, 12460, 12488, 12531, 12513, 12540,
-    12488, 12523, 12516, 12540, 12489, 12516, 12540, 12523,
-    12518, 12450, 12531, 12522, 12483, 12488, 12523, 12522,
-    12521, 12523, 12500, 12540, 12523, 12540, 12502, 12523,
-    12524, 12512, 12524, 12531, 12488, 12466, 12531, 12527,
-    12483, 12488, 48, 28857, 49, 28857, 50, 28857,
-    51, 28857, 52, 28857, 53, 28857, 54, 28857,
-    55, 28857, 56, 28857, 57, 28857, 49, 48,
-    28857, 49, 49, 28857, 49, 50, 28857, 49,
-    51, 28857, 49, 52, 28857, 49, 53, 28857,
-    49, 54, 28857, 49, 55, 28857, 49, 56,
-    28857, 49, 57, 28857, 50, 48, 28857, 50,
-    49, 28857, 50, 50, 28857, 50, 51, 28857,
-    50, 52, 28857, 104, 80, 97, 100, 97,
-    65, 85, 98, 97, 114, 111, 86, 112,
-    99, 100, 109, 100, 109, 178, 100, 109,
-    179, 73, 85, 24179, 25104, 26157, 21644, 22823,
-    27491, 26126, 27835, 26666, 24335, 20250, 31038, 112,
-    65, 110, 65, 956, 65, 109, 65, 107,
-    65, 75, 66, 77, 66, 71, 66, 99,
-    97, 108, 107, 99, 97, 108, 112, 70,
-    110, 70, 956, 70, 956, 103, 109, 103,
-    107, 103, 72, 122, 107, 72, 122, 77,
-    72, 122, 71, 72, 122, 84, 72, 122,
-    956, 8467, 109, 8467, 100, 8467, 107, 8467,
-    102, 109, 110, 109, 956, 109, 109, 109,
-    99, 109, 107, 109, 109, 109, 178, 99,
-    109, 178, 109, 178, 107, 109, 178, 109,
-    109, 179, 99, 109, 179, 109, 179, 107,
-    109, 179, 109, 8725, 115, 109, 8725, 115,
-    178, 80, 97, 107, 80, 97, 77, 80,
-    97, 71, 80, 97, 114, 97, 100, 114,
-    97, 100, 8725, 115, 114, 97, 100, 8725,
-    115, 178, 112, 115, 110, 115, 956, 115,
-    109, 115, 112, 86, 110, 86, 956, 86,
-    109, 86, 107, 86, 77, 86, 112, 87,
-    110, 87, 956, 87, 109, 87, 107, 87,
-    77, 87, 107, 937, 77, 937, 97, 46,
-    109, 46, 66, 113, 99, 99, 99, 100,
-    67, 8725, 107, 103, 67, 111, 46, 100,
-    66, 71, 121, 104, 97, 72, 80, 105,
-    110, 75, 75, 75, 77, 107, 116, 108,
-    109, 108, 110, 108, 111, 103, 108, 120,
-    109, 98, 109, 105, 108, 109, 111, 108,
-    80, 72, 112, 46, 109, 46, 80, 80,
-    77, 80, 82, 115, 114, 83, 118, 87,
-    98, 86, 8725, 109, 65, 8725, 109, 49,
-    26085, 50, 26085, 51, 26085, 52, 26085, 53,
-    26085, 54, 26085, 55, 26085, 56, 26085, 57,
-    26085, 49, 48, 26085, 49, 49, 26085, 49,
-    50, 26085, 49, 51, 26085, 49, 52, 26085,
-    49, 53, 26085, 49, 54, 26085, 49, 55,
-    26085, 49, 56, 26085, 49, 57, 26085, 50,
-    48, 26085, 50, 49, 26085, 50, 50, 26085,
-    50, 51, 26085, 50, 52, 26085, 50, 53,
-    26085, 50, 54, 26085, 50, 55, 26085, 50,
-    56, 26085, 50, 57, 26085, 51, 48, 26085,
-    51, 49, 26085, 103, 97, 108, 42561, 42563,
-    42565, 42567, 42569, 42573, 42575, 42577, 42579, 42581,
-    42583, 42585, 42587, 42589, 42591, 42593, 42595, 42597,
-    42599, 42601, 42603, 42605, 42625, 42627, 42629, 42631,
-    42633, 42635, 42637, 42639, 42641, 42643, 42645, 42647,
-    42649, 42651, 42787, 42789, 42791, 42793, 42795, 42797,
-    42799, 42803, 42805, 42807, 42809, 42811, 42813, 42815,
-    42817, 42819, 42821, 42823, 42825, 42827, 42829, 42831,
-    42833, 42835, 42837, 42839, 42841, 42843, 42845, 42847,
-    42849, 42851, 42853, 42855, 42857, 42859, 42861, 42863,
-    42874, 42876, 7545, 42879, 42881, 42883, 42885, 42887,
-    42892, 42897, 42899, 42903, 42905, 42907, 42909, 42911,
-    42913, 42915, 42917, 42919, 42921, 620, 670, 647,
-    43859, 42933, 42935, 294, 43831, 43858, 5024, 5025,
-    5026, 5027, 5028, 5029, 5030, 5031, 5032, 5033,
-    5034, 5035, 5036, 5037, 5038, 5039, 5040, 5041,
-    5042, 5043, 5044, 5045, 5046, 5047, 5048, 5049,
-    5050, 5051, 5052, 5053, 5054, 5055, 5056, 5057,
-    5058, 5059, 5060, 5061, 5062, 5063, 5064, 5065,
-    5066, 5067, 5068, 5069, 5070, 5071, 5072, 5073,
-    5074, 5075, 5076, 5077, 5078, 5079, 5080, 5081,
-    5082, 5083, 5084, 5085, 5086, 5087, 5088, 5089,
-    5090, 5091, 5092, 5093, 5094, 5095, 5096, 5097,
-    5098, 5099, 5100, 5101, 5102, 5103, 35912, 26356,
-    36040, 28369, 20018, 21477, 22865, 21895, 22856, 25078,
-    30313, 32645, 34367, 34746, 35064, 37007, 27138, 27931,
-    28889, 29662, 33853, 37226, 39409, 20098, 21365, 27396,
-    29211, 34349, 40478, 23888, 28651, 34253, 35172, 25289,
-    33240, 34847, 24266, 26391, 28010, 29436, 37070, 20358,
-    20919, 21214, 25796, 27347, 29200, 30439, 34310, 34396,
-    36335, 38706, 39791, 40442, 30860, 31103, 32160, 33737,
-    37636, 35542, 22751, 24324, 31840, 32894, 29282, 30922,
-    36034, 38647, 22744, 23650, 27155, 28122, 28431, 32047,
-    32311, 38475, 21202, 32907, 20956, 20940, 31260, 32190,
-    33777, 38517, 35712, 25295, 35582, 20025, 23527, 24594,
-    29575, 30064, 21271, 30971, 20415, 24489, 19981, 27852,
-    25976, 32034, 21443, 22622, 30465, 33865, 35498, 27578,
-    27784, 25342, 33509, 25504, 30053, 20142, 20841, 20937,
-    26753, 31975, 33391, 35538, 37327, 21237, 21570, 24300,
-    26053, 28670, 31018, 38317, 39530, 40599, 40654, 26310,
-    27511, 36706, 24180, 24976, 25088, 25754, 28451, 29001,
-    29833, 31178, 32244, 32879, 36646, 34030, 36899, 37706,
-    21015, 21155, 21693, 28872, 35010, 24265, 24565, 25467,
-    27566, 31806, 29557, 20196, 22265, 23994, 24604, 29618,
-    29801, 32666, 32838, 37428, 38646, 38728, 38936, 20363,
-    31150, 37300, 38584, 24801, 20102, 20698, 23534, 23615,
-    26009, 29134, 30274, 34044, 36988, 26248, 38446, 21129,
-    26491, 26611, 27969, 28316, 29705, 30041, 30827, 32016,
-    39006, 25134, 38520, 20523, 23833, 28138, 36650, 24459,
-    24900, 26647, 38534, 21033, 21519, 23653, 26131, 26446,
-    26792, 27877, 29702, 30178, 32633, 35023, 35041, 38626,
-    21311, 28346, 21533, 29136, 29848, 34298, 38563, 40023,
-    40607, 26519, 28107, 33256, 31520, 31890, 29376, 28825,
-    35672, 20160, 33590, 21050, 20999, 24230, 25299, 31958,
-    23429, 27934, 26292, 36667, 38477, 24275, 20800, 21952,
-    22618, 26228, 20958, 29482, 30410, 31036, 31070, 31077,
-    31119, 38742, 31934, 34322, 35576, 36920, 37117, 39151,
-    39164, 39208, 40372, 37086, 38583, 20398, 20711, 20813,
-    21193, 21220, 21329, 21917, 22022, 22120, 22592, 22696,
-    23652, 24724, 24936, 24974, 25074, 25935, 26082, 26257,
-    26757, 28023, 28186, 28450, 29038, 29227, 29730, 30865,
-    31049, 31048, 31056, 31062, 31117, 31118, 31296, 31361,
-    31680, 32265, 32321, 32626, 32773, 33261, 33401, 33879,
-    35088, 35222, 35585, 35641, 36051, 36104, 36790, 38627,
-    38911, 38971, 24693, 55376, 57070, 33304, 20006, 20917,
-    20840, 20352, 20805, 20864, 21191, 21242, 21845, 21913,
-    21986, 22707, 22852, 22868, 23138, 23336, 24274, 24281,
-    24425, 24493, 24792, 24910, 24840, 24928, 25140, 25540,
-    25628, 25682, 25942, 26395, 26454, 28379, 28363, 28702,
-    30631, 29237, 29359, 29809, 29958, 30011, 30237, 30239,
-    30427, 30452, 30538, 30528, 30924, 31409, 31867, 32091,
-    32574, 33618, 33775, 34681, 35137, 35206, 35519, 35531,
-    35565, 35722, 36664, 36978, 37273, 37494, 38524, 38875,
-    38923, 39698, 55370, 56394, 55370, 56388, 55372, 57301,
-    15261, 16408, 16441, 55380, 56905, 55383, 56528, 55391,
-    57043, 40771, 40846, 102, 102, 102, 105, 102,
-    108, 102, 102, 105, 102, 102, 108, 383,
-    116, 115, 116, 1396, 1398, 1396, 1381, 1396,
-    1387, 1406, 1398, 1396, 1389, 1497, 1460, 1522,
-    1463, 1506, 1492, 1499, 1500, 1501, 1512, 1514,
-    1513, 1473, 1513, 1474, 64329, 1473, 64329, 1474,
-    1488, 1463, 1488, 1464, 1488, 1468, 1489, 1468,
-    1490, 1468, 1491, 1468, 1492, 1468, 1493, 1468,
-    1494, 1468, 1496, 1468, 1497, 1468, 1498, 1468,
-    1499, 1468, 1500, 1468, 1502, 1468, 1504, 1468,
-    1505, 1468, 1507, 1468, 1508, 1468, 1510, 1468,
-    1511, 1468, 1512, 1468, 1513, 1468, 1514, 1468,
-    1493, 1465, 1489, 1471, 1499, 1471, 1508, 1471,
-    1488, 1500, 1649, 1659, 1662, 1664, 1658, 1663,
-    1657, 1700, 1702, 1668, 1667, 1670, 1671, 1677,
-    1676, 1678, 1672, 1688, 1681, 1705, 1711, 1715,
-    1713, 1722, 1723, 1728, 1729, 1726, 1746, 1747,
-    1709, 1735, 1734, 1736, 1655, 1739, 1733, 1737,
-    1744, 1609, 1574, 1575, 1574, 1749, 1574, 1608,
-    1574, 1735, 1574, 1734, 1574, 1736, 1574, 1744,
-    1574, 1609, 1740, 1574, 1580, 1574, 1581, 1574,
-    1605, 1574, 1610, 1576, 1580, 1576, 1581, 1576,
-    1582, 1576, 1605, 1576, 1609, 1576, 1610, 1578,
-    1580, 1578, 1581, 1578, 1582, 1578, 1605, 1578,
-    1609, 1578, 1610, 1579, 1580, 1579, 1605, 1579,
-    1609, 1579, 1610, 1580, 1581, 1580, 1605, 1581,
-    1580, 1581, 1605, 1582, 1580, 1582, 1581, 1582,
-    1605, 1587, 1580, 1587, 1581, 1587, 1582, 1587,
-    1605, 1589, 1581, 1589, 1605, 1590, 1580, 1590,
-    1581, 1590, 1582, 1590, 1605, 1591, 1581, 1591,
-    1605, 1592, 1605, 1593, 1580, 1593, 1605, 1594,
-    1580, 1594, 1605, 1601, 1580, 1601, 1581, 1601,
-    1582, 1601, 1605, 1601, 1609, 1601, 1610, 1602,
-    1581, 1602, 1605, 1602, 1609, 1602, 1610, 1603,
-    1575, 1603, 1580, 1603, 1581, 1603, 1582, 1603,
-    1604, 1603, 1605, 1603, 1609, 1603, 1610, 1604,
-    1580, 1604, 1581, 1604, 1582, 1604, 1605, 1604,
-    1609, 1604, 1610, 1605, 1580, 1605, 1581, 1605,
-    1582, 1605, 1605, 1605, 1609, 1605, 1610, 1606,
-    1580, 1606, 1581, 1606, 1582, 1606, 1605, 1606,
-    1609, 1606, 1610, 1607, 1580, 1607, 1605, 1607,
-    1609, 1607, 1610, 1610, 1580, 1610, 1581, 1610,
-    1582, 1610, 1605, 1610, 1609, 1610, 1610, 1584,
-    1648, 1585, 1648, 1609, 1648, 32, 1612, 1617,
-    32, 1613, 1617, 32, 1614, 1617, 32, 1615,
-    1617, 32, 1616, 1617, 32, 1617, 1648, 1574,
-    1585, 1574, 1586, 1574, 1606, 1576, 1585, 1576,
-    1586, 1576, 1606, 1578, 1585, 1578, 1586, 1578,
-    1606, 1579, 1585, 1579, 1586, 1579, 1606, 1605,
-    1575, 1606, 1585, 1606, 1586, 1606, 1606, 1610,
-    1585, 1610, 1586, 1610, 1606, 1574, 1582, 1574,
-    1607, 1576, 1607, 1578, 1607, 1589, 1582, 1604,
-    1607, 1606, 1607, 1607, 1648, 1610, 1607, 1579,
-    1607, 1587, 1607, 1588, 1605, 1588, 1607, 1600,
-    1614, 1617, 1600, 1615, 1617, 1600, 1616, 1617,
-    1591, 1609, 1591, 1610, 1593, 1609, 1593, 1610,
-    1594, 1609, 1594, 1610, 1587, 1609, 1587, 1610,
-    1588, 1609, 1588, 1610, 1581, 1609, 1581, 1610,
-    1580, 1609, 1580, 1610, 1582, 1609, 1582, 1610,
-    1589, 1609, 1589, 1610, 1590, 1609, 1590, 1610,
-    1588, 1580, 1588, 1581, 1588, 1582, 1588, 1585,
-    1587, 1585, 1589, 1585, 1590, 1585, 1575, 1611,
-    1578, 1580, 1605, 1578, 1581, 1580, 1578, 1581,
-    1605, 1578, 1582, 1605, 1578, 1605, 1580, 1578,
-    1605, 1581, 1578, 1605, 1582, 1580, 1605, 1581,
-    1581, 1605, 1610, 1581, 1605, 1609, 1587, 1581,
-    1580, 1587, 1580, 1581, 1587, 1580, 1609, 1587,
-    1605, 1581, 1587, 1605, 1580, 1587, 1605, 1605,
-    1589, 1581, 1581, 1589, 1605, 1605, 1588, 1581,
-    1605, 1588, 1580, 1610, 1588, 1605, 1582, 1588,
-    1605, 1605, 1590, 1581, 1609, 1590, 1582, 1605,
-    1591, 1605, 1581, 1591, 1605, 1605, 1591, 1605,
-    1610, 1593, 1580, 1605, 1593, 1605, 1605, 1593,
-    1605, 1609, 1594, 1605, 1605, 1594, 1605, 1610,
-    1594, 1605, 1609, 1601, 1582, 1605, 1602, 1605,
-    1581, 1602, 1605, 1605, 1604, 1581, 1605, 1604,
-    1581, 1610, 1604, 1581, 1609, 1604, 1580, 1580,
-    1604, 1582, 1605, 1604, 1605, 1581, 1605, 1581,
-    1580, 1605, 1581, 1605, 1605, 1581, 1610, 1605,
-    1580, 1581, 1605, 1580, 1605, 1605, 1582, 1580,
-    1605, 1582, 1605, 1605, 1580, 1582, 1607, 1605,
-    1580, 1607, 1605, 1605, 1606, 1581, 1605, 1606,
-    1581, 1609, 1606, 1580, 1605, 1606, 1580, 1609,
-    1606, 1605, 1610, 1606, 1605, 1609, 1610, 1605,
-    1605, 1576, 1582, 1610, 1578, 1580, 1610, 1578,
-    1580, 1609, 1578, 1582, 1610, 1578, 1582, 1609,
-    1578, 1605, 1610, 1578, 1605, 1609, 1580, 1605,
-    1610, 1580, 1581, 1609, 1580, 1605, 1609, 1587,
-    1582, 1609, 1589, 1581, 1610, 1588, 1581, 1610,
-    1590, 1581, 1610, 1604, 1580, 1610, 1604, 1605,
-    1610, 1610, 1581, 1610, 1610, 1580, 1610, 1610,
-    1605, 1610, 1605, 1605, 1610, 1602, 1605, 1610,
-    1606, 1581, 1610, 1593, 1605, 1610, 1603, 1605,
-    1610, 1606, 1580, 1581, 1605, 1582, 1610, 1604,
-    1580, 1605, 1603, 1605, 1605, 1580, 1581, 1610,
-    1581, 1580, 1610, 1605, 1580, 1610, 1601, 1605,
-    1610, 1576, 1581, 1610, 1587, 1582, 1610, 1606,
-    1580, 1610, 1589, 1604, 1746, 1602, 1604, 1746,
-    1575, 1604, 1604, 1607, 1575, 1603, 1576, 1585,
-    1605, 1581, 1605, 1583, 1589, 1604, 1593, 1605,
-    1585, 1587, 1608, 1604, 1593, 1604, 1610, 1607,
-    1608, 1587, 1604, 1605, 1589, 1604, 1609, 17,
-    1589, 1604, 1609, 32, 1575, 1604, 1604, 1607,
-    32, 1593, 1604, 1610, 1607, 32, 1608, 1587,
-    1604, 1605, 7, 1580, 1604, 32, 1580, 1604,
-    1575, 1604, 1607, 1585, 1740, 1575, 1604, 44,
-    12289, 12290, 58, 33, 63, 12310, 12311, 8230,
-    8229, 8212, 8211, 95, 123, 125, 12308, 12309,
-    12304, 12305, 12298, 12299, 12300, 12301, 12302, 12303,
-    91, 93, 8254, 35, 38, 42, 45, 60,
-    62, 92, 36, 37, 64, 32, 1611, 1600,
-    1611, 32, 1612, 32, 1613, 32, 1614, 1600,
-    1614, 32, 1615, 1600, 1615, 32, 1616, 1600,
-    1616, 32, 1617, 1600, 1617, 32, 1618, 1600,
-    1618, 1569, 1570, 1571, 1572, 1573, 1574, 1575,
-    1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583,
-    1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591,
-    1592, 1593, 1594, 1601, 1602, 1603, 1604, 1605,
-    1606, 1607, 1608, 1610, 1604, 1570, 1604, 1571,
-    1604, 1573, 1604, 1575, 34, 39, 47, 65345,
-    65346, 65347, 65348, 65349, 65350, 65351, 65352, 65353,
-    65354, 65355, 65356, 65357, 65358, 65359, 65360, 65361,
-    65362, 65363, 65364, 65365, 65366, 65367, 65368, 65369,
-    65370, 94, 124, 126, 10629, 10630, 12539, 12449,
-    12451, 12453, 12455, 12457, 12515, 12517, 12519, 12483,
-    12540, 12531, 12441, 12442, 12644, 12593, 12594, 12595,
-    12596, 12597, 12598, 12599, 12600, 12601, 12602, 12603,
-    12604, 12605, 12606, 12607, 12608, 12609, 12610, 12611,
-    12612, 12613, 12614, 12615, 12616, 12617, 12618, 12619,
-    12620, 12621, 12622, 12623, 12624, 12625, 12626, 12627,
-    12628, 12629, 12630, 12631, 12632, 12633, 12634, 12635,
-    12636, 12637, 12638, 12639, 12640, 12641, 12642, 12643,
-    162, 163, 172, 175, 166, 165, 8361, 9474,
-    8592, 8593, 8594, 8595, 9632, 9675, 55297, 56360,
-    55297, 56361, 55297, 56362, 55297, 56363, 55297, 56364,
-    55297, 56365, 55297, 56366, 55297, 56367, 55297, 56368,
-    55297, 56369, 55297, 56370, 55297, 56371, 55297, 56372,
-    55297, 56373, 55297, 56374, 55297, 56375, 55297, 56376,
-    55297, 56377, 55297, 56378, 55297, 56379, 55297, 56380,
-    55297, 56381, 55297, 56382, 55297, 56383, 55297, 56384,
-    55297, 56385, 55297, 56386, 55297, 56387, 55297, 56388,
-    55297, 56389, 55297, 56390, 55297, 56391, 55297, 56392,
-    55297, 56393, 55297, 56394, 55297, 56395, 55297, 56396,
-    55297, 56397, 55297, 56398, 55297, 56399, 55297, 56536,
-    55297, 56537, 55297, 56538, 55297, 56539, 55297, 56540,
-    55297, 56541, 55297, 56542, 55297, 56543, 55297, 56544,
-    55297, 56545, 55297, 56546, 55297, 56547, 55297, 56548,
-    55297, 56549, 55297, 56550, 55297, 56551, 55297, 56552,
-    55297, 56553, 55297, 56554, 55297, 56555, 55297, 56556,
-    55297, 56557, 55297, 56558, 55297, 56559, 55297, 56560,
-    55297, 56561, 55297, 56562, 55297, 56563, 55297, 56564,
-    55297, 56565, 55297, 56566, 55297, 56567, 55297, 56568,
-    55297, 56569, 55297, 56570, 55297, 56571, 55299, 56512,
-    55299, 56513, 55299, 56514, 55299, 56515, 55299, 56516,
-    55299, 56517, 55299, 56518, 55299, 56519, 55299, 56520,
-    55299, 56521, 55299, 56522, 55299, 56523, 55299, 56524,
-    55299, 56525, 55299, 56526, 55299, 56527, 55299, 56528,
-    55299, 56529, 55299, 56530, 55299, 56531, 55299, 56532,
-    55299, 56533, 55299, 56534, 55299, 56535, 55299, 56536,
-    55299, 56537, 55299, 56538, 55299, 56539, 55299, 56540,
-    55299, 56541, 55299, 56542, 55299, 56543, 55299, 56544,
-    55299, 56545, 55299, 56546, 55299, 56547, 55299, 56548,
-    55299, 56549, 55299, 56550, 55299, 56551, 55299, 56552,
-    55299, 56553, 55299, 56554, 55299, 56555, 55299, 56556,
-    55299, 56557, 55299, 56558, 55299, 56559, 55299, 56560,
-    55299, 56561, 55299, 56562, 55300, 56473, 55300, 56506,
-    55300, 56475, 55300, 56506, 55300, 56485, 55300, 56506,
-    55300, 56625, 55300, 56615, 55300, 56626, 55300, 56615,
-    55300, 57159, 55300, 57150, 55300, 57159, 55300, 57175,
-    55301, 56505, 55301, 56506, 55301, 56505, 55301, 56496,
-    55301, 56505, 55301, 56509, 55301, 56760, 55301, 56751,
-    55301, 56761, 55301, 56751, 55302, 56512, 55302, 56513,
-    55302, 56514, 55302, 56515, 55302, 56516, 55302, 56517,
-    55302, 56518, 55302, 56519, 55302, 56520, 55302, 56521,
-    55302, 56522, 55302, 56523, 55302, 56524, 55302, 56525,
-    55302, 56526, 55302, 56527, 55302, 56528, 55302, 56529,
-    55302, 56530, 55302, 56531, 55302, 56532, 55302, 56533,
-    55302, 56534, 55302, 56535, 55302, 56536, 55302, 56537,
-    55302, 56538, 55302, 56539, 55302, 56540, 55302, 56541,
-    55302, 56542, 55302, 56543, 55348, 56663, 55348, 56677,
-    55348, 56664, 55348, 56677, 55348, 56671, 55348, 56686,
-    55348, 56671, 55348, 56687, 55348, 56671, 55348, 56688,
-    55348, 56671, 55348, 56689, 55348, 56671, 55348, 56690,
-    55348, 56761, 55348, 56677, 55348, 56762, 55348, 56677,
-    55348, 56763, 55348, 56686, 55348, 56764, 55348, 56686,
-    55348, 56763, 55348, 56687, 55348, 56764, 55348, 56687,
-    305, 567, 913, 914, 916, 917, 918, 919,
-    921, 922, 923, 924, 925, 926, 927, 929,
-    1012, 932, 934, 935, 936, 8711, 8706, 1013,
-    977, 1008, 981, 1009, 982, 988, 55354, 56610,
-    55354, 56611, 55354, 56612, 55354, 56613, 55354, 56614,
-    55354, 56615, 55354, 56616, 55354, 56617, 55354, 56618,
-    55354, 56619, 55354, 56620, 55354, 56621, 55354, 56622,
-    55354, 56623, 55354, 56624, 55354, 56625, 55354, 56626,
-    55354, 56627, 55354, 56628, 55354, 56629, 55354, 56630,
-    55354, 56631, 55354, 56632, 55354, 56633, 55354, 56634,
-    55354, 56635, 55354, 56636, 55354, 56637, 55354, 56638,
-    55354, 56639, 55354, 56640, 55354, 56641, 55354, 56642,
-    55354, 56643, 1646, 1697, 1647, 48, 46, 48,
-    44, 49, 44, 50, 44, 51, 44, 52,
-    44, 53, 44, 54, 44, 55, 44, 56,
-    44, 57, 44, 40, 65, 41, 40, 66,
-    41, 40, 67, 41, 40, 68, 41, 40,
-    69, 41, 40, 70, 41, 40, 71, 41,
-    40, 72, 41, 40, 73, 41, 40, 74,
-    41, 40, 75, 41, 40, 76, 41, 40,
-    77, 41, 40, 78, 41, 40, 79, 41,
-    40, 80, 41, 40, 81, 41, 40, 82,
-    41, 40, 83, 41, 40, 84, 41, 40,
-    85, 41, 40, 86, 41, 40, 87, 41,
-    40, 88, 41, 40, 89, 41, 40, 90,
-    41, 12308, 83, 12309, 67, 68, 87, 90,
-    72, 86, 83, 68, 83, 83, 80, 80,
-    86, 87, 67, 77, 67, 77, 68, 68,
-    74, 12411, 12363, 12467, 12467, 23383, 21452, 12487,
-    22810, 35299, 20132, 26144, 28961, 21069, 24460, 20877,
-    26032, 21021, 32066, 36009, 22768, 21561, 28436, 25237,
-    25429, 36938, 25351, 25171, 31105, 31354, 21512, 28288,
-    30003, 21106, 21942, 37197, 12308, 26412, 12309, 12308,
-    19977, 12309, 12308, 20108, 12309, 12308, 23433, 12309,
-    12308, 28857, 12309, 12308, 25171, 12309, 12308, 30423,
-    12309, 12308, 21213, 12309, 12308, 25943, 12309, 24471,
-    21487, 20029, 20024, 20033, 55360, 56610, 20320, 20411,
-    20482, 20602, 20633, 20687, 13470, 55361, 56890, 20820,
-    20836, 20855, 55361, 56604, 13497, 20839, 55361, 56651,
-    20887, 20900, 20172, 20908, 55396, 56799, 20995, 13535,
-    21051, 21062, 21111, 13589, 21253, 21254, 21321, 21338,
-    21363, 21373, 21375, 55362, 56876, 28784, 21450, 21471,
-    55362, 57187, 21483, 21489, 21510, 21662, 21560, 21576,
-    21608, 21666, 21750, 21776, 21843, 21859, 21892, 21931,
-    21939, 21954, 22294, 22295, 22097, 22132, 22766, 22478,
-    22516, 22541, 22411, 22578, 22577, 22700, 55365, 56548,
-    22770, 22775, 22790, 22818, 22882, 55365, 57000, 55365,
-    57066, 23020, 23067, 23079, 23000, 23142, 14062, 14076,
-    23304, 23358, 55366, 56776, 23491, 23512, 23539, 55366,
-    57112, 23551, 23558, 24403, 14209, 23648, 23744, 23693,
-    55367, 56804, 23875, 55367, 56806, 23918, 23915, 23932,
-    24033, 24034, 14383, 24061, 24104, 24125, 24169, 14434,
-    55368, 56707, 14460, 24240, 24243, 24246, 55400, 57234,
-    55368, 57137, 33281, 24354, 14535, 55372, 57016, 55384,
-    56794, 24418, 24427, 14563, 24474, 24525, 24535, 24569,
-    24705, 14650, 14620, 55369, 57044, 24775, 24904, 24908,
-    24954, 25010, 24996, 25007, 25054, 25104, 25115, 25181,
-    25265, 25300, 25424, 55370, 57100, 25405, 25340, 25448,
-    25475, 25572, 55370, 57329, 25634, 25541, 25513, 14894,
-    25705, 25726, 25757, 25719, 14956, 25964, 55372, 56330,
-    26083, 26360, 26185, 15129, 15112, 15076, 20882, 20885,
-    26368, 26268, 32941, 17369, 26401, 26462, 26451, 55372,
-    57283, 15177, 26618, 26501, 26706, 55373, 56429, 26766,
-    26655, 26900, 26946, 27043, 27114, 27304, 55373, 56995,
-    27355, 15384, 27425, 55374, 56487, 27476, 15438, 27506,
-    27551, 27579, 55374, 56973, 55367, 56587, 55374, 57082,
-    27726, 55375, 56508, 27839, 27853, 27751, 27926, 27966,
-    28009, 28024, 28037, 55375, 56606, 27956, 28207, 28270,
-    15667, 28359, 55375, 57041, 28153, 28526, 55375, 57182,
-    55375, 57230, 28614, 28729, 28699, 15766, 28746, 28797,
-    28791, 28845, 55361, 56613, 28997, 55376, 56931, 29084,
-    55376, 57259, 29224, 29264, 55377, 56840, 29312, 29333,
-    55377, 57141, 55378, 56340, 29562, 29579, 16044, 29605,
-    16056, 29767, 29788, 29829, 29898, 16155, 29988, 55379,
-    56374, 30014, 55379, 56466, 55368, 56735, 30224, 55379,
-    57249, 55379, 57272, 55380, 56388, 16380, 16392, 55380,
-    56563, 55380, 56562, 55380, 56601, 55380, 56627, 30494,
-    30495, 30603, 16454, 16534, 55381, 56349, 30798, 16611,
-    55381, 56870, 55381, 56986, 55381, 57029, 31211, 16687,
-    31306, 31311, 55382, 56700, 55382, 56999, 31470, 16898,
-    55382, 57259, 31686, 31689, 16935, 55383, 56448, 31954,
-    17056, 31976, 31971, 32000, 55383, 57222, 32099, 17153,
-    32199, 32258, 32325, 17204, 55384, 56872, 55384, 56903,
-    17241, 55384, 57049, 32634, 55384, 57150, 32661, 32762,
-    55385, 56538, 55385, 56611, 32864, 55385, 56744, 32880,
-    55372, 57183, 17365, 32946, 33027, 17419, 33086, 23221,
-    55385, 57255, 55385, 57269, 55372, 57235, 55372, 57244,
-    33284, 36766, 17515, 33425, 33419, 33437, 21171, 33457,
-    33459, 33469, 33510, 55386, 57148, 33565, 33635, 33709,
-    33571, 33725, 33767, 33619, 33738, 33740, 33756, 55387,
-    56374, 55387, 56683, 55387, 56533, 17707, 34033, 34035,
-    34070, 55388, 57290, 34148, 55387, 57132, 17757, 17761,
-    55387, 57265, 55388, 56530, 17771, 34384, 34407, 34409,
-    34473, 34440, 34574, 34530, 34600, 34667, 34694, 17879,
-    34785, 34817, 17913, 34912, 55389, 56935, 35031, 35038,
-    17973, 35066, 13499, 55390, 56494, 55390, 56678, 18110,
-    18119, 35488, 55391, 56488, 36011, 36033, 36123, 36215,
-    55391, 57135, 55362, 56324, 36299, 36284, 36336, 55362,
-    56542, 36564, 55393, 56786, 55393, 56813, 37012, 37105,
-    37137, 55393, 57134, 37147, 37432, 37591, 37592, 37500,
-    37881, 37909, 55394, 57338, 38283, 18837, 38327, 55395,
-    56695, 18918, 38595, 23986, 38691, 55396, 56645, 55396,
-    56858, 19054, 19062, 38880, 55397, 56330, 19122, 55397,
-    56470, 38953, 55397, 56758, 39138, 19251, 39209, 39335,
-    39362, 39422, 19406, 55398, 57136, 40000, 40189, 19662,
-    19693, 40295, 55400, 56526, 19704, 55400, 56581, 55400,
-    56846, 55400, 56977, 19798, 40702, 40709, 40719, 40726,
-    55401, 56832, 192, 193, 194, 195, 196, 199,
-    200, 201, 202, 203, 204, 205, 206, 207,
-    208, 209, 210, 211, 212, 213, 214, 216,
-    217, 218, 219, 220, 221, 222, 376, 256,
-    258, 260, 262, 264, 266, 268, 270, 272,
-    274, 276, 278, 280, 282, 284, 286, 288,
-    290, 292, 296, 298, 300, 302, 306, 308,
-    310, 313, 315, 317, 319, 321, 323, 325,
-    327, 330, 332, 334, 336, 338, 340, 342,
-    344, 346, 348, 350, 352, 354, 356, 358,
-    360, 362, 364, 366, 368, 370, 372, 374,
-    377, 379, 381, 579, 386, 388, 391, 395,
-    401, 502, 408, 573, 544, 416, 418, 420,
-    423, 428, 431, 435, 437, 440, 444, 503,
-    453, 452, 456, 455, 459, 458, 461, 463,
-    465, 467, 469, 471, 473, 475, 478, 480,
-    482, 484, 486, 488, 490, 492, 494, 498,
-    497, 500, 504, 506, 508, 510, 512, 514,
-    516, 518, 520, 522, 524, 526, 528, 530,
-    532, 534, 536, 538, 540, 542, 548, 550,
-    552, 554, 556, 558, 560, 562, 571, 11390,
-    11391, 577, 582, 584, 586, 588, 590, 11375,
-    11373, 11376, 385, 390, 393, 394, 399, 42923,
-    403, 42924, 404, 42893, 42922, 407, 406, 42926,
-    11362, 42925, 412, 11374, 413, 415, 11364, 422,
-    425, 42929, 430, 580, 433, 434, 581, 439,
-    42930, 42928, 880, 882, 886, 1021, 1022, 1023,
-    938, 939, 975, 984, 986, 990, 992, 994,
-    996, 998, 1000, 1002, 1004, 1006, 1017, 895,
-    1015, 1018, 1040, 1041, 1042, 1043, 1044, 1045,
-    1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053,
-    1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061,
-    1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069,
-    1070, 1071, 1024, 1025, 1026, 1027, 1028, 1029,
-    1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037,
-    1038, 1039, 1120, 1122, 1124, 1126, 1128, 1130,
-    1132, 1134, 1136, 1138, 1140, 1142, 1144, 1146,
-    1148, 1150, 1152, 1162, 1164, 1166, 1168, 1170,
-    1172, 1174, 1176, 1178, 1180, 1182, 1184, 1186,
-    1188, 1190, 1192, 1194, 1196, 1198, 1200, 1202,
-    1204, 1206, 1208, 1210, 1212, 1214, 1217, 1219,
-    1221, 1223, 1225, 1227, 1229, 1216, 1232, 1234,
-    1236, 1238, 1240, 1242, 1244, 1246, 1248, 1250,
-    1252, 1254, 1256, 1258, 1260, 1262, 1264, 1266,
-    1268, 1270, 1272, 1274, 1276, 1278, 1280, 1282,
-    1284, 1286, 1288, 1290, 1292, 1294, 1296, 1298,
-    1300, 1302, 1304, 1306, 1308, 1310, 1312, 1314,
-    1316, 1318, 1320, 1322, 1324, 1326, 1329, 1330,
-    1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338,
-    1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346,
-    1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354,
-    1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362,
-    1363, 1364, 1365, 1366, 43888, 43889, 43890, 43891,
-    43892, 43893, 43894, 43895, 43896, 43897, 43898, 43899,
-    43900, 43901, 43902, 43903, 43904, 43905, 43906, 43907,
-    43908, 43909, 43910, 43911, 43912, 43913, 43914, 43915,
-    43916, 43917, 43918, 43919, 43920, 43921, 43922, 43923,
-    43924, 43925, 43926, 43927, 43928, 43929, 43930, 43931,
-    43932, 43933, 43934, 43935, 43936, 43937, 43938, 43939,
-    43940, 43941, 43942, 43943, 43944, 43945, 43946, 43947,
-    43948, 43949, 43950, 43951, 43952, 43953, 43954, 43955,
-    43956, 43957, 43958, 43959, 43960, 43961, 43962, 43963,
-    43964, 43965, 43966, 43967, 5112, 5113, 5114, 5115,
-    5116, 5117, 42570, 42877, 11363, 7680, 7682, 7684,
-    7686, 7688, 7690, 7692, 7694, 7696, 7698, 7700,
-    7702, 7704, 7706, 7708, 7710, 7712, 7714, 7716,
-    7718, 7720, 7722, 7724, 7726, 7728, 7730, 7732,
-    7734, 7736, 7738, 7740, 7742, 7744, 7746, 7748,
-    7750, 7752, 7754, 7756, 7758, 7760, 7762, 7764,
-    7766, 7768, 7770, 7772, 7774, 7776, 7778, 7780,
-    7782, 7784, 7786, 7788, 7790, 7792, 7794, 7796,
-    7798, 7800, 7802, 7804, 7806, 7808, 7810, 7812,
-    7814, 7816, 7818, 7820, 7822, 7824, 7826, 7828,
-    7840, 7842, 7844, 7846, 7848, 7850, 7852, 7854,
-    7856, 7858, 7860, 7862, 7864, 7866, 7868, 7870,
-    7872, 7874, 7876, 7878, 7880, 7882, 7884, 7886,
-    7888, 7890, 7892, 7894, 7896, 7898, 7900, 7902,
-    7904, 7906, 7908, 7910, 7912, 7914, 7916, 7918,
-    7920, 7922, 7924, 7926, 7928, 7930, 7932, 7934,
-    7944, 7945, 7946, 7947, 7948, 7949, 7950, 7951,
-    7960, 7961, 7962, 7963, 7964, 7965, 7976, 7977,
-    7978, 7979, 7980, 7981, 7982, 7983, 7992, 7993,
-    7994, 7995, 7996, 7997, 7998, 7999, 8008, 8009,
-    8010, 8011, 8012, 8013, 8025, 8027, 8029, 8031,
-    8040, 8041, 8042, 8043, 8044, 8045, 8046, 8047,
-    8122, 8123, 8136, 8137, 8138, 8139, 8154, 8155,
-    8184, 8185, 8170, 8171, 8186, 8187, 8072, 8073,
-    8074, 8075, 8076, 8077, 8078, 8079, 8088, 8089,
-    8090, 8091, 8092, 8093, 8094, 8095, 8104, 8105,
-    8106, 8107, 8108, 8109, 8110, 8111, 8120, 8121,
-    8124, 8140, 8152, 8153, 8168, 8169, 8172, 8188,
-    8498, 8544, 8545, 8546, 8547, 8548, 8549, 8550,
-    8551, 8552, 8553, 8554, 8555, 8556, 8557, 8558,
-    8559, 8579, 9398, 9399, 9400, 9401, 9402, 9403,
-    9404, 9405, 9406, 9407, 9408, 9409, 9410, 9411,
-    9412, 9413, 9414, 9415, 9416, 9417, 9418, 9419,
-    9420, 9421, 9422, 9423, 11264, 11265, 11266, 11267,
-    11268, 11269, 11270, 11271, 11272, 11273, 11274, 11275,
-    11276, 11277, 11278, 11279, 11280, 11281, 11282, 11283,
-    11284, 11285, 11286, 11287, 11288, 11289, 11290, 11291,
-    11292, 11293, 11294, 11295, 11296, 11297, 11298, 11299,
-    11300, 11301, 11302, 11303, 11304, 11305, 11306, 11307,
-    11308, 11309, 11310, 11360, 570, 574, 11367, 11369,
-    11371, 11378, 11381, 11392, 11394, 11396, 11398, 11400,
-    11402, 11404, 11406, 11408, 11410, 11412, 11414, 11416,
-    11418, 11420, 11422, 11424, 11426, 11428, 11430, 11432,
-    11434, 11436, 11438, 11440, 11442, 11444, 11446, 11448,
-    11450, 11452, 11454, 11456, 11458, 11460, 11462, 11464,
-    11466, 11468, 11470, 11472, 11474, 11476, 11478, 11480,
-    11482, 11484, 11486, 11488, 11490, 11499, 11501, 11506,
-    4256, 4257, 4258, 4259, 4260, 4261, 4262, 4263,
-    4264, 4265, 4266, 4267, 4268, 4269, 4270, 4271,
-    4272, 4273, 4274, 4275, 4276, 4277, 4278, 4279,
-    4280, 4281, 4282, 4283, 4284, 4285, 4286, 4287,
-    4288, 4289, 4290, 4291, 4292, 4293, 4295, 4301,
-    42560, 42562, 42564, 42566, 42568, 42572, 42574, 42576,
-    42578, 42580, 42582, 42584, 42586, 42588, 42590, 42592,
-    42594, 42596, 42598, 42600, 42602, 42604, 42624, 42626,
-    42628, 42630, 42632, 42634, 42636, 42638, 42640, 42642,
-    42644, 42646, 42648, 42650, 42786, 42788, 42790, 42792,
-    42794, 42796, 42798, 42802, 42804, 42806, 42808, 42810,
-    42812, 42814, 42816, 42818, 42820, 42822, 42824, 42826,
-    42828, 42830, 42832, 42834, 42836, 42838, 42840, 42842,
-    42844, 42846, 42848, 42850, 42852, 42854, 42856, 42858,
-    42860, 42862, 42873, 42875, 42878, 42880, 42882, 42884,
-    42886, 42891, 42896, 42898, 42902, 42904, 42906, 42908,
-    42910, 42912, 42914, 42916, 42918, 42920, 42932, 42934,
-    42931, 65313, 65314, 65315, 65316, 65317, 65318, 65319,
-    65320, 65321, 65322, 65323, 65324, 65325, 65326, 65327,
-    65328, 65329, 65330, 65331, 65332, 65333, 65334, 65335,
-    65336, 65337, 65338, 55297, 56320, 55297, 56321, 55297,
-    56322, 55297, 56323, 55297, 56324, 55297, 56325, 55297,
-    56326, 55297, 56327, 55297, 56328, 55297, 56329, 55297,
-    56330, 55297, 56331, 55297, 56332, 55297, 56333, 55297,
-    56334, 55297, 56335, 55297, 56336, 55297, 56337, 55297,
-    56338, 55297, 56339, 55297, 56340, 55297, 56341, 55297,
-    56342, 55297, 56343, 55297, 56344, 55297, 56345, 55297,
-    56346, 55297, 56347, 55297, 56348, 55297, 56349, 55297,
-    56350, 55297, 56351, 55297, 56352, 55297, 56353, 55297,
-    56354, 55297, 56355, 55297, 56356, 55297, 56357, 55297,
-    56358, 55297, 56359, 55297, 56496, 55297, 56497, 55297,
-    56498, 55297, 56499, 55297, 56500, 55297, 56501, 55297,
-    56502, 55297, 56503, 55297, 56504, 55297, 56505, 55297,
-    56506, 55297, 56507, 55297, 56508, 55297, 56509, 55297,
-    56510, 55297, 56511, 55297, 56512, 55297, 56513, 55297,
-    56514, 55297, 56515, 55297, 56516, 55297, 56517, 55297,
-    56518, 55297, 56519, 55297, 56520, 55297, 56521, 55297,
-    56522, 55297, 56523, 55297, 56524, 55297, 56525, 55297,
-    56526, 55297, 56527, 55297, 56528, 55297, 56529, 55297,
-    56530, 55297, 56531, 55299, 56448, 55299, 56449, 55299,
-    56450, 55299, 56451, 55299, 56452, 55299, 56453, 55299,
-    56454, 55299, 56455, 55299, 56456, 55299, 56457, 55299,
-    56458, 55299, 56459, 55299, 56460, 55299, 56461, 55299,
-    56462, 55299, 56463, 55299, 56464, 55299, 56465, 55299,
-    56466, 55299, 56467, 55299, 56468, 55299, 56469, 55299,
-    56470, 55299, 56471, 55299, 56472, 55299, 56473, 55299,
-    56474, 55299, 56475, 55299, 56476, 55299, 56477, 55299,
-    56478, 55299, 56479, 55299, 56480, 55299, 56481, 55299,
-    56482, 55299, 56483, 55299, 56484, 55299, 56485, 55299,
-    56486, 55299, 56487, 55299, 56488, 55299, 56489, 55299,
-    56490, 55299, 56491, 55299, 56492, 55299, 56493, 55299,
-    56494, 55299, 56495, 55299, 56496, 55299, 56497, 55299,
-    56498, 55302, 56480, 55302, 56481, 55302, 56482, 55302,
-    56483, 55302, 56484, 55302, 56485, 55302, 56486, 55302,
-    56487, 55302, 56488, 55302, 56489, 55302, 56490, 55302,
-    56491, 55302, 56492, 55302, 56493, 55302, 56494, 55302,
-    56495, 55302, 56496, 55302, 56497, 55302, 56498, 55302,
-    56499, 55302, 56500, 55302, 56501, 55302, 56502, 55302,
-    56503, 55302, 56504, 55302, 56505, 55302, 56506, 55302,
-    56507, 55302, 56508, 55302, 56509, 55302, 56510, 55302,
-    56511, 55354, 56576, 55354, 56577, 55354, 56578, 55354,
-    56579, 55354, 56580, 55354, 56581, 55354, 56582, 55354,
-    56583, 55354, 56584, 55354, 56585, 55354, 56586, 55354,
-    56587, 55354, 56588, 55354, 56589, 55354, 56590, 55354,
-    56591, 55354, 56592, 55354, 56593, 55354, 56594, 55354,
-    56595, 55354, 56596, 55354, 56597, 55354, 56598, 55354,
-    56599, 55354, 56600, 55354, 56601, 55354, 56602, 55354,
-    56603, 55354, 56604, 55354, 56605, 55354, 56606, 55354,
-    56607, 55354, 56608, 55354, 56609,
-};
-
-static const UInt16 utf8_stage1table[] = {
-    0, 256, 512, 768, 1024, 1280, 1536,
-    1792, 2048, 2304, 2560, 2816, 3072, 3328, 3584,
-    3840, 4096, 4352, 4608, 4864, 5120, 5376, 5632,
-    5888, 6144, 6400, 6656, 6912, 7168, 7424, 7680,
-    7936, 8192, 8448, 8704, 8960, 9216, 9472, 9728,
-    9984, 10240, 10496, 10752, 11008, 11264, 11520, 11776,
-    12032, 12288, 12544, 12800, 13056, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13568, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13824, 14080, 13312, 13312, 13312, 14336, 13312, 14592,
-    14848, 15104, 15360, 15616, 15872, 16128, 16384, 16640,
-    16896, 17152, 17408, 17664, 16128, 16384, 16640, 16896,
-    17152, 17408, 17664, 16128, 16384, 16640, 16896, 17152,
-    17408, 17664, 16128, 16384, 16640, 16896, 17152, 17408,
-    17664, 16128, 16384, 16640, 16896, 17152, 17408, 17664,
-    16128, 16384, 16640, 16896, 17152, 17408, 17664, 16128,
-    17920, 18176, 18176, 18176, 18176, 18176, 18176, 18176,
-    18176, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18688, 18944, 19200, 19456, 19712, 19968,
-    20224, 20480, 20736, 20992, 21248, 21504, 21760, 22016,
-    22272, 22528, 22784, 23040, 23296, 23552, 23808, 24064,
-    23808, 24320, 24576, 24832, 25088, 25344, 25600, 25856,
-    26112, 26368, 23808, 26624, 23808, 26880, 23808, 23808,
-    23808, 27136, 27136, 27136, 27392, 27648, 27904, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 27136, 27136, 27136, 27136, 28160, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 27136, 27136, 28416,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 27136, 27136, 28672, 28928, 23808, 23808, 23808,
-    29184, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    29440, 13312, 13312, 29696, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 29952, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 30208, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 30464, 30720, 30976, 31232, 31488, 31744, 32000,
-    32256, 10240, 10240, 32512, 23808, 23808, 23808, 23808,
-    23808, 32768, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 33024, 33280, 23808, 23808, 23808, 23808, 33536,
-    23808, 33792, 34048, 34304, 34560, 34816, 35072, 35328,
-    35584, 35840, 36096, 23808, 23808, 23808, 23808, 23808,
-    23808, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 36352,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    36608, 36864, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 13312,
-    13312, 13312, 13312, 13312, 13312, 13312, 13312, 37120,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 37376, 37632, 37888, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 38144, 38400, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 23808, 23808, 23808, 23808, 23808, 23808, 23808,
-    23808, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    38656, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    18432, 18432, 18432, 18432, 18432, 18432, 18432, 18432,
-    38656, 
-};
-
-static const UInt16 utf8_stage2table[] = {
-    1, 2, 2, 2, 2, 2, 2,
-    2, 2, 3, 4, 3, 5, 6, 2,
-    2, 2, 2, 2, 2, 2, 2, 2,
-    2, 2, 2, 2, 2, 7, 7, 7,
-    3, 8, 9, 9, 10, 11, 10, 9,
-    9, 12, 13, 9, 14, 15, 16, 15,
-    15, 17, 17, 17, 17, 17, 17, 17,
-    17, 17, 17, 15, 9, 18, 19, 20,
-    9, 9, 21, 22, 23, 24, 25, 26,
-    27, 28, 29, 30, 31, 32, 33, 34,
-    35, 36, 37, 38, 39, 40, 41, 42,
-    43, 44, 45, 46, 12, 9, 13, 47,
-    48, 47, 49, 50, 51, 52, 53, 54,
-    55, 56, 57, 58, 59, 60, 61, 62,
-    63, 64, 65, 66, 67, 68, 69, 70,
-    71, 72, 73, 74, 12, 75, 13, 75,
-    2, 2, 2, 2, 2, 2, 7, 2,
-    2, 2, 2, 2, 2, 2, 2, 2,
-    2, 2, 2, 2, 2, 2, 2, 2,
-    2, 2, 2, 2, 2, 2, 2, 2,
-    2, 76, 9, 11, 11, 11, 11, 77,
-    9, 78, 77, 79, 80, 75, 81, 77,
-    82, 83, 84, 85, 86, 87, 88, 9,
-    9, 89, 90, 91, 92, 93, 94, 95,
-    9, 96, 97, 98, 99, 100, 101, 102,
-    103, 104, 105, 106, 107, 108, 109, 110,
-    111, 112, 113, 114, 115, 116, 117, 118,
-    75, 119, 120, 121, 122, 123, 124, 125,
-    126, 127, 128, 129, 130, 131, 132, 133,
-    134, 135, 136, 137, 138, 139, 140, 141,
-    142, 143, 144, 145, 146, 147, 148, 149,
-    75, 150, 151, 152, 153, 154, 155, 156,
-    157, 158, 159, 160, 161, 162, 163, 164,
-    165, 166, 167, 168, 169, 170, 171, 172,
-    173, 174, 175, 176, 177, 178, 179, 180,
-    181, 182, 183, 184, 185, 186, 187, 188,
-    189, 190, 191, 192, 193, 194, 195, 196,
-    197, 198, 199, 200, 201, 202, 203, 204,
-    205, 206, 207, 208, 209, 210, 211, 212,
-    213, 214, 215, 216, 217, 218, 219, 220,
-    221, 222, 223, 224, 225, 226, 227, 228,
-    229, 230, 231, 232, 233, 234, 235, 236,
-    237, 238, 239, 240, 241, 242, 243, 244,
-    245, 246, 247, 248, 249, 250, 251, 252,
-    253, 254, 255, 256, 257, 258, 259, 260,
-    261, 262, 263, 264, 265, 266, 267, 268,
-    269, 270, 271, 272, 273, 274, 275, 276,
-    277, 278, 279, 280, 281, 282, 283, 284,
-    285, 286, 287, 288, 289, 290, 291, 292,
-    293, 294, 295, 296, 297, 298, 214, 299,
-    300, 301, 302, 303, 304, 305, 306, 307,
-    308, 309, 310, 311, 214, 312, 313, 314,
-    315, 316, 317, 318, 319, 320, 321, 322,
-    323, 324, 325, 214, 214, 326, 327, 328,
-    329, 330, 331, 332, 333, 334, 335, 336,
-    337, 338, 339, 214, 340, 341, 342, 214,
-    343, 340, 340, 340, 340, 344, 345, 346,
-    347, 348, 349, 350, 351, 352, 353, 354,
-    355, 356, 357, 358, 359, 360, 361, 362,
-    363, 364, 365, 366, 367, 368, 369, 370,
-    371, 372, 373, 374, 375, 376, 377, 378,
-    379, 380, 381, 382, 383, 384, 385, 386,
-    387, 388, 389, 390, 391, 392, 393, 394,
-    395, 396, 397, 398, 399, 400, 401, 402,
-    403, 404, 405, 406, 407, 408, 409, 410,
-    411, 412, 413, 414, 415, 416, 417, 418,
-    419, 420, 421, 422, 423, 424, 425, 426,
-    427, 428, 429, 430, 431, 432, 433, 434,
-    435, 436, 214, 437, 438, 439, 440, 441,
-    442, 443, 444, 445, 446, 447, 448, 449,
-    450, 451, 452, 453, 454, 214, 214, 214,
-    214, 214, 214, 455, 456, 457, 458, 459,
-    460, 461, 462, 463, 464, 465, 466, 467,
-    468, 469, 470, 471, 472, 473, 474, 475,
-    476, 477, 478, 479, 480, 481, 214, 482,
-    483, 214, 484, 214, 485, 486, 214, 214,
-    214, 487, 488, 214, 489, 214, 490, 491,
-    214, 492, 493, 494, 495, 496, 214, 214,
-    497, 214, 498, 499, 214, 214, 500, 214,
-    214, 214, 214, 214, 214, 214, 501, 214,
-    214, 502, 214, 214, 503, 214, 214, 214,
-    504, 505, 506, 507, 508, 509, 214, 214,
-    214, 214, 214, 510, 214, 340, 214, 214,
-    214, 214, 214, 214, 214, 214, 511, 512,
-    214, 214, 214, 214, 214, 214, 214, 214,
-    214, 214, 214, 214, 214, 214, 214, 214,
-    214, 513, 514, 515, 516, 517, 518, 519,
-    520, 521, 522, 522, 523, 523, 523, 523,
-    523, 523, 523, 47, 47, 47, 47, 522,
-    522, 522, 522, 522, 522, 522, 522, 522,
-    522, 523, 523, 47, 47, 47, 47, 47,
-    47, 524, 525, 526, 527, 528, 529, 47,
-    47, 530, 531, 532, 533, 534, 47, 47,
-    47, 47, 47, 47, 47, 522, 47, 523,
-    47, 47, 47, 47, 47, 47, 47, 47,
-    47, 47, 47, 47, 47, 47, 47, 47,
-    47, 535, 536, 537, 538, 539, 540, 541,
-    542, 543, 544, 545, 546, 547, 540, 540,
-    548, 540, 549, 540, 550, 551, 552, 553,
-    553, 553, 553, 552, 554, 553, 553, 553,
-    553, 553, 555, 555, 556, 557, 558, 559,
-    560, 561, 553, 553, 553, 553, 562, 563,
-    553, 564, 565, 553, 553, 566, 566, 566,
-    566, 567, 553, 553, 553, 553, 540, 540,
-    540, 568, 569, 570, 571, 572, 573, 540,
-    553, 553, 553, 540, 540, 540, 553, 553,
-    574, 540, 540, 540, 553, 553, 553, 553,
-    540, 552, 553, 553, 540, 575, 576, 576,
-    575, 576, 576, 575, 540, 540, 540, 540,
-    540, 540, 540, 540, 540, 540, 540, 540,
-    540, 577, 578, 579, 580, 581, 47, 582,
-    583, 0, 0, 584, 585, 586, 587, 588,
-    589, 0, 0, 0, 0, 87, 590, 591,
-    592, 593, 594, 595, 0, 596, 0, 597,
-    598, 599, 600, 601, 602, 603, 604, 605,
-    606, 607, 608, 609, 610, 611, 612, 613,
-    614, 615, 616, 0, 617, 618, 619, 620,
-    621, 622, 623, 624, 625, 626, 627, 628,
-    629, 630, 631, 632, 633, 634, 635, 636,
-    637, 638, 639, 640, 641, 642, 643, 644,
-    645, 646, 647, 648, 649, 650, 651, 652,
-    653, 654, 655, 656, 657, 658, 659, 660,
-    661, 662, 663, 664, 665, 666, 667, 668,
-    669, 670, 671, 672, 673, 674, 675, 676,
-    677, 678, 679, 680, 681, 682, 683, 684,
-    685, 686, 687, 688, 689, 690, 691, 692,
-    693, 694, 695, 696, 697, 698, 699, 75,
-    700, 701, 702, 703, 704, 214, 705, 706,
-    707, 708, 709, 710, 711, 712, 713, 714,
-    715, 716, 717, 718, 719, 720, 721, 722,
-    723, 724, 725, 726, 727, 728, 729, 730,
-    731, 732, 733, 734, 735, 736, 737, 738,
-    739, 740, 741, 742, 743, 744, 745, 746,
-    747, 748, 749, 750, 751, 752, 753, 754,
-    755, 756, 757, 758, 759, 760, 761, 762,
-    763, 764, 765, 766, 767, 768, 769, 770,
-    771, 772, 773, 774, 775, 776, 777, 778,
-    779, 780, 781, 782, 783, 784, 785, 786,
-    787, 788, 789, 790, 791, 792, 793, 794,
-    795, 796, 797, 798, 799, 800, 801, 802,
-    803, 804, 805, 806, 807, 808, 809, 810,
-    811, 812, 813, 814, 815, 816, 817, 818,
-    819, 820, 821, 822, 823, 824, 825, 826,
-    827, 828, 829, 830, 831, 832, 833, 834,
-    835, 836, 837, 838, 540, 540, 540, 540,
-    540, 839, 839, 840, 841, 842, 843, 844,
-    845, 846, 847, 848, 849, 850, 851, 852,
-    853, 854, 855, 856, 857, 858, 859, 860,
-    861, 862, 863, 864, 865, 866, 867, 868,
-    869, 870, 871, 872, 873, 874, 875, 876,
-    877, 878, 879, 880, 881, 882, 883, 884,
-    885, 886, 887, 888, 889, 890, 891, 892,
-    893, 894, 895, 896, 897, 898, 899, 900,
-    901, 902, 903, 904, 905, 906, 907, 908,
-    909, 910, 911, 912, 913, 914, 915, 916,
-    917, 918, 919, 920, 921, 922, 923, 924,
-    925, 926, 927, 928, 929, 930, 931, 932,
-    933, 934, 935, 936, 937, 938, 939, 940,
-    941, 942, 943, 944, 945, 946, 947, 948,
-    949, 950, 951, 952, 953, 954, 955, 956,
-    957, 958, 959, 960, 961, 962, 963, 964,
-    965, 966, 967, 968, 969, 970, 971, 972,
-    973, 974, 975, 976, 977, 978, 979, 980,
-    981, 982, 983, 984, 985, 986, 987, 988,
-    989, 990, 991, 992, 993, 994, 995, 996,
-    997, 998, 999, 1000, 1001, 1002, 1003, 1004,
-    1005, 0, 1006, 1007, 1008, 1009, 1010, 1011,
-    1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019,
-    1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027,
-    1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035,
-    1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043,
-    0, 0, 523, 1044, 1044, 1044, 1044, 1044,
-    1044, 0, 1045, 1046, 1047, 1048, 1049, 1050,
-    1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058,
-    1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066,
-    1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074,
-    1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082,
-    1083, 0, 1044, 1084, 0, 0, 1085, 1085,
-    11, 0, 553, 540, 540, 540, 540, 553,
-    540, 540, 540, 1086, 553, 540, 540, 540,
-    540, 540, 540, 553, 553, 553, 553, 553,
-    553, 540, 540, 553, 540, 540, 1086, 1087,
-    540, 1088, 1089, 1090, 1091, 1092, 1093, 1094,
-    1095, 1096, 1097, 1097, 1098, 1099, 1100, 1101,
-    1102, 1103, 1104, 1105, 1103, 540, 553, 1103,
-    1096, 0, 0, 0, 0, 0, 0, 0,
-    0, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 0, 0, 0, 0,
-    0, 1106, 1106, 1106, 1103, 1103, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1107, 1108, 1108, 1108, 1107, 1107, 1109,
-    1109, 1110, 10, 10, 1111, 15, 1112, 1085,
-    1085, 540, 540, 540, 540, 540, 540, 540,
-    540, 1113, 1114, 1115, 1112, 1116, 0, 1117,
-    1112, 1118, 1118, 1119, 1120, 1121, 1122, 1123,
-    1124, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
-    1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
-    1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
-    1118, 1125, 1118, 1118, 1118, 1118, 1118, 1118,
-    1126, 1127, 1118, 1128, 1129, 1130, 1131, 1113,
-    1114, 1115, 1132, 1133, 1134, 1135, 1136, 553,
-    540, 540, 540, 540, 540, 553, 540, 540,
-    553, 1137, 1137, 1137, 1137, 1137, 1137, 1137,
-    1137, 1137, 1137, 10, 1138, 1138, 1112, 1118,
-    1118, 1139, 1118, 1118, 1118, 1118, 1140, 1141,
-    1142, 1143, 1118, 1118, 1118, 1118, 1118, 1118,
-    1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
-    1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
-    1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
-    1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
-    1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
-    1118, 1118, 1118, 1126, 1118, 1118, 1118, 1118,
-    1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
-    1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
-    1118, 1144, 1145, 1146, 1118, 1118, 1118, 1118,
-    1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
-    1118, 1118, 1118, 1147, 1148, 1112, 1149, 540,
-    540, 540, 540, 540, 540, 540, 1108, 1085,
-    540, 540, 540, 540, 553, 540, 1125, 1125,
-    540, 540, 1085, 553, 540, 540, 553, 1118,
-    1118, 17, 17, 17, 17, 17, 17, 17,
-    17, 17, 17, 1118, 1118, 1118, 1150, 1150,
-    1126, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
-    1117, 1117, 1117, 1117, 1117, 1117, 1117, 0,
-    1151, 1126, 1152, 1126, 1126, 1126, 1126, 1126,
-    1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126,
-    1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126,
-    1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126,
-    1126, 540, 553, 540, 540, 553, 540, 540,
-    553, 553, 553, 540, 553, 553, 540, 553,
-    540, 540, 540, 553, 540, 553, 540, 553,
-    540, 553, 540, 540, 0, 0, 1126, 1126,
-    1126, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
-    1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
-    1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
-    1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
-    1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
-    1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
-    1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
-    1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
-    1118, 1126, 1118, 1118, 1118, 1118, 1118, 1118,
-    1118, 1118, 1118, 1118, 1118, 1118, 1126, 1126,
-    1126, 1118, 1118, 1118, 1118, 1118, 1118, 1153,
-    1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153,
-    1153, 1153, 1118, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1154, 1154, 1154, 1154, 1154, 1154, 1154,
-    1154, 1154, 1154, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 540, 540, 540, 540,
-    540, 540, 540, 553, 540, 1155, 1155, 77,
-    9, 9, 9, 1155, 0, 0, 0, 0,
-    0, 1156, 1156, 1156, 1156, 1156, 1156, 1156,
-    1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156,
-    1156, 1156, 1156, 1156, 1156, 1156, 1156, 540,
-    540, 540, 540, 1157, 540, 540, 540, 540,
-    540, 540, 540, 540, 540, 1157, 540, 540,
-    540, 1157, 540, 540, 540, 540, 540, 0,
-    0, 1158, 1158, 1158, 1158, 1158, 1158, 1158,
-    1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158,
-    0, 1156, 1156, 1156, 1156, 1156, 1156, 1156,
-    1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156,
-    1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156,
-    1156, 1156, 553, 553, 553, 0, 0, 1158,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
-    1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
-    1118, 1118, 1118, 1118, 1118, 1118, 0, 1118,
-    1118, 1118, 1118, 1118, 1118, 1118, 1118, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 540, 540, 540,
-    540, 540, 540, 540, 540, 540, 540, 540,
-    540, 540, 540, 1107, 553, 540, 540, 553,
-    540, 540, 553, 540, 540, 540, 553, 553,
-    553, 1129, 1130, 1131, 540, 540, 540, 553,
-    540, 540, 553, 553, 540, 540, 540, 540,
-    540, 1153, 1153, 1153, 1159, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1161, 1162, 1160, 1160, 1160, 1160, 1160,
-    1160, 1163, 1164, 1160, 1165, 1166, 1160, 1160,
-    1160, 1160, 1160, 1153, 1159, 1167, 1160, 1159,
-    1159, 1159, 1153, 1153, 1153, 1153, 1153, 1153,
-    1153, 1153, 1159, 1159, 1159, 1159, 1168, 1159,
-    1159, 1160, 540, 553, 540, 540, 1153, 1153,
-    1153, 1169, 1170, 1171, 1172, 1173, 1174, 1175,
-    1176, 1160, 1160, 1153, 1153, 1177, 1177, 1178,
-    1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1177, 1179, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1153, 1159, 1159, 0, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 0, 0,
-    1160, 1160, 0, 0, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 0, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 0, 1160, 0, 0, 0, 1160,
-    1160, 1160, 1160, 0, 0, 1180, 1160, 1181,
-    1159, 1159, 1153, 1153, 1153, 1153, 0, 0,
-    1182, 1159, 0, 0, 1183, 1184, 1168, 1160,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    1185, 0, 0, 0, 0, 1186, 1187, 0,
-    1188, 1160, 1160, 1153, 1153, 0, 0, 1178,
-    1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1160, 1160, 1189, 1189, 1190, 1190, 1190,
-    1190, 1190, 1190, 1191, 1189, 0, 0, 0,
-    0, 0, 1153, 1153, 1159, 0, 1160, 1160,
-    1160, 1160, 1160, 1160, 0, 0, 0, 0,
-    1160, 1160, 0, 0, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 0, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 0, 1160, 1192, 0, 1160, 1193,
-    0, 1160, 1160, 0, 0, 1180, 0, 1159,
-    1159, 1159, 1153, 1153, 0, 0, 0, 0,
-    1153, 1153, 0, 0, 1153, 1153, 1168, 0,
-    0, 0, 1153, 0, 0, 0, 0, 0,
-    0, 0, 1194, 1195, 1196, 1160, 0, 1197,
-    0, 0, 0, 0, 0, 0, 0, 1178,
-    1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1153, 1153, 1160, 1160, 1160, 1153, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 1153, 1153, 1159, 0, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 0,
-    1160, 1160, 1160, 0, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 0, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 0, 1160, 1160, 0, 1160, 1160,
-    1160, 1160, 1160, 0, 0, 1180, 1160, 1159,
-    1159, 1159, 1153, 1153, 1153, 1153, 1153, 0,
-    1153, 1153, 1159, 0, 1159, 1159, 1168, 0,
-    0, 1160, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1153, 1153, 0, 0, 1178,
-    1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1177, 1189, 0, 0, 0, 0, 0,
-    0, 0, 1160, 0, 0, 0, 0, 0,
-    0, 0, 1153, 1159, 1159, 0, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 0, 0,
-    1160, 1160, 0, 0, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 0, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 0, 1160, 1160, 0, 1160, 1160,
-    1160, 1160, 1160, 0, 0, 1180, 1160, 1198,
-    1153, 1159, 1153, 1153, 1153, 1153, 0, 0,
-    1199, 1200, 0, 0, 1201, 1202, 1168, 0,
-    0, 0, 0, 0, 0, 0, 0, 1203,
-    1204, 0, 0, 0, 0, 1205, 1206, 0,
-    1160, 1160, 1160, 1153, 1153, 0, 0, 1178,
-    1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1191, 1160, 1190, 1190, 1190, 1190, 1190,
-    1190, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 1153, 1160, 0, 1160, 1160,
-    1160, 1160, 1160, 1160, 0, 0, 0, 1160,
-    1160, 1160, 0, 1207, 1160, 1208, 1160, 0,
-    0, 0, 1160, 1160, 0, 1160, 0, 1160,
-    1160, 0, 0, 0, 1160, 1160, 0, 0,
-    0, 1160, 1160, 1160, 0, 0, 0, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 0, 0, 0, 0, 1209,
-    1159, 1153, 1159, 1159, 0, 0, 0, 1210,
-    1211, 1159, 0, 1212, 1213, 1214, 1168, 0,
-    0, 1160, 0, 0, 0, 0, 0, 0,
-    1215, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 1178,
-    1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1190, 1190, 1190, 1085, 1085, 1085, 1085,
-    1085, 1085, 1189, 1085, 0, 0, 0, 0,
-    0, 1153, 1159, 1159, 1159, 0, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 0, 1160,
-    1160, 1160, 0, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 0, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 0, 0, 0, 1160, 1153,
-    1153, 1153, 1159, 1159, 1159, 1159, 0, 1216,
-    1153, 1217, 0, 1153, 1153, 1153, 1168, 0,
-    0, 0, 0, 0, 0, 0, 1218, 1219,
-    0, 1160, 1160, 1160, 0, 0, 0, 0,
-    0, 1160, 1160, 1153, 1153, 0, 0, 1178,
-    1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 0, 0, 0, 0, 0, 0, 0,
-    0, 1220, 1220, 1220, 1220, 1220, 1220, 1220,
-    1191, 1160, 1153, 1159, 1159, 0, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 0, 1160,
-    1160, 1160, 0, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 0, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 0, 1160, 1160,
-    1160, 1160, 1160, 0, 0, 1180, 1160, 1159,
-    1221, 1222, 1159, 1223, 1159, 1159, 0, 1224,
-    1225, 1226, 0, 1227, 1228, 1153, 1168, 0,
-    0, 0, 0, 0, 0, 0, 1229, 1230,
-    0, 0, 0, 0, 0, 0, 0, 1160,
-    0, 1160, 1160, 1153, 1153, 0, 0, 1178,
-    1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 0, 1160, 1160, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 1153, 1159, 1159, 0, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 0, 1160,
-    1160, 1160, 0, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 0, 0, 1160, 1231,
-    1159, 1159, 1153, 1153, 1153, 1153, 0, 1232,
-    1233, 1159, 0, 1234, 1235, 1236, 1168, 1237,
-    1191, 0, 0, 0, 0, 1160, 1160, 1160,
-    1238, 1190, 1190, 1190, 1190, 1190, 1190, 1190,
-    1160, 1160, 1160, 1153, 1153, 0, 0, 1178,
-    1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1190, 1190, 1190, 1190, 1190, 1190, 1190,
-    1190, 1190, 1191, 1160, 1160, 1160, 1160, 1160,
-    1160, 0, 0, 1159, 1159, 0, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    0, 0, 0, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 0, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 0, 1160, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    0, 0, 0, 1239, 0, 0, 0, 0,
-    1240, 1159, 1159, 1153, 1153, 1153, 0, 1153,
-    0, 1159, 1241, 1242, 1159, 1243, 1244, 1245,
-    1246, 0, 0, 0, 0, 0, 0, 1178,
-    1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 0, 0, 1159, 1159, 1177, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 1153, 340, 1247, 1153, 1153, 1153,
-    1153, 1248, 1248, 1168, 0, 0, 0, 0,
-    11, 340, 340, 340, 340, 340, 340, 523,
-    1153, 1249, 1249, 1249, 1249, 1153, 1153, 1153,
-    1044, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-    1250, 1250, 1250, 1044, 1044, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 340, 340, 0, 340, 0, 0,
-    340, 340, 0, 340, 0, 0, 340, 0,
-    0, 0, 0, 0, 0, 340, 340, 340,
-    340, 0, 340, 340, 340, 340, 340, 340,
-    340, 0, 340, 340, 340, 0, 340, 0,
-    340, 0, 0, 340, 340, 0, 340, 340,
-    340, 340, 1153, 340, 1251, 1153, 1153, 1153,
-    1153, 1252, 1252, 0, 1153, 1153, 340, 0,
-    0, 340, 340, 340, 340, 340, 0, 523,
-    0, 1253, 1253, 1253, 1253, 1153, 1153, 0,
-    0, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-    1250, 1250, 1250, 0, 0, 1254, 1255, 340,
-    340, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1191, 1191, 1191, 1177, 1177, 1177,
-    1177, 1177, 1177, 1177, 1177, 1256, 1177, 1177,
-    1177, 1177, 1177, 1177, 1191, 1177, 1191, 1191,
-    1191, 553, 553, 1191, 1191, 1191, 1191, 1191,
-    1191, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1178, 1178, 1190, 1190, 1190, 1190, 1190,
-    1190, 1190, 1190, 1190, 1190, 1191, 553, 1191,
-    553, 1191, 1257, 1258, 1259, 1258, 1259, 1159,
-    1159, 1160, 1160, 1160, 1260, 1160, 1160, 1160,
-    1160, 0, 1160, 1160, 1160, 1160, 1261, 1160,
-    1160, 1160, 1160, 1262, 1160, 1160, 1160, 1160,
-    1263, 1160, 1160, 1160, 1160, 1264, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1265, 1160, 1160, 1160, 0, 0,
-    0, 0, 1266, 1267, 1268, 1269, 1270, 1271,
-    1272, 1273, 1274, 1267, 1267, 1267, 1267, 1153,
-    1159, 1267, 1275, 540, 540, 1168, 1177, 540,
-    540, 1160, 1160, 1160, 1160, 1160, 1153, 1153,
-    1153, 1153, 1153, 1153, 1276, 1153, 1153, 1153,
-    1153, 0, 1153, 1153, 1153, 1153, 1277, 1153,
-    1153, 1153, 1153, 1278, 1153, 1153, 1153, 1153,
-    1279, 1153, 1153, 1153, 1153, 1280, 1153, 1153,
-    1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153,
-    1153, 1153, 1281, 1153, 1153, 1153, 0, 1191,
-    1191, 1191, 1191, 1191, 1191, 1191, 1191, 553,
-    1191, 1191, 1191, 1191, 1191, 1191, 0, 1191,
-    1191, 1177, 1177, 1177, 1177, 1177, 1191, 1191,
-    1191, 1191, 1177, 1177, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 340, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 340, 1160, 1160, 1160, 1160, 1282, 1283,
-    1160, 1160, 1160, 1160, 1284, 1284, 1153, 1285,
-    1153, 1153, 1159, 1153, 1153, 1153, 1153, 1153,
-    1180, 1284, 1168, 1168, 1159, 1159, 1153, 1153,
-    1160, 1178, 1178, 1250, 1250, 1178, 1178, 1178,
-    1178, 1178, 1178, 1044, 1044, 1044, 1177, 1177,
-    1177, 1160, 1160, 1160, 1160, 340, 1160, 1159,
-    1159, 1153, 1153, 1160, 1160, 1160, 1160, 1153,
-    1153, 1153, 1160, 1284, 1284, 1284, 1160, 1160,
-    1284, 1284, 1284, 1284, 1284, 1284, 1284, 1160,
-    1160, 1160, 1153, 1153, 1153, 1153, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1153, 1284, 1159, 1153, 1153,
-    1284, 1284, 1284, 1284, 1284, 1284, 553, 1160,
-    1284, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1178, 1178, 1284, 1284, 1284, 1153, 1191,
-    1191, 1286, 1287, 1288, 1289, 1290, 1291, 1292,
-    1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300,
-    1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308,
-    1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316,
-    1317, 1318, 1319, 1320, 1321, 1322, 1323, 0,
-    1324, 0, 0, 0, 0, 0, 1325, 0,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 1044, 1326, 340, 340,
-    340, 1327, 1327, 1327, 1327, 1327, 1327, 1327,
-    1327, 1327, 1327, 1327, 1327, 1327, 1327, 1327,
-    1327, 1327, 1327, 1327, 1327, 1327, 1327, 1327,
-    1327, 1327, 1327, 1327, 1327, 1327, 1327, 1327,
-    1327, 1327, 1327, 1327, 1327, 1327, 1327, 1327,
-    1327, 1327, 1327, 1327, 1327, 1327, 1327, 1327,
-    1327, 1327, 1327, 1327, 1327, 1327, 1327, 1327,
-    1327, 1327, 1327, 1327, 1327, 1327, 1327, 1327,
-    1327, 1327, 1327, 1327, 1327, 1327, 1327, 1327,
-    1327, 1327, 1327, 1327, 1327, 1327, 1327, 1327,
-    1327, 1327, 1327, 1327, 1327, 1327, 1327, 1327,
-    1327, 1327, 1327, 1327, 1327, 1327, 1327, 1327,
-    1328, 1329, 1330, 1330, 1330, 1330, 1330, 1330,
-    1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330,
-    1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330,
-    1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330,
-    1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330,
-    1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330,
-    1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330,
-    1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330,
-    1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330,
-    1330, 1331, 1331, 1331, 1331, 1331, 1331, 1331,
-    1331, 1331, 1331, 1331, 1331, 1331, 1331, 1331,
-    1331, 1331, 1331, 1331, 1331, 1331, 1331, 1331,
-    1331, 1331, 1331, 1331, 1331, 1331, 1331, 1331,
-    1331, 1331, 1331, 1331, 1331, 1331, 1331, 1331,
-    1331, 1331, 1331, 1331, 1331, 1331, 1331, 1331,
-    1331, 1331, 1331, 1331, 1331, 1331, 1331, 1331,
-    1331, 1331, 1331, 1331, 1331, 1331, 1331, 1331,
-    1331, 1331, 1331, 1331, 1331, 1331, 1331, 1331,
-    1331, 1331, 1331, 1331, 1331, 1331, 1331, 1331,
-    1331, 1331, 1331, 1331, 1331, 1331, 1331, 1331,
-    1331, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 0, 1160, 1160, 1160, 1160, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    0, 1160, 0, 1160, 1160, 1160, 1160, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 0, 1160, 1160, 1160, 1160, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 0, 1160, 1160, 1160, 1160, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    0, 1160, 0, 1160, 1160, 1160, 1160, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 0, 1160, 1160, 1160, 1160, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 340, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 0, 0, 540, 540,
-    540, 1177, 1044, 1177, 1177, 1177, 1177, 1177,
-    1177, 1177, 1190, 1190, 1190, 1190, 1190, 1190,
-    1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190,
-    1190, 1190, 1190, 1190, 1190, 1190, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 77, 77, 77, 77, 77, 1085, 77,
-    1085, 1085, 77, 0, 0, 0, 0, 0,
-    0, 1332, 1333, 1334, 1335, 1336, 1337, 1338,
-    1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346,
-    1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354,
-    1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362,
-    1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370,
-    1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378,
-    1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386,
-    1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394,
-    1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402,
-    1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410,
-    1411, 1412, 1413, 1414, 1415, 1416, 1417, 0,
-    0, 1418, 1419, 1420, 1421, 1422, 1423, 0,
-    0, 1424, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 340, 340, 340, 340,
-    340, 340, 340, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 340, 340, 340, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 340,
-    1160, 1160, 1160, 1160, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 340, 340, 340, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 1160, 1160, 1160, 1160, 1160,
-    1160, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 340, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 340, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 340, 340, 340, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 340,
-    340, 340, 340, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    340, 340, 340, 340, 1160, 1160, 1160, 1160,
-    340, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 340,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 340, 340, 340, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 340,
-    340, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 340, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1177, 1044,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 1425, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1258, 1259, 0, 0,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 1160, 340, 1160, 340, 340, 340, 340,
-    340, 340, 340, 340, 1044, 1044, 1044, 1426,
-    1426, 1426, 340, 340, 340, 340, 340, 340,
-    340, 340, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 0, 1160,
-    1160, 1160, 1160, 1153, 1153, 1168, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1153, 1153, 1168, 1177, 1177,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1153, 1153, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 340, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 0, 1160,
-    1160, 1160, 0, 1153, 1153, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 574, 574, 1159,
-    1153, 1153, 1153, 1153, 1153, 1153, 1153, 1159,
-    1159, 1159, 1159, 1159, 1159, 1159, 1159, 1153,
-    1159, 1159, 1153, 1153, 1153, 1153, 1153, 1153,
-    1153, 1153, 1153, 1168, 1153, 1177, 1177, 1044,
-    1179, 1177, 1177, 1177, 1189, 340, 540, 0,
-    0, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1178, 1178, 0, 0, 0, 0, 0,
-    0, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
-    1427, 1427, 1427, 0, 0, 0, 0, 0,
-    0, 1428, 1428, 1428, 1428, 1428, 1428, 1424,
-    1428, 1428, 1428, 1428, 574, 574, 574, 81,
-    0, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1178, 1178, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1179, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1153, 1153,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1087, 1160, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 340, 340, 340,
-    1160, 340, 1160, 340, 1160, 1160, 1160, 340,
-    340, 1160, 1160, 1160, 340, 340, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 340, 1160, 340, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 340, 340, 340, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    0, 1153, 1153, 1153, 1159, 1159, 1159, 1159,
-    1153, 1153, 1159, 1159, 1159, 0, 0, 0,
-    0, 1159, 1159, 1153, 1159, 1159, 1159, 1159,
-    1159, 1159, 1086, 540, 553, 0, 0, 0,
-    0, 1085, 0, 0, 0, 1428, 1428, 1178,
-    1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 0,
-    0, 340, 340, 340, 340, 340, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 0, 0, 0, 0, 0,
-    0, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1178, 1178, 1190, 0, 0, 0, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    540, 553, 1159, 1159, 1153, 0, 0, 1177,
-    1177, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1159, 1153,
-    1159, 1153, 1153, 1153, 1153, 1153, 1153, 1153,
-    0, 1168, 1284, 1153, 1284, 1284, 1153, 1153,
-    1153, 1153, 1153, 1153, 1153, 1153, 1159, 1159,
-    1159, 1159, 1159, 1159, 1153, 1153, 540, 540,
-    540, 540, 540, 540, 540, 540, 0, 0,
-    553, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1178, 1178, 0, 0, 0, 0, 0,
-    0, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1178, 1178, 0, 0, 0, 0, 0,
-    0, 1177, 1177, 1177, 1177, 1177, 1177, 1177,
-    1179, 1177, 1177, 1177, 1177, 1177, 1177, 0,
-    0, 540, 540, 540, 540, 540, 553, 553,
-    553, 553, 553, 553, 540, 540, 553, 839,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1153, 1153, 1153, 1153, 1159, 1429, 1430,
-    1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438,
-    1160, 1160, 1439, 1440, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1180, 1441, 1153,
-    1153, 1153, 1153, 1442, 1443, 1444, 1445, 1446,
-    1447, 1448, 1449, 1450, 1451, 1452, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 0, 0, 0,
-    0, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1178, 1178, 1177, 1177, 1177, 1177, 1177,
-    1177, 1177, 1191, 1191, 1191, 1191, 1191, 1191,
-    1191, 1191, 1191, 1191, 540, 553, 540, 540,
-    540, 540, 540, 540, 540, 1191, 1191, 1191,
-    1191, 1191, 1191, 1191, 1191, 1191, 0, 0,
-    0, 1153, 1153, 1159, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1159, 1153, 1153, 1153, 1153, 1159,
-    1159, 1153, 1153, 1452, 1168, 1153, 1153, 1160,
-    1160, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1178, 1178, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1180,
-    1159, 1153, 1153, 1159, 1159, 1159, 1153, 1159,
-    1153, 1153, 1153, 1452, 1452, 0, 0, 0,
-    0, 0, 0, 0, 0, 1177, 1177, 1177,
-    1177, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1159, 1159, 1159,
-    1159, 1159, 1159, 1159, 1159, 1153, 1153, 1153,
-    1153, 1153, 1153, 1153, 1153, 1159, 1159, 1153,
-    1180, 0, 0, 0, 1177, 1177, 1177, 1177,
-    1177, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1178, 1178, 0, 0, 0, 1160, 1160,
-    1160, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-    1250, 1250, 1250, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 523, 523, 523, 523, 523, 523, 1044,
-    1044, 1453, 1454, 1455, 1456, 1457, 1457, 1458,
-    1459, 1460, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1177, 1177, 1177, 1177, 1177, 1177, 1177,
-    1177, 0, 0, 0, 0, 0, 0, 0,
-    0, 540, 540, 540, 1177, 566, 553, 553,
-    553, 553, 553, 540, 540, 553, 553, 553,
-    553, 540, 1159, 566, 566, 566, 566, 566,
-    566, 566, 1160, 1160, 1160, 1160, 553, 1160,
-    1160, 1160, 1160, 1159, 1159, 540, 1160, 1160,
-    0, 540, 540, 0, 0, 0, 0, 0,
-    0, 214, 214, 214, 214, 214, 214, 214,
-    214, 214, 214, 214, 214, 214, 214, 214,
-    214, 214, 214, 214, 214, 214, 214, 214,
-    214, 214, 214, 214, 214, 214, 214, 214,
-    214, 214, 214, 214, 214, 214, 214, 214,
-    214, 214, 214, 214, 214, 1461, 1462, 1463,
-    523, 1464, 1465, 1466, 1467, 1468, 1469, 1470,
-    1471, 1472, 1473, 1474, 523, 1475, 1476, 1477,
-    1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485,
-    1486, 1487, 1488, 1489, 1490, 1491, 1492, 523,
-    1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500,
-    1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508,
-    1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516,
-    1517, 1518, 1519, 1520, 214, 214, 214, 214,
-    214, 214, 214, 214, 214, 214, 214, 214,
-    214, 1521, 1522, 1523, 214, 214, 1524, 214,
-    214, 214, 214, 214, 214, 214, 214, 214,
-    214, 214, 214, 214, 214, 214, 214, 214,
-    214, 214, 214, 214, 214, 214, 1523, 214,
-    214, 214, 214, 214, 1525, 1526, 1527, 1528,
-    1491, 1529, 1530, 1531, 1532, 1533, 1534, 1535,
-    1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543,
-    1544, 1545, 1546, 1547, 1548, 1549, 1550, 1551,
-    1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559,
-    1560, 540, 540, 553, 540, 540, 540, 540,
-    540, 540, 540, 553, 540, 540, 576, 1561,
-    553, 555, 540, 540, 540, 540, 540, 540,
-    540, 540, 540, 540, 540, 540, 540, 540,
-    540, 540, 540, 540, 540, 540, 540, 540,
-    540, 540, 540, 540, 540, 540, 540, 540,
-    540, 540, 540, 540, 540, 540, 540, 0,
-    0, 0, 0, 0, 540, 575, 553, 540,
-    553, 1562, 1563, 1564, 1565, 1566, 1567, 1568,
-    1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576,
-    1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584,
-    1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592,
-    1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600,
-    1601, 1602, 1603, 1604, 1605, 1606, 1607, 1608,
-    1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616,
-    1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624,
-    1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632,
-    1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640,
-    1641, 1642, 1643, 1644, 1645, 1646, 1647, 1648,
-    1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656,
-    1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664,
-    1665, 1666, 1667, 1668, 1669, 1670, 1671, 1672,
-    1673, 1674, 1675, 1676, 1677, 1678, 1679, 1680,
-    1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688,
-    1689, 1690, 1691, 1692, 1693, 1694, 1695, 1696,
-    1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704,
-    1705, 1706, 1707, 1708, 1709, 1710, 1711, 1712,
-    1713, 1714, 1715, 1716, 1717, 214, 214, 1718,
-    214, 1719, 1720, 1721, 1722, 1723, 1724, 1725,
-    1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733,
-    1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741,
-    1742, 1743, 1744, 1745, 1746, 1747, 1748, 1749,
-    1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757,
-    1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765,
-    1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773,
-    1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781,
-    1782, 1783, 1784, 1785, 1786, 1787, 1788, 1789,
-    1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797,
-    1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805,
-    1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813,
-    1814, 1815, 1816, 1817, 1818, 1819, 1820, 1821,
-    1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829,
-    1830, 1831, 1832, 1833, 1834, 1835, 1836, 0,
-    0, 1837, 1838, 1839, 1840, 1841, 1842, 0,
-    0, 1843, 1844, 1845, 1846, 1847, 1848, 1849,
-    1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857,
-    1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865,
-    1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873,
-    1874, 1875, 1876, 1877, 1878, 1879, 1880, 0,
-    0, 1881, 1882, 1883, 1884, 1885, 1886, 0,
-    0, 1887, 1888, 1889, 1890, 1891, 1892, 1893,
-    1894, 0, 1895, 0, 1896, 0, 1897, 0,
-    1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905,
-    1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913,
-    1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921,
-    1922, 1923, 1924, 1925, 1926, 1927, 1928, 0,
-    0, 1929, 1930, 1931, 1932, 1933, 1934, 1935,
-    1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943,
-    1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951,
-    1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959,
-    1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967,
-    1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975,
-    1976, 1977, 1978, 1979, 1980, 1981, 0, 1982,
-    1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990,
-    1991, 1992, 1993, 1994, 1995, 1996, 0, 1997,
-    1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005,
-    2006, 2007, 2008, 2009, 2010, 0, 0, 2011,
-    2012, 2013, 2014, 2015, 2016, 0, 2017, 2018,
-    2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026,
-    2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034,
-    2035, 0, 0, 2036, 2037, 2038, 0, 2039,
-    2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047,
-    0, 2048, 2049, 2050, 2051, 2050, 2050, 2050,
-    2052, 2050, 2050, 2050, 81, 2053, 2054, 2055,
-    2056, 1084, 2057, 1084, 1084, 1084, 1084, 9,
-    2058, 2059, 2060, 2061, 2059, 2059, 2060, 2061,
-    2059, 9, 9, 9, 9, 2062, 2063, 2064,
-    9, 2065, 2066, 2067, 2068, 2069, 2070, 2071,
-    76, 10, 10, 10, 2072, 2073, 9, 2074,
-    2075, 9, 80, 92, 9, 2076, 9, 2077,
-    48, 48, 9, 9, 9, 2078, 12, 13,
-    2079, 2080, 2081, 9, 9, 9, 9, 9,
-    9, 9, 9, 75, 9, 48, 9, 9,
-    2082, 9, 9, 9, 9, 9, 9, 9,
-    2050, 81, 81, 81, 81, 81, 0, 2083,
-    2084, 2085, 2086, 81, 81, 81, 81, 81,
-    81, 2087, 2088, 0, 0, 2089, 2090, 2091,
-    2092, 2093, 2094, 2095, 2096, 2097, 2098, 2099,
-    2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107,
-    2108, 2109, 2110, 2111, 2112, 2113, 2114, 2115,
-    0, 2116, 2117, 2118, 2119, 2120, 2121, 2122,
-    2123, 2124, 2125, 2126, 2127, 2128, 0, 0,
-    0, 11, 11, 11, 11, 11, 11, 11,
-    11, 2129, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 1189, 11, 11, 11, 11, 11,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 540, 540, 566, 566, 540, 540, 540,
-    540, 566, 566, 566, 540, 540, 839, 839,
-    839, 839, 540, 839, 839, 839, 566, 566,
-    540, 553, 540, 566, 566, 553, 553, 553,
-    553, 540, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 2130, 2131, 2132, 2133, 77, 2134, 2135,
-    2136, 77, 2137, 2138, 2139, 2139, 2139, 2140,
-    2141, 2142, 2142, 2143, 2144, 77, 2145, 2146,
-    77, 75, 2147, 2148, 2149, 2149, 2149, 77,
-    77, 2150, 2151, 2152, 77, 2153, 77, 2154,
-    77, 2153, 77, 2155, 2156, 2157, 2132, 83,
-    2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165,
-    2166, 2167, 2168, 1085, 2169, 2170, 2171, 2172,
-    2173, 2174, 75, 75, 75, 75, 2175, 2176,
-    2158, 2168, 2177, 77, 75, 1085, 77, 2178,
-    1191, 2179, 2180, 2181, 2182, 2183, 2184, 2185,
-    2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193,
-    2194, 2195, 2196, 2197, 2198, 2199, 2200, 2201,
-    2202, 2203, 2204, 2205, 2206, 2207, 2208, 2209,
-    2210, 2211, 2212, 2213, 2214, 2215, 2216, 2217,
-    2218, 2219, 2220, 2221, 2222, 2223, 2224, 2225,
-    2226, 1426, 1426, 2227, 2228, 2229, 1426, 1426,
-    1426, 2227, 2230, 77, 77, 0, 0, 0,
-    0, 2231, 75, 2232, 75, 2233, 77, 77,
-    77, 77, 77, 2234, 2235, 77, 77, 77,
-    77, 75, 77, 77, 75, 77, 77, 75,
-    77, 77, 77, 77, 77, 77, 77, 2236,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 2237, 2238,
-    2239, 2240, 77, 2241, 77, 2242, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 1109, 75, 75,
-    75, 75, 1109, 1109, 1109, 1109, 75, 75,
-    1109, 75, 2243, 2243, 2244, 2245, 75, 75,
-    75, 2246, 2247, 2243, 2248, 2249, 2243, 75,
-    75, 75, 2243, 14, 84, 75, 2243, 2243,
-    75, 75, 75, 2243, 2243, 2243, 2243, 75,
-    2243, 2243, 2243, 2243, 2250, 2251, 2252, 2253,
-    75, 75, 75, 75, 2243, 2254, 2255, 2243,
-    2256, 2257, 2243, 2243, 2243, 75, 75, 75,
-    75, 75, 2243, 75, 2243, 2258, 2243, 2243,
-    2243, 2243, 2259, 2243, 2260, 2261, 2262, 2243,
-    2263, 2264, 2265, 2243, 2243, 2243, 2266, 75,
-    75, 75, 75, 2243, 2243, 2243, 2243, 75,
-    75, 75, 75, 75, 75, 75, 75, 75,
-    2243, 2267, 2268, 2269, 75, 2270, 2271, 2243,
-    2243, 2243, 2243, 2243, 2243, 75, 2272, 2273,
-    2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281,
-    2282, 2283, 2284, 2285, 2286, 2287, 2288, 2243,
-    2243, 2289, 2290, 2291, 2292, 2293, 2294, 2295,
-    2296, 2297, 2298, 2243, 2243, 2243, 75, 75,
-    2243, 2243, 2299, 2300, 75, 75, 75, 75,
-    75, 2243, 75, 75, 75, 75, 75, 75,
-    75, 75, 75, 2301, 2243, 75, 75, 2243,
-    2243, 2302, 2303, 2243, 2304, 2305, 2306, 2307,
-    2308, 2243, 2243, 2309, 2310, 2311, 2312, 2243,
-    2243, 2243, 75, 75, 75, 75, 75, 2243,
-    2243, 75, 75, 75, 75, 75, 75, 75,
-    75, 75, 2243, 2243, 2243, 2243, 2243, 75,
-    75, 2243, 2243, 75, 75, 75, 75, 2243,
-    2243, 2243, 2243, 2243, 2243, 2243, 2243, 2243,
-    2243, 2313, 2314, 2315, 2316, 2243, 2243, 2243,
-    2243, 2243, 2243, 2317, 2318, 2319, 2320, 75,
-    75, 2243, 2243, 2321, 2321, 2243, 2321, 2321,
-    2243, 2243, 2321, 2321, 2321, 2243, 2321, 2243,
-    2321, 77, 77, 77, 77, 77, 77, 77,
-    77, 12, 13, 12, 13, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 1085, 1085, 77, 77, 77,
-    77, 2243, 2243, 77, 77, 77, 77, 77,
-    77, 77, 2322, 2323, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 1085, 1109, 1085, 1085,
-    77, 77, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 838, 77,
-    1085, 1085, 1085, 1085, 75, 75, 75, 75,
-    75, 75, 75, 75, 75, 75, 75, 75,
-    75, 75, 75, 75, 75, 75, 75, 75,
-    75, 75, 75, 1109, 1109, 1085, 1085, 1085,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 77, 77, 1085, 1085,
-    77, 77, 77, 77, 77, 1085, 1085, 1085,
-    1085, 1085, 1085, 77, 1085, 1109, 1109, 1109,
-    1109, 1109, 1109, 1085, 1085, 1085, 1085, 1085,
-    1085, 77, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    0, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 77, 77, 77, 77, 77,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 2324, 2325, 2326, 2327, 2328, 2329, 2330,
-    2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338,
-    2339, 2340, 2341, 2342, 2343, 2344, 2345, 2346,
-    2347, 2348, 2349, 2350, 2351, 2352, 2353, 2354,
-    2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362,
-    2363, 2364, 2365, 2366, 2367, 2368, 2369, 2370,
-    2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378,
-    2379, 2380, 2381, 2382, 2383, 2384, 2385, 2386,
-    2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394,
-    2395, 2396, 2397, 2398, 2399, 2400, 2401, 2402,
-    2403, 2404, 2405, 2406, 2407, 2408, 2409, 2410,
-    2411, 2412, 2413, 2414, 2415, 2416, 2417, 2418,
-    2419, 2420, 2421, 2422, 2423, 2424, 2425, 2426,
-    2427, 2428, 2429, 2430, 2431, 2432, 2433, 2434,
-    2435, 2436, 2437, 2438, 2439, 2440, 2441, 2442,
-    2443, 2444, 2445, 2446, 2447, 2448, 2449, 2450,
-    2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458,
-    2459, 2460, 2461, 2462, 1220, 1220, 1220, 1220,
-    1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220,
-    1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220,
-    1220, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    75, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 75, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 75, 75, 75, 75, 75, 1109, 1109,
-    75, 77, 77, 77, 1085, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 1085, 1085, 1085,
-    1085, 1085, 1085, 77, 77, 77, 2463, 77,
-    77, 77, 77, 1085, 1085, 1085, 77, 77,
-    77, 77, 77, 77, 1085, 1085, 77, 77,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    75, 77, 77, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 77, 77, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 77, 1085, 1085, 1085, 838, 1085, 1085,
-    1085, 1085, 1085, 77, 77, 77, 77, 1085,
-    77, 77, 77, 77, 77, 77, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 77, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 2464, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 2464, 2464, 2464, 2464, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 2465, 1085, 1085,
-    1085, 12, 13, 12, 13, 12, 13, 12,
-    13, 12, 13, 12, 13, 12, 13, 1220,
-    1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220,
-    1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220,
-    1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220,
-    1220, 1220, 1220, 1220, 1220, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 2243, 1109, 75, 2321, 2321, 12, 13,
-    75, 2321, 2321, 75, 2321, 2321, 2321, 1109,
-    1109, 1109, 75, 1109, 2243, 2243, 2321, 2321,
-    1109, 1109, 1109, 1109, 1109, 2321, 2321, 2321,
-    1109, 75, 1109, 2321, 2321, 2321, 2321, 12,
-    13, 12, 13, 12, 13, 12, 13, 12,
-    13, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
-    1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
-    1109, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
-    1109, 75, 75, 1109, 1109, 1109, 1109, 1109,
-    1109, 1109, 1109, 75, 75, 1109, 1109, 1109,
-    1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
-    1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
-    1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
-    1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
-    1109, 75, 75, 1109, 1109, 1109, 1109, 1109,
-    1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
-    1109, 1109, 75, 1109, 1109, 75, 75, 1109,
-    75, 1109, 75, 1109, 1109, 75, 75, 1109,
-    1109, 75, 75, 1109, 1109, 75, 75, 1109,
-    1109, 75, 75, 1109, 1109, 1109, 1109, 1109,
-    1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
-    1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
-    1109, 1109, 1109, 1109, 1109, 75, 75, 1109,
-    1109, 75, 1109, 75, 12, 13, 12, 13,
-    12, 13, 12, 13, 12, 13, 12, 13,
-    12, 13, 12, 13, 1258, 1259, 1258, 1259,
-    12, 13, 75, 1109, 2321, 2321, 2321, 2321,
-    2321, 2321, 2321, 2321, 2321, 2321, 2321, 2243,
-    2243, 2321, 2321, 2321, 2321, 2321, 2321, 2321,
-    2321, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
-    1109, 2321, 1109, 1109, 1109, 1109, 1109, 1109,
-    1109, 2321, 2321, 2321, 2321, 2321, 2321, 1109,
-    1109, 1109, 2321, 1109, 1109, 1109, 1109, 2321,
-    2321, 2321, 2243, 2243, 75, 2243, 2243, 75,
-    75, 12, 13, 1258, 1259, 2321, 1109, 1109,
-    1109, 1109, 2321, 1109, 2321, 2321, 2321, 1109,
-    1109, 2321, 2321, 1109, 75, 1109, 1109, 1109,
-    1109, 1109, 1109, 1109, 1109, 2321, 2243, 2243,
-    2243, 2243, 2243, 75, 75, 12, 13, 1109,
-    1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
-    1109, 1109, 1109, 2321, 2321, 2466, 2321, 2321,
-    2321, 2321, 2321, 2321, 2321, 2321, 2321, 2321,
-    2321, 2321, 2321, 2321, 2321, 2321, 1109, 2243,
-    2243, 2321, 2243, 75, 75, 2243, 75, 2243,
-    1109, 75, 2243, 75, 2243, 2243, 2321, 2321,
-    75, 75, 75, 75, 1109, 2321, 2321, 1109,
-    1109, 1109, 1109, 1109, 1109, 2243, 2243, 2243,
-    1109, 1109, 1109, 1109, 1109, 1109, 1109, 75,
-    75, 75, 75, 75, 75, 1109, 1109, 1109,
-    1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
-    2321, 2321, 1109, 1109, 1109, 1109, 1109, 1109,
-    1109, 1109, 1109, 1109, 1109, 2321, 2321, 75,
-    75, 1109, 1109, 2243, 2243, 2243, 2243, 1109,
-    2243, 2243, 75, 75, 2243, 2467, 2468, 2469,
-    75, 1109, 2321, 2321, 2321, 2321, 2321, 2321,
-    2321, 2321, 2321, 2321, 2321, 2321, 2321, 2321,
-    2321, 2321, 2321, 2321, 2243, 2243, 2321, 2321,
-    2243, 2243, 2243, 2243, 2243, 2243, 2321, 2321,
-    2321, 2321, 2321, 2321, 2321, 2321, 2321, 2321,
-    2321, 2321, 2321, 2321, 2321, 1109, 1109, 2321,
-    2321, 2321, 2321, 2321, 2321, 2321, 2321, 1109,
-    2321, 2321, 2321, 2321, 2321, 2321, 2321, 2321,
-    2321, 2321, 2321, 2321, 2321, 2321, 2321, 2321,
-    2243, 2243, 2243, 2243, 2243, 2243, 2243, 2243,
-    2321, 2321, 2243, 2243, 2243, 2243, 2321, 2321,
-    2321, 2321, 2321, 2321, 2243, 2243, 2243, 2243,
-    1109, 1109, 1109, 1109, 1109, 2470, 2471, 2243,
-    1109, 1109, 1109, 2321, 2321, 2321, 2321, 2321,
-    1109, 1109, 1109, 1109, 1109, 2321, 2321, 2243,
-    75, 75, 75, 75, 2321, 1109, 1109, 75,
-    2321, 2321, 2321, 2321, 2321, 1109, 2321, 75,
-    75, 1085, 1085, 1085, 1085, 1085, 1085, 77,
-    77, 1085, 1085, 1085, 1085, 1085, 77, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 77, 77,
-    1085, 1085, 1085, 1085, 1085, 1085, 77, 77,
-    77, 77, 77, 77, 77, 1085, 1085, 77,
-    77, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
-    1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
-    1109, 1109, 1109, 1109, 1109, 1109, 1085, 1085,
-    1109, 1109, 1109, 1109, 1109, 1109, 1085, 77,
-    77, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 0, 0, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 0,
-    0, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 0, 0, 0, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 0, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 1085, 1085, 1085,
-    1085, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 2472, 2473, 2474, 2475, 2476, 2477, 2478,
-    2479, 2480, 2481, 2482, 2483, 2484, 2485, 2486,
-    2487, 2488, 2489, 2490, 2491, 2492, 2493, 2494,
-    2495, 2496, 2497, 2498, 2499, 2500, 2501, 2502,
-    2503, 2504, 2505, 2506, 2507, 2508, 2509, 2510,
-    2511, 2512, 2513, 2514, 2515, 2516, 2517, 2518,
-    0, 2519, 2520, 2521, 2522, 2523, 2524, 2525,
-    2526, 2527, 2528, 2529, 2530, 2531, 2532, 2533,
-    2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541,
-    2542, 2543, 2544, 2545, 2546, 2547, 2548, 2549,
-    2550, 2551, 2552, 2553, 2554, 2555, 2556, 2557,
-    2558, 2559, 2560, 2561, 2562, 2563, 2564, 2565,
-    0, 2566, 2567, 2568, 2569, 2570, 2571, 2572,
-    2573, 2574, 2575, 2576, 2577, 2578, 2579, 2580,
-    2581, 2582, 214, 2583, 2584, 214, 2585, 2586,
-    214, 214, 214, 214, 214, 2587, 2588, 2589,
-    2590, 2591, 2592, 2593, 2594, 2595, 2596, 2597,
-    2598, 2599, 2600, 2601, 2602, 2603, 2604, 2605,
-    2606, 2607, 2608, 2609, 2610, 2611, 2612, 2613,
-    2614, 2615, 2616, 2617, 2618, 2619, 2620, 2621,
-    2622, 2623, 2624, 2625, 2626, 2627, 2628, 2629,
-    2630, 2631, 2632, 2633, 2634, 2635, 2636, 2637,
-    2638, 2639, 2640, 2641, 2642, 2643, 2644, 2645,
-    2646, 2647, 2648, 2649, 2650, 2651, 2652, 2653,
-    2654, 2655, 2656, 2657, 2658, 2659, 2660, 2661,
-    2662, 2663, 2664, 2665, 2666, 2667, 2668, 2669,
-    2670, 2671, 2672, 2673, 2674, 2675, 2676, 2677,
-    2678, 2679, 2680, 2681, 2682, 2683, 2684, 2685,
-    2686, 2687, 2688, 2689, 2690, 214, 77, 77,
-    1085, 77, 77, 1085, 2691, 2692, 2693, 2694,
-    540, 540, 540, 2695, 2696, 0, 0, 0,
-    0, 0, 9, 9, 9, 9, 1427, 9,
-    9, 2697, 2698, 2699, 2700, 2701, 2702, 2703,
-    2704, 2705, 2706, 2707, 2708, 2709, 2710, 2711,
-    2712, 2713, 2714, 2715, 2716, 2717, 2718, 2719,
-    2720, 2721, 2722, 2723, 2724, 2725, 2726, 2727,
-    2728, 2729, 2730, 2731, 2732, 2733, 2734, 0,
-    2735, 0, 0, 0, 0, 0, 2736, 0,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 1160, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 0, 0, 0, 0, 0, 0, 0,
-    2737, 1044, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    1168, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    0, 540, 540, 540, 540, 540, 540, 540,
-    540, 540, 540, 540, 540, 540, 540, 540,
-    540, 540, 540, 540, 540, 540, 540, 540,
-    540, 540, 540, 540, 540, 540, 540, 540,
-    540, 9, 9, 80, 92, 80, 92, 9,
-    9, 9, 80, 92, 9, 80, 92, 1428,
-    1428, 1428, 1428, 9, 1428, 1428, 1428, 9,
-    1084, 9, 9, 1084, 9, 80, 92, 9,
-    9, 80, 92, 12, 13, 12, 13, 12,
-    13, 12, 13, 9, 9, 9, 9, 9,
-    522, 9, 9, 9, 9, 9, 9, 9,
-    9, 9, 9, 1084, 1084, 9, 9, 9,
-    9, 1084, 9, 2061, 1428, 9, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 0, 1085, 1085, 1085, 1085,
-    2738, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 2739, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 2740, 2741, 2742, 2743, 2744, 2745, 2746,
-    2747, 2748, 2749, 2750, 2751, 2752, 2753, 2754,
-    2755, 2756, 2757, 2758, 2759, 2760, 2761, 2762,
-    2763, 2764, 2765, 2766, 2767, 2768, 2769, 2770,
-    2771, 2772, 2773, 2774, 2775, 2776, 2777, 2778,
-    2779, 2780, 2781, 2782, 2783, 2784, 2785, 2786,
-    2787, 2788, 2789, 2790, 2791, 2792, 2793, 2794,
-    2795, 2796, 2797, 2798, 2799, 2800, 2801, 2802,
-    2803, 2804, 2805, 2806, 2807, 2808, 2809, 2810,
-    2811, 2812, 2813, 2814, 2815, 2816, 2817, 2818,
-    2819, 2820, 2821, 2822, 2823, 2824, 2825, 2826,
-    2827, 2828, 2829, 2830, 2831, 2832, 2833, 2834,
-    2835, 2836, 2837, 2838, 2839, 2840, 2841, 2842,
-    2843, 2844, 2845, 2846, 2847, 2848, 2849, 2850,
-    2851, 2852, 2853, 2854, 2855, 2856, 2857, 2858,
-    2859, 2860, 2861, 2862, 2863, 2864, 2865, 2866,
-    2867, 2868, 2869, 2870, 2871, 2872, 2873, 2874,
-    2875, 2876, 2877, 2878, 2879, 2880, 2881, 2882,
-    2883, 2884, 2885, 2886, 2887, 2888, 2889, 2890,
-    2891, 2892, 2893, 2894, 2895, 2896, 2897, 2898,
-    2899, 2900, 2901, 2902, 2903, 2904, 2905, 2906,
-    2907, 2908, 2909, 2910, 2911, 2912, 2913, 2914,
-    2915, 2916, 2917, 2918, 2919, 2920, 2921, 2922,
-    2923, 2924, 2925, 2926, 2927, 2928, 2929, 2930,
-    2931, 2932, 2933, 2934, 2935, 2936, 2937, 2938,
-    2939, 2940, 2941, 2942, 2943, 2944, 2945, 2946,
-    2947, 2948, 2949, 2950, 2951, 2952, 2953, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 0, 0, 0,
-    0, 2954, 1428, 1428, 1428, 1085, 1179, 1160,
-    2227, 1258, 1259, 1258, 1259, 1258, 1259, 1258,
-    1259, 1258, 1259, 1085, 1085, 1258, 1259, 1258,
-    1259, 1258, 1259, 1258, 1259, 1424, 2955, 2956,
-    2956, 1085, 2227, 2227, 2227, 2227, 2227, 2227,
-    2227, 2227, 2227, 2957, 1087, 552, 1086, 2958,
-    2958, 1424, 1179, 1179, 1179, 1179, 1179, 2959,
-    1085, 2960, 2961, 2962, 1179, 1160, 1428, 1085,
-    77, 0, 1160, 1160, 1160, 1160, 1160, 2963,
-    1160, 1160, 1160, 1160, 2964, 2965, 2966, 2967,
-    2968, 2969, 2970, 2971, 2972, 2973, 2974, 2975,
-    2976, 2977, 2978, 2979, 2980, 2981, 2982, 2983,
-    2984, 2985, 2986, 2987, 1160, 2988, 2989, 2990,
-    2991, 2992, 2993, 1160, 1160, 1160, 1160, 1160,
-    2994, 2995, 2996, 2997, 2998, 2999, 3000, 3001,
-    3002, 3003, 3004, 3005, 3006, 3007, 3008, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 3009, 1160, 1160,
-    0, 0, 3010, 3011, 3012, 3013, 3014, 3015,
-    3016, 1424, 1160, 1160, 1160, 1160, 1160, 3017,
-    1160, 1160, 1160, 1160, 3018, 3019, 3020, 3021,
-    3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029,
-    3030, 3031, 3032, 3033, 3034, 3035, 3036, 3037,
-    3038, 3039, 3040, 3041, 1160, 3042, 3043, 3044,
-    3045, 3046, 3047, 1160, 1160, 1160, 1160, 1160,
-    3048, 3049, 3050, 3051, 3052, 3053, 3054, 3055,
-    3056, 3057, 3058, 3059, 3060, 3061, 3062, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    3063, 3064, 3065, 3066, 1160, 3067, 1160, 1160,
-    3068, 3069, 3070, 3071, 1428, 1179, 3072, 3073,
-    3074, 0, 0, 0, 0, 0, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 0,
-    0, 0, 3075, 3076, 3077, 3078, 3079, 3080,
-    3081, 3082, 3083, 3084, 3085, 3086, 3087, 3088,
-    3089, 3090, 3091, 3092, 3093, 3094, 3095, 3096,
-    3097, 3098, 3099, 3100, 3101, 3102, 3103, 3104,
-    3105, 3106, 3107, 3108, 3109, 3110, 3111, 3112,
-    3113, 3114, 3115, 3116, 3117, 3118, 3119, 3120,
-    3121, 3122, 3123, 3124, 3125, 3126, 3127, 3128,
-    3129, 3130, 3131, 3132, 3133, 3134, 3135, 3136,
-    3137, 3138, 3139, 3140, 3141, 3142, 3143, 3144,
-    3145, 3146, 3147, 3148, 3149, 3150, 3151, 3152,
-    3153, 3154, 3155, 3156, 3157, 3158, 3159, 3160,
-    3161, 3162, 3163, 3164, 3165, 3166, 3167, 3168,
-    0, 1191, 1191, 3169, 3170, 3171, 3172, 3173,
-    3174, 3175, 3176, 3177, 3178, 3179, 3180, 3181,
-    3182, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 0, 0, 0, 0,
-    0, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 3183, 3184, 3185, 3186, 3187, 3188, 3189,
-    3190, 3191, 3192, 3193, 3194, 3195, 3196, 3197,
-    3198, 3199, 3200, 3201, 3202, 3203, 3204, 3205,
-    3206, 3207, 3208, 3209, 3210, 3211, 3212, 3213,
-    0, 3214, 3215, 3216, 3217, 3218, 3219, 3220,
-    3221, 3222, 3223, 3224, 3225, 3226, 3227, 3228,
-    3229, 3230, 3231, 3232, 3233, 3234, 3235, 3236,
-    3237, 3238, 3239, 3240, 3241, 3242, 3243, 3244,
-    3245, 3246, 3247, 3248, 3249, 3250, 3251, 3252,
-    3253, 1190, 1190, 1190, 1190, 1190, 1190, 1190,
-    1190, 3254, 3255, 3256, 3257, 3258, 3259, 3260,
-    3261, 3262, 3263, 3264, 3265, 3266, 3267, 3268,
-    3269, 3270, 3271, 3272, 3273, 3274, 3275, 3276,
-    3277, 3278, 3279, 3280, 3281, 3282, 3283, 3284,
-    3285, 3286, 3287, 3288, 3289, 3290, 3291, 3292,
-    3293, 3294, 3295, 3296, 3297, 3298, 3299, 3300,
-    1191, 3301, 3302, 3303, 3304, 3305, 3306, 3307,
-    3308, 3309, 3310, 3311, 3312, 3313, 3314, 3315,
-    3316, 3317, 3318, 3319, 3320, 3321, 3322, 3323,
-    3324, 3325, 3326, 3327, 3328, 3329, 3330, 3331,
-    3332, 3333, 3334, 3335, 3336, 3337, 3338, 3339,
-    3340, 3341, 3342, 3343, 3344, 3345, 3346, 3347,
-    3348, 3349, 3350, 3351, 3352, 3353, 3354, 3355,
-    3356, 3357, 3358, 3359, 3360, 3361, 3362, 3363,
-    3364, 3365, 3366, 3367, 3368, 3369, 3370, 3371,
-    3372, 3373, 3374, 3375, 3376, 3377, 3378, 3379,
-    3380, 3381, 3382, 3383, 3384, 3385, 3386, 3387,
-    3388, 3389, 3390, 3391, 3392, 3393, 3394, 3395,
-    3396, 3397, 3398, 3399, 3400, 3401, 3402, 3403,
-    3404, 3405, 3406, 3407, 3408, 3409, 3410, 3411,
-    3412, 3413, 3414, 3415, 3416, 3417, 3418, 3419,
-    3420, 3421, 3422, 3423, 3424, 3425, 3426, 3427,
-    0, 3428, 3429, 3430, 3431, 3432, 3433, 3434,
-    3435, 3436, 3437, 3438, 3439, 3440, 3441, 3442,
-    3443, 3444, 3445, 3446, 3447, 3448, 3449, 3450,
-    3451, 3452, 3453, 3454, 3455, 3456, 3457, 3458,
-    3459, 3460, 3461, 3462, 3463, 3464, 3465, 3466,
-    3467, 3468, 3469, 3470, 3471, 3472, 3473, 3474,
-    3475, 3476, 3477, 3478, 3479, 3480, 3481, 3482,
-    3483, 3484, 3485, 3486, 3487, 3488, 3489, 3490,
-    3491, 3492, 3493, 3494, 3495, 3496, 3497, 3498,
-    3499, 3500, 3501, 3502, 3503, 3504, 3505, 3506,
-    3507, 3508, 3509, 3510, 3511, 3512, 3513, 3514,
-    3515, 3516, 3517, 3518, 3519, 3520, 3521, 3522,
-    3523, 3524, 3525, 3526, 3527, 3528, 3529, 3530,
-    3531, 3532, 3533, 3534, 3535, 3536, 3537, 3538,
-    3539, 3540, 3541, 3542, 3543, 3544, 3545, 3546,
-    3547, 3548, 3549, 3550, 3551, 3552, 3553, 3554,
-    3555, 3556, 3557, 3558, 3559, 3560, 3561, 3562,
-    3563, 3564, 3565, 3566, 3567, 3568, 3569, 3570,
-    3571, 3572, 3573, 3574, 3575, 3576, 3577, 3578,
-    3579, 3580, 3581, 3582, 3583, 3584, 3585, 3586,
-    3587, 3588, 3589, 3590, 3591, 3592, 3593, 3594,
-    3595, 3596, 3597, 3598, 3599, 3600, 3601, 3602,
-    3603, 3604, 3605, 3606, 3607, 3608, 3609, 3610,
-    3611, 3612, 3613, 3614, 3615, 3616, 3617, 3618,
-    3619, 3620, 3621, 3622, 3623, 3624, 3625, 3626,
-    3627, 3628, 3629, 3630, 3631, 3632, 3633, 3634,
-    3635, 3636, 3637, 3638, 3639, 3640, 3641, 3642,
-    3643, 3644, 3645, 3646, 3647, 3648, 3649, 3650,
-    3651, 3652, 3653, 3654, 3655, 3656, 3657, 3658,
-    3659, 3660, 3661, 3662, 3663, 3664, 3665, 3666,
-    3667, 3668, 3669, 3670, 3671, 3672, 3673, 3674,
-    3675, 3676, 3677, 3678, 3679, 3680, 3681, 3682,
-    3683, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1179, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 0, 0,
-    0, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 523, 523, 523, 523, 523, 523, 1044,
-    1044, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1179, 1428, 1428,
-    1428, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1178, 1178, 1160, 1160, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 3684, 3685, 3686, 3687, 3688, 3689, 3690,
-    3691, 3692, 3693, 3694, 3695, 3696, 3697, 3698,
-    3699, 3700, 3701, 3702, 3703, 3704, 3705, 3706,
-    3707, 3708, 3709, 3710, 3711, 3712, 3713, 3714,
-    3715, 3716, 3717, 3718, 3719, 3720, 3721, 3722,
-    3723, 3724, 3725, 3726, 3727, 3728, 3729, 1160,
-    540, 839, 839, 839, 9, 540, 540, 540,
-    540, 540, 540, 540, 540, 540, 540, 9,
-    522, 3730, 3731, 3732, 3733, 3734, 3735, 3736,
-    3737, 3738, 3739, 3740, 3741, 3742, 3743, 3744,
-    3745, 3746, 3747, 3748, 3749, 3750, 3751, 3752,
-    3753, 3754, 3755, 3756, 3757, 3758, 3759, 540,
-    540, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 1426,
-    1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-    1426, 540, 540, 1044, 1044, 1044, 1044, 1044,
-    1044, 0, 0, 0, 0, 0, 0, 0,
-    0, 47, 47, 47, 47, 47, 47, 47,
-    47, 47, 47, 47, 47, 47, 47, 47,
-    47, 47, 47, 47, 47, 47, 47, 47,
-    522, 522, 522, 522, 522, 522, 522, 522,
-    522, 47, 47, 3760, 3761, 3762, 3763, 3764,
-    3765, 3766, 3767, 3768, 3769, 3770, 3771, 3772,
-    3773, 214, 214, 3774, 3775, 3776, 3777, 3778,
-    3779, 3780, 3781, 3782, 3783, 3784, 3785, 3786,
-    3787, 3788, 3789, 3790, 3791, 3792, 3793, 3794,
-    3795, 3796, 3797, 3798, 3799, 3800, 3801, 3802,
-    3803, 3804, 3805, 3806, 3807, 3808, 3809, 3810,
-    3811, 3812, 3813, 3814, 3815, 3816, 3817, 3818,
-    3819, 3820, 3821, 3822, 3823, 3824, 3825, 3826,
-    3827, 3828, 3829, 3830, 3831, 3832, 3833, 3834,
-    3835, 3836, 1523, 1523, 1523, 1523, 1523, 1523,
-    1523, 214, 3837, 3838, 3839, 3840, 3841, 3842,
-    3843, 3844, 3845, 3846, 3847, 3848, 3849, 3850,
-    3851, 522, 3852, 3852, 3853, 3854, 3855, 214,
-    340, 3856, 3857, 3858, 3859, 214, 214, 3860,
-    3861, 3862, 3863, 3864, 3865, 3866, 3867, 3868,
-    3869, 3870, 3871, 3872, 3873, 3874, 3875, 3876,
-    3877, 3878, 3879, 3880, 3881, 3882, 3883, 3884,
-    0, 3885, 3886, 3887, 3888, 3889, 3890, 3891,
-    3892, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    340, 3893, 3894, 214, 340, 340, 340, 340,
-    1160, 1160, 1160, 1153, 1160, 1160, 1160, 1168,
-    1160, 1160, 1160, 1160, 1153, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1159, 1159, 1153, 1153,
-    1159, 77, 77, 1085, 1085, 0, 0, 0,
-    0, 1190, 1190, 1190, 1190, 1190, 1190, 1191,
-    1191, 1189, 3895, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1428, 1428, 1428,
-    1428, 0, 0, 0, 0, 0, 0, 0,
-    0, 1159, 1159, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1159, 1159, 1159,
-    1159, 1159, 1159, 1159, 1159, 1159, 1159, 1159,
-    1159, 1159, 1159, 1159, 1159, 1168, 1153, 0,
-    0, 0, 0, 0, 0, 0, 0, 1177,
-    1177, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1178, 1178, 0, 0, 0, 0, 0,
-    0, 540, 540, 540, 540, 540, 540, 540,
-    540, 540, 540, 540, 540, 540, 540, 540,
-    540, 540, 540, 1160, 1160, 1160, 1160, 1160,
-    1160, 1177, 1177, 1177, 1160, 1177, 1160, 0,
-    0, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1178, 1178, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1153,
-    1153, 1153, 1153, 1153, 553, 553, 553, 1177,
-    1177, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153,
-    1153, 1153, 1153, 1159, 1452, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    1177, 1327, 1327, 1327, 1327, 1327, 1327, 1327,
-    1327, 1327, 1327, 1327, 1327, 1327, 1327, 1327,
-    1327, 1327, 1327, 1327, 1327, 1327, 1327, 1327,
-    1327, 1327, 1327, 1327, 1327, 1327, 0, 0,
-    0, 1153, 1153, 1153, 1159, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1180, 1159, 1159, 1153,
-    1153, 1153, 1153, 1159, 1159, 1153, 1159, 1159,
-    1159, 1452, 1177, 1177, 1177, 1177, 1177, 1177,
-    1177, 1177, 1177, 1177, 1177, 1177, 1177, 0,
-    1179, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1178, 1178, 0, 0, 0, 0, 1177,
-    1177, 340, 1160, 1160, 1160, 1160, 1153, 523,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    340, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-    1250, 1250, 1178, 1160, 1160, 1160, 340, 1160,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1153, 1153, 1153, 1153, 1153, 1153,
-    1159, 1159, 1153, 1153, 1159, 1159, 1153, 1153,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1153, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1153, 1159, 0,
-    0, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1178, 1178, 0, 0, 1177, 1177, 1177,
-    1177, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1179, 1160, 1160, 1160, 1160, 1160, 1160,
-    1191, 1191, 1191, 1160, 1284, 1153, 1284, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 540, 1160, 540, 540, 553, 1160, 1160,
-    540, 540, 1160, 1160, 1160, 1160, 1160, 540,
-    540, 1160, 540, 1160, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 1160, 1160, 1179, 1177,
-    1177, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1159, 1153, 1153, 1159,
-    1159, 1177, 1177, 1160, 1179, 1179, 1159, 1168,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 1160, 1160, 1160, 1160, 1160, 1160,
-    0, 0, 1160, 1160, 1160, 1160, 1160, 1160,
-    0, 0, 1160, 1160, 1160, 1160, 1160, 1160,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    0, 214, 214, 214, 214, 214, 214, 214,
-    214, 214, 214, 214, 214, 214, 214, 214,
-    214, 214, 214, 214, 214, 214, 214, 214,
-    214, 214, 214, 214, 214, 214, 214, 214,
-    214, 214, 214, 214, 3896, 214, 214, 214,
-    214, 214, 214, 214, 3852, 3897, 3898, 3899,
-    3900, 214, 214, 214, 214, 214, 214, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 3901, 3902, 3903, 3904, 3905, 3906, 3907,
-    3908, 3909, 3910, 3911, 3912, 3913, 3914, 3915,
-    3916, 3917, 3918, 3919, 3920, 3921, 3922, 3923,
-    3924, 3925, 3926, 3927, 3928, 3929, 3930, 3931,
-    3932, 3933, 3934, 3935, 3936, 3937, 3938, 3939,
-    3940, 3941, 3942, 3943, 3944, 3945, 3946, 3947,
-    3948, 3949, 3950, 3951, 3952, 3953, 3954, 3955,
-    3956, 3957, 3958, 3959, 3960, 3961, 3962, 3963,
-    3964, 3965, 3966, 3967, 3968, 3969, 3970, 3971,
-    3972, 3973, 3974, 3975, 3976, 3977, 3978, 3979,
-    3980, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1159, 1159, 1153, 1159,
-    1159, 1153, 1159, 1159, 1177, 1159, 1168, 0,
-    0, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1178, 1178, 0, 0, 0, 0, 0,
-    0, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3981, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3981, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 3982, 3982, 3982,
-    3982, 3982, 3982, 3982, 3982, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1330, 1330, 1330, 1330, 1330, 1330, 1330,
-    1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330,
-    1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330,
-    0, 0, 0, 0, 1331, 1331, 1331, 1331,
-    1331, 1331, 1331, 1331, 1331, 1331, 1331, 1331,
-    1331, 1331, 1331, 1331, 1331, 1331, 1331, 1331,
-    1331, 1331, 1331, 1331, 1331, 1331, 1331, 1331,
-    1331, 1331, 1331, 1331, 1331, 1331, 1331, 1331,
-    1331, 1331, 1331, 1331, 1331, 1331, 1331, 1331,
-    1331, 1331, 1331, 1331, 1331, 0, 0, 0,
-    0, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3983, 3983, 3983, 3983, 3983, 3983, 3983,
-    3983, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3985, 3986, 3987, 3988, 3989, 3990, 3991,
-    3992, 3992, 3993, 3994, 3995, 3996, 3997, 3998,
-    3999, 4000, 4001, 4002, 4003, 4004, 4005, 4006,
-    4007, 4008, 4009, 4010, 4011, 4012, 4013, 4014,
-    4015, 4016, 4017, 4018, 4019, 4020, 4021, 4022,
-    4023, 4024, 4025, 4026, 4027, 4028, 4029, 4030,
-    4031, 4032, 4033, 4034, 4035, 4036, 4037, 4038,
-    4039, 4040, 4041, 4042, 4043, 4044, 4045, 4046,
-    4047, 4048, 4049, 4050, 4051, 4052, 4053, 4054,
-    4055, 4056, 4057, 4058, 4059, 4060, 4061, 4062,
-    4063, 4064, 4065, 4066, 4067, 4068, 4069, 4070,
-    4071, 4072, 4073, 4074, 4075, 4004, 4076, 4077,
-    4078, 4079, 4080, 4081, 4082, 4083, 4084, 4085,
-    4086, 4087, 4088, 4089, 4090, 4091, 4092, 4093,
-    4094, 4095, 4096, 4097, 4098, 4099, 4100, 4101,
-    4102, 4103, 4104, 4105, 4106, 4107, 4108, 4109,
-    4110, 4111, 4112, 4113, 4114, 4115, 4116, 4117,
-    4118, 4119, 4120, 4121, 4122, 4123, 4124, 4125,
-    4126, 4127, 4128, 4129, 4130, 4131, 4132, 4133,
-    4134, 4135, 4136, 4137, 4138, 4139, 4140, 4141,
-    4142, 4143, 4094, 4144, 4145, 4146, 4147, 4148,
-    4149, 4150, 4151, 4078, 4152, 4153, 4154, 4155,
-    4156, 4157, 4158, 4159, 4160, 4161, 4162, 4163,
-    4164, 4165, 4166, 4167, 4168, 4169, 4170, 4171,
-    4004, 4172, 4173, 4174, 4175, 4176, 4177, 4178,
-    4179, 4180, 4181, 4182, 4183, 4184, 4185, 4186,
-    4187, 4188, 4189, 4190, 4191, 4192, 4193, 4194,
-    4195, 4196, 4197, 4198, 4080, 4199, 4200, 4201,
-    4202, 4203, 4204, 4205, 4206, 4207, 4208, 4209,
-    4210, 4211, 4212, 4213, 4214, 4215, 4216, 4217,
-    4218, 4219, 4220, 4221, 4222, 4223, 4224, 4225,
-    4226, 4227, 4228, 4229, 4230, 4231, 4232, 4233,
-    4234, 4235, 4236, 4237, 4238, 4239, 4240, 4241,
-    4242, 4243, 4244, 4245, 4246, 4247, 4248, 1160,
-    1160, 4249, 1160, 4250, 1160, 1160, 4251, 4252,
-    4253, 4254, 4255, 4256, 4257, 4258, 4259, 4260,
-    1160, 4261, 1160, 4262, 1160, 1160, 4263, 4264,
-    1160, 1160, 1160, 4265, 4266, 4267, 4268, 4269,
-    4270, 4271, 4272, 4273, 4274, 4275, 4276, 4277,
-    4278, 4279, 4280, 4281, 4282, 4283, 4284, 4285,
-    4286, 4287, 4288, 4289, 4290, 4291, 4292, 4293,
-    4294, 4295, 4296, 4297, 4298, 4299, 4300, 4301,
-    4302, 4303, 4304, 4305, 4306, 4307, 4308, 4309,
-    4133, 4310, 4311, 4312, 4313, 4314, 4315, 4315,
-    4316, 4317, 4318, 4319, 4320, 4321, 4322, 4323,
-    4263, 4324, 4325, 4326, 4327, 4328, 4329, 0,
-    0, 4330, 4331, 4332, 4333, 4334, 4335, 4336,
-    4337, 4277, 4338, 4339, 4340, 4249, 4341, 4342,
-    4343, 4344, 4345, 4346, 4347, 4348, 4349, 4350,
-    4351, 4352, 4286, 4353, 4287, 4354, 4355, 4356,
-    4357, 4358, 4250, 4025, 4359, 4360, 4361, 4095,
-    4182, 4362, 4363, 4294, 4364, 4295, 4365, 4366,
-    4367, 4252, 4368, 4369, 4370, 4371, 4372, 4253,
-    4373, 4374, 4375, 4376, 4377, 4378, 4309, 4379,
-    4380, 4133, 4381, 4313, 4382, 4383, 4384, 4385,
-    4386, 4318, 4387, 4262, 4388, 4319, 4076, 4389,
-    4320, 4390, 4322, 4391, 4392, 4393, 4394, 4395,
-    4324, 4258, 4396, 4325, 4397, 4326, 4398, 3992,
-    4399, 4400, 4401, 4402, 4403, 4404, 4405, 4406,
-    4407, 4408, 4409, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 4410, 4411, 4412, 4413, 4414, 4415, 4416,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 4417, 4418, 4419, 4420,
-    4421, 0, 0, 0, 0, 0, 4422, 4423,
-    4424, 4425, 4426, 4427, 4428, 4429, 4430, 4431,
-    4432, 4433, 4434, 4435, 4436, 4437, 4438, 4439,
-    4440, 4441, 4442, 4443, 4444, 4445, 4446, 4447,
-    0, 4448, 4449, 4450, 4451, 4452, 0, 4453,
-    0, 4454, 4455, 0, 4456, 4457, 0, 4458,
-    4459, 4460, 4461, 4462, 4463, 4464, 4465, 4466,
-    4467, 4468, 4469, 4470, 4471, 4472, 4473, 4474,
-    4475, 4476, 4477, 4478, 4479, 4480, 4481, 4482,
-    4483, 4484, 4485, 4486, 4487, 4488, 4489, 4490,
-    4491, 4492, 4493, 4494, 4495, 4496, 4497, 4498,
-    4499, 4500, 4501, 4502, 4503, 4504, 4505, 4506,
-    4507, 4508, 4509, 4510, 4511, 4512, 4513, 4514,
-    4515, 4516, 4517, 4518, 4519, 4520, 4521, 4522,
-    4523, 4524, 4525, 4526, 4527, 4528, 4529, 4530,
-    4531, 4532, 4533, 4534, 4535, 4536, 4537, 4538,
-    4539, 4540, 4541, 4542, 4543, 4544, 4545, 4546,
-    4547, 4548, 4549, 4550, 4551, 4552, 4553, 4554,
-    4555, 4556, 4557, 4558, 4559, 4560, 4561, 4562,
-    4563, 4564, 4565, 4566, 4566, 4566, 4566, 4566,
-    4566, 4566, 4566, 4566, 4566, 4566, 4566, 4566,
-    4566, 4566, 4566, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 4567, 4568, 4569, 4570,
-    4571, 4572, 4573, 4574, 4575, 4576, 4577, 4578,
-    4579, 4580, 4581, 4582, 4583, 4584, 4585, 4586,
-    4587, 4588, 4589, 4590, 4591, 4592, 4593, 4594,
-    4595, 4596, 4597, 4598, 4599, 4600, 4601, 4602,
-    4603, 4604, 4605, 4606, 4607, 4608, 4609, 4610,
-    4611, 4612, 4613, 4614, 4605, 4615, 4616, 4617,
-    4618, 4619, 4620, 4621, 4622, 4623, 4624, 4625,
-    4626, 4627, 4628, 4629, 4630, 4631, 4632, 4633,
-    4634, 4635, 4636, 4637, 4638, 4639, 4640, 4641,
-    4642, 4643, 4644, 4645, 4646, 4647, 4648, 4649,
-    4650, 4651, 4652, 4653, 4654, 4655, 4656, 4657,
-    4658, 4659, 4660, 4661, 4662, 4663, 4664, 4665,
-    4666, 4667, 4668, 4669, 4670, 4671, 4672, 4673,
-    4674, 4675, 4676, 4677, 4678, 4679, 4680, 4681,
-    4682, 4683, 4684, 4685, 4686, 4687, 4688, 4689,
-    4690, 4691, 4692, 4693, 4694, 4695, 4696, 4697,
-    4698, 4699, 4700, 4701, 4702, 4703, 4704, 4705,
-    4706, 4707, 4708, 4709, 4710, 4711, 4712, 4713,
-    4714, 4606, 4715, 4716, 4717, 4718, 4719, 4720,
-    4721, 4722, 4723, 4724, 4725, 4726, 4727, 4728,
-    4729, 4730, 4731, 4732, 4733, 4734, 4735, 4736,
-    4737, 4738, 4739, 4740, 4741, 4742, 4743, 4744,
-    4745, 4746, 4747, 4748, 4749, 4750, 4751, 4752,
-    4753, 4754, 4755, 4756, 4757, 4758, 4759, 4760,
-    4761, 4762, 4763, 4764, 4765, 4766, 4767, 4768,
-    4769, 4770, 4771, 4772, 4773, 4774, 4775, 4776,
-    4777, 4778, 4779, 4780, 4781, 4782, 4783, 4784,
-    4785, 4786, 4787, 4788, 4789, 4790, 4791, 4792,
-    4793, 4794, 4795, 4796, 4797, 4798, 4799, 4800,
-    4801, 4802, 4803, 4804, 4805, 4806, 4807, 4808,
-    4809, 4810, 4811, 4812, 4813, 4814, 4815, 4816,
-    4817, 4818, 4819, 4820, 4821, 4822, 4823, 4824,
-    4825, 4826, 4827, 4828, 4829, 4830, 4831, 4832,
-    4833, 4834, 4835, 4836, 4837, 4838, 4839, 4840,
-    4841, 4842, 4843, 4844, 4845, 4846, 4847, 4848,
-    4849, 4850, 4851, 4852, 4853, 4854, 4855, 4856,
-    4857, 4858, 4859, 4860, 4861, 4862, 4863, 4864,
-    4865, 4866, 4867, 4868, 4869, 4870, 4871, 4872,
-    4873, 4874, 4875, 4876, 4877, 4878, 4879, 4880,
-    4881, 4882, 4883, 4884, 4885, 4886, 4887, 4888,
-    4889, 4890, 4891, 4892, 4893, 4894, 4895, 4896,
-    4897, 4898, 4899, 4900, 4901, 4902, 4903, 4904,
-    4905, 4906, 4907, 4908, 4909, 4910, 4911, 4912,
-    4913, 4914, 4915, 4916, 4917, 4918, 4919, 4920,
-    4921, 4922, 4923, 4924, 4925, 4926, 4927, 2956,
-    2955, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 4928, 4929, 4930, 4931, 4932, 4933, 4934,
-    4935, 4936, 4937, 4938, 4939, 4940, 4941, 4942,
-    4943, 4944, 4945, 4946, 4947, 4948, 4949, 4950,
-    4951, 4952, 4953, 4954, 4955, 4956, 4957, 4958,
-    4959, 4960, 4961, 4962, 4963, 4964, 4965, 4966,
-    4967, 4968, 4969, 4970, 4971, 4972, 4973, 4974,
-    4975, 4976, 4977, 4978, 4979, 4980, 4981, 4982,
-    4983, 4984, 4985, 4986, 4987, 4988, 4989, 4990,
-    4991, 0, 0, 4992, 4993, 4994, 4995, 4996,
-    4997, 4998, 4999, 5000, 5001, 5002, 5003, 5004,
-    5005, 5006, 5007, 5008, 5009, 5010, 5011, 5012,
-    5013, 5014, 5015, 5016, 5017, 5018, 5019, 5020,
-    5021, 5022, 5023, 5024, 5025, 5026, 5027, 5028,
-    5029, 5030, 5031, 5032, 5033, 5034, 5035, 5036,
-    5037, 5038, 5039, 5040, 5041, 5042, 5043, 5044,
-    5045, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 5046, 5047, 5048, 5049, 5050, 5051, 5052,
-    5053, 5054, 5055, 5056, 5057, 5058, 1085, 0,
-    0, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 5059, 5060, 5061, 5062, 5063, 5064, 5065,
-    5066, 5067, 5068, 0, 0, 0, 0, 0,
-    0, 540, 540, 540, 540, 540, 540, 540,
-    553, 553, 553, 553, 553, 553, 553, 540,
-    540, 5069, 5070, 5071, 5072, 5072, 5073, 5074,
-    5075, 5076, 5077, 5078, 5079, 5080, 5081, 5082,
-    5083, 5084, 5085, 5086, 5087, 5088, 1428, 1428,
-    5089, 5090, 5091, 5091, 5091, 5091, 5092, 5092,
-    5092, 5093, 5094, 5095, 0, 5096, 5097, 5098,
-    5099, 5100, 5101, 5102, 5103, 5104, 5105, 5106,
-    5107, 5108, 5109, 5110, 5111, 5112, 5113, 5114,
-    0, 5115, 5116, 5117, 5118, 0, 0, 0,
-    0, 5119, 5120, 5121, 1118, 5122, 0, 5123,
-    5124, 5125, 5126, 5127, 5128, 5129, 5130, 5131,
-    5132, 5133, 5134, 5135, 5136, 5137, 5138, 5139,
-    5140, 5141, 5142, 5143, 5144, 5145, 5146, 5147,
-    5148, 5149, 5150, 5151, 5152, 5153, 5154, 5155,
-    5156, 5157, 5158, 5159, 5160, 5161, 5162, 5163,
-    5164, 5165, 5166, 5167, 5168, 5169, 5170, 5171,
-    5172, 5173, 5174, 5175, 5176, 5177, 5178, 5179,
-    5180, 5181, 5182, 5183, 5184, 5185, 5186, 5187,
-    5188, 5189, 5190, 5191, 5192, 5193, 5194, 5195,
-    5196, 5197, 5198, 5199, 5200, 5201, 5202, 5203,
-    5204, 5205, 5206, 5207, 5208, 5209, 5210, 5211,
-    5212, 5213, 5214, 5215, 5216, 5217, 5218, 5219,
-    5220, 5221, 5222, 5223, 5224, 5225, 5226, 5227,
-    5228, 5229, 5230, 5231, 5232, 5233, 5234, 5235,
-    5236, 5237, 5238, 5239, 5240, 5241, 5242, 5243,
-    5244, 5245, 5246, 5247, 5248, 5249, 5250, 5251,
-    5252, 5253, 5254, 5255, 5256, 5257, 0, 0,
-    81, 0, 5258, 5259, 5260, 5261, 5262, 5263,
-    5264, 5265, 5266, 5267, 5268, 5269, 5270, 5271,
-    5272, 5273, 5274, 5275, 5276, 5277, 5278, 5279,
-    5280, 5281, 5282, 5283, 5284, 5285, 5286, 5287,
-    5288, 5289, 5290, 5291, 5292, 5293, 5294, 5295,
-    5296, 5297, 5298, 5299, 5300, 5301, 5302, 5303,
-    5304, 5305, 5306, 5307, 5308, 5309, 5310, 5311,
-    5312, 5313, 5314, 5315, 5316, 5317, 5318, 5319,
-    5320, 5321, 5322, 5323, 5324, 5325, 5326, 5327,
-    5328, 5329, 5330, 5331, 5332, 5333, 5334, 5335,
-    5336, 5337, 5338, 5339, 5340, 5341, 5342, 5343,
-    5344, 5345, 5346, 5347, 5348, 5349, 5350, 5351,
-    5352, 5353, 5354, 5355, 5356, 5357, 5358, 5359,
-    5360, 5361, 5362, 5363, 5364, 5365, 5366, 5367,
-    5368, 5369, 5370, 5371, 5372, 5373, 5374, 5375,
-    5376, 5377, 5378, 5379, 5380, 5381, 5382, 5383,
-    5384, 5385, 5386, 5387, 5388, 5389, 5390, 5391,
-    5392, 5393, 5394, 5395, 5396, 5397, 5398, 5399,
-    5400, 5401, 5402, 5403, 5404, 5405, 5406, 5407,
-    5408, 5409, 5410, 5411, 5412, 5413, 5414, 5415,
-    5416, 5417, 5418, 5419, 5420, 5421, 5422, 5423,
-    5424, 5425, 5426, 5427, 5428, 5429, 5430, 5431,
-    5432, 5433, 5434, 5435, 5436, 5437, 5438, 5439,
-    5440, 5441, 5442, 5443, 5444, 5445, 5446, 5447,
-    0, 0, 0, 5448, 5449, 5450, 5451, 5452,
-    5453, 0, 0, 5454, 5455, 5456, 5457, 5458,
-    5459, 0, 0, 5460, 5461, 5462, 5463, 5464,
-    5465, 0, 0, 5466, 5467, 5468, 0, 0,
-    0, 5469, 5470, 5471, 5472, 5473, 5474, 5475,
-    0, 5476, 5477, 5478, 5479, 5480, 5481, 5482,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 5483, 5483, 5483, 1085, 77, 0,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 0, 340, 1160,
-    1160, 340, 340, 340, 1160, 340, 340, 340,
-    340, 340, 340, 340, 340, 1160, 340, 340,
-    340, 340, 340, 1160, 1160, 1160, 340, 340,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 1160,
-    340, 340, 340, 340, 0, 340, 340, 0,
-    340, 340, 1160, 340, 340, 1160, 1160, 1160,
-    340, 340, 340, 1160, 1160, 340, 1160, 0,
-    0, 340, 340, 1160, 340, 340, 1160, 340,
-    1160, 1160, 1160, 340, 1160, 1160, 1160, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 340, 340, 1160, 1160, 1160, 1160, 340,
-    340, 340, 340, 1160, 1160, 1160, 1160, 1160,
-    340, 1160, 340, 340, 340, 340, 1160, 1160,
-    1160, 1160, 1160, 340, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    340, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 340, 1160, 340, 1160,
-    1160, 1160, 1160, 1160, 340, 340, 1160, 1160,
-    1160, 1160, 1160, 1160, 340, 1160, 1160, 1160,
-    1160, 1160, 340, 340, 340, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    340, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 0, 0, 0, 0,
-    0, 1044, 9, 1044, 0, 0, 0, 0,
-    5484, 5484, 5484, 5484, 5484, 5484, 5484, 5484,
-    5484, 5484, 5484, 5484, 5484, 5484, 5484, 5484,
-    5484, 5484, 5484, 5484, 5484, 5484, 5484, 5484,
-    5484, 5484, 1190, 5484, 1190, 5484, 1190, 1190,
-    1190, 1190, 1190, 1190, 5484, 1190, 5484, 1190,
-    1190, 1190, 1190, 1190, 1190, 0, 0, 0,
-    1191, 838, 1191, 838, 838, 838, 838, 838,
-    1191, 5485, 5485, 5485, 5485, 5485, 5485, 5485,
-    5485, 5485, 5485, 5485, 5485, 5485, 5485, 5485,
-    5485, 5485, 5485, 5485, 5485, 5485, 5485, 5485,
-    5485, 5485, 5485, 5485, 5485, 5485, 5485, 5485,
-    5485, 5485, 5485, 5485, 5485, 5485, 5485, 5485,
-    5485, 5485, 5486, 5486, 5486, 5486, 5486, 5486,
-    5485, 5486, 5485, 5485, 5485, 5485, 1427, 1427,
-    1220, 1427, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 1085, 77, 1427, 1427, 77, 838, 838,
-    0, 77, 77, 77, 77, 77, 77, 77,
-    1085, 1085, 1085, 77, 77, 0, 0, 0,
-    0, 77, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1191, 1191, 1191, 1191, 1191, 1191, 1191,
-    1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191,
-    1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191,
-    1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191,
-    1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191,
-    1191, 1191, 1191, 1191, 1191, 1191, 553, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 1160,
-    1160, 340, 340, 340, 340, 340, 340, 340,
-    340, 1160, 340, 1160, 340, 340, 0, 0,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 1160, 340, 340, 340, 340, 340, 340,
-    1160, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 553, 5487, 5487, 5487, 5487, 5487, 5487,
-    5487, 5487, 5487, 5487, 5487, 5487, 5487, 5487,
-    5487, 5487, 5487, 5487, 5487, 5487, 5487, 5487,
-    5487, 5487, 5487, 5487, 5487, 0, 0, 0,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 5484, 5484, 5484, 5484, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 1426, 340, 340, 340, 340, 340,
-    340, 340, 340, 1426, 0, 0, 0, 0,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 540,
-    540, 540, 540, 540, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 0,
-    1177, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1177, 2227, 2227, 2227, 2227, 2227, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 5488, 5489, 5490, 5491, 5492, 5493, 5494,
-    5495, 5496, 5497, 5498, 5499, 5500, 5501, 5502,
-    5503, 5504, 5505, 5506, 5507, 5508, 5509, 5510,
-    5511, 5512, 5513, 5514, 5515, 5516, 5517, 5518,
-    5519, 5520, 5521, 5522, 5523, 5524, 5525, 5526,
-    5527, 5528, 5529, 5530, 5531, 5532, 5533, 5534,
-    5535, 5536, 5537, 5538, 5539, 5540, 5541, 5542,
-    5543, 5544, 5545, 5546, 5547, 5548, 5549, 5550,
-    5551, 5552, 5553, 5554, 5555, 5556, 5557, 5558,
-    5559, 5560, 5561, 5562, 5563, 5564, 5565, 5566,
-    5567, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 1160, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 1160,
-    340, 1160, 340, 340, 1160, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 1160, 0,
-    0, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-    1250, 1250, 1250, 0, 0, 0, 0, 0,
-    0, 5568, 5569, 5570, 5571, 5572, 5573, 5574,
-    5575, 5576, 5577, 5578, 5579, 5580, 5581, 5582,
-    5583, 5584, 5585, 5586, 5587, 5588, 5589, 5590,
-    5591, 5592, 5593, 5594, 5595, 5596, 5597, 5598,
-    5599, 5600, 5601, 5602, 5603, 0, 0, 0,
-    0, 5604, 5605, 5606, 5607, 5608, 5609, 5610,
-    5611, 5612, 5613, 5614, 5615, 5616, 5617, 5618,
-    5619, 5620, 5621, 5622, 5623, 5624, 5625, 5626,
-    5627, 5628, 5629, 5630, 5631, 5632, 5633, 5634,
-    5635, 5636, 5637, 5638, 5639, 0, 0, 0,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    1044, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 1160, 340, 340, 340,
-    340, 1160, 340, 1160, 1160, 1160, 340, 340,
-    340, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 340, 340, 1160, 340, 340, 1160, 1160,
-    340, 340, 1160, 1160, 1160, 1160, 340, 1160,
-    340, 340, 340, 340, 340, 1160, 1160, 1160,
-    340, 1160, 340, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 340, 1160, 1160, 1160, 340,
-    1160, 1160, 340, 340, 1160, 1160, 1160, 1160,
-    1160, 1160, 340, 340, 1160, 1160, 1160, 340,
-    340, 340, 340, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 340, 1160, 1160, 1160, 1160,
-    340, 1160, 1160, 340, 340, 340, 1160, 1160,
-    1160, 1160, 340, 340, 340, 1160, 1160, 1160,
-    1160, 340, 1160, 1160, 1160, 1160, 1160, 1160,
-    340, 1160, 1160, 1160, 1160, 1160, 340, 340,
-    1160, 1160, 340, 1160, 1160, 340, 1160, 1160,
-    1160, 1160, 1160, 340, 1160, 1160, 1160, 340,
-    1160, 1160, 340, 1160, 1160, 340, 1160, 340,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 340, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    340, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 340, 340, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 340, 1160,
-    340, 340, 340, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 340, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    340, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 1160, 1160, 1160, 1160, 1160, 1160,
-    340, 340, 1160, 1160, 340, 1160, 340, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1156, 1156, 1156, 1106, 1156, 1106, 0,
-    0, 1156, 0, 1106, 1156, 1156, 1156, 1156,
-    1156, 1106, 1156, 1106, 1156, 1156, 1156, 1156,
-    1156, 1156, 1106, 1156, 1156, 1156, 1156, 1106,
-    1156, 1106, 1156, 1156, 1106, 1106, 1156, 1106,
-    1156, 1106, 1106, 1106, 1106, 1156, 1106, 1106,
-    1106, 1106, 1106, 1156, 1106, 1156, 1106, 0,
-    1156, 1106, 0, 0, 0, 1156, 0, 0,
-    1156, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 1106, 0,
-    1103, 5640, 5640, 5640, 5640, 5640, 5640, 5640,
-    5640, 1156, 1156, 1156, 1106, 1106, 1106, 1106,
-    1156, 1106, 1106, 1156, 1106, 1156, 1106, 1106,
-    1156, 1156, 1106, 1156, 1156, 1106, 1156, 1156,
-    5641, 5641, 5640, 5640, 5642, 5642, 5642, 5642,
-    5640, 1156, 1106, 1156, 1156, 1156, 1106, 1106,
-    1106, 1106, 1106, 1156, 1156, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 1106, 1156,
-    1156, 1106, 1156, 1156, 1106, 1106, 1106, 1106,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    5640, 5640, 5640, 5640, 5640, 5640, 5640, 5640,
-    5640, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 0, 1106, 1106, 0,
-    0, 0, 0, 0, 5640, 5640, 5640, 5640,
-    5640, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 1106, 5640,
-    5640, 5640, 5640, 5640, 5640, 0, 0, 0,
-    9, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 0, 0, 0, 0, 0,
-    1103, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1156, 1106, 1156, 1156, 1156, 1156, 1156,
-    1106, 1156, 1156, 1156, 1156, 1156, 1156, 1156,
-    1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156,
-    1106, 1156, 1156, 1156, 1156, 1156, 1156, 1106,
-    1156, 1156, 1106, 1156, 1106, 1156, 1106, 1106,
-    1106, 1106, 1156, 1106, 1156, 1106, 1156, 1106,
-    1106, 1106, 1156, 1106, 1156, 1106, 1156, 1156,
-    1106, 0, 0, 0, 0, 5642, 5640, 1106,
-    1156, 5640, 5640, 5640, 5640, 5642, 5642, 5642,
-    5640, 5640, 5642, 5642, 5642, 5642, 5642, 5642,
-    5642, 0, 0, 5642, 5642, 5642, 5642, 5642,
-    5642, 5642, 5642, 5642, 5642, 5642, 5642, 5642,
-    5642, 5642, 5642, 5642, 5642, 5642, 5642, 5642,
-    5642, 5642, 5642, 5642, 5642, 5642, 5642, 5642,
-    5642, 5642, 5642, 5642, 5642, 5642, 5642, 5640,
-    5640, 5640, 5640, 5642, 5640, 5642, 5642, 5642,
-    5642, 1156, 1153, 1153, 1153, 0, 1153, 1153,
-    0, 0, 0, 0, 0, 1153, 553, 1153,
-    540, 1156, 1156, 1156, 1156, 0, 1156, 1156,
-    1156, 0, 1156, 1156, 1156, 1156, 1156, 1156,
-    1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156,
-    1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156,
-    1156, 1156, 1156, 1156, 1156, 0, 0, 0,
-    0, 540, 566, 553, 0, 0, 0, 0,
-    1168, 5642, 5642, 5642, 5642, 5642, 5642, 5642,
-    5642, 0, 0, 0, 0, 0, 0, 0,
-    0, 1158, 1158, 1158, 1158, 1158, 1158, 1158,
-    1158, 1158, 0, 0, 0, 0, 0, 0,
-    0, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 5640, 5640,
-    1103, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 5640, 5640,
-    5640, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1106, 1156, 1156, 1106, 1106, 1106, 1156,
-    1106, 5643, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1156, 1156, 1156, 1106, 1156, 1156, 1156,
-    1106, 1156, 1156, 1156, 1156, 1156, 1156, 1156,
-    1156, 1156, 1106, 1156, 1156, 1106, 540, 553,
-    0, 0, 0, 0, 5640, 5642, 5642, 5642,
-    5642, 1158, 1158, 1158, 1158, 1103, 1103, 1103,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1106, 1156, 1156, 1156, 1156, 1106, 1106,
-    1106, 1156, 1156, 1156, 1156, 1106, 1106, 1106,
-    1106, 1106, 1156, 1156, 1156, 1156, 1106, 1156,
-    1106, 1106, 1106, 1106, 1156, 1106, 1106, 1106,
-    1106, 1156, 1156, 1106, 1106, 1106, 1106, 1106,
-    1156, 1106, 1106, 1156, 1156, 1106, 1106, 1106,
-    1106, 1106, 1156, 1156, 1156, 1156, 1156, 0,
-    0, 0, 9, 9, 9, 9, 9, 9,
-    9, 1156, 1156, 1106, 1106, 1156, 1106, 1106,
-    1106, 1156, 1106, 1156, 1106, 1156, 1156, 1106,
-    1106, 1156, 1156, 1106, 1106, 1106, 1106, 0,
-    0, 5640, 5640, 5640, 5640, 5640, 5640, 5642,
-    5640, 1106, 1106, 1106, 1106, 1156, 1106, 1106,
-    1156, 1106, 1106, 1106, 1106, 1156, 1106, 1156,
-    1106, 1106, 1156, 1106, 0, 0, 0, 0,
-    0, 5640, 5640, 5640, 5640, 5640, 5640, 5640,
-    5640, 1106, 1156, 1106, 1156, 1106, 1106, 1106,
-    1156, 1106, 1156, 1106, 1106, 1106, 1156, 1106,
-    1106, 1156, 1106, 0, 0, 0, 0, 0,
-    0, 0, 1158, 1158, 1158, 1158, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 5640, 5640, 5640, 5642, 5640, 5640,
-    5642, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
-    1106, 1106, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 5644, 5645, 5646, 5647, 5648, 5649, 5650,
-    5651, 5652, 5653, 5654, 5655, 5656, 5657, 5658,
-    5659, 5660, 5661, 5662, 5663, 5664, 5665, 5666,
-    5667, 5668, 5669, 5670, 5671, 5672, 5673, 5674,
-    5675, 5676, 5677, 5678, 5679, 5680, 5681, 5682,
-    5683, 5684, 5685, 5686, 5687, 5688, 5689, 5690,
-    5691, 5692, 5693, 5694, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 5695, 5696, 5697, 5698, 5699, 5700, 5701,
-    5702, 5703, 5704, 5705, 5706, 5707, 5708, 5709,
-    5710, 5711, 5712, 5713, 5714, 5715, 5716, 5717,
-    5718, 5719, 5720, 5721, 5722, 5723, 5724, 5725,
-    5726, 5727, 5728, 5729, 5730, 5731, 5732, 5733,
-    5734, 5735, 5736, 5737, 5738, 5739, 5740, 5741,
-    5742, 5743, 5744, 5745, 0, 0, 0, 0,
-    0, 0, 0, 5640, 5640, 5640, 5640, 5640,
-    5640, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 5746, 5746, 5747, 5746, 5746, 5746, 5746,
-    5746, 5747, 5746, 5746, 5747, 5747, 5747, 5746,
-    5746, 5747, 5746, 5746, 5746, 5747, 5747, 5746,
-    5747, 5747, 5746, 5746, 5747, 5747, 5747, 5747,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1159, 1153, 1159, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1153, 1153, 1153, 1153, 1153, 1153, 1153,
-    1153, 1153, 1153, 1153, 1153, 1153, 1153, 1168,
-    1177, 1177, 1177, 1177, 1177, 1177, 1177, 0,
-    0, 0, 0, 1220, 1220, 1220, 1220, 1220,
-    1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220,
-    1220, 1220, 1220, 1220, 1220, 1220, 1220, 1178,
-    1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    1168, 1153, 1153, 1159, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 5748, 5749, 5750, 5751, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 5752, 1160,
-    1160, 1160, 1160, 1160, 5753, 1160, 1160, 1160,
-    1160, 1159, 1159, 1159, 1153, 1153, 1153, 1153,
-    1159, 1159, 1168, 5754, 1177, 1177, 5755, 1177,
-    1177, 1177, 1177, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 0, 0, 0, 0, 0, 0,
-    0, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-    1250, 1250, 1250, 0, 0, 0, 0, 0,
-    0, 540, 540, 540, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    5756, 1153, 1153, 1153, 1153, 1159, 1153, 5757,
-    5758, 1153, 5759, 5760, 1168, 1168, 0, 1178,
-    1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1177, 1177, 1177, 1177, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 340, 340, 340, 1160, 340, 340,
-    340, 340, 1160, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 1160, 340, 1160,
-    1160, 1160, 1160, 1160, 340, 1160, 340, 1160,
-    340, 340, 340, 340, 1180, 1044, 1044, 1160,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1153, 1153, 1159, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1159, 1159, 1159, 1153,
-    1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153,
-    1159, 1452, 1160, 1237, 1237, 1160, 1177, 1177,
-    1177, 1177, 1177, 1180, 1153, 1153, 1177, 0,
-    0, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1178, 1178, 1160, 1177, 1160, 1177, 1177,
-    1177, 0, 1190, 1190, 1190, 1190, 1190, 1190,
-    1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190,
-    1190, 1190, 1190, 1190, 1190, 1190, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 0, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1159, 1159, 1159,
-    1153, 1153, 1153, 1159, 1159, 1153, 1452, 1180,
-    1153, 1177, 1177, 1177, 1177, 1177, 1177, 1153,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    0, 1160, 0, 1160, 1160, 1160, 1160, 0,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 0,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1177, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1153, 1159, 1159, 1159, 1153, 1153, 1153, 1153,
-    1153, 1153, 1180, 1168, 0, 0, 0, 0,
-    0, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1178, 1178, 0, 0, 0, 0, 0,
-    0, 1153, 1153, 1159, 1159, 0, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 0, 0,
-    1160, 1160, 0, 0, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 0, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 0, 1160, 1160, 0, 1160, 1160,
-    1160, 1160, 1160, 0, 0, 1180, 1160, 5761,
-    1159, 1153, 1159, 1159, 1159, 1159, 0, 0,
-    5762, 1159, 0, 0, 5763, 5764, 1452, 0,
-    0, 1160, 0, 0, 0, 0, 0, 0,
-    5765, 0, 0, 0, 0, 0, 1160, 1160,
-    1160, 1160, 1160, 1159, 1159, 0, 0, 540,
-    540, 540, 540, 540, 540, 540, 0, 0,
-    0, 540, 540, 540, 540, 540, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1159, 1159,
-    1159, 1153, 1153, 1153, 1153, 1153, 1153, 1153,
-    1153, 1159, 1159, 1168, 1153, 1153, 1159, 1180,
-    1160, 1160, 1160, 1160, 1177, 1177, 1177, 1177,
-    1177, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1178, 1178, 0, 1177, 0, 1177, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 5766, 1159, 1159, 1153, 1153, 1153, 1153,
-    1153, 1153, 5767, 5768, 5769, 5770, 5771, 5772,
-    1153, 1153, 1159, 1168, 1180, 1160, 1160, 1177,
-    1160, 0, 0, 0, 0, 0, 0, 0,
-    0, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1178, 1178, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    5773, 1159, 1159, 1153, 1153, 1153, 1153, 0,
-    0, 5774, 5775, 5776, 5777, 1153, 1153, 1159,
-    1168, 1180, 1177, 1177, 1177, 1177, 1177, 1177,
-    1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177,
-    1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177,
-    1177, 1160, 1160, 1160, 1160, 1153, 1153, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1159, 1159, 1159, 1153, 1153, 1153, 1153,
-    1153, 1153, 1153, 1153, 1159, 1159, 1153, 1159,
-    1168, 1153, 1177, 1177, 1177, 1160, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1178, 1178, 0, 0, 0, 0, 0,
-    0, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
-    1428, 1428, 1428, 1428, 1428, 1428, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1153, 1159, 1153, 1159,
-    1159, 1153, 1153, 1153, 1153, 1153, 1153, 1452,
-    1180, 0, 0, 0, 0, 0, 0, 0,
-    0, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1178, 1178, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 0, 0, 0, 1153, 1153,
-    1153, 1159, 1159, 1153, 1153, 1153, 1153, 1159,
-    1153, 1153, 1153, 1153, 1168, 0, 0, 0,
-    0, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1178, 1178, 1190, 1190, 1177, 1177, 1177,
-    1191, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 5778, 5779, 5780, 5781, 5782, 5783, 5784,
-    5785, 5786, 5787, 5788, 5789, 5790, 5791, 5792,
-    5793, 5794, 5795, 5796, 5797, 5798, 5799, 5800,
-    5801, 5802, 5803, 5804, 5805, 5806, 5807, 5808,
-    5809, 5810, 5811, 5812, 5813, 5814, 5815, 5816,
-    5817, 5818, 5819, 5820, 5821, 5822, 5823, 5824,
-    5825, 5826, 5827, 5828, 5829, 5830, 5831, 5832,
-    5833, 5834, 5835, 5836, 5837, 5838, 5839, 5840,
-    5841, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-    1250, 1250, 1250, 5484, 5484, 5484, 5484, 5484,
-    5484, 5484, 5484, 5484, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    340, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 0, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    5842, 1153, 1153, 1153, 1153, 1153, 1153, 1153,
-    0, 1153, 1153, 1153, 1153, 1153, 1153, 1159,
-    5843, 1160, 1177, 1177, 1177, 1177, 1177, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
-    1178, 1178, 1178, 1190, 1190, 1190, 1190, 1190,
-    1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190,
-    1190, 1190, 1190, 1190, 1190, 1190, 0, 0,
-    0, 1044, 1044, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 0, 0, 1153, 1153, 1153, 1153, 1153,
-    1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153,
-    1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153,
-    1153, 0, 1159, 1153, 1153, 1153, 1153, 1153,
-    1153, 1153, 1159, 1153, 1153, 1159, 1153, 1153,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-    1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-    1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-    1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-    1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-    1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-    1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-    1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-    1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-    1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-    1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-    1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-    1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-    1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
-    0, 1044, 1044, 1044, 1044, 1044, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 0, 0, 0, 0, 0, 0,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    0, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-    1250, 1250, 1250, 0, 0, 0, 0, 1044,
-    1044, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 0,
-    0, 566, 566, 566, 566, 566, 1044, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 540, 540, 540, 540, 540, 540, 540,
-    1044, 1044, 1044, 1044, 1044, 838, 838, 838,
-    838, 523, 523, 523, 523, 1044, 838, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
-    1250, 1250, 1250, 0, 5484, 5484, 5484, 5484,
-    5484, 5484, 5484, 0, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 0, 0, 0, 0, 0, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1159, 1159, 1159, 1159, 1159, 1159,
-    1159, 1159, 1159, 1159, 1159, 1159, 1159, 1159,
-    1159, 1159, 1159, 1159, 1159, 1159, 1159, 1159,
-    1159, 1159, 1159, 1159, 1159, 1159, 1159, 1159,
-    1159, 1159, 1159, 1159, 1159, 1159, 1159, 1159,
-    1159, 1159, 1159, 1159, 1159, 1159, 1159, 1159,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    1153, 1153, 1153, 1153, 1179, 1179, 1179, 1179,
-    1179, 1179, 1179, 1179, 1179, 1179, 1179, 1179,
-    1179, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1179, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 1160, 1160,
-    1160, 1160, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 1160, 1160, 340, 340,
-    1160, 1160, 340, 340, 1160, 1160, 1160, 1160,
-    340, 340, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 1160, 1160, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 1160, 340, 340, 340, 1160, 340, 340,
-    1160, 1160, 1160, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 340, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    340, 1160, 340, 340, 340, 340, 0, 0,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 0, 0, 0, 0, 0, 0,
-    0, 340, 340, 340, 340, 340, 340, 340,
-    340, 340, 340, 0, 0, 1191, 1153, 566,
-    1177, 81, 81, 81, 81, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 838, 838, 838, 838, 838, 838, 838,
-    838, 1191, 1191, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 1191, 838, 1191, 838,
-    838, 838, 1191, 838, 838, 838, 1191, 1191,
-    1191, 838, 1191, 838, 1191, 838, 1191, 1191,
-    1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191,
-    1191, 838, 1191, 1191, 1191, 1191, 1191, 1191,
-    1191, 1191, 838, 1191, 1191, 1191, 1191, 1191,
-    1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191,
-    838, 838, 1191, 1191, 1191, 1191, 1191, 838,
-    838, 838, 838, 1191, 838, 1191, 1191, 1191,
-    838, 838, 838, 1191, 1191, 1191, 1191, 1191,
-    838, 1191, 1191, 1191, 838, 1191, 1191, 1191,
-    1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191,
-    1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191,
-    1191, 1191, 1191, 838, 1191, 1191, 1191, 838,
-    838, 838, 1191, 1191, 838, 838, 838, 838,
-    1191, 1191, 838, 838, 838, 1191, 1191, 838,
-    838, 838, 838, 1191, 1191, 1191, 1191, 1191,
-    838, 838, 838, 838, 838, 838, 1191, 838,
-    838, 1191, 1191, 1191, 838, 1191, 1191, 1191,
-    1191, 838, 838, 1191, 838, 1191, 838, 1191,
-    1191, 1191, 1191, 1191, 1191, 838, 838, 838,
-    1191, 1191, 838, 838, 838, 1191, 838, 1191,
-    838, 1191, 838, 838, 1191, 1191, 1191, 1191,
-    838, 1191, 1191, 1191, 838, 1191, 1191, 1191,
-    1191, 838, 1191, 1191, 1191, 838, 1191, 1191,
-    1191, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 1191,
-    838, 1191, 838, 838, 838, 838, 838, 838,
-    838, 1191, 838, 1191, 838, 838, 838, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 1191, 1191, 1191, 1191, 1191, 1191,
-    1191, 1191, 1191, 838, 1191, 838, 838, 1191,
-    1191, 1191, 1191, 1191, 1191, 1191, 1191, 838,
-    838, 838, 1191, 1191, 1191, 1191, 838, 838,
-    0, 0, 1191, 838, 1191, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 1191,
-    1191, 1191, 1191, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    5844, 5845, 1191, 838, 838, 1191, 838, 5846,
-    5847, 5848, 5849, 5850, 5851, 5852, 5853, 5854,
-    566, 566, 566, 1191, 1191, 1191, 5855, 5856,
-    5857, 5858, 5859, 5860, 81, 81, 81, 81,
-    81, 81, 81, 81, 553, 553, 553, 553,
-    553, 553, 553, 553, 838, 838, 540, 540,
-    540, 540, 540, 553, 553, 838, 838, 838,
-    838, 838, 838, 1191, 1191, 838, 838, 1191,
-    1191, 1191, 1191, 838, 838, 1191, 1191, 838,
-    838, 838, 838, 838, 1191, 1191, 838, 1191,
-    1191, 838, 838, 540, 540, 540, 540, 1191,
-    1191, 1191, 1191, 1191, 1191, 838, 1191, 1191,
-    1191, 1191, 5861, 5862, 5863, 5864, 5865, 5866,
-    5867, 5868, 838, 838, 838, 838, 838, 838,
-    1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191,
-    1191, 838, 838, 838, 838, 838, 838, 838,
-    1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191,
-    1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191,
-    1191, 1191, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 540, 540, 540, 1085, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1190, 1190, 1190, 1190, 1190, 1190, 1190,
-    1190, 1190, 5484, 1190, 1190, 1190, 1190, 1190,
-    1190, 1190, 1190, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 5869, 2157, 2132, 5870, 2159, 2160, 5871,
-    2139, 2142, 5872, 5873, 2143, 2162, 2145, 5874,
-    2147, 2148, 2149, 5875, 5876, 5877, 5878, 5879,
-    5880, 5881, 2153, 5882, 5883, 5884, 5885, 2158,
-    5886, 2138, 2140, 2168, 2177, 5887, 2144, 5888,
-    5889, 2163, 5890, 5891, 5892, 5893, 5894, 5895,
-    5896, 5897, 5898, 5899, 5900, 5901, 5902, 5903,
-    2175, 5904, 5905, 5906, 5907, 5908, 5909, 5910,
-    5911, 5912, 5913, 5914, 5915, 5916, 5917, 5918,
-    5919, 5920, 5921, 5922, 5923, 5924, 5925, 5926,
-    5927, 5928, 2176, 5929, 5930, 5931, 0, 5932,
-    5933, 5934, 5935, 5936, 5937, 5938, 5939, 5940,
-    5941, 5942, 5943, 5944, 5945, 5946, 5947, 5948,
-    5949, 5901, 5902, 5903, 2175, 5904, 5905, 5906,
-    5907, 5908, 5909, 5910, 5911, 5912, 5913, 5914,
-    5915, 5916, 5917, 5918, 5919, 5920, 5921, 5922,
-    5923, 5924, 5925, 5926, 5927, 5928, 2176, 5929,
-    5930, 5931, 5950, 5932, 5933, 5934, 5935, 5936,
-    5937, 5938, 5939, 5940, 5941, 5942, 5943, 5944,
-    5945, 5946, 5947, 5948, 5949, 5901, 0, 5903,
-    2175, 0, 0, 5906, 0, 0, 5909, 5910,
-    0, 0, 5913, 5914, 5915, 5916, 0, 5918,
-    5919, 5920, 5921, 5922, 5923, 5924, 5925, 5926,
-    5927, 5928, 2176, 0, 5930, 0, 5950, 5932,
-    5933, 5934, 5935, 5936, 5937, 0, 5939, 5940,
-    5941, 5942, 5943, 5944, 5945, 5946, 5947, 5948,
-    5949, 5901, 5902, 5903, 2175, 5904, 5905, 5906,
-    5907, 5908, 5909, 5910, 5911, 5912, 5913, 5914,
-    5915, 5916, 5917, 5918, 5919, 5920, 5921, 5922,
-    5923, 5924, 5925, 5926, 5927, 5928, 2176, 5929,
-    5930, 5931, 5950, 5932, 5933, 5934, 5935, 5936,
-    5937, 5938, 5939, 5940, 5941, 5942, 5943, 5944,
-    5945, 5946, 5947, 5948, 5949, 5869, 2157, 0,
-    5870, 2159, 2160, 5871, 0, 0, 5872, 5873,
-    2143, 2162, 2145, 5874, 2147, 2148, 0, 5875,
-    5876, 5877, 5878, 5879, 5880, 5881, 0, 5882,
-    5883, 5884, 5885, 2158, 5886, 2138, 2140, 2168,
-    2177, 5887, 2144, 5888, 5889, 2163, 5890, 5891,
-    5892, 5893, 5894, 5895, 5896, 5897, 5898, 5899,
-    5900, 5869, 2157, 0, 5870, 2159, 2160, 5871,
-    0, 2142, 5872, 5873, 2143, 2162, 0, 5874,
-    0, 0, 0, 5875, 5876, 5877, 5878, 5879,
-    5880, 5881, 0, 5882, 5883, 5884, 5885, 2158,
-    5886, 2138, 2140, 2168, 2177, 5887, 2144, 5888,
-    5889, 2163, 5890, 5891, 5892, 5893, 5894, 5895,
-    5896, 5897, 5898, 5899, 5900, 5869, 2157, 2132,
-    5870, 2159, 2160, 5871, 2139, 2142, 5872, 5873,
-    2143, 2162, 2145, 5874, 2147, 2148, 2149, 5875,
-    5876, 5877, 5878, 5879, 5880, 5881, 2153, 5882,
-    5883, 5884, 5885, 2158, 5886, 2138, 2140, 2168,
-    2177, 5887, 2144, 5888, 5889, 2163, 5890, 5891,
-    5892, 5893, 5894, 5895, 5896, 5897, 5898, 5899,
-    5900, 5869, 2157, 2132, 5870, 2159, 2160, 5871,
-    2139, 2142, 5872, 5873, 2143, 2162, 2145, 5874,
-    2147, 2148, 2149, 5875, 5876, 5877, 5878, 5879,
-    5880, 5881, 2153, 5882, 5883, 5884, 5885, 2158,
-    5886, 2138, 2140, 2168, 2177, 5887, 2144, 5888,
-    5889, 2163, 5890, 5891, 5892, 5893, 5894, 5895,
-    5896, 5897, 5898, 5899, 5900, 5869, 2157, 2132,
-    5870, 2159, 2160, 5871, 2139, 2142, 5872, 5873,
-    2143, 2162, 2145, 5874, 2147, 2148, 2149, 5875,
-    5876, 5877, 5878, 5879, 5880, 5881, 2153, 5882,
-    5883, 5884, 5885, 2158, 5886, 2138, 2140, 2168,
-    2177, 5887, 2144, 5888, 5889, 2163, 5890, 5891,
-    5892, 5893, 5894, 5895, 5896, 5897, 5898, 5899,
-    5900, 5901, 5902, 5903, 2175, 5904, 5905, 5906,
-    5907, 5908, 5909, 5910, 5911, 5912, 5913, 5914,
-    5915, 5916, 5917, 5918, 5919, 5920, 5921, 5922,
-    5923, 5924, 5925, 5926, 5927, 5928, 2176, 5929,
-    5930, 5931, 5950, 5932, 5933, 5934, 5935, 5936,
-    5937, 5938, 5939, 5940, 5941, 5942, 5943, 5944,
-    5945, 5946, 5947, 5948, 5949, 5901, 5902, 5903,
-    2175, 5904, 5905, 5906, 5907, 5908, 5909, 5910,
-    5911, 5912, 5913, 5914, 5915, 5916, 5917, 5918,
-    5919, 5920, 5921, 5922, 5923, 5924, 5925, 5926,
-    5927, 5928, 2176, 5929, 5930, 5931, 5950, 5932,
-    5933, 5934, 5935, 5936, 5937, 5938, 5939, 5940,
-    5941, 5942, 5943, 5944, 5945, 5946, 5947, 5948,
-    5949, 5901, 5902, 5903, 2175, 5904, 5905, 5906,
-    5907, 5908, 5909, 5910, 5911, 5912, 5913, 5914,
-    5915, 5916, 5917, 5918, 5919, 5920, 5921, 5922,
-    5923, 5924, 5925, 5926, 5927, 5928, 2176, 5929,
-    5930, 5931, 5950, 5932, 5933, 5934, 5935, 5936,
-    5937, 5938, 5939, 5940, 5941, 5942, 5943, 5944,
-    5945, 5946, 5947, 5948, 5949, 5951, 5952, 0,
-    0, 5953, 5954, 2172, 5955, 5956, 5957, 5958,
-    5959, 5960, 5961, 5962, 5963, 5964, 5965, 5966,
-    5967, 5968, 5969, 5970, 5971, 5972, 5973, 5974,
-    5975, 5976, 5977, 5978, 5979, 5980, 5981, 5982,
-    5983, 5984, 5985, 5986, 5987, 5988, 5989, 5990,
-    5991, 5992, 5993, 5994, 5995, 5996, 5997, 5998,
-    5999, 6000, 6001, 6002, 6003, 6004, 6005, 6006,
-    6007, 6008, 6009, 6010, 6011, 6012, 6013, 6014,
-    6015, 6016, 6017, 6018, 6019, 6020, 6021, 6022,
-    6023, 6024, 2173, 6025, 6026, 6027, 6028, 6029,
-    6030, 6031, 6032, 6033, 6034, 6035, 6036, 2171,
-    6037, 6038, 6039, 6040, 6041, 6042, 6043, 6044,
-    6045, 6046, 6047, 6048, 2170, 6049, 6050, 6051,
-    6052, 6053, 6054, 6055, 6056, 6057, 6058, 6059,
-    6005, 6060, 6061, 6062, 6063, 6010, 6011, 6012,
-    6013, 6014, 6015, 6016, 6017, 6018, 6019, 6020,
-    6021, 6022, 6023, 6024, 2173, 6025, 6026, 6027,
-    6028, 6029, 6030, 6031, 6032, 6033, 6034, 6035,
-    6036, 2171, 6037, 6038, 6039, 6040, 6041, 6042,
-    6043, 6044, 6045, 6046, 6047, 6048, 2170, 6049,
-    6050, 6051, 6052, 6053, 6054, 6055, 6056, 6057,
-    6058, 6059, 6064, 6060, 6061, 6062, 6063, 5953,
-    5954, 2172, 5955, 5956, 5957, 5958, 5959, 5960,
-    5961, 5962, 5963, 5964, 5965, 5966, 5967, 5968,
-    5969, 5970, 5971, 5972, 5973, 5974, 5975, 5976,
-    5977, 5978, 5979, 5980, 5981, 5982, 5983, 5984,
-    5985, 5986, 5987, 5988, 5989, 5990, 5991, 5992,
-    5993, 5994, 5995, 5996, 5997, 5998, 5999, 6000,
-    6001, 6002, 6003, 6004, 6005, 6006, 6007, 6008,
-    6009, 6010, 6011, 6012, 6013, 6014, 6015, 6016,
-    6017, 6018, 6019, 6020, 6021, 6022, 6023, 6024,
-    2173, 6025, 6026, 6027, 6028, 6029, 6030, 6031,
-    6032, 6033, 6034, 6035, 6036, 2171, 6037, 6038,
-    6039, 6040, 6041, 6042, 6043, 6044, 6045, 6046,
-    6047, 6048, 2170, 6049, 6050, 6051, 6052, 6053,
-    6054, 6055, 6056, 6057, 6058, 6059, 6064, 6060,
-    6061, 6062, 6063, 6065, 6066, 0, 0, 6067,
-    6068, 6069, 6070, 6071, 6072, 6073, 6074, 6075,
-    6076, 6067, 6068, 6069, 6070, 6071, 6072, 6073,
-    6074, 6075, 6076, 6067, 6068, 6069, 6070, 6071,
-    6072, 6073, 6074, 6075, 6076, 6067, 6068, 6069,
-    6070, 6071, 6072, 6073, 6074, 6075, 6076, 6077,
-    6078, 6079, 6080, 6081, 6082, 6083, 6084, 6085,
-    6086, 1153, 1153, 1153, 1153, 1153, 1153, 1153,
-    1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153,
-    1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153,
-    1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153,
-    1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153,
-    1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153,
-    1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153,
-    838, 838, 838, 838, 1153, 1153, 1153, 1153,
-    1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153,
-    1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153,
-    1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153,
-    1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153,
-    1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153,
-    1153, 1153, 1153, 1153, 1153, 1153, 838, 838,
-    838, 838, 838, 838, 838, 838, 1153, 838,
-    838, 838, 838, 838, 838, 838, 838, 838,
-    838, 838, 838, 838, 838, 1153, 838, 838,
-    1044, 1044, 1044, 1044, 1044, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 1153, 1153, 1153, 1153,
-    1153, 0, 1153, 1153, 1153, 1153, 1153, 1153,
-    1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153,
-    1153, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 540, 540, 540, 540, 540, 540, 540,
-    0, 540, 540, 540, 540, 540, 540, 540,
-    540, 540, 540, 540, 540, 540, 540, 540,
-    540, 540, 0, 0, 540, 540, 540, 540,
-    540, 540, 540, 0, 540, 540, 0, 540,
-    540, 540, 540, 540, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1156, 1156, 1156, 1156, 1156, 1156, 1156,
-    1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156,
-    1156, 1156, 1156, 1156, 1106, 1106, 1106, 1106,
-    1106, 1156, 1156, 1106, 1106, 1106, 1106, 1106,
-    1156, 1106, 1156, 1106, 1106, 1106, 1156, 1106,
-    1156, 1156, 1106, 1106, 1106, 1106, 1156, 1106,
-    1106, 1106, 1156, 1156, 1106, 1156, 1156, 1156,
-    1156, 1156, 1156, 1156, 1106, 1106, 1156, 1156,
-    1156, 1156, 1156, 1106, 1156, 1106, 1106, 1106,
-    1106, 1106, 1156, 1156, 1106, 1106, 1106, 1106,
-    1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156,
-    1106, 1156, 1156, 1106, 1106, 1106, 1106, 1156,
-    1156, 1156, 1156, 1106, 1156, 1156, 1156, 1156,
-    1106, 1156, 1156, 1106, 1156, 1106, 1156, 1106,
-    1156, 1156, 1106, 1106, 1106, 1106, 1106, 1156,
-    1156, 1156, 1106, 1156, 1106, 1156, 1106, 1156,
-    1156, 1156, 1156, 1106, 1156, 1156, 1156, 1156,
-    1156, 1156, 1106, 1156, 1156, 1156, 1156, 1156,
-    1156, 1106, 1106, 1156, 1156, 1156, 1106, 1106,
-    1156, 1156, 1156, 1156, 1106, 1156, 1156, 1106,
-    1156, 1156, 1156, 1156, 1106, 1156, 1156, 1106,
-    1156, 1156, 1106, 1156, 1156, 1156, 1106, 1156,
-    1156, 1156, 1156, 1106, 1106, 1156, 1156, 1106,
-    1156, 1156, 1156, 1156, 1156, 1156, 1156, 1106,
-    1156, 1156, 1156, 1156, 1156, 1156, 0, 0,
-    5642, 5642, 5642, 5642, 5642, 5642, 5642, 5642,
-    5642, 553, 553, 553, 553, 553, 553, 553,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 6087, 6088, 6089, 6090, 6091, 6092, 6093,
-    6094, 6095, 6096, 6097, 6098, 6099, 6100, 6101,
-    6102, 6103, 6104, 6105, 6106, 6107, 6108, 6109,
-    6110, 6111, 6112, 6113, 6114, 6115, 6116, 6117,
-    6118, 6119, 6120, 6121, 6122, 6123, 6124, 6125,
-    6126, 6127, 6128, 6129, 6130, 6131, 6132, 6133,
-    6134, 6135, 6136, 6137, 6138, 6139, 6140, 6141,
-    6142, 6143, 6144, 6145, 6146, 6147, 6148, 6149,
-    6150, 6151, 6152, 6153, 6154, 540, 540, 540,
-    540, 540, 540, 1180, 0, 0, 0, 0,
-    0, 1154, 1154, 1154, 1154, 1154, 1154, 1154,
-    1154, 1154, 1154, 0, 0, 0, 0, 1103,
-    1103, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 6155, 6156, 6157, 6158, 0, 6159, 6160,
-    6161, 6162, 6163, 6164, 6165, 6166, 6167, 6168,
-    6169, 6170, 6171, 6172, 6173, 6174, 6175, 6176,
-    6177, 6178, 6179, 6180, 6181, 6182, 6183, 6184,
-    6185, 0, 6156, 6157, 0, 6186, 0, 0,
-    6161, 0, 6163, 6164, 6165, 6166, 6167, 6168,
-    6169, 6170, 6171, 6172, 0, 6174, 6175, 6176,
-    6177, 0, 6179, 0, 6181, 0, 0, 0,
-    0, 0, 0, 6157, 0, 0, 0, 0,
-    6161, 0, 6163, 0, 6165, 0, 6167, 6168,
-    6169, 0, 6171, 6172, 0, 6174, 0, 0,
-    6177, 0, 6179, 0, 6181, 0, 6183, 0,
-    6185, 0, 6156, 6157, 0, 6187, 0, 0,
-    6161, 6162, 6163, 6164, 0, 6166, 6167, 6168,
-    6169, 6170, 6171, 6172, 0, 6174, 6175, 6176,
-    6177, 0, 6179, 6180, 6181, 6182, 0, 6184,
-    0, 6155, 6156, 6157, 6158, 6187, 6159, 6160,
-    6161, 6162, 6163, 0, 6165, 6166, 6167, 6168,
-    6169, 6170, 6171, 6172, 6173, 6174, 6175, 6176,
-    6177, 6178, 6179, 6180, 6181, 0, 0, 0,
-    0, 0, 6188, 6189, 6190, 0, 6191, 6192,
-    6193, 6194, 6195, 0, 6196, 6197, 6198, 6199,
-    6200, 6201, 6202, 6203, 6204, 6205, 6206, 6207,
-    6208, 6209, 6210, 6211, 6212, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1109, 1109, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 0, 0, 0,
-    0, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 77, 77, 77,
-    77, 77, 77, 77, 77, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    0, 0, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 0, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 0, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 6213, 6214, 6215, 6216, 6217, 6218, 6219,
-    6220, 6221, 6222, 6223, 1220, 1220, 0, 0,
-    0, 6224, 6225, 6226, 6227, 6228, 6229, 6230,
-    6231, 6232, 6233, 6234, 6235, 6236, 6237, 6238,
-    6239, 6240, 6241, 6242, 6243, 6244, 6245, 6246,
-    6247, 6248, 6249, 6250, 6251, 6252, 6253, 6254,
-    0, 6255, 6256, 6257, 6258, 6259, 6260, 6261,
-    6262, 6263, 6264, 6265, 6266, 6267, 6268, 6269,
-    6270, 6271, 6272, 6273, 6274, 6275, 6276, 6277,
-    6278, 6279, 6280, 6281, 3613, 6282, 6283, 6284,
-    6285, 1191, 1191, 1191, 1191, 1191, 1191, 1191,
-    1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191,
-    1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191,
-    1191, 1191, 1191, 6286, 6287, 0, 0, 0,
-    0, 1191, 1191, 1191, 1191, 1191, 1191, 1191,
-    1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191,
-    1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191,
-    1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191,
-    1191, 6288, 1191, 1191, 1191, 1191, 1191, 1191,
-    1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191,
-    1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191,
-    1191, 1191, 1191, 1191, 1191, 1191, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 6289,
-    6289, 6289, 6289, 6289, 6289, 6289, 6289, 6289,
-    6289, 6289, 6289, 6289, 6289, 6289, 6289, 6289,
-    6289, 6289, 6289, 6289, 6289, 6289, 6289, 6289,
-    6289, 6290, 6291, 6292, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 6293, 6294, 6295, 6296, 6297, 6298, 6299,
-    6300, 6301, 6302, 6303, 6304, 6305, 6306, 6307,
-    6308, 6309, 6310, 6311, 6312, 6313, 6314, 6315,
-    6316, 6317, 6318, 6319, 6320, 6321, 6322, 6323,
-    6324, 6325, 6326, 6327, 6328, 6329, 6330, 6331,
-    6332, 6333, 6334, 6335, 6336, 0, 0, 0,
-    0, 6337, 6338, 6339, 6340, 6341, 6342, 6343,
-    6344, 6345, 0, 0, 0, 0, 0, 0,
-    0, 6346, 6347, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 2464, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 2464, 2464, 1085, 1085,
-    1085, 1085, 1085, 2464, 2464, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 6348, 6348, 6348, 6348,
-    6348, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 2464, 2464, 1085, 1085, 2464,
-    2464, 2464, 2464, 2464, 2464, 2464, 2464, 2464,
-    2464, 2464, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 6349,
-    6349, 6349, 6349, 1085, 1085, 1085, 1085, 2464,
-    1085, 2464, 2464, 2464, 2464, 2464, 2464, 2464,
-    2464, 2464, 1085, 1085, 1085, 2464, 1085, 1085,
-    1085, 1085, 2464, 2464, 2464, 1085, 2464, 2464,
-    2464, 1085, 1085, 1085, 2465, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 2464, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 2464, 1085,
-    1085, 1085, 1085, 2464, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 2464, 1085, 1085, 1085, 1085, 2464, 2464,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    77, 2465, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 2464, 2464,
-    2464, 1085, 1085, 1085, 2464, 2464, 2464, 2464,
-    2464, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 77,
-    77, 77, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 2464, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 2464, 2464, 2464,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 2464, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 0, 0,
-    0, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 77, 77, 1085, 77, 77,
-    77, 1085, 1085, 1085, 1085, 77, 77, 77,
-    1085, 1085, 77, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 77, 1085, 77, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1085, 1085, 1085, 1085, 77, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 77, 77, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    77, 77, 77, 1085, 1085, 1085, 77, 77,
-    77, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 0, 0, 0,
-    0, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 77, 77, 77, 77, 77, 77, 77,
-    77, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 0, 0, 0, 0, 0, 0, 0,
-    0, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 0, 0, 0, 0, 0,
-    0, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 0, 0, 0, 0, 0, 0, 0,
-    0, 77, 77, 77, 77, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 77, 77, 77,
-    77, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 77, 77, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 2464, 2464, 2464, 2464, 2464, 2464, 2464,
-    0, 1085, 1085, 1085, 1085, 1085, 1085, 2464,
-    1085, 0, 0, 0, 0, 0, 0, 0,
-    0, 2464, 0, 0, 2464, 2464, 2464, 2464,
-    2464, 2464, 2464, 1085, 1085, 2464, 2464, 2464,
-    0, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 0, 0, 0,
-    0, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
-    1085, 1085, 1085, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1085, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 0,
-    0, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1160, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 6350, 6351, 6352, 6353, 6354, 4271, 6355,
-    6356, 6357, 6358, 4272, 6359, 6360, 6361, 4273,
-    6362, 6363, 6364, 6365, 6366, 6367, 6368, 6369,
-    6370, 6371, 6372, 6373, 4331, 6374, 6375, 6376,
-    6377, 6378, 6379, 6380, 6381, 6382, 4336, 4274,
-    4275, 4337, 6383, 6384, 4082, 6385, 4276, 6386,
-    6387, 6388, 6389, 6389, 6389, 6390, 6391, 6392,
-    6393, 6394, 6395, 6396, 6397, 6398, 6399, 6400,
-    6401, 6402, 6403, 6404, 6405, 6406, 6407, 6407,
-    4339, 6408, 6409, 6410, 6411, 4278, 6412, 6413,
-    6414, 4235, 6415, 6416, 6417, 6418, 6419, 6420,
-    6421, 6422, 6423, 6424, 6425, 6426, 6427, 6428,
-    6429, 6430, 6431, 6432, 6433, 6434, 6435, 6436,
-    6437, 6438, 6439, 6440, 6440, 6441, 6442, 6443,
-    4078, 6444, 6445, 6446, 6447, 6448, 6449, 6450,
-    6451, 4283, 6452, 6453, 6454, 6455, 6456, 6457,
-    6458, 6459, 6460, 6461, 6462, 6463, 6464, 6465,
-    6466, 6467, 6468, 6469, 6470, 6471, 6472, 4024,
-    6473, 6474, 6475, 6475, 6476, 6477, 6477, 6478,
-    6479, 6480, 6481, 6482, 6483, 6484, 6485, 6486,
-    6487, 6488, 6489, 6490, 4284, 6491, 6492, 6493,
-    6494, 4351, 6494, 6495, 4286, 6496, 6497, 6498,
-    6499, 4287, 3997, 6500, 6501, 6502, 6503, 6504,
-    6505, 6506, 6507, 6508, 6509, 6510, 6511, 6512,
-    6513, 6514, 6515, 6516, 6517, 6518, 6519, 6520,
-    6521, 4288, 6522, 6523, 6524, 6525, 6526, 6527,
-    4290, 6528, 6529, 6530, 6531, 6532, 6533, 6534,
-    6535, 4025, 4359, 6536, 6537, 6538, 6539, 6540,
-    6541, 6542, 6543, 4291, 6544, 6545, 6546, 6547,
-    4402, 6548, 6549, 6550, 6551, 6552, 6553, 6554,
-    6555, 6556, 6557, 6558, 6559, 6560, 4095, 6561,
-    6562, 6563, 6564, 6565, 6566, 6567, 6568, 6569,
-    6570, 6571, 4292, 4182, 6572, 6573, 6574, 6575,
-    6576, 6577, 6578, 6579, 4363, 6580, 6581, 6582,
-    6583, 6584, 6585, 6586, 6587, 4364, 6588, 6589,
-    6590, 6591, 6592, 6593, 6594, 6595, 6596, 6597,
-    6598, 6599, 4366, 6600, 6601, 6602, 6603, 6604,
-    6605, 6606, 6607, 6608, 6609, 6610, 6610, 6611,
-    6612, 4368, 6613, 6614, 6615, 6616, 6617, 6618,
-    6619, 4081, 6620, 6621, 6622, 6623, 6624, 6625,
-    6626, 4374, 6627, 6628, 6629, 6630, 6631, 6632,
-    6632, 4375, 4404, 6633, 6634, 6635, 6636, 6637,
-    4043, 4377, 6638, 6639, 4303, 6640, 6641, 4257,
-    6642, 6643, 4307, 6644, 6645, 6646, 6647, 6647,
-    6648, 6649, 6650, 6651, 6652, 6653, 6654, 6655,
-    6656, 6657, 6658, 6659, 6660, 6661, 6662, 6663,
-    6664, 6665, 6666, 6667, 6668, 6669, 6670, 6671,
-    6672, 6673, 6674, 4313, 6675, 6676, 6677, 6678,
-    6679, 6680, 6681, 6682, 6683, 6684, 6685, 6686,
-    6687, 6688, 6689, 6690, 6476, 6691, 6692, 6693,
-    6694, 6695, 6696, 6697, 6698, 6699, 6700, 6701,
-    6702, 4099, 6703, 6704, 6705, 6706, 6707, 6708,
-    4316, 6709, 6710, 6711, 6712, 6713, 6714, 6715,
-    6716, 6717, 6718, 6719, 6720, 6721, 6722, 6723,
-    6724, 6725, 6726, 6727, 6728, 4038, 6729, 6730,
-    6731, 6732, 6733, 6734, 4384, 6735, 6736, 6737,
-    6738, 6739, 6740, 6741, 6742, 6743, 6744, 6745,
-    6746, 6747, 6748, 6749, 6750, 6751, 6752, 6753,
-    6754, 4389, 4390, 6755, 6756, 6757, 6758, 6759,
-    6760, 6761, 6762, 6763, 6764, 6765, 6766, 6767,
-    4391, 6768, 6769, 6770, 6771, 6772, 6773, 6774,
-    6775, 6776, 6777, 6778, 6779, 6780, 6781, 6782,
-    6783, 6784, 6785, 6786, 6787, 6788, 6789, 6790,
-    6791, 6792, 6793, 6794, 6795, 6796, 6797, 4397,
-    4397, 6798, 6799, 6800, 6801, 6802, 6803, 6804,
-    6805, 6806, 6807, 4398, 6808, 6809, 6810, 6811,
-    6812, 6813, 6814, 6815, 6816, 6817, 6818, 6819,
-    6820, 6821, 6822, 6823, 6824, 6825, 6826, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 81, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 2053, 2053, 2053, 2053, 2053, 2053, 2053,
-    2053, 2053, 2053, 2053, 2053, 2053, 2053, 2053,
-    2053, 2053, 2053, 2053, 2053, 2053, 2053, 2053,
-    2053, 2053, 2053, 2053, 2053, 2053, 2053, 2053,
-    2053, 2053, 2053, 2053, 2053, 2053, 2053, 2053,
-    2053, 2053, 2053, 2053, 2053, 2053, 2053, 2053,
-    2053, 2053, 2053, 2053, 2053, 2053, 2053, 2053,
-    2053, 2053, 2053, 2053, 2053, 2053, 2053, 2053,
-    2053, 2053, 2053, 2053, 2053, 2053, 2053, 2053,
-    2053, 2053, 2053, 2053, 2053, 2053, 2053, 2053,
-    2053, 2053, 2053, 2053, 2053, 2053, 2053, 2053,
-    2053, 2053, 2053, 2053, 2053, 2053, 2053, 2053,
-    2053, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 574, 574, 574, 574, 574, 574, 574,
-    574, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 3984,
-    3984, 3984, 3984, 3984, 3984, 3984, 3984, 0,
-    0,
-};
-
-// For normalizations
-static const UInt16 utf8_combinations[] = {
-    0, 46, 192, 193, 194, 195, 196, 197, 0,
-    256, 258, 260, 550, 461, 0, 0, 512,
-    514, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    7680, 7840, 0, 0, 0, 0, 0, 7842,
-    1, 11,
-    262, 264, 0, 0, 0, 199, 0, 0,
-    0, 266, 268,
-    0, 46, 200, 201, 202, 7868, 203,
-    0, 552, 274, 276, 280, 278, 282, 0,
-    0, 516, 518, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 7864, 0, 7704, 7706, 0,
-    0, 7866,
-    0, 46, 204, 205, 206, 296, 207, 0,
-    0, 298, 300, 302, 304, 463, 0, 0,
-    520, 522, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 7882, 0, 0, 7724, 0, 0,
-    7880,
-    0, 42, 504, 323, 0, 209, 0, 0, 325,
-    0, 0, 0, 7748, 327, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 7750, 7752, 7754,
-    0, 46, 210, 211, 212, 213,
-    214, 0, 0, 332, 334, 490, 558, 465,
-    336, 416, 524, 526, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 7884, 0, 0, 0,
-    0, 0, 7886,
-    0, 46, 217, 218, 219, 360, 220,
-    366, 0, 362, 364, 370, 0, 467, 368,
-    431, 532, 534, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 7908, 0, 7798, 7796, 0,
-    7794, 7910,
-    0, 46, 7922, 221, 374, 7928, 376, 0,
-    0, 562, 0, 0, 7822, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 7924, 0, 0, 0, 0, 0,
-    7926,
-    0, 46, 224, 225, 226, 227, 228, 229, 0,
-    257, 259, 261, 551, 462, 0, 0, 513,
-    515, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    7681, 7841, 0, 0, 0, 0, 0, 7843,
-    1, 11,
-    263, 265, 0, 0, 0, 231, 0, 0,
-    0, 267, 269,
-    0, 46, 232, 233, 234, 7869, 235,
-    0, 553, 275, 277, 281, 279, 283, 0,
-    0, 517, 519, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 7865, 0, 7705, 7707, 0,
-    0, 7867,
-    0, 46, 236, 237, 238, 297, 239, 0,
-    0, 299, 301, 303, 0, 464, 0, 0,
-    521, 523, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 7883, 0, 0, 7725, 0, 0,
-    7881,
-    0, 42, 505, 324, 0, 241, 0, 0, 326,
-    0, 0, 0, 7749, 328, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 7751, 7753, 7755,
-    0, 46, 242, 243, 244, 245,
-    246, 0, 0, 333, 335, 491, 559, 466,
-    337, 417, 525, 527, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 7885, 0, 0, 0,
-    0, 0, 7887,
-    0, 46, 249, 250, 251, 361, 252,
-    367, 0, 363, 365, 371, 0, 468, 369,
-    432, 533, 535, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 7909, 0, 7799, 7797, 0,
-    7795, 7911,
-    0, 46, 7923, 253, 375, 7929, 255, 7833,
-    0, 563, 0, 0, 7823, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 7925, 0, 0, 0, 0, 0,
-    7927,
-    6, 42, 7696, 0, 0, 0, 7690, 270, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 7692, 7694, 7698,
-    6, 42, 7697, 0,
-    0, 0, 7691, 271, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    7693, 7695, 7699,
-    1, 11, 500, 284, 0, 0, 0,
-    290, 7712, 286, 0, 288, 486,
-    1, 11, 501, 285,
-    0, 0, 0, 291, 7713, 287, 0, 289,
-    487,
-    2, 44, 292, 0, 7718, 0, 7720, 0, 0,
-    0, 7714, 542, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 7716,
-    0, 0, 0, 7722,
-    2, 44, 293, 0, 7719, 0,
-    7721, 0, 0, 0, 7715, 543, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 7717, 7830, 0, 0, 7723,
-    2, 2, 308,
-    2, 11,
-    309, 0, 0, 0, 0, 0, 0, 0,
-    0, 496,
-    1, 41, 7728, 0, 0, 0, 0, 310,
-    0, 0, 0, 0, 488, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 7730, 7732,
-    1, 41, 7729, 0, 0, 0, 0,
-    311, 0, 0, 0, 0, 489, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 7731, 7733,
-    1, 42, 313, 0, 0, 0,
-    0, 315, 0, 0, 0, 0, 317, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 7734, 7738, 7740,
-    1, 42, 314, 0,
-    0, 0, 0, 316, 0, 0, 0, 0,
-    318, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 7735, 7739, 7741,
-    1, 41,
-    340, 0, 0, 0, 0, 342, 0, 0,
-    0, 7768, 344, 0, 0, 528, 530, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 7770,
-    7774,
-    1, 41, 341, 0, 0, 0, 0, 343, 0,
-    0, 0, 7769, 345, 0, 0, 529, 531,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    7771, 7775,
-    1, 40, 346, 348, 0, 0, 0, 350,
-    0, 0, 0, 7776, 352, 0, 0, 0,
-    0, 536, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 7778,
-    1, 40, 347, 349, 0, 0, 0, 351,
-    0, 0, 0, 7777, 353, 0, 0, 0,
-    0, 537, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 7779,
-    6, 42, 354, 0, 0, 0, 7786, 356,
-    0, 0, 0, 0, 538, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 7788, 7790, 7792,
-    4, 42, 7831,
-    0, 355, 0, 0, 0, 7787, 357, 0,
-    0, 0, 0, 539, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 7789, 7791, 7793,
-    0, 40, 7808, 7810,
-    372, 0, 7812, 0, 0, 0, 0, 0,
-    7814, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 7816,
-    0, 40, 7809,
-    7811, 373, 0, 7813, 7832, 0, 0, 0,
-    0, 7815, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 7817,
-    1, 41,
-    377, 7824, 0, 0, 0, 0, 0, 0,
-    0, 379, 381, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 7826,
-    7828,
-    1, 41, 378, 7825, 0, 0, 0, 0, 0,
-    0, 0, 380, 382, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    7827, 7829,
-    0, 11, 475, 471, 0, 0, 0, 0,
-    0, 469, 0, 0, 0, 473,
-    0, 11, 476, 472,
-    0, 0, 0, 0, 0, 470, 0, 0,
-    0, 474,
-    7, 7, 478,
-    7, 7, 479,
-    7, 7, 480,
-    7, 7, 481,
-    1, 7, 508, 0,
-    0, 0, 0, 0, 482,
-    1, 7, 509, 0, 0,
-    0, 0, 0, 483,
-    7, 7, 492,
-    7, 7, 493,
-    11, 11, 494,
-    11, 11, 495,
-    1, 1,
-    506,
-    1, 1, 507,
-    1, 1, 510,
-    1, 1, 511,
-    7, 7, 554,
-    7, 7, 555,
-    1, 7, 7756, 0,
-    0, 7758, 0, 0, 556,
-    1, 7, 7757, 0, 0,
-    7759, 0, 0, 557,
-    7, 7, 560,
-    7, 7, 561,
-    0, 49, 8173, 901,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 8129,
-    0, 50,
-    8122, 902, 0, 0, 0, 0, 0, 8121,
-    8120, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 7944,
-    7945, 0, 8124,
-    0, 48, 8136, 904, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 7960, 7961,
-    0, 50, 8138, 905, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 7976, 7977, 0, 8140,
-    0, 48, 8154,
-    906, 0, 0, 938, 0, 0, 8153, 8152,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 7992, 7993,
-    0, 48,
-    8184, 908, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 8008,
-    8009,
-    0, 48, 8170, 910, 0, 0, 939, 0, 0,
-    8169, 8168, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 8025,
-    0, 50, 8186, 911, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 8040, 8041, 0, 8188,
-    0, 49, 8146, 912, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 8151,
-    0, 50, 8048,
-    940, 0, 0, 0, 0, 0, 8113, 8112,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 7936, 7937,
-    8118, 8115,
-    0, 48, 8050, 941, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 7952, 7953,
-    0, 50, 8052, 942, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 7968, 7969, 8134, 8131,
-    0, 49, 8054, 943,
-    0, 0, 970, 0, 0, 8145, 8144, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 7984, 7985, 8150,
-    0, 49,
-    8162, 944, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 8167,
-    0, 49, 8058, 973, 0, 0, 971, 0,
-    0, 8161, 8160, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 8016, 8017, 8166,
-    0, 48, 8056, 972, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 8000, 8001,
-    0, 50, 8060, 974, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 8032, 8033, 8182, 8179,
-    1, 4,
-    979, 0, 0, 980,
-    0, 8, 1024, 0, 0, 0,
-    1025, 0, 0, 0, 1238,
-    1, 1, 1027,
-    4, 4, 1031,
-    1, 1, 1036,
-    0, 8,
-    1037, 0, 0, 0, 1252, 0, 0, 1250,
-    1049,
-    4, 12, 1264, 0, 0, 1262, 1038, 0, 0,
-    0, 1266,
-    0, 8, 1117, 0, 0, 0, 1253, 0,
-    0, 1251, 1081,
-    0, 8, 1104, 0, 0, 0, 1105,
-    0, 0, 0, 1239,
-    1, 1, 1107,
-    4, 4, 1111,
-    1, 1, 1116,
-    4, 12, 1265,
-    0, 0, 1263, 1118, 0, 0, 0, 1267,
-    14, 14,
-    1142,
-    14, 14, 1143,
-    4, 8, 1244, 0, 0, 0, 1217,
-    4, 8, 1245,
-    0, 0, 0, 1218,
-    4, 8, 1234, 0, 0, 0,
-    1232,
-    4, 8, 1235, 0, 0, 0, 1233,
-    4, 4, 1242,
-    4, 4, 1243,
-    4, 4,
-    1246,
-    4, 4, 1247,
-    4, 4, 1254,
-    4, 4, 1255,
-    4, 4, 1258,
-    4, 4, 1259,
-    4, 4, 1260,
-    4, 4, 1261,
-    4, 4,
-    1268,
-    4, 4, 1269,
-    4, 4, 1272,
-    4, 4, 1273,
-    17, 19, 1570, 1571, 1573,
-    18, 18, 1572,
-    18, 18,
-    1574,
-    18, 18, 1728,
-    18, 18, 1730,
-    18, 18, 1747,
-    20, 20, 2345,
-    20, 20, 2353,
-    20, 20, 2356,
-    21, 22, 2507,
-    2508,
-    23, 25, 2888, 2891, 2892,
-    26, 26, 2964,
-    26, 27, 3020, 3018,
-    27, 27, 3019,
-    28, 28,
-    3144,
-    29, 29, 3264,
-    29, 31, 3271, 3272, 3274,
-    29, 29, 3275,
-    32, 33, 3402, 3404,
-    32, 32,
-    3403,
-    34, 36, 3546, 3548, 3550,
-    34, 34, 3549,
-    37, 37, 4134,
-    38, 38, 6918,
-    38, 38, 6920,
-    38, 38,
-    6922,
-    38, 38, 6924,
-    38, 38, 6926,
-    38, 38, 6930,
-    38, 38, 6971,
-    38, 38, 6973,
-    38, 38, 6976,
-    38, 38, 6977,
-    38, 38,
-    6979,
-    10, 41, 7682, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 7684,
-    7686,
-    10, 41, 7683, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 7685,
-    7687,
-    1, 1, 7688,
-    1, 1, 7689,
-    0, 1, 7700, 7702,
-    0, 1, 7701, 7703,
-    8, 8, 7708,
-    8, 8,
-    7709,
-    10, 10, 7710,
-    10, 10, 7711,
-    1, 1, 7726,
-    1, 1, 7727,
-    7, 7, 7736,
-    7, 7, 7737,
-    1, 40, 7742,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    7744, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 7746,
-    1, 40, 7743,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    7745, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 7747,
-    0, 1, 7760,
-    7762,
-    0, 1, 7761, 7763,
-    1, 10, 7764, 0, 0, 0, 0,
-    0, 0, 0, 0, 7766,
-    1, 10, 7765, 0, 0,
-    0, 0, 0, 0, 0, 0, 7767,
-    7, 7, 7772,
-    7, 7,
-    7773,
-    10, 10, 7780,
-    10, 10, 7781,
-    10, 10, 7782,
-    10, 10, 7783,
-    10, 10, 7784,
-    10, 10, 7785,
-    1, 1, 7800,
-    1, 1,
-    7801,
-    4, 4, 7802,
-    4, 4, 7803,
-    3, 40, 7804, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    7806,
-    3, 40, 7805, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 7807,
-    4, 10, 7820,
-    0, 0, 0, 0, 0, 7818,
-    4, 10, 7821, 0,
-    0, 0, 0, 0, 7819,
-    10, 10, 7835,
-    0, 46, 7846, 7844,
-    0, 7850, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 7848,
-    0, 46, 7847, 7845, 0,
-    7851, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 7849,
-    2, 8, 7852, 0, 0, 0,
-    0, 0, 7862,
-    2, 8, 7853, 0, 0, 0, 0,
-    0, 7863,
-    0, 46, 7856, 7854, 0, 7860, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    7858,
-    0, 46, 7857, 7855, 0, 7861, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 7859,
-    0, 46,
-    7872, 7870, 0, 7876, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 7874,
-    0, 46, 7873,
-    7871, 0, 7877, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 7875,
-    2, 2, 7878,
-    2, 2, 7879,
-    0, 46,
-    7890, 7888, 0, 7894, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 7892,
-    0, 46, 7891,
-    7889, 0, 7895, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 7893,
-    2, 2, 7896,
-    2, 2, 7897,
-    0, 46,
-    7900, 7898, 0, 7904, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    7906, 0, 0, 0, 0, 0, 7902,
-    0, 46, 7901,
-    7899, 0, 7905, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 7907,
-    0, 0, 0, 0, 0, 7903,
-    0, 46, 7914, 7912,
-    0, 7918, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 7920, 0,
-    0, 0, 0, 0, 7916,
-    0, 46, 7915, 7913, 0,
-    7919, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 7921, 0, 0,
-    0, 0, 0, 7917,
-    0, 50, 7938, 7940, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 7942, 8064,
-    0, 50, 7939,
-    7941, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    7943, 8065,
-    0, 50, 7946, 7948, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 7950, 8072,
-    0, 50, 7947, 7949, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 7951, 8073,
-    0, 1,
-    7954, 7956,
-    0, 1, 7955, 7957,
-    0, 1, 7962, 7964,
-    0, 1, 7963, 7965,
-    0, 50,
-    7970, 7972, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 7974, 8080,
-    0, 50, 7971, 7973, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 7975, 8081,
-    0, 50, 7978, 7980,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 7982,
-    8088,
-    0, 50, 7979, 7981, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 7983, 8089,
-    0, 49, 7986, 7988, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 7990,
-    0, 49, 7987, 7989,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 7991,
-    0, 49,
-    7994, 7996, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 7998,
-    0, 49, 7995, 7997, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 7999,
-    0, 1, 8002, 8004,
-    0, 1, 8003, 8005,
-    0, 1,
-    8010, 8012,
-    0, 1, 8011, 8013,
-    0, 49, 8018, 8020, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 8022,
-    0, 49, 8019, 8021,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 8023,
-    0, 49,
-    8027, 8029, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 8031,
-    0, 50, 8034, 8036, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 8038, 8096,
-    0, 50, 8035, 8037, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 8039, 8097,
-    0, 50,
-    8042, 8044, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 8046, 8104,
-    0, 50, 8043, 8045, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 8047, 8105,
-    50, 50, 8066,
-    50, 50, 8067,
-    50, 50,
-    8068,
-    50, 50, 8069,
-    50, 50, 8070,
-    50, 50, 8071,
-    50, 50, 8074,
-    50, 50, 8075,
-    50, 50, 8076,
-    50, 50, 8077,
-    50, 50,
-    8078,
-    50, 50, 8079,
-    50, 50, 8082,
-    50, 50, 8083,
-    50, 50, 8084,
-    50, 50, 8085,
-    50, 50, 8086,
-    50, 50, 8087,
-    50, 50,
-    8090,
-    50, 50, 8091,
-    50, 50, 8092,
-    50, 50, 8093,
-    50, 50, 8094,
-    50, 50, 8095,
-    50, 50, 8098,
-    50, 50, 8099,
-    50, 50,
-    8100,
-    50, 50, 8101,
-    50, 50, 8102,
-    50, 50, 8103,
-    50, 50, 8106,
-    50, 50, 8107,
-    50, 50, 8108,
-    50, 50, 8109,
-    50, 50,
-    8110,
-    50, 50, 8111,
-    50, 50, 8114,
-    50, 50, 8116,
-    50, 50, 8119,
-    50, 50, 8130,
-    50, 50, 8132,
-    50, 50, 8135,
-    0, 49,
-    8141, 8142, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 8143,
-    0, 49, 8157, 8158, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 8159,
-    47, 48, 8164, 8165,
-    48, 48, 8172,
-    50, 50, 8178,
-    50, 50,
-    8180,
-    50, 50, 8183,
-    51, 51, 8602,
-    51, 51, 8603,
-    51, 51, 8622,
-    51, 51, 8653,
-    51, 51, 8654,
-    51, 51, 8655,
-    51, 51,
-    8708,
-    51, 51, 8713,
-    51, 51, 8716,
-    51, 51, 8740,
-    51, 51, 8742,
-    51, 51, 8769,
-    51, 51, 8772,
-    51, 51, 8775,
-    51, 51,
-    8777,
-    51, 51, 8800,
-    51, 51, 8802,
-    51, 51, 8813,
-    51, 51, 8814,
-    51, 51, 8815,
-    51, 51, 8816,
-    51, 51, 8817,
-    51, 51,
-    8820,
-    51, 51, 8821,
-    51, 51, 8824,
-    51, 51, 8825,
-    51, 51, 8832,
-    51, 51, 8833,
-    51, 51, 8836,
-    51, 51, 8837,
-    51, 51,
-    8840,
-    51, 51, 8841,
-    51, 51, 8876,
-    51, 51, 8877,
-    51, 51, 8878,
-    51, 51, 8879,
-    51, 51, 8928,
-    51, 51, 8929,
-    51, 51,
-    8930,
-    51, 51, 8931,
-    51, 51, 8938,
-    51, 51, 8939,
-    51, 51, 8940,
-    51, 51, 8941,
-    51, 51, 10972,
-    52, 52, 12364,
-    52, 52,
-    12366,
-    52, 52, 12368,
-    52, 52, 12370,
-    52, 52, 12372,
-    52, 52, 12374,
-    52, 52, 12376,
-    52, 52, 12378,
-    52, 52, 12380,
-    52, 52,
-    12382,
-    52, 52, 12384,
-    52, 52, 12386,
-    52, 52, 12389,
-    52, 52, 12391,
-    52, 52, 12393,
-    52, 53, 12400, 12401,
-    52, 53,
-    12403, 12404,
-    52, 53, 12406, 12407,
-    52, 53, 12409, 12410,
-    52, 53, 12412, 12413,
-    52, 52,
-    12436,
-    52, 52, 12446,
-    52, 52, 12460,
-    52, 52, 12462,
-    52, 52, 12464,
-    52, 52, 12466,
-    52, 52, 12468,
-    52, 52, 12470,
-    52, 52,
-    12472,
-    52, 52, 12474,
-    52, 52, 12476,
-    52, 52, 12478,
-    52, 52, 12480,
-    52, 52, 12482,
-    52, 52, 12485,
-    52, 52, 12487,
-    52, 52,
-    12489,
-    52, 53, 12496, 12497,
-    52, 53, 12499, 12500,
-    52, 53, 12502, 12503,
-    52, 53, 12505,
-    12506,
-    52, 53, 12508, 12509,
-    52, 52, 12532,
-    52, 52, 12535,
-    52, 52, 12536,
-    52, 52, 12537,
-    52, 52, 12538,
-    52, 52,
-    12542,
-    54, 55, 1, 4250,
-    54, 55, 1, 4252,
-    54, 55, 1, 4267,
-    56, 57, 1, 4398,
-    56, 57, 1, 4399,
-    58, 61, 1, 4939, 1, 4940,
-    62, 67,
-    1, 5307, 1, 5308, 1, 5310,
-    68, 69, 1, 5562,
-    68, 69, 1, 5563,
-    70, 71, 1, 53598,
-    70, 71, 1, 53599,
-    72, 81, 1, 53600,
-    1, 53601, 1, 53602, 1, 53603, 1, 53604,
-    70, 71, 1, 53691,
-    70, 71, 1, 53692,
-    72, 75, 1, 53693, 1, 53695,
-    72, 75,
-    1, 53694, 1, 53696,
-};
-
-#endif // CORETEN_UTF8_DATA_H
\ No newline at end of file
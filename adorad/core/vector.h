@@ -15,10 +15,16 @@ Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
 #define CORETEN_VECTOR_H
 
 #include <adorad/core/types.h>
+#include <adorad/core/misc.h>
+#include <adorad/core/debug.h>
+#include <adorad/core/memory.h>
+#include <string.h>
 
 #define VEC_INIT_ALLOC_CAP      5
 #define VECTOR_AT_MACRO(v, i)   ((void *)((char *) (v)->core.data + (i) * (v)->core.objsize))
 #define VEC_NEW(strct, nelem)     _vec_new(sizeof(strct), (nelem))
+// Same as `VEC_NEW`, except that the Vec (and its elements) are allocated from `allocator` (see `Allocator`)
+#define VEC_NEW_WITH(strct, nelem, allocator)     _vec_new_with(sizeof(strct), (nelem), (allocator))
 
 typedef struct cstlVector cstlVector;
 typedef cstlVector Vec;
@@ -29,10 +35,12 @@ struct cstlVector {
         UInt64 len;      // number of elements currently in `vec`
         UInt64 capacity;  // allocated memory capacity (no. of elements)
         UInt64 objsize;   // size of each element in bytes
+        Allocator* allocator; // where `data` (and the Vec itself) come from (the heap, if null)
     } core;
 };
 
 cstlVector* _vec_new(UInt64 objsize, UInt64 capacity);
+cstlVector* _vec_new_with(UInt64 objsize, UInt64 capacity, Allocator* allocator);
 bool __vec_grow(cstlVector* vec, UInt64 capacity);
 void vec_free(cstlVector* vec);
 void* vec_at(cstlVector* vec, UInt64 elem);
@@ -44,26 +52,59 @@ UInt64 vec_cap(cstlVector* vec);
 bool vec_clear(cstlVector* vec);
 bool vec_push(cstlVector* vec, const void* data);
 bool vec_pop(cstlVector* vec);
+// Push the `num` elements in `data` into `vec` (at the end), growing it (at most) once
+bool vec_extend(cstlVector* vec, const void* data, UInt64 num);
+// Replace the `num_remove` elements of `vec` from the `at`th with the `num_insert` elements in `data`
+bool vec_splice(cstlVector* vec, UInt64 at, UInt64 num_remove, const void* data, UInt64 num_insert);
+
+// Typed accessors for a `Vec` of `T`s (one made with `VEC_NEW(T, ...)`).
+// `VEC_DEFINE(T)` defines `vec_at_T()`, `vec_push_T()`, `vec_reserve_T()` and `vec_extend_T()`, which know the 
+// size of an element at compile time, so they inline to a bounds check (in Debug) and a plain copy. `vec_at_T()`,
+// unlike `vec_at()`, only accepts `i < len`. The element size is checked against `sizeof(T)` in Debug.
+#define VEC_DEFINE(T)                                                                                   \
+    static inline T* vec_at_##T(cstlVector* vec, UInt64 i) {                                           \
+        CORETEN_DEBUG_ENFORCE(vec->core.objsize == sizeof(T) && i < vec->core.len, "Out of bounds");   \
+        return cast(T*)vec->core.data + i;                                                              \
+    }                                                                                                   \
+    static inline bool vec_reserve_##T(cstlVector* vec, UInt64 capacity) {                             \
+        CORETEN_DEBUG_ENFORCE(vec->core.objsize == sizeof(T), "Wrong element type");                   \
+        return CORETEN_LIKELY(capacity <= vec->core.capacity) || __vec_grow(vec, capacity);            \
+    }                                                                                                   \
+    static inline bool vec_push_##T(cstlVector* vec, const T* elem) {                                  \
+        if(CORETEN_UNLIKELY(!vec_reserve_##T(vec, vec->core.len + 1)))                                 \
+            return false;                                                                               \
+        (cast(T*)vec->core.data)[vec->core.len++] = *elem;                                              \
+        return true;                                                                                    \
+    }                                                                                                   \
+    static inline bool vec_extend_##T(cstlVector* vec, const T* elems, UInt64 num) {                   \
+        if(CORETEN_UNLIKELY(!vec_reserve_##T(vec, vec->core.len + num)))                               \
+            return false;                                                                               \
+        if(num > 0)                                                                                     \
+            memcpy(cast(T*)vec->core.data + vec->core.len, elems, num * sizeof(T));                     \
+        vec->core.len += num;                                                                           \
+        return true;                                                                                    \
+    }
 
 
 #ifdef CORETEN_IMPL
-    #include <string.h>
-    
     // Create a new `cstlVector`
     // size = size of each element (in bytes)
     // capacity = number of elements
     cstlVector* _vec_new(UInt64 objsize, UInt64 capacity) {
+        return _vec_new_with(objsize, capacity, null);
+    }
+
+    // Same as `_vec_new()`, allocating from `allocator`
+    cstlVector* _vec_new_with(UInt64 objsize, UInt64 capacity, Allocator* allocator) {
         CORETEN_ENFORCE(cast(int)capacity > 0, "Really? `capacity` can only be > 0");
         
-        cstlVector* vec = cast(cstlVector*)calloc(1, sizeof(cstlVector));
-        CORETEN_ENFORCE_NN(vec, "Could not allocate memory. Memory full.");
-
-        vec->core.data = cast(void*)calloc(objsize, capacity);
-        CORETEN_ENFORCE_NN(vec->core.data, "Could not allocate memory. Memory full.");
+        cstlVector* vec = cast(cstlVector*)allocator_calloc(allocator, sizeof(cstlVector));
+        vec->core.data = cast(void**)allocator_calloc(allocator, objsize * capacity);
 
         vec->core.capacity = capacity;
         vec->core.len = 0;
         vec->core.objsize = objsize;
+        vec->core.allocator = allocator;
 
         return vec;
     } 
@@ -71,16 +112,16 @@ bool vec_pop(cstlVector* vec);
     // Free a cstlVector from it's associated memory
     void vec_free(cstlVector* vec) {
         if(SOME(vec)) {
-            if(SOME(vec->core.data))
-                free(vec->core.data);
-            free(vec);
+            Allocator* allocator = vec->core.allocator;
+            allocator_free(allocator, vec->core.data, vec->core.capacity * vec->core.objsize);
+            allocator_free(allocator, vec, sizeof(cstlVector));
         }
     }
 
     // Return a pointer to element `i` in `vec`
     void* vec_at(cstlVector* vec, UInt64 elem) {
-        CORETEN_ENFORCE_NN(vec, "Expected not null");
-        CORETEN_ENFORCE_NN(vec->core.data, "Expected not null");
+        CORETEN_DEBUG_ENFORCE_NN(vec, "Expected not null");
+        CORETEN_DEBUG_ENFORCE_NN(vec->core.data, "Expected not null");
 
         if(elem > vec->core.len)
             return null;
@@ -90,8 +131,8 @@ bool vec_pop(cstlVector* vec);
 
     // Return a pointer to first element in `vec`
     void* vec_begin(cstlVector* vec) {
-        CORETEN_ENFORCE_NN(vec, "Expected not null");
-        CORETEN_ENFORCE_NN(vec->core.data, "Expected not null");
+        CORETEN_DEBUG_ENFORCE_NN(vec, "Expected not null");
+        CORETEN_DEBUG_ENFORCE_NN(vec->core.data, "Expected not null");
 
         if(vec->core.len == 0) 
             return null;
@@ -101,8 +142,8 @@ bool vec_pop(cstlVector* vec);
 
     // Return a pointer to last element in `vec`
     void* vec_end(cstlVector* vec) {
-        CORETEN_ENFORCE_NN(vec, "Expected not null");
-        CORETEN_ENFORCE_NN(vec->core.data, "Expected not null");
+        CORETEN_DEBUG_ENFORCE_NN(vec, "Expected not null");
+        CORETEN_DEBUG_ENFORCE_NN(vec->core.data, "Expected not null");
 
         if(vec->core.data == 0)
             return null;
@@ -112,32 +153,32 @@ bool vec_pop(cstlVector* vec);
 
     // Is `vec` empty?
     bool vec_is_empty(cstlVector* vec) {
-        CORETEN_ENFORCE_NN(vec, "Expected not null");
-        CORETEN_ENFORCE_NN(vec->core.data, "Expected not null");
+        CORETEN_DEBUG_ENFORCE_NN(vec, "Expected not null");
+        CORETEN_DEBUG_ENFORCE_NN(vec->core.data, "Expected not null");
 
         return vec->core.len == 0;
     }
 
     // Returns the size of `vec` (i.e the number of bytes)
     UInt64 vec_size(cstlVector* vec) {
-        CORETEN_ENFORCE_NN(vec, "Expected not null");
-        CORETEN_ENFORCE_NN(vec->core.data, "Expected not null");
+        CORETEN_DEBUG_ENFORCE_NN(vec, "Expected not null");
+        CORETEN_DEBUG_ENFORCE_NN(vec->core.data, "Expected not null");
 
         return vec->core.len;
     }
 
     // Returns the allocated capacity of `vec` (i.e the number of bytes)
     UInt64 vec_cap(cstlVector* vec) {
-        CORETEN_ENFORCE_NN(vec, "Expected not null");
-        CORETEN_ENFORCE_NN(vec->core.data, "Expected not null");
+        CORETEN_DEBUG_ENFORCE_NN(vec, "Expected not null");
+        CORETEN_DEBUG_ENFORCE_NN(vec->core.data, "Expected not null");
 
         return vec->core.capacity;
     }
 
     // Clear all contents of `vec`
     bool vec_clear(cstlVector* vec) {
-        CORETEN_ENFORCE_NN(vec, "Expected not null");
-        CORETEN_ENFORCE_NN(vec->core.data, "Expected not null");
+        CORETEN_DEBUG_ENFORCE_NN(vec, "Expected not null");
+        CORETEN_DEBUG_ENFORCE_NN(vec->core.data, "Expected not null");
 
         vec->core.len = 0;
         return true;
@@ -145,8 +186,8 @@ bool vec_pop(cstlVector* vec);
 
     // Push an element into `vec` (at the end)
     bool vec_push(cstlVector* vec, const void* data) {
-        CORETEN_ENFORCE_NN(vec, "Expected not null");
-        CORETEN_ENFORCE_NN(vec->core.data, "Expected not null");
+        CORETEN_DEBUG_ENFORCE_NN(vec, "Expected not null");
+        CORETEN_DEBUG_ENFORCE_NN(vec->core.data, "Expected not null");
 
         if(vec->core.len + 1 > vec->core.capacity) {
             bool result = __vec_grow(vec, vec->core.len + 1);
@@ -154,7 +195,7 @@ bool vec_pop(cstlVector* vec);
                 return false;
         }
 
-        CORETEN_ENFORCE(vec->core.objsize > 0);
+        CORETEN_DEBUG_ENFORCE(vec->core.objsize > 0);
 
         if(SOME(vec->core.data))
             memcpy(VECTOR_AT_MACRO(vec, vec->core.len), data, vec->core.objsize);
@@ -165,8 +206,8 @@ bool vec_pop(cstlVector* vec);
 
     // Pop an element from the end of `vec`
     bool vec_pop(cstlVector* vec) {
-        CORETEN_ENFORCE_NN(vec, "Expected not null");
-        CORETEN_ENFORCE_NN(vec->core.data, "Expected not null");
+        CORETEN_DEBUG_ENFORCE_NN(vec, "Expected not null");
+        CORETEN_DEBUG_ENFORCE_NN(vec->core.data, "Expected not null");
 
         if(vec->core.len == 0) 
             return false;
@@ -175,19 +216,61 @@ bool vec_pop(cstlVector* vec);
         return true;
     }
 
+    // Push the `num` elements in `data` into `vec` (at the end), growing it (at most) once
+    bool vec_extend(cstlVector* vec, const void* data, UInt64 num) {
+        CORETEN_DEBUG_ENFORCE_NN(vec, "Expected not null");
+        CORETEN_DEBUG_ENFORCE_NN(vec->core.data, "Expected not null");
+
+        if(vec->core.len + num > vec->core.capacity) {
+            bool result = __vec_grow(vec, vec->core.len + num);
+            if(!result)
+                return false;
+        }
+        if(num > 0)
+            memcpy(VECTOR_AT_MACRO(vec, vec->core.len), data, num * vec->core.objsize);
+
+        vec->core.len += num;
+        return true;
+    }
+
+    // Replace the `num_remove` elements of `vec` from the `at`th with the `num_insert` elements in `data`
+    bool vec_splice(cstlVector* vec, UInt64 at, UInt64 num_remove, const void* data, UInt64 num_insert) {
+        CORETEN_DEBUG_ENFORCE_NN(vec, "Expected not null");
+        CORETEN_DEBUG_ENFORCE_NN(vec->core.data, "Expected not null");
+        CORETEN_DEBUG_ENFORCE(at + num_remove <= vec->core.len, "Out of bounds");
+
+        UInt64 len = vec->core.len - num_remove + num_insert;
+        if(len > vec->core.capacity) {
+            bool result = __vec_grow(vec, len);
+            if(!result)
+                return false;
+        }
+
+        // Move the elements after the removed ones into place
+        UInt64 num_after = vec->core.len - at - num_remove;
+        if(num_after > 0 && num_insert != num_remove)
+            memmove(VECTOR_AT_MACRO(vec, at + num_insert), VECTOR_AT_MACRO(vec, at + num_remove), 
+                    num_after * vec->core.objsize);
+        if(num_insert > 0)
+            memcpy(VECTOR_AT_MACRO(vec, at), data, num_insert * vec->core.objsize);
+
+        vec->core.len = len;
+        return true;
+    }
+
     // Grow the capacity of `vec` to at least `capacity`.
     // If more space == needed, grow `vec` to `capacity`, but at least by a factor of 1.5.
     bool __vec_grow(cstlVector* vec, UInt64 capacity) {
         void* newdata;
         UInt64 newcapacity;
 
-        CORETEN_ENFORCE_NN(vec, "Expected not null");
-        CORETEN_ENFORCE_NN(vec->core.data, "Expected not null");
+        CORETEN_DEBUG_ENFORCE_NN(vec, "Expected not null");
+        CORETEN_DEBUG_ENFORCE_NN(vec->core.data, "Expected not null");
 
         if (capacity <= vec->core.capacity)
             return true;
 
-        CORETEN_ENFORCE(vec->core.objsize > 0);
+        CORETEN_DEBUG_ENFORCE(vec->core.objsize > 0);
         CORETEN_ENFORCE(capacity < cast(UInt64)-1/vec->core.objsize);
 
         // Grow small vectors by a factor of 2, && 1.5 for larger ones
@@ -200,8 +283,8 @@ bool vec_pop(cstlVector* vec);
         if (capacity > newcapacity || newcapacity >= (size_t) -1 / vec->core.objsize)
             newcapacity = capacity;
 
-        newdata = realloc(vec->core.data, newcapacity * vec->core.objsize);
-        CORETEN_ENFORCE_NN(newdata, "Expected not null");
+        newdata = allocator_realloc(vec->core.allocator, vec->core.data, vec->core.capacity * vec->core.objsize, 
+                                    newcapacity * vec->core.objsize);
 
         vec->core.data = newdata;
         vec->core.capacity = newcapacity;
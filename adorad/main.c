@@ -1,18 +1,298 @@
 #include <adorad/adorad.h>
 
 static void usage(int status) {
-    fprintf(stderr, "Usage: adorad [ -c ] <file>\n");
+    fprintf(stderr, "Usage: adorad [ --stats ] [ --time-report ] [ --diagnostics <format> ] [ --trace=<file> ] <file>...\n");
+    fprintf(stderr, "       adorad build [ --diagnostics <format> ] [ --trace=<file> ] [ --full [ --stats ] [ --emit-c <prefix> [ --shards <n> ] [ --cc <cc> ] [ --debug ] ] ] <dir>\n");
+    fprintf(stderr, "       adorad serve [ --socket <path> ] [ --send <request> ] <dir>\n");
+    fprintf(stderr, "    build           build the `.ad` files under <dir> that changed since the last build (and the\n");
+    fprintf(stderr, "                    modules that depend on what they export)\n");
+    fprintf(stderr, "    --full          build every file, and report how fast it went\n");
+    fprintf(stderr, "    --emit-c        write the C of the build to <prefix>.c (or <prefix>_<i>.c, with more than one\n");
+    fprintf(stderr, "                    shard)\n");
+    fprintf(stderr, "    --shards        split the C into <n> files, compiled in parallel\n");
+    fprintf(stderr, "    --cc            compile the C (into object files) with <cc>: gcc, clang or tcc\n");
+    fprintf(stderr, "    --debug         compile the C in %d unity shards (unless --shards): in process if Adorad was built\n",
+            CGEN_UNITY_SHARDS);
+    fprintf(stderr, "                    with libtcc and no --cc is given (no `.c` files are written), with <cc> or gcc\n");
+    fprintf(stderr, "                    otherwise\n");
+    fprintf(stderr, "    serve           keep <dir> built in memory (rebuilding what changes as it changes), and answer\n");
+    fprintf(stderr, "                    requests on a local socket: check, build, status or stop\n");
+    fprintf(stderr, "    --socket        the socket to listen (or send) on (<dir>/%s by default)\n", SERVER_DEFAULT_SOCKET);
+    fprintf(stderr, "    --send          send <request> to the server of <dir>, and exit with its status\n");
+    fprintf(stderr, "    --stats         print front end statistics (tokens, AST nodes, allocations, time per phase and\n");
+    fprintf(stderr, "                    memory per subsystem)\n");
+    fprintf(stderr, "    --time-report   print the time spent in each phase, per file and in total (to stderr)\n");
+    fprintf(stderr, "    --diagnostics   print errors and warnings as text (the default), plain (text without colors)\n");
+    fprintf(stderr, "                    or json\n");
+    fprintf(stderr, "    --trace         write a trace of what each thread did (and when) to <file>, for chrome://tracing\n");
+    fprintf(stderr, "                    or Perfetto\n");
     exit(status);
 }
 
+// `--trace=<file>`: the file, or null if `arg` isn't `--trace=`
+static const char* trace_fname_of(const char* arg) {
+    return strncmp(arg, "--trace=", 8) == 0 && arg[8] != nullchar ? arg + 8 : null;
+}
+
+// Write the trace started for `--trace=<fname>` (if `fname` is set) to `fname`
+static void trace_finish(const char* fname) {
+    if(NONE(fname))
+        return;
+    trace_stop();
+    if(!trace_save_chrome(fname))
+        fprintf(stderr, "Cannot write the trace to `%s`\n", fname);
+    trace_free();
+}
+
+// `--diagnostics <format>`
+static DiagnosticsFormat diagnostics_format_of(const char* name) {
+    if(strcmp(name, "text") == 0)
+        return DiagnosticsFormatText;
+    if(strcmp(name, "plain") == 0)
+        return DiagnosticsFormatPlain;
+    if(strcmp(name, "json") == 0)
+        return DiagnosticsFormatJson;
+    usage(1);
+    return DiagnosticsFormatText;
+}
+
+// `adorad build <dir>`: rebuild what changed since the graph saved by the last build
+static int build_incremental_main(const char* dir, BuildOptions* options, DiagnosticsFormat format) {
+    UInt64 path_len = strlen(dir) + sizeof(GRAPH_DEFAULT_FNAME) + 1;
+    char* graph_path = cast(char*)malloc(path_len);
+    CORETEN_ENFORCE_NN(graph_path, "Could not allocate memory. Memory full.");
+    snprintf(graph_path, path_len, "%s/%s", dir, GRAPH_DEFAULT_FNAME);
+
+    ModuleGraph* prev = module_graph_load(graph_path);
+    GraphBuildReport report;
+    ModuleGraph* graph = module_graph_build(prev, dir, options, &report);
+    module_graph_free(prev);
+    if(NONE(graph)) {
+        fprintf(stderr, "Cannot open directory `%s`\n", dir);
+        free(graph_path);
+        return 1;
+    }
+    if(report.num_files == 0)
+        fprintf(stderr, "No `.ad` files found in `%s`\n", dir);
+    diagnostics_render(report.diags, format, stderr);
+    graph_print_report(&report, stdout);
+    if(!module_graph_save(graph, graph_path))
+        fprintf(stderr, "Cannot save the module graph to `%s` (the next build will be a full one)\n", graph_path);
+    int status = report.ok ? 0 : 1;
+    diagnostics_free(report.diags);
+    module_graph_free(graph);
+    free(graph_path);
+    return status;
+}
+
+// `adorad build --full <dir>`
+// Adds each file of the build to the C backend, as it's emitted
+static bool build_emit_c(Build* build, BuildFile* file, void* arg) {
+    cgen_add_build_file(cast(CGen*)arg, file);
+    return true;
+}
+
+// Emit the C of `build` (whose files were added to `cgen`) to `prefix`, and compile it with `compiler` if set. A debug
+// build is compiled in process if it can be and no `compiler` was asked for (and with gcc otherwise)
+static bool build_write_c(CGen* cgen, const char* prefix, const char* compiler, bool is_debug) {
+    cgen_emit(cgen);
+    UInt32 num_failed = 0;
+    UInt64 start = stats_now();
+    if(is_debug && NONE(compiler) && cgen_compile_in_process(cgen, prefix, &num_failed)) {
+        printf("Emitted %llu bytes of C, and compiled its %u shard(s) in process in %.3f ms\n",
+               cast(unsigned long long)cgen->num_bytes, cgen->options.num_shards,
+               cast(double)(cgen->nanoseconds + stats_now() - start) / 1e6);
+        if(num_failed > 0)
+            fprintf(stderr, "%u shard(s) failed to compile\n", num_failed);
+        return num_failed == 0;
+    }
+    if(is_debug && NONE(compiler))
+        compiler = "gcc";
+    if(!cgen_write_files(cgen, prefix)) {
+        fprintf(stderr, "Cannot write the C output to `%s`\n", prefix);
+        return false;
+    }
+    printf("Emitted %llu bytes of C in %u shard(s) in %.3f ms\n", cast(unsigned long long)cgen->num_bytes,
+           cgen->options.num_shards, cast(double)cgen->nanoseconds / 1e6);
+    if(NONE(compiler))
+        return true;
+    CompilerType type = strcmp(compiler, "clang") == 0 ? CompilerTypeClang :
+                        strcmp(compiler, "tcc") == 0 ? CompilerTypeTinyc : CompilerTypeGcc;
+    start = stats_now();
+    num_failed = cgen_compile(cgen, type, prefix);
+    printf("Compiled %u shard(s) with %s in %.3f ms\n", cgen->options.num_shards, compiler,
+           cast(double)(stats_now() - start) / 1e6);
+    if(num_failed > 0)
+        fprintf(stderr, "%u shard(s) failed to compile\n", num_failed);
+    return num_failed == 0;
+}
+
+static int build_main(int argc, char** argv) {
+    BuildOptions options = {0};
+    CGenOptions cgen_options = {0};
+    const char* dir = null;
+    const char* c_prefix = null;
+    const char* compiler = null;
+    bool is_full = false;
+    bool is_debug = false;
+    const char* trace_fname = null;
+    DiagnosticsFormat format = DiagnosticsFormatText;
+    for(int i = 2; i < argc; i++) {
+        if(strcmp(argv[i], "--stats") == 0)
+            options.keep_stats = true;
+        else if(SOME(trace_fname_of(argv[i])))
+            trace_fname = trace_fname_of(argv[i]);
+        else if(strcmp(argv[i], "--diagnostics") == 0 && i + 1 < argc)
+            format = diagnostics_format_of(argv[++i]);
+        else if(strcmp(argv[i], "--full") == 0)
+            is_full = true;
+        else if(strcmp(argv[i], "--emit-c") == 0 && i + 1 < argc)
+            c_prefix = argv[++i];
+        else if(strcmp(argv[i], "--shards") == 0 && i + 1 < argc)
+            cgen_options.num_shards = cast(UInt32)strtoul(argv[++i], null, 10);
+        else if(strcmp(argv[i], "--cc") == 0 && i + 1 < argc)
+            compiler = argv[++i];
+        else if(strcmp(argv[i], "--debug") == 0)
+            is_debug = true;
+        else if(strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0)
+            usage(0);
+        else if(argv[i][0] == '-' || SOME(dir))
+            usage(1);
+        else
+            dir = argv[i];
+    }
+    if(NONE(dir) || ((options.keep_stats || SOME(c_prefix)) && !is_full) ||
+       ((SOME(compiler) || is_debug) && NONE(c_prefix)))
+        usage(1);
+    if(is_debug && cgen_options.num_shards == 0)
+        cgen_options.num_shards = CGEN_UNITY_SHARDS;
+    if(SOME(trace_fname))
+        trace_start(0);
+    if(!is_full) {
+        int status = build_incremental_main(dir, &options, format);
+        trace_finish(trace_fname);
+        return status;
+    }
+
+    CGen* cgen = null;
+    if(SOME(c_prefix)) {
+        cgen = cgen_new(&cgen_options);
+        options.emit = build_emit_c;
+        options.emit_arg = cgen;
+    }
+    Build* build = build_dir(dir, &options);
+    if(NONE(build)) {
+        fprintf(stderr, "Cannot open directory `%s`\n", dir);
+        cgen_free(cgen);
+        trace_finish(trace_fname);
+        return 1;
+    }
+    if(build->num_files == 0)
+        fprintf(stderr, "No `.ad` files found in `%s`\n", dir);
+    diagnostics_render(build->diags, format, stderr);
+    if(options.keep_stats)
+        stats_print(build->stats, stdout);
+    build_print_report(build, stdout);
+    int status = build->ok ? 0 : 1;
+    // The units refer to the files of the build
+    if(SOME(cgen) && build->ok && !build_write_c(cgen, c_prefix, compiler, is_debug))
+        status = 1;
+    trace_finish(trace_fname);
+    cgen_free(cgen);
+    build_free(build);
+    return status;
+}
+
+// `adorad serve <dir>`
+static int serve_main(int argc, char** argv) {
+    ServerOptions options = {0};
+    const char* dir = null;
+    const char* request = null;
+    for(int i = 2; i < argc; i++) {
+        if(strcmp(argv[i], "--socket") == 0 && i + 1 < argc)
+            options.socket_path = argv[++i];
+        else if(strcmp(argv[i], "--send") == 0 && i + 1 < argc)
+            request = argv[++i];
+        else if(strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0)
+            usage(0);
+        else if(argv[i][0] == '-' || SOME(dir))
+            usage(1);
+        else
+            dir = argv[i];
+    }
+    if(NONE(dir))
+        usage(1);
+
+    Server* server = server_new(dir, &options);
+    if(NONE(server)) {
+        fprintf(stderr, "`adorad serve` needs local sockets, which this platform doesn't have\n");
+        return 1;
+    }
+    int status = 0;
+    if(SOME(request)) {
+        status = server_request(server->socket_path, request, stdout);
+        if(status < 0)
+            fprintf(stderr, "No server is listening on `%s`\n", server->socket_path);
+    } else {
+        printf("Serving `%s` on `%s`\n", dir, server->socket_path);
+        fflush(stdout);
+        if(!server_run(server)) {
+            fprintf(stderr, "Cannot listen on `%s` (is a server already running there?)\n", server->socket_path);
+            status = 1;
+        }
+    }
+    server_free(server);
+    return status < 0 ? 1 : status;
+}
+
 int main(int argc, char** argv) {
     // C - Example: 
     // To compile a Adorad source file:
     // >> adorad compile hello.ad
-    // if(argc<3) {
-    //     printf("Too few arguments"); 
-    //     return 1;
-    // }
+    if(argc > 1 && strcmp(argv[1], "build") == 0)
+        return build_main(argc, argv);
+    if(argc > 1 && strcmp(argv[1], "serve") == 0)
+        return serve_main(argc, argv);
+
+    bool keep_stats = false;
+    bool time_report = false;
+    const char* trace_fname = null;
+    DiagnosticsFormat format = DiagnosticsFormatText;
+    const char** fnames = cast(const char**)calloc(argc > 1 ? argc : 1, sizeof(char*));
+    UInt32 num_files = 0;
+    for(int i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--stats") == 0)
+            keep_stats = true;
+        else if(strcmp(argv[i], "--time-report") == 0)
+            time_report = true;
+        else if(SOME(trace_fname_of(argv[i])))
+            trace_fname = trace_fname_of(argv[i]);
+        else if(strcmp(argv[i], "--diagnostics") == 0 && i + 1 < argc)
+            format = diagnostics_format_of(argv[++i]);
+        else if(strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0)
+            usage(0);
+        else if(argv[i][0] == '-')
+            usage(1);
+        else
+            fnames[num_files++] = argv[i];
+    }
+    if(num_files == 0)
+        usage(1);
+
+    if(SOME(trace_fname))
+        trace_start(0);
+    Frontend* frontend = frontend_run(fnames, num_files, 0, 0, keep_stats || time_report);
+    trace_finish(trace_fname);
+    diagnostics_render(frontend->diags, format, stderr);
+    if(keep_stats) {
+        stats_print(frontend->stats, stdout);
+        frontend_print_memory_report(frontend, stdout);
+    }
+    if(time_report)
+        frontend_print_time_report(frontend, stderr);
+    int status = frontend->ok ? 0 : 1;
+    frontend_free(frontend);
+    free(fnames);
 
     // puts("    Adorad Language 0.0.1 (May 22 2021 02:39:23)");
     // puts("    GCC version: 9.3.0 on Windows");
@@ -25,5 +305,5 @@ int main(int argc, char** argv) {
     //     printf("%s", buffer);
     //     // printf("\n");
     // }
-    return 0; 
-}
\ No newline at end of file
+    return status; 
+}
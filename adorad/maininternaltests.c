@@ -27,7 +27,8 @@ int main(int argc, const char* const argv[]) {
     printf("Tokens: \n---------------------\n");
     for(UInt64 i=0; i<lexer->toklist->core.len; i++) {
         token = cast(Token*)vec_at(lexer->toklist, i);
-        printf("%s: %s\n", token_to_buff(token->kind)->data, token->value->data);
+        BuffView value = lexer_value(lexer, token);
+        printf("%s: " BV_FMT "\n", token_to_buff(token->kind)->data, BV_ARG(value));
     }
     printf("---------------------\n");
 
@@ -0,0 +1,938 @@
+/*
+          _____   ____  _____            _____
+    /\   |  __ \ / __ \|  __ \     /\   |  __ \
+   /  \  | |  | | |  | | |__) |   /  \  | |  | | Adorad - The Fast, Expressive & Elegant Programming Language
+  / /\ \ | |  | | |  | |  _  /   / /\ \ | |  | | Languages: C, C++, and Assembly
+ / ____ \| |__| | |__| | | \ \  / ____ \| |__| | https://github.com/adorad/adorad/
+/_/    \_\_____/ \____/|_|  \_\/_/    \_\_____/
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>
+SPDX-License-Identifier: MIT
+Copyright (c) 2021-22 Jason Dsouza <@jasmcaus>
+*/
+
+/*
+    Front end throughput benchmark.
+
+    Generates synthetic Adorad corpora (shaped after `docs/examples.swift`) at a few sizes and runs each front end
+    stage over them, reporting MB/s, tokens/s, nodes/s, allocations and peak RSS. The `parse` stage (lexing and
+    parsing) only runs over the `decl` corpus, which is made of what the Parser handles so far (top-level `module`,
+    `use` and `put` declarations).
+
+    Usage:
+        bench_frontend [--sizes=1,4,16] [--reps=3] [--corpus=code,ident,string,comment,decl] [--stage=lex,...]
+                       [--threads=0] [--json] 
+                       [--baseline=FILE [--threshold=5] [--time-threshold=50] [--update-baseline]]
+
+    `--sizes` are in MB. The best of `--reps` runs is reported. With `--json`, every (corpus, size, stage) is
+    reported as a JSON object on its own line (JSON Lines), so that results can be tracked over time. Fields which
+    don't apply to a stage (or can't be measured on this platform) are `null`.
+
+    Regression gate: with `--baseline`, the instructions retired (counted by the CPU, on Linux - where perf counters
+    are available) and the allocations made by each stage are compared against the ones recorded in FILE (see
+    `bench/baseline.txt`), and the benchmark fails (exits with 1) if any of them grew by more than `--threshold`
+    percent. Unlike times, both are (nearly) the same from one run to the next, so a small threshold doesn't make the
+    gate flaky. `--update-baseline` records the results into FILE instead (after a change that is meant to cost more,
+    or on a new toolchain: instruction counts depend on the compiler and its flags).
+
+    Where instructions can't be counted (no perf counters, or a `-` in FILE), the CPU time of the stage is compared
+    instead - as a multiple of the time of a reference loop over the same corpus, run right before it (see 
+    `bench_reference()`), so that it carries over (roughly) from one machine to another. Times are noisy (even so, 
+    they vary by up to ~35% on a busy machine), so they get a threshold of their own (`--time-threshold`): large 
+    enough to only catch real slowdowns.
+*/
+
+// For `clock_gettime()` and `getrusage()` (this must come before the first system header)
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+    #define _POSIX_C_SOURCE 200809L
+#endif
+// For `syscall()` (see `bench_counter_start()`)
+#if defined(__linux__) && !defined(_DEFAULT_SOURCE)
+    #define _DEFAULT_SOURCE
+#endif
+
+#include <adorad/adorad.h>
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(CORETEN_OS_WINDOWS)
+    #include <psapi.h>
+#else
+    #include <sys/resource.h>
+    #include <time.h>
+#endif // CORETEN_OS_WINDOWS
+
+#if defined(__linux__) && !defined(BENCH_NO_PERF_COUNTERS)
+    #define BENCH_HAS_PERF_COUNTERS     1
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif // __linux__
+
+#define BENCH_VERSION       2
+#define BENCH_MAX_SIZES     16
+// No. of (corpus, size, stage)s a run measures at most
+#define BENCH_MAX_RESULTS   (BENCH_MAX_SIZES * 64)
+#define BENCH_DEFAULT_THRESHOLD     5.0
+#define BENCH_DEFAULT_TIME_THRESHOLD    50.0
+// A count regresses only if it also grew by more than this (so that 10 allocations becoming 11 isn't one)
+#define BENCH_GATE_MIN_DELTA        16
+
+// ================ Allocation counting ================
+// On glibc, the allocator is interposed so that every allocation made by the front end is counted
+#if defined(__GLIBC__) && !defined(BENCH_NO_ALLOC_COUNTING)
+    #define BENCH_COUNTS_ALLOCS     1
+
+    extern void* __libc_malloc(size_t size);
+    extern void* __libc_calloc(size_t num, size_t size);
+    extern void* __libc_realloc(void* ptr, size_t size);
+    extern void __libc_free(void* ptr);
+
+    static UInt64 bench_num_allocs = 0;
+    static UInt64 bench_alloc_bytes = 0;
+
+    static inline void bench_count_alloc(UInt64 bytes) {
+        __atomic_fetch_add(&bench_num_allocs, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&bench_alloc_bytes, bytes, __ATOMIC_RELAXED);
+    }
+
+    void* malloc(size_t size) {
+        bench_count_alloc(size);
+        return __libc_malloc(size);
+    }
+
+    void* calloc(size_t num, size_t size) {
+        bench_count_alloc(cast(UInt64)num * size);
+        return __libc_calloc(num, size);
+    }
+
+    void* realloc(void* ptr, size_t size) {
+        bench_count_alloc(size);
+        return __libc_realloc(ptr, size);
+    }
+
+    void free(void* ptr) {
+        __libc_free(ptr);
+    }
+#endif // __GLIBC__
+
+typedef struct BenchAllocs {
+    UInt64 num_allocs;
+    UInt64 bytes;
+} BenchAllocs;
+
+static BenchAllocs bench_allocs_now() {
+    BenchAllocs allocs = {0, 0};
+#ifdef BENCH_COUNTS_ALLOCS
+    allocs.num_allocs = __atomic_load_n(&bench_num_allocs, __ATOMIC_RELAXED);
+    allocs.bytes = __atomic_load_n(&bench_alloc_bytes, __ATOMIC_RELAXED);
+#endif // BENCH_COUNTS_ALLOCS
+    return allocs;
+}
+
+// ================ Instruction counting ================
+// Instructions retired in user space (by every thread of the process made after `bench_counter_start()`), where
+// the kernel and the CPU let us count them. -1 is "not counted"
+#ifdef BENCH_HAS_PERF_COUNTERS
+    static int bench_counter_fd = -2;   // -2 until opened, -1 if it can't be
+
+    static void bench_counter_start() {
+        if(bench_counter_fd == -2) {
+            struct perf_event_attr attr;
+            memset(&attr, 0, sizeof(attr));
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.size = sizeof(attr);
+            attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+            attr.disabled = 1;
+            attr.inherit = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            bench_counter_fd = cast(int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+            if(bench_counter_fd < 0)
+                bench_counter_fd = -1;
+        }
+        if(bench_counter_fd >= 0) {
+            ioctl(bench_counter_fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(bench_counter_fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+
+    static Int64 bench_counter_stop() {
+        if(bench_counter_fd < 0)
+            return -1;
+        ioctl(bench_counter_fd, PERF_EVENT_IOC_DISABLE, 0);
+        UInt64 count = 0;
+        if(read(bench_counter_fd, &count, sizeof(count)) != sizeof(count))
+            return -1;
+        return cast(Int64)count;
+    }
+#else
+    static void bench_counter_start() {}
+    static Int64 bench_counter_stop() { return -1; }
+#endif // BENCH_HAS_PERF_COUNTERS
+
+// ================ Timing and memory ================
+// Monotonic time (in seconds)
+static double bench_now() {
+#if defined(CORETEN_OS_WINDOWS)
+    LARGE_INTEGER freq, count;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&count);
+    return cast(double)count.QuadPart / cast(double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return cast(double)ts.tv_sec + cast(double)ts.tv_nsec * 1e-9;
+#endif // CORETEN_OS_WINDOWS
+}
+
+// CPU time of the process (in seconds) - unlike `bench_now()`, it doesn't count the time that other processes ran
+// instead of this one. Falls back to `bench_now()` where there's no such clock
+static double bench_cpu_now() {
+#if defined(CLOCK_PROCESS_CPUTIME_ID)
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return cast(double)ts.tv_sec + cast(double)ts.tv_nsec * 1e-9;
+#else
+    return bench_now();
+#endif // CLOCK_PROCESS_CPUTIME_ID
+}
+
+// Peak resident set size of the process so far (in KB)
+static UInt64 bench_peak_rss_kb() {
+#if defined(CORETEN_OS_WINDOWS)
+    PROCESS_MEMORY_COUNTERS counters;
+    if(!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0;
+    return cast(UInt64)counters.PeakWorkingSetSize / 1024;
+#else
+    struct rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+    #if defined(CORETEN_OS_OSX)
+        // Reported in bytes on macOS
+        return cast(UInt64)usage.ru_maxrss / 1024;
+    #else
+        return cast(UInt64)usage.ru_maxrss;
+    #endif // CORETEN_OS_OSX
+#endif // CORETEN_OS_WINDOWS
+}
+
+// Keeps the compiler from dropping the loop in `bench_reference()`
+volatile UInt64 bench_reference_sink = 0;
+
+// Best time (of `reps`) of a loop that hashes every byte of `data` - the yardstick stage times are measured with
+// in the regression gate. It does about as much per byte as a (fast) lexer, but no more, so how the two compare
+// depends little on the machine
+static double bench_reference(const char* data, UInt64 len, UInt32 reps) {
+    double best = 0;
+    for(UInt32 rep = 0; rep < reps; rep++) {
+        double start = bench_cpu_now();
+        UInt64 hash = 0xcbf29ce484222325ull;
+        UInt64 num_lines = 0;
+        for(UInt64 i = 0; i < len; i++) {
+            hash = (hash ^ cast(UInt8)data[i]) * 0x100000001b3ull;
+            num_lines += data[i] == '\n';
+        }
+        bench_reference_sink = hash + num_lines;
+        double seconds = bench_cpu_now() - start;
+        if(rep == 0 || seconds < best)
+            best = seconds;
+    }
+    return best;
+}
+
+// ================ Corpus generation ================
+typedef struct Corpus {
+    char* data;
+    UInt64 len;
+    UInt64 cap;
+    UInt64 rng;     // state of the (deterministic) random generator
+} Corpus;
+
+typedef enum CorpusKind {
+    CorpusKindCode = 0,   // a mix of everything below (like `docs/examples.swift`)
+    CorpusKindIdent,      // identifier-heavy expressions and calls
+    CorpusKindString,     // string-heavy (plain, escaped and formatted strings)
+    CorpusKindComment,    // comment-heavy (line, block and `#` comments around some code)
+    CorpusKindDecl,       // top-level declarations only, of expressions the Parser handles (see `corpus_decl_expr()`)
+    CorpusKindCount
+} CorpusKind;
+
+static const char* corpusNames[CorpusKindCount] = { "code", "ident", "string", "comment", "decl" };
+
+static const char* corpusWords[] = {
+    "name", "msg", "parser", "curr_tok", "offset", "lexer", "buffer", "node", "value", "count", "index", "result",
+    "fruits", "favourite_fruit", "lucky_num", "hash", "module", "scope", "symbol", "table", "entry", "kind", "loc",
+    "greet", "holler", "subtract", "tokens", "line_starts", "num_lines", "is_done", "x", "y", "i", "parser_new"
+};
+static const char* corpusTypes[] = { "string", "i8", "i32", "u32", "u64", "f64", "bool", "Fruits" };
+#define NUM_WORDS   (sizeof(corpusWords) / sizeof(corpusWords[0]))
+#define NUM_TYPES   (sizeof(corpusTypes) / sizeof(corpusTypes[0]))
+
+// xorshift64*
+static UInt64 corpus_rand(Corpus* corpus, UInt64 n) {
+    corpus->rng ^= corpus->rng >> 12;
+    corpus->rng ^= corpus->rng << 25;
+    corpus->rng ^= corpus->rng >> 27;
+    return (corpus->rng * 0x2545F4914F6CDD1Dull >> 32) % n;
+}
+
+static void corpus_printf(Corpus* corpus, const char* format, ...) {
+    va_list args;
+    while(true) {
+        va_start(args, format);
+        int len = vsnprintf(corpus->data + corpus->len, corpus->cap - corpus->len, format, args);
+        va_end(args);
+        CORETEN_ENFORCE(len >= 0);
+        if(corpus->len + cast(UInt64)len < corpus->cap) {
+            corpus->len += cast(UInt64)len;
+            return;
+        }
+
+        corpus->cap = corpus->cap * 2 + cast(UInt64)len;
+        corpus->data = cast(char*)realloc(corpus->data, corpus->cap);
+        CORETEN_ENFORCE_NN(corpus->data, "Could not allocate memory. Memory full.");
+    }
+}
+
+#define WORD()  corpusWords[corpus_rand(corpus, NUM_WORDS)]
+#define TYPE()  corpusTypes[corpus_rand(corpus, NUM_TYPES)]
+
+// A few words of prose (for comments and strings)
+static void corpus_prose(Corpus* corpus, UInt64 max_words) {
+    UInt64 num_words = 1 + corpus_rand(corpus, max_words);
+    for(UInt64 i = 0; i < num_words; i++)
+        corpus_printf(corpus, i == 0 ? "%s" : " %s", WORD());
+}
+
+static void corpus_expr(Corpus* corpus, UInt64 depth) {
+    switch(corpus_rand(corpus, depth == 0 ? 3 : 7)) {
+        case 0: corpus_printf(corpus, "%s", WORD()); break;
+        case 1: corpus_printf(corpus, "%s.%s", WORD(), WORD()); break;
+        case 2: corpus_printf(corpus, "0x%llX", cast(unsigned long long)corpus_rand(corpus, 1 << 16)); break;
+        case 3:
+            corpus_printf(corpus, "%s(", WORD());
+            corpus_expr(corpus, depth - 1);
+            corpus_printf(corpus, ", ");
+            corpus_expr(corpus, depth - 1);
+            corpus_printf(corpus, ")");
+            break;
+        case 4:
+            corpus_printf(corpus, "@cast(%s, ", TYPE());
+            corpus_expr(corpus, depth - 1);
+            corpus_printf(corpus, ")");
+            break;
+        default: {
+            static const char* ops[] = { "+", "-", "*", "/", "%", "<<", ">>", "==", "<=", ">=", "&&", "||" };
+            corpus_printf(corpus, "(");
+            corpus_expr(corpus, depth - 1);
+            corpus_printf(corpus, " %s ", ops[corpus_rand(corpus, sizeof(ops) / sizeof(ops[0]))]);
+            corpus_expr(corpus, depth - 1);
+            corpus_printf(corpus, ")");
+            break;
+        }
+    }
+}
+
+static void corpus_string(Corpus* corpus) {
+    switch(corpus_rand(corpus, 3)) {
+        case 0: corpus_printf(corpus, "\""); break;
+        // Formatted
+        case 1: corpus_printf(corpus, "f\"{%s}, ", WORD()); break;
+        // Escaped
+        case 2: corpus_printf(corpus, "\"\\\"%s\\\" \\n", WORD()); break;
+    }
+    corpus_prose(corpus, 12);
+    corpus_printf(corpus, "\"");
+}
+
+static void corpus_comment(Corpus* corpus) {
+    switch(corpus_rand(corpus, 3)) {
+        case 0: corpus_printf(corpus, "// "); corpus_prose(corpus, 16); break;
+        case 1: corpus_printf(corpus, "# "); corpus_prose(corpus, 16); break;
+        case 2:
+            corpus_printf(corpus, "/* ");
+            corpus_prose(corpus, 16);
+            corpus_printf(corpus, "\n   ");
+            corpus_prose(corpus, 16);
+            corpus_printf(corpus, " */");
+            break;
+    }
+    corpus_printf(corpus, "\n");
+}
+
+static void corpus_statement(Corpus* corpus, CorpusKind kind) {
+    switch(corpus_rand(corpus, 6)) {
+        case 0:
+            corpus_printf(corpus, "    put %s%s: %s = ", corpus_rand(corpus, 2) ? "mutable " : "", WORD(), TYPE());
+            corpus_expr(corpus, kind == CorpusKindIdent ? 4 : 2);
+            break;
+        case 1:
+            corpus_printf(corpus, "    if %s == nil {\n        print(", WORD());
+            corpus_string(corpus);
+            corpus_printf(corpus, ")\n    } else {\n        %s += ", WORD());
+            corpus_expr(corpus, 2);
+            corpus_printf(corpus, "\n    }");
+            break;
+        case 2:
+            corpus_printf(corpus, "    loop {\n        match %s.%s {\n            when ", WORD(), WORD());
+            corpus_string(corpus);
+            corpus_printf(corpus, " => ...\n            default => ...\n        }\n    } // loop");
+            break;
+        case 3:
+            corpus_printf(corpus, "    %s = ", WORD());
+            if(kind == CorpusKindString)
+                corpus_string(corpus);
+            else
+                corpus_expr(corpus, 3);
+            break;
+        default:
+            corpus_printf(corpus, "    return ");
+            if(kind == CorpusKindIdent)
+                corpus_expr(corpus, 4);
+            else
+                corpus_string(corpus);
+            break;
+    }
+    corpus_printf(corpus, "\n");
+}
+
+// One top-level declaration
+static void corpus_decl(Corpus* corpus, CorpusKind kind) {
+    CorpusKind shape = kind == CorpusKindCode ? cast(CorpusKind)(1 + corpus_rand(corpus, 3)) : kind;
+    UInt64 num_comments = shape == CorpusKindComment ? 2 + corpus_rand(corpus, 6) : corpus_rand(corpus, 2);
+    for(UInt64 i = 0; i < num_comments; i++)
+        corpus_comment(corpus);
+
+    static const char* prefixes[] = { "", "", "[inline] ", "[comptime] ", "export " };
+    corpus_printf(corpus, "%sfunc %s_%llu(%s: %s, %s: %s) -> %s {\n",
+                  prefixes[corpus_rand(corpus, sizeof(prefixes) / sizeof(prefixes[0]))],
+                  WORD(), cast(unsigned long long)corpus_rand(corpus, 100000), WORD(), TYPE(), WORD(), TYPE(), TYPE());
+
+    UInt64 num_statements = 2 + corpus_rand(corpus, 8);
+    for(UInt64 i = 0; i < num_statements; i++) {
+        if(shape == CorpusKindComment && corpus_rand(corpus, 2))
+            corpus_comment(corpus);
+        corpus_statement(corpus, shape);
+        if(shape == CorpusKindString && corpus_rand(corpus, 2)) {
+            corpus_printf(corpus, "    put %s = ", WORD());
+            corpus_string(corpus);
+            corpus_printf(corpus, "\n");
+        }
+    }
+    corpus_printf(corpus, "}\n\n");
+}
+
+// A word of `corpusWords` that isn't a keyword (`module` is)
+static const char* corpus_ident(Corpus* corpus) {
+    const char* word = WORD();
+    while(strcmp(word, "module") == 0)
+        word = WORD();
+    return word;
+}
+
+// An expression the Parser handles: identifiers, integers and arithmetic. Constants are small and never divided by, so 
+// that folding them can't fail
+static void corpus_decl_expr(Corpus* corpus, UInt64 depth) {
+    static const char* ops[] = { "+", "-", "*" };
+    switch(corpus_rand(corpus, depth == 0 ? 2 : 6)) {
+        case 0: corpus_printf(corpus, "%s", corpus_ident(corpus)); break;
+        case 1: corpus_printf(corpus, "%llu", cast(unsigned long long)(1 + corpus_rand(corpus, 999))); break;
+        // (Not `-` on any expression: `--` is a token of its own)
+        case 2: corpus_printf(corpus, "-%s", corpus_ident(corpus)); break;
+        case 3:
+            corpus_decl_expr(corpus, depth - 1);
+            corpus_printf(corpus, " / %s", corpus_ident(corpus));
+            break;
+        default:
+            corpus_printf(corpus, "(");
+            corpus_decl_expr(corpus, depth - 1);
+            corpus_printf(corpus, " %s ", ops[corpus_rand(corpus, sizeof(ops) / sizeof(ops[0]))]);
+            corpus_decl_expr(corpus, depth - 1);
+            corpus_printf(corpus, ")");
+            break;
+    }
+}
+
+// One top-level declaration of the `decl` corpus
+static void corpus_decl_only(Corpus* corpus) {
+    switch(corpus_rand(corpus, 8)) {
+        case 0: corpus_printf(corpus, "use %s\n", corpus_ident(corpus)); break;
+        default:
+            corpus_printf(corpus, "put %s%s %s_%llu = ", corpus_rand(corpus, 2) ? "mutable " : "", TYPE(), 
+                          corpus_ident(corpus), cast(unsigned long long)corpus_rand(corpus, 100000));
+            corpus_decl_expr(corpus, 2);
+            corpus_printf(corpus, "\n");
+            break;
+    }
+}
+
+// Generate (at least) `size` bytes of source
+static Corpus corpus_new(CorpusKind kind, UInt64 size) {
+    Corpus corpus;
+    corpus.cap = size + 4096;
+    corpus.len = 0;
+    corpus.rng = 0x9E3779B97F4A7C15ull ^ (cast(UInt64)kind + 1);
+    corpus.data = cast(char*)malloc(corpus.cap);
+    CORETEN_ENFORCE_NN(corpus.data, "Could not allocate memory. Memory full.");
+
+    if(kind == CorpusKindDecl) {
+        corpus_printf(&corpus, "module bench\nuse string\n\n");
+        while(corpus.len < size)
+            corpus_decl_only(&corpus);
+        return corpus;
+    }
+    corpus_printf(&corpus, "import std::string\nimport std::hash as hash\n\n");
+    while(corpus.len < size)
+        corpus_decl(&corpus, kind);
+    return corpus;
+}
+
+// ================ Stages ================
+typedef struct StageResult {
+    UInt64 tokens;
+    UInt64 nodes;       // 0 if the stage doesn't parse
+} StageResult;
+
+// What a stage produced (freed by `stage_free()`, outside of the timed region)
+typedef struct StageOutput {
+    Lexer* lexer;
+    Parser* parser;     // null if the stage doesn't parse (otherwise, it owns `lexer`)
+} StageOutput;
+
+typedef StageOutput (*StageFunc)(Corpus* corpus, UInt32 num_threads);
+
+static StageOutput stage_lex(Corpus* corpus, UInt32 num_threads) {
+    Lexer* lexer = lexer_init(corpus->data, null);
+    lexer_lex(lexer);
+    return (StageOutput){ lexer, null };
+}
+
+static StageOutput stage_lex_compact(Corpus* corpus, UInt32 num_threads) {
+    Lexer* lexer = lexer_init_compact(corpus->data, null, 0);
+    lexer_lex(lexer);
+    return (StageOutput){ lexer, null };
+}
+
+static StageOutput stage_lex_stream(Corpus* corpus, UInt32 num_threads) {
+    Lexer* lexer = lexer_init(corpus->data, null);
+    Token* token = null;
+    do {
+        token = lexer_next_token(lexer);
+    } while(token->kind != TOK_EOF);
+    return (StageOutput){ lexer, null };
+}
+
+// Into the same TokenKinds from run to run (as an editor would), so only the first run allocates it. Comments are
+// counted as tokens
+static TokenKinds* stage_kinds = null;
+
+static StageOutput stage_lex_kinds(Corpus* corpus, UInt32 num_threads) {
+    Lexer* lexer = lexer_init(corpus->data, null);
+    if(NONE(stage_kinds))
+        stage_kinds = token_kinds_new(TOKENLIST_ALLOC_CAPACITY);
+    stage_kinds->len = 0;
+    lexer_lex_kinds(lexer, stage_kinds, 0, UInt32_MAX);
+    lexer->num_tokens = stage_kinds->len;
+    return (StageOutput){ lexer, null };
+}
+
+// On the same pool from run to run (as the Frontend lexes every file on its own), so only the first run starts it
+static JobPool* stage_pool = null;
+
+static StageOutput stage_lex_parallel(Corpus* corpus, UInt32 num_threads) {
+    Lexer* lexer = lexer_init_compact(corpus->data, null, 0);
+    if(NONE(stage_pool))
+        stage_pool = job_pool_new(num_threads);
+    lexer_lex_parallel(lexer, stage_pool);
+    return (StageOutput){ lexer, null };
+}
+
+static StageOutput stage_parse(Corpus* corpus, UInt32 num_threads) {
+    Lexer* lexer = lexer_init(corpus->data, null);
+    lexer_lex(lexer);
+    Parser* parser = parser_init(lexer);
+    CORETEN_ENFORCE(parser_parse(parser), "The corpus doesn't parse");
+    return (StageOutput){ lexer, parser };
+}
+
+static StageResult stage_result(StageOutput* output) {
+    // The nodes of the (index-based) AST, but its Root
+    StageResult result = { output->lexer->num_tokens, SOME(output->parser) ? output->parser->ast->len - 1 : 0 };
+    return result;
+}
+
+static void stage_free(StageOutput* output) {
+    if(SOME(output->parser))
+        parser_free(output->parser);
+    else
+        lexer_free(output->lexer);
+}
+
+typedef struct Stage {
+    const char* name;
+    StageFunc func;
+    bool parses;        // only run over the `decl` corpus (the others have syntax the Parser doesn't handle yet)
+} Stage;
+
+static const Stage stages[] = {
+    { "lex",            stage_lex,          false },
+    { "lex_compact",    stage_lex_compact,  false },
+    { "lex_stream",     stage_lex_stream,   false },
+    { "lex_kinds",      stage_lex_kinds,    false },
+    { "lex_parallel",   stage_lex_parallel, false },
+    { "parse",          stage_parse,        true },
+};
+#define NUM_STAGES  (sizeof(stages) / sizeof(stages[0]))
+
+// ================ Driver ================
+typedef struct BenchOptions {
+    UInt64 sizes[BENCH_MAX_SIZES];   // in MB
+    UInt32 num_sizes;
+    UInt32 reps;
+    UInt32 num_threads;
+    bool corpora[CorpusKindCount];
+    bool stages[NUM_STAGES];
+    bool json;
+    const char* baseline;       // null unless gating (or updating the baseline)
+    double threshold;           // in percent
+    double time_threshold;      // in percent (for times - see `gate_compare_time()`)
+    bool update_baseline;
+} BenchOptions;
+
+typedef struct BenchResult {
+    const char* corpus;
+    UInt64 bytes;
+    const char* stage;
+    Int64 instructions;         // -1 if not counted
+    Int64 allocs;               // -1 if not counted
+    double time;                // best time, as a multiple of the reference time (see `bench_reference()`)
+} BenchResult;
+
+static void usage(int status) {
+    fprintf(stderr,
+        "Usage: bench_frontend [--sizes=1,4,16] [--reps=3] [--corpus=code,ident,string,comment,decl]\n"
+        "                      [--stage=NAME,...] [--threads=0] [--json]\n"
+        "                      [--baseline=FILE [--threshold=5] [--time-threshold=50] [--update-baseline]]\n"
+        "Stages:");
+    for(UInt32 i = 0; i < NUM_STAGES; i++)
+        fprintf(stderr, " %s", stages[i].name);
+    fprintf(stderr, "\n");
+    exit(status);
+}
+
+// Parse a comma-separated list of names into `selected` (of `count` `names`)
+static void parse_name_list(const char* list, const char** names, UInt32 stride, UInt32 count, bool* selected) {
+    memset(selected, 0, count * sizeof(bool));
+    while(*list != nullchar) {
+        UInt64 len = strcspn(list, ",");
+        bool found = false;
+        for(UInt32 i = 0; i < count; i++) {
+            const char* name = *cast(const char**)(cast(const char*)names + i * stride);
+            if(strlen(name) == len && strncmp(name, list, len) == 0) {
+                selected[i] = found = true;
+                break;
+            }
+        }
+        if(!found) {
+            fprintf(stderr, "Unknown name `%.*s`\n", cast(int)len, list);
+            usage(1);
+        }
+        list += len + (list[len] == ',');
+    }
+}
+
+static BenchOptions parse_options(int argc, char** argv) {
+    BenchOptions options;
+    memset(&options, 0, sizeof(options));
+    options.sizes[0] = 1;
+    options.sizes[1] = 4;
+    options.sizes[2] = 16;
+    options.num_sizes = 3;
+    options.reps = 3;
+    options.num_threads = 0;
+    options.threshold = BENCH_DEFAULT_THRESHOLD;
+    options.time_threshold = BENCH_DEFAULT_TIME_THRESHOLD;
+    for(UInt32 i = 0; i < CorpusKindCount; i++)
+        options.corpora[i] = true;
+    for(UInt32 i = 0; i < NUM_STAGES; i++)
+        options.stages[i] = true;
+
+    for(int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if(strncmp(arg, "--sizes=", 8) == 0) {
+            options.num_sizes = 0;
+            for(const char* s = arg + 8; *s != nullchar && options.num_sizes < BENCH_MAX_SIZES; s += (*s == ',')) {
+                char* end = null;
+                options.sizes[options.num_sizes++] = strtoull(s, &end, 10);
+                if(end == s)
+                    usage(1);
+                s = end;
+            }
+        } else if(strncmp(arg, "--reps=", 7) == 0) {
+            options.reps = cast(UInt32)atoi(arg + 7);
+        } else if(strncmp(arg, "--threads=", 10) == 0) {
+            options.num_threads = cast(UInt32)atoi(arg + 10);
+        } else if(strncmp(arg, "--corpus=", 9) == 0) {
+            parse_name_list(arg + 9, corpusNames, sizeof(const char*), CorpusKindCount, options.corpora);
+        } else if(strncmp(arg, "--stage=", 8) == 0) {
+            parse_name_list(arg + 8, &stages[0].name, sizeof(Stage), NUM_STAGES, options.stages);
+        } else if(strcmp(arg, "--json") == 0) {
+            options.json = true;
+        } else if(strncmp(arg, "--baseline=", 11) == 0) {
+            options.baseline = arg + 11;
+        } else if(strncmp(arg, "--threshold=", 12) == 0) {
+            options.threshold = atof(arg + 12);
+        } else if(strncmp(arg, "--time-threshold=", 17) == 0) {
+            options.time_threshold = atof(arg + 17);
+        } else if(strcmp(arg, "--update-baseline") == 0) {
+            options.update_baseline = true;
+        } else if(strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0) {
+            usage(0);
+        } else {
+            fprintf(stderr, "Unknown option `%s`\n", arg);
+            usage(1);
+        }
+    }
+
+    if(options.reps == 0)
+        options.reps = 1;
+    if(options.update_baseline && NONE(options.baseline))
+        usage(1);
+    return options;
+}
+
+static void report(BenchOptions* options, const char* corpus, UInt64 bytes, const char* stage, double seconds,
+                   StageResult result, BenchAllocs allocs, Int64 instructions) {
+    double mb = cast(double)bytes / (1024.0 * 1024.0);
+    UInt64 peak_rss_kb = bench_peak_rss_kb();
+    if(options->json) {
+        printf("{\"bench\":\"frontend\",\"version\":%d,\"corpus\":\"%s\",\"bytes\":%llu,\"stage\":\"%s\","
+               "\"reps\":%u,\"threads\":%u,\"seconds\":%.6f,\"mb_per_s\":%.2f,\"tokens\":%llu,\"tokens_per_s\":%.0f,",
+               BENCH_VERSION, corpus, cast(unsigned long long)bytes, stage, options->reps, options->num_threads,
+               seconds, mb / seconds, cast(unsigned long long)result.tokens, result.tokens / seconds);
+        if(result.nodes > 0)
+            printf("\"nodes\":%llu,\"nodes_per_s\":%.0f,", cast(unsigned long long)result.nodes, result.nodes / seconds);
+        else
+            printf("\"nodes\":null,\"nodes_per_s\":null,");
+    #ifdef BENCH_COUNTS_ALLOCS
+        printf("\"allocs\":%llu,\"alloc_bytes\":%llu,",
+               cast(unsigned long long)allocs.num_allocs, cast(unsigned long long)allocs.bytes);
+    #else
+        printf("\"allocs\":null,\"alloc_bytes\":null,");
+    #endif // BENCH_COUNTS_ALLOCS
+        if(instructions >= 0)
+            printf("\"instructions\":%lld,", cast(long long)instructions);
+        else
+            printf("\"instructions\":null,");
+        printf("\"peak_rss_kb\":%llu}\n", cast(unsigned long long)peak_rss_kb);
+    } else {
+        printf("%-8s %7.1fMB  %-13s %9.2f MB/s %12.0f tok/s", corpus, mb, stage, mb / seconds, result.tokens / seconds);
+        if(result.nodes > 0)
+            printf(" %12.0f nodes/s", result.nodes / seconds);
+    #ifdef BENCH_COUNTS_ALLOCS
+        printf(" %10llu allocs", cast(unsigned long long)allocs.num_allocs);
+    #endif // BENCH_COUNTS_ALLOCS
+        if(instructions >= 0)
+            printf(" %14lld instr", cast(long long)instructions);
+        printf(" %8llu KB peak RSS\n", cast(unsigned long long)peak_rss_kb);
+    }
+    fflush(stdout);
+}
+
+// ================ Regression gate ================
+// The baseline is a line per (corpus, size, stage): `<corpus> <bytes> <stage> <instructions> <allocs> <time>`, where
+// a value that wasn't counted is `-` (as is a missing `<time>`). Lines starting with `#` are comments
+static bool baseline_write(const char* path, BenchResult* results, UInt32 num_results) {
+    FILE* file = fopen(path, "w");
+    if(NONE(file))
+        return false;
+    fprintf(file, "# Front end benchmark baseline (`bench_frontend --baseline=%s --update-baseline`)\n", path);
+    fprintf(file, "# corpus bytes stage instructions allocs time (relative to `bench_reference()`)\n");
+    for(UInt32 i = 0; i < num_results; i++) {
+        BenchResult* result = &results[i];
+        fprintf(file, "%s %llu %s ", result->corpus, cast(unsigned long long)result->bytes, result->stage);
+        if(result->instructions >= 0)
+            fprintf(file, "%lld ", cast(long long)result->instructions);
+        else
+            fprintf(file, "- ");
+        if(result->allocs >= 0)
+            fprintf(file, "%lld ", cast(long long)result->allocs);
+        else
+            fprintf(file, "- ");
+        fprintf(file, "%.3f\n", result->time);
+    }
+    return fclose(file) == 0;
+}
+
+// A count of the baseline (-1 for `-`)
+static Int64 baseline_count(const char* str) {
+    return strcmp(str, "-") == 0 ? -1 : cast(Int64)strtoll(str, null, 10);
+}
+
+// Find the baseline of `result` in `file` (read from its start). Returns false if there's none
+static bool baseline_find(FILE* file, BenchResult* result, BenchResult* baseline) {
+    char line[256], corpus[64], stage[64], instructions[32], allocs[32], time[32];
+    unsigned long long bytes;
+    rewind(file);
+    while(SOME(fgets(line, sizeof(line), file))) {
+        strcpy(time, "-");
+        if(line[0] == '#' ||
+           sscanf(line, "%63s %llu %63s %31s %31s %31s", corpus, &bytes, stage, instructions, allocs, time) < 5)
+            continue;
+        if(strcmp(corpus, result->corpus) == 0 && bytes == result->bytes && strcmp(stage, result->stage) == 0) {
+            *baseline = *result;
+            baseline->instructions = baseline_count(instructions);
+            baseline->allocs = baseline_count(allocs);
+            baseline->time = strcmp(time, "-") == 0 ? -1.0 : atof(time);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Compare a count against its baseline (if both were counted). Returns true if it grew past the threshold
+static bool gate_compare(BenchOptions* options, FILE* out, const char* what, Int64 baseline, Int64 count) {
+    if(baseline < 0 || count < 0) {
+        fprintf(out, "  %s -", what);
+        return false;
+    }
+    double change = baseline > 0 ? 100.0 * cast(double)(count - baseline) / cast(double)baseline :
+                                   (count > 0 ? 100.0 : 0.0);
+    fprintf(out, "  %s %lld -> %lld (%+.1f%%)", what, cast(long long)baseline, cast(long long)count, change);
+    return change > options->threshold && count - baseline > BENCH_GATE_MIN_DELTA;
+}
+
+// Compare a (relative) time against its baseline, with `--time-threshold`. Returns true if it grew past it
+static bool gate_compare_time(BenchOptions* options, FILE* out, double baseline, double time) {
+    if(baseline <= 0 || time <= 0) {
+        fprintf(out, "  time -");
+        return false;
+    }
+    double change = 100.0 * (time - baseline) / baseline;
+    fprintf(out, "  time %.3f -> %.3f (%+.1f%%)", baseline, time, change);
+    return change > options->time_threshold;
+}
+
+// Returns the no. of results that regressed
+static UInt32 gate(BenchOptions* options, BenchResult* results, UInt32 num_results) {
+    // Not in the way of the results
+    FILE* out = options->json ? stderr : stdout;
+    FILE* file = fopen(options->baseline, "r");
+    if(NONE(file)) {
+        fprintf(stderr, "Cannot open the baseline `%s` (make one with `--update-baseline`)\n", options->baseline);
+        return 1;
+    }
+    fprintf(out, "Regression gate against `%s` (threshold %.1f%%, %.1f%% for times):\n", options->baseline, 
+            options->threshold, options->time_threshold);
+    UInt32 num_regressed = 0;
+    for(UInt32 i = 0; i < num_results; i++) {
+        BenchResult* result = &results[i];
+        BenchResult baseline;
+        fprintf(out, "%-8s %9llu  %-13s", result->corpus, cast(unsigned long long)result->bytes, result->stage);
+        if(!baseline_find(file, result, &baseline)) {
+            fprintf(out, "  no baseline\n");
+            continue;
+        }
+        bool is_regressed = false;
+        if(baseline.instructions >= 0 && result->instructions >= 0)
+            is_regressed = gate_compare(options, out, "instructions", baseline.instructions, result->instructions);
+        else
+            is_regressed = gate_compare_time(options, out, baseline.time, result->time);
+        is_regressed = gate_compare(options, out, "allocs", baseline.allocs, result->allocs) || is_regressed;
+        fprintf(out, "  %s\n", is_regressed ? "REGRESSED" : "ok");
+        num_regressed += is_regressed;
+    }
+    fclose(file);
+    if(num_regressed > 0)
+        fprintf(out, "%u regression(s). If they're expected, record a new baseline with `--update-baseline`\n",
+                num_regressed);
+    return num_regressed;
+}
+
+int main(int argc, char** argv) {
+    BenchOptions options = parse_options(argc, argv);
+    BenchResult* results = cast(BenchResult*)calloc(BENCH_MAX_RESULTS, sizeof(BenchResult));
+    CORETEN_ENFORCE_NN(results, "Could not allocate memory. Memory full.");
+    UInt32 num_results = 0;
+
+    for(UInt32 c = 0; c < CorpusKindCount; c++) {
+        if(!options.corpora[c])
+            continue;
+
+        for(UInt32 s = 0; s < options.num_sizes; s++) {
+            Corpus corpus = corpus_new(cast(CorpusKind)c, options.sizes[s] * 1024 * 1024);
+            for(UInt32 i = 0; i < NUM_STAGES; i++) {
+                if(!options.stages[i] || (stages[i].parses && c != CorpusKindDecl))
+                    continue;
+
+                double best = 0;
+                double best_relative = 0;
+                StageResult result = {0, 0};
+                BenchAllocs allocs = {0, 0};
+                Int64 instructions = -1;
+                for(UInt32 rep = 0; rep < options.reps; rep++) {
+                    // Right before the stage, so that both run under the same conditions (frequency, other load)
+                    double reference = bench_reference(corpus.data, corpus.len, 3);
+                    BenchAllocs before = bench_allocs_now();
+                    bench_counter_start();
+                    double start = bench_now();
+                    double cpu_start = bench_cpu_now();
+                    StageOutput output = stages[i].func(&corpus, options.num_threads);
+                    double seconds = bench_now() - start;
+                    double cpu_seconds = bench_cpu_now() - cpu_start;
+                    Int64 count = bench_counter_stop();
+                    BenchAllocs after = bench_allocs_now();
+                    // The fewest (the others count what happened to run alongside)
+                    if(count >= 0 && (instructions < 0 || count < instructions))
+                        instructions = count;
+                    result = stage_result(&output);
+                    stage_free(&output);
+
+                    if(rep == 0 || seconds < best)
+                        best = seconds;
+                    if(rep == 0 || cpu_seconds / reference < best_relative)
+                        best_relative = cpu_seconds / reference;
+                    allocs.num_allocs = after.num_allocs - before.num_allocs;
+                    allocs.bytes = after.bytes - before.bytes;
+                }
+                report(&options, corpusNames[c], corpus.len, stages[i].name, best, result, allocs, instructions);
+                if(num_results < BENCH_MAX_RESULTS) {
+                    BenchResult* gated = &results[num_results++];
+                    gated->corpus = corpusNames[c];
+                    gated->bytes = corpus.len;
+                    gated->stage = stages[i].name;
+                    gated->instructions = instructions;
+                    gated->time = best_relative;
+                #ifdef BENCH_COUNTS_ALLOCS
+                    gated->allocs = cast(Int64)allocs.num_allocs;
+                #else
+                    gated->allocs = -1;
+                #endif // BENCH_COUNTS_ALLOCS
+                }
+            }
+            free(corpus.data);
+        }
+    }
+
+    int status = 0;
+    if(options.update_baseline) {
+        if(!baseline_write(options.baseline, results, num_results)) {
+            fprintf(stderr, "Cannot write the baseline `%s`\n", options.baseline);
+            status = 1;
+        } else {
+            printf("Recorded %u result(s) into `%s`\n", num_results, options.baseline);
+        }
+    } else if(SOME(options.baseline)) {
+        status = gate(&options, results, num_results) > 0 ? 1 : 0;
+    }
+    free(results);
+    if(SOME(stage_pool))
+        job_pool_free(stage_pool);
+    return status;
+}
@@ -0,0 +1,60 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+TEST(Buffer, copy) {
+    char source[] = "put int identifier = 1";
+    Buff* name = buff_new_copy(source + 8, 10);
+    CHECK_EQ(name->len, 10);
+    CHECK_STREQ(name->data, "identifier");
+    // The data is stored right after the Buff (a single allocation)
+    CHECK_EQ(name->data, cast(char*)(name + 1));
+    buff_free(name);
+
+    Buff* empty = buff_new_copy(null, 0);
+    CHECK_EQ(empty->len, 0);
+    CHECK_STREQ(empty->data, "");
+    buff_free(empty);
+
+    Buff* full = buff_new_from_len(source, sizeof(source) - 1);
+    Buff* clone = buff_clone(full);
+    CHECK_NE(clone->data, full->data);
+    CHECK_TRUE(buff_cmp(clone, full));
+    Buff* slice = buff_slice(full, 4, 3);
+    CHECK_STREQ(slice->data, "int");
+    Buff* prefix = buff_clone_n(full, 3);
+    CHECK_STREQ(prefix->data, "put");
+    buff_free(prefix);
+    buff_free(slice);
+    buff_free(clone);
+    buff_free(full);
+
+    Buff* lit = BUFF_LIT("adorad");
+    CHECK_EQ(lit->len, 6);
+    buff_free(lit);
+}
+
+TEST(Buffer, views) {
+    char* source = "foo bar FOO foobar";
+    BuffView all = buffview_new(source);
+    BuffView foo = buffview_slice(&all, 0, 3);
+    BuffView bar = buffview_slice(&all, 4, 3);
+    BuffView upper = buffview_slice(&all, 8, 3);
+    BuffView foo2 = buffview_slice(&all, 12, 3);
+    CHECK_EQ(foo.data, source);
+    CHECK_EQ(foo.len, 3);
+
+    // Views aren't null-terminated: only `len` bytes are compared (and hashed)
+    CHECK_TRUE(buffview_cmp(&foo, &foo2));
+    CHECK_FALSE(buffview_cmp(&foo, &bar));
+    CHECK_FALSE(buffview_cmp(&foo, &upper));
+    CHECK_TRUE(buffview_cmp_nocase(&foo, &upper));
+    CHECK_FALSE(buffview_cmp_nocase(&foo, &bar));
+    CHECK_EQ(buffview_hash(&foo), buffview_hash(&foo2));
+    CHECK_NE(buffview_hash(&foo), buffview_hash(&bar));
+
+    Buff* buff = buff_new_copy("foo", 3);
+    BuffView view = buff_view(buff);
+    CHECK_TRUE(buffview_cmp(&view, &foo));
+    buff_free(buff);
+}
@@ -0,0 +1,176 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+    #include <direct.h>
+    #define make_dir(path)  _mkdir(path)
+#else
+    #define make_dir(path)  mkdir(path, 0755)
+#endif
+TAU_MAIN()
+
+static void write_source(const char* fname, const char* source) {
+    FILE* file = fopen(fname, "wb");
+    fputs(source, file);
+    fclose(file);
+}
+
+// Has `diags` got an error of kind `err`?
+static bool has_error(Diagnostics* diags, Error err) {
+    for(UInt32 i = 0; i < diags->len; i++) {
+        if(diags->items[i].err == err)
+            return true;
+    }
+    return false;
+}
+
+TEST(Build, find_files) {
+    make_dir("__build_find");
+    make_dir("__build_find/b");
+    make_dir("__build_find/.hidden");
+    write_source("__build_find/b/z.ad", "module b\n");
+    write_source("__build_find/b/a.ad", "module b\n");
+    write_source("__build_find/main.ad", "use b\n");
+    write_source("__build_find/notes.txt", "not a source file\n");
+    write_source("__build_find/.hidden/x.ad", "module hidden\n");
+
+    Vec* fnames = build_find_files("__build_find");
+    REQUIRE_NE(fnames, null);
+    REQUIRE_EQ(vec_size(fnames), 3);
+    CHECK_NE(strstr(*cast(char**)vec_at(fnames, 0), "a.ad"), null);
+    CHECK_NE(strstr(*cast(char**)vec_at(fnames, 1), "z.ad"), null);
+    CHECK_NE(strstr(*cast(char**)vec_at(fnames, 2), "main.ad"), null);
+    for(UInt64 i = 0; i < vec_size(fnames); i++)
+        free(*cast(char**)vec_at(fnames, i));
+    vec_free(fnames);
+    CHECK_NULL(build_find_files("__build_find/missing"));
+
+    Build* build = build_dir("__build_find", null);
+    REQUIRE_NE(build, null);
+    CHECK_TRUE(build->ok);
+    CHECK_EQ(vec_size(build->modules), 2);
+    BuildModule* module = build_find_module(build, "b");
+    REQUIRE_NE(module, null);
+    CHECK_EQ(module->num_files, 2);
+    CHECK_EQ(module->first_file, 0);
+    CHECK_NE(build_find_module(build, BUILD_DEFAULT_MODULE), null);
+    CHECK_NULL(build_find_module(build, "hidden"));
+    build_free(build);
+
+    remove("__build_find/b/z.ad");
+    remove("__build_find/b/a.ad");
+    remove("__build_find/main.ad");
+    remove("__build_find/notes.txt");
+    remove("__build_find/.hidden/x.ad");
+    rmdir("__build_find/b");
+    rmdir("__build_find/.hidden");
+    rmdir("__build_find");
+}
+
+TEST(Build, modules) {
+    make_dir("__build_modules");
+    make_dir("__build_modules/net");
+    write_source("__build_modules/net/http.ad", "module net\nuse io\nuse io\n");
+    // Not the module of the other file of its directory
+    write_source("__build_modules/net/tcp.ad", "module tcp\n");
+    // `io` isn't a module of the build
+    write_source("__build_modules/main.ad", "use net\nmodule late\n");
+
+    Build* build = build_dir("__build_modules", null);
+    REQUIRE_NE(build, null);
+    CHECK_FALSE(build->ok);
+    REQUIRE_EQ(build->num_files, 3);
+    BuildFile* main_file = &build->files[0];
+    BuildFile* http = &build->files[1];
+    BuildFile* tcp = &build->files[2];
+    CHECK_STREQ(http->module, "net");
+    CHECK_EQ(vec_size(http->uses), 1);
+    CHECK_TRUE(has_error(http->diags, ErrorModuleNotFound));
+    CHECK_EQ(http->diags->len, 2);  // the second `use io` is a warning
+    CHECK_TRUE(has_error(tcp->diags, ErrorModuleMismatch));
+    CHECK_STREQ(main_file->module, "late");
+    CHECK_TRUE(has_error(main_file->diags, ErrorSyntaxError));
+    CHECK_EQ(build->diags->num_errors, 3);
+    build_free(build);
+
+    remove("__build_modules/net/http.ad");
+    remove("__build_modules/net/tcp.ad");
+    remove("__build_modules/main.ad");
+    rmdir("__build_modules/net");
+    rmdir("__build_modules");
+}
+
+typedef struct EmitLog {
+    UInt32 order[64];
+    UInt32 num_files;
+} EmitLog;
+
+static bool log_emit(Build* build, BuildFile* file, void* arg) {
+    EmitLog* log = cast(EmitLog*)arg;
+    log->order[log->num_files++] = file->parser->id;
+    return file->parser->id != 7;
+}
+
+TEST(Build, pipeline) {
+    char fnames[40][32];
+    const char* paths[40];
+    for(UInt32 i = 0; i < 40; i++) {
+        sprintf(fnames[i], "__build_pipeline_%02u.ad", i);
+        write_source(fnames[i], i % 2 ? "module pipeline\nuse pipeline\n" : "module pipeline\n");
+        paths[i] = fnames[i];
+    }
+
+    // Queues that are much shorter than the list of files (so that stages block on one another)
+    EmitLog log = {0};
+    BuildOptions options = {0};
+    options.queue_depth = 2;
+    options.keep_stats = true;
+    options.emit = log_emit;
+    options.emit_arg = &log;
+    Build* build = build_files(paths, 40, &options);
+    // Files are emitted in order, and a failed emit fails the build
+    REQUIRE_EQ(log.num_files, 40);
+    bool is_ordered = true;
+    for(UInt32 i = 0; i < 40; i++)
+        is_ordered = is_ordered && log.order[i] == i;
+    CHECK_TRUE(is_ordered);
+    CHECK_FALSE(build->files[7].ok);
+    CHECK_TRUE(build->files[8].ok);
+    CHECK_FALSE(build->ok);
+    for(UInt32 i = 0; i < BuildStageCount; i++)
+        CHECK_EQ(build->stages[i].num_files, 40);
+    CHECK_EQ(build->stats->num_files, 40);
+    CHECK_GT(build->stats->phases[StatsPhaseCheck].num_runs, 0);
+    CHECK_EQ(build->num_tokens, 20 * 3 + 20 * 5);
+    CHECK_STREQ(build_stage_str(BuildStageCheck), "check");
+
+    FILE* stream = tmpfile();
+    REQUIRE_NE(stream, null);
+    build_print_report(build, stream);
+    char report[1024] = {0};
+    rewind(stream);
+    fread(report, 1, sizeof(report) - 1, stream);
+    fclose(stream);
+    CHECK_NE(strstr(report, "Built 40 file(s) in 1 module(s)"), null);
+    CHECK_NE(strstr(report, "files/s"), null);
+    CHECK_NE(strstr(report, "parse"), null);
+    build_free(build);
+
+    // A file that doesn't exist goes through the pipeline too (and fails it)
+    const char* missing[] = { paths[0], "__build_pipeline_missing.ad" };
+    build = build_files(missing, 2, null);
+    CHECK_TRUE(build->files[0].ok);
+    CHECK_FALSE(build->files[1].ok);
+    CHECK_TRUE(has_error(build->diags, ErrorFileNotFound));
+    build_free(build);
+
+    // So does one that can't be read (a directory, here)
+    const char* unreadable[] = { paths[0], "." };
+    build = build_files(unreadable, 2, null);
+    CHECK_TRUE(build->files[0].ok);
+    CHECK_FALSE(build->files[1].ok);
+    CHECK_TRUE(has_error(build->diags, ErrorFileNotReadable));
+    build_free(build);
+    for(UInt32 i = 0; i < 40; i++)
+        remove(fnames[i]);
+}
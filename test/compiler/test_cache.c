@@ -0,0 +1,80 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+TEST(Cache, key) {
+    char* source = "module foo\nuse bar\n";
+    UInt64 len = strlen(source);
+    CHECK_EQ(cache_key(source, len), cache_key(source, len));
+    CHECK_NE(cache_key(source, len), cache_key("module foo\nuse baz\n", len));
+    CHECK_NE(cache_key(source, len), cache_key(source, len - 1));
+
+    char* path = cache_path(".", 0x1234abcdull);
+    CHECK_STREQ(path, "./000000001234abcd.adc");
+    free(path);
+}
+
+TEST(Cache, store_load) {
+    char* source = "module foo\nuse bar\nput x = a + b * 2\nput s = \"a\\n\"\n";
+    UInt64 len = strlen(source);
+    UInt64 key = cache_key(source, len);
+    Lexer* lexer = lexer_init_compact(source, null, 3);
+    lexer_lex(lexer);
+
+    Ast* ast = ast_new(0);
+    AstIndex a = ast_add_node(ast, AstNodeKindIdentifier, 8, AST_NULL, AST_NULL);
+    AstIndex b = ast_add_node(ast, AstNodeKindIdentifier, 10, AST_NULL, AST_NULL);
+    AstIndex mul = ast_add_node(ast, AstNodeKindBinaryOpExpr, 11, b, AST_NULL);
+    AstIndex add = ast_add_node(ast, AstNodeKindBinaryOpExpr, 9, a, mul);
+    AstIf branches = { add, mul };
+    UInt32 extra = AST_ADD_EXTRA(ast, branches);
+
+    char* path = cache_path(".", key);
+    remove(path);
+    CHECK_NULL(cache_load(path, key, len));
+    REQUIRE(cache_store(path, key, len, lexer->tokens->data, cast(UInt32)lexer->tokens->len, ast));
+
+    CacheEntry* entry = cache_load(path, key, len);
+    REQUIRE_NE(entry, null);
+    REQUIRE_EQ(entry->num_tokens, lexer->tokens->len);
+    CHECK_EQ(memcmp(entry->tokens, lexer->tokens->data, entry->num_tokens * sizeof(CompactToken)), 0);
+    CHECK_EQ(entry->tokens[0].fileid, 3);
+    // Strings keep whether they have to be unescaped
+    CHECK_EQ(entry->tokens[15].kind, STRING);
+    CHECK_EQ(entry->tokens[15].flags, TOKEN_FLAG_HAS_ESCAPES);
+    REQUIRE_EQ(entry->ast.len, ast->len);
+    CHECK_EQ(entry->ast.extra_len, ast->extra_len);
+    for(AstIndex i = 0; i < ast->len; i++) {
+        CHECK_EQ(AST_KIND(&entry->ast, i), AST_KIND(ast, i));
+        CHECK_EQ(AST_MAIN_TOKEN(&entry->ast, i), AST_MAIN_TOKEN(ast, i));
+        CHECK_EQ(AST_LHS(&entry->ast, i), AST_LHS(ast, i));
+        CHECK_EQ(AST_RHS(&entry->ast, i), AST_RHS(ast, i));
+    }
+    CHECK_EQ(AST_EXTRA(&entry->ast, AstIf, extra).then_body, add);
+    CHECK_EQ(AST_EXTRA(&entry->ast, AstIf, extra).else_body, mul);
+    // A hit is used in place
+    if(entry->view.is_mapped && !entry->is_swapped)
+        CHECK_EQ(cast(char*)entry->tokens, entry->view.data + sizeof(CacheHeader));
+    cache_entry_free(entry);
+
+    // Another key (or length) is a miss
+    CHECK_NULL(cache_load(path, key + 1, len));
+    CHECK_NULL(cache_load(path, key, len + 1));
+
+    // So is a truncated file
+    FileView view = file_map(path);
+    UInt64 truncated_len = view.len - 8;
+    char* truncated = cast(char*)malloc(truncated_len);
+    memcpy(truncated, view.data, truncated_len);
+    file_unmap(&view);
+    FILE* file = fopen(path, "wb");
+    fwrite(truncated, 1, truncated_len, file);
+    fclose(file);
+    free(truncated);
+    CHECK_NULL(cache_load(path, key, len));
+
+    remove(path);
+    free(path);
+    ast_free(ast);
+    lexer_free(lexer);
+}
@@ -0,0 +1,193 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+// A unit: a function of `n` statements (so units are of very different sizes)
+static void emit_func(CWriter* writer, void* arg) {
+    UInt64 n = cast(UInt64)arg;
+    cwriter_printf(writer, "int f%llu(int x) {\n", cast(unsigned long long)n);
+    writer->indent++;
+    for(UInt64 i = 0; i < n % 37; i++) {
+        cwriter_indent(writer);
+        cwriter_printf(writer, "x = x * %llu + 1;\n", cast(unsigned long long)i);
+    }
+    cwriter_indent(writer);
+    cwriter_str(writer, "return x;\n");
+    writer->indent--;
+    cwriter_str(writer, "}\n\n");
+}
+
+// Everything `cgen` emitted, shard after shard (the prelude of each shard included)
+static char* read_shards(CGen* cgen, UInt64* len) {
+    FILE* stream = tmpfile();
+    for(UInt32 i = 0; i < cgen->options.num_shards; i++)
+        cgen_write_shard(cgen, i, stream);
+    *len = cast(UInt64)ftell(stream);
+    char* data = cast(char*)calloc(*len + 1, 1);
+    rewind(stream);
+    fread(data, 1, *len, stream);
+    fclose(stream);
+    return data;
+}
+
+static CGen* emit_funcs(UInt32 num_threads, UInt32 num_shards, UInt32 units_per_job) {
+    CGenOptions options = { num_threads, num_shards, units_per_job };
+    CGen* cgen = cgen_new(&options);
+    for(UInt64 i = 0; i < 500; i++)
+        cgen_add_unit(cgen, emit_func, cast(void*)i);
+    cgen_emit(cgen);
+    return cgen;
+}
+
+TEST(CGen, writer) {
+    CWriter writer;
+    cwriter_init(&writer, 4);
+    cwriter_str(&writer, "ab");
+    // Longer than what's left (so it's formatted twice)
+    cwriter_printf(&writer, "%s-%d", "cdefgh", 42);
+    writer.indent = 2;
+    cwriter_indent(&writer);
+    cwriter_write(&writer, "xyz", 2);
+    CHECK_EQ(writer.len, 21);
+    CHECK_EQ(strncmp(writer.data, "abcdefgh-42        xy", writer.len), 0);
+    cwriter_free(&writer);
+}
+
+TEST(CGen, deterministic) {
+    // One thread, one shard
+    CGen* serial = emit_funcs(1, 1, 1);
+    UInt64 serial_len;
+    char* expected = read_shards(serial, &serial_len);
+    CHECK_EQ(serial->num_writers, 1);
+    CHECK_GT(serial->num_bytes, 0);
+    CHECK_EQ(serial_len, serial->prelude.len + serial->num_bytes);
+    CHECK_NE(strstr(expected, "int f0(int x) {\n    return x;\n}\n"), null);
+    CHECK_NE(strstr(expected, "int f499(int x)"), null);
+
+    // More threads (and jobs of any size) emit the same, in the same order
+    CGen* parallel = emit_funcs(4, 1, 3);
+    UInt64 len;
+    char* output = read_shards(parallel, &len);
+    CHECK_EQ(len, serial_len);
+    CHECK_EQ(memcmp(output, expected, len), 0);
+    free(output);
+    cgen_free(parallel);
+    free(expected);
+    cgen_free(serial);
+}
+
+TEST(CGen, shards) {
+    CGen* cgen = emit_funcs(4, 4, 0);
+    CHECK_EQ(cgen->shard_starts[0], 0);
+    CHECK_EQ(cgen->shard_starts[4], 500);
+    UInt64 total = 0;
+    for(UInt32 i = 0; i < 4; i++) {
+        UInt64 num_bytes = 0;
+        for(UInt32 j = cgen->shard_starts[i]; j < cgen->shard_starts[i + 1]; j++)
+            num_bytes += vec_at_CGenUnit(cgen->units, j)->len;
+        // About a quarter each
+        CHECK_GT(num_bytes, cgen->num_bytes / 5);
+        CHECK_LT(num_bytes, cgen->num_bytes / 3);
+        total += num_bytes;
+    }
+    CHECK_EQ(total, cgen->num_bytes);
+
+    // The shards, without their preludes, are the output of one shard
+    UInt64 len;
+    char* output = read_shards(cgen, &len);
+    CHECK_EQ(len, 4 * cgen->prelude.len + cgen->num_bytes);
+    CGen* single = emit_funcs(2, 1, 0);
+    UInt64 single_len;
+    char* expected = read_shards(single, &single_len);
+    UInt64 offset = 0;
+    UInt64 expected_offset = single->prelude.len;
+    bool is_same = true;
+    for(UInt32 i = 0; i < 4; i++) {
+        is_same = is_same && memcmp(output + offset, single->prelude.data, single->prelude.len) == 0;
+        offset += single->prelude.len;
+        UInt64 num_bytes = 0;
+        for(UInt32 j = cgen->shard_starts[i]; j < cgen->shard_starts[i + 1]; j++)
+            num_bytes += vec_at_CGenUnit(cgen->units, j)->len;
+        is_same = is_same && memcmp(output + offset, expected + expected_offset, num_bytes) == 0;
+        offset += num_bytes;
+        expected_offset += num_bytes;
+    }
+    CHECK_TRUE(is_same);
+    free(expected);
+    cgen_free(single);
+    free(output);
+
+    char path[64];
+    cgen_shard_path(cgen, "out/prog", 3, path, sizeof(path));
+    CHECK_STREQ(path, "out/prog_3.c");
+    REQUIRE_TRUE(cgen_write_files(cgen, "__cgen_shards"));
+    CHECK_TRUE(file_exists("__cgen_shards_0.c"));
+    CHECK_TRUE(file_exists("__cgen_shards_3.c"));
+    for(UInt32 i = 0; i < 4; i++) {
+        cgen_shard_path(cgen, "__cgen_shards", i, path, sizeof(path));
+        remove(path);
+    }
+    cgen_free(cgen);
+
+    // More shards than units: the unit goes to the shard its middle is in, and the others are empty (but for the
+    // prelude)
+    CGenOptions options = { 1, 3, 0 };
+    cgen = cgen_new(&options);
+    cgen_add_unit(cgen, emit_func, cast(void*)7);
+    cgen_emit(cgen);
+    CHECK_EQ(cgen->shard_starts[1], 0);
+    CHECK_EQ(cgen->shard_starts[2], 1);
+    CHECK_EQ(cgen->shard_starts[3], 1);
+    cgen_shard_path(cgen, "prog", 0, path, sizeof(path));
+    CHECK_STREQ(path, "prog_0.c");
+    cgen_free(cgen);
+}
+
+TEST(CGen, compile_command) {
+    char command[256];
+    cgen_compile_command(CompilerTypeGcc, "a.c", "a.o", command, sizeof(command));
+    CHECK_STREQ(command, "gcc -std=c11 -O2 -w -c \"a.c\" -o \"a.o\"");
+    cgen_compile_command(CompilerTypeClang, "a.c", "a.o", command, sizeof(command));
+    CHECK_NE(strstr(command, "clang "), null);
+    cgen_compile_command(CompilerTypeTinyc, "a.c", "a.o", command, sizeof(command));
+    CHECK_STREQ(command, "tcc -c \"a.c\" -o \"a.o\"");
+    cgen_compile_command(CompilerTypeMsvc, "a.c", "a.obj", command, sizeof(command));
+    CHECK_STREQ(command, "cl /nologo /O2 /c \"a.c\" /Fo\"a.obj\"");
+    CHECK_GT(cgen_compile_command(CompilerTypeGcc, "a.c", "a.o", command, 8), 8);
+}
+
+TEST(CGen, unity) {
+    CGenOptions options = { 2, CGEN_UNITY_SHARDS, 0 };
+    CGen* cgen = cgen_new(&options);
+    for(UInt64 i = 0; i < 100; i++)
+        cgen_add_unit(cgen, emit_func, cast(void*)i);
+    cgen_emit(cgen);
+
+    // In memory, the shards are what's written to their files
+    UInt64 len;
+    char* expected = read_shards(cgen, &len);
+    CWriter unit;
+    cwriter_init(&unit, 16);
+    for(UInt32 i = 0; i < CGEN_UNITY_SHARDS; i++)
+        cgen_shard_str(cgen, i, &unit);
+    CHECK_EQ(unit.len, len);
+    CHECK_EQ(unit.data[unit.len], nullchar);
+    CHECK_EQ(memcmp(unit.data, expected, len), 0);
+    cwriter_free(&unit);
+    free(expected);
+
+    UInt32 num_failed = 1;
+    bool is_compiled = cgen_compile_in_process(cgen, "__cgen_unity", &num_failed);
+    #if defined(ADORAD_HAS_LIBTCC)
+        CHECK_TRUE(is_compiled);
+        CHECK_EQ(num_failed, 0);
+        CHECK_TRUE(file_exists("__cgen_unity_0.o"));
+        CHECK_FALSE(file_exists("__cgen_unity_0.c"));
+        remove("__cgen_unity_0.o");
+        remove("__cgen_unity_1.o");
+    #else
+        CHECK_FALSE(is_compiled);
+        CHECK_EQ(num_failed, 0);
+    #endif
+    cgen_free(cgen);
+}
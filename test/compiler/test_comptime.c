@@ -0,0 +1,181 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+#define INS(op, a, b, c)    comptime_emit(vm, func, COMPTIME_INS(ComptimeOp##op, a, b, c))
+#define INS_BX(op, a, bx)   comptime_emit(vm, func, COMPTIME_INS_BX(ComptimeOp##op, a, bx))
+
+// `fib(n)`, recursively (so it's exponential unless memoized)
+static UInt32 make_fib(ComptimeVM* vm) {
+    UInt32 func = comptime_func_new(vm, "fib", 1);
+    for(int i = 0; i < 3; i++)
+        comptime_new_reg(vm, func);
+    INS_BX(LoadInt, 1, 2);
+    INS(Lt, 1, 0, 1);
+    UInt32 at = INS_BX(JumpIfNot, 1, 0);
+    INS(Return, 0, 0, 0);
+    comptime_patch_jump(vm, func, at, vec_at_ComptimeFunc(vm->funcs, func)->len);
+    INS(AddInt, 3, 0, cast(UInt8)-1);
+    INS_BX(Call, 2, func);
+    INS(AddInt, 3, 0, cast(UInt8)-2);
+    INS(Move, 1, 2, 0);
+    INS_BX(Call, 2, func);
+    INS(Add, 1, 1, 2);
+    INS(Return, 1, 0, 0);
+    return func;
+}
+
+// `table(n)`: an array of `i * i ^ (i >> 3)` for `i` in `0 .. n`
+static UInt32 make_table(ComptimeVM* vm) {
+    UInt32 func = comptime_func_new(vm, "table", 1);
+    for(int i = 0; i < 5; i++)
+        comptime_new_reg(vm, func);
+    INS(NewArray, 1, 0, 0);
+    INS_BX(LoadInt, 2, 0);
+    UInt32 loop = INS(Lt, 3, 2, 0);
+    UInt32 exit = INS_BX(JumpIfNot, 3, 0);
+    INS(Mul, 4, 2, 2);
+    INS_BX(LoadInt, 5, 3);
+    INS(Shr, 5, 2, 5);
+    INS(BitXor, 4, 4, 5);
+    INS(SetIndex, 1, 2, 4);
+    INS(AddInt, 2, 2, 1);
+    UInt32 back = INS_BX(Jump, 0, 0);
+    comptime_patch_jump(vm, func, back, loop);
+    comptime_patch_jump(vm, func, exit, INS(Return, 1, 0, 0));
+    return func;
+}
+
+TEST(Comptime, table) {
+    ComptimeVM* vm = comptime_vm_new(null);
+    UInt32 table = make_table(vm);
+    ComptimeValue n = comptime_int(64 * 1024);
+    ComptimeValue result;
+    REQUIRE_EQ(comptime_call(vm, table, &n, &result), ComptimeOk);
+    ComptimeArray* array = comptime_array_of(vm, result);
+    REQUIRE_NE(array, null);
+    REQUIRE_EQ(array->len, 64 * 1024);
+    bool is_same = true;
+    for(Int64 i = 0; i < 64 * 1024; i++)
+        is_same = is_same && array->values[i].kind == ComptimeValueKindInt &&
+                  array->values[i].int_value == (i * i ^ (i >> 3));
+    CHECK_TRUE(is_same);
+    // One step per iteration
+    CHECK_EQ(vm->num_steps, 64 * 1024);
+    CHECK_EQ(vm->num_bytes, 64 * 1024 * sizeof(ComptimeValue));
+    CHECK_EQ(vec_at_ComptimeFunc(vm->funcs, table)->purity, ComptimePurityImpure);
+    comptime_vm_free(vm);
+}
+
+TEST(Comptime, memo) {
+    ComptimeVM* vm = comptime_vm_new(null);
+    UInt32 fib = make_fib(vm);
+    ComptimeValue n = comptime_int(90);
+    ComptimeValue result;
+    REQUIRE_EQ(comptime_call(vm, fib, &n, &result), ComptimeOk);
+    CHECK_EQ(result.kind, ComptimeValueKindInt);
+    CHECK_EQ(result.int_value, 2880067194370816120ll);
+    CHECK_EQ(vec_at_ComptimeFunc(vm->funcs, fib)->purity, ComptimePurityPure);
+    // Each `fib(i)` (but the first) is computed once
+    CHECK_EQ(vm->memo_len, 90);
+    CHECK_LT(vm->num_steps, 200);
+    CHECK_GT(vm->num_memo_hits, 80);
+
+    // Memoized across calls
+    UInt64 num_steps = vm->num_steps;
+    n = comptime_int(91);
+    REQUIRE_EQ(comptime_call(vm, fib, &n, &result), ComptimeOk);
+    CHECK_EQ(result.int_value, 4660046610375530309ll);
+    CHECK_EQ(vm->num_steps, num_steps + 4);
+    comptime_vm_free(vm);
+}
+
+TEST(Comptime, budget) {
+    ComptimeOptions options = { 1000, 1024 };
+    ComptimeVM* vm = comptime_vm_new(&options);
+    ComptimeValue result;
+
+    // `loop { }`
+    UInt32 func = comptime_func_new(vm, "spin", 0);
+    comptime_patch_jump(vm, func, INS_BX(Jump, 0, 0), 0);
+    CHECK_EQ(comptime_call(vm, func, null, &result), ComptimeStepLimit);
+    CHECK_STREQ(vm->error_func, "spin");
+    CHECK_EQ(vm->num_steps, 1001);
+
+    // 1024 bytes is 64 values
+    UInt32 table = make_table(vm);
+    ComptimeValue n = comptime_int(64);
+    CHECK_EQ(comptime_call(vm, table, &n, &result), ComptimeOk);
+    n = comptime_int(1);
+    CHECK_EQ(comptime_call(vm, table, &n, &result), ComptimeMemoryLimit);
+    n = comptime_int(-1);
+    CHECK_EQ(comptime_call(vm, table, &n, &result), ComptimeTypeError);
+    comptime_vm_free(vm);
+
+    // `f(n) = f(n + 1)`, with an array (so it isn't memoized)
+    options.max_steps = 0;
+    vm = comptime_vm_new(&options);
+    func = comptime_func_new(vm, "deep", 1);
+    comptime_new_reg(vm, func);
+    comptime_new_reg(vm, func);
+    INS(Len, 1, 0, 0);
+    INS(Move, 2, 0, 0);
+    INS_BX(Call, 1, func);
+    INS(Return, 1, 0, 0);
+    UInt32 deep = func;
+    func = comptime_func_new(vm, "main", 0);
+    comptime_new_reg(vm, func);
+    comptime_new_reg(vm, func);
+    INS_BX(LoadInt, 1, 0);
+    INS(NewArray, 1, 1, 0);
+    INS_BX(Call, 0, deep);
+    INS(Return, 0, 0, 0);
+    CHECK_EQ(comptime_call(vm, func, null, &result), ComptimeStackOverflow);
+    CHECK_STREQ(vm->error_func, "deep");
+    comptime_vm_free(vm);
+}
+
+// Evaluate the initializer of the first variable of `source`, as parsed (without folding)
+static ComptimeResult eval(const char* source, ComptimeValue* result) {
+    Lexer* lexer = lexer_init(cast(char*)source, null);
+    lexer_lex(lexer);
+    Parser* parser = parser_init(lexer);
+    parser->fold_constants = false;
+    ComptimeResult status = ComptimeNotConstant;
+    if(parser_parse(parser)) {
+        AstNode* node = cast(AstNode*)vec_at(parser->nodelist, 0);
+        ComptimeVM* vm = comptime_vm_new(null);
+        UInt32 func;
+        status = comptime_compile_expr(vm, node->data.scope_obj->var->init_expr, &func);
+        if(status == ComptimeOk)
+            status = comptime_call(vm, func, null, result);
+        comptime_vm_free(vm);
+    }
+    parser_free(parser);
+    return status;
+}
+
+TEST(Comptime, exprs) {
+    ComptimeValue value;
+    REQUIRE_EQ(eval("put int a = (2 + 3) * -4", &value), ComptimeOk);
+    CHECK_EQ(value.kind, ComptimeValueKindInt);
+    CHECK_EQ(value.int_value, -20);
+    REQUIRE_EQ(eval("put int a = 1 << 12 | 0x40 & 100000 % 7", &value), ComptimeOk);
+    CHECK_EQ(value.int_value, 1 << 12 | (0x40 & 100000 % 7));
+    REQUIRE_EQ(eval("put int a = -9223372036854775807 - 1", &value), ComptimeOk);
+    CHECK_EQ(value.int_value, Int64_MIN);
+    REQUIRE_EQ(eval("put float a = 1.5 * 2 - 1", &value), ComptimeOk);
+    CHECK_EQ(value.kind, ComptimeValueKindFloat);
+    CHECK_EQ(value.float_value, 2.0);
+    REQUIRE_EQ(eval("put bool a = (3 > 4) | (2 >= 2) & not (1 == 2)", &value), ComptimeOk);
+    CHECK_EQ(value.kind, ComptimeValueKindBool);
+    CHECK_TRUE(value.bool_value);
+
+    REQUIRE_EQ(eval("put int a = !0 + 2", &value), ComptimeOk);
+    CHECK_EQ(value.int_value, 1);
+
+    CHECK_EQ(eval("put int a = 1 / (2 - 2)", &value), ComptimeDivisionByZero);
+    CHECK_EQ(eval("put int a = (1 < 2) + 1", &value), ComptimeTypeError);
+    CHECK_EQ(eval("put int a = x + 1", &value), ComptimeNotConstant);
+    CHECK_STREQ(comptime_result_str(ComptimeStepLimit), "too many steps (an infinite loop?)");
+}
@@ -0,0 +1,138 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+TEST(Diagnostics, report) {
+    Diagnostics* diags = diagnostics_new(0);
+    CHECK_EQ(diags->max_errors, DIAGNOSTICS_DEFAULT_MAX_ERRORS);
+
+    Buff* fname = buff_new("foo.ad");
+    Location loc = { 3, 7, fname };
+    CHECK(diagnostics_report(diags, DiagnosticLevelError, ErrorParseError, loc, 10, 12, "Expected `%s`", "}"));
+    CHECK(diagnostics_report(diags, DiagnosticLevelWarning, ErrorNone, loc, 12, 12, "unused"));
+    // Names and messages are copied
+    buff_free(fname);
+
+    REQUIRE_EQ(diags->len, 2);
+    CHECK_EQ(diags->num_errors, 1);
+    CHECK_EQ(diags->items[0].level, DiagnosticLevelError);
+    CHECK_EQ(diags->items[0].err, ErrorParseError);
+    CHECK_EQ(diags->items[0].begin, 10);
+    CHECK_EQ(diags->items[0].end, 12);
+    CHECK_EQ(diags->items[0].line, 3);
+    CHECK_EQ(diags->items[0].col, 7);
+    CHECK_STREQ(diags->items[0].fname, "foo.ad");
+    CHECK_STREQ(diags->items[0].message, "Expected `}`");
+    CHECK_EQ(diags->items[1].level, DiagnosticLevelWarning);
+    CHECK_STREQ(diags->items[1].message, "unused");
+
+    diagnostics_free(diags);
+}
+
+TEST(Diagnostics, max_errors) {
+    Diagnostics* diags = diagnostics_new(5);
+    Location loc = { 1, 1, null };
+    for(UInt32 i = 0; i < 100; i++) {
+        bool is_kept = diagnostics_report(diags, DiagnosticLevelError, ErrorSyntaxError, loc, i, i + 1, "error %u", i);
+        CHECK_EQ(is_kept, i < 5);
+        CHECK_EQ(diagnostics_is_full(diags), i >= 4);
+    }
+    CHECK_EQ(diags->len, 5);
+    CHECK_EQ(diags->num_errors, 5);
+    CHECK_EQ(diags->num_dropped, 95);
+    CHECK_STREQ(diags->items[4].message, "error 4");
+    CHECK_STREQ(diags->items[4].fname, "");
+
+    // Warnings don't count toward the cap
+    CHECK(diagnostics_report(diags, DiagnosticLevelWarning, ErrorNone, loc, 0, 0, "still kept"));
+    CHECK_EQ(diags->len, 6);
+    diagnostics_free(diags);
+}
+
+// What `diags` renders to in `format`
+static char* render(Diagnostics* diags, DiagnosticsFormat format) {
+    FILE* stream = tmpfile();
+    diagnostics_render(diags, format, stream);
+    long len = ftell(stream);
+    char* data = cast(char*)calloc(cast(UInt64)len + 1, 1);
+    rewind(stream);
+    fread(data, 1, cast(UInt64)len, stream);
+    fclose(stream);
+    return data;
+}
+
+TEST(Diagnostics, sort) {
+    Diagnostics* diags = diagnostics_new(0);
+    Buff* b = buff_new("b.ad");
+    Buff* a = buff_new("a.ad");
+    Location loc_b = { 1, 1, b };
+    Location loc_a = { 1, 1, a };
+    diagnostics_report(diags, DiagnosticLevelError, ErrorSyntaxError, loc_b, 8, 9, "second");
+    diagnostics_report(diags, DiagnosticLevelError, ErrorSyntaxError, loc_b, 2, 3, "first");
+    diagnostics_report(diags, DiagnosticLevelError, ErrorParseError, loc_a, 5, 6, "in a");
+    // A duplicate (reported twice, eg. by two passes over the file)
+    diagnostics_report(diags, DiagnosticLevelError, ErrorSyntaxError, loc_b, 2, 3, "first");
+    diagnostics_report(diags, DiagnosticLevelNote, ErrorNone, loc_b, 2, 3, "about first");
+    buff_free(a);
+    buff_free(b);
+    // A file name is stored once
+    CHECK_EQ(diags->num_files, 2);
+    CHECK_EQ(diags->items[0].file, diags->items[1].file);
+    CHECK_EQ(diags->items[0].fname, diags->items[1].fname);
+
+    diagnostics_sort(diags);
+    REQUIRE_EQ(diags->len, 4);
+    CHECK_EQ(diags->num_errors, 3);
+    CHECK_STREQ(diags->items[0].message, "in a");
+    CHECK_STREQ(diags->items[1].message, "first");
+    CHECK_STREQ(diags->items[2].message, "about first");
+    CHECK_STREQ(diags->items[3].message, "second");
+    diagnostics_free(diags);
+}
+
+TEST(Diagnostics, render) {
+    const char* source = "module m\n\tput int $x = 1\n";
+    Diagnostics* diags = diagnostics_new(0);
+    diagnostics_set_source(diags, "m.ad", source, cast(UInt32)strlen(source));
+    Buff* fname = buff_new("m.ad");
+    Location loc = { 2, 10, fname };
+    diagnostics_report(diags, DiagnosticLevelError, ErrorSyntaxError, loc, 18, 20, "Invalid character `$`");
+    buff_free(fname);
+
+    char* text = render(diags, DiagnosticsFormatPlain);
+    CHECK_STREQ(text, "SyntaxError: Invalid character `$` at m.ad:2:10\n"
+                      "    2 | \tput int $x = 1\n"
+                      "      | \t        ^~\n");
+    free(text);
+    text = render(diags, DiagnosticsFormatText);
+    CHECK_NOT_NULL(strstr(text, "\033[1;31mSyntaxError: "));
+    CHECK_NOT_NULL(strstr(text, "\033[1;32m^~\033[0m"));
+    free(text);
+    diagnostics_free(diags);
+}
+
+TEST(Diagnostics, json) {
+    Diagnostics* diags = diagnostics_new(1);
+    Location loc = { 1, 2, null };
+    diagnostics_report(diags, DiagnosticLevelError, ErrorUnexpectedToken, loc, 1, 2, "Expected `\"`\t(or \\)");
+    diagnostics_report(diags, DiagnosticLevelError, ErrorUnexpectedToken, loc, 3, 4, "dropped");
+    diagnostics_report(diags, DiagnosticLevelWarning, ErrorNone, loc, 0, 0, "a warning");
+    char* json = render(diags, DiagnosticsFormatJson);
+    CHECK_STREQ(json, "{\"diagnostics\": [\n"
+                      "  {\"level\": \"warning\", \"code\": null, \"file\": \"\", \"line\": 1, \"col\": 2, \"begin\": 0, "
+                      "\"end\": 0, \"message\": \"a warning\"},\n"
+                      "  {\"level\": \"error\", \"code\": \"UnexpectedTokenError\", \"file\": \"\", \"line\": 1, \"col\": 2, "
+                      "\"begin\": 1, \"end\": 2, \"message\": \"Expected `\\\"`\\t(or \\\\)\"}\n"
+                      "], \"num_dropped\": 1}\n");
+    free(json);
+
+    // An error storm prints in a few writes (and one pass)
+    Diagnostics* storm = diagnostics_new(100000);
+    for(UInt32 i = 0; i < 100000; i++)
+        diagnostics_report(storm, DiagnosticLevelError, ErrorSyntaxError, loc, 100000 - i, 100001 - i, "error %u", i);
+    json = render(storm, DiagnosticsFormatJson);
+    CHECK_NOT_NULL(strstr(json, "\"begin\": 1, \"end\": 2, \"message\": \"error 99999\"},\n"));
+    free(json);
+    diagnostics_free(storm);
+    diagnostics_free(diags);
+}
@@ -0,0 +1,169 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+static FoldValue int_value(Int64 value) {
+    FoldValue result = { .kind = FoldValueKindInt, .is_negative = value < 0 };
+    result.magnitude = value < 0 ? ~cast(UInt64)value + 1 : cast(UInt64)value;
+    return result;
+}
+
+// Fold `lhs op rhs` (ints), returning the result as an Int64
+static Int64 fold_ints(BinaryOpKind op, Int64 lhs, Int64 rhs, FoldResult* result) {
+    FoldValue a = int_value(lhs), b = int_value(rhs), value = {0};
+    *result = fold_binary_op(op, &a, &b, &value);
+    return value.is_negative ? -cast(Int64)(value.magnitude - 1) - 1 : cast(Int64)value.magnitude;
+}
+
+TEST(Fold, ints) {
+    // Every operator, against C's (Int64) semantics
+    Int64 values[] = { 0, 1, -1, 7, -7, 3, -3, 1000, Int32_MAX, Int32_MIN, 123456789 };
+    UInt32 num_values = sizeof(values) / sizeof(values[0]);
+    for(UInt32 i = 0; i < num_values; i++) {
+        for(UInt32 j = 0; j < num_values; j++) {
+            Int64 a = values[i], b = values[j];
+            FoldResult result;
+            CHECK_EQ(fold_ints(BinaryOpKindAdd, a, b, &result), a + b);
+            CHECK_EQ(fold_ints(BinaryOpKindSubtract, a, b, &result), a - b);
+            CHECK_EQ(fold_ints(BinaryOpKindMult, a, b, &result), a * b);
+            CHECK_EQ(fold_ints(BinaryOpKindBitAnd, a, b, &result), a & b);
+            CHECK_EQ(fold_ints(BinaryOpKindBitOr, a, b, &result), a | b);
+            CHECK_EQ(fold_ints(BinaryOpKindBitXor, a, b, &result), a ^ b);
+            if(b != 0) {
+                CHECK_EQ(fold_ints(BinaryOpKindDiv, a, b, &result), a / b);
+                CHECK_EQ(fold_ints(BinaryOpKindMod, a, b, &result), a % b);
+            } else {
+                fold_ints(BinaryOpKindDiv, a, b, &result);
+                CHECK_EQ(result, FoldDivisionByZero);
+            }
+            if(b >= 0 && b < 32) {
+                CHECK_EQ(fold_ints(BinaryOpKindBitshitRight, a, b, &result), a >> b);
+                CHECK_EQ(fold_ints(BinaryOpKindBitshitLeft, a, b, &result), a * (cast(Int64)1 << b));
+            }
+            FoldValue x = int_value(a), y = int_value(b), value;
+            fold_binary_op(BinaryOpKindCmpLessThan, &x, &y, &value);
+            CHECK_EQ(value.kind, FoldValueKindBool);
+            CHECK_EQ(value.bool_value, a < b);
+        }
+    }
+}
+
+TEST(Fold, ranges) {
+    FoldResult result;
+    // [Int64 min, UInt64 max]
+    CHECK_EQ(fold_ints(BinaryOpKindSubtract, -Int64_MAX, 1, &result), Int64_MIN);
+    CHECK_EQ(result, FoldOk);
+    fold_ints(BinaryOpKindSubtract, Int64_MIN, 1, &result);
+    CHECK_EQ(result, FoldOutOfRange);
+    fold_ints(BinaryOpKindMult, Int64_MIN, -1, &result);
+    CHECK_EQ(result, FoldOk);
+    fold_ints(BinaryOpKindMult, Int64_MAX, 4, &result);
+    CHECK_EQ(result, FoldOutOfRange);
+    fold_ints(BinaryOpKindBitshitLeft, 1, 64, &result);
+    CHECK_EQ(result, FoldOutOfRange);
+    fold_ints(BinaryOpKindBitshitLeft, 1, -1, &result);
+    CHECK_EQ(result, FoldNotConstant);
+
+    FoldValue max = { .kind = FoldValueKindInt, .magnitude = UInt64_MAX }, one = int_value(1), value;
+    CHECK_EQ(fold_binary_op(BinaryOpKindAdd, &max, &one, &value), FoldOutOfRange);
+    CHECK_EQ(fold_binary_op(BinaryOpKindSubtract, &max, &one, &value), FoldOk);
+    CHECK_EQ(value.magnitude, UInt64_MAX - 1);
+
+    // The type of a constant is the smallest that holds it
+    FoldValue values[] = { 
+        int_value(0), int_value(Int32_MAX), int_value(Int32_MIN), int_value(cast(Int64)Int32_MAX + 1), 
+        int_value(Int64_MIN), max 
+    };
+    AdoradTypes types[] = { 
+        AdoradTypeInt, AdoradTypeInt, AdoradTypeInt, AdoradTypeInt64, AdoradTypeInt64, AdoradTypeUInt64 
+    };
+    for(UInt32 i = 0; i < 6; i++)
+        CHECK_EQ(fold_value_type(&values[i]), types[i]);
+
+    FoldValue big = { .kind = FoldValueKindFloat, .float_value = 1e300 };
+    CHECK_EQ(fold_value_type(&big), AdoradTypeFloat64);
+    CHECK_EQ(fold_binary_op(BinaryOpKindMult, &big, &big, &value), FoldOutOfRange);
+    CHECK_EQ(fold_binary_op(BinaryOpKindAdd, &big, &one, &value), FoldOk);
+    CHECK_EQ(value.kind, FoldValueKindFloat);
+
+    // Bools don't mix with numbers
+    FoldValue yes = { .kind = FoldValueKindBool, .bool_value = true };
+    CHECK_EQ(fold_binary_op(BinaryOpKindAdd, &yes, &one, &value), FoldNotConstant);
+    CHECK_EQ(fold_prefix_op(PrefixOpKindBoolNot, &yes, &value), FoldOk);
+    CHECK_FALSE(value.bool_value);
+    CHECK_EQ(fold_prefix_op(PrefixOpKindAddrOf, &one, &value), FoldNotConstant);
+}
+
+// The initializer of the `index`th (top-level) variable
+#define INIT_EXPR(parser, index)    \
+    ((cast(AstNode*)vec_at((parser)->nodelist, (index)))->data.scope_obj->var->init_expr)
+
+TEST(Fold, parser) {
+    char* buffer = 
+        "put int a = 1 << 12 | 0x40\n"
+        "put int b = (2 + 3) * -4\n"
+        "put int c = !0\n"
+        "put int d = 9223372036854775807 + 1\n"
+        "put float e = 1.5 * 2 - .5\n"
+        "put int f = (1 < 2) & (3 > 4)\n"
+        "put int g = x + 1 + 2\n";
+    Lexer* lexer = lexer_init(buffer, null);
+    lexer_lex(lexer);
+    Parser* parser = parser_init(lexer);
+    REQUIRE(parser_parse(parser));
+    REQUIRE_EQ(vec_size(parser->nodelist), 7);
+
+    AstNode* a = INIT_EXPR(parser, 0);
+    REQUIRE_EQ(a->kind, AstNodeKindIntLiteral);
+    CHECK_EQ(a->data.literal->int_value->number, (1 << 12) | 0x40);
+    CHECK_EQ(a->data.literal->int_value->type, AstNodeIntegerLiteral32);
+    AstNode* b = INIT_EXPR(parser, 1);
+    REQUIRE_EQ(b->kind, AstNodeKindIntLiteral);
+    CHECK_EQ(cast(Int64)b->data.literal->int_value->number, -20);
+    AstNode* c = INIT_EXPR(parser, 2);
+    REQUIRE_EQ(c->kind, AstNodeKindIntLiteral);
+    CHECK_EQ(cast(Int64)c->data.literal->int_value->number, -1);
+    AstNode* d = INIT_EXPR(parser, 3);
+    REQUIRE_EQ(d->kind, AstNodeKindIntLiteral);
+    CHECK_EQ(d->data.literal->int_value->number, cast(UInt64)1 << 63);
+    CHECK_EQ(d->data.literal->int_value->type, AstNodeUIntLiteral64);
+    AstNode* e = INIT_EXPR(parser, 4);
+    REQUIRE_EQ(e->kind, AstNodeKindFloatLiteral);
+    CHECK_EQ(e->data.literal->float_value->number, 2.5);
+    AstNode* f = INIT_EXPR(parser, 5);
+    REQUIRE_EQ(f->kind, AstNodeKindBoolLiteral);
+    CHECK_FALSE(f->data.literal->bool_value->value);
+    // `(x + 1) + 2` has no constant subexpression
+    AstNode* g = INIT_EXPR(parser, 6);
+    REQUIRE_EQ(g->kind, AstNodeKindBinaryOpExpr);
+    CHECK_EQ(g->data.expr->binary_op_expr->rhs->kind, AstNodeKindIntLiteral);
+    CHECK_EQ(g->data.expr->binary_op_expr->lhs->kind, AstNodeKindBinaryOpExpr);
+    parser_free(parser);
+
+    // Folding is optional
+    lexer = lexer_init("put int a = 1 + 2", null);
+    lexer_lex(lexer);
+    parser = parser_init(lexer);
+    parser->fold_constants = false;
+    REQUIRE(parser_parse(parser));
+    CHECK_EQ(INIT_EXPR(parser, 0)->kind, AstNodeKindBinaryOpExpr);
+    parser_free(parser);
+
+    // Out of range constants are errors
+    lexer = lexer_init("put int a = 1 << 64\nput int b = 1 / 0\nput int c = 1e308 * 10\n", null);
+    Diagnostics* diags = diagnostics_new(0);
+    lexer_set_diagnostics(lexer, diags);
+    lexer_lex(lexer);
+    parser = parser_init(lexer);
+    CHECK_FALSE(parser_parse(parser));
+    REQUIRE_EQ(diags->num_errors, 3);
+    CHECK_EQ(diags->items[0].err, ErrorLiteralOutOfRange);
+    CHECK_EQ(diags->items[0].line, 1);
+    CHECK_EQ(diags->items[0].col, 15);
+    CHECK_STREQ(diags->items[1].message, "Division by zero in a constant expression");
+    CHECK_EQ(diags->items[1].line, 2);
+    CHECK_EQ(diags->items[2].err, ErrorLiteralOutOfRange);
+    CHECK_EQ(diags->items[2].line, 3);
+    parser_free(parser);
+    diagnostics_free(diags);
+}
@@ -0,0 +1,153 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+#define NUM_FILES   24
+
+// Write file `i` of the test module: every 5th file has an error, and files are of very different sizes
+static void write_file(char* fname, UInt32 i) {
+    sprintf(fname, "__frontend_test_%u.ad", i);
+    FILE* file = fopen(fname, "wb");
+    fprintf(file, "module m%u\n", i);
+    for(UInt32 j = 0; j < (i % 3 == 0 ? 500 : 5); j++)
+        fprintf(file, "use dep%u\n", j);
+    if(i % 5 == 0)
+        fprintf(file, "use ;\n");
+    fclose(file);
+}
+
+TEST(Frontend, run) {
+    char names[NUM_FILES][64];
+    const char* fnames[NUM_FILES + 1];
+    for(UInt32 i = 0; i < NUM_FILES; i++) {
+        write_file(names[i], i);
+        fnames[i] = names[i];
+    }
+    fnames[NUM_FILES] = "__frontend_test_missing.ad";
+
+    Frontend* expected = frontend_run(fnames, NUM_FILES + 1, 1, 0, false);
+    CHECK_EQ(expected->num_threads, 1);
+    CHECK_EQ(expected->num_steals, 0);
+    CHECK_FALSE(expected->ok);
+    for(UInt32 i = 0; i < NUM_FILES; i++) {
+        FrontendFile* file = &expected->files[i];
+        REQUIRE_NE(file->parser, null);
+        CHECK_EQ(file->parser->id, i);
+        CHECK_EQ(file->ok, i % 5 != 0);
+        CHECK_EQ(vec_size(file->parser->nodelist), i % 3 == 0 ? 501 : 6);
+    }
+    CHECK_NULL(expected->files[NUM_FILES].parser);
+    CHECK_FALSE(expected->files[NUM_FILES].ok);
+    // One error per bad file, and one for the missing one - in file order
+    REQUIRE_EQ(expected->diags->len, NUM_FILES / 5 + 1 + 1);
+    for(UInt32 i = 0; i < expected->diags->len - 1; i++)
+        CHECK_STREQ(expected->diags->items[i].fname, fnames[i * 5]);
+    CHECK_EQ(expected->diags->items[expected->diags->len - 1].err, ErrorFileNotFound);
+
+    // Results don't depend on the number of threads
+    UInt32 counts[] = { 2, 4, 0 };
+    for(UInt32 t = 0; t < sizeof(counts) / sizeof(counts[0]); t++) {
+        Frontend* frontend = frontend_run(fnames, NUM_FILES + 1, counts[t], 0, false);
+        CHECK_EQ(frontend->ok, expected->ok);
+        for(UInt32 i = 0; i <= NUM_FILES; i++) {
+            CHECK_EQ(frontend->files[i].ok, expected->files[i].ok);
+            if(SOME(expected->files[i].parser))
+                CHECK_EQ(vec_size(frontend->files[i].parser->nodelist), vec_size(expected->files[i].parser->nodelist));
+        }
+        REQUIRE_EQ(frontend->diags->len, expected->diags->len);
+        for(UInt32 i = 0; i < frontend->diags->len; i++) {
+            CHECK_STREQ(frontend->diags->items[i].fname, expected->diags->items[i].fname);
+            CHECK_STREQ(frontend->diags->items[i].message, expected->diags->items[i].message);
+            CHECK_EQ(frontend->diags->items[i].begin, expected->diags->items[i].begin);
+        }
+        frontend_free(frontend);
+    }
+
+    frontend_free(expected);
+    for(UInt32 i = 0; i < NUM_FILES; i++)
+        remove(names[i]);
+}
+
+TEST(Frontend, shared_interner) {
+    char names[4][64];
+    const char* fnames[4];
+    for(UInt32 i = 0; i < 4; i++) {
+        write_file(names[i], i + 1);
+        fnames[i] = names[i];
+    }
+    Frontend* frontend = frontend_run(fnames, 4, 4, 0, false);
+    CHECK_TRUE(frontend->ok);
+    // `use dep0` (the 2nd node) is the same name in every file
+    SymbolId dep0 = interner_find(frontend->interner, "dep0", 4);
+    CHECK_NE(dep0, SYMBOL_NULL);
+    for(UInt32 i = 0; i < 4; i++) {
+        Parser* parser = frontend->files[i].parser;
+        REQUIRE_NE(parser, null);
+        CHECK_EQ(parser->interner, frontend->interner);
+        CHECK_EQ((cast(AstNode*)vec_at(parser->nodelist, 1))->data.stmt->use_stmt->name, dep0);
+    }
+    frontend_free(frontend);
+    for(UInt32 i = 0; i < 4; i++)
+        remove(names[i]);
+}
+
+TEST(Frontend, large_file) {
+    // Large enough to be lexed in chunks (on the Frontend's threads), next to a small file
+    char small[64];
+    write_file(small, 1);
+    const char* fnames[] = { "__frontend_test_large.ad", small };
+    FILE* file = fopen(fnames[0], "wb");
+    fprintf(file, "module large\n");
+    for(UInt32 j = 0; j < 4 * LEXER_PARALLEL_MIN_CHUNK / 8; j++)
+        fprintf(file, "use d%u\n", j);
+    fclose(file);
+
+    Frontend* expected = frontend_run(fnames, 2, 1, 0, false);
+    Frontend* frontend = frontend_run(fnames, 2, 2, 0, false);
+    CHECK_TRUE(expected->ok);
+    CHECK_TRUE(frontend->ok);
+    Lexer* exp = expected->files[0].lexer;
+    Lexer* lexer = frontend->files[0].lexer;
+    REQUIRE_EQ(vec_size(lexer->toklist), vec_size(exp->toklist));
+    for(UInt64 i = 0; i < vec_size(lexer->toklist); i++) {
+        Token* token = cast(Token*)vec_at(lexer->toklist, i);
+        Token* exp_token = cast(Token*)vec_at(exp->toklist, i);
+        CHECK_EQ(token->kind, exp_token->kind);
+        CHECK_EQ(token->offset, exp_token->offset);
+        CHECK_EQ(token->len, exp_token->len);
+    }
+    frontend_free(expected);
+    frontend_free(frontend);
+    remove(fnames[0]);
+    remove(fnames[1]);
+}
+
+TEST(Frontend, unreadable_file) {
+    // A directory is reported like a missing file would be (rather than exiting), and the other files are still read
+    char name[64];
+    write_file(name, 1);
+    const char* fnames[] = { name, "." };
+    Frontend* frontend = frontend_run(fnames, 2, 2, 0, false);
+    CHECK_FALSE(frontend->ok);
+    CHECK_TRUE(frontend->files[0].ok);
+    CHECK_NULL(frontend->files[1].parser);
+    REQUIRE_EQ(frontend->diags->len, 1);
+    CHECK_EQ(frontend->diags->items[0].err, ErrorFileNotReadable);
+    CHECK_STREQ(frontend->diags->items[0].fname, ".");
+    CHECK_NE(strstr(frontend->diags->items[0].message, "Cannot open file: "), null);
+    frontend_free(frontend);
+    remove(name);
+}
+
+TEST(Frontend, merge_max_errors) {
+    const char* fnames[] = { "__frontend_test_missing_0.ad", "__frontend_test_missing_1.ad", 
+                             "__frontend_test_missing_2.ad" };
+    Frontend* frontend = frontend_run(fnames, 3, 0, 2, false);
+    CHECK_FALSE(frontend->ok);
+    CHECK_EQ(frontend->diags->len, 2);
+    CHECK_EQ(frontend->diags->num_errors, 2);
+    CHECK_EQ(frontend->diags->num_dropped, 1);
+    CHECK_STREQ(frontend->diags->items[0].fname, fnames[0]);
+    CHECK_STREQ(frontend->diags->items[1].fname, fnames[1]);
+    frontend_free(frontend);
+}
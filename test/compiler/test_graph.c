@@ -0,0 +1,165 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+#include <sys/stat.h>
+#if defined(_WIN32)
+    #include <direct.h>
+    #define make_dir(path)  _mkdir(path)
+#else
+    #define make_dir(path)  mkdir(path, 0755)
+#endif
+TAU_MAIN()
+
+static void write_source(const char* fname, const char* source) {
+    FILE* file = fopen(fname, "wb");
+    fputs(source, file);
+    fclose(file);
+}
+
+static UInt64 interface_of(const char* source) {
+    Lexer* lexer = lexer_init(cast(char*)source, null);
+    lexer_lex(lexer);
+    UInt64 hash = graph_interface_hash(lexer);
+    lexer_free(lexer);
+    return hash;
+}
+
+TEST(Graph, interface_hash) {
+    UInt64 hash = interface_of("module a\nexport func f(x int) { return x }\n");
+    // Function bodies, private declarations and whitespace aren't part of it
+    CHECK_EQ(interface_of("module a\nexport func f(x int) { return x + 1 }\n"), hash);
+    CHECK_EQ(interface_of("module a\nuse b\n\n\nexport func f(x int) {\n}\nfunc g() { }\n"), hash);
+    CHECK_NE(interface_of("module a\nexport func f(x uint) { return x }\n"), hash);
+    CHECK_NE(interface_of("module a\nexport func f(x int) { return x }\nexport func g() { }\n"), hash);
+    CHECK_NE(interface_of("module a\nexport inline func f(x int) { return x }\n"), hash);
+}
+
+TEST(Graph, incremental) {
+    make_dir("__graph");
+    make_dir("__graph/io");
+    make_dir("__graph/net");
+    write_source("__graph/io/file.ad", "module io\n");
+    write_source("__graph/net/http.ad", "module net\nuse io\n");
+    write_source("__graph/main.ad", "use net\n");
+
+    GraphBuildReport report;
+    ModuleGraph* graph = module_graph_build(null, "__graph", null, &report);
+    REQUIRE_NE(graph, null);
+    CHECK_TRUE(report.ok);
+    CHECK_EQ(report.num_files, 3);
+    CHECK_EQ(report.num_modules, 3);
+    CHECK_EQ(report.num_rebuilt_modules, 3);
+    CHECK_EQ(report.num_hashed, 3);
+    CHECK_EQ(report.num_waves, 1);
+    GraphFile* http = module_graph_find_file(graph, "__graph/net/http.ad");
+    REQUIRE_NE(http, null);
+    CHECK_STREQ(http->module, "net");
+    REQUIRE_EQ(vec_size(http->uses), 1);
+    CHECK_STREQ(*cast(char**)vec_at(http->uses, 0), "io");
+    CHECK_NE(module_graph_find_module(graph, BUILD_DEFAULT_MODULE), null);
+    diagnostics_free(report.diags);
+
+    // Nothing changed: nothing is read, nothing is built
+    ModuleGraph* next = module_graph_build(graph, "__graph", null, &report);
+    CHECK_EQ(report.num_hashed, 0);
+    CHECK_EQ(report.num_rebuilt_modules, 0);
+    CHECK_EQ(report.num_waves, 0);
+    diagnostics_free(report.diags);
+    module_graph_free(graph);
+    graph = next;
+
+    // A private edit rebuilds only its module
+    write_source("__graph/io/file.ad", "module io\n\n// now with a comment\n");
+    next = module_graph_build(graph, "__graph", null, &report);
+    CHECK_EQ(report.num_hashed, 1);
+    CHECK_EQ(report.num_rebuilt_modules, 1);
+    CHECK_EQ(report.num_waves, 1);
+    diagnostics_free(report.diags);
+    module_graph_free(graph);
+    graph = next;
+
+    // A change to what `io` exports rebuilds `net` too (which uses it), but not `main` (which doesn't)
+    write_source("__graph/io/file.ad", "module io\nexport func\n");
+    next = module_graph_build(graph, "__graph", null, &report);
+    CHECK_FALSE(report.ok);
+    CHECK_EQ(report.num_rebuilt_modules, 2);
+    CHECK_EQ(report.num_rebuilt_files, 2);
+    CHECK_EQ(report.num_waves, 2);
+    CHECK_GT(report.diags->num_errors, 0);
+    diagnostics_free(report.diags);
+    module_graph_free(graph);
+    graph = next;
+    CHECK_FALSE(module_graph_find_module(graph, "io")->ok);
+    CHECK_TRUE(module_graph_find_module(graph, "net")->ok);
+
+    // A module with errors is rebuilt until it has none
+    write_source("__graph/io/file.ad", "module io\n");
+    next = module_graph_build(graph, "__graph", null, &report);
+    CHECK_TRUE(report.ok);
+    CHECK_EQ(report.num_rebuilt_modules, 2);
+    diagnostics_free(report.diags);
+    module_graph_free(graph);
+    graph = next;
+
+    // Removing a module rebuilds its users (which now use a module that doesn't exist)
+    remove("__graph/io/file.ad");
+    next = module_graph_build(graph, "__graph", null, &report);
+    CHECK_FALSE(report.ok);
+    CHECK_EQ(report.num_files, 2);
+    CHECK_EQ(report.num_rebuilt_modules, 1);
+    CHECK_NULL(module_graph_find_module(next, "io"));
+    CHECK_FALSE(module_graph_find_module(next, "net")->ok);
+    diagnostics_free(report.diags);
+    module_graph_free(graph);
+    module_graph_free(next);
+
+    CHECK_NULL(module_graph_build(null, "__graph/missing", null, &report));
+    remove("__graph/net/http.ad");
+    remove("__graph/main.ad");
+    rmdir("__graph/io");
+    rmdir("__graph/net");
+    rmdir("__graph");
+}
+
+TEST(Graph, save_load) {
+    make_dir("__graph_save");
+    write_source("__graph_save/a.ad", "module saved\nuse saved\n");
+    GraphBuildReport report;
+    ModuleGraph* graph = module_graph_build(null, "__graph_save", null, &report);
+    REQUIRE_NE(graph, null);
+    diagnostics_free(report.diags);
+    GraphFile* file = module_graph_find_file(graph, "__graph_save/a.ad");
+    REQUIRE_NE(file, null);
+    REQUIRE_TRUE(module_graph_save(graph, "__graph_saved"));
+
+    ModuleGraph* loaded = module_graph_load("__graph_saved");
+    REQUIRE_NE(loaded, null);
+    CHECK_EQ(vec_size(loaded->files), vec_size(graph->files));
+    CHECK_EQ(vec_size(loaded->modules), vec_size(graph->modules));
+    GraphFile* copy = module_graph_find_file(loaded, "__graph_save/a.ad");
+    REQUIRE_NE(copy, null);
+    CHECK_STREQ(copy->module, "saved");
+    CHECK_EQ(copy->hash, file->hash);
+    CHECK_EQ(copy->interface, file->interface);
+    CHECK_EQ(copy->info.size, file->info.size);
+    CHECK_EQ(copy->info.mtime_ns, file->info.mtime_ns);
+    CHECK_EQ(copy->ok, file->ok);
+    REQUIRE_EQ(vec_size(copy->uses), 1);
+    CHECK_STREQ(*cast(char**)vec_at(copy->uses, 0), "saved");
+    CHECK_EQ(module_graph_find_module(loaded, "saved")->interface, module_graph_find_module(graph, "saved")->interface);
+    module_graph_free(loaded);
+    module_graph_free(graph);
+
+    // A corrupt (or truncated) graph isn't loaded
+    FILE* stream = fopen("__graph_saved", "r+b");
+    REQUIRE_NE(stream, null);
+    fseek(stream, 14, SEEK_SET);
+    fputc('#', stream);
+    fclose(stream);
+    CHECK_NULL(module_graph_load("__graph_saved"));
+    write_source("__graph_saved", "AADG");
+    CHECK_NULL(module_graph_load("__graph_saved"));
+    CHECK_NULL(module_graph_load("__graph_missing"));
+    remove("__graph_saved");
+    remove("__graph_save/a.ad");
+    rmdir("__graph_save");
+}
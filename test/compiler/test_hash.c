@@ -0,0 +1,74 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+TEST(Hash, crc32c) {
+    // The standard check value (and RFC 3720's test vectors)
+    CHECK_EQ(hash_crc32c("123456789", 9), 0xE3069283);
+    CHECK_EQ(hash_crc32c("", 0), 0);
+    UInt8 zeros[32] = {0};
+    UInt8 ones[32];
+    memset(ones, 0xFF, sizeof(ones));
+    CHECK_EQ(hash_crc32c(zeros, 32), 0x8A9136AA);
+    CHECK_EQ(hash_crc32c(ones, 32), 0x62A8AB43);
+
+    // The hardware (if the CPU has it) and software paths agree, and `hash_crc32c_update()` can be fed in pieces
+    UInt8 data[1024];
+    for(UInt32 i = 0; i < sizeof(data); i++)
+        data[i] = cast(UInt8)(i * 131 + (i >> 3));
+    for(UInt32 len = 0; len <= sizeof(data); len += 37) {
+        UInt32 crc = hash_crc32c(data, len);
+        CHECK_EQ(crc, ~__hash_crc32c_sw(~0u, data, len));
+        UInt32 half = len / 3;
+        CHECK_EQ(hash_crc32c_update(hash_crc32c(data, half), data + half, len - half), crc);
+    }
+}
+
+TEST(Hash, wyhash) {
+    UInt8 data[4096];
+    for(UInt32 i = 0; i < sizeof(data); i++)
+        data[i] = cast(UInt8)(i * 7 + (i >> 5));
+
+    // Every length (around the 16 and 48-byte thresholds in particular) hashes differently
+    CHECK_NE(hash_wyhash(data, 0, 0), hash_wyhash(data, 0, 1));
+    for(UInt32 len = 1; len < 200; len++) {
+        CHECK_NE(hash_wyhash(data, len, 0), hash_wyhash(data, len - 1, 0));
+        CHECK_EQ(hash_wyhash(data, len, 0), hash_wyhash(data, len, 0));
+    }
+    // ... and so does every byte
+    UInt64 hash = hash_wyhash(data, 100, 0);
+    for(UInt32 i = 0; i < 100; i++) {
+        data[i] ^= 1;
+        CHECK_NE(hash_wyhash(data, 100, 0), hash);
+        data[i] ^= 1;
+    }
+}
+
+TEST(Hash, wyhash_streaming) {
+    UInt8 data[4096];
+    for(UInt32 i = 0; i < sizeof(data); i++)
+        data[i] = cast(UInt8)(i * 13 + (i >> 4));
+
+    // Any split into pieces gives the same hash as hashing it all at once
+    UInt32 lens[] = { 0, 1, 3, 4, 15, 16, 17, 47, 48, 49, 95, 96, 97, 100, 1000, 4096 };
+    UInt32 pieces[] = { 1, 5, 16, 47, 48, 49, 200 };
+    for(UInt32 l = 0; l < sizeof(lens) / sizeof(lens[0]); l++) {
+        UInt32 len = lens[l];
+        UInt64 expected = hash_wyhash(data, len, 42);
+        for(UInt32 p = 0; p < sizeof(pieces) / sizeof(pieces[0]); p++) {
+            HashWyState state;
+            hash_wyhash_init(&state, 42);
+            for(UInt32 i = 0; i < len; i += pieces[p])
+                hash_wyhash_update(&state, data + i, len - i < pieces[p] ? len - i : pieces[p]);
+            CHECK_EQ(hash_wyhash_final(&state), expected);
+        }
+        // A small piece, and then all the rest
+        if(len > 2) {
+            HashWyState state;
+            hash_wyhash_init(&state, 42);
+            hash_wyhash_update(&state, data, 2);
+            hash_wyhash_update(&state, data + 2, len - 2);
+            CHECK_EQ(hash_wyhash_final(&state), expected);
+        }
+    }
+}
@@ -0,0 +1,117 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+TEST(Interner, intern) {
+    Interner* interner = interner_new();
+    CHECK_EQ(interner_len(interner), 0);
+
+    SymbolId foo = interner_intern(interner, "foo", 3);
+    SymbolId bar = interner_intern(interner, "bar", 3);
+    SymbolId empty = interner_intern(interner, "", 0);
+    CHECK_NE(foo, SYMBOL_NULL);
+    CHECK_NE(bar, SYMBOL_NULL);
+    CHECK_NE(empty, SYMBOL_NULL);
+    CHECK_NE(foo, bar);
+    CHECK_NE(foo, empty);
+    CHECK_EQ(interner_len(interner), 3);
+
+    // The same spelling always gets the same id (no matter where it's read from)
+    char buffer[] = "xfoobar";
+    CHECK_EQ(interner_intern(interner, buffer + 1, 3), foo);
+    CHECK_EQ(interner_intern_view(interner, buffview_new_from_len(buffer + 4, 3)), bar);
+    CHECK_EQ(interner_intern(interner, "foobar", 6) != foo, true);
+    CHECK_EQ(interner_len(interner), 4);
+
+    CHECK_STREQ(interner_str(interner, foo), "foo");
+    CHECK_STREQ(interner_str(interner, empty), "");
+    BuffView view = interner_view(interner, bar);
+    CHECK_EQ(view.len, 3);
+    CHECK_STRNEQ(view.data, "bar", 3);
+
+    interner_free(interner);
+}
+
+TEST(Interner, find) {
+    Interner* interner = interner_new();
+    CHECK_EQ(interner_find(interner, "foo", 3), SYMBOL_NULL);
+    SymbolId foo = interner_intern(interner, "foo", 3);
+    CHECK_EQ(interner_find(interner, "foo", 3), foo);
+    CHECK_EQ(interner_find(interner, "fo", 2), SYMBOL_NULL);
+    // Looking up doesn't intern anything
+    CHECK_EQ(interner_len(interner), 1);
+    interner_free(interner);
+}
+
+TEST(Interner, grow) {
+    // Enough symbols to grow the hash table (and the spelling storage) several times over
+    Interner* interner = interner_new();
+    char name[32];
+    for(int i = 0; i < 50000; i++) {
+        int len = sprintf(name, "symbol_%d", i);
+        CHECK_EQ(interner_intern(interner, name, len), cast(SymbolId)(i + 1));
+    }
+
+    // A spelling larger than a block of storage
+    UInt32 long_len = 100 * 1024;
+    char* long_name = cast(char*)malloc(long_len);
+    memset(long_name, 'z', long_len);
+    SymbolId long_id = interner_intern(interner, long_name, long_len);
+    CHECK_EQ(interner_view(interner, long_id).len, long_len);
+
+    CHECK_EQ(interner_len(interner), 50001);
+    for(int i = 0; i < 50000; i++) {
+        int len = sprintf(name, "symbol_%d", i);
+        REQUIRE_EQ(interner_find(interner, name, len), cast(SymbolId)(i + 1));
+        CHECK_STREQ(interner_str(interner, i + 1), name);
+    }
+    CHECK_EQ(interner_find(interner, long_name, long_len), long_id);
+
+    free(long_name);
+    interner_free(interner);
+}
+
+typedef struct InternerWorker {
+    Interner* interner;
+    UInt32 start;       // first spelling interned
+    SymbolId ids[2000];
+} InternerWorker;
+
+// Every worker interns the same 2000 spellings (each in a different order), and reads them back as it goes
+static void* interner_work(void* arg) {
+    InternerWorker* worker = cast(InternerWorker*)arg;
+    char name[32];
+    for(UInt32 n = 0; n < 2000; n++) {
+        UInt32 i = (worker->start + n * 7) % 2000;
+        int len = sprintf(name, "symbol_%u", i);
+        worker->ids[i] = interner_intern(worker->interner, name, len);
+        if(strcmp(interner_str(worker->interner, worker->ids[i]), name) != 0)
+            worker->ids[i] = SYMBOL_NULL;
+    }
+    return null;
+}
+
+TEST(Interner, shared) {
+    Interner* interner = interner_new_shared();
+    InternerWorker* workers = cast(InternerWorker*)calloc(4, sizeof(InternerWorker));
+    Thread threads[4];
+    for(UInt32 i = 0; i < 4; i++) {
+        workers[i].interner = interner;
+        workers[i].start = i * 500;
+        REQUIRE_TRUE(thread_start(&threads[i], interner_work, &workers[i]));
+    }
+    for(UInt32 i = 0; i < 4; i++)
+        thread_join(&threads[i]);
+
+    // Every thread got the same id for the same spelling
+    CHECK_EQ(interner_len(interner), 2000);
+    bool is_same = true;
+    for(UInt32 i = 0; i < 2000; i++) {
+        is_same = is_same && workers[0].ids[i] != SYMBOL_NULL;
+        for(UInt32 t = 1; t < 4; t++)
+            is_same = is_same && workers[t].ids[i] == workers[0].ids[i];
+    }
+    CHECK_TRUE(is_same);
+    free(workers);
+    interner_free(interner);
+}
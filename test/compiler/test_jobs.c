@@ -0,0 +1,162 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+#define NUM_ITEMS   10000
+
+typedef struct SumJob {
+    UInt64* items;
+    UInt64 begin;
+    UInt64 end;
+    UInt64 sum;
+} SumJob;
+
+static void sum_job(void* arg) {
+    SumJob* job = cast(SumJob*)arg;
+    for(UInt64 i = job->begin; i < job->end; i++)
+        job->sum += job->items[i];
+}
+
+TEST(Jobs, submit_and_wait) {
+    UInt64* items = cast(UInt64*)malloc(NUM_ITEMS * sizeof(UInt64));
+    for(UInt64 i = 0; i < NUM_ITEMS; i++)
+        items[i] = i;
+
+    // More jobs than a deque initially holds, on pools of several sizes
+    for(UInt32 num_threads = 1; num_threads <= 4; num_threads++) {
+        SumJob jobs[NUM_ITEMS / 10];
+        JobPool* pool = job_pool_new(num_threads);
+        CHECK_EQ(pool->num_workers, num_threads);
+        JobGroup group;
+        job_group_init(&group);
+        for(UInt64 i = 0; i < NUM_ITEMS / 10; i++) {
+            jobs[i].items = items;
+            jobs[i].begin = i * 10;
+            jobs[i].end = i * 10 + 10;
+            jobs[i].sum = 0;
+            job_pool_submit(pool, &group, sum_job, &jobs[i]);
+        }
+        job_group_wait(pool, &group);
+        CHECK_EQ(group.num_pending, 0);
+
+        UInt64 sum = 0;
+        for(UInt64 i = 0; i < NUM_ITEMS / 10; i++)
+            sum += jobs[i].sum;
+        CHECK_EQ(sum, cast(UInt64)NUM_ITEMS * (NUM_ITEMS - 1) / 2);
+        if(num_threads == 1)
+            CHECK_EQ(job_pool_num_steals(pool), 0);
+        job_pool_free(pool);
+    }
+    free(items);
+}
+
+typedef struct FibJob {
+    JobPool* pool;
+    UInt32 n;
+    UInt64 result;
+} FibJob;
+
+// Jobs that submit (and wait on) jobs of their own
+static void fib_job(void* arg) {
+    FibJob* job = cast(FibJob*)arg;
+    if(job->n < 2) {
+        job->result = job->n;
+        return;
+    }
+    FibJob a = { job->pool, job->n - 1, 0 };
+    FibJob b = { job->pool, job->n - 2, 0 };
+    JobGroup group;
+    job_group_init(&group);
+    job_pool_submit(job->pool, &group, fib_job, &a);
+    job_pool_submit(job->pool, &group, fib_job, &b);
+    job_group_wait(job->pool, &group);
+    job->result = a.result + b.result;
+}
+
+TEST(Jobs, nested) {
+    JobPool* pool = job_pool_new(4);
+    FibJob job = { pool, 20, 0 };
+    JobGroup group;
+    job_group_init(&group);
+    job_pool_submit(pool, &group, fib_job, &job);
+    job_group_wait(pool, &group);
+    CHECK_EQ(job.result, 6765);
+    job_pool_free(pool);
+}
+
+typedef struct WorkerJob {
+    JobPool* pool;
+    UInt32 worker_id;
+    Arena* arena;
+} WorkerJob;
+
+static void worker_job(void* arg) {
+    WorkerJob* job = cast(WorkerJob*)arg;
+    job->worker_id = job_pool_worker_id(job->pool);
+    job->arena = job_pool_arena(job->pool);
+    char* scratch = cast(char*)arena_alloc(job->arena, 64);
+    memset(scratch, 'x', 64);
+}
+
+TEST(Jobs, workers) {
+    JobPool* pool = job_pool_new(3);
+    // The calling thread is worker `0`
+    CHECK_EQ(job_pool_worker_id(pool), 0);
+    Arena* arena = job_pool_arena(pool);
+    CHECK_EQ(job_pool_arena(pool), arena);
+
+    WorkerJob jobs[100];
+    JobGroup group;
+    job_group_init(&group);
+    for(UInt32 i = 0; i < 100; i++) {
+        jobs[i].pool = pool;
+        job_pool_submit(pool, &group, worker_job, &jobs[i]);
+    }
+    job_group_wait(pool, &group);
+    // Every worker has an arena of its own
+    for(UInt32 i = 0; i < 100; i++) {
+        CHECK_LT(jobs[i].worker_id, 3);
+        CHECK_EQ(jobs[i].arena, pool->workers[jobs[i].worker_id].arena);
+    }
+    job_pool_free(pool);
+}
+
+TEST(Jobs, teardown) {
+    UInt64* items = cast(UInt64*)malloc(NUM_ITEMS * sizeof(UInt64));
+    for(UInt64 i = 0; i < NUM_ITEMS; i++)
+        items[i] = i;
+
+    // Free the pool while its (idle) workers are still busy trying to steal from every deque - worker `0`'s included
+    for(UInt32 round = 0; round < 100; round++) {
+        JobPool* pool = job_pool_new(8);
+        SumJob jobs[NUM_ITEMS / 10];
+        JobGroup group;
+        job_group_init(&group);
+        for(UInt64 i = 0; i < NUM_ITEMS / 10; i++) {
+            jobs[i] = (SumJob){ items, i * 10, i * 10 + 10, 0 };
+            job_pool_submit(pool, &group, sum_job, &jobs[i]);
+        }
+        job_group_wait(pool, &group);
+        job_pool_free(pool);
+        UInt64 sum = 0;
+        for(UInt64 i = 0; i < NUM_ITEMS / 10; i++)
+            sum += jobs[i].sum;
+        CHECK_EQ(sum, cast(UInt64)NUM_ITEMS * (NUM_ITEMS - 1) / 2);
+    }
+    free(items);
+}
+
+TEST(Jobs, sync) {
+    Mutex mutex;
+    mutex_init(&mutex);
+    mutex_lock(&mutex);
+    mutex_unlock(&mutex);
+    mutex_destroy(&mutex);
+
+    CondVar cond;
+    condvar_init(&cond);
+    condvar_signal(&cond);
+    condvar_broadcast(&cond);
+    condvar_destroy(&cond);
+    thread_yield();
+}
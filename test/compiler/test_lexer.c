@@ -1,7 +1,14 @@
 #include <AdoradInternalTests/AdoradInternalTests.h>
+#include <AdoradInternalTests/compiler/charclass.h>
 #include <tau/tau.h>
 TAU_MAIN()
- 
+
+// Is the value of `token` (see `lexer_value()`) `str`?
+static bool value_is(Lexer* lexer, Token* token, const char* str) {
+    BuffView value = lexer_value(lexer, token);
+    return value.len == strlen(str) && memcmp(value.data, str, value.len) == 0;
+}
+
 TEST(Lexer, Init) {
     char* buffer = "0123456789abcdefghijklmnopqrstuvwxyz";
     Lexer* lexer = lexer_init(buffer, null);
@@ -18,6 +25,584 @@ TEST(Lexer, Init) {
     free(lexer);
 }
 
+TEST(Lexer, compact_tokens) {
+    char* buffer = "[inline] func foo(bar) { put s = \"str\"; }\n";
+    Lexer* lexer = lexer_init_compact(buffer, null, 3);
+    lexer_lex(lexer);
+
+    CHECK_EQ(lexer->toklist, null);
+    REQUIRE_EQ(lexer->tokens->len, 14);
+
+    TokenKind kinds[] = { ATTR_INLINE, FUNC, IDENTIFIER, LPAREN, IDENTIFIER, RPAREN, LBRACE, PUT, IDENTIFIER,
+                          EQUALS, STRING, SEMICOLON, RBRACE, TOK_EOF };
+    for(int i = 0; i < 14; i++) {
+        CHECK_EQ(lexer->tokens->data[i].kind, kinds[i]);
+        CHECK_EQ(lexer->tokens->data[i].fileid, 3);
+    }
+
+    CompactToken* foo = &lexer->tokens->data[2];
+    BuffView foo_value = lexer_token_value(lexer, foo);
+    CHECK_EQ(foo->offset, 14);
+    CHECK_EQ(foo->len, 3);
+    CHECK_STRNEQ(foo_value.data, "foo", 3);
+
+    // Strings are views into the source (without the quotes)
+    CompactToken* str = &lexer->tokens->data[10];
+    BuffView str_value = lexer_token_value(lexer, str);
+    CHECK_EQ(str->len, 5);
+    CHECK_EQ(str_value.len, 3);
+    CHECK_EQ(str_value.data, buffer + str->offset + 1);
+
+    lexer_free(lexer);
+}
+
+TEST(Lexer, keywords) {
+    // Every keyword must be found by the keyword hash
+    for(TokenKind kind = TOK___KEYWORDS_BEGIN + 1; kind < TOK___KEYWORDS_END; kind++) {
+        if(*tokenHash[kind] == nullchar)
+            continue;
+
+        Lexer* lexer = lexer_init_compact(cast(char*)tokenHash[kind], null, 0);
+        lexer_lex(lexer);
+        CHECK_EQ(lexer->tokens->data[0].kind, kind);
+        lexer_free(lexer);
+    }
+
+    // Near misses are identifiers
+    char* buffer = "a ifs rang raisf ranges elsei fallthrougx";
+    Lexer* lexer = lexer_init_compact(buffer, null, 0);
+    lexer_lex(lexer);
+    REQUIRE_EQ(lexer->tokens->len, 8);
+    for(int i = 0; i < 7; i++)
+        CHECK_EQ(lexer->tokens->data[i].kind, IDENTIFIER);
+    lexer_free(lexer);
+}
+
+TEST(Lexer, char_classes) {
+    // The (generated) class table must agree with <adorad/core/char.h> for every byte
+    for(int i = 0; i < 256; i++) {
+        char c = cast(char)i;
+        bool is_ascii = i < 0x80;
+        CHECK_EQ(CHAR_IS(c, CHAR_BLANK), is_ascii && char_is_whitespace(c) && c != '\n');
+        CHECK_EQ(CHAR_IS(c, CHAR_ALPHA), is_ascii && char_is_alpha(c));
+        CHECK_EQ(CHAR_IS(c, CHAR_IDENT_START), is_ascii && char_is_letter(c));
+        CHECK_EQ(CHAR_IS(c, CHAR_IDENT), is_ascii && (char_is_letter(c) || char_is_digit(c)));
+        CHECK_EQ(CHAR_IS(c, CHAR_DIGIT), is_ascii && char_is_digit(c));
+        CHECK_EQ(CHAR_IS(c, CHAR_HEX_DIGIT), is_ascii && char_is_hex_digit(c));
+        CHECK_EQ(CHAR_IS(c, CHAR_OCT_DIGIT), is_ascii && char_is_octal_digit(c));
+        CHECK_EQ(CHAR_IS(c, CHAR_BIN_DIGIT), is_ascii && char_is_binary_digit(c));
+    }
+}
+
+TEST(Lexer, symbols) {
+    // Lexers sharing an Interner give the same spelling the same symbol
+    Interner* interner = interner_new();
+    Lexer* lexer1 = lexer_init("foo bar \"foo\" func", null);
+    Lexer* lexer2 = lexer_init("bar + foo", null);
+    lexer_set_interner(lexer1, interner);
+    lexer_set_interner(lexer2, interner);
+    lexer_lex(lexer1);
+    lexer_lex(lexer2);
+
+    Token* foo1 = cast(Token*)vec_at(lexer1->toklist, 0);
+    Token* bar1 = cast(Token*)vec_at(lexer1->toklist, 1);
+    Token* str1 = cast(Token*)vec_at(lexer1->toklist, 2);
+    Token* func1 = cast(Token*)vec_at(lexer1->toklist, 3);
+    Token* bar2 = cast(Token*)vec_at(lexer2->toklist, 0);
+    Token* plus2 = cast(Token*)vec_at(lexer2->toklist, 1);
+    Token* foo2 = cast(Token*)vec_at(lexer2->toklist, 2);
+
+    CHECK_NE(foo1->symbol, SYMBOL_NULL);
+    CHECK_NE(foo1->symbol, bar1->symbol);
+    CHECK_EQ(foo1->symbol, foo2->symbol);
+    CHECK_EQ(bar1->symbol, bar2->symbol);
+    // Strings are interned by their value (without the quotes)
+    CHECK_EQ(str1->kind, STRING);
+    CHECK_EQ(str1->symbol, foo1->symbol);
+    // Only identifiers and strings carry a symbol
+    CHECK_EQ(func1->symbol, SYMBOL_NULL);
+    CHECK_EQ(plus2->symbol, SYMBOL_NULL);
+    CHECK_STREQ(interner_str(interner, foo1->symbol), "foo");
+    CHECK_EQ(interner_len(interner), 2);
+
+    lexer_free(lexer1);
+    lexer_free(lexer2);
+    interner_free(interner);
+}
+
+TEST(Lexer, number_at_eof) {
+    // A number that runs into the end of the buffer
+    char* sources[] = { "x = 1", "0x1F", "12", "(3)" };
+    UInt32 lens[] = { 1, 4, 2, 1 };
+    UInt32 at[] = { 2, 0, 0, 1 };
+    for(int i = 0; i < 4; i++) {
+        Lexer* lexer = lexer_init_compact(sources[i], null, 0);
+        lexer_lex(lexer);
+        CompactToken* number = &lexer->tokens->data[at[i]];
+        CHECK_EQ(number->len, lens[i]);
+        CHECK_EQ(lexer->tokens->data[lexer->tokens->len - 1].kind, TOK_EOF);
+        CHECK_EQ(lexer->tokens->len, at[i] + 2 + (i == 3));
+        lexer_free(lexer);
+    }
+}
+
+TEST(Lexer, diagnostics) {
+    char* buffer = "x $ y\n0xZ; w\n\"unterminated";
+    Lexer* lexer = lexer_init(buffer, "foo.ad");
+    Diagnostics* diags = diagnostics_new(0);
+    lexer_set_diagnostics(lexer, diags);
+    lexer_lex(lexer);
+
+    // Every error is reported, and the bad source is replaced with TOK_ILLEGAL
+    TokenKind kinds[] = { IDENTIFIER, TOK_ILLEGAL, IDENTIFIER, TOK_ILLEGAL, SEMICOLON, IDENTIFIER, TOK_ILLEGAL, TOK_EOF };
+    REQUIRE_EQ(vec_size(lexer->toklist), 8);
+    for(int i = 0; i < 8; i++)
+        CHECK_EQ((cast(Token*)vec_at(lexer->toklist, i))->kind, kinds[i]);
+
+    REQUIRE_EQ(diags->len, 3);
+    CHECK_EQ(diags->num_errors, 3);
+    CHECK_EQ(diags->items[0].err, ErrorSyntaxError);
+    CHECK_EQ(diags->items[0].begin, 2);
+    CHECK_EQ(diags->items[0].line, 1);
+    CHECK_EQ(diags->items[0].col, 3);
+    CHECK_STREQ(diags->items[0].fname, "foo.ad");
+    CHECK_STREQ(diags->items[0].message, "Invalid character `$`");
+    CHECK_EQ(diags->items[1].begin, 6);
+    CHECK_EQ(diags->items[1].line, 2);
+    CHECK_EQ(diags->items[2].begin, 13);
+    CHECK_EQ(diags->items[2].end, strlen(buffer));
+    CHECK_EQ(diags->items[2].line, 3);
+
+    // Diagnostics outlive the Lexer
+    lexer_free(lexer);
+    CHECK_STREQ(diags->items[2].message, "Unterminated string literal");
+    diagnostics_free(diags);
+}
+
+TEST(Lexer, unicode_identifiers) {
+    char* buffer = "put caf\xC3\xA9 = \xCE\xBB_1 + x\xCC\x81y\n\xE4\xB8\xAD\xE6\x96\x87 // \xE2\x82\xAC\n\"\xF0\x9F\x98\x80\"";
+    Lexer* lexer = lexer_init(buffer, null);
+    CHECK_FALSE(lexer->is_ascii);
+    CHECK_EQ(lexer->bad_utf8, UInt32_MAX);
+    lexer_lex(lexer);
+
+    TokenKind kinds[] = { PUT, IDENTIFIER, EQUALS, IDENTIFIER, PLUS, IDENTIFIER, IDENTIFIER, STRING, TOK_EOF };
+    char* values[] = { null, "caf\xC3\xA9", null, "\xCE\xBB_1", null, "x\xCC\x81y", "\xE4\xB8\xAD\xE6\x96\x87", 
+                       "\xF0\x9F\x98\x80", null };
+    REQUIRE_EQ(vec_size(lexer->toklist), 9);
+    for(int i = 0; i < 9; i++) {
+        Token* token = vec_at_Token(lexer->toklist, i);
+        CHECK_EQ(token->kind, kinds[i]);
+        if(SOME(values[i]))
+            CHECK_TRUE(value_is(lexer, token, values[i]));
+    }
+    lexer_free(lexer);
+
+    lexer = lexer_init("put int x = 1", null);
+    CHECK_TRUE(lexer->is_ascii);
+    lexer_free(lexer);
+}
+
+TEST(Lexer, bad_utf8) {
+    // Characters that can't be part of an identifier, and invalid UTF-8 (in a string, a comment and on its own)
+    char* buffer = "a \xE2\x82\xAC b\n\"x\xFFy\" c // \xC3\n\xC3(d\n\xE2\x82\xACz";
+    Lexer* lexer = lexer_init(buffer, null);
+    CHECK_EQ(lexer->bad_utf8, 10);
+    Diagnostics* diags = diagnostics_new(0);
+    lexer_set_diagnostics(lexer, diags);
+    lexer_lex(lexer);
+
+    REQUIRE_EQ(diags->len, 5);
+    CHECK_EQ(diags->items[0].err, ErrorInvalidCharacter);
+    CHECK_STREQ(diags->items[0].message, "Invalid character `\xE2\x82\xAC` (U+20AC)");
+    CHECK_EQ(diags->items[0].begin, 2);
+    CHECK_EQ(diags->items[0].end, 5);
+    CHECK_STREQ(diags->items[1].message, "Invalid UTF-8 byte `0xFF` at offset 10");
+    CHECK_EQ(diags->items[1].begin, 8);
+    CHECK_EQ(diags->items[1].line, 2);
+    CHECK_STREQ(diags->items[2].message, "Invalid UTF-8 byte `0xC3` at offset 19");
+    CHECK_STREQ(diags->items[3].message, "Invalid UTF-8 byte `0xC3` at offset 21");
+    CHECK_EQ(diags->items[3].line, 3);
+    CHECK_EQ(diags->items[4].begin, 25);
+    CHECK_EQ(diags->items[4].line, 4);
+
+    TokenKind kinds[] = { IDENTIFIER, TOK_ILLEGAL, IDENTIFIER, TOK_ILLEGAL, IDENTIFIER, TOK_ILLEGAL, TOK_ILLEGAL, 
+                          LPAREN, IDENTIFIER, TOK_ILLEGAL, TOK_EOF };
+    REQUIRE_EQ(vec_size(lexer->toklist), 11);
+    for(int i = 0; i < 11; i++)
+        CHECK_EQ(vec_at_Token(lexer->toklist, i)->kind, kinds[i]);
+    lexer_free(lexer);
+    diagnostics_free(diags);
+}
+
+TEST(Lexer, comments) {
+    char* buffer = "/* multi\n   line ** comment */ abc // comment\n  # comment\nz/**/w";
+    Lexer* lexer = lexer_init(buffer, null);
+    lexer_lex(lexer);
+
+    REQUIRE_EQ(vec_size(lexer->toklist), 4);
+    Token* abc = cast(Token*)vec_at(lexer->toklist, 0);
+    CHECK_TRUE(value_is(lexer, abc, "abc"));
+    CHECK_EQ(abc->offset, 31);
+    CHECK_EQ(lexer_loc(lexer, abc->offset).line, 2);
+    CHECK_EQ(lexer_loc(lexer, abc->offset).col, 23);
+
+    Token* z = cast(Token*)vec_at(lexer->toklist, 1);
+    Token* w = cast(Token*)vec_at(lexer->toklist, 2);
+    CHECK_TRUE(value_is(lexer, z, "z"));
+    CHECK_EQ(lexer_loc(lexer, z->offset).line, 4);
+    CHECK_TRUE(value_is(lexer, w, "w"));
+    CHECK_EQ(lexer_loc(lexer, w->offset).col, 6);
+
+    lexer_free(lexer);
+}
+
+TEST(Lexer, line_table) {
+    char* buffer = "ab\n\ncdef\n  g";
+    LineTable* lines = line_table_new(buffer, strlen(buffer));
+    REQUIRE_EQ(lines->num_lines, 4);
+
+    UInt32 expected[][3] = {
+        // offset, line, col
+        {0, 1, 1}, {2, 1, 3}, {3, 2, 1}, {4, 3, 1}, {7, 3, 4}, {9, 4, 1}, {11, 4, 3},
+        // Past the end of the buffer, we're still on the last line
+        {20, 4, 12}
+    };
+    for(UInt32 i = 0; i < sizeof(expected) / sizeof(expected[0]); i++) {
+        Location loc = line_table_loc(lines, expected[i][0]);
+        CHECK_EQ(loc.line, expected[i][1]);
+        CHECK_EQ(loc.col, expected[i][2]);
+    }
+    line_table_free(lines);
+
+    // The Lexer builds the table lazily
+    Lexer* lexer = lexer_init(buffer, null);
+    CHECK_NULL(lexer->lines);
+    CHECK_EQ(lexer_loc(lexer, 11).line, 4);
+    CHECK_NOT_NULL(lexer->lines);
+    CHECK_EQ(lexer_line_table(lexer), lexer->lines);
+    lexer_free(lexer);
+}
+
+TEST(Lexer, file_view) {
+    const char* fname = "test/LexerDemo.ad";
+    char* contents = read_file(fname);
+    FileView view = file_map(fname);
+
+    REQUIRE_NE(view.data, null);
+    CHECK_EQ(view.error, 0);
+    REQUIRE_EQ(view.len, strlen(contents));
+    CHECK_EQ(memcmp(view.data, contents, view.len), 0);
+    for(UInt32 i = 0; i < FILE_VIEW_PADDING; i++)
+        CHECK_EQ(view.data[view.len + i], nullchar);
+
+    // Lexing the view gives the same tokens as lexing a copy
+    Lexer* expected = lexer_init_compact(contents, null, 0);
+    Lexer* lexer = lexer_init_compact_view(&view, null, 0);
+    CHECK_EQ(lexer->buffer->data, view.data);
+    lexer_lex(expected);
+    lexer_lex(lexer);
+    REQUIRE_EQ(lexer->tokens->len, expected->tokens->len);
+    CHECK_EQ(memcmp(lexer->tokens->data, expected->tokens->data, lexer->tokens->len * sizeof(CompactToken)), 0);
+
+    lexer_free(lexer);
+    lexer_free(expected);
+    file_unmap(&view);
+    CHECK_EQ(view.data, null);
+    free(contents);
+
+    // Files that can't be read give an empty view (and why), rather than exiting
+    view = file_map("__lexer_test_missing.ad");
+    CHECK_EQ(view.data, null);
+    CHECK_EQ(view.error, ENOENT);
+    view = file_map(".");
+    CHECK_EQ(view.data, null);
+    CHECK_NE(view.error, 0);
+    CHECK_NE(view.error, ENOENT);
+    file_unmap(&view);
+}
+
+// Source made of lines that are easy to mistake for the beginning of a line of code
+static char* parallel_source(UInt32 min_len) {
+    const char* chunk = 
+        "[inline] func _foo(bar) {\n"
+        "    put s = \"a string\nthat spans $lines #and: 42 [inline] /* x\n\";\n"
+        "    /* a comment\n   \"with a quote\n   $ and more */ x = y // z\n"
+        "    put t = r\"raw\\d\" + \"\"\"tri\"ple\\t\"\"\" + \"esc\\\"aped\"\n"
+        "}\n"
+        "# comment \"\n";
+    UInt32 num_chunks = min_len / strlen(chunk) + 1;
+    char* buffer = cast(char*)calloc(num_chunks, strlen(chunk) + 1);
+    for(UInt32 i = 0; i < num_chunks; i++)
+        strcat(buffer, chunk);
+    return buffer;
+}
+
+TEST(Lexer, lex_parallel) {
+    char* buffer = parallel_source(16 * LEXER_PARALLEL_MIN_CHUNK);
+    Lexer* expected = lexer_init_compact(buffer, null, 0);
+    lexer_lex(expected);
+
+    // No pool (on the calling thread), then pools of 1 to 9 threads
+    for(UInt32 num_threads = 0; num_threads <= 9; num_threads++) {
+        JobPool* pool = num_threads > 0 ? job_pool_new(num_threads) : null;
+        Lexer* lexer = lexer_init_compact(buffer, null, 0);
+        lexer_lex_parallel(lexer, pool);
+        if(SOME(pool))
+            job_pool_free(pool);
+
+        REQUIRE_EQ(lexer->tokens->len, expected->tokens->len);
+        CHECK_EQ(lexer->num_tokens, expected->num_tokens);
+        CHECK_EQ(lexer->nest_level, expected->nest_level);
+        CHECK_EQ(memcmp(lexer->tokens->data, expected->tokens->data, lexer->tokens->len * sizeof(CompactToken)), 0);
+        lexer_free(lexer);
+    }
+    lexer_free(expected);
+    free(buffer);
+
+    // Regular tokens (symbols are interned in order too, so they get the same ids)
+    buffer = parallel_source(4 * LEXER_PARALLEL_MIN_CHUNK);
+    expected = lexer_init(buffer, null);
+    Lexer* lexer = lexer_init(buffer, null);
+    Interner* expected_interner = interner_new();
+    Interner* interner = interner_new();
+    lexer_set_interner(expected, expected_interner);
+    lexer_set_interner(lexer, interner);
+    lexer_lex(expected);
+    JobPool* pool = job_pool_new(4);
+    lexer_lex_parallel(lexer, pool);
+    job_pool_free(pool);
+
+    REQUIRE_EQ(vec_size(lexer->toklist), vec_size(expected->toklist));
+    for(UInt64 i = 0; i < vec_size(lexer->toklist); i++) {
+        Token* token = cast(Token*)vec_at(lexer->toklist, i);
+        Token* exp = cast(Token*)vec_at(expected->toklist, i);
+        CHECK_EQ(token->kind, exp->kind);
+        CHECK_EQ(token->offset, exp->offset);
+        CHECK_EQ(token->symbol, exp->symbol);
+        CHECK_EQ(token->flags, exp->flags);
+        CHECK_EQ(token->len, exp->len);
+    }
+    CHECK_EQ(interner_len(interner), interner_len(expected_interner));
+    lexer_free(lexer);
+    lexer_free(expected);
+    interner_free(interner);
+    interner_free(expected_interner);
+    free(buffer);
+}
+
+TEST(Lexer, next_token) {
+    // Enough tokens to go around the ring a few times
+    const char* chunk = "func foo(bar) { put s = \"str\"; } // comment\n";
+    char* buffer = cast(char*)calloc(16, strlen(chunk) + 1);
+    for(int i = 0; i < 16; i++)
+        strcat(buffer, chunk);
+    Lexer* expected = lexer_init(buffer, null);
+    Lexer* lexer = lexer_init(buffer, null);
+    lexer_lex(expected);
+
+    // Pulling tokens one at a time gives the same tokens as `lexer_lex()`
+    UInt64 num_tokens = vec_size(expected->toklist);
+    REQUIRE_GT(num_tokens, 2 * LEXER_RING_SIZE);
+    for(UInt64 i = 0; i < num_tokens; i++) {
+        Token* exp = cast(Token*)vec_at(expected->toklist, i);
+        if(i + 3 < num_tokens)
+            CHECK_EQ(lexer_peek_token(lexer, 3)->offset, (cast(Token*)vec_at(expected->toklist, i + 3))->offset);
+
+        Token* token = lexer_next_token(lexer);
+        CHECK_EQ(token->kind, exp->kind);
+        CHECK_EQ(token->offset, exp->offset);
+        CHECK_EQ(token->len, exp->len);
+    }
+    CHECK_NULL(lexer->toklist);
+
+    // Past the end, we're stuck at TOK_EOF
+    CHECK_EQ(lexer_next_token(lexer)->kind, TOK_EOF);
+    CHECK_EQ(lexer_peek_token(lexer, 2)->kind, TOK_EOF);
+
+    lexer_free(lexer);
+    lexer_free(expected);
+    free(buffer);
+}
+
+TEST(Lexer, unget_token) {
+    char* buffer = "put x = y";
+    Lexer* lexer = lexer_init(buffer, null);
+
+    CHECK_EQ(lexer_next_token(lexer)->kind, PUT);
+    CHECK_EQ(lexer_next_token(lexer)->kind, IDENTIFIER);
+    lexer_unget_token(lexer);
+    Token* x = lexer_next_token(lexer);
+    CHECK_TRUE(value_is(lexer, x, "x"));
+    CHECK_EQ(lexer_next_token(lexer)->kind, EQUALS);
+    CHECK_EQ(lexer_next_token(lexer)->kind, IDENTIFIER);
+    CHECK_EQ(lexer_next_token(lexer)->kind, TOK_EOF);
+
+    lexer_free(lexer);
+}
+
+TEST(Lexer, lex_kinds) {
+    char* buffer = "a = \"s\" /* c */ (b) // x\n";
+    Lexer* lexer = lexer_init(buffer, null);
+    TokenKinds* kinds = token_kinds_new(1);
+    CHECK_EQ(lexer_lex_kinds(lexer, kinds, 0, UInt32_MAX), strlen(buffer));
+
+    UInt32 expected[][3] = {
+        // kind, offset, len
+        { IDENTIFIER, 0, 1 }, { EQUALS, 2, 1 }, { STRING, 4, 3 }, { COMMENT, 8, 7 }, { LPAREN, 16, 1 },
+        { IDENTIFIER, 17, 1 }, { RPAREN, 18, 1 }, { COMMENT, 20, 4 }, { TOK_EOF, 25, 0 }
+    };
+    REQUIRE_EQ(kinds->len, sizeof(expected) / sizeof(expected[0]));
+    for(UInt64 i = 0; i < kinds->len; i++) {
+        CHECK_EQ(kinds->kinds[i], expected[i][0]);
+        CHECK_EQ(kinds->offsets[i], expected[i][1]);
+        CHECK_EQ(kinds->lens[i], expected[i][2]);
+    }
+    // The Lexer's own tokens are left alone
+    CHECK_EQ(vec_size(lexer->toklist), 0);
+    CHECK_EQ(lexer->num_tokens, 0);
+    lexer_free(lexer);
+
+    // Errors don't stop lexing (even without a Diagnostics)
+    buffer = "a ` b \"unterminated";
+    lexer = lexer_init(buffer, null);
+    kinds->len = 0;
+    lexer_lex_kinds(lexer, kinds, 0, UInt32_MAX);
+    REQUIRE_EQ(kinds->len, 5);
+    CHECK_EQ(kinds->kinds[1], TOK_ILLEGAL);
+    CHECK_EQ(kinds->offsets[1], 2);
+    CHECK_EQ(kinds->kinds[2], IDENTIFIER);
+    CHECK_EQ(kinds->kinds[3], TOK_ILLEGAL);
+    CHECK_EQ(kinds->lens[3], strlen(buffer) - 6);
+    CHECK_EQ(kinds->kinds[4], TOK_EOF);
+    lexer_free(lexer);
+    token_kinds_free(kinds);
+
+    // The same tokens as the other modes (comments aside)
+    buffer = parallel_source(64 * 1024);
+    Lexer* compact = lexer_init_compact(buffer, null, 0);
+    lexer_lex(compact);
+    lexer = lexer_init(buffer, null);
+    kinds = token_kinds_new(1024);
+    lexer_lex_kinds(lexer, kinds, 0, UInt32_MAX);
+    UInt64 num_tokens = 0;
+    bool is_same = true;
+    for(UInt64 i = 0; i < kinds->len; i++) {
+        if(kinds->kinds[i] == COMMENT)
+            continue;
+        CompactToken* token = &compact->tokens->data[num_tokens++];
+        is_same = is_same && token->kind == kinds->kinds[i] && token->offset == kinds->offsets[i] &&
+                  token->len == kinds->lens[i];
+    }
+    CHECK_TRUE(is_same);
+    CHECK_EQ(num_tokens, compact->tokens->len);
+    lexer_free(compact);
+    lexer_free(lexer);
+    token_kinds_free(kinds);
+    free(buffer);
+}
+
+TEST(Lexer, lex_kinds_restart) {
+    char* buffer = "a = 1\n/* one\ntwo\nthree */ b\ns = \"x\ny\"\nc d e\n";
+    Lexer* lexer = lexer_init(buffer, null);
+    TokenKinds* full = token_kinds_new(64);
+    lexer_lex_kinds(lexer, full, 0, UInt32_MAX);
+    TokenKinds* kinds = token_kinds_new(64);
+
+    // From every line start (outside of a comment or a string, or not) to the end: the same tokens
+    LineTable* lines = lexer_line_table(lexer);
+    for(UInt32 line = 0; line < lines->num_lines; line++) {
+        kinds->len = 0;
+        lexer_lex_kinds(lexer, kinds, 0, UInt32_MAX);
+        UInt32 begin = token_kinds_rewind(kinds, lines->starts[line]);
+        CHECK_LE(begin, lines->starts[line]);
+        lexer_lex_kinds(lexer, kinds, begin, UInt32_MAX);
+        REQUIRE_EQ(kinds->len, full->len);
+        CHECK_EQ(memcmp(kinds->kinds, full->kinds, full->len), 0);
+        CHECK_EQ(memcmp(kinds->offsets, full->offsets, full->len * sizeof(UInt32)), 0);
+        CHECK_EQ(memcmp(kinds->lens, full->lens, full->len * sizeof(UInt32)), 0);
+    }
+    // Inside the comment: from where it begins
+    kinds->len = 0;
+    lexer_lex_kinds(lexer, kinds, 0, UInt32_MAX);
+    CHECK_EQ(token_kinds_rewind(kinds, lines->starts[2]), 6);
+    CHECK_EQ(kinds->len, 3);
+
+    // Only a viewport: up to the first token boundary past its end
+    kinds->len = 0;
+    UInt32 end = lexer_lex_kinds(lexer, kinds, lines->starts[6], lines->starts[6] + 3);
+    CHECK_EQ(end, lines->starts[6] + 3);
+    REQUIRE_EQ(kinds->len, 2);
+    CHECK_EQ(kinds->kinds[0], IDENTIFIER);
+    CHECK_EQ(kinds->offsets[1], lines->starts[6] + 2);
+
+    // An edit that extends a token makes it again
+    CHECK_EQ(token_kinds_rewind(kinds, lines->starts[6] + 1), lines->starts[6]);
+    CHECK_EQ(kinds->len, 0);
+
+    token_kinds_free(kinds);
+    token_kinds_free(full);
+    lexer_free(lexer);
+}
+
+TEST(Lexer, strings) {
+    char* buffer = "\"plain\" \"a\\tb\\x41\\\\\" r\"raw\\n\" \"\"\"tri\"ple\\n\"\"\" \"\" r";
+    Lexer* lexer = lexer_init_compact(buffer, null, 0);
+    lexer_lex(lexer);
+
+    TokenKind kinds[] = { STRING, STRING, RAW_STRING, TRIPLE_STRING, STRING, IDENTIFIER, TOK_EOF };
+    UInt8 flags[] = { 0, TOKEN_FLAG_HAS_ESCAPES, 0, TOKEN_FLAG_HAS_ESCAPES, 0, 0, 0 };
+    REQUIRE_EQ(lexer->tokens->len, 7);
+    for(int i = 0; i < 7; i++) {
+        CHECK_EQ(lexer->tokens->data[i].kind, kinds[i]);
+        CHECK_EQ(lexer->tokens->data[i].flags, flags[i]);
+    }
+
+    Arena* arena = arena_new(0);
+    CompactToken* tokens = lexer->tokens->data;
+    // Strings without escapes are views into the source
+    BuffView value = lexer_string_value(lexer_token_value(lexer, &tokens[0]), tokens[0].flags, arena);
+    CHECK_EQ(value.data, buffer + 1);
+    CHECK_EQ(value.len, 5);
+    value = lexer_string_value(lexer_token_value(lexer, &tokens[2]), tokens[2].flags, arena);
+    CHECK_EQ(value.len, 5);
+    CHECK_EQ(strncmp(value.data, "raw\\n", 5), 0);
+    CHECK_EQ(lexer_token_value(lexer, &tokens[4]).len, 0);
+
+    // The others are unescaped when asked for
+    value = lexer_token_value(lexer, &tokens[1]);
+    CHECK_EQ(value.len, 10);
+    value = lexer_string_value(value, tokens[1].flags, arena);
+    CHECK_EQ(value.len, 5);
+    CHECK_STREQ(value.data, "a\tbA\\");
+    value = lexer_string_value(lexer_token_value(lexer, &tokens[3]), tokens[3].flags, arena);
+    CHECK_STREQ(value.data, "tri\"ple\n");
+    arena_free(arena);
+    lexer_free(lexer);
+}
+
+TEST(Lexer, bad_escape) {
+    char* buffer = "x \"a\\qb\" \"\\x4\" y";
+    Lexer* lexer = lexer_init(buffer, null);
+    Diagnostics* diags = diagnostics_new(0);
+    lexer_set_diagnostics(lexer, diags);
+    lexer_lex(lexer);
+
+    // The whole string is the bad token
+    TokenKind kinds[] = { IDENTIFIER, TOK_ILLEGAL, TOK_ILLEGAL, IDENTIFIER, TOK_EOF };
+    REQUIRE_EQ(vec_size(lexer->toklist), 5);
+    for(int i = 0; i < 5; i++)
+        CHECK_EQ((cast(Token*)vec_at(lexer->toklist, i))->kind, kinds[i]);
+    REQUIRE_EQ(diags->len, 2);
+    CHECK_EQ(diags->items[0].err, ErrorInvalidCharacter);
+    CHECK_EQ(diags->items[0].begin, 2);
+    CHECK_EQ(diags->items[0].end, 8);
+    CHECK_STREQ(diags->items[0].message, "Invalid escape sequence `\\q`");
+    CHECK_STREQ(diags->items[1].message, "Invalid escape sequence `\\x`");
+    lexer_free(lexer);
+    diagnostics_free(diags);
+}
+
 // // Without newline in buffer
 // TEST(Lexer, advance_without_newline) {
 //     char* buffer = "abcdefghijklmnopqrstuvwxyz0123456789";
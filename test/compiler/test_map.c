@@ -0,0 +1,122 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+TEST(Map, ints) {
+    Map* map = map_new(MapKeyKindInt, 0, null);
+    CHECK_EQ(map_len(map), 0);
+    CHECK_EQ(map_find_int(map, 42), null);
+
+    // Enough keys to grow the table a few times
+    for(UInt64 i = 0; i < 10000; i++)
+        map_put_int(map, i * 7919, cast(void*)(i + 1));
+    CHECK_EQ(map_len(map), 10000);
+    for(UInt64 i = 0; i < 10000; i++) {
+        MapEntry* entry = map_find_int(map, i * 7919);
+        REQUIRE_NE(entry, null);
+        CHECK_EQ(entry->key.num, i * 7919);
+        CHECK_EQ(entry->value, cast(void*)(i + 1));
+    }
+    CHECK_EQ(map_find_int(map, 1), null);
+
+    bool is_new;
+    MapEntry* entry = map_insert_int(map, 7919, &is_new);
+    CHECK_FALSE(is_new);
+    CHECK_EQ(entry->value, cast(void*)2);
+    entry = map_insert_int(map, 1, &is_new);
+    CHECK_TRUE(is_new);
+    CHECK_EQ(entry->value, null);
+    CHECK_EQ(map_len(map), 10001);
+
+    // Remove every other key
+    for(UInt64 i = 0; i < 10000; i += 2)
+        CHECK_TRUE(map_remove_int(map, i * 7919));
+    CHECK_FALSE(map_remove_int(map, 0));
+    CHECK_EQ(map_len(map), 5001);
+    for(UInt64 i = 0; i < 10000; i++)
+        CHECK_EQ(SOME(map_find_int(map, i * 7919)), i % 2 == 1);
+
+    // Removed slots are reused (or reclaimed by a rehash)
+    for(UInt64 i = 0; i < 10000; i += 2)
+        map_put_int(map, i * 7919, cast(void*)(i + 1));
+    CHECK_EQ(map_len(map), 10001);
+    for(UInt64 i = 0; i < 10000; i++)
+        CHECK_EQ(map_find_int(map, i * 7919)->value, cast(void*)(i + 1));
+
+    map_clear(map);
+    CHECK_EQ(map_len(map), 0);
+    CHECK_EQ(map_find_int(map, 7919), null);
+    map_free(map);
+}
+
+TEST(Map, strings) {
+    char* names[] = { "foo", "bar", "baz", "foobar", "", "a_rather_long_identifier_name", "Foo" };
+    UInt32 num_names = sizeof(names) / sizeof(names[0]);
+
+    Map* map = map_new(MapKeyKindStr, 4, null);
+    for(UInt32 i = 0; i < num_names; i++)
+        map_put_str(map, buffview_new(names[i]), names[i]);
+    CHECK_EQ(map_len(map), num_names);
+
+    // Keys are compared by their bytes (not by pointer, and they need not be null-terminated)
+    char* source = "xfoobarx";
+    MapEntry* foo = map_find_str(map, buffview_new_from_len(source + 1, 3));
+    REQUIRE_NE(foo, null);
+    CHECK_EQ(foo->value, names[0]);
+    CHECK_EQ(map_find_str(map, buffview_new_from_len(source + 1, 6))->value, names[3]);
+    CHECK_EQ(map_find_str(map, BV(""))->value, names[4]);
+    CHECK_EQ(map_find_str(map, BV("fo")), null);
+    CHECK_EQ(map_find_str(map, BV("FOO")), null);
+
+    CHECK_TRUE(map_remove_str(map, BV("bar")));
+    CHECK_EQ(map_find_str(map, BV("bar")), null);
+    CHECK_EQ(map_len(map), num_names - 1);
+    map_free(map);
+}
+
+TEST(Map, order) {
+    // Entries are iterated in insertion order, however the table grows (and with removed entries skipped)
+    Map* map = map_new(MapKeyKindInt, 0, null);
+    for(UInt64 i = 0; i < 1000; i++)
+        map_put_int(map, (i * 2654435761u) % 100003, cast(void*)i);
+    for(UInt64 i = 0; i < 1000; i += 3)
+        map_remove_int(map, (i * 2654435761u) % 100003);
+
+    UInt64 expected = 1;
+    UInt32 iter = 0;
+    for(MapEntry* entry; SOME(entry = map_next(map, &iter)); ) {
+        CHECK_EQ(entry->value, cast(void*)expected);
+        expected += expected % 3 == 2 ? 2 : 1;
+    }
+    CHECK_EQ(expected, 1000);
+
+    // Growing the table (which compacts the entries) doesn't change the order
+    map_reserve(map, 50000);
+    expected = 1;
+    iter = 0;
+    for(MapEntry* entry; SOME(entry = map_next(map, &iter)); ) {
+        CHECK_EQ(entry->value, cast(void*)expected);
+        expected += expected % 3 == 2 ? 2 : 1;
+    }
+    CHECK_EQ(expected, 1000);
+    CHECK_EQ(map_at(map, 0)->value, cast(void*)1);
+    map_free(map);
+}
+
+TEST(Map, arena) {
+    Arena* arena = arena_new(0);
+    Map* map = map_new(MapKeyKindInt, 16, arena);
+    map_reserve(map, 100);
+    UInt32 num_slots = map->num_slots;
+    for(UInt64 i = 0; i < 100; i++)
+        map_put_int(map, i, cast(void*)(i + 1));
+    // Reserving made room for all of them
+    CHECK_EQ(map->num_slots, num_slots);
+    for(UInt64 i = 100; i < 5000; i++)
+        map_put_int(map, i, cast(void*)(i + 1));
+    for(UInt64 i = 0; i < 5000; i++)
+        CHECK_EQ(map_find_int(map, i)->value, cast(void*)(i + 1));
+    CHECK_GT(arena->allocated, 5000 * sizeof(MapEntry));
+    map_free(map);
+    arena_free(arena);
+}
@@ -0,0 +1,107 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+TEST(Memory, tracking) {
+    TrackingAllocator tracker;
+    tracking_allocator_init(&tracker, "test", null);
+    Allocator* allocator = &tracker.allocator;
+
+    char* a = cast(char*)allocator_alloc(allocator, 100);
+    char* b = cast(char*)allocator_calloc(allocator, 50);
+    CHECK_EQ(b[49], 0);
+    CHECK_EQ(tracker.live_bytes, 150);
+    CHECK_EQ(tracker.num_allocs, 2);
+
+    // Growing counts the growth, and shrinking gives it back (the peak stays)
+    memset(a, 'x', 100);
+    a = cast(char*)allocator_realloc(allocator, a, 100, 300);
+    CHECK_EQ(a[99], 'x');
+    CHECK_EQ(tracker.live_bytes, 350);
+    a = cast(char*)allocator_realloc(allocator, a, 300, 10);
+    CHECK_EQ(tracker.live_bytes, 60);
+    CHECK_EQ(tracker.peak_bytes, 350);
+    CHECK_EQ(tracker.total_bytes, 350);
+
+    allocator_free(allocator, a, 10);
+    allocator_free(allocator, b, 50);
+    allocator_free(allocator, null, 0);
+    CHECK_EQ(tracker.live_bytes, 0);
+    CHECK_EQ(tracker.num_frees, 2);
+    CHECK_EQ(tracker.peak_bytes, 350);
+    CHECK_STREQ(tracker.name, "test");
+}
+
+TEST(Memory, containers) {
+    TrackingAllocator tracker;
+    tracking_allocator_init(&tracker, "containers", null);
+    Allocator* allocator = &tracker.allocator;
+
+    // A Vec allocates (and grows, and frees) through its allocator
+    Vec* vec = VEC_NEW_WITH(UInt64, 4, allocator);
+    for(UInt64 i = 0; i < 1000; i++)
+        vec_push(vec, &i);
+    CHECK_EQ(*cast(UInt64*)vec_at(vec, 999), 999);
+    CHECK_EQ(tracker.live_bytes, sizeof(Vec) + vec_cap(vec) * sizeof(UInt64));
+    vec_free(vec);
+    CHECK_EQ(tracker.live_bytes, 0);
+
+    // ... and so does a Buff
+    Buff* buff = buff_new_copy_with("hello, world", 12, allocator);
+    CHECK_STREQ(buff->data, "hello, world");
+    CHECK_EQ(tracker.live_bytes, BUFF_COPY_SIZE(12));
+    buff_free_with(buff, allocator);
+    CHECK_EQ(tracker.live_bytes, 0);
+
+    // ... and so do the blocks of an Arena (which can itself be an allocator)
+    Arena* arena = arena_new_with(1024, allocator);
+    Allocator* from_arena = arena_allocator(arena);
+    Vec* nodes = VEC_NEW_WITH(UInt64, 1, from_arena);
+    for(UInt64 i = 0; i < 100; i++)
+        vec_push(nodes, &i);
+    CHECK_EQ(*cast(UInt64*)vec_at(nodes, 42), 42);
+    CHECK_GT(tracker.live_bytes, sizeof(Arena) + 1024);
+    UInt64 live = tracker.live_bytes;
+    vec_free(nodes);
+    CHECK_EQ(tracker.live_bytes, live);
+    arena_free(arena);
+    CHECK_EQ(tracker.live_bytes, 0);
+}
+
+TEST(Memory, frontend) {
+    const char* fname = "__memory_test.ad";
+    FILE* file = fopen(fname, "wb");
+    fprintf(file, "module foo\nuse bar\nput x = 1 + 2\nput name = \"adorad\"\n");
+    fclose(file);
+
+    const char* fnames[] = { fname, fname };
+    Frontend* frontend = frontend_run(fnames, 2, 2, 0, true);
+    TrackingAllocator* tokens = &frontend->memory[FrontendMemoryTokens];
+    TrackingAllocator* ast = &frontend->memory[FrontendMemoryAst];
+    CHECK_GT(tokens->live_bytes, 0);
+    CHECK_GT(ast->live_bytes, 0);
+    CHECK_GE(tokens->peak_bytes, tokens->live_bytes);
+    CHECK_STREQ(ast->name, "ast");
+
+    FILE* stream = tmpfile();
+    REQUIRE_NE(stream, null);
+    frontend_print_memory_report(frontend, stream);
+    char report[1024] = {0};
+    rewind(stream);
+    fread(report, 1, sizeof(report) - 1, stream);
+    fclose(stream);
+    CHECK_NE(strstr(report, "tokens"), null);
+    CHECK_NE(strstr(report, "ast"), null);
+
+    frontend_free(frontend);
+    remove(fname);
+
+    // Without statistics, nothing is tracked
+    FILE* again = fopen(fname, "wb");
+    fprintf(again, "module foo\n");
+    fclose(again);
+    frontend = frontend_run(fnames, 1, 1, 0, false);
+    CHECK_EQ(frontend->memory[FrontendMemoryTokens].num_allocs, 0);
+    frontend_free(frontend);
+    remove(fname);
+}
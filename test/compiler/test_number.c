@@ -0,0 +1,177 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+#include <math.h>
+#include <stdlib.h>
+TAU_MAIN()
+
+static UInt64 xorshift_state = 88172645463325252ull;
+static UInt64 xorshift(void) {
+    xorshift_state ^= xorshift_state << 13;
+    xorshift_state ^= xorshift_state >> 7;
+    xorshift_state ^= xorshift_state << 17;
+    return xorshift_state;
+}
+
+static UInt64 bits_of(double value) {
+    UInt64 bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+TEST(Number, integers) {
+    const char* sources[] = { 
+        "0", "7", "12", "12345678", "123456789", "1234567890123456", "18446744073709551615", "1_000_000", "0000000000000042",
+        "0x1F", "0XdeadBEEF", "0xFFFF_FFFF_FFFF_FFFF", "0b101", "0B1111_0000", "0o17", "0O777",
+    };
+    UInt64 values[] = { 
+        0, 7, 12, 12345678, 123456789, 1234567890123456ull, UInt64_MAX, 1000000, 42,
+        0x1F, 0xDEADBEEF, UInt64_MAX, 5, 0xF0, 15, 511,
+    };
+    for(UInt32 i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        UInt64 value = 1;
+        CHECK_EQ(number_parse_int(sources[i], cast(UInt32)strlen(sources[i]), &value), NumberOk);
+        CHECK_EQ(value, values[i]);
+    }
+
+    // Every length, so that both the 8-digit and the scalar paths are exercised
+    char buffer[32];
+    for(int i = 0; i < 100000; i++) {
+        UInt64 expected = xorshift() >> (xorshift() % 64);
+        int len = snprintf(buffer, sizeof(buffer), "%llu", cast(unsigned long long)expected);
+        UInt64 value = 0;
+        REQUIRE_EQ(number_parse_int(buffer, cast(UInt32)len, &value), NumberOk);
+        REQUIRE_EQ(value, expected);
+    }
+}
+
+TEST(Number, integer_errors) {
+    const char* overflows[] = { 
+        "18446744073709551616", "99999999999999999999", "100000000000000000000000000", "0x1_0000_0000_0000_0000", 
+        "0b11111111111111111111111111111111111111111111111111111111111111111", "0o2000000000000000000000",
+    };
+    for(UInt32 i = 0; i < sizeof(overflows) / sizeof(overflows[0]); i++) {
+        UInt64 value = 0;
+        CHECK_EQ(number_parse_int(overflows[i], cast(UInt32)strlen(overflows[i]), &value), NumberOverflow);
+    }
+
+    const char* invalids[] = { "", "_", "12a", "0x", "0x_", "0b102", "0o8", "1.5" };
+    for(UInt32 i = 0; i < sizeof(invalids) / sizeof(invalids[0]); i++) {
+        UInt64 value = 0;
+        CHECK_EQ(number_parse_int(invalids[i], cast(UInt32)strlen(invalids[i]), &value), NumberInvalid);
+    }
+}
+
+TEST(Number, floats) {
+    const char* sources[] = {
+        "0.0", "1.5", ".5", "0.1", "3.14159", "1e10", "2E-3", "1_000.000_1", "1e+5", "123456789012345678901234567890",
+        // Clinger's fast path limits
+        "9007199254740992.0", "9007199254740993.0", "1e22", "1e23",
+        // Smallest and largest (sub)normals, and the halfway cases around them
+        "2.2250738585072014e-308", "2.2250738585072011e-308", "4.9406564584124654e-324", "2.4703282292062327e-324",
+        "2.4703282292062328e-324", "1.7976931348623157e308", "1.7976931348623158e308",
+        // More than 19 digits, with a halfway case decided by the last one
+        "9007199254740993.0000000000000000000000000000001", "9007199254740992.9999999999999999999999999999999",
+        "7.2057594037927933e16", "0.000000000000000000000000000000000000000000001e-280", "1e-400",
+        "179769313486231580793728971405301.00000000000000000000000000000000000001e276",
+    };
+    for(UInt32 i = 0; i < sizeof(sources) / sizeof(sources[0]); i++) {
+        char spelling[128];
+        UInt32 len = 0;
+        for(const char* c = sources[i]; *c; c++)
+            if(*c != '_')
+                spelling[len++] = *c;
+        spelling[len] = nullchar;
+
+        double value = -1.0;
+        CHECK_EQ(number_parse_float(sources[i], cast(UInt32)strlen(sources[i]), &value), NumberOk);
+        CHECK_EQ(bits_of(value), bits_of(strtod(spelling, null)));
+    }
+
+    double value = 0.0;
+    CHECK_EQ(number_parse_float("1.7976931348623159e308", 22, &value), NumberOverflow);
+    CHECK_EQ(number_parse_float("1e400", 5, &value), NumberOverflow);
+    CHECK_EQ(number_parse_float("", 0, &value), NumberInvalid);
+    CHECK_EQ(number_parse_float(".", 1, &value), NumberInvalid);
+    CHECK_EQ(number_parse_float("1e", 2, &value), NumberInvalid);
+    CHECK_EQ(number_parse_float("1e+", 3, &value), NumberInvalid);
+    CHECK_EQ(number_parse_float("1.5x", 4, &value), NumberInvalid);
+}
+
+// `strtod()` is correctly rounded (on the platforms we test on), so it serves as the oracle
+TEST(Number, floats_random) {
+    char buffer[128];
+    for(int i = 0; i < 200000; i++) {
+        int len = 0;
+        switch(i % 3) {
+            // Shortest (and longer) spellings of any double
+            case 0: {
+                double expected;
+                UInt64 bits = xorshift();
+                memcpy(&expected, &bits, sizeof(expected));
+                if(expected != expected || expected < 0 || expected > 1.7976931348623157e308)
+                    continue;
+                len = snprintf(buffer, sizeof(buffer), "%.*g", cast(int)(xorshift() % 20 + 1), expected);
+                break;
+            }
+            // Long mantissas
+            case 1: {
+                int num_digits = cast(int)(xorshift() % 40) + 1;
+                for(; len < num_digits; len++)
+                    buffer[len] = cast(char)('0' + xorshift() % 10);
+                len += snprintf(buffer + len, sizeof(buffer) - len, "e%d", cast(int)(xorshift() % 660) - 340);
+                break;
+            }
+            // Exactly halfway between two doubles
+            case 2: {
+                double lower;
+                UInt64 bits = xorshift() >> 2;
+                memcpy(&lower, &bits, sizeof(lower));
+                ++bits;
+                double upper;
+                memcpy(&upper, &bits, sizeof(upper));
+                len = snprintf(buffer, sizeof(buffer), "%.40Le", ((long double)lower + (long double)upper) / 2);
+                break;
+            }
+        }
+
+        double value = 0.0;
+        double expected = strtod(buffer, null);
+        NumberResult result = number_parse_float(buffer, cast(UInt32)len, &value);
+        REQUIRE_EQ(result, expected == HUGE_VAL ? NumberOverflow : NumberOk);
+        REQUIRE_EQ(bits_of(value), bits_of(expected));
+    }
+}
+
+TEST(Number, lexer) {
+    char* buffer = "0 12 3.5 .5 1e+5 2E-3 1_000 0x1F 0b101 0o17 0..10";
+    TokenKind kinds[] = { 
+        INTEGER, INTEGER, FLOAT_LIT, FLOAT_LIT, FLOAT_LIT, FLOAT_LIT, INTEGER, HEX_INT, BIN_INT, OCT_INT,
+        INTEGER, DDOT, INTEGER, TOK_EOF 
+    };
+    const char* values[] = { "0", "12", "3.5", ".5", "1e+5", "2E-3", "1_000", "0x1F", "0b101", "0o17", "0", "..", "10" };
+    Lexer* lexer = lexer_init(buffer, null);
+    lexer_lex(lexer);
+    REQUIRE_EQ(vec_size(lexer->toklist), 14);
+    for(int i = 0; i < 14; i++) {
+        Token* token = cast(Token*)vec_at(lexer->toklist, i);
+        CHECK_EQ(token->kind, kinds[i]);
+        if(i < 13 && token->kind != DDOT) {
+            CHECK_EQ(token->len, strlen(values[i]));
+            CHECK_STRNEQ(lexer_value(lexer, token).data, values[i], token->len);
+        }
+    }
+    lexer_free(lexer);
+
+    // Malformed numbers are replaced with TOK_ILLEGAL (as a whole)
+    lexer = lexer_init("12ab 0b102 1e+ 0x; 3", null);
+    Diagnostics* diags = diagnostics_new(0);
+    lexer_set_diagnostics(lexer, diags);
+    lexer_lex(lexer);
+    TokenKind error_kinds[] = { TOK_ILLEGAL, TOK_ILLEGAL, TOK_ILLEGAL, TOK_ILLEGAL, SEMICOLON, INTEGER, TOK_EOF };
+    REQUIRE_EQ(vec_size(lexer->toklist), 7);
+    for(int i = 0; i < 7; i++)
+        CHECK_EQ((cast(Token*)vec_at(lexer->toklist, i))->kind, error_kinds[i]);
+    CHECK_EQ(diags->num_errors, 4);
+    lexer_free(lexer);
+    diagnostics_free(diags);
+}
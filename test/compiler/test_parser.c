@@ -0,0 +1,436 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <AdoradInternalTests/compiler/precedence.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+TEST(Parser, create_node) {
+    Lexer* lexer = lexer_init("module foo; use bar; put x = 1", null);
+    lexer_lex(lexer);
+    Parser* parser = parser_init(lexer);
+
+    // Nodes come with (zeroed) payloads, all allocated from the Parser's arena
+    AstNode* module = ast_create_node(parser, AstNodeKindModuleStatement);
+    CHECK_EQ(module->kind, AstNodeKindModuleStatement);
+    REQUIRE_NE(module->data.stmt, null);
+    REQUIRE_NE(module->data.stmt->module_stmt, null);
+    CHECK_EQ(module->data.stmt->module_stmt->name, SYMBOL_NULL);
+    CHECK_EQ(module->data.stmt->module_stmt->is_skip, false);
+
+    AstNode* loop = ast_create_node(parser, AstNodeKindLoopCExpr);
+    REQUIRE_NE(loop->data.expr->loop_expr, null);
+    REQUIRE_NE(loop->data.expr->loop_expr->loop_c_expr, null);
+    CHECK_EQ(loop->data.expr->loop_expr->loop_c_expr->cond, null);
+
+    AstNode* var = ast_create_node(parser, AstNodeKindVariableDecl);
+    var->data.scope_obj->var->name = interner_intern(parser->interner, "x", 1);
+    var->data.scope_obj->var->is_mutable = true;
+    CHECK_STREQ(interner_str(parser->interner, var->data.scope_obj->var->name), "x");
+
+    UInt64 allocated = parser->arena->allocated;
+    CHECK_GE(allocated, sizeof(AstNode) * 3);
+    for(int i = 0; i < 10000; i++) {
+        AstNode* node = ast_create_node(parser, AstNodeKindBinaryOpExpr);
+        REQUIRE_NE(node->data.expr->binary_op_expr, null);
+        REQUIRE_EQ(node->data.expr->binary_op_expr->lhs, null);
+        node->data.expr->binary_op_expr->lhs = var;
+    }
+    CHECK_GT(parser->arena->allocated, allocated);
+    // The older nodes are untouched
+    CHECK_EQ(var->data.scope_obj->var->is_mutable, true);
+    CHECK_EQ(module->kind, AstNodeKindModuleStatement);
+
+    // Frees the Lexer, and the whole AST
+    parser_free(parser);
+}
+
+TEST(Parser, flat_ast) {
+    Lexer* lexer = lexer_init("a + b * c", null);
+    lexer_lex(lexer);
+    Parser* parser = parser_init(lexer);
+    Ast* ast = parser->ast;
+
+    // Node 0 is the Root
+    CHECK_EQ(ast->len, 1);
+    CHECK_GE(ast->cap, vec_size(lexer->toklist) / 4);
+    CHECK_EQ(AST_KIND(ast, 0), AstNodeKindRoot);
+
+    // a + (b * c), with the parent of `b * c` reserved before its children
+    AstIndex add = ast_reserve_node(ast, AstNodeKindBinaryOpExpr);
+    AstIndex a = ast_add_node(ast, AstNodeKindIdentifier, 0, AST_NULL, AST_NULL);
+    AstIndex b = ast_add_node(ast, AstNodeKindIdentifier, 2, AST_NULL, AST_NULL);
+    AstIndex c = ast_add_node(ast, AstNodeKindIdentifier, 4, AST_NULL, AST_NULL);
+    AstIndex mult = ast_add_node(ast, AstNodeKindBinaryOpExpr, 3, b, c);
+    ast_set_node(ast, add, 1, a, mult);
+
+    CHECK_EQ(AST_KIND(ast, add), AstNodeKindBinaryOpExpr);
+    CHECK_EQ(AST_MAIN_TOKEN(ast, add), 1);
+    CHECK_EQ(AST_LHS(ast, add), a);
+    CHECK_EQ(AST_RHS(ast, AST_RHS(ast, add)), c);
+    CHECK_EQ(AST_MAIN_TOKEN(ast, AST_LHS(ast, mult)), 2);
+
+    // Lists and structs go into `extra`
+    AstIndex top[] = { add };
+    AstRange range = ast_add_list(ast, top, 1);
+    ast_set_node(ast, 0, 0, range.start, range.end);
+    CHECK_EQ(ast->extra[AST_LHS(ast, 0)], add);
+    CHECK_EQ(AST_RHS(ast, 0) - AST_LHS(ast, 0), 1);
+
+    AstIf branches = { b, c };
+    UInt32 at = AST_ADD_EXTRA(ast, branches);
+    AstIndex cond = ast_add_node(ast, AstNodeKindIfExpr, 0, a, at);
+    CHECK_EQ(AST_EXTRA(ast, AstIf, AST_RHS(ast, cond)).then_body, b);
+    CHECK_EQ(AST_EXTRA(ast, AstIf, AST_RHS(ast, cond)).else_body, c);
+
+    // Growing keeps the existing nodes
+    for(UInt32 i = 0; i < 100000; i++)
+        ast_add_node(ast, AstNodeKindIntLiteral, i, AST_NULL, AST_NULL);
+    CHECK_EQ(ast->len, 100000 + 7);
+    CHECK_EQ(AST_MAIN_TOKEN(ast, ast->len - 1), 99999);
+    CHECK_EQ(AST_RHS(ast, add), mult);
+    CHECK_GE(ast_memory(ast), cast(UInt64)ast->len * 13);
+
+    parser_free(parser);
+}
+
+TEST(Parser, emits_ast) {
+    Lexer* lexer = lexer_init("module foo\nuse bar\nput int x = a + b * -c\nput int y = (1 + 2) * 3", null);
+    lexer_lex(lexer);
+    Parser* parser = parser_init(lexer);
+    REQUIRE(parser_parse(parser));
+    Ast* ast = parser->ast;
+
+    // The top-level declarations, in order
+    REQUIRE_EQ(AST_RHS(ast, 0) - AST_LHS(ast, 0), 4);
+    AstIndex* top = ast->extra + AST_LHS(ast, 0);
+    CHECK_EQ(AST_KIND(ast, top[0]), AstNodeKindModuleStatement);
+    CHECK_EQ(AST_MAIN_TOKEN(ast, top[0]), 1);
+    CHECK_EQ(AST_KIND(ast, top[1]), AstNodeKindUseStatement);
+    CHECK_EQ(AST_MAIN_TOKEN(ast, top[1]), 3);
+
+    // x: int = a + (b * (-c)), children first
+    AstIndex x = top[2];
+    CHECK_EQ(AST_KIND(ast, x), AstNodeKindVariableDecl);
+    CHECK_EQ(AST_MAIN_TOKEN(ast, x), 6);
+    CHECK_EQ(AST_KIND(ast, AST_LHS(ast, x)), AstNodeKindIdentifier);
+    CHECK_EQ(AST_MAIN_TOKEN(ast, AST_LHS(ast, x)), 5);
+    AstIndex add = AST_RHS(ast, x);
+    CHECK_EQ(AST_KIND(ast, add), AstNodeKindBinaryOpExpr);
+    CHECK_EQ(AST_MAIN_TOKEN(ast, add), 9);
+    CHECK_EQ(AST_MAIN_TOKEN(ast, AST_LHS(ast, add)), 8);
+    AstIndex mult = AST_RHS(ast, add);
+    CHECK_EQ(AST_MAIN_TOKEN(ast, mult), 11);
+    CHECK_EQ(AST_MAIN_TOKEN(ast, AST_LHS(ast, mult)), 10);
+    CHECK_EQ(AST_KIND(ast, AST_RHS(ast, mult)), AstNodeKindPrefixOpExpr);
+    CHECK_EQ(AST_MAIN_TOKEN(ast, AST_LHS(ast, AST_RHS(ast, mult))), 13);
+    CHECK_LT(mult, add);
+    CHECK_LT(add, x);
+
+    // y = 9: the folded constant replaces its operands, and its main token is its (outermost) operator
+    AstIndex y = top[3];
+    CHECK_EQ(AST_MAIN_TOKEN(ast, y), 16);
+    AstIndex nine = AST_RHS(ast, y);
+    CHECK_EQ(AST_KIND(ast, nine), AstNodeKindIntLiteral);
+    CHECK_EQ(AST_MAIN_TOKEN(ast, nine), 23);
+    CHECK_EQ(nine, y - 1);
+    CHECK_EQ(ast->len, y + 1);
+
+    parser_free(parser);
+}
+
+TEST(Parser, precedence) {
+    // Every token has an entry - non-operators get the sentinel
+    for(int kind = 0; kind < TOK_COUNT; kind++) {
+        if(BINOP_PRECEDENCE(kind) == PREC_NONE)
+            CHECK_EQ(BINOP_KIND(kind), BinaryOpKindInvalid);
+        else
+            CHECK_NE(BINOP_KIND(kind), BinaryOpKindInvalid);
+    }
+    CHECK_EQ(BINOP_PRECEDENCE(IDENTIFIER), PREC_NONE);
+    CHECK_EQ(BINOP_PRECEDENCE(SEMICOLON), PREC_NONE);
+    CHECK_EQ(BINOP_PRECEDENCE(TOK_EOF), PREC_NONE);
+
+    CHECK_EQ(BINOP_KIND(PLUS), BinaryOpKindAdd);
+    CHECK_EQ(BINOP_KIND(LESS_THAN_OR_EQUAL_TO), BinaryOpKindCmpLessThanorEqualTo);
+    CHECK_EQ(BINOP_KIND(OR), BinaryOpKindBoolOr);
+
+    // Stronger operators bind tighter
+    CHECK_GT(BINOP_PRECEDENCE(MULT), BINOP_PRECEDENCE(PLUS));
+    CHECK_GT(BINOP_PRECEDENCE(PLUS), BINOP_PRECEDENCE(LBITSHIFT));
+    CHECK_GT(BINOP_PRECEDENCE(LBITSHIFT), BINOP_PRECEDENCE(EQUALS_EQUALS));
+    CHECK_GT(BINOP_PRECEDENCE(EQUALS_EQUALS), BINOP_PRECEDENCE(AND));
+    CHECK_GT(BINOP_PRECEDENCE(AND), BINOP_PRECEDENCE(OR));
+    CHECK_EQ(BINOP_PRECEDENCE(MOD), BINOP_PRECEDENCE(SLASH));
+}
+
+TEST(Parser, error_recovery) {
+    // Three bad declarations (one of them a lexer error) among good ones
+    char* buffer = "module ;\nuse bar;\nuse ;\nmodule foo\n$ use baz\nput";
+    Lexer* lexer = lexer_init(buffer, "foo.ad");
+    Diagnostics* diags = diagnostics_new(0);
+    lexer_set_diagnostics(lexer, diags);
+    lexer_lex(lexer);
+    Parser* parser = parser_init(lexer);
+
+    // Every error is reported in a single pass (the Lexer's first, since it's done before parsing)
+    CHECK_FALSE(parser_parse(parser));
+    REQUIRE_EQ(diags->len, 4);
+    CHECK_EQ(diags->items[0].line, 5);
+    CHECK_EQ(diags->items[0].err, ErrorSyntaxError);
+    CHECK_STREQ(diags->items[0].message, "Invalid character `$`");
+    CHECK_EQ(diags->items[1].line, 1);
+    CHECK_EQ(diags->items[1].col, 8);
+    CHECK_EQ(diags->items[1].err, ErrorParseError);
+    CHECK_STREQ(diags->items[1].message, "Expected module name; got `;`");
+    CHECK_EQ(diags->items[2].line, 3);
+    CHECK_STREQ(diags->items[2].message, "Expected use name; got `;`");
+    // `put` at the end of the file
+    CHECK_EQ(diags->items[3].line, 6);
+
+    // The good declarations are all there
+    REQUIRE_EQ(vec_size(parser->nodelist), 3);
+    CHECK_EQ((cast(AstNode*)vec_at(parser->nodelist, 0))->kind, AstNodeKindUseStatement);
+    CHECK_EQ((cast(AstNode*)vec_at(parser->nodelist, 1))->kind, AstNodeKindModuleStatement);
+    CHECK_STREQ(interner_str(parser->interner, 
+                (cast(AstNode*)vec_at(parser->nodelist, 1))->data.stmt->module_stmt->name), "foo");
+    CHECK_EQ((cast(AstNode*)vec_at(parser->nodelist, 2))->kind, AstNodeKindUseStatement);
+    CHECK_STREQ(interner_str(parser->interner, 
+                (cast(AstNode*)vec_at(parser->nodelist, 2))->data.stmt->use_stmt->name), "baz");
+
+    parser_free(parser);
+    diagnostics_free(diags);
+}
+
+TEST(Parser, unsupported) {
+    // Syntax the Parser doesn't handle yet is an error like any other - not the end of the process
+    char* buffer = "use foo\nstruct Foo { id: Int }\nfunc f() -> Int;\nenum E { A }\nfunc g(a: Int) -> Int;\nuse bar";
+    Lexer* lexer = lexer_init(buffer, "foo.ad");
+    Diagnostics* diags = diagnostics_new(0);
+    lexer_set_diagnostics(lexer, diags);
+    lexer_lex(lexer);
+    Parser* parser = parser_init(lexer);
+
+    CHECK_FALSE(parser_parse(parser));
+    REQUIRE_EQ(diags->len, 3);
+    CHECK_EQ(diags->items[0].line, 2);
+    CHECK_EQ(diags->items[0].err, ErrorUnsupported);
+    CHECK_STREQ(diags->items[0].message, "Struct declarations aren't supported yet");
+    CHECK_EQ(diags->items[1].line, 4);
+    CHECK_EQ(diags->items[1].err, ErrorUnsupported);
+    CHECK_EQ(diags->items[2].line, 5);
+    CHECK_STREQ(diags->items[2].message, "Function parameters aren't supported yet");
+
+    // A function without parameters is fine
+    REQUIRE_EQ(vec_size(parser->nodelist), 3);
+    CHECK_EQ((cast(AstNode*)vec_at(parser->nodelist, 0))->kind, AstNodeKindUseStatement);
+    CHECK_EQ((cast(AstNode*)vec_at(parser->nodelist, 1))->kind, AstNodeKindFuncDecl);
+    CHECK_EQ((cast(AstNode*)vec_at(parser->nodelist, 2))->kind, AstNodeKindUseStatement);
+
+    parser_free(parser);
+    diagnostics_free(diags);
+}
+
+TEST(Parser, max_errors) {
+    Lexer* lexer = lexer_init("use ; use ; use ; use ; use ; use ; use fine", null);
+    Diagnostics* diags = diagnostics_new(2);
+    lexer_set_diagnostics(lexer, diags);
+    lexer_lex(lexer);
+    Parser* parser = parser_init(lexer);
+
+    // Parsing stops once the Diagnostics is full
+    CHECK_FALSE(parser_parse(parser));
+    CHECK_EQ(diags->len, 2);
+    CHECK_EQ(vec_size(parser->nodelist), 0);
+
+    parser_free(parser);
+    diagnostics_free(diags);
+}
+
+// Are the tokens of `parser` those of a fresh `lexer_lex()` of `source`?
+static bool same_tokens(Parser* parser, char* source) {
+    Lexer* lexer = lexer_init(source, null);
+    lexer_lex(lexer);
+    bool is_same = vec_size(parser->toklist) == vec_size(lexer->toklist);
+    for(UInt64 i = 0; is_same && i < vec_size(lexer->toklist); i++) {
+        Token* expected = cast(Token*)vec_at(lexer->toklist, i);
+        Token* token = cast(Token*)vec_at(parser->toklist, i);
+        BuffView value = lexer_value(parser->lexer, token);
+        BuffView expected_value = lexer_value(lexer, expected);
+        is_same = token->kind == expected->kind && token->offset == expected->offset && 
+                  buffview_cmp(&value, &expected_value);
+    }
+    lexer_free(lexer);
+    return is_same;
+}
+
+#define DECL_PAYLOAD(parser, i)     ((cast(AstNode*)vec_at((parser)->nodelist, (i)))->data.stmt)
+#define DECL_NAME(parser, i)        interner_str((parser)->interner, DECL_PAYLOAD(parser, i)->use_stmt->name)
+
+TEST(Parser, reparse) {
+    char* sources[] = {
+        "module foo\nuse bar\nuse baz\nuse qux\n",
+        // `baz` -> `bazz`
+        "module foo\nuse bar\nuse bazz\nuse qux\n",
+        // Whitespace only
+        "module foo\nuse bar\nuse bazz\n   use qux\n",
+        // A new declaration
+        "module foo\nuse bar;use zap\nuse bazz\n   use qux\n",
+    };
+    // The edits (in the previous source) giving each source
+    UInt32 edits[][3] = { { 0, 0, 0 }, { 23, 23, 1 }, { 28, 28, 3 }, { 18, 18, 8 } };
+
+    Lexer* lexer = lexer_init(sources[0], null);
+    lexer_lex(lexer);
+    Parser* parser = parser_init(lexer);
+    REQUIRE(parser_parse(parser));
+    REQUIRE_EQ(vec_size(parser->nodelist), 4);
+    AstNodeStatement* module = DECL_PAYLOAD(parser, 0);
+    AstNodeStatement* bar = DECL_PAYLOAD(parser, 1);
+    AstNodeStatement* qux = DECL_PAYLOAD(parser, 3);
+
+    REQUIRE(parser_reparse(parser, sources[1], edits[1][0], edits[1][1], edits[1][2]));
+    CHECK(same_tokens(parser, sources[1]));
+    REQUIRE_EQ(vec_size(parser->nodelist), 4);
+    CHECK_STREQ(DECL_NAME(parser, 2), "bazz");
+    // Declarations outside the edit are kept as they are
+    CHECK_EQ(DECL_PAYLOAD(parser, 0), module);
+    CHECK_EQ(DECL_PAYLOAD(parser, 1), bar);
+    CHECK_EQ(DECL_PAYLOAD(parser, 3), qux);
+    AstNodeStatement* bazz = DECL_PAYLOAD(parser, 2);
+
+    // Both declarations touching the edit are unchanged (token-wise), so they're reused
+    REQUIRE(parser_reparse(parser, sources[2], edits[2][0], edits[2][1], edits[2][2]));
+    CHECK(same_tokens(parser, sources[2]));
+    REQUIRE_EQ(vec_size(parser->nodelist), 4);
+    CHECK_EQ(DECL_PAYLOAD(parser, 2), bazz);
+    CHECK_EQ(DECL_PAYLOAD(parser, 3), qux);
+
+    REQUIRE(parser_reparse(parser, sources[3], edits[3][0], edits[3][1], edits[3][2]));
+    CHECK(same_tokens(parser, sources[3]));
+    REQUIRE_EQ(vec_size(parser->nodelist), 5);
+    CHECK_EQ(DECL_PAYLOAD(parser, 0), module);
+    CHECK_STREQ(DECL_NAME(parser, 1), "bar");
+    CHECK_STREQ(DECL_NAME(parser, 2), "zap");
+    CHECK_EQ(DECL_PAYLOAD(parser, 3), bazz);
+    CHECK_EQ(DECL_PAYLOAD(parser, 4), qux);
+    ParserDecl* decls = cast(ParserDecl*)vec_begin(parser->decls);
+    CHECK_EQ(vec_size(parser->decls), 5);
+    CHECK_EQ(decls[4].first_token, 9);
+    CHECK_EQ(decls[4].num_tokens, 2);
+
+    // The Ast's Root lists the declarations too, with the main tokens of the moved (and reused) ones moved along
+    Ast* ast = parser->ast;
+    REQUIRE_EQ(AST_RHS(ast, 0) - AST_LHS(ast, 0), 5);
+    const char* names[] = { "foo", "bar", "zap", "bazz", "qux" };
+    for(UInt32 i = 0; i < 5; i++) {
+        AstIndex node = ast->extra[AST_LHS(ast, 0) + i];
+        CHECK_EQ(node, vec_at_AstNode(parser->nodelist, i)->index);
+        Token* name = vec_at_Token(lexer->toklist, AST_MAIN_TOKEN(ast, node));
+        BuffView value = lexer_value(lexer, name);
+        CHECK_EQ(value.len, strlen(names[i]));
+        CHECK_STRNEQ(value.data, names[i], value.len);
+    }
+
+    parser_free(parser);
+}
+
+TEST(Parser, reparse_errors) {
+    char* sources[] = {
+        "use foo\nuse bar\n",
+        // A parse error
+        "use foo\nuse \n",
+        // Fixed
+        "use foo\nuse baz\n",
+        // A lexer error
+        "use foo\nuse \"baz\n",
+    };
+    Lexer* lexer = lexer_init(sources[0], null);
+    Diagnostics* diags = diagnostics_new(0);
+    lexer_set_diagnostics(lexer, diags);
+    lexer_lex(lexer);
+    Parser* parser = parser_init(lexer);
+    REQUIRE(parser_parse(parser));
+
+    CHECK_FALSE(parser_reparse(parser, sources[1], 12, 15, 0));
+    CHECK_EQ(diags->len, 1);
+    CHECK(parser->has_errors);
+    CHECK(same_tokens(parser, sources[1]));
+
+    // After an error, the whole file is reparsed
+    REQUIRE(parser_reparse(parser, sources[2], 12, 12, 3));
+    CHECK_EQ(diags->len, 1);
+    CHECK_FALSE(parser->has_errors);
+    CHECK(same_tokens(parser, sources[2]));
+    REQUIRE_EQ(vec_size(parser->nodelist), 2);
+    CHECK_STREQ(DECL_NAME(parser, 1), "baz");
+
+    // The string runs into the end of the file
+    CHECK_FALSE(parser_reparse(parser, sources[3], 12, 12, 1));
+    CHECK_EQ(diags->len, 2);
+    CHECK_STREQ(diags->items[1].message, "Unterminated string literal");
+
+    parser_free(parser);
+    diagnostics_free(diags);
+}
+
+TEST(Parser, string_value) {
+    Lexer* lexer = lexer_init("put s = \"a\\tb\"", null);
+    lexer_lex(lexer);
+    Parser* parser = parser_init(lexer);
+    Token* token = cast(Token*)vec_at(lexer->toklist, 3);
+    REQUIRE_EQ(token->kind, STRING);
+    CHECK_EQ(token->flags, TOKEN_FLAG_HAS_ESCAPES);
+
+    // Literals keep their spelling, and are unescaped in the Parser's arena when asked for
+    AstNode* node = ast_create_node(parser, AstNodeKindStringLiteral);
+    node->data.literal->str_value->value = interner_intern_view(parser->interner, lexer_value(lexer, token));
+    node->data.literal->str_value->has_escapes = true;
+    BuffView value = parser_string_value(parser, node);
+    CHECK_EQ(value.len, 3);
+    CHECK_STREQ(value.data, "a\tb");
+    CHECK_STREQ(interner_str(parser->interner, node->data.literal->str_value->value), "a\\tb");
+
+    node->data.literal->str_value->has_escapes = false;
+    value = parser_string_value(parser, node);
+    CHECK_EQ(value.data, interner_str(parser->interner, node->data.literal->str_value->value));
+    parser_free(parser);
+}
+
+TEST(Parser, stream_matches_toklist) {
+    // Many more tokens than the streaming Lexer's ring holds
+    static char source[200 * 32];
+    UInt32 len = 0;
+    for(int i = 0; i < 200; i++)
+        len += snprintf(source + len, sizeof(source) - len, "put int a%d = b%d;\n", i, i);
+
+    Lexer* lexer = lexer_init(source, null);
+    lexer_lex(lexer);
+    CHECK_GT(vec_size(lexer->toklist), 10 * LEXER_RING_SIZE);
+    Parser* parser = parser_init(lexer);
+    REQUIRE(parser_parse(parser));
+    Parser* stream = parser_init_stream(lexer_init(source, null));
+    REQUIRE(parser_parse(stream));
+
+    REQUIRE_EQ(vec_size(stream->nodelist), 200);
+    REQUIRE_EQ(vec_size(stream->nodelist), vec_size(parser->nodelist));
+    for(UInt64 i = 0; i < vec_size(parser->nodelist); i++) {
+        AstNode* node = vec_at_AstNode(parser->nodelist, i);
+        AstNode* streamed = vec_at_AstNode(stream->nodelist, i);
+        REQUIRE_EQ(streamed->kind, AstNodeKindVariableDecl);
+        CHECK_EQ(streamed->kind, node->kind);
+        CHECK_STREQ(interner_str(stream->interner, streamed->data.scope_obj->var->name), 
+                    interner_str(parser->interner, node->data.scope_obj->var->name));
+    }
+
+    // ... and so are their (index-based) ASTs
+    Ast* ast = parser->ast;
+    Ast* streamed = stream->ast;
+    REQUIRE_EQ(streamed->len, ast->len);
+    REQUIRE_EQ(streamed->extra_len, ast->extra_len);
+    CHECK_EQ(memcmp(streamed->kinds, ast->kinds, ast->len * sizeof(UInt8)), 0);
+    CHECK_EQ(memcmp(streamed->main_tokens, ast->main_tokens, ast->len * sizeof(UInt32)), 0);
+    CHECK_EQ(memcmp(streamed->data, ast->data, ast->len * sizeof(AstNodeData)), 0);
+    CHECK_EQ(memcmp(streamed->extra, ast->extra, ast->extra_len * sizeof(UInt32)), 0);
+
+    parser_free(stream);
+    parser_free(parser);
+}
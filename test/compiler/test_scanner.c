@@ -0,0 +1,70 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <AdoradInternalTests/compiler/scanner.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+// Runs of every length (and at every alignment) are tested so that both the vectorized and scalar paths
+// are exercised
+#define RUNS_BUFFER_SIZE    160
+
+TEST(Scanner, blanks) {
+    char buffer[RUNS_BUFFER_SIZE];
+    for(UInt32 start = 0; start < 8; start++) {
+        for(UInt32 len = 0; start + len < RUNS_BUFFER_SIZE; len++) {
+            memset(buffer, 'a', RUNS_BUFFER_SIZE);
+            for(UInt32 i = 0; i < len; i++)
+                buffer[start + i] = " \t\r\v\f"[i % 5];
+
+            CHECK_EQ(scan_blanks(buffer, start, RUNS_BUFFER_SIZE), start + len);
+            // Newlines end the run
+            if(start + len < RUNS_BUFFER_SIZE) {
+                buffer[start + len] = '\n';
+                CHECK_EQ(scan_blanks(buffer, start, RUNS_BUFFER_SIZE), start + len);
+            }
+        }
+    }
+
+    // The run is cut short at `end`
+    memset(buffer, ' ', RUNS_BUFFER_SIZE);
+    CHECK_EQ(scan_blanks(buffer, 3, 100), 100);
+}
+
+TEST(Scanner, identifier) {
+    const char* ident = "abcxyzABCXYZ_0123456789";
+    char buffer[RUNS_BUFFER_SIZE];
+    for(UInt32 start = 0; start < 8; start++) {
+        for(UInt32 len = 0; start + len < RUNS_BUFFER_SIZE; len++) {
+            memset(buffer, ' ', RUNS_BUFFER_SIZE);
+            for(UInt32 i = 0; i < len; i++)
+                buffer[start + i] = ident[i % strlen(ident)];
+
+            CHECK_EQ(scan_identifier(buffer, start, RUNS_BUFFER_SIZE), start + len);
+        }
+    }
+
+    // Characters that neighbour the identifier ranges end the run
+    const char* stops = "@[`{/:-.\"\x7f\x80\xff";
+    for(UInt32 i = 0; i < strlen(stops); i++) {
+        memset(buffer, 'q', RUNS_BUFFER_SIZE);
+        buffer[40] = stops[i];
+        CHECK_EQ(scan_identifier(buffer, 1, RUNS_BUFFER_SIZE), 40);
+    }
+}
+
+TEST(Scanner, until) {
+    char buffer[RUNS_BUFFER_SIZE];
+    for(UInt32 start = 0; start < 8; start++) {
+        for(UInt32 at = start; at < RUNS_BUFFER_SIZE; at++) {
+            memset(buffer, 'a', RUNS_BUFFER_SIZE);
+            buffer[at] = '\n';
+            CHECK_EQ(scan_until(buffer, start, RUNS_BUFFER_SIZE, '\n'), at);
+            CHECK_EQ(scan_until2(buffer, start, RUNS_BUFFER_SIZE, '*', '\n'), at);
+            buffer[at] = '*';
+            CHECK_EQ(scan_until2(buffer, start, RUNS_BUFFER_SIZE, '*', '\n'), at);
+        }
+    }
+
+    memset(buffer, 'a', RUNS_BUFFER_SIZE);
+    CHECK_EQ(scan_until(buffer, 0, RUNS_BUFFER_SIZE, '\n'), RUNS_BUFFER_SIZE);
+    CHECK_EQ(scan_until2(buffer, 0, RUNS_BUFFER_SIZE, '"', '\\'), RUNS_BUFFER_SIZE);
+}
@@ -0,0 +1,189 @@
+// For `fileno()` (this must come before the first system header)
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+#include <fcntl.h>
+TAU_MAIN()
+
+static void write_fields(SerialWriter* writer) {
+    serial_write_u8(writer, 0xAB);
+    serial_write_u16(writer, 0xBEEF);
+    serial_write_u32(writer, 0xDEADBEEF);
+    serial_write_u64(writer, 0x0123456789ABCDEFull);
+    serial_write_f64(writer, -2.5);
+    serial_write_uleb(writer, 300);
+    serial_write_sleb(writer, -300);
+    serial_write_str(writer, "adorad", 6);
+    serial_write_str(writer, "lexer", 5);
+    serial_write_str(writer, "adorad", 6);
+    serial_write_bytes(writer, "raw", 3);
+}
+
+// Returns true if the fields of `write_fields()` are read back
+static bool check_fields(SerialReader* reader) {
+    bool is_ok = serial_read_u8(reader) == 0xAB;
+    is_ok &= serial_read_u16(reader) == 0xBEEF;
+    is_ok &= serial_read_u32(reader) == 0xDEADBEEF;
+    is_ok &= serial_read_u64(reader) == 0x0123456789ABCDEFull;
+    is_ok &= serial_read_f64(reader) == -2.5;
+    is_ok &= serial_read_uleb(reader) == 300;
+    is_ok &= serial_read_sleb(reader) == -300;
+    BuffView first = serial_read_str(reader);
+    BuffView second = serial_read_str(reader);
+    BuffView again = serial_read_str(reader);
+    is_ok &= first.len == 6 && !strncmp(first.data, "adorad", 6);
+    is_ok &= second.len == 5 && !strncmp(second.data, "lexer", 5);
+    // A string written twice is read back from the table
+    is_ok &= again.data == first.data && again.len == 6;
+    char raw[3];
+    is_ok &= serial_read_bytes(reader, raw, 3) && !memcmp(raw, "raw", 3);
+    return is_ok && !reader->has_error;
+}
+
+TEST(Serial, memory) {
+    SerialWriter writer;
+    serial_writer_init_memory(&writer, 0);
+    write_fields(&writer);
+    // Fixed-width fields are little-endian
+    CHECK_EQ(cast(UInt8)writer.data[1], 0xEF);
+    CHECK_EQ(cast(UInt8)writer.data[2], 0xBE);
+    // The second "adorad" is a 1-byte reference
+    CHECK_EQ(serial_writer_offset(&writer), 1 + 2 + 4 + 8 + 8 + 2 + 2 + (1 + 6) + (1 + 5) + 1 + 3);
+
+    SerialReader reader;
+    serial_reader_init_memory(&reader, writer.data, writer.len);
+    CHECK_TRUE(check_fields(&reader));
+    CHECK_TRUE(serial_reader_is_done(&reader));
+    CHECK_EQ(serial_reader_offset(&reader), writer.len);
+    serial_reader_free(&reader);
+    CHECK_TRUE(serial_writer_free(&writer));
+}
+
+TEST(Serial, fd) {
+    FILE* file = tmpfile();
+    REQUIRE_NE(file, null);
+    int fd = fileno(file);
+
+    // Enough to flush (and refill) the buffer a few times
+    SerialWriter writer;
+    serial_writer_init_fd(&writer, fd);
+    for(UInt64 i = 0; i < 50000; i++)
+        serial_write_uleb(&writer, i * 977);
+    write_fields(&writer);
+    char* big = cast(char*)calloc(1, 3 * SERIAL_BUFFER_SIZE);
+    big[SERIAL_BUFFER_SIZE] = 'x';
+    serial_write_bytes(&writer, big, 3 * SERIAL_BUFFER_SIZE);
+    UInt64 offset = serial_writer_offset(&writer);
+    UInt32 crc = serial_writer_checksum(&writer);
+    CHECK_TRUE(serial_writer_free(&writer));
+    CHECK_EQ(cast(UInt64)lseek(fd, 0, SEEK_END), offset);
+
+    lseek(fd, 0, SEEK_SET);
+    SerialReader reader;
+    serial_reader_init_fd(&reader, fd);
+    bool is_ok = true;
+    for(UInt64 i = 0; i < 50000; i++)
+        is_ok &= serial_read_uleb(&reader) == i * 977;
+    CHECK_TRUE(is_ok);
+    CHECK_TRUE(check_fields(&reader));
+    CHECK_FALSE(serial_reader_is_done(&reader));
+    memset(big, 1, 3 * SERIAL_BUFFER_SIZE);
+    CHECK_TRUE(serial_read_bytes(&reader, big, 3 * SERIAL_BUFFER_SIZE));
+    CHECK_EQ(big[SERIAL_BUFFER_SIZE], 'x');
+    CHECK_EQ(big[0], 0);
+    CHECK_EQ(serial_reader_checksum(&reader), crc);
+    CHECK_EQ(serial_reader_offset(&reader), offset);
+    CHECK_TRUE(serial_reader_is_done(&reader));
+    serial_reader_free(&reader);
+    free(big);
+    fclose(file);
+}
+
+TEST(Serial, varints) {
+    UInt64 unsigned_values[] = { 0, 1, 127, 128, 16383, 16384, UInt32_MAX, UInt64_MAX };
+    UInt32 unsigned_lens[] = { 1, 1, 1, 2, 2, 3, 5, 10 };
+    Int64 signed_values[] = { 0, -1, 63, 64, -64, -65, INT64_MAX, INT64_MIN };
+    UInt32 signed_lens[] = { 1, 1, 1, 2, 1, 2, 10, 10 };
+
+    SerialWriter writer;
+    serial_writer_init_memory(&writer, 16);
+    for(UInt32 i = 0; i < 8; i++) {
+        UInt64 before = writer.len;
+        serial_write_uleb(&writer, unsigned_values[i]);
+        CHECK_EQ(writer.len - before, unsigned_lens[i]);
+    }
+    for(UInt32 i = 0; i < 8; i++) {
+        UInt64 before = writer.len;
+        serial_write_sleb(&writer, signed_values[i]);
+        CHECK_EQ(writer.len - before, signed_lens[i]);
+    }
+
+    SerialReader reader;
+    serial_reader_init_memory(&reader, writer.data, writer.len);
+    for(UInt32 i = 0; i < 8; i++)
+        CHECK_EQ(serial_read_uleb(&reader), unsigned_values[i]);
+    for(UInt32 i = 0; i < 8; i++)
+        CHECK_EQ(serial_read_sleb(&reader), signed_values[i]);
+    CHECK_TRUE(serial_reader_is_done(&reader));
+    serial_reader_free(&reader);
+    serial_writer_free(&writer);
+
+    // More than 10 bytes is malformed
+    char bad[11];
+    memset(bad, 0x80, sizeof(bad));
+    serial_reader_init_memory(&reader, bad, sizeof(bad));
+    CHECK_EQ(serial_read_uleb(&reader), 0);
+    CHECK_TRUE(reader.has_error);
+    serial_reader_free(&reader);
+}
+
+TEST(Serial, checksum) {
+    SerialWriter writer;
+    serial_writer_init_memory(&writer, 0);
+    write_fields(&writer);
+    UInt32 crc = serial_writer_checksum(&writer);
+    CHECK_EQ(crc, hash_crc32c(writer.data, cast(Ll)writer.len));
+    serial_write_u32(&writer, crc);
+
+    SerialReader reader;
+    serial_reader_init_memory(&reader, writer.data, writer.len);
+    for(UInt32 i = 0; i < 10; i++)
+        serial_read_u8(&reader);
+    CHECK_EQ(serial_reader_checksum(&reader), hash_crc32c(writer.data, 10));
+    serial_reader_free(&reader);
+
+    // Flipping a bit changes the checksum
+    writer.data[3] ^= 4;
+    CHECK_NE(hash_crc32c(writer.data, cast(Ll)writer.len - 4), crc);
+    serial_writer_free(&writer);
+}
+
+TEST(Serial, truncated) {
+    SerialWriter writer;
+    serial_writer_init_memory(&writer, 0);
+    serial_write_u32(&writer, 42);
+    serial_write_str(&writer, "truncated", 9);
+
+    // Reading past the end fails (and keeps failing)
+    SerialReader reader;
+    serial_reader_init_memory(&reader, writer.data, writer.len - 3);
+    CHECK_EQ(serial_read_u32(&reader), 42);
+    BuffView str = serial_read_str(&reader);
+    CHECK_TRUE(reader.has_error);
+    CHECK_EQ(str.len, 0);
+    CHECK_NULL(str.data);
+    CHECK_EQ(serial_read_u8(&reader), 0);
+    CHECK_FALSE(serial_reader_is_done(&reader));
+    serial_reader_free(&reader);
+
+    // ... as does a reference to a string that isn't in the table
+    char dangling[] = { 4 };
+    serial_reader_init_memory(&reader, dangling, 1);
+    serial_read_str(&reader);
+    CHECK_TRUE(reader.has_error);
+    serial_reader_free(&reader);
+    serial_writer_free(&writer);
+}
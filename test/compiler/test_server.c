@@ -0,0 +1,158 @@
+// For `nanosleep()` (this must come before the first system header)
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+#include <sys/stat.h>
+#include <time.h>
+#if defined(_WIN32)
+    #include <direct.h>
+    #define make_dir(path)  _mkdir(path)
+#else
+    #include <sys/socket.h>
+    #include <sys/un.h>
+    #include <unistd.h>
+    #define make_dir(path)  mkdir(path, 0755)
+#endif
+TAU_MAIN()
+
+static void write_source(const char* fname, const char* source) {
+    FILE* file = fopen(fname, "wb");
+    fputs(source, file);
+    fclose(file);
+}
+
+// Answer `request`, with the response in `response` (of `cap` bytes). Returns what `server_handle()` did
+static bool serve(Server* server, const char* request, char* response, UInt64 cap) {
+    FILE* stream = tmpfile();
+    bool is_running = server_handle(server, request, stream);
+    UInt64 len = cast(UInt64)ftell(stream);
+    len = len < cap ? len : cap - 1;
+    rewind(stream);
+    response[fread(response, 1, len, stream)] = nullchar;
+    fclose(stream);
+    return is_running;
+}
+
+TEST(Server, handle) {
+    make_dir("__server");
+    make_dir("__server/io");
+    write_source("__server/io/file.ad", "module io\n");
+    write_source("__server/main.ad", "use io\n");
+    Server* server = server_new("__server", null);
+    #if defined(_WIN32)
+        REQUIRE_EQ(server, null);
+        return;
+    #endif
+    REQUIRE_NE(server, null);
+    CHECK_EQ(server->graph, null);
+
+    char response[4096];
+    CHECK_TRUE(serve(server, "check\n", response, sizeof(response)));
+    CHECK_NE(strstr(response, "done 0\n"), null);
+    REQUIRE_NE(server->graph, null);
+    CHECK_EQ(server->report.num_rebuilt_modules, 2);
+    CHECK_EQ(server->num_builds, 1);
+
+    // Nothing changed: answered from memory
+    CHECK_TRUE(serve(server, "check", response, sizeof(response)));
+    CHECK_NE(strstr(response, "Up to date: 2 file(s) in 2 module(s)"), null);
+    CHECK_NE(strstr(response, "done 0\n"), null);
+    CHECK_EQ(server->num_builds, 1);
+
+    // An edit (that breaks the build), then its fix
+    write_source("__server/main.ad", "use io\nexport func\n");
+    CHECK_TRUE(serve(server, "check", response, sizeof(response)));
+    CHECK_NE(strstr(response, "done 1\n"), null);
+    CHECK_EQ(server->num_builds, 2);
+    CHECK_EQ(server->report.num_rebuilt_files, 1);
+    // Still broken (and still said so)
+    CHECK_TRUE(serve(server, "check", response, sizeof(response)));
+    CHECK_NE(strstr(response, "done 1\n"), null);
+    write_source("__server/main.ad", "use io\n\n");
+    CHECK_TRUE(serve(server, "build", response, sizeof(response)));
+    CHECK_NE(strstr(response, "done 0\n"), null);
+    CHECK_TRUE(file_exists("__server/" GRAPH_DEFAULT_FNAME));
+
+    CHECK_TRUE(serve(server, "status", response, sizeof(response)));
+    CHECK_NE(strstr(response, "2 file(s) in 2 module(s), 6 request(s), 3 build(s)"), null);
+    CHECK_TRUE(serve(server, "compile", response, sizeof(response)));
+    CHECK_NE(strstr(response, "Unknown request `compile`"), null);
+    CHECK_NE(strstr(response, "done 1\n"), null);
+    CHECK_FALSE(serve(server, "stop", response, sizeof(response)));
+    CHECK_STREQ(response, "done 0\n");
+    CHECK_TRUE(server->is_stopping);
+    server_free(server);
+
+    // A new server starts from the saved graph: nothing to rebuild
+    server = server_new("__server", null);
+    REQUIRE_NE(server->graph, null);
+    CHECK_TRUE(serve(server, "check", response, sizeof(response)));
+    CHECK_NE(strstr(response, "done 0\n"), null);
+    CHECK_EQ(server->report.num_rebuilt_files, 0);
+    server_free(server);
+
+    remove("__server/" GRAPH_DEFAULT_FNAME);
+    remove("__server/main.ad");
+    remove("__server/io/file.ad");
+    rmdir("__server/io");
+    rmdir("__server");
+}
+
+#if !defined(_WIN32)
+    static void* run_server(void* arg) {
+        server_run(cast(Server*)arg);
+        return null;
+    }
+
+    TEST(Server, socket) {
+        make_dir("__server_socket");
+        write_source("__server_socket/main.ad", "module main\n");
+        ServerOptions options = {0};
+        options.socket_path = "__server_socket.sock";
+        options.poll_ms = 10;
+        options.request_timeout_ms = 50;
+        Server* server = server_new("__server_socket", &options);
+        REQUIRE_NE(server, null);
+        CHECK_EQ(server_request("__server_socket.sock", "status", stdout), -1);
+
+        Thread thread;
+        thread_start(&thread, run_server, server);
+        // Wait for it to listen
+        FILE* stream = tmpfile();
+        int status = -1;
+        for(int i = 0; i < 500 && status < 0; i++) {
+            status = server_request("__server_socket.sock", "check", stream);
+            if(status < 0)
+                nanosleep(&(struct timespec){ 0, 10 * 1000 * 1000 }, null);
+        }
+        CHECK_EQ(status, 0);
+
+        // A second server doesn't take the socket over
+        Server* other = server_new("__server_socket", &options);
+        CHECK_FALSE(server_run(other));
+        server_free(other);
+
+        // A client that never sends its request is dropped, rather than stalling the others
+        struct sockaddr_un addr = {0};
+        addr.sun_family = AF_UNIX;
+        strcpy(addr.sun_path, "__server_socket.sock");
+        int idle_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        REQUIRE_EQ(connect(idle_fd, cast(struct sockaddr*)&addr, sizeof(addr)), 0);
+
+        write_source("__server_socket/main.ad", "module main\nexport func\n");
+        CHECK_EQ(server_request("__server_socket.sock", "check", stream), 1);
+        close(idle_fd);
+        CHECK_EQ(server_request("__server_socket.sock", "stop", stream), 0);
+        fclose(stream);
+        thread_join(&thread);
+        CHECK_FALSE(file_exists("__server_socket.sock"));
+        CHECK_EQ(server->num_requests, 3);
+        server_free(server);
+
+        remove("__server_socket/main.ad");
+        rmdir("__server_socket");
+    }
+#endif
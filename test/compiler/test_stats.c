@@ -0,0 +1,144 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+TEST(Stats, lexer_parser) {
+    char* buffer = "module foo\nuse bar\nuse baz\n";
+    Stats* stats = stats_new();
+    Lexer* lexer = lexer_init(buffer, null);
+    lexer_set_stats(lexer, stats);
+    lexer_lex(lexer);
+
+    CHECK_EQ(stats->num_tokens, vec_size(lexer->toklist));
+    CHECK_EQ(stats->bytes_scanned, strlen(buffer));
+    CHECK_EQ(stats->phases[StatsPhaseLex].num_runs, 1);
+    // Nothing is allocated per token: tokens are stored in `toklist` itself, and their values are read from the source
+    CHECK_EQ(stats->phases[StatsPhaseLex].num_allocs, 0);
+    CHECK_EQ(stats->phases[StatsPhaseLex].bytes_allocated, 0);
+
+    Parser* parser = parser_init(lexer);
+    CHECK_EQ(parser->stats, stats);
+    REQUIRE(parser_parse(parser));
+    CHECK_EQ(stats->phases[StatsPhaseParse].num_runs, 1);
+    CHECK_EQ(stats->nodes_by_kind[AstNodeKindModuleStatement], 1);
+    CHECK_EQ(stats->nodes_by_kind[AstNodeKindUseStatement], 2);
+    CHECK_EQ(stats->nodes_by_kind[AstNodeKindRoot], 1);
+    CHECK_EQ(stats->num_nodes, 4);
+    CHECK_EQ(stats->phases[StatsPhaseParse].num_allocs, parser->arena->num_allocs);
+    CHECK_EQ(stats->phases[StatsPhaseParse].bytes_allocated, parser->arena->allocated);
+
+    parser_free(parser);
+    stats_free(stats);
+}
+
+TEST(Stats, merge) {
+    Stats* a = stats_new();
+    Stats* b = stats_new();
+    a->num_tokens = 3;
+    a->nodes_by_kind[AstNodeKindIdentifier] = 2;
+    a->phases[StatsPhaseLex].nanoseconds = 10;
+    b->num_tokens = 4;
+    b->nodes_by_kind[AstNodeKindIdentifier] = 1;
+    b->phases[StatsPhaseLex].nanoseconds = 5;
+    stats_merge(a, b);
+    CHECK_EQ(a->num_tokens, 7);
+    CHECK_EQ(a->nodes_by_kind[AstNodeKindIdentifier], 3);
+    CHECK_EQ(a->phases[StatsPhaseLex].nanoseconds, 15);
+    CHECK_STREQ(ast_node_kind_str(AstNodeKindIdentifier), "Identifier");
+    CHECK_STREQ(ast_node_kind_str(AstNodeKindRoot), "Root");
+    stats_free(a);
+    stats_free(b);
+}
+
+TEST(Stats, frontend) {
+    const char* fname = "__stats_test.ad";
+    FILE* file = fopen(fname, "wb");
+    fprintf(file, "module foo\nuse bar\n");
+    fclose(file);
+
+    const char* fnames[] = { fname, fname, fname };
+    Frontend* frontend = frontend_run(fnames, 3, 2, 0, true);
+    REQUIRE(frontend->ok);
+    REQUIRE_NE(frontend->stats, null);
+    CHECK_EQ(frontend->stats->num_files, 3);
+    CHECK_EQ(frontend->stats->phases[StatsPhaseRead].num_runs, 3);
+    CHECK_EQ(frontend->stats->phases[StatsPhaseLex].num_runs, 3);
+    CHECK_EQ(frontend->stats->phases[StatsPhaseParse].num_runs, 3);
+    CHECK_EQ(frontend->stats->bytes_scanned, 3 * strlen("module foo\nuse bar\n"));
+    CHECK_EQ(frontend->stats->nodes_by_kind[AstNodeKindUseStatement], 3);
+    CHECK_EQ(frontend->stats->num_tokens, 3 * frontend->files[0].stats->num_tokens);
+    frontend_free(frontend);
+    remove(fname);
+}
+
+TEST(Stats, clock) {
+    // The clock never goes backwards, and does move
+    UInt64 start = clock_monotonic_ns();
+    UInt64 prev = start;
+    while(prev == start) {
+        UInt64 now = clock_monotonic_ns();
+        CHECK_GE(now, prev);
+        prev = now;
+    }
+    CHECK_GE(clock_elapsed_ns(start), prev - start);
+
+    // A timed block is counted once, and a null `stats` is fine
+    Stats* stats = stats_new();
+    UInt32 num_iters = 0;
+    STATS_TIME_PHASE(stats, StatsPhaseCheck) {
+        ++num_iters;
+        for(UInt64 now = stats_now(); stats_now() == now; ) {}
+    }
+    STATS_TIME_PHASE(null, StatsPhaseCheck) {
+        ++num_iters;
+    }
+    CHECK_EQ(num_iters, 2);
+    CHECK_EQ(stats->phases[StatsPhaseCheck].num_runs, 1);
+    CHECK_GT(stats->phases[StatsPhaseCheck].nanoseconds, 0);
+    CHECK_EQ(stats->phases[StatsPhaseCodegen].num_runs, 0);
+    CHECK_STREQ(stats_phase_str(StatsPhaseCodegen), "codegen");
+    stats_free(stats);
+}
+
+TEST(Stats, time_report) {
+    const char* small = "__stats_small.ad";
+    const char* large = "__stats_large.ad";
+    FILE* file = fopen(small, "wb");
+    fprintf(file, "module foo\n");
+    fclose(file);
+    file = fopen(large, "wb");
+    for(UInt32 i = 0; i < 20000; i++)
+        fprintf(file, "use bar%u\n", i);
+    fclose(file);
+
+    const char* fnames[] = { small, large, "__stats_missing.ad" };
+    Frontend* frontend = frontend_run(fnames, 3, 1, 0, true);
+    CHECK_GT(frontend->nanoseconds, 0);
+    CHECK_LE(frontend->stats->phases[StatsPhaseLex].nanoseconds, frontend->nanoseconds);
+
+    FILE* stream = tmpfile();
+    REQUIRE_NE(stream, null);
+    frontend_print_time_report(frontend, stream);
+    char report[4096] = {0};
+    rewind(stream);
+    fread(report, 1, sizeof(report) - 1, stream);
+    fclose(stream);
+
+    // Every phase is a column, and the files that were read are rows (slowest first), followed by the totals
+    CHECK_NE(strstr(report, "2 file(s) on 1 thread(s)"), null);
+    for(UInt32 i = 0; i < StatsPhaseCount; i++)
+        CHECK_NE(strstr(report, stats_phase_str(cast(StatsPhase)i)), null);
+    char* large_row = strstr(report, large);
+    char* small_row = strstr(report, small);
+    char* total_row = strstr(report, "\nTotal");
+    REQUIRE_NE(large_row, null);
+    REQUIRE_NE(small_row, null);
+    REQUIRE_NE(total_row, null);
+    CHECK_LT(large_row, small_row);
+    CHECK_LT(small_row, total_row);
+    CHECK_NE(strstr(total_row, "%"), null);
+    CHECK_EQ(strstr(report, "__stats_missing.ad"), null);
+    frontend_free(frontend);
+    remove(small);
+    remove(large);
+}
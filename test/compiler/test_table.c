@@ -0,0 +1,154 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+static Symbol make_symbol(SymbolId module, SymbolId name, UInt32 file) {
+    Symbol symbol = {0};
+    symbol.module = module;
+    symbol.name = name;
+    symbol.kind = SymbolKindFunc;
+    symbol.file = file;
+    return symbol;
+}
+
+TEST(Table, insert_find) {
+    Table* table = table_new();
+    Interner* interner = interner_new();
+    SymbolId io = interner_intern(interner, "io", 2);
+    SymbolId net = interner_intern(interner, "net", 3);
+    SymbolId open = interner_intern(interner, "open", 4);
+
+    bool is_new;
+    Symbol symbol = make_symbol(io, open, 1);
+    symbol.kind = SymbolKindType;
+    Symbol* io_open = table_insert(table, &symbol, &is_new);
+    CHECK_TRUE(is_new);
+    CHECK_NE(io_open, &symbol);
+    CHECK_EQ(io_open->kind, SymbolKindType);
+    // Same name, another module
+    symbol = make_symbol(net, open, 2);
+    Symbol* net_open = table_insert(table, &symbol, &is_new);
+    CHECK_TRUE(is_new);
+    CHECK_NE(net_open, io_open);
+    // A redeclaration returns the first one
+    symbol = make_symbol(io, open, 3);
+    CHECK_EQ(table_insert(table, &symbol, &is_new), io_open);
+    CHECK_FALSE(is_new);
+    CHECK_EQ(io_open->file, 1);
+
+    CHECK_EQ(table_find(table, io, open), io_open);
+    CHECK_EQ(table_find(table, net, open), net_open);
+    CHECK_NULL(table_find(table, open, io));
+    CHECK_EQ(table_len(table), 2);
+    interner_free(interner);
+    table_free(table);
+}
+
+TEST(Table, bulk) {
+    Table* table = table_new();
+    // Enough to grow every shard a few times
+    Symbol* symbols = cast(Symbol*)malloc(20000 * sizeof(Symbol));
+    Symbol** results = cast(Symbol**)malloc(20000 * sizeof(Symbol*));
+    for(UInt32 i = 0; i < 20000; i++)
+        symbols[i] = make_symbol(1 + i % 7, 1 + i, i);
+    CHECK_EQ(table_insert_bulk(table, symbols, 20000, results), 20000);
+    CHECK_EQ(table_len(table), 20000);
+    bool is_found = true;
+    for(UInt32 i = 0; i < 20000; i++)
+        is_found = is_found && table_find(table, 1 + i % 7, 1 + i) == results[i] && results[i]->file == i;
+    CHECK_TRUE(is_found);
+
+    // Every other one of these is already in the table (from a file before)
+    for(UInt32 i = 0; i < 2000; i++) {
+        UInt32 j = 19000 + i / 2;
+        symbols[i] = i % 2 ? make_symbol(100, 1 + i / 2, 100000 + i) : make_symbol(1 + j % 7, 1 + j, 100000 + i);
+    }
+    CHECK_EQ(table_insert_bulk(table, symbols, 2000, results), 1000);
+    CHECK_EQ(results[0]->file, 19000);
+    CHECK_EQ(results[1]->file, 100001);
+    CHECK_EQ(results[1999], table_find(table, 100, 1000));
+    CHECK_EQ(table_len(table), 21000);
+    CHECK_EQ(table_insert_bulk(table, symbols, 0, null), 0);
+    free(results);
+    free(symbols);
+    table_free(table);
+}
+
+typedef struct TableWriter {
+    Table* table;
+    UInt32 id;
+    UInt32 num_inserted;
+} TableWriter;
+
+typedef struct TableReader {
+    Table* table;
+    _Atomic bool* is_done;
+    UInt64 num_found;
+    bool ok;
+} TableReader;
+
+// Inserts "files" of 64 declarations, each (but the first) also redeclaring a symbol of the file before
+static void* table_write(void* arg) {
+    TableWriter* writer = cast(TableWriter*)arg;
+    Symbol symbols[65];
+    for(UInt32 file = 0; file < 200; file++) {
+        for(UInt32 i = 0; i < 64; i++)
+            symbols[i] = make_symbol(1 + writer->id, 1 + file * 64 + i, file);
+        symbols[64] = make_symbol(1 + writer->id, 1 + (file > 0 ? file - 1 : 0) * 64, file);
+        writer->num_inserted += table_insert_bulk(writer->table, symbols, 65, null);
+    }
+    return null;
+}
+
+// Looks up symbols while they're being inserted: any symbol found must be complete
+static void* table_read(void* arg) {
+    TableReader* reader = cast(TableReader*)arg;
+    while(!atomic_load(reader->is_done)) {
+        for(UInt32 id = 0; id < 4; id++) {
+            for(UInt32 name = 1; name <= 200 * 64; name += 97) {
+                Symbol* symbol = table_find(reader->table, 1 + id, name);
+                if(SOME(symbol)) {
+                    reader->num_found++;
+                    reader->ok = reader->ok && symbol->name == name && symbol->module == 1 + id &&
+                                 symbol->file == (name - 1) / 64 && symbol->kind == SymbolKindFunc;
+                }
+            }
+        }
+    }
+    return null;
+}
+
+TEST(Table, concurrent) {
+    Table* table = table_new();
+    _Atomic bool is_done = false;
+    TableWriter writers[4];
+    TableReader readers[2];
+    Thread writer_threads[4];
+    Thread reader_threads[2];
+    for(UInt32 i = 0; i < 2; i++) {
+        readers[i] = (TableReader){ table, &is_done, 0, true };
+        REQUIRE_TRUE(thread_start(&reader_threads[i], table_read, &readers[i]));
+    }
+    for(UInt32 i = 0; i < 4; i++) {
+        writers[i] = (TableWriter){ table, i, 0 };
+        REQUIRE_TRUE(thread_start(&writer_threads[i], table_write, &writers[i]));
+    }
+    for(UInt32 i = 0; i < 4; i++)
+        thread_join(&writer_threads[i]);
+    atomic_store(&is_done, true);
+    for(UInt32 i = 0; i < 2; i++) {
+        thread_join(&reader_threads[i]);
+        CHECK_TRUE(readers[i].ok);
+    }
+
+    for(UInt32 i = 0; i < 4; i++)
+        CHECK_EQ(writers[i].num_inserted, 200 * 64);
+    CHECK_EQ(table_len(table), 4 * 200 * 64);
+    bool is_found = true;
+    for(UInt32 id = 0; id < 4; id++) {
+        for(UInt32 name = 1; name <= 200 * 64; name++)
+            is_found = is_found && SOME(table_find(table, 1 + id, name));
+    }
+    CHECK_TRUE(is_found);
+    table_free(table);
+}
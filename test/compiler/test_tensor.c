@@ -0,0 +1,107 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+// `out = |in0 * in1 + 2.5 * in0| - (-(in1 * in0))`
+static TensorKernel* make_kernel(OutputArch arch) {
+    TensorKernel* kernel = tensor_kernel_new("fused", AdoradTypeTensorFloat32, 2, arch);
+    TensorNodeId a = tensor_input(kernel, 0);
+    TensorNodeId b = tensor_input(kernel, 1);
+    TensorNodeId ab = tensor_binary(kernel, TensorOpMul, a, b);
+    TensorNodeId x = tensor_binary(kernel, TensorOpAdd, ab,
+                                   tensor_binary(kernel, TensorOpMul, tensor_const(kernel, 2.5), a));
+    TensorNodeId ba = tensor_binary(kernel, TensorOpMul, b, a);
+    kernel->output = tensor_binary(kernel, TensorOpSub, tensor_unary(kernel, TensorOpAbs, x),
+                                   tensor_unary(kernel, TensorOpNeg, ba));
+    return kernel;
+}
+
+static char* emit(TensorKernel* kernel) {
+    CWriter writer;
+    cwriter_init(&writer, 64);
+    tensor_emit(&writer, kernel);
+    cwriter_write(&writer, "", 1);
+    return writer.data;
+}
+
+static UInt32 count(const char* str, const char* sub) {
+    UInt32 num = 0;
+    for(const char* at = strstr(str, sub); SOME(at); at = strstr(at + 1, sub))
+        num++;
+    return num;
+}
+
+TEST(Tensor, nodes) {
+    TensorKernel* kernel = make_kernel(OutputArchAmd64);
+    // `in1 * in0` is `in0 * in1`
+    TensorNode* out = tensor_node(kernel, kernel->output);
+    CHECK_EQ(out->op, TensorOpSub);
+    CHECK_EQ(tensor_node(kernel, tensor_node(kernel, out->rhs)->lhs)->op, TensorOpMul);
+    CHECK_EQ(tensor_node(kernel, out->rhs)->lhs, tensor_binary(kernel, TensorOpMul, 0, 1));
+    // 2 inputs, a constant, and 6 operations
+    CHECK_EQ(vec_size(kernel->nodes), 9);
+
+    // Constants are folded
+    TensorNodeId c = tensor_binary(kernel, TensorOpMul, tensor_const(kernel, 2.5), tensor_const(kernel, 4));
+    CHECK_EQ(tensor_node(kernel, c)->op, TensorOpConst);
+    CHECK_EQ(tensor_node(kernel, c)->float_value, 10);
+    CHECK_EQ(tensor_unary(kernel, TensorOpNeg, tensor_const(kernel, -10)), c);
+    tensor_kernel_free(kernel);
+
+    // Integer constants wrap around to the width of the elements, and dividing by 0 isn't folded
+    kernel = tensor_kernel_new("ints", AdoradTypeTensorInt16, 1, OutputArchAmd64);
+    c = tensor_binary(kernel, TensorOpAdd, tensor_const_int(kernel, 32767), tensor_const_int(kernel, 1));
+    CHECK_EQ(tensor_node(kernel, c)->int_value, -32768);
+    c = tensor_binary(kernel, TensorOpDiv, c, tensor_const_int(kernel, 0));
+    CHECK_EQ(tensor_node(kernel, c)->op, TensorOpDiv);
+    tensor_kernel_free(kernel);
+}
+
+TEST(Tensor, emit) {
+    TensorKernel* kernel = make_kernel(OutputArchAmd64);
+    char* code = emit(kernel);
+    CHECK_NOT_NULL(strstr(code, "void fused(float* restrict out, const float* restrict in0, "
+                                "const float* restrict in1, size_t n) {"));
+    CHECK_NOT_NULL(strstr(code, "_f32x4 __attribute__((vector_size(16)));"));
+    // One loop over the vectors, then one over what's left (and the one of the fallback)
+    CHECK_EQ(count(code, "for(; i + 4 <= n; i += 4) {"), 1);
+    CHECK_EQ(count(code, "for(; i < n; i++) {"), 2);
+    // Every input read, and the output written, once per element
+    CHECK_EQ(count(code, "__builtin_memcpy(&t0, in0 + i"), 1);
+    CHECK_EQ(count(code, "__builtin_memcpy(out + i"), 1);
+    CHECK_EQ(count(code, "out[i] = "), 2);
+    CHECK_NULL(strstr(code, "__builtin_cpu_supports"));
+    free(code);
+
+    // No vectors on an architecture we don't know the vectors of
+    TensorKernel* scalar = make_kernel(OutputArchRv64);
+    code = emit(scalar);
+    CHECK_NULL(strstr(code, "vector_size"));
+    CHECK_NULL(strstr(code, "#if"));
+    CHECK_EQ(count(code, "for(; i < n; i++) {"), 1);
+    free(code);
+    tensor_kernel_free(scalar);
+
+    // A version per ISA, and the entry point picking one
+    kernel->dispatch = true;
+    code = emit(kernel);
+    CHECK_NOT_NULL(strstr(code, "__attribute__((target(\"avx2\")))"));
+    CHECK_NOT_NULL(strstr(code, "__attribute__((target(\"avx512f,avx512bw\")))"));
+    CHECK_NOT_NULL(strstr(code, " fused__avx512(float* restrict out"));
+    CHECK_NOT_NULL(strstr(code, "_f32x16 __attribute__((vector_size(64)));"));
+    CHECK_NOT_NULL(strstr(code, "__builtin_cpu_supports(\"avx2\") ? fused__avx2 : fused__sse2;"));
+    CHECK_EQ(count(code, "for(; i + 8 <= n; i += 8) {"), 1);
+    CHECK_EQ(count(code, "void fused("), 2);
+    free(code);
+    tensor_kernel_free(kernel);
+}
+
+TEST(Tensor, isa) {
+    CHECK_EQ(tensor_isa_of_arch(OutputArchAmd64), TensorIsaSse2);
+    CHECK_EQ(tensor_isa_of_arch(OutputArchI386), TensorIsaSse2);
+    CHECK_EQ(tensor_isa_of_arch(OutputArchArm64), TensorIsaNeon);
+    CHECK_EQ(tensor_isa_of_arch(OutputArchRv32), TensorIsaScalar);
+    CHECK_EQ(tensor_isa_width(TensorIsaAvx2), 32);
+    CHECK_EQ(tensor_isa_width(TensorIsaScalar), 0);
+    CHECK_STREQ(tensor_isa_str(TensorIsaAvx512), "avx512");
+}
@@ -0,0 +1,126 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+static void write_source(const char* fname, const char* source) {
+    FILE* file = fopen(fname, "wb");
+    fputs(source, file);
+    fclose(file);
+}
+
+// The trace, in the Chrome format
+static char* chrome_str() {
+    FILE* stream = tmpfile();
+    trace_write_chrome(stream);
+    long len = ftell(stream);
+    rewind(stream);
+    char* str = cast(char*)calloc(cast(size_t)len + 1, 1);
+    fread(str, 1, cast(size_t)len, stream);
+    fclose(stream);
+    return str;
+}
+
+static UInt32 count(const char* str, const char* sub) {
+    UInt32 num = 0;
+    for(const char* at = strstr(str, sub); SOME(at); at = strstr(at + 1, sub))
+        num++;
+    return num;
+}
+
+static void* record_zones(void* arg) {
+    trace_thread_name("worker");
+    for(UInt32 i = 0; i < 3; i++) {
+        TRACE_ZONE("work", cast(const char*)arg) {
+            thread_yield();
+        }
+    }
+    return null;
+}
+
+TEST(Trace, zones) {
+    // Nothing is recorded until tracing is started
+    TRACE_ZONE("before", null) {}
+    CHECK_EQ(trace_num_events(), 0);
+
+    trace_start(0);
+    TRACE_ZONE("outer", "a.ad") {
+        TRACE_ZONE("inner", null) {}
+    }
+    Thread threads[2];
+    for(UInt32 i = 0; i < 2; i++)
+        REQUIRE_TRUE(thread_start(&threads[i], record_zones, i == 0 ? "x.ad" : "y.ad"));
+    for(UInt32 i = 0; i < 2; i++)
+        thread_join(&threads[i]);
+    trace_stop();
+    TRACE_ZONE("after", null) {}
+    CHECK_EQ(trace_num_events(), 8);
+    CHECK_EQ(trace_num_dropped(), 0);
+
+    char* json = chrome_str();
+    CHECK_EQ(strncmp(json, "{\"traceEvents\": [", 17), 0);
+    CHECK_EQ(count(json, "\"ph\": \"X\""), 8);
+    CHECK_EQ(count(json, "{\"name\": \"work\""), 6);
+    CHECK_EQ(count(json, "\"args\": {\"detail\": \"x.ad\"}"), 3);
+    CHECK_EQ(count(json, "\"args\": {\"detail\": \"a.ad\"}"), 1);
+    CHECK_EQ(count(json, "\"args\": {\"name\": \"worker\"}"), 2);
+    CHECK_NOT_NULL(strstr(json, "\"args\": {\"name\": \"main\"}"));
+    // The inner zone ends first
+    CHECK_TRUE(strstr(json, "\"inner\"") < strstr(json, "\"outer\""));
+    CHECK_NULL(strstr(json, "\"before\""));
+    CHECK_NULL(strstr(json, "\"after\""));
+    CHECK_NOT_NULL(strstr(json, "\"otherData\": {\"num_dropped\": 0}}"));
+    free(json);
+
+    trace_free();
+    CHECK_EQ(trace_num_events(), 0);
+}
+
+TEST(Trace, ring) {
+    // The oldest zones are overwritten
+    trace_start(3);
+    for(UInt32 i = 0; i < 10; i++) {
+        TRACE_ZONE(i < 6 ? "old" : "new", null) {}
+    }
+    CHECK_EQ(trace_num_events(), 4);
+    CHECK_EQ(trace_num_dropped(), 6);
+
+    // Long details keep their end, and are escaped
+    TRACE_ZONE("long", "some/very/long/directory/name/and/then/the/file\"name\".ad") {}
+    char* json = chrome_str();
+    CHECK_EQ(count(json, "\"new\""), 3);
+    CHECK_NULL(strstr(json, "\"old\""));
+    CHECK_NOT_NULL(strstr(json, "\"detail\": \"rectory/name/and/then/the/file\\\"name\\\".ad\"}"));
+    CHECK_NOT_NULL(strstr(json, "\"num_dropped\": 7}"));
+    free(json);
+    trace_free();
+}
+
+TEST(Trace, build) {
+    write_source("__trace_a.ad", "module a\n");
+    write_source("__trace_b.ad", "module a\n");
+    const char* fnames[] = { "__trace_a.ad", "__trace_b.ad" };
+
+    trace_start(0);
+    Build* build = build_files(fnames, 2, null);
+    CHECK_TRUE(build->ok);
+    build_free(build);
+    trace_stop();
+    // A zone per stage per file, and resolving the modules
+    CHECK_EQ(trace_num_events(), 2 * BuildStageCount + 1);
+    char* json = chrome_str();
+    for(UInt32 i = 0; i < BuildStageCount; i++) {
+        char pattern[64];
+        snprintf(pattern, sizeof(pattern), "{\"name\": \"%s\", \"ph\": \"X\"", build_stage_str(cast(BuildStage)i));
+        CHECK_EQ(count(json, pattern), 2);
+        // Every stage has a thread (the last one runs on the calling thread)
+        snprintf(pattern, sizeof(pattern), "\"args\": {\"name\": \"%s\"}", build_stage_str(cast(BuildStage)i));
+        CHECK_EQ(count(json, pattern), 1);
+    }
+    CHECK_EQ(count(json, "\"detail\": \"__trace_b.ad\""), BuildStageCount);
+    CHECK_EQ(count(json, "{\"name\": \"resolve\""), 1);
+    free(json);
+    trace_free();
+
+    remove("__trace_a.ad");
+    remove("__trace_b.ad");
+}
@@ -0,0 +1,101 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+TEST(TypeStore, primitives) {
+    TypeStore* store = type_store_new();
+    CHECK_EQ(type_store_len(store), AdoradTypeCount);
+    Type* type = type_store_get(store, TYPE_ID_OF(AdoradTypeFloat64));
+    CHECK_EQ(type->kind, TypeKindPrimitive);
+    CHECK_EQ(type->primitive, AdoradTypeFloat64);
+    CHECK_STREQ(type_primitive_str(AdoradTypeUInt16), "UInt16");
+    CHECK_STREQ(type_primitive_str(AdoradTypeQuaternion256), "Quaternion256");
+    type_store_free(store);
+}
+
+TEST(TypeStore, hash_consing) {
+    TypeStore* store = type_store_new();
+    TypeId int_id = TYPE_ID_OF(AdoradTypeInt);
+    TypeId bool_id = TYPE_ID_OF(AdoradTypeBool);
+
+    TypeId ptr = type_pointer_to(store, int_id);
+    TypeId slice = type_slice_of(store, ptr);
+    TypeId opt = type_optional_of(store, slice);
+    TypeId arr = type_array_of(store, int_id, 4);
+    TypeId params[] = { slice, bool_id };
+    TypeId func = type_func(store, params, 2, opt);
+    UInt32 len = type_store_len(store);
+    CHECK_EQ(len, AdoradTypeCount + 5);
+
+    // Asking again makes nothing new
+    for(UInt32 i = 0; i < 1000; i++) {
+        CHECK_EQ(type_optional_of(store, type_slice_of(store, type_pointer_to(store, int_id))), opt);
+        CHECK_EQ(type_array_of(store, int_id, 4), arr);
+        CHECK_EQ(type_func(store, params, 2, opt), func);
+    }
+    CHECK_EQ(type_store_len(store), len);
+
+    // ... while types that differ in any part are distinct
+    CHECK_NE(type_pointer_to(store, bool_id), ptr);
+    CHECK_NE(type_slice_of(store, int_id), slice);
+    CHECK_NE(type_array_of(store, int_id, 5), arr);
+    CHECK_NE(type_array_of(store, int_id, 4 + (1ull << 32)), arr);
+    CHECK_NE(type_array_of(store, bool_id, 4), arr);
+    CHECK_NE(type_func(store, params, 1, opt), func);
+    CHECK_NE(type_func(store, params, 2, int_id), func);
+    TypeId swapped[] = { bool_id, slice };
+    CHECK_NE(type_func(store, swapped, 2, opt), func);
+    CHECK_NE(type_func(store, null, 0, opt), func);
+
+    Type* type = type_store_get(store, func);
+    CHECK_EQ(type->kind, TypeKindFunc);
+    CHECK_EQ(type->num_args, 2);
+    CHECK_EQ(type->elem, opt);
+    CHECK_EQ(type_store_arg(store, func, 0)->type, slice);
+    CHECK_EQ(type_store_arg(store, func, 1)->type, bool_id);
+    CHECK_EQ(type_store_get(store, arr)->len, 4);
+    CHECK_EQ(type_store_get(store, int_id)->pointer, ptr);
+
+    // Functions with more parameters than fit in a key on the stack
+    TypeId many[100];
+    for(UInt32 i = 0; i < 100; i++)
+        many[i] = TYPE_ID_OF(i % AdoradTypeCount);
+    TypeId big = type_func(store, many, 100, int_id);
+    CHECK_EQ(type_func(store, many, 100, int_id), big);
+    CHECK_EQ(type_store_arg(store, big, 99)->type, many[99]);
+    type_store_free(store);
+}
+
+TEST(TypeStore, structs) {
+    TypeStore* store = type_store_new();
+    Interner* interner = interner_new();
+    SymbolId geo = interner_intern(interner, "geo", 3);
+    SymbolId point = interner_intern(interner, "Point", 5);
+    SymbolId x = interner_intern(interner, "x", 1);
+
+    TypeId id = type_struct(store, geo, point);
+    CHECK_FALSE(type_store_get(store, id)->is_complete);
+    // A struct may refer to itself (through a pointer) before its fields are set
+    TypeArg fields[] = { { x, TYPE_ID_OF(AdoradTypeFloat64) }, { point, type_pointer_to(store, id) } };
+    type_struct_set_fields(store, id, fields, 2);
+    CHECK_EQ(type_struct(store, geo, point), id);
+    CHECK_NE(type_struct(store, point, geo), id);
+    Type* type = type_store_get(store, id);
+    CHECK_TRUE(type->is_complete);
+    CHECK_EQ(type->num_args, 2);
+    CHECK_EQ(type_store_arg(store, id, 0)->name, x);
+    CHECK_EQ(type_store_arg(store, id, 1)->type, type_pointer_to(store, id));
+
+    char name[64];
+    TypeId params[] = { type_slice_of(store, type_pointer_to(store, id)), TYPE_ID_OF(AdoradTypeInt) };
+    TypeId func = type_func(store, params, 2, type_optional_of(store, type_array_of(store, id, 3)));
+    CHECK_EQ(type_format(store, func, interner, name, sizeof(name)), 37);
+    CHECK_STREQ(name, "func([]*geo.Point, Int) ?[3]geo.Point");
+    // Truncated
+    CHECK_EQ(type_format(store, func, interner, name, 8), 37);
+    CHECK_STREQ(name, "func([]");
+    type_format(store, id, null, name, sizeof(name));
+    CHECK_NE(strstr(name, "struct#"), null);
+    interner_free(interner);
+    type_store_free(store);
+}
@@ -0,0 +1,62 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+TEST(Unicode, categories) {
+    CHECK_EQ(unicode_category('A'), UTF8_CATEGORY_LU);
+    CHECK_EQ(unicode_category('z'), UTF8_CATEGORY_LL);
+    CHECK_EQ(unicode_category('7'), UTF8_CATEGORY_ND);
+    CHECK_EQ(unicode_category(' '), UTF8_CATEGORY_ZS);
+    CHECK_EQ(unicode_category('\n'), UTF8_CATEGORY_CC);
+    CHECK_EQ(unicode_category(0xE9), UTF8_CATEGORY_LL);      // é
+    CHECK_EQ(unicode_category(0x01C5), UTF8_CATEGORY_LT);    // ǅ
+    CHECK_EQ(unicode_category(0x0663), UTF8_CATEGORY_ND);    // Arabic-Indic 3
+    CHECK_EQ(unicode_category(0x20AC), UTF8_CATEGORY_SC);    // €
+    CHECK_EQ(unicode_category(0x2028), UTF8_CATEGORY_ZL);
+    CHECK_EQ(unicode_category(0xFEFF), UTF8_CATEGORY_CF);    // BOM
+    CHECK_EQ(unicode_category(0x1F600), UTF8_CATEGORY_SO);   // 😀
+    CHECK_EQ(unicode_category(0x10FFFF), UTF8_CATEGORY_CN);
+    CHECK_EQ(unicode_category(0x110000), UTF8_CATEGORY_CN);
+    CHECK_EQ(unicode_category(UInt32_MAX), UTF8_CATEGORY_CN);
+
+    // Whole ranges (which share blocks)
+    for(Rune rune = 0x4E00; rune <= 0x9FFF; rune++)          // CJK Unified Ideographs
+        CHECK_EQ(unicode_category(rune), UTF8_CATEGORY_LO);
+    for(Rune rune = 0xAC00; rune <= 0xD7A3; rune++)          // Hangul Syllables
+        CHECK_EQ(unicode_category(rune), UTF8_CATEGORY_LO);
+    for(Rune rune = 0xD800; rune <= 0xDFFF; rune++)
+        CHECK_EQ(unicode_category(rune), UTF8_CATEGORY_CS);
+    for(Rune rune = 0xE000; rune <= 0xF8FF; rune++)
+        CHECK_EQ(unicode_category(rune), UTF8_CATEGORY_CO);
+    CHECK_EQ(unicode_category(0xFFFE), UTF8_CATEGORY_CN);
+}
+
+TEST(Unicode, tables) {
+    // Every block points at one of the distinct blocks
+    UInt32 num_blocks = sizeof(unicodeBlocks) / sizeof(unicodeBlocks[0]);
+    CHECK_EQ(num_blocks << UNICODE_BLOCK_SHIFT, CORETEN_RUNE_MAX + 1);
+    UInt32 max_block = 0;
+    for(UInt32 i = 0; i < num_blocks; i++)
+        max_block = unicodeBlocks[i] > max_block ? unicodeBlocks[i] : max_block;
+    CHECK_EQ(max_block, UNICODE_NUM_BLOCKS - 1);
+    for(UInt32 i = 0; i < UNICODE_NUM_BLOCKS * UNICODE_BLOCK_SIZE; i++)
+        CHECK_LE(unicodeCategories[i], UTF8_CATEGORY_CO);
+}
+
+TEST(Unicode, identifiers) {
+    Rune starts[] = { '_', 'a', 'Z', 0xE9, 0x03BB, 0x4E2D, 0x2160 /* Ⅰ (Nl) */, 0x1D400 /* 𝐀 */, 0x02B0 /* ʰ (Lm) */ };
+    for(UInt32 i = 0; i < sizeof(starts) / sizeof(starts[0]); i++) {
+        CHECK_TRUE(unicode_is_ident_start(starts[i]));
+        CHECK_TRUE(unicode_is_ident_continue(starts[i]));
+    }
+    Rune continues[] = { '0', 0x0301 /* combining acute */, 0x0903 /* (Mc) */, 0x0663, 0x203F /* ‿ (Pc) */ };
+    for(UInt32 i = 0; i < sizeof(continues) / sizeof(continues[0]); i++) {
+        CHECK_FALSE(unicode_is_ident_start(continues[i]));
+        CHECK_TRUE(unicode_is_ident_continue(continues[i]));
+    }
+    Rune neither[] = { ' ', '+', '$', 0xA0 /* nbsp */, 0x20AC, 0x1F600, 0x2028, 0xE000 /* private use */, 0x110000 };
+    for(UInt32 i = 0; i < sizeof(neither) / sizeof(neither[0]); i++) {
+        CHECK_FALSE(unicode_is_ident_start(neither[i]));
+        CHECK_FALSE(unicode_is_ident_continue(neither[i]));
+    }
+}
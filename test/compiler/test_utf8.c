@@ -0,0 +1,89 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+TEST(UTF8, decode) {
+    Rune rune = 0;
+    CHECK_EQ(utf8_decode("a", 1, &rune), 1);
+    CHECK_EQ(rune, 'a');
+    CHECK_EQ(utf8_decode("\xC3\xA9", 2, &rune), 2);       // é
+    CHECK_EQ(rune, 0xE9);
+    CHECK_EQ(utf8_decode("\xE2\x82\xAC", 3, &rune), 3);   // €
+    CHECK_EQ(rune, 0x20AC);
+    CHECK_EQ(utf8_decode("\xF0\x9F\x98\x80", 4, &rune), 4);
+    CHECK_EQ(rune, 0x1F600);
+    CHECK_EQ(utf8_decode("\xF4\x8F\xBF\xBF", 4, &rune), 4);
+    CHECK_EQ(rune, 0x10FFFF);
+
+    rune = 42;
+    CHECK_EQ(utf8_decode("", 0, &rune), 0);
+    CHECK_EQ(utf8_decode("\x80", 1, &rune), 0);               // stray continuation byte
+    CHECK_EQ(utf8_decode("\xC0\xAF", 2, &rune), 0);           // overlong
+    CHECK_EQ(utf8_decode("\xE0\x80\xAF", 3, &rune), 0);       // overlong
+    CHECK_EQ(utf8_decode("\xF0\x8F\xBF\xBF", 4, &rune), 0);   // overlong
+    CHECK_EQ(utf8_decode("\xED\xA0\x80", 3, &rune), 0);       // surrogate
+    CHECK_EQ(utf8_decode("\xF4\x90\x80\x80", 4, &rune), 0);   // past U+10FFFF
+    CHECK_EQ(utf8_decode("\xF5\x80\x80\x80", 4, &rune), 0);
+    CHECK_EQ(utf8_decode("\xE2\x82", 2, &rune), 0);           // truncated
+    CHECK_EQ(utf8_decode("\xE2\x82\xAC", 2, &rune), 0);
+    CHECK_EQ(utf8_decode("\xE2\x28\xA1", 3, &rune), 0);       // not a continuation byte
+    CHECK_EQ(rune, 42);
+
+    // Every code point round-trips
+    for(Rune cp = 1; cp <= CORETEN_RUNE_MAX; cp++) {
+        if(cp >= 0xD800 && cp <= 0xDFFF)
+            continue;
+        char buff[4];
+        UInt32 len = cp < 0x80 ? 1 : cp < 0x800 ? 2 : cp < 0x10000 ? 3 : 4;
+        if(len == 1) {
+            buff[0] = cast(char)cp;
+        } else {
+            for(UInt32 i = len - 1; i > 0; i--)
+                buff[i] = cast(char)(0x80 | ((cp >> (6 * (len - 1 - i))) & 0x3F));
+            buff[0] = cast(char)((0xF00 >> len) | (cp >> (6 * (len - 1))));
+        }
+        if(utf8_decode(buff, len, &rune) != len || rune != cp) {
+            CHECK_EQ(rune, cp);
+            break;
+        }
+    }
+}
+
+TEST(UTF8, find_non_ascii) {
+    char buff[300];
+    memset(buff, 'a', sizeof(buff));
+    CHECK_EQ(utf8_find_non_ascii(buff, sizeof(buff)), sizeof(buff));
+    CHECK_TRUE(utf8_is_ascii(buff, sizeof(buff)));
+    CHECK_TRUE(utf8_is_ascii(buff, 0));
+
+    // At every offset (in every lane of a vector, and in the tail)
+    for(UInt32 i = 0; i < sizeof(buff); i++) {
+        buff[i] = cast(char)0x80;
+        CHECK_EQ(utf8_find_non_ascii(buff, sizeof(buff)), i);
+        CHECK_EQ(utf8_find_non_ascii(buff, i), i);
+        CHECK_FALSE(utf8_is_ascii(buff, sizeof(buff)));
+        buff[i] = cast(char)0xFF;
+        CHECK_EQ(utf8_find_non_ascii(buff, sizeof(buff)), i);
+        buff[i] = 'a';
+    }
+}
+
+TEST(UTF8, validate) {
+    char* valid = "put x = 1 // caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80 \xE4\xB8\xAD\xE6\x96\x87\n";
+    CHECK_EQ(utf8_validate(valid, strlen(valid)), strlen(valid));
+    CHECK_EQ(utf8_validate("", 0), 0);
+
+    // An invalid byte is found wherever it is (after ASCII, after another non-ASCII character, or in the tail)
+    char buff[200];
+    for(UInt32 i = 0; i + 4 < sizeof(buff); i++) {
+        memset(buff, 'x', sizeof(buff));
+        memcpy(buff + i, "\xC3\xA9", 2);
+        CHECK_EQ(utf8_validate(buff, sizeof(buff)), sizeof(buff));
+        buff[i + 2] = cast(char)0xA9;
+        CHECK_EQ(utf8_validate(buff, sizeof(buff)), i + 2);
+        buff[i + 2] = cast(char)0xE2;
+        CHECK_EQ(utf8_validate(buff, sizeof(buff)), i + 2);
+        // Truncated by the end of the buffer
+        CHECK_EQ(utf8_validate(buff, i + 1), i);
+    }
+}
@@ -0,0 +1,64 @@
+#include <AdoradInternalTests/AdoradInternalTests.h>
+#include <tau/tau.h>
+TAU_MAIN()
+
+typedef struct {
+    UInt32 a;
+    UInt64 b;
+} Pair;
+
+VEC_DEFINE(Pair)
+
+TEST(Vec, typed) {
+    Vec* vec = VEC_NEW(Pair, 1);
+    for(UInt32 i = 0; i < 1000; i++) {
+        Pair pair = { i, cast(UInt64)i * i };
+        CHECK_TRUE(vec_push_Pair(vec, &pair));
+    }
+    CHECK_EQ(vec_size(vec), 1000);
+    CHECK_GE(vec_cap(vec), 1000);
+    for(UInt32 i = 0; i < 1000; i++) {
+        CHECK_EQ(vec_at_Pair(vec, i)->a, i);
+        CHECK_EQ(vec_at_Pair(vec, i)->b, cast(UInt64)i * i);
+    }
+    // The typed and untyped accessors agree
+    CHECK_EQ(cast(void*)vec_at_Pair(vec, 42), vec_at(vec, 42));
+
+    CHECK_TRUE(vec_reserve_Pair(vec, 5000));
+    CHECK_GE(vec_cap(vec), 5000);
+    CHECK_EQ(vec_size(vec), 1000);
+    CHECK_EQ(vec_at_Pair(vec, 999)->a, 999);
+    vec_free(vec);
+}
+
+TEST(Vec, extend) {
+    Pair pairs[100];
+    for(UInt32 i = 0; i < 100; i++) {
+        pairs[i].a = i;
+        pairs[i].b = 100 - i;
+    }
+
+    Vec* vec = VEC_NEW(Pair, 1);
+    CHECK_TRUE(vec_extend_Pair(vec, pairs, 0));
+    CHECK_EQ(vec_size(vec), 0);
+    CHECK_TRUE(vec_extend_Pair(vec, pairs, 100));
+    CHECK_TRUE(vec_extend(vec, pairs + 50, 50));
+    CHECK_EQ(vec_size(vec), 150);
+    for(UInt32 i = 0; i < 150; i++) {
+        UInt32 want = i < 100 ? i : i - 50;
+        CHECK_EQ(vec_at_Pair(vec, i)->a, want);
+        CHECK_EQ(vec_at_Pair(vec, i)->b, 100 - want);
+    }
+    vec_free(vec);
+}
+
+TEST(Vec, tokens) {
+    // The lexer pushes its tokens through `vec_push_Token()`
+    char* source = "put int x = 1\nput int y = x\n";
+    Lexer* lexer = lexer_init(source, null);
+    lexer_lex(lexer);
+    CHECK_EQ(vec_size(lexer->toklist), lexer->num_tokens);
+    CHECK_EQ(vec_at_Token(lexer->toklist, 0)->kind, PUT);
+    CHECK_EQ(vec_at_Token(lexer->toklist, lexer->num_tokens - 1)->kind, TOK_EOF);
+    lexer_free(lexer);
+}
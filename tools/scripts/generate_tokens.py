@@ -2,6 +2,11 @@
 # The files are (relative to the root) are:
 #   1. adorad/compiler/tokens/token.h
 #   2. adorad/compiler/tokens/token.c
+#   3. adorad/compiler/keywords.h (the keyword perfect hash - `keyword_hash`)
+#   4. adorad/compiler/charclass.h and adorad/compiler/charclass.c (the character-class table - `char_classes`)
+#   5. adorad/compiler/precedence.h and adorad/compiler/precedence.c (the binary operator table - `precedence`)
+#   6. adorad/compiler/powers.c (the 128-bit powers of ten used to convert float literals - `powers_of_ten`)
+#   7. adorad/compiler/unicode.h and adorad/compiler/unicode.c (the Unicode category tables - `unicode`)
 
 NT_OFFSET = 256 
 
@@ -245,6 +250,484 @@ def make_token_py(infile, outfile='adorad/compiler/tokens/tokens.py'):
         print("%s regenerated from %s" % (outfile, infile))
 
 
+keyword_hash_template = """\
+// Auto-generated by tools/scripts/generate_tokens.py
+// DO NOT EDIT - regenerate with:
+//     python tools/scripts/generate_tokens.py keyword_hash adorad/compiler/tokens.h adorad/compiler/keywords.h
+
+#ifndef ADORAD_KEYWORDS_H
+#define ADORAD_KEYWORDS_H
+
+#include <adorad/core/types.h>
+#include <adorad/compiler/tokens.h>
+
+/*
+    Collision-free perfect hash for the keywords in `ALLTOKENS` (TOK___KEYWORDS_BEGIN..TOK___KEYWORDS_END).
+    A keyword is classified with one hash and one compare (see `is_keyword_or_identifier()` in lexer.c).
+*/
+#define KEYWORD_COUNT       %d
+#define KEYWORD_MIN_LENGTH  %d
+#define KEYWORD_MAX_LENGTH  %d
+#define KEYWORD_HASH_BITS   %d
+#define KEYWORD_TABLE_SIZE  (1 << KEYWORD_HASH_BITS)
+
+// If this fails, `ALLTOKENS` has changed and this file must be regenerated
+CORETEN_STATIC_ASSERT(TOK___KEYWORDS_END - TOK___KEYWORDS_BEGIN - 2 == KEYWORD_COUNT);
+
+// Packs the first two and last two characters of a keyword candidate (along with its length) into a single word
+// `len` must be in [KEYWORD_MIN_LENGTH, KEYWORD_MAX_LENGTH]
+static inline UInt32 keyword_hash(const char* data, UInt32 len) {
+    const UInt8* s = cast(const UInt8*)data;
+    UInt32 key = (s[0] | (s[1] << 8) | (s[len - 2] << 16) | (cast(UInt32)s[len - 1] << 24)) ^ len;
+    return cast(UInt32)(key * 0x%08Xu) >> (32 - KEYWORD_HASH_BITS);
+}
+
+// Maps `keyword_hash()` to a keyword TokenKind (TOK_NULL for empty slots)
+static const UInt8 keywordTable[KEYWORD_TABLE_SIZE] = {
+%s\
+};
+
+#endif // ADORAD_KEYWORDS_H
+"""
+
+def load_keywords(path):
+    # Returns the (name, string) pairs between TOK___KEYWORDS_BEGIN and TOK___KEYWORDS_END in `ALLTOKENS`
+    import re
+    keywords = []
+    inside = False
+    with open(path) as fp:
+        for line in fp:
+            m = re.search(r'TOKENKIND\(\s*(\w+)\s*,\s*"([^"]*)"\s*\)', line)
+            if not m:
+                continue
+            name, string = m.groups()
+            if name == 'TOK___KEYWORDS_BEGIN':
+                inside = True
+            elif name == 'TOK___KEYWORDS_END':
+                break
+            elif inside and string:
+                keywords.append((name, string))
+    return keywords
+
+
+def keyword_key(kwd):
+    # Must match `keyword_hash()` in keyword_hash_template
+    s = kwd.encode()
+    return (s[0] | (s[1] << 8) | (s[-2] << 16) | (s[-1] << 24)) ^ len(kwd)
+
+
+def find_keyword_hash(keywords, max_tries=1 << 20):
+    # Search (deterministically) for a multiplier that makes `keyword_hash()` collision-free, starting with the
+    # smallest table that can hold every keyword
+    assert min(len(kwd) for _, kwd in keywords) >= 2
+    keys = [(name, keyword_key(kwd)) for name, kwd in keywords]
+    assert len(set(key for _, key in keys)) == len(keys)
+
+    bits = 1
+    while (1 << bits) < len(keywords):
+        bits += 1
+    while True:
+        state = 1
+        for _ in range(max_tries):
+            state = (state * 6364136223846793005 + 1442695040888963407) & 0xFFFFFFFFFFFFFFFF
+            mult = (state >> 32) | 1
+            slots = {}
+            for name, key in keys:
+                h = ((key * mult) & 0xFFFFFFFF) >> (32 - bits)
+                if h in slots:
+                    break
+                slots[h] = name
+            else:
+                return bits, mult, slots
+        bits += 1
+
+
+def make_keyword_hash(infile='adorad/compiler/tokens.h', outfile='adorad/compiler/keywords.h'):
+    keywords = load_keywords(infile)
+    bits, mult, slots = find_keyword_hash(keywords)
+
+    entries = []
+    for h in range(1 << bits):
+        entries.append('    %s,\n' % slots.get(h, 'TOK_NULL'))
+
+    if update_file(outfile, keyword_hash_template % (
+            len(keywords),
+            min(len(kwd) for _, kwd in keywords),
+            max(len(kwd) for _, kwd in keywords),
+            bits,
+            mult,
+            ''.join(entries)
+        )):
+        print("%s regenerated from %s" % (outfile, infile))
+
+
+char_class_h_template = """\
+// Auto-generated by tools/scripts/generate_tokens.py
+// DO NOT EDIT - regenerate with:
+//     python tools/scripts/generate_tokens.py char_classes adorad/compiler/charclass.h adorad/compiler/charclass.c
+
+#ifndef ADORAD_CHARCLASS_H
+#define ADORAD_CHARCLASS_H
+
+#include <adorad/core/types.h>
+
+/*
+    Character classes used by the Lexer. `charClassTable` maps every byte to the set of classes it belongs to, so
+    classifying a character is one load and one mask (see `CHAR_IS()`).
+    Bytes >= 0x80 belong to no class.
+*/
+%s\
+
+extern const UInt8 charClassTable[256];
+
+// The classes of `c`
+#define CHAR_CLASS(c)           (charClassTable[cast(UInt8)(c)])
+// Is `c` in any of the classes in `classes`?
+#define CHAR_IS(c, classes)     ((CHAR_CLASS(c) & (classes)) != 0)
+
+#endif // ADORAD_CHARCLASS_H
+"""
+
+char_class_c_template = """\
+// Auto-generated by tools/scripts/generate_tokens.py
+// DO NOT EDIT - regenerate with:
+//     python tools/scripts/generate_tokens.py char_classes adorad/compiler/charclass.h adorad/compiler/charclass.c
+
+#include <adorad/compiler/charclass.h>
+
+const UInt8 charClassTable[256] = {
+%s\
+};
+"""
+
+LOWER = 'abcdefghijklmnopqrstuvwxyz'
+UPPER = LOWER.upper()
+DIGITS = '0123456789'
+
+# (name, members, description) - in bit order
+CHAR_CLASSES = (
+    ('CHAR_BLANK',       ' \t\r\v\f',              "' ', '\\t', '\\r', '\\v' and '\\f' (_not_ '\\n')"),
+    ('CHAR_ALPHA',       LOWER + UPPER,               '[A-Za-z]'),
+    ('CHAR_IDENT_START', LOWER + UPPER + '_',         '[A-Za-z_] - begins an identifier'),
+    ('CHAR_IDENT',       LOWER + UPPER + DIGITS + '_', '[A-Za-z0-9_] - continues an identifier (or a macro/attribute name)'),
+    ('CHAR_DIGIT',       DIGITS,                      '[0-9]'),
+    ('CHAR_HEX_DIGIT',   DIGITS + 'abcdefABCDEF',     '[0-9A-Fa-f]'),
+    ('CHAR_OCT_DIGIT',   '01234567',                  '[0-7]'),
+    ('CHAR_BIN_DIGIT',   '01',                        '[01]'),
+)
+
+
+def char_literal(c):
+    if c == "\\" or c == "'":
+        return "'\\%s'" % c
+    if 0x20 <= ord(c) < 0x7f:
+        return "'%s'" % c
+    return '0x%02X' % ord(c)
+
+
+def make_char_classes(header='adorad/compiler/charclass.h', source='adorad/compiler/charclass.c'):
+    assert len(CHAR_CLASSES) <= 8
+
+    defines = []
+    for bit, (name, _, desc) in enumerate(CHAR_CLASSES):
+        defines.append('#define %-18s 0x%02X    // %s\n' % (name, 1 << bit, desc))
+
+    entries = []
+    for byte in range(256):
+        c = chr(byte)
+        names = [name for name, members, _ in CHAR_CLASSES if c in members]
+        value = ' | '.join(names) if names else '0'
+        entries.append('    /* %-4s */ %s,\n' % (char_literal(c), value))
+
+    regenerated = update_file(header, char_class_h_template % ''.join(defines))
+    regenerated = update_file(source, char_class_c_template % ''.join(entries)) or regenerated
+    if regenerated:
+        print("%s and %s regenerated" % (header, source))
+
+
+precedence_h_template = """\
+// Auto-generated by tools/scripts/generate_tokens.py
+// DO NOT EDIT - regenerate with:
+//     python tools/scripts/generate_tokens.py precedence adorad/compiler/tokens.h adorad/compiler/precedence.h adorad/compiler/precedence.c
+
+#ifndef ADORAD_PRECEDENCE_H
+#define ADORAD_PRECEDENCE_H
+
+#include <adorad/core/types.h>
+#include <adorad/compiler/tokens.h>
+#include <adorad/compiler/ast.h>
+
+/*
+    Binary operator table, indexed by TokenKind. Every token has an entry - tokens that aren't binary operators have
+    a precedence of PREC_NONE (and BinaryOpKindInvalid), so the Parser finds out both whether a token is a binary
+    operator and how strongly it binds with a single load (see `ast_parse_precedence()` in parser.c).
+    Higher precedence values bind more strongly.
+*/
+#define PREC_NONE       0
+
+typedef struct BinaryOpInfo {
+    UInt8 prec;
+    UInt8 op;       // BinaryOpKind
+} BinaryOpInfo;
+
+extern const BinaryOpInfo binaryOpTable[TOK_COUNT];
+
+// Precedence of `kind` (PREC_NONE if it isn't a binary operator)
+#define BINOP_PRECEDENCE(kind)      (binaryOpTable[(kind)].prec)
+// BinaryOpKind of `kind` (BinaryOpKindInvalid if it isn't a binary operator)
+#define BINOP_KIND(kind)            (cast(BinaryOpKind)binaryOpTable[(kind)].op)
+
+#endif // ADORAD_PRECEDENCE_H
+"""
+
+precedence_c_template = """\
+// Auto-generated by tools/scripts/generate_tokens.py
+// DO NOT EDIT - regenerate with:
+//     python tools/scripts/generate_tokens.py precedence adorad/compiler/tokens.h adorad/compiler/precedence.h adorad/compiler/precedence.c
+
+#include <adorad/compiler/precedence.h>
+
+// If this fails, `ALLTOKENS` has changed and this file must be regenerated
+CORETEN_STATIC_ASSERT(TOK_COUNT == %d);
+
+const BinaryOpInfo binaryOpTable[TOK_COUNT] = {
+%s\
+};
+"""
+
+# (token, precedence, BinaryOpKind) - from strong to weak. Binary Operators of the same precedence value
+# are grouped together in the order given by their associativity.
+BINARY_OPERATORS = (
+    # ('MULT_MULT', 60, 'BinaryOpKindMultMult'),
+    ('MULT',  60, 'BinaryOpKindMult'),
+    ('MOD',   60, 'BinaryOpKindMod'),
+    ('SLASH', 60, 'BinaryOpKindDiv'),
+
+    ('PLUS',         50, 'BinaryOpKindAdd'),
+    ('MINUS',        50, 'BinaryOpKindSubtract'),
+    ('PLUS_EQUALS',  50, 'BinaryOpKindAssignmentPlus'),
+    ('MINUS_EQUALS', 50, 'BinaryOpKindAssignmentMinus'),
+
+    ('LBITSHIFT', 40, 'BinaryOpKindBitshitLeft'),
+    ('RBITSHIFT', 40, 'BinaryOpKindBitshitRight'),
+
+    ('LESS_THAN',                30, 'BinaryOpKindCmpLessThan'),
+    ('GREATER_THAN',             30, 'BinaryOpKindCmpGreaterThan'),
+    ('EQUALS_EQUALS',            30, 'BinaryOpKindCmpEqual'),
+    ('EXCLAMATION_EQUALS',       30, 'BinaryOpKindCmpNotEqual'),
+    ('LESS_THAN_OR_EQUAL_TO',    30, 'BinaryOpKindCmpLessThanorEqualTo'),
+    ('GREATER_THAN_OR_EQUAL_TO', 30, 'BinaryOpKindCmpGreaterThanorEqualTo'),
+
+    ('AND', 20, 'BinaryOpKindBoolAnd'),
+
+    ('OR',  10, 'BinaryOpKindBoolOr'),
+)
+
+
+def load_token_kinds(path):
+    # Returns the names in `ALLTOKENS`, in order (ie. indexed by TokenKind), up to (but excluding) TOK_COUNT
+    import re
+    kinds = []
+    with open(path) as fp:
+        for line in fp:
+            m = re.search(r'TOKENKIND\(\s*(\w+)', line)
+            if not m or m.group(1) == 'kind':
+                continue
+            if m.group(1) == 'TOK_COUNT':
+                return kinds
+            kinds.append(m.group(1))
+    raise ValueError('TOK_COUNT not found in %s' % path)
+
+
+def make_precedence(infile='adorad/compiler/tokens.h', header='adorad/compiler/precedence.h',
+                    source='adorad/compiler/precedence.c'):
+    kinds = load_token_kinds(infile)
+    ops = {}
+    for tok, prec, op in BINARY_OPERATORS:
+        assert tok in kinds and tok not in ops and 0 < prec <= 255, tok
+        ops[tok] = (prec, op)
+
+    width = max(len(kind) for kind in kinds) + 2
+    entries = []
+    for kind in kinds:
+        prec, op = ops.get(kind, ('PREC_NONE', 'BinaryOpKindInvalid'))
+        entries.append('    %-*s = { %s, %s },\n' % (width, '[%s]' % kind, prec, op))
+
+    regenerated = update_file(header, precedence_h_template)
+    regenerated = update_file(source, precedence_c_template % (len(kinds), ''.join(entries))) or regenerated
+    if regenerated:
+        print("%s and %s regenerated from %s" % (header, source, infile))
+
+
+powers_c_template = """\
+// Auto-generated by tools/scripts/generate_tokens.py
+// DO NOT EDIT - regenerate with:
+//     python tools/scripts/generate_tokens.py powers_of_ten adorad/compiler/powers.c
+
+#include <adorad/compiler/number.h>
+
+// `numberPowersOfTen[i]` is the 128-bit mantissa of 10^(i + NUMBER_POW10_MIN), normalized so that its top bit is
+// set and rounded down, as `{ low 64 bits, high 64 bits }`
+const UInt64 numberPowersOfTen[NUMBER_POW10_MAX - NUMBER_POW10_MIN + 1][2] = {
+%s};
+"""
+
+POW10_MIN = -348
+POW10_MAX = 347
+
+def pow10_mantissa(e):
+    # floor(10^e * 2^k), for the `k` that puts the top bit at bit 127
+    if e >= 0:
+        value = 10 ** e
+        bits = value.bit_length()
+        return value >> (bits - 128) if bits > 128 else value << (128 - bits)
+    divisor = 10 ** -e
+    k = 127 + divisor.bit_length()
+    value = (1 << k) // divisor
+    while value.bit_length() < 128:
+        k += 1
+        value = (1 << k) // divisor
+    return value
+
+
+def make_powers_of_ten(source='adorad/compiler/powers.c'):
+    entries = []
+    for e in range(POW10_MIN, POW10_MAX + 1):
+        value = pow10_mantissa(e)
+        assert value.bit_length() == 128
+        entries.append('    { 0x%016XULL, 0x%016XULL }, // 1e%d\n' % (value & ((1 << 64) - 1), value >> 64, e))
+
+    if update_file(source, powers_c_template % ''.join(entries)):
+        print("%s regenerated" % source)
+
+
+unicode_h_template = """\
+// Auto-generated by tools/scripts/generate_tokens.py
+// DO NOT EDIT - regenerate with:
+//     python tools/scripts/generate_tokens.py unicode adorad/compiler/unicode.h adorad/compiler/unicode.c
+
+#ifndef ADORAD_UNICODE_H
+#define ADORAD_UNICODE_H
+
+#include <adorad/core/misc.h>
+#include <adorad/core/types.h>
+#include <adorad/core/utf8.h>
+
+/*
+    Unicode properties of code points, as two-stage tables (generated from the Unicode Character Database).
+    The code points are split into blocks of `UNICODE_BLOCK_SIZE`. Blocks with the same properties are only stored
+    once (in `unicodeCategories`), and `unicodeBlocks` maps every block to its index there - so a lookup is two loads.
+*/
+#define UNICODE_VERSION         "%(version)s"
+#define UNICODE_BLOCK_SHIFT     %(shift)d
+#define UNICODE_BLOCK_SIZE      (1 << UNICODE_BLOCK_SHIFT)
+#define UNICODE_NUM_BLOCKS      %(num_blocks)d  // distinct blocks
+
+extern const UInt8 unicodeBlocks[(CORETEN_RUNE_MAX + 1) >> UNICODE_BLOCK_SHIFT];
+// The general category (a `cstlUTF8Category`) of every code point of every distinct block
+extern const UInt8 unicodeCategories[UNICODE_NUM_BLOCKS * UNICODE_BLOCK_SIZE];
+
+// Returns the general category of `rune` (UTF8_CATEGORY_CN past U+10FFFF)
+cstlUTF8Category unicode_category(Rune rune);
+
+/*
+    Identifiers (following the default syntax of UAX #31 - https://unicode.org/reports/tr31/)
+    An identifier begins with a letter (Lu, Ll, Lt, Lm, Lo), a letter number (Nl) or `_`, and continues with any of
+    those, a mark (Mn, Mc), a decimal digit (Nd) or a connector (Pc).
+    These are whole code points - the Lexer classifies ASCII with its own (cheaper) table first.
+*/
+// Can `rune` begin an identifier?
+bool unicode_is_ident_start(Rune rune);
+// Can `rune` continue an identifier?
+bool unicode_is_ident_continue(Rune rune);
+
+#endif // ADORAD_UNICODE_H
+"""
+
+unicode_c_template = """\
+// Auto-generated by tools/scripts/generate_tokens.py
+// DO NOT EDIT - regenerate with:
+//     python tools/scripts/generate_tokens.py unicode adorad/compiler/unicode.h adorad/compiler/unicode.c
+
+#include <adorad/compiler/unicode.h>
+
+const UInt8 unicodeBlocks[(CORETEN_RUNE_MAX + 1) >> UNICODE_BLOCK_SHIFT] = {
+%(blocks)s\
+};
+
+const UInt8 unicodeCategories[UNICODE_NUM_BLOCKS * UNICODE_BLOCK_SIZE] = {
+%(categories)s\
+};
+
+cstlUTF8Category unicode_category(Rune rune) {
+    if(rune > CORETEN_RUNE_MAX)
+        return UTF8_CATEGORY_CN;
+    UInt32 block = unicodeBlocks[rune >> UNICODE_BLOCK_SHIFT];
+    return cast(cstlUTF8Category)unicodeCategories[(block << UNICODE_BLOCK_SHIFT) | (rune & (UNICODE_BLOCK_SIZE - 1))];
+}
+
+// The categories of identifiers, as bitmasks (there are fewer than 32)
+#define UNICODE_IDENT_START_CATEGORIES                                                              \\
+    ((1u << UTF8_CATEGORY_LU) | (1u << UTF8_CATEGORY_LL) | (1u << UTF8_CATEGORY_LT) |               \\
+     (1u << UTF8_CATEGORY_LM) | (1u << UTF8_CATEGORY_LO) | (1u << UTF8_CATEGORY_NL))
+#define UNICODE_IDENT_CONTINUE_CATEGORIES                                                           \\
+    (UNICODE_IDENT_START_CATEGORIES | (1u << UTF8_CATEGORY_MN) | (1u << UTF8_CATEGORY_MC) |         \\
+     (1u << UTF8_CATEGORY_ND) | (1u << UTF8_CATEGORY_PC))
+
+bool unicode_is_ident_start(Rune rune) {
+    return rune == '_' || ((1u << unicode_category(rune)) & UNICODE_IDENT_START_CATEGORIES) != 0;
+}
+
+bool unicode_is_ident_continue(Rune rune) {
+    return ((1u << unicode_category(rune)) & UNICODE_IDENT_CONTINUE_CATEGORIES) != 0;
+}
+"""
+
+# In the order of `cstlUTF8Category` (see adorad/core/utf8.h)
+UNICODE_CATEGORIES = ('Cn', 'Lu', 'Ll', 'Lt', 'Lm', 'Lo', 'Mn', 'Mc', 'Me', 'Nd', 'Nl', 'No', 'Pc', 'Pd', 'Ps', 'Pe',
+                      'Pi', 'Pf', 'Po', 'Sm', 'Sc', 'Sk', 'So', 'Zs', 'Zl', 'Zp', 'Cc', 'Cf', 'Cs', 'Co')
+UNICODE_MAX = 0x10FFFF
+
+
+def format_table(values, per_line=20):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('    ' + ', '.join('%d' % v for v in values[i:i + per_line]) + ',\n')
+    return ''.join(lines)
+
+
+def make_unicode(header='adorad/compiler/unicode.h', source='adorad/compiler/unicode.c', shift=7):
+    import unicodedata
+
+    index = {name: i for i, name in enumerate(UNICODE_CATEGORIES)}
+    categories = [index[unicodedata.category(chr(c))] for c in range(UNICODE_MAX + 1)]
+
+    # Deduplicate the blocks (in the order they're first seen)
+    size = 1 << shift
+    block_index = {}
+    blocks = []
+    leaves = []
+    for b in range((UNICODE_MAX + 1) >> shift):
+        block = tuple(categories[b * size:(b + 1) * size])
+        if block not in block_index:
+            block_index[block] = len(block_index)
+            leaves.extend(block)
+        blocks.append(block_index[block])
+    assert len(block_index) <= 256, 'The blocks no longer fit in a byte - use a smaller `shift`'
+
+    args = {
+        'version': unicodedata.unidata_version,
+        'shift': shift,
+        'num_blocks': len(block_index),
+        'blocks': format_table(blocks),
+        'categories': format_table(leaves),
+    }
+    regenerated = update_file(header, unicode_h_template % args)
+    regenerated = update_file(source, unicode_c_template % args) or regenerated
+    if regenerated:
+        print("%s and %s regenerated (Unicode %s)" % (header, source, unicodedata.unidata_version))
+
+
 def mainfunc(op, infile='adorad/compiler/tokens', *args):
     make = globals()['make_' + op]
     make(infile, *args)